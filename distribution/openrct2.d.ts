@@ -15,7 +15,13 @@
 //   /// <reference path="/path/to/openrct2.d.ts" />
 //
 
-export type PluginType = "local" | "remote";
+/**
+ * local: runs on the game thread and is not sent to clients.
+ * remote: runs on the game thread and is sent to clients by the server.
+ * worker: runs in its own context on a separate thread. Only console and worker are available, the plugin
+ *         receives copies of the events it subscribes to and can not access or modify the game state.
+ */
+export type PluginType = "local" | "remote" | "worker";
 
 declare global {
     /**
@@ -37,6 +43,8 @@ declare global {
     var park: Park;
     /** APIs for the current scenario. */
     var scenario: Scenario;
+    /** APIs for worker plugins, only available to plugins of type worker. */
+    var worker: WorkerApi;
     /** APIs for the climate and weather. */
     var climate: Climate;
     /**
@@ -124,6 +132,34 @@ declare global {
         verticalG: number;
     }
 
+    /**
+     * The API available to worker plugins instead of the other globals.
+     */
+    interface WorkerApi {
+        /**
+         * Subscribes to a copy of the given hook's event. The events are delivered in order on the worker
+         * thread, events are dropped if the worker can not keep up. Hooks that have no event arguments,
+         * such as interval.day, receive a WorkerParkSnapshot.
+         */
+        subscribe(hook: HookType, callback: (e: any) => void): void;
+    }
+
+    interface WorkerParkSnapshot {
+        date: {
+            year: number;
+            month: number;
+            day: number;
+            monthsElapsed: number;
+            ticksElapsed: number;
+        };
+        park: {
+            rating: number;
+            guests: number;
+            cash: number;
+            companyValue: number;
+        };
+    }
+
     /**
      * Represents information about the plugin such as type, name, author and version.
      * It also includes the entry point.
@@ -186,6 +222,8 @@ declare global {
         /**
          * Render the current state of the map and save to disc.
          * Useful for server administration and timelapse creation.
+         * Captures of a view with a filename are rendered straight away but written
+         * to disc in the background, so the file may appear shortly after this returns.
          * @param options Options that control the capture and output file.
          */
         captureImage(options: CaptureOptions): void;
@@ -252,6 +290,23 @@ declare global {
         executeAction(action: ActionType, args: object, callback: (result: GameActionResult) => void): void;
         executeAction(action: string, args: object, callback: (result: GameActionResult) => void): void;
 
+        /**
+         * Query the result of running several built-in game actions as one batch. The batch fails with the result of
+         * the first action that fails.
+         * @param actions The actions and their parameters.
+         * @param callback The function to be called with the combined result of the actions.
+         */
+        queryActions(actions: BatchedAction[], callback: (result: GameActionResult) => void): void;
+
+        /**
+         * Executes several built-in game actions as one batch. In a network game, the batch is sent to the server
+         * as a single action and applied in one pass. Actions that fail because of an earlier action in the batch
+         * are skipped, the batch only fails when none of its actions could be applied.
+         * @param actions The actions and their parameters.
+         * @param callback The function to be called with the combined result of the actions.
+         */
+        executeActions(actions: BatchedAction[], callback: (result: GameActionResult) => void): void;
+
         /**
          * Subscribes to the given hook.
          */
@@ -297,6 +352,41 @@ declare global {
          * @param handle The numerical handle of the registered timeout to remove.
          */
         clearTimeout(handle: number): void;
+
+        /**
+         * Gets the time spent in the callbacks of each plugin, per hook or category such as "interval".
+         * The most expensive entries are first.
+         */
+        getPerformanceStats(): PluginPerformanceStats[];
+
+        /**
+         * Resets the counters returned by getPerformanceStats.
+         */
+        resetPerformanceStats(): void;
+
+        /**
+         * Gets the bytes held by each subsystem of the game, such as "tile_elements", "object_images"
+         * or "scripting" for the heaps of all plugins.
+         */
+        getMemoryUsage(): MemoryUsage[];
+    }
+
+    interface MemoryUsage {
+        readonly category: string;
+        readonly bytes: number;
+    }
+
+    interface PluginPerformanceStats {
+        readonly plugin: string;
+        /** The hook, "interval", "action.custom.query", "action.custom.execute" or "callback" for other callbacks. */
+        readonly category: string;
+        readonly calls: number;
+        /** The number of calls that took longer than the call_time_budget setting. */
+        readonly overBudgetCalls: number;
+        /** The total time spent in microseconds. */
+        readonly totalTime: number;
+        /** The time of the slowest call in microseconds. */
+        readonly maxTime: number;
     }
 
     interface Configuration {
@@ -444,6 +534,7 @@ declare global {
         "signsetname" |
         "smallsceneryplace" |
         "smallsceneryremove" |
+        "smallsceneryscatter" |
         "stafffire" |
         "staffhire" |
         "staffsetcolour" |
@@ -473,6 +564,11 @@ declare global {
         result: GameActionResult;
     }
 
+    interface BatchedAction {
+        action: ActionType;
+        args: object;
+    }
+
     interface GameActionResult {
         error?: number;
         errorTitle?: string;
@@ -579,9 +675,56 @@ declare global {
         getAllEntities(type: "staff"): Staff[];
         getAllEntities(type: "car"): Car[];
         getAllEntities(type: "litter"): Litter[];
+        /**
+         * Gets the surface and footpath data of a rectangular range of tiles in one call.
+         * This is much faster than calling getTile for every tile of a large area.
+         * @param x The x coordinate of the first tile.
+         * @param y The y coordinate of the first tile.
+         * @param width The number of tiles on the x axis.
+         * @param height The number of tiles on the y axis.
+         */
+        getTileData(x: number, y: number, width: number, height: number): TileData;
+        /**
+         * Gets the id and position of all entities of the given type in one call.
+         * This is much faster than getAllEntities when only the positions are needed.
+         */
+        getEntityData(type: EntityType): EntityData;
         createEntity(type: EntityType, initializer: object): Entity;
     }
 
+    /**
+     * Data of a range of tiles returned by map.getTileData. Each array has one entry per tile,
+     * the entry for a tile is at index (y - this.y) * this.width + (x - this.x).
+     */
+    interface TileData {
+        readonly x: number;
+        readonly y: number;
+        readonly width: number;
+        readonly height: number;
+        /** The base height of the surface element. */
+        readonly surfaceHeight: Uint8Array;
+        /** The water height of the surface element, 0 if there is no water. */
+        readonly waterHeight: Uint16Array;
+        readonly surfaceStyle: Uint8Array;
+        readonly edgeStyle: Uint8Array;
+        readonly ownership: Uint8Array;
+        /**
+         * Footpaths on the tile.
+         * 1: tile has a footpath, 2: tile has a queue, 4: tile has a sloped footpath.
+         */
+        readonly footpathFlags: Uint8Array;
+    }
+
+    /**
+     * Entities returned by map.getEntityData. Each array has one entry per entity.
+     */
+    interface EntityData {
+        readonly id: Uint16Array;
+        readonly x: Int16Array;
+        readonly y: Int16Array;
+        readonly z: Int16Array;
+    }
+
     type TileElementType =
         "surface" | "footpath" | "track" | "small_scenery" | "wall" | "entrance" | "large_scenery" | "banner"
         /** This only exist to retrieve the types for existing corrupt elements. For hiding elements, use the isHidden field instead. */
@@ -1581,6 +1724,43 @@ declare global {
     interface NetworkStats {
         bytesReceived: number[];
         bytesSent: number[];
+
+        /**
+         * Traffic per network command, keyed by command name e.g. "gameAction" or "map".
+         */
+        commands: { [name: string]: NetworkCommandStats };
+
+        /**
+         * How long game actions waited in the queue before they were executed.
+         */
+        actionQueue: GameActionQueueStats;
+    }
+
+    interface NetworkCommandStats {
+        bytesReceived: number;
+        bytesSent: number;
+        packetsReceived: number;
+        packetsSent: number;
+    }
+
+    interface GameActionQueueStats {
+        /**
+         * The number of actions currently waiting to be executed.
+         */
+        depth: number;
+        processed: number;
+
+        /**
+         * Sum of the wait time of all processed actions in milliseconds.
+         */
+        totalWaitTime: number;
+        maxWaitTime: number;
+
+        /**
+         * Number of actions per wait time, the first entry counts waits below 1 ms and entry i
+         * waits from 2^(i-1) ms up to 2^i ms. The last entry also counts all longer waits.
+         */
+        waitHistogram: number[];
     }
 
     type PermissionType =
@@ -40,11 +40,13 @@
 #include <openrct2/interface/InteractiveConsole.h>
 #include <openrct2/localisation/StringIds.h>
 #include <openrct2/platform/Platform2.h>
+#include <openrct2/platform/platform.h>
 #include <openrct2/scripting/ScriptEngine.h>
 #include <openrct2/title/TitleSequencePlayer.h>
 #include <openrct2/ui/UiContext.h>
 #include <openrct2/ui/WindowManager.h>
 #include <openrct2/world/Location.hpp>
+#include <utility>
 #include <vector>
 
 using namespace OpenRCT2;
@@ -87,6 +89,8 @@ private:
     const uint8_t* _keysState = nullptr;
     uint8_t _keysPressed[256] = {};
     uint32_t _lastGestureTimestamp = 0;
+    // When the oldest input event not yet reported by TakeInputTimestamp was made, in platform ticks
+    uint32_t _inputTimestamp = 0;
     float _gestureRadius = 0;
 
     InGameConsole _inGameConsole;
@@ -316,6 +320,11 @@ public:
         _textComposition.Stop();
     }
 
+    uint32_t TakeInputTimestamp() override
+    {
+        return std::exchange(_inputTimestamp, 0);
+    }
+
     void ProcessMessages() override
     {
         _lastKeyPressed = 0;
@@ -327,6 +336,13 @@ public:
         SDL_Event e;
         while (SDL_PollEvent(&e))
         {
+            if (_inputTimestamp == 0 && IsInputEvent(e))
+            {
+                // Events are stamped by SDL's clock, the latency is measured with the platform's
+                const auto eventAge = SDL_GetTicks() - e.common.timestamp;
+                _inputTimestamp = std::max<uint32_t>(platform_get_ticks() - eventAge, 1);
+            }
+
             switch (e.type)
             {
                 case SDL_QUIT:
@@ -701,6 +717,24 @@ public:
     }
 
 private:
+    static bool IsInputEvent(const SDL_Event& e)
+    {
+        switch (e.type)
+        {
+            case SDL_MOUSEMOTION:
+            case SDL_MOUSEBUTTONDOWN:
+            case SDL_MOUSEBUTTONUP:
+            case SDL_MOUSEWHEEL:
+            case SDL_KEYDOWN:
+            case SDL_TEXTINPUT:
+            case SDL_FINGERDOWN:
+            case SDL_FINGERMOTION:
+                return true;
+            default:
+                return false;
+        }
+    }
+
     void CreateWindow(const ScreenCoordsXY& windowPos)
     {
         // Get saved window size
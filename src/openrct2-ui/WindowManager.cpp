@@ -83,6 +83,8 @@ public:
                 return window_new_ride_open();
             case WC_PARK_INFORMATION:
                 return window_park_entrance_open();
+            case WC_PROFILER:
+                return window_profiler_open();
             case WC_RECENT_NEWS:
                 return window_news_open();
             case WC_RIDE_CONSTRUCTION:
@@ -379,7 +381,21 @@ public:
                 break;
 
             case INTENT_ACTION_REFRESH_GUEST_LIST:
-                window_guest_list_refresh_list();
+            {
+                auto guest = static_cast<Guest*>(intent.GetPointerExtra(INTENT_EXTRA_PEEP));
+                if (guest != nullptr)
+                {
+                    window_guest_list_update_guest(guest);
+                }
+                else
+                {
+                    window_guest_list_refresh_list();
+                }
+                break;
+            }
+
+            case INTENT_ACTION_REMOVE_GUEST_FROM_LIST:
+                window_guest_list_remove_guest(static_cast<Guest*>(intent.GetPointerExtra(INTENT_EXTRA_PEEP)));
                 break;
 
             case INTENT_ACTION_REFRESH_STAFF_LIST:
@@ -432,11 +448,21 @@ public:
                 break;
 
             case INTENT_ACTION_UPDATE_GUEST_COUNT:
+            {
                 gToolbarDirtyFlags |= BTM_TB_DIRTY_FLAG_PEEP_COUNT;
                 window_invalidate_by_class(WC_GUEST_LIST);
                 window_invalidate_by_class(WC_PARK_INFORMATION);
-                window_guest_list_refresh_list();
+                auto guest = static_cast<Guest*>(intent.GetPointerExtra(INTENT_EXTRA_PEEP));
+                if (guest != nullptr)
+                {
+                    window_guest_list_update_guest(guest);
+                }
+                else
+                {
+                    window_guest_list_refresh_list();
+                }
                 break;
+            }
 
             case INTENT_ACTION_UPDATE_PARK_RATING:
                 gToolbarDirtyFlags |= BTM_TB_DIRTY_FLAG_PARK_RATING;
@@ -511,6 +537,11 @@ public:
         GameHandleInput();
     }
 
+    void UpdateToolAtCursor() override
+    {
+        GameUpdateToolAtCursor();
+    }
+
     void HandleKeyboard(bool isTitle) override
     {
         auto& inputManager = GetInputManager();
@@ -14,6 +14,7 @@
 #include <openrct2/audio/AudioSource.h>
 #include <openrct2/common.h>
 #include <string>
+#include <vector>
 
 struct SDL_RWops;
 using SpeexResamplerState = struct SpeexResamplerState_;
@@ -62,7 +63,11 @@ namespace OpenRCT2::Audio
 
     namespace AudioSource
     {
-        IAudioSource* CreateMemoryFromCSS1(const std::string& path, size_t index, const AudioFormat* targetFormat = nullptr);
+        /**
+         * Loads the first count sounds of a CSS1 file in one pass, sounds that fail to load are returned as nullptr.
+         */
+        std::vector<IAudioSource*> CreateMemoryFromCSS1(
+            const std::string& path, size_t count, const AudioFormat* targetFormat = nullptr);
         IAudioSource* CreateMemoryFromWAV(const std::string& path, const AudioFormat* targetFormat = nullptr);
         IAudioSource* CreateStreamFromWAV(const std::string& path);
         IAudioSource* CreateStreamFromWAV(SDL_RWops* rw);
@@ -13,7 +13,7 @@
 #include <SDL.h>
 #include <algorithm>
 #include <iterator>
-#include <list>
+#include <limits>
 #include <openrct2/Context.h>
 #include <openrct2/OpenRCT2.h>
 #include <openrct2/audio/AudioChannel.h>
@@ -22,6 +22,7 @@
 #include <openrct2/audio/audio.h>
 #include <openrct2/common.h>
 #include <openrct2/config/Config.h>
+#include <openrct2/core/Profiling.h>
 #include <speex/speex_resampler.h>
 #include <vector>
 
@@ -34,7 +35,7 @@ namespace OpenRCT2::Audio
 
         SDL_AudioDeviceID _deviceId = 0;
         AudioFormat _format = {};
-        std::list<ISDLAudioChannel*> _channels;
+        std::vector<ISDLAudioChannel*> _channels;
         float _volume = 1.0f;
         float _adjustSoundVolume = 0.0f;
         float _adjustMusicVolume = 0.0f;
@@ -196,29 +197,27 @@ namespace OpenRCT2::Audio
         void LoadAllSounds()
         {
             const utf8* css1Path = context_get_path_legacy(PATH_ID_CSS1);
+            auto sources = AudioSource::CreateMemoryFromCSS1(css1Path, std::size(_css1Sources), &_format);
             for (size_t i = 0; i < std::size(_css1Sources); i++)
             {
-                auto source = AudioSource::CreateMemoryFromCSS1(css1Path, i, &_format);
-                if (source == nullptr)
-                {
-                    source = _nullSource;
-                }
-                _css1Sources[i] = source;
+                _css1Sources[i] = sources[i] != nullptr ? sources[i] : _nullSource;
             }
         }
 
         void GetNextAudioChunk(uint8_t* dst, size_t length)
         {
+            Profiling::SetThreadName("Audio");
+            Profiling::ScopedZone zone("Audio mix");
+
             UpdateAdjustedSound();
 
             // Zero the output buffer
             std::fill_n(dst, length, 0);
 
-            // Mix channels onto output buffer
-            auto it = _channels.begin();
-            while (it != _channels.end())
+            // Mix channels onto output buffer, finished channels are removed by compacting the array in place
+            size_t numActiveChannels = 0;
+            for (auto channel : _channels)
             {
-                auto channel = *it;
                 MixerGroup group = channel->GetGroup();
                 if ((group != MixerGroup::Sound || gConfigSound.sound_enabled) && gConfigSound.master_sound_enabled
                     && gConfigSound.master_volume != 0)
@@ -228,13 +227,13 @@ namespace OpenRCT2::Audio
                 if ((channel->IsDone() && channel->DeleteOnDone()) || channel->IsStopping())
                 {
                     delete channel;
-                    it = _channels.erase(it);
                 }
                 else
                 {
-                    it++;
+                    _channels[numActiveChannels++] = channel;
                 }
             }
+            _channels.resize(numActiveChannels);
         }
 
         void UpdateAdjustedSound()
@@ -328,8 +327,17 @@ namespace OpenRCT2::Audio
 
             // Finally mix on to destination buffer
             size_t dstLength = std::min(length, bufferLen);
-            SDL_MixAudioFormat(
-                data, static_cast<const uint8_t*>(buffer), _format.format, static_cast<uint32_t>(dstLength), mixVolume);
+            if (_format.format == AUDIO_S16SYS)
+            {
+                MixS16(
+                    reinterpret_cast<int16_t*>(data), static_cast<const int16_t*>(buffer), dstLength / sizeof(int16_t),
+                    mixVolume);
+            }
+            else
+            {
+                SDL_MixAudioFormat(
+                    data, static_cast<const uint8_t*>(buffer), _format.format, static_cast<uint32_t>(dstLength), mixVolume);
+            }
 
             channel->UpdateOldVolume();
         }
@@ -429,35 +437,38 @@ namespace OpenRCT2::Audio
             return mixVolume;
         }
 
+        // The effect kernels compute the gain of each sample from its index rather than accumulating it, so the loops have
+        // no dependency between iterations and can be vectorised by the compiler.
+
         static void EffectPanS16(const IAudioChannel* channel, int16_t* data, int32_t length)
         {
             const float dt = 1.0f / static_cast<float>(length * 2.0f);
-            float volumeL = channel->GetOldVolumeL();
-            float volumeR = channel->GetOldVolumeR();
+            const float volumeL = channel->GetOldVolumeL();
+            const float volumeR = channel->GetOldVolumeR();
             const float d_left = dt * (channel->GetVolumeL() - channel->GetOldVolumeL());
             const float d_right = dt * (channel->GetVolumeR() - channel->GetOldVolumeR());
 
-            for (int32_t i = 0; i < length * 2; i += 2)
+            for (int32_t i = 0; i < length; i++)
             {
-                data[i + 0] = static_cast<int16_t>(volumeL * static_cast<float>(data[i + 0]));
-                data[i + 1] = static_cast<int16_t>(volumeR * static_cast<float>(data[i + 1]));
-                volumeL += d_left;
-                volumeR += d_right;
+                const float t = static_cast<float>(i);
+                data[i * 2 + 0] = static_cast<int16_t>((volumeL + t * d_left) * static_cast<float>(data[i * 2 + 0]));
+                data[i * 2 + 1] = static_cast<int16_t>((volumeR + t * d_right) * static_cast<float>(data[i * 2 + 1]));
             }
         }
 
         static void EffectPanU8(const IAudioChannel* channel, uint8_t* data, int32_t length)
         {
-            float volumeL = channel->GetVolumeL();
-            float volumeR = channel->GetVolumeR();
-            float oldVolumeL = channel->GetOldVolumeL();
-            float oldVolumeR = channel->GetOldVolumeR();
+            const float dt = 1.0f / static_cast<float>(length);
+            const float oldVolumeL = channel->GetOldVolumeL();
+            const float oldVolumeR = channel->GetOldVolumeR();
+            const float d_left = dt * (channel->GetVolumeL() - oldVolumeL);
+            const float d_right = dt * (channel->GetVolumeR() - oldVolumeR);
 
-            for (int32_t i = 0; i < length * 2; i += 2)
+            for (int32_t i = 0; i < length; i++)
             {
-                float t = static_cast<float>(i) / static_cast<float>(length * 2.0f);
-                data[i] = static_cast<uint8_t>(data[i] * ((1.0 - t) * oldVolumeL + t * volumeL));
-                data[i + 1] = static_cast<uint8_t>(data[i + 1] * ((1.0 - t) * oldVolumeR + t * volumeR));
+                const float t = static_cast<float>(i);
+                data[i * 2 + 0] = static_cast<uint8_t>((oldVolumeL + t * d_left) * static_cast<float>(data[i * 2 + 0]));
+                data[i * 2 + 1] = static_cast<uint8_t>((oldVolumeR + t * d_right) * static_cast<float>(data[i * 2 + 1]));
             }
         }
 
@@ -465,12 +476,12 @@ namespace OpenRCT2::Audio
         {
             static_assert(SDL_MIX_MAXVOLUME == MIXER_VOLUME_MAX, "Max volume differs between OpenRCT2 and SDL2");
 
-            float startvolume_f = static_cast<float>(startvolume) / SDL_MIX_MAXVOLUME;
-            float endvolume_f = static_cast<float>(endvolume) / SDL_MIX_MAXVOLUME;
+            const float startvolume_f = static_cast<float>(startvolume) / SDL_MIX_MAXVOLUME;
+            const float d_volume = (static_cast<float>(endvolume - startvolume) / SDL_MIX_MAXVOLUME) / length;
             for (int32_t i = 0; i < length; i++)
             {
-                float t = static_cast<float>(i) / length;
-                data[i] = static_cast<int16_t>(data[i] * ((1.0f - t) * startvolume_f + t * endvolume_f));
+                const float volume = startvolume_f + static_cast<float>(i) * d_volume;
+                data[i] = static_cast<int16_t>(static_cast<float>(data[i]) * volume);
             }
         }
 
@@ -478,12 +489,30 @@ namespace OpenRCT2::Audio
         {
             static_assert(SDL_MIX_MAXVOLUME == MIXER_VOLUME_MAX, "Max volume differs between OpenRCT2 and SDL2");
 
-            float startvolume_f = static_cast<float>(startvolume) / SDL_MIX_MAXVOLUME;
-            float endvolume_f = static_cast<float>(endvolume) / SDL_MIX_MAXVOLUME;
+            const float startvolume_f = static_cast<float>(startvolume) / SDL_MIX_MAXVOLUME;
+            const float d_volume = (static_cast<float>(endvolume - startvolume) / SDL_MIX_MAXVOLUME) / length;
             for (int32_t i = 0; i < length; i++)
             {
-                float t = static_cast<float>(i) / length;
-                data[i] = static_cast<uint8_t>(data[i] * ((1.0f - t) * startvolume_f + t * endvolume_f));
+                const float volume = startvolume_f + static_cast<float>(i) * d_volume;
+                data[i] = static_cast<uint8_t>(static_cast<float>(data[i]) * volume);
+            }
+        }
+
+        /**
+         * Adds src scaled by volume on to dst, clipping to the range of a sample. Same result as SDL_MixAudioFormat for
+         * AUDIO_S16SYS.
+         */
+        static void MixS16(int16_t* dst, const int16_t* src, size_t length, int32_t volume)
+        {
+            if (volume <= 0)
+                return;
+
+            constexpr int32_t sampleMin = std::numeric_limits<int16_t>::min();
+            constexpr int32_t sampleMax = std::numeric_limits<int16_t>::max();
+            for (size_t i = 0; i < length; i++)
+            {
+                const int32_t sample = dst[i] + (src[i] * volume) / SDL_MIX_MAXVOLUME;
+                dst[i] = static_cast<int16_t>(std::clamp(sample, sampleMin, sampleMax));
             }
         }
 
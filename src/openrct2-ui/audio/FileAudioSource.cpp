@@ -12,23 +12,43 @@
 
 #include <SDL.h>
 #include <algorithm>
+#include <condition_variable>
+#include <mutex>
 #include <openrct2/audio/AudioSource.h>
 #include <openrct2/common.h>
+#include <thread>
+#include <vector>
 
 namespace OpenRCT2::Audio
 {
     /**
      * An audio source where raw PCM data is streamed directly from
-     * a file.
+     * a file. A prefetch thread keeps a window of the data ahead of
+     * the play position in memory so the audio callback only copies.
      */
     class FileAudioSource final : public ISDLAudioSource
     {
     private:
+        static constexpr size_t PrefetchAhead = 256 * 1024;
+        static constexpr size_t PrefetchChunkSize = 64 * 1024;
+
         AudioFormat _format = {};
         SDL_RWops* _rw = nullptr;
         uint64_t _dataBegin = 0;
         uint64_t _dataLength = 0;
 
+        // Serialises access to _rw between the prefetch thread and reads that missed the prefetch window
+        std::mutex _fileMutex;
+
+        // The prefetched data starting at _bufferOffset of the data chunk, _readOffset is where the channel reads next
+        std::mutex _bufferMutex;
+        std::condition_variable _bufferCondition;
+        std::vector<uint8_t> _buffer;
+        uint64_t _bufferOffset = 0;
+        uint64_t _readOffset = 0;
+        bool _stopPrefetch = false;
+        std::thread _prefetchThread;
+
     public:
         ~FileAudioSource() override
         {
@@ -47,23 +67,37 @@ namespace OpenRCT2::Audio
 
         size_t Read(void* dst, uint64_t offset, size_t len) override
         {
-            size_t bytesRead = 0;
-            int64_t currentPosition = SDL_RWtell(_rw);
-            if (currentPosition != -1)
+            if (offset >= _dataLength)
+            {
+                return 0;
+            }
+            size_t bytesToRead = static_cast<size_t>(std::min<uint64_t>(len, _dataLength - offset));
+
+            size_t bytesCopied = 0;
             {
-                size_t bytesToRead = static_cast<size_t>(std::min<uint64_t>(len, _dataLength - offset));
-                int64_t dataOffset = _dataBegin + offset;
-                if (currentPosition != dataOffset)
+                std::lock_guard<std::mutex> lock(_bufferMutex);
+                if (offset >= _bufferOffset && offset < _bufferOffset + _buffer.size())
+                {
+                    auto bufferIndex = static_cast<size_t>(offset - _bufferOffset);
+                    bytesCopied = std::min(bytesToRead, _buffer.size() - bufferIndex);
+                    std::copy_n(_buffer.data() + bufferIndex, bytesCopied, reinterpret_cast<uint8_t*>(dst));
+                    _readOffset = offset + bytesCopied;
+                }
+                else
                 {
-                    int64_t newPosition = SDL_RWseek(_rw, dataOffset, SEEK_SET);
-                    if (newPosition == -1)
-                    {
-                        return 0;
-                    }
+                    // Seeked, looped or the prefetch thread fell behind, restart the window after this read
+                    _buffer.clear();
+                    _bufferOffset = offset + bytesToRead;
+                    _readOffset = _bufferOffset;
                 }
-                bytesRead = SDL_RWread(_rw, dst, 1, bytesToRead);
             }
-            return bytesRead;
+            _bufferCondition.notify_one();
+
+            if (bytesCopied != 0)
+            {
+                return bytesCopied;
+            }
+            return ReadFromFile(dst, offset, bytesToRead);
         }
 
         bool LoadWAV(SDL_RWops* rw)
@@ -140,10 +174,88 @@ namespace OpenRCT2::Audio
 
             _dataLength = dataChunkSize;
             _dataBegin = SDL_RWtell(rw);
+
+            _stopPrefetch = false;
+            _prefetchThread = std::thread(&FileAudioSource::PrefetchMain, this);
             return true;
         }
 
     private:
+        size_t ReadFromFile(void* dst, uint64_t offset, size_t len)
+        {
+            std::lock_guard<std::mutex> lock(_fileMutex);
+            int64_t currentPosition = SDL_RWtell(_rw);
+            if (currentPosition == -1)
+            {
+                return 0;
+            }
+            int64_t dataOffset = _dataBegin + offset;
+            if (currentPosition != dataOffset)
+            {
+                int64_t newPosition = SDL_RWseek(_rw, dataOffset, SEEK_SET);
+                if (newPosition == -1)
+                {
+                    return 0;
+                }
+            }
+            return SDL_RWread(_rw, dst, 1, len);
+        }
+
+        void PrefetchMain()
+        {
+            std::vector<uint8_t> chunk;
+            std::unique_lock<std::mutex> lock(_bufferMutex);
+            while (!_stopPrefetch)
+            {
+                // Drop data that has been played, in whole chunks to keep the moves rare
+                auto consumed = static_cast<size_t>(std::min<uint64_t>(_readOffset - _bufferOffset, _buffer.size()));
+                if (consumed >= PrefetchChunkSize)
+                {
+                    _buffer.erase(_buffer.begin(), _buffer.begin() + consumed);
+                    _bufferOffset += consumed;
+                }
+
+                auto fetchOffset = _bufferOffset + _buffer.size();
+                if (fetchOffset >= _dataLength || fetchOffset - _readOffset >= PrefetchAhead)
+                {
+                    _bufferCondition.wait(lock);
+                    continue;
+                }
+
+                chunk.resize(static_cast<size_t>(std::min<uint64_t>(PrefetchChunkSize, _dataLength - fetchOffset)));
+                lock.unlock();
+                auto bytesRead = ReadFromFile(chunk.data(), fetchOffset, chunk.size());
+                lock.lock();
+
+                if (bytesRead == 0)
+                {
+                    // Nothing to read, wait until the channel reads or seeks again rather than spinning on the file
+                    _bufferCondition.wait(lock);
+                }
+                else if (fetchOffset == _bufferOffset + _buffer.size())
+                {
+                    // Only append when the window was not restarted while the file was being read
+                    _buffer.insert(_buffer.end(), chunk.begin(), chunk.begin() + bytesRead);
+                }
+            }
+        }
+
+        void StopPrefetch()
+        {
+            if (_prefetchThread.joinable())
+            {
+                {
+                    std::lock_guard<std::mutex> lock(_bufferMutex);
+                    _stopPrefetch = true;
+                }
+                _bufferCondition.notify_one();
+                _prefetchThread.join();
+            }
+            _buffer.clear();
+            _bufferOffset = 0;
+            _readOffset = 0;
+        }
+
         static uint32_t FindChunk(SDL_RWops* rw, uint32_t wantedId)
         {
             uint32_t subchunkId = SDL_ReadLE32(rw);
@@ -171,6 +283,7 @@ namespace OpenRCT2::Audio
 
         void Unload()
         {
+            StopPrefetch();
             if (_rw != nullptr)
             {
                 SDL_RWclose(_rw);
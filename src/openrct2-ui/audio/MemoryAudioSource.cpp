@@ -101,54 +101,47 @@ namespace OpenRCT2::Audio
             return result;
         }
 
-        bool LoadCSS1(const utf8* path, size_t index)
+        bool LoadCSS1(SDL_RWops* rw, size_t index)
         {
-            log_verbose("MemoryAudioSource::LoadCSS1(%s, %d)", path, index);
+            log_verbose("MemoryAudioSource::LoadCSS1(%d)", index);
 
             Unload();
 
-            bool result = false;
-            SDL_RWops* rw = SDL_RWFromFile(path, "rb");
-            if (rw != nullptr)
+            SDL_RWseek(rw, 0, RW_SEEK_SET);
+            uint32_t numSounds{};
+            SDL_RWread(rw, &numSounds, sizeof(numSounds), 1);
+            if (index >= numSounds)
             {
-                uint32_t numSounds{};
-                SDL_RWread(rw, &numSounds, sizeof(numSounds), 1);
-                if (index < numSounds)
-                {
-                    SDL_RWseek(rw, index * 4, RW_SEEK_CUR);
+                return false;
+            }
 
-                    uint32_t pcmOffset{};
-                    SDL_RWread(rw, &pcmOffset, sizeof(pcmOffset), 1);
-                    SDL_RWseek(rw, pcmOffset, RW_SEEK_SET);
+            SDL_RWseek(rw, index * 4, RW_SEEK_CUR);
 
-                    uint32_t pcmSize{};
-                    SDL_RWread(rw, &pcmSize, sizeof(pcmSize), 1);
-                    _length = pcmSize;
+            uint32_t pcmOffset{};
+            SDL_RWread(rw, &pcmOffset, sizeof(pcmOffset), 1);
+            SDL_RWseek(rw, pcmOffset, RW_SEEK_SET);
 
-                    WaveFormatEx waveFormat{};
-                    SDL_RWread(rw, &waveFormat, sizeof(waveFormat), 1);
-                    _format.freq = waveFormat.frequency;
-                    _format.format = AUDIO_S16LSB;
-                    _format.channels = waveFormat.channels;
+            uint32_t pcmSize{};
+            SDL_RWread(rw, &pcmSize, sizeof(pcmSize), 1);
+            _length = pcmSize;
 
-                    try
-                    {
-                        _data.resize(_length);
-                        SDL_RWread(rw, _data.data(), _length, 1);
-                        result = true;
-                    }
-                    catch (const std::bad_alloc&)
-                    {
-                        log_verbose("Unable to allocate data");
-                    }
-                }
-                SDL_RWclose(rw);
+            WaveFormatEx waveFormat{};
+            SDL_RWread(rw, &waveFormat, sizeof(waveFormat), 1);
+            _format.freq = waveFormat.frequency;
+            _format.format = AUDIO_S16LSB;
+            _format.channels = waveFormat.channels;
+
+            try
+            {
+                _data.resize(_length);
+                SDL_RWread(rw, _data.data(), _length, 1);
+                return true;
             }
-            else
+            catch (const std::bad_alloc&)
             {
-                log_verbose("Unable to load %s", path);
+                log_verbose("Unable to allocate data");
             }
-            return result;
+            return false;
         }
 
         bool Convert(const AudioFormat* format)
@@ -195,26 +188,59 @@ namespace OpenRCT2::Audio
         }
     };
 
-    IAudioSource* AudioSource::CreateMemoryFromCSS1(const std::string& path, size_t index, const AudioFormat* targetFormat)
+    std::vector<IAudioSource*> AudioSource::CreateMemoryFromCSS1(
+        const std::string& path, size_t count, const AudioFormat* targetFormat)
     {
-        auto source = new MemoryAudioSource();
-        if (source->LoadCSS1(path.c_str(), index))
+        std::vector<IAudioSource*> sources(count, nullptr);
+
+        // Read the whole file once rather than reopening it for every sound, the sounds are then decoded and converted
+        // up front so playing them never touches the disk or converts on the audio thread.
+        SDL_RWops* file = SDL_RWFromFile(path.c_str(), "rb");
+        if (file == nullptr)
         {
-            if (targetFormat != nullptr && source->GetFormat() != *targetFormat)
+            log_verbose("Unable to load %s", path.c_str());
+            return sources;
+        }
+
+        std::vector<uint8_t> fileData;
+        auto fileSize = SDL_RWsize(file);
+        if (fileSize > 0)
+        {
+            fileData.resize(static_cast<size_t>(fileSize));
+            if (SDL_RWread(file, fileData.data(), fileData.size(), 1) != 1)
             {
-                if (!source->Convert(targetFormat))
-                {
-                    delete source;
-                    source = nullptr;
-                }
+                fileData.clear();
             }
         }
-        else
+        SDL_RWclose(file);
+
+        SDL_RWops* rw = SDL_RWFromConstMem(fileData.data(), static_cast<int32_t>(fileData.size()));
+        if (rw == nullptr)
         {
-            delete source;
-            source = nullptr;
+            return sources;
         }
-        return source;
+
+        for (size_t i = 0; i < count; i++)
+        {
+            auto source = new MemoryAudioSource();
+            if (source->LoadCSS1(rw, i))
+            {
+                if (targetFormat != nullptr && source->GetFormat() != *targetFormat)
+                {
+                    if (!source->Convert(targetFormat))
+                    {
+                        SafeDelete(source);
+                    }
+                }
+            }
+            else
+            {
+                SafeDelete(source);
+            }
+            sources[i] = source;
+        }
+        SDL_RWclose(rw);
+        return sources;
     }
 
     IAudioSource* AudioSource::CreateMemoryFromWAV(const std::string& path, const AudioFormat* targetFormat)
@@ -10,7 +10,9 @@
 #include "DrawingEngineFactory.hpp"
 
 #include <SDL.h>
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <openrct2/Game.h>
 #include <openrct2/common.h>
 #include <openrct2/config/Config.h>
@@ -50,6 +52,11 @@ private:
 
     std::vector<uint32_t> _dirtyVisualsTime;
 
+    // The screen as it was last uploaded to the texture, and the same pixels converted to the texture format.
+    std::vector<uint8_t> _uploadedBits;
+    std::vector<uint32_t> _uploadedPixels;
+    bool _screenTextureOutdated = true;
+
     bool smoothNN = false;
 
 public:
@@ -153,6 +160,7 @@ public:
         _screenTextureFormat = SDL_AllocFormat(format);
 
         ConfigureBits(width, height, width);
+        _screenTextureOutdated = true;
     }
 
     void SetPalette(const GamePalette& palette) override
@@ -163,6 +171,7 @@ public:
             {
                 _paletteHWMapped[i] = SDL_MapRGB(_screenTextureFormat, palette[i].Red, palette[i].Green, palette[i].Blue);
             }
+            _screenTextureOutdated = true;
 
 #ifdef __ENABLE_LIGHTFX__
             if (gConfigGeneral.enable_light_fx)
@@ -217,12 +226,12 @@ private:
                 lightfx_render_to_texture(pixels, pitch, _bits, _width, _height, _paletteHWMapped, _lightPaletteHWMapped);
                 SDL_UnlockTexture(_screenTexture);
             }
+            _screenTextureOutdated = true;
         }
         else
 #endif
         {
-            CopyBitsToTexture(
-                _screenTexture, _bits, static_cast<int32_t>(_width), static_cast<int32_t>(_height), _paletteHWMapped);
+            UpdateScreenTexture();
         }
         if (smoothNN)
         {
@@ -256,6 +265,60 @@ private:
         }
     }
 
+    /**
+     * Uploads the rows of the screen that changed since the last frame. Rows are compared rather than relying on the
+     * dirty grid, as scrolling viewports and weather change pixels without invalidating them.
+     */
+    void UpdateScreenTexture()
+    {
+        if (_screenTextureFormat == nullptr || _screenTextureFormat->BytesPerPixel != 4)
+        {
+            CopyBitsToTexture(
+                _screenTexture, _bits, static_cast<int32_t>(_width), static_cast<int32_t>(_height), _paletteHWMapped);
+            return;
+        }
+
+        const size_t width = _width;
+        const size_t numPixels = width * _height;
+        if (_uploadedBits.size() != numPixels)
+        {
+            _uploadedBits.resize(numPixels);
+            _uploadedPixels.resize(numPixels);
+            _screenTextureOutdated = true;
+        }
+
+        size_t top = 0;
+        size_t bottom = _height;
+        if (!_screenTextureOutdated)
+        {
+            while (top < bottom && std::memcmp(&_bits[top * width], &_uploadedBits[top * width], width) == 0)
+            {
+                top++;
+            }
+            while (bottom > top
+                   && std::memcmp(&_bits[(bottom - 1) * width], &_uploadedBits[(bottom - 1) * width], width) == 0)
+            {
+                bottom--;
+            }
+            if (top == bottom)
+            {
+                return;
+            }
+        }
+
+        const auto* src = &_bits[top * width];
+        std::copy_n(src, (bottom - top) * width, &_uploadedBits[top * width]);
+        std::transform(
+            src, src + (bottom - top) * width, &_uploadedPixels[top * width],
+            [this](uint8_t paletteIndex) { return _paletteHWMapped[paletteIndex]; });
+
+        SDL_Rect rect = { 0, static_cast<int32_t>(top), static_cast<int32_t>(width), static_cast<int32_t>(bottom - top) };
+        if (SDL_UpdateTexture(_screenTexture, &rect, &_uploadedPixels[top * width], static_cast<int32_t>(width * 4)) == 0)
+        {
+            _screenTextureOutdated = false;
+        }
+    }
+
     void CopyBitsToTexture(SDL_Texture* texture, uint8_t* src, int32_t width, int32_t height, const uint32_t* palette)
     {
         void* pixels;
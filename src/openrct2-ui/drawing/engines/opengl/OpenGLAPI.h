@@ -31,6 +31,7 @@
 #    define glGetError __static__glGetError
 #    define glPixelStorei __static__glPixelStorei
 #    define glReadPixels __static__glReadPixels
+#    define glScissor __static__glScissor
 #    define glTexImage2D __static__glTexImage2D
 #    define glTexParameteri __static__glTexParameteri
 #    define glViewport __static__glViewport
@@ -67,6 +68,7 @@
 #    undef glGetError
 #    undef glPixelStorei
 #    undef glReadPixels
+#    undef glScissor
 #    undef glTexImage2D
 #    undef glTexParameteri
 #    undef glViewport
@@ -93,6 +95,7 @@ using PFNGLGENTEXTURESPROC = void(APIENTRYP)(GLsizei n, GLuint* textures);
 using PFNGLPIXELSTOREIPROC = void(APIENTRYP)(GLenum pname, GLint param);
 using PFNGLREADPIXELSPROC = void(APIENTRYP)(
     GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLvoid* pixels);
+using PFNGLSCISSORPROC = void(APIENTRYP)(GLint x, GLint y, GLsizei width, GLsizei height);
 using PFNGLTEXIMAGE2DPROC = void(APIENTRYP)(
     GLenum target, GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type,
     const GLvoid* pixels);
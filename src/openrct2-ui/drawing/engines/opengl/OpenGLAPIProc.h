@@ -29,6 +29,7 @@ OPENGL_PROC(PFNGLGENTEXTURESPROC, glGenTextures)
 OPENGL_PROC(PFNGLGETERRORPROC, glGetError)
 OPENGL_PROC(PFNGLPIXELSTOREIPROC, glPixelStorei)
 OPENGL_PROC(PFNGLREADPIXELSPROC, glReadPixels)
+OPENGL_PROC(PFNGLSCISSORPROC, glScissor)
 OPENGL_PROC(PFNGLTEXIMAGE2DPROC, glTexImage2D)
 OPENGL_PROC(PFNGLTEXPARAMETERIPROC, glTexParameteri)
 OPENGL_PROC(PFNGLVIEWPORTPROC, glViewport)
@@ -24,6 +24,7 @@
 #    include <SDL.h>
 #    include <algorithm>
 #    include <cmath>
+#    include <limits>
 #    include <openrct2-ui/interface/Window.h>
 #    include <openrct2/Intro.h>
 #    include <openrct2/config/Config.h>
@@ -74,6 +75,8 @@ private:
     ScreenCoordsXY _spriteOffset;
 
     int32_t _drawCount = 0;
+    uint32_t _drawCallCount = 0;
+    uint32_t _lastFrameDrawCallCount = 0;
 
     struct
     {
@@ -95,6 +98,10 @@ public:
     {
         return _swapFramebuffer->GetFinalFramebuffer();
     }
+    uint32_t GetDrawCallCount() const
+    {
+        return _lastFrameDrawCallCount;
+    }
 
     void Initialise();
     void Resize(int32_t width, int32_t height);
@@ -379,6 +386,11 @@ public:
         _drawingContext->GetTextureCache()->InvalidateImage(image);
     }
 
+    uint32_t GetDrawCallCount() const override
+    {
+        return _drawingContext->GetDrawCallCount();
+    }
+
     rct_drawpixelinfo* GetDPI()
     {
         return &_bitsDPI;
@@ -538,6 +550,7 @@ void OpenGLDrawingContext::StartNewDraw()
 {
     _drawCount = 0;
     _swapFramebuffer->Clear();
+    _textureCache->BeginFrame();
 }
 
 void OpenGLDrawingContext::Clear(uint8_t paletteIndex)
@@ -924,6 +937,8 @@ void OpenGLDrawingContext::DrawGlyph(uint32_t image, int32_t x, int32_t y, const
 
 void OpenGLDrawingContext::FlushCommandBuffers()
 {
+    _textureCache->FlushUploads();
+
     glEnable(GL_DEPTH_TEST);
     glDepthFunc(GL_LESS);
 
@@ -935,6 +950,9 @@ void OpenGLDrawingContext::FlushCommandBuffers()
     FlushRectangles();
 
     HandleTransparency();
+
+    _lastFrameDrawCallCount = _drawCallCount;
+    _drawCallCount = 0;
 }
 
 void OpenGLDrawingContext::FlushLines()
@@ -944,6 +962,7 @@ void OpenGLDrawingContext::FlushLines()
 
     _drawLineShader->Use();
     _drawLineShader->DrawInstances(_commandBuffers.lines);
+    _drawCallCount++;
 
     _commandBuffers.lines.clear();
 }
@@ -959,6 +978,7 @@ void OpenGLDrawingContext::FlushRectangles()
     _drawRectShader->Use();
     _drawRectShader->SetInstances(_commandBuffers.rects);
     _drawRectShader->DrawInstances();
+    _drawCallCount++;
 
     _commandBuffers.rects.clear();
 }
@@ -970,6 +990,32 @@ void OpenGLDrawingContext::HandleTransparency()
         return;
     }
 
+    // Only the area covered by transparent sprites has to be peeled and mixed, scissor all passes to it
+    int32_t left = std::numeric_limits<int32_t>::max();
+    int32_t top = std::numeric_limits<int32_t>::max();
+    int32_t right = std::numeric_limits<int32_t>::min();
+    int32_t bottom = std::numeric_limits<int32_t>::min();
+    for (const auto& command : _commandBuffers.transparent)
+    {
+        left = std::min(left, std::max(command.bounds.x, command.clip.x));
+        top = std::min(top, std::max(command.bounds.y, command.clip.y));
+        right = std::max(right, std::min(command.bounds.z, command.clip.z));
+        bottom = std::max(bottom, std::min(command.bounds.w, command.clip.w));
+    }
+    const auto* screenDPI = _engine->GetDPI();
+    left = std::max(left, 0);
+    top = std::max(top, 0);
+    right = std::min<int32_t>(right, screenDPI->width);
+    bottom = std::min<int32_t>(bottom, screenDPI->height);
+    if (left >= right || top >= bottom)
+    {
+        _commandBuffers.transparent.clear();
+        return;
+    }
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(left, screenDPI->height - bottom, right - left, bottom - top);
+    _swapFramebuffer->ClearTransparency();
+
     _drawRectShader->Use();
     _drawRectShader->SetInstances(_commandBuffers.transparent);
 
@@ -993,7 +1039,11 @@ void OpenGLDrawingContext::HandleTransparency()
         _drawRectShader->Use();
         _drawRectShader->DrawInstances();
         _swapFramebuffer->ApplyTransparency(*_applyTransparencyShader, _textureCache->GetPaletteTexture());
+
+        // One draw for the layer and one to blend it
+        _drawCallCount += 2;
     }
+    glDisable(GL_SCISSOR_TEST);
 
     _commandBuffers.transparent.clear();
 }
@@ -39,14 +39,18 @@ void SwapFramebuffer::ApplyTransparency(ApplyTransparencyShader& shader, GLuint
 
     _backDepth = _transparentFramebuffer.SwapDepthTexture(_backDepth);
 
-    // Clear transparency buffers
+    ClearTransparency();
+
+    // Copy rather than swap the mixed buffer, so that with a scissor only the area that was mixed is touched.
+    // Copy leaves the opaque framebuffer bound, to guarantee no undefined behavior.
+    _opaqueFramebuffer.Copy(_mixFramebuffer, GL_NEAREST);
+}
+
+void SwapFramebuffer::ClearTransparency()
+{
     _transparentFramebuffer.Bind();
     glClearBufferuiv(GL_COLOR, 0, indexValue);
     glClearBufferfv(GL_DEPTH, 0, depthValueTransparent);
-
-    _opaqueFramebuffer.SwapColourBuffer(_mixFramebuffer);
-    // Change binding to guarantee no undefined behavior
-    _opaqueFramebuffer.Bind();
 }
 
 void SwapFramebuffer::Clear()
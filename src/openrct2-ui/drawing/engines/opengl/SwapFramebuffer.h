@@ -51,6 +51,10 @@ public:
         _transparentFramebuffer.Bind();
     }
 
+    /**
+     * Mixes the transparent layer into the opaque framebuffer. Only the area inside the current scissor is mixed.
+     */
     void ApplyTransparency(ApplyTransparencyShader& shader, GLuint paletteTex);
+    void ClearTransparency();
     void Clear();
 };
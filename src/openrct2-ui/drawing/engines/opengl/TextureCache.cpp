@@ -12,6 +12,9 @@
 #    include "TextureCache.h"
 
 #    include <algorithm>
+#    include <openrct2/config/Config.h>
+#    include <openrct2/core/MemoryAccounting.h>
+#    include <openrct2/core/TaskScheduler.h>
 #    include <openrct2/drawing/Drawing.h>
 #    include <openrct2/util/Util.h>
 #    include <openrct2/world/Location.hpp>
@@ -20,9 +23,19 @@
 
 constexpr uint32_t UNUSED_INDEX = 0xFFFFFFFF;
 
+// The palette texture is a 256x256 single channel texture.
+constexpr size_t PaletteTextureBytes = 256 * 256;
+
+// Number of images loaded in one frame from which they are rendered on the task scheduler workers.
+constexpr size_t ParallelUploadThreshold = 16;
+
 TextureCache::TextureCache()
 {
     std::fill(_indexMap.begin(), _indexMap.end(), UNUSED_INDEX);
+    for (auto& lastUsedFrame : _imageLastUsedFrame)
+    {
+        lastUsedFrame.store(0, std::memory_order_relaxed);
+    }
 }
 
 TextureCache::~TextureCache()
@@ -38,10 +51,88 @@ void TextureCache::InvalidateImage(uint32_t image)
     if (index == UNUSED_INDEX)
         return;
 
+    // The slot is about to be reused, so the old pixels must not be uploaded to it anymore
+    _pendingUploads.erase(
+        std::remove_if(
+            _pendingUploads.begin(), _pendingUploads.end(),
+            [image](const PendingUpload& upload) { return !upload.IsGlyph && upload.Info.image == image; }),
+        _pendingUploads.end());
+
+    RemoveImage(index);
+}
+
+void TextureCache::BeginFrame()
+{
+    unique_lock lock(_mutex);
+
+    _currentFrame++;
+}
+
+void TextureCache::FlushUploads()
+{
+    if (_pendingUploads.empty())
+        return;
+
+    size_t totalBytes = 0;
+    for (auto& upload : _pendingUploads)
+    {
+        upload.Offset = totalBytes;
+        totalBytes += static_cast<size_t>(upload.Width) * upload.Height;
+    }
+    _uploadPixels.assign(totalBytes, 0);
+
+    // Rendering the images does not need the GL context, so when a new area comes into view they are rendered on all
+    // workers rather than one by one as the draw reaches them.
+    const auto renderUpload = [this](size_t i) {
+        auto& upload = _pendingUploads[i];
+        auto* bits = _uploadPixels.data() + upload.Offset;
+        if (upload.IsGlyph)
+        {
+            std::copy(upload.GlyphPixels.begin(), upload.GlyphPixels.end(), bits);
+        }
+        else
+        {
+            RenderImage(upload.Info.image, bits, upload.Width, upload.Height);
+        }
+    };
+    if (_pendingUploads.size() >= ParallelUploadThreshold)
+    {
+        OpenRCT2::TaskScheduler::Get().ParallelFor(0, _pendingUploads.size(), 4, renderUpload);
+    }
+    else
+    {
+        for (size_t i = 0; i < _pendingUploads.size(); i++)
+        {
+            renderUpload(i);
+        }
+    }
+
+    // All images are transferred in a single buffer, the texture updates then read from it without stalling on the
+    // client memory of every image.
+    if (_uploadBuffer == 0)
+    {
+        glGenBuffers(1, &_uploadBuffer);
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, _uploadBuffer);
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, totalBytes, _uploadPixels.data(), GL_STREAM_DRAW);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, _atlasesTexture);
+    for (const auto& upload : _pendingUploads)
+    {
+        glTexSubImage3D(
+            GL_TEXTURE_2D_ARRAY, 0, upload.Info.bounds.x, upload.Info.bounds.y, upload.Info.index, upload.Width,
+            upload.Height, 1, GL_RED_INTEGER, GL_UNSIGNED_BYTE, reinterpret_cast<const void*>(upload.Offset));
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    _pendingUploads.clear();
+}
+
+void TextureCache::RemoveImage(uint32_t index)
+{
     AtlasTextureInfo& elem = _textureCache.at(index);
 
     _atlases[elem.index].Free(elem);
-    _indexMap[image] = UNUSED_INDEX;
+    _indexMap[elem.image] = UNUSED_INDEX;
 
     if (index == _textureCache.size() - 1)
     {
@@ -77,6 +168,8 @@ BasicTextureInfo TextureCache::GetOrLoadImageTexture(uint32_t image)
         index = _indexMap[image];
         if (index != UNUSED_INDEX)
         {
+            _imageLastUsedFrame[image].store(_currentFrame, std::memory_order_relaxed);
+
             const auto& info = _textureCache[index];
             return {
                 info.index,
@@ -94,6 +187,7 @@ BasicTextureInfo TextureCache::GetOrLoadImageTexture(uint32_t image)
 
     _textureCache.push_back(info);
     _indexMap[image] = index;
+    _imageLastUsedFrame[image].store(_currentFrame, std::memory_order_relaxed);
 
     return info;
 }
@@ -162,6 +256,7 @@ void TextureCache::CreateTextures()
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
         glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
         GeneratePaletteTexture();
+        SetTextureBytes(PaletteTextureBytes);
 
         _initialized = true;
         _atlasesTextureIndices = 0;
@@ -223,6 +318,9 @@ void TextureCache::EnlargeAtlasesTexture(GLuint newEntries)
         glTexImage3D(
             GL_TEXTURE_2D_ARRAY, 0, GL_R8UI, _atlasesTextureDimensions, _atlasesTextureDimensions, _atlasesTextureCapacity, 0,
             GL_RED_INTEGER, GL_UNSIGNED_BYTE, nullptr);
+        SetTextureBytes(
+            static_cast<size_t>(_atlasesTextureDimensions) * _atlasesTextureDimensions * _atlasesTextureCapacity
+            + PaletteTextureBytes);
 
         // Restore old data
         if (!oldPixels.empty())
@@ -238,34 +336,30 @@ void TextureCache::EnlargeAtlasesTexture(GLuint newEntries)
 
 AtlasTextureInfo TextureCache::LoadImageTexture(uint32_t image)
 {
-    rct_drawpixelinfo dpi = GetImageAsDPI(image, 0);
+    auto g1Element = gfx_get_g1_element(image & 0x7FFFFUL);
+    int32_t width = g1Element->width;
+    int32_t height = g1Element->height;
 
-    auto cacheInfo = AllocateImage(dpi.width, dpi.height);
+    auto cacheInfo = AllocateImage(width, height);
     cacheInfo.image = image;
 
-    glBindTexture(GL_TEXTURE_2D_ARRAY, _atlasesTexture);
-    glTexSubImage3D(
-        GL_TEXTURE_2D_ARRAY, 0, cacheInfo.bounds.x, cacheInfo.bounds.y, cacheInfo.index, dpi.width, dpi.height, 1,
-        GL_RED_INTEGER, GL_UNSIGNED_BYTE, dpi.bits);
-
-    DeleteDPI(dpi);
+    _pendingUploads.push_back({ cacheInfo, width, height, false, {}, 0 });
 
     return cacheInfo;
 }
 
 AtlasTextureInfo TextureCache::LoadGlyphTexture(uint32_t image, const PaletteMap& paletteMap)
 {
-    rct_drawpixelinfo dpi = GetGlyphAsDPI(image, paletteMap);
+    auto g1Element = gfx_get_g1_element(image & 0x7FFFFUL);
+    int32_t width = g1Element->width;
+    int32_t height = g1Element->height;
 
-    auto cacheInfo = AllocateImage(dpi.width, dpi.height);
+    auto cacheInfo = AllocateImage(width, height);
     cacheInfo.image = image;
 
-    glBindTexture(GL_TEXTURE_2D_ARRAY, _atlasesTexture);
-    glTexSubImage3D(
-        GL_TEXTURE_2D_ARRAY, 0, cacheInfo.bounds.x, cacheInfo.bounds.y, cacheInfo.index, dpi.width, dpi.height, 1,
-        GL_RED_INTEGER, GL_UNSIGNED_BYTE, dpi.bits);
-
-    DeleteDPI(dpi);
+    std::vector<uint8_t> pixels(static_cast<size_t>(width) * height);
+    RenderGlyph(image, paletteMap, pixels.data(), width, height);
+    _pendingUploads.push_back({ cacheInfo, width, height, true, std::move(pixels), 0 });
 
     return cacheInfo;
 }
@@ -283,6 +377,18 @@ AtlasTextureInfo TextureCache::AllocateImage(int32_t imageWidth, int32_t imageHe
         }
     }
 
+    // Rather than growing past the budget, reuse the slot of an image that has not been drawn for the longest time
+    if (IsAtlasBudgetReached() && EvictImage(imageWidth, imageHeight))
+    {
+        for (Atlas& atlas : _atlases)
+        {
+            if (atlas.GetFreeSlots() > 0 && atlas.IsImageSuitable(imageWidth, imageHeight))
+            {
+                return atlas.Allocate(imageWidth, imageHeight);
+            }
+        }
+    }
+
     // If there is no such atlas, then create a new one
     if (static_cast<int32_t>(_atlases.size()) >= _atlasesTextureIndicesLimit)
     {
@@ -306,46 +412,81 @@ AtlasTextureInfo TextureCache::AllocateImage(int32_t imageWidth, int32_t imageHe
     return _atlases.back().Allocate(imageWidth, imageHeight);
 }
 
-rct_drawpixelinfo TextureCache::GetImageAsDPI(uint32_t image, uint32_t tertiaryColour)
+bool TextureCache::IsAtlasBudgetReached() const
 {
-    auto g1Element = gfx_get_g1_element(image & 0x7FFFFUL);
-    int32_t width = g1Element->width;
-    int32_t height = g1Element->height;
+    if (gConfigGeneral.texture_memory_budget <= 0)
+        return false;
 
-    rct_drawpixelinfo dpi = CreateDPI(width, height);
-    gfx_draw_sprite_software(&dpi, ImageId::FromUInt32(image, tertiaryColour), { -g1Element->x_offset, -g1Element->y_offset });
-    return dpi;
+    const auto atlasBytes = static_cast<size_t>(_atlasesTextureDimensions) * _atlasesTextureDimensions;
+    const auto budgetBytes = static_cast<size_t>(gConfigGeneral.texture_memory_budget) * 1024 * 1024;
+    return (_atlases.size() + 1) * atlasBytes > budgetBytes;
+}
+
+bool TextureCache::EvictImage(int32_t imageWidth, int32_t imageHeight)
+{
+    // Only images of atlases with the right slot size make room, and only if they are not part of the current frame.
+    uint32_t lruIndex = UNUSED_INDEX;
+    uint32_t lruFrame = _currentFrame;
+    for (uint32_t i = 0; i < _textureCache.size(); i++)
+    {
+        const auto& info = _textureCache[i];
+        const auto lastUsedFrame = _imageLastUsedFrame[info.image].load(std::memory_order_relaxed);
+        if (lastUsedFrame < lruFrame && _atlases[info.index].IsImageSuitable(imageWidth, imageHeight))
+        {
+            lruIndex = i;
+            lruFrame = lastUsedFrame;
+        }
+    }
+
+    if (lruIndex == UNUSED_INDEX)
+        return false;
+
+    RemoveImage(lruIndex);
+    return true;
 }
 
-rct_drawpixelinfo TextureCache::GetGlyphAsDPI(uint32_t image, const PaletteMap& palette)
+void TextureCache::RenderImage(uint32_t image, uint8_t* bits, int32_t width, int32_t height)
 {
     auto g1Element = gfx_get_g1_element(image & 0x7FFFFUL);
-    int32_t width = g1Element->width;
-    int32_t height = g1Element->height;
+    rct_drawpixelinfo dpi = GetDPI(bits, width, height);
+    gfx_draw_sprite_software(&dpi, ImageId::FromUInt32(image, 0), { -g1Element->x_offset, -g1Element->y_offset });
+}
 
-    rct_drawpixelinfo dpi = CreateDPI(width, height);
+void TextureCache::RenderGlyph(uint32_t image, const PaletteMap& palette, uint8_t* bits, int32_t width, int32_t height)
+{
+    auto g1Element = gfx_get_g1_element(image & 0x7FFFFUL);
+    rct_drawpixelinfo dpi = GetDPI(bits, width, height);
 
     const auto glyphCoords = ScreenCoordsXY{ -g1Element->x_offset, -g1Element->y_offset };
     gfx_draw_sprite_palette_set_software(&dpi, ImageId::FromUInt32(image), glyphCoords, palette);
-    return dpi;
 }
 
 void TextureCache::FreeTextures()
 {
     // Free array texture
     glDeleteTextures(1, &_atlasesTexture);
+    if (_uploadBuffer != 0)
+    {
+        glDeleteBuffers(1, &_uploadBuffer);
+        _uploadBuffer = 0;
+    }
+    _pendingUploads.clear();
     _textureCache.clear();
     std::fill(_indexMap.begin(), _indexMap.end(), UNUSED_INDEX);
+    SetTextureBytes(0);
 }
 
-rct_drawpixelinfo TextureCache::CreateDPI(int32_t width, int32_t height)
+void TextureCache::SetTextureBytes(size_t bytes)
 {
-    size_t numPixels = width * height;
-    auto pixels8 = new uint8_t[numPixels];
-    std::fill_n(pixels8, numPixels, 0);
+    OpenRCT2::MemoryAccounting::Remove(OpenRCT2::MemoryAccounting::Category::Textures, _textureBytes);
+    OpenRCT2::MemoryAccounting::Add(OpenRCT2::MemoryAccounting::Category::Textures, bytes);
+    _textureBytes = bytes;
+}
 
+rct_drawpixelinfo TextureCache::GetDPI(uint8_t* bits, int32_t width, int32_t height)
+{
     rct_drawpixelinfo dpi;
-    dpi.bits = pixels8;
+    dpi.bits = bits;
     dpi.pitch = 0;
     dpi.x = 0;
     dpi.y = 0;
@@ -355,6 +496,15 @@ rct_drawpixelinfo TextureCache::CreateDPI(int32_t width, int32_t height)
     return dpi;
 }
 
+rct_drawpixelinfo TextureCache::CreateDPI(int32_t width, int32_t height)
+{
+    size_t numPixels = width * height;
+    auto pixels8 = new uint8_t[numPixels];
+    std::fill_n(pixels8, numPixels, 0);
+
+    return GetDPI(pixels8, width, height);
+}
+
 void TextureCache::DeleteDPI(rct_drawpixelinfo dpi)
 {
     delete[] dpi.bits;
@@ -15,6 +15,7 @@
 #include <SDL_pixels.h>
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <mutex>
 #include <openrct2/common.h>
 #ifndef __MACOSX__
@@ -191,6 +192,18 @@ private:
 class TextureCache final
 {
 private:
+    // An image whose atlas slot is already allocated, its pixels are uploaded when the draw commands are flushed
+    struct PendingUpload
+    {
+        AtlasTextureInfo Info;
+        int32_t Width;
+        int32_t Height;
+        bool IsGlyph;
+        // Glyphs are rendered straight away, the palette map they are drawn with is not owned by the cache
+        std::vector<uint8_t> GlyphPixels;
+        size_t Offset;
+    };
+
     bool _initialized = false;
 
     GLuint _atlasesTexture = 0;
@@ -202,9 +215,20 @@ private:
     std::unordered_map<GlyphId, AtlasTextureInfo, GlyphId::Hash, GlyphId::Equal> _glyphTextureMap;
     std::vector<AtlasTextureInfo> _textureCache;
     std::array<uint32_t, 0x7FFFF> _indexMap;
+    // Frame each cached image was last drawn in, used to evict the least recently used images once the budget is
+    // reached. Written by readers holding the shared lock, hence atomic.
+    std::array<std::atomic<uint32_t>, 0x7FFFF> _imageLastUsedFrame;
+    uint32_t _currentFrame = 1;
 
     GLuint _paletteTexture = 0;
 
+    std::vector<PendingUpload> _pendingUploads;
+    std::vector<uint8_t> _uploadPixels;
+    GLuint _uploadBuffer = 0;
+
+    // Bytes of texture storage reported to the memory accounting.
+    size_t _textureBytes = 0;
+
 #ifndef __MACOSX__
     std::shared_mutex _mutex;
     using shared_lock = std::shared_lock<std::shared_mutex>;
@@ -219,6 +243,17 @@ public:
     TextureCache();
     ~TextureCache();
     void InvalidateImage(uint32_t image);
+
+    /**
+     * Starts a new frame. Images drawn since the last call are referenced by pending draw commands and are never
+     * evicted.
+     */
+    void BeginFrame();
+    /**
+     * Renders the images loaded since the last call and uploads them to the atlases, has to be called before the draw
+     * commands using them are flushed.
+     */
+    void FlushUploads();
     BasicTextureInfo GetOrLoadImageTexture(uint32_t image);
     BasicTextureInfo GetOrLoadGlyphTexture(uint32_t image, const PaletteMap& paletteMap);
 
@@ -233,10 +268,15 @@ private:
     AtlasTextureInfo LoadImageTexture(uint32_t image);
     AtlasTextureInfo LoadGlyphTexture(uint32_t image, const PaletteMap& paletteMap);
     AtlasTextureInfo AllocateImage(int32_t imageWidth, int32_t imageHeight);
-    static rct_drawpixelinfo GetImageAsDPI(uint32_t image, uint32_t tertiaryColour);
-    static rct_drawpixelinfo GetGlyphAsDPI(uint32_t image, const PaletteMap& paletteMap);
+    bool IsAtlasBudgetReached() const;
+    bool EvictImage(int32_t imageWidth, int32_t imageHeight);
+    void RemoveImage(uint32_t index);
+    static void RenderImage(uint32_t image, uint8_t* bits, int32_t width, int32_t height);
+    static void RenderGlyph(uint32_t image, const PaletteMap& paletteMap, uint8_t* bits, int32_t width, int32_t height);
     void FreeTextures();
+    void SetTextureBytes(size_t bytes);
 
+    static rct_drawpixelinfo GetDPI(uint8_t* bits, int32_t width, int32_t height);
     static rct_drawpixelinfo CreateDPI(int32_t width, int32_t height);
     static void DeleteDPI(rct_drawpixelinfo dpi);
 };
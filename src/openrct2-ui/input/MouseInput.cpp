@@ -132,6 +132,24 @@ void GameHandleInput()
     window_visit_each([](rct_window* w) { window_event_unknown_08_call(w); });
 }
 
+/**
+ * Updates the active tool for the current cursor position between game ticks. Queued clicks are left for the next
+ * tick, this only moves the tool's ghosts and highlights with the cursor.
+ */
+void GameUpdateToolAtCursor()
+{
+    if (_inputState != InputState::Normal || (_inputFlags & INPUT_FLAG_5)
+        || _mouseInputQueueReadIndex != _mouseInputQueueWriteIndex)
+    {
+        return;
+    }
+
+    const CursorState* cursorState = context_get_cursor_state();
+    ScreenCoordsXY screenCoords = { std::clamp(cursorState->position.x, 0, context_get_width() - 1),
+                                    std::clamp(cursorState->position.y, 0, context_get_height() - 1) };
+    ProcessMouseTool(screenCoords);
+}
+
 /**
  *
  *  rct2: 0x006E83C7
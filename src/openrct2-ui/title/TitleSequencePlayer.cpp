@@ -12,6 +12,7 @@
 #include "../interface/Window.h"
 
 #include <algorithm>
+#include <future>
 #include <memory>
 #include <openrct2/Context.h>
 #include <openrct2/Game.h>
@@ -21,6 +22,7 @@
 #include <openrct2/common.h>
 #include <openrct2/core/Console.hpp>
 #include <openrct2/core/Guard.hpp>
+#include <openrct2/core/MemoryStream.h>
 #include <openrct2/core/Path.hpp>
 #include <openrct2/core/String.hpp>
 #include <openrct2/interface/Viewport.h>
@@ -51,6 +53,10 @@ private:
     int32_t _position = 0;
     int32_t _waitCounter = 0;
 
+    // The park of the next load command, read on a background thread while the current scene plays
+    std::future<std::unique_ptr<TitleSequenceParkHandle>> _preloadedPark;
+    uint8_t _preloadedSaveIndex = 0;
+
     int32_t _lastScreenWidth = 0;
     int32_t _lastScreenHeight = 0;
     CoordsXY _viewCentreLocation = {};
@@ -73,6 +79,12 @@ public:
 
     void Eject() override
     {
+        // The preload reads from the sequence, so it has to finish first
+        if (_preloadedPark.valid())
+        {
+            _preloadedPark.wait();
+            _preloadedPark = {};
+        }
         _sequence = nullptr;
     }
 
@@ -282,7 +294,11 @@ private:
             {
                 bool loadSuccess = false;
                 uint8_t saveIndex = command.SaveIndex;
-                auto parkHandle = TitleSequenceGetParkHandle(*_sequence, saveIndex);
+                auto parkHandle = TakePreloadedPark(saveIndex);
+                if (parkHandle == nullptr)
+                {
+                    parkHandle = TitleSequenceGetParkHandle(*_sequence, saveIndex);
+                }
                 if (parkHandle != nullptr)
                 {
                     loadSuccess = LoadParkFromStream(parkHandle->Stream.get(), parkHandle->HintPath);
@@ -296,6 +312,7 @@ private:
                     }
                     return false;
                 }
+                PreloadNextPark();
                 break;
             }
             case TitleScript::LoadSc:
@@ -317,6 +334,75 @@ private:
         return true;
     }
 
+    /**
+     * Starts reading the park of the next load command of the sequence into memory, so that the next scene does not
+     * have to wait for the title sequence archive or the disk.
+     */
+    void PreloadNextPark()
+    {
+        const auto numCommands = _sequence->Commands.size();
+        for (size_t i = 1; i < numCommands; i++)
+        {
+            const auto& command = _sequence->Commands[(_position + i) % numCommands];
+            if (command.Type == TitleScript::Load)
+            {
+                if (command.SaveIndex >= _sequence->Saves.size())
+                {
+                    return;
+                }
+
+                const auto& sequence = *_sequence;
+                const auto saveIndex = command.SaveIndex;
+                _preloadedSaveIndex = saveIndex;
+                _preloadedPark = std::async(
+                    std::launch::async, [&sequence, saveIndex]() { return ReadPark(sequence, saveIndex); });
+                return;
+            }
+            if (command.Type == TitleScript::LoadSc)
+            {
+                return;
+            }
+        }
+    }
+
+    /**
+     * Returns the preloaded park if it is the requested one, otherwise nullptr.
+     */
+    std::unique_ptr<TitleSequenceParkHandle> TakePreloadedPark(uint8_t saveIndex)
+    {
+        if (!_preloadedPark.valid())
+        {
+            return nullptr;
+        }
+        auto parkHandle = _preloadedPark.get();
+        if (_preloadedSaveIndex != saveIndex)
+        {
+            return nullptr;
+        }
+        return parkHandle;
+    }
+
+    static std::unique_ptr<TitleSequenceParkHandle> ReadPark(const TitleSequence& sequence, uint8_t saveIndex)
+    {
+        try
+        {
+            auto parkHandle = TitleSequenceGetParkHandle(sequence, saveIndex);
+            if (parkHandle != nullptr && !sequence.IsZip)
+            {
+                // Parks of sequences in a directory are opened but not read, read them into memory as well
+                std::vector<uint8_t> data(static_cast<size_t>(parkHandle->Stream->GetLength()));
+                parkHandle->Stream->Read(data.data(), data.size());
+                parkHandle->Stream = std::make_unique<OpenRCT2::MemoryStream>(std::move(data));
+            }
+            return parkHandle;
+        }
+        catch (const std::exception&)
+        {
+            // Leave it for the load command, which reports the error
+            return nullptr;
+        }
+    }
+
     void SetViewZoom(const uint32_t& zoom)
     {
         rct_window* w = window_get_main();
@@ -36,6 +36,7 @@
 #include <openrct2/title/TitleScreen.h>
 #include <openrct2/util/Util.h>
 #include <openrct2/windows/Intent.h>
+#include <array>
 #include <string>
 #include <vector>
 
@@ -220,7 +221,7 @@ static int32_t get_object_from_object_selection(ObjectType object_type, int32_t
 static void window_editor_object_selection_manage_tracks();
 static void editor_load_selected_objects();
 static bool filter_selected(uint8_t objectFlags);
-static bool filter_string(const ObjectRepositoryItem* item);
+static bool filter_string(size_t index, const ObjectRepositoryItem* item);
 static bool filter_source(const ObjectRepositoryItem* item);
 static bool filter_chunks(const ObjectRepositoryItem* item);
 static void filter_update_counts();
@@ -266,6 +267,69 @@ static int32_t _listSortType = RIDE_SORT_TYPE;
 static bool _listSortDescending = false;
 static std::unique_ptr<Object> _loadedObject;
 
+/**
+ * The lowercase texts the search box is matched against, built once per repository item instead of on every
+ * keystroke.
+ */
+struct ObjectSearchTerms
+{
+    std::string Name;
+    std::string RideType;
+    std::string Path;
+};
+
+static std::vector<ObjectSearchTerms> _objectSearchTerms;
+static std::array<std::vector<int32_t>, EnumValue(ObjectType::Count)> _objectsByType;
+static std::string _filterStringLower;
+
+static std::string object_search_to_lower(std::string_view text)
+{
+    std::string result(text);
+    std::transform(result.begin(), result.end(), result.begin(), [](char c) {
+        return static_cast<char>(tolower(static_cast<unsigned char>(c)));
+    });
+    return result;
+}
+
+static void object_search_index_build()
+{
+    const auto numObjects = object_repository_get_items_count();
+    const ObjectRepositoryItem* items = object_repository_get_items();
+
+    _objectSearchTerms.clear();
+    _objectSearchTerms.reserve(numObjects);
+    for (auto& objects : _objectsByType)
+    {
+        objects.clear();
+    }
+
+    for (size_t i = 0; i < numObjects; i++)
+    {
+        const auto& item = items[i];
+        _objectSearchTerms.push_back({ object_search_to_lower(item.Name),
+                                       object_search_to_lower(language_get_string(get_ride_type_string_id(&item))),
+                                       object_search_to_lower(item.Path) });
+
+        const auto objectType = EnumValue(item.ObjectEntry.GetType());
+        if (objectType < _objectsByType.size())
+        {
+            _objectsByType[objectType].push_back(static_cast<int32_t>(i));
+        }
+    }
+}
+
+/**
+ * Rebuilds the search index if the repository changed and lowercases the current search text.
+ */
+static void object_search_prepare()
+{
+    if (_objectSearchTerms.size() != object_repository_get_items_count())
+    {
+        object_search_index_build();
+    }
+    _filterStringLower = object_search_to_lower(_filter_string);
+}
+
 static void visible_list_dispose()
 {
     _listItems.clear();
@@ -289,19 +353,17 @@ static bool visible_list_sort_ride_type(const list_item& a, const list_item& b)
 
 static void visible_list_refresh(rct_window* w)
 {
-    int32_t numObjects = static_cast<int32_t>(object_repository_get_items_count());
-
     visible_list_dispose();
     w->selected_list_item = -1;
+    object_search_prepare();
 
     const ObjectRepositoryItem* items = object_repository_get_items();
-    for (int32_t i = 0; i < numObjects; i++)
+    for (auto i : _objectsByType[EnumValue(get_selected_object_type(w))])
     {
         uint8_t selectionFlags = _objectSelectionFlags[i];
         const ObjectRepositoryItem* item = &items[i];
-        ObjectType objectType = item->ObjectEntry.GetType();
-        if (objectType == get_selected_object_type(w) && !(selectionFlags & OBJECT_SELECTION_FLAG_6) && filter_source(item)
-            && filter_string(item) && filter_chunks(item) && filter_selected(selectionFlags))
+        if (!(selectionFlags & OBJECT_SELECTION_FLAG_6) && filter_source(item) && filter_string(i, item) && filter_chunks(item)
+            && filter_selected(selectionFlags))
         {
             auto filter = std::make_unique<rct_object_filters>();
             filter->ride.category[0] = 0;
@@ -376,6 +438,7 @@ rct_window* window_editor_object_selection_open()
 
     sub_6AB211();
     reset_selected_object_count_and_size();
+    object_search_index_build();
 
     window = WindowCreateCentred(
         600, 400, &window_editor_object_selection_events, WC_EDITOR_OBJECT_SELECTION, WF_10 | WF_RESIZABLE);
@@ -1460,7 +1523,7 @@ static bool filter_selected(uint8_t objectFlag)
     }
 }
 
-static bool filter_string(const ObjectRepositoryItem* item)
+static bool filter_string(size_t index, const ObjectRepositoryItem* item)
 {
     // Nothing to search for
     if (_filter_string[0] == '\0')
@@ -1470,33 +1533,12 @@ static bool filter_string(const ObjectRepositoryItem* item)
     if (item->Name.empty())
         return false;
 
-    // Get ride type
-    const char* rideTypeName = language_get_string(get_ride_type_string_id(item));
-
-    // Get object name (ride/vehicle for rides) and type name (rides only)
-    char name_lower[MAX_PATH];
-    char type_lower[MAX_PATH];
-    char object_path[MAX_PATH];
-    char filter_lower[sizeof(_filter_string)];
-    safe_strcpy(name_lower, item->Name.c_str(), MAX_PATH);
-    safe_strcpy(type_lower, rideTypeName, MAX_PATH);
-    safe_strcpy(object_path, item->Path.c_str(), MAX_PATH);
-    safe_strcpy(filter_lower, _filter_string, sizeof(_filter_string));
-
-    // Make use of lowercase characters only
-    for (int32_t i = 0; name_lower[i] != '\0'; i++)
-        name_lower[i] = static_cast<char>(tolower(name_lower[i]));
-    for (int32_t i = 0; type_lower[i] != '\0'; i++)
-        type_lower[i] = static_cast<char>(tolower(type_lower[i]));
-    for (int32_t i = 0; object_path[i] != '\0'; i++)
-        object_path[i] = static_cast<char>(tolower(object_path[i]));
-    for (int32_t i = 0; filter_lower[i] != '\0'; i++)
-        filter_lower[i] = static_cast<char>(tolower(filter_lower[i]));
-
     // Check if the searched string exists in the name, ride type, or filename
-    bool inName = strstr(name_lower, filter_lower) != nullptr;
-    bool inRideType = (item->ObjectEntry.GetType() == ObjectType::Ride) && strstr(type_lower, filter_lower) != nullptr;
-    bool inPath = strstr(object_path, filter_lower) != nullptr;
+    const auto& terms = _objectSearchTerms[index];
+    bool inName = terms.Name.find(_filterStringLower) != std::string::npos;
+    bool inRideType = (item->ObjectEntry.GetType() == ObjectType::Ride)
+        && terms.RideType.find(_filterStringLower) != std::string::npos;
+    bool inPath = terms.Path.find(_filterStringLower) != std::string::npos;
 
     return inName || inRideType || inPath;
 }
@@ -1560,13 +1602,14 @@ static void filter_update_counts()
     {
         const auto& selectionFlags = _objectSelectionFlags;
         std::fill(std::begin(_filter_object_counts), std::end(_filter_object_counts), 0);
+        object_search_prepare();
 
         size_t numObjects = object_repository_get_items_count();
         const ObjectRepositoryItem* items = object_repository_get_items();
         for (size_t i = 0; i < numObjects; i++)
         {
             const ObjectRepositoryItem* item = &items[i];
-            if (filter_source(item) && filter_string(item) && filter_chunks(item) && filter_selected(selectionFlags[i]))
+            if (filter_source(item) && filter_string(i, item) && filter_chunks(item) && filter_selected(selectionFlags[i]))
             {
                 ObjectType objectType = item->ObjectEntry.GetType();
                 _filter_object_counts[EnumValue(objectType)]++;
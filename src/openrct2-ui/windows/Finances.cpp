@@ -383,7 +383,7 @@ rct_window* window_finances_open()
     w = window_bring_to_front_by_class(WC_FINANCES);
     if (w == nullptr)
     {
-        w = WindowCreateAutoPos(WW_OTHER_TABS, WH_SUMMARY, _windowFinancesPageEvents[0], WC_FINANCES, WF_10);
+        w = WindowCreateAutoPos(WW_OTHER_TABS, WH_SUMMARY, _windowFinancesPageEvents[0], WC_FINANCES, WF_10 | WF_CACHE_SURFACE);
         w->number = 0;
         w->frame_no = 0;
 
@@ -683,11 +683,10 @@ static void window_finances_financial_graph_mouseup(rct_window* w, rct_widgetind
  */
 static void window_finances_financial_graph_update(rct_window* w)
 {
-    // Tab animation
+    // Tab animation, the graph itself is invalidated whenever the finances change
     if (++w->frame_no >= WindowFinancesTabAnimationLoops[w->page])
         w->frame_no = 0;
-
-    w->Invalidate();
+    widget_invalidate(w, WIDX_TAB_2);
 }
 
 /**
@@ -793,11 +792,10 @@ static void window_finances_park_value_graph_mouseup(rct_window* w, rct_widgetin
  */
 static void window_finances_park_value_graph_update(rct_window* w)
 {
-    // Tab animation
+    // Tab animation, the graph itself is invalidated whenever the finances change
     if (++w->frame_no >= WindowFinancesTabAnimationLoops[w->page])
         w->frame_no = 0;
-
-    w->Invalidate();
+    widget_invalidate(w, WIDX_TAB_3);
 }
 
 /**
@@ -8,6 +8,7 @@
  *****************************************************************************/
 
 #include <cmath>
+#include <limits>
 #include <openrct2-ui/interface/Dropdown.h>
 #include <openrct2-ui/interface/Widget.h>
 #include <openrct2-ui/windows/Window.h>
@@ -22,6 +23,9 @@
 #include <openrct2/util/Util.h>
 #include <openrct2/world/Park.h>
 #include <openrct2/world/Sprite.h>
+#include <optional>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 static constexpr const rct_string_id WINDOW_TITLE = STR_GUESTS;
@@ -119,13 +123,14 @@ private:
         using CompareFunc = bool (*)(const GuestItem&, const GuestItem&);
 
         uint16_t Id;
-        char Name[256];
+        std::string Name;
     };
 
     static constexpr const uint8_t SUMMARISED_GUEST_ROW_HEIGHT = SCROLLABLE_ROW_HEIGHT + 11;
     static constexpr const auto GUESTS_PER_PAGE = 2000;
     static constexpr const auto GUEST_PAGE_HEIGHT = GUESTS_PER_PAGE * SCROLLABLE_ROW_HEIGHT;
     static constexpr size_t MaxGroups = 240;
+    static constexpr uint32_t RefreshListInterval = 40;
 
     TabId _selectedTab{};
     GuestViewType _selectedView{};
@@ -142,8 +147,11 @@ private:
     uint32_t _lastFindGroupsWait{};
     std::vector<GuestGroup> _groups;
 
+    // Kept sorted, single guests are inserted into or removed from it as they enter, leave or get renamed
     std::vector<GuestItem> _guestList;
     std::optional<size_t> _highlightedIndex;
+    bool _refreshListRequired{};
+    uint32_t _refreshListWait{};
 
     uint32_t _tabAnimationIndex{};
 
@@ -264,6 +272,16 @@ public:
             _lastFindGroupsWait--;
         }
 
+        if (_refreshListWait != 0)
+        {
+            _refreshListWait--;
+        }
+        else if (_refreshListRequired)
+        {
+            RefreshList();
+            Invalidate();
+        }
+
         // Current tab image animation
         _tabAnimationIndex++;
         if (_tabAnimationIndex >= (_selectedTab == TabId::Individual ? 24UL : 32UL))
@@ -548,20 +566,15 @@ public:
         {
             case TabId::Individual:
             {
-                auto i = screenCoords.y / SCROLLABLE_ROW_HEIGHT;
-                i += static_cast<int32_t>(_selectedPage * GUESTS_PER_PAGE);
-                for (const auto& guestItem : _guestList)
+                auto i = static_cast<size_t>(screenCoords.y / SCROLLABLE_ROW_HEIGHT);
+                i += _selectedPage * GUESTS_PER_PAGE;
+                if (i < _guestList.size())
                 {
-                    if (i == 0)
+                    auto guest = GetEntity<Guest>(_guestList[i].Id);
+                    if (guest != nullptr)
                     {
-                        auto guest = GetEntity<Guest>(guestItem.Id);
-                        if (guest != nullptr)
-                        {
-                            window_guest_open(guest);
-                        }
-                        break;
+                        window_guest_open(guest);
                     }
-                    i--;
                 }
                 break;
             }
@@ -612,28 +625,53 @@ public:
 
             for (auto peep : EntityList<Guest>())
             {
-                sprite_set_flashing(peep, false);
-                if (peep->OutsideOfPark)
-                    continue;
-                if (_selectedFilter)
+                auto item = CreateGuestItem(*peep);
+                if (item)
                 {
-                    if (!IsPeepInFilter(*peep))
-                        continue;
-                    sprite_set_flashing(peep, true);
+                    _guestList.push_back(std::move(*item));
                 }
-                if (!GuestShouldBeVisible(*peep))
-                    continue;
-
-                auto& item = _guestList.emplace_back();
-                item.Id = peep->sprite_index;
-
-                Formatter ft;
-                peep->FormatNameTo(ft);
-                format_string(item.Name, sizeof(item.Name), STR_STRINGID, ft.Data());
             }
 
             std::sort(_guestList.begin(), _guestList.end(), GetGuestCompareFunc());
         }
+        _refreshListRequired = false;
+        _refreshListWait = RefreshListInterval;
+    }
+
+    /**
+     * Updates the position of a single guest that entered or left the park or got renamed. A filtered list depends on
+     * what all guests are doing, so it is refreshed as a whole, at most every RefreshListInterval updates.
+     */
+    void UpdateGuest(Guest& guest)
+    {
+        if (_selectedTab != TabId::Individual)
+            return;
+
+        if (_selectedFilter)
+        {
+            _refreshListRequired = true;
+            return;
+        }
+
+        RemoveGuest(guest.sprite_index);
+        auto item = CreateGuestItem(guest);
+        if (item)
+        {
+            auto it = std::upper_bound(_guestList.begin(), _guestList.end(), *item, GetGuestCompareFunc());
+            _guestList.insert(it, std::move(*item));
+        }
+        Invalidate();
+    }
+
+    void RemoveGuest(uint16_t spriteIndex)
+    {
+        auto it = std::find_if(
+            _guestList.begin(), _guestList.end(), [spriteIndex](const GuestItem& item) { return item.Id == spriteIndex; });
+        if (it != _guestList.end())
+        {
+            _guestList.erase(it);
+            Invalidate();
+        }
     }
 
 private:
@@ -656,13 +694,18 @@ private:
 
     void DrawScrollIndividual(rct_drawpixelinfo& dpi)
     {
-        size_t index = 0;
-        auto y = static_cast<int32_t>(_selectedPage) * -GUEST_PAGE_HEIGHT;
-        for (const auto& guestItem : _guestList)
+        // Only the rows within the clip are formatted, start at the first row that can overlap it
+        auto pageOffset = static_cast<int64_t>(_selectedPage) * GUEST_PAGE_HEIGHT;
+        auto firstRow = std::max<int64_t>(0, (pageOffset + dpi.y - SCROLLABLE_ROW_HEIGHT - 1) / SCROLLABLE_ROW_HEIGHT);
+        for (auto index = static_cast<size_t>(firstRow); index < _guestList.size(); index++)
         {
+            const auto& guestItem = _guestList[index];
+            auto y = static_cast<int32_t>(static_cast<int64_t>(index) * SCROLLABLE_ROW_HEIGHT - pageOffset);
+            if (y >= dpi.y + dpi.height || y >= 0x7FFF)
+                break;
+
             // Check if y is beyond the scroll control
-            if (y + SCROLLABLE_ROW_HEIGHT + 1 >= -0x7FFF && y + SCROLLABLE_ROW_HEIGHT + 1 > dpi.y && y < 0x7FFF
-                && y < dpi.y + dpi.height)
+            if (y + SCROLLABLE_ROW_HEIGHT + 1 >= -0x7FFF && y + SCROLLABLE_ROW_HEIGHT + 1 > dpi.y)
             {
                 // Highlight backcolour and text colour (format)
                 rct_string_id format = STR_BLACK_STRING;
@@ -716,8 +759,6 @@ private:
                         break;
                 }
             }
-            y += SCROLLABLE_ROW_HEIGHT;
-            index++;
         }
     }
 
@@ -773,25 +814,33 @@ private:
         }
     }
 
-    bool GuestShouldBeVisible(const Guest& peep)
+    /**
+     * Creates the list item for a guest if it passes the filters, the guests matching the filter flash on the map.
+     */
+    std::optional<GuestItem> CreateGuestItem(Guest& peep)
     {
-        if (_trackingOnly && !(peep.PeepFlags & PEEP_FLAGS_TRACKING))
-            return false;
-
-        if (!_filterName.empty())
+        sprite_set_flashing(&peep, false);
+        if (peep.OutsideOfPark)
+            return std::nullopt;
+        if (_selectedFilter)
         {
-            char name[256]{};
-
-            Formatter ft;
-            peep.FormatNameTo(ft);
-            format_string(name, sizeof(name), STR_STRINGID, ft.Data());
-            if (strcasestr(name, _filterName.c_str()) == nullptr)
-            {
-                return false;
-            }
+            if (!IsPeepInFilter(peep))
+                return std::nullopt;
+            sprite_set_flashing(&peep, true);
         }
-
-        return true;
+        if (_trackingOnly && !(peep.PeepFlags & PEEP_FLAGS_TRACKING))
+            return std::nullopt;
+
+        // The name is needed for sorting and the name filter, format it once
+        Formatter ft;
+        peep.FormatNameTo(ft);
+        GuestItem item;
+        item.Id = peep.sprite_index;
+        item.Name = format_string(STR_STRINGID, ft.Data());
+        if (!_filterName.empty() && strcasestr(item.Name.c_str(), _filterName.c_str()) == nullptr)
+            return std::nullopt;
+
+        return item;
     }
 
     bool IsPeepInFilter(const Guest& peep)
@@ -819,17 +868,31 @@ private:
         return true;
     }
 
-    GuestGroup& FindOrAddGroup(FilterArguments&& arguments)
+    size_t FindOrAddGroup(std::unordered_map<std::string, size_t>& groupIndices, FilterArguments&& arguments)
     {
-        auto foundGroup = std::find_if(
-            std::begin(_groups), std::end(_groups), [&arguments](GuestGroup& group) { return group.Arguments == arguments; });
-        if (foundGroup != std::end(_groups))
+        // The arguments of a group are raw bytes, use them as the key as they are
+        auto key = std::string(reinterpret_cast<const char*>(arguments.args), sizeof(arguments.args));
+        auto [foundGroup, isNew] = groupIndices.emplace(std::move(key), _groups.size());
+        if (isNew)
+        {
+            auto& newGroup = _groups.emplace_back();
+            newGroup.Arguments = arguments;
+        }
+        return foundGroup->second;
+    }
+
+    /**
+     * Identifies the thought GetArgumentsFromPeep formats for the thoughts view, guests with the same key always have
+     * the same arguments.
+     */
+    static uint16_t GetThoughtKey(const Guest& peep)
+    {
+        const auto& thought = peep.Thoughts[0];
+        if (thought.type == PeepThoughtType::None || thought.freshness > 5)
         {
-            return *foundGroup;
+            return std::numeric_limits<uint16_t>::max();
         }
-        auto& newGroup = _groups.emplace_back();
-        newGroup.Arguments = arguments;
-        return newGroup;
+        return static_cast<uint16_t>((EnumValue(thought.type) << 8) | thought.item);
     }
 
     void RefreshGroups()
@@ -839,12 +902,35 @@ private:
         _lastFindGroupsWait = 320;
         _groups.clear();
 
+        std::unordered_map<std::string, size_t> groupIndices;
+        // Most guests share a handful of thoughts, so each distinct thought is only formatted once
+        std::unordered_map<uint16_t, size_t> thoughtGroupIndices;
         for (auto peep : EntityList<Guest>())
         {
             if (peep->OutsideOfPark)
                 continue;
 
-            auto& group = FindOrAddGroup(GetArgumentsFromPeep(*peep, _selectedView));
+            size_t groupIndex;
+            if (_selectedView == GuestViewType::Thoughts)
+            {
+                auto thoughtKey = GetThoughtKey(*peep);
+                auto foundThoughtGroup = thoughtGroupIndices.find(thoughtKey);
+                if (foundThoughtGroup != thoughtGroupIndices.end())
+                {
+                    groupIndex = foundThoughtGroup->second;
+                }
+                else
+                {
+                    groupIndex = FindOrAddGroup(groupIndices, GetArgumentsFromPeep(*peep, _selectedView));
+                    thoughtGroupIndices.emplace(thoughtKey, groupIndex);
+                }
+            }
+            else
+            {
+                groupIndex = FindOrAddGroup(groupIndices, GetArgumentsFromPeep(*peep, _selectedView));
+            }
+
+            auto& group = _groups[groupIndex];
             if (group.NumGuests < std::size(group.Faces))
             {
                 group.Faces[group.NumGuests] = get_peep_face_sprite_small(peep) - SPR_PEEP_SMALL_FACE_VERY_VERY_UNHAPPY;
@@ -945,7 +1031,7 @@ private:
                 }
             }
         }
-        return strlogicalcmp(a.Name, b.Name) < 0;
+        return strlogicalcmp(a.Name.c_str(), b.Name.c_str()) < 0;
     }
 
     static GuestItem::CompareFunc GetGuestCompareFunc()
@@ -985,3 +1071,21 @@ void window_guest_list_refresh_list()
         static_cast<GuestListWindow*>(w)->RefreshList();
     }
 }
+
+void window_guest_list_update_guest(Guest* guest)
+{
+    auto* w = window_find_by_class(WC_GUEST_LIST);
+    if (w != nullptr)
+    {
+        static_cast<GuestListWindow*>(w)->UpdateGuest(*guest);
+    }
+}
+
+void window_guest_list_remove_guest(Guest* guest)
+{
+    auto* w = window_find_by_class(WC_GUEST_LIST);
+    if (w != nullptr)
+    {
+        static_cast<GuestListWindow*>(w)->RemoveGuest(guest->sprite_index);
+    }
+}
@@ -187,14 +187,34 @@ static uint32_t _currentLine;
 /** rct2: 0x00F1AD68 */
 static std::vector<uint8_t> _mapImageData;
 
+// After the map image is reset it is drawn line by line at the full rate. From then on, tiles are redrawn as they get
+// invalidated, and the rolling redraw slows down to only catch changes that did not invalidate their tile.
+static constexpr int32_t MapLinesPerUpdate = 16;
+static constexpr int32_t MapBackgroundLinesPerUpdate = 1;
+static int32_t _linesToDraw;
+
+// The guests, staff or vehicles drawn on top of the map, collected at a lower rate than the window is painted.
+struct MapOverlayPixel
+{
+    ScreenCoordsXY LeftTop;
+    ScreenCoordsXY RightBottom;
+    uint8_t Colour;
+};
+static constexpr uint32_t MapOverlayRebuildInterval = 4;
+static std::vector<MapOverlayPixel> _mapOverlayPixels;
+static uint32_t _mapOverlayAge;
+static uint16_t _mapOverlayFlashingFlags;
+static int16_t _mapOverlayTab = -1;
+
 static uint16_t _landRightsToolSize;
 
 static void window_map_init_map();
 static void window_map_centre_on_view_point();
 static void window_map_show_default_scenario_editor_buttons(rct_window* w);
 static void window_map_draw_tab_images(rct_window* w, rct_drawpixelinfo* dpi);
-static void window_map_paint_peep_overlay(rct_drawpixelinfo* dpi);
-static void window_map_paint_train_overlay(rct_drawpixelinfo* dpi);
+static void window_map_update_overlay(rct_window* w);
+static void window_map_build_peep_overlay();
+static void window_map_build_train_overlay();
 static void window_map_paint_hud_rectangle(rct_drawpixelinfo* dpi);
 static void window_map_inputsize_land(rct_window* w);
 static void window_map_inputsize_map(rct_window* w);
@@ -207,6 +227,7 @@ static void window_map_set_peep_spawn_tool_down(const ScreenCoordsXY& screenCoor
 static void map_window_increase_map_size();
 static void map_window_decrease_map_size();
 static void map_window_set_pixels(rct_window* w);
+static void map_window_set_changed_tile_pixels(rct_window* w);
 
 static CoordsXY map_window_screen_to_map(ScreenCoordsXY screenCoords);
 
@@ -253,6 +274,7 @@ rct_window* window_map_open()
 
     w->map.rotation = get_current_rotation();
 
+    map_set_changed_tile_tracking(true);
     window_map_init_map();
     gWindowSceneryRotation = 0;
     window_map_centre_on_view_point();
@@ -284,8 +306,11 @@ void window_map_reset()
  */
 static void window_map_close(rct_window* w)
 {
+    map_set_changed_tile_tracking(false);
     _mapImageData.clear();
     _mapImageData.shrink_to_fit();
+    _mapOverlayPixels.clear();
+    _mapOverlayPixels.shrink_to_fit();
     if ((input_test_flag(INPUT_FLAG_TOOL_ACTIVE)) && gCurrentToolWidget.window_classification == w->classification
         && gCurrentToolWidget.window_number == w->number)
     {
@@ -388,6 +413,9 @@ static void window_map_mouseup(rct_window* w, rct_widgetindex widgetIndex)
 
                 w->selected_tab = widgetIndex;
                 w->list_information_type = 0;
+
+                // The pages colour the map differently, redraw it over the old page at the full rate
+                _linesToDraw = MAXIMUM_MAP_SIZE_TECHNICAL;
             }
     }
 }
@@ -447,8 +475,13 @@ static void window_map_update(rct_window* w)
         window_map_centre_on_view_point();
     }
 
-    for (int32_t i = 0; i < 16; i++)
+    map_window_set_changed_tile_pixels(w);
+    auto numLines = _linesToDraw > 0 ? MapLinesPerUpdate : MapBackgroundLinesPerUpdate;
+    for (int32_t i = 0; i < numLines; i++)
         map_window_set_pixels(w);
+    _linesToDraw = std::max(0, _linesToDraw - numLines);
+
+    window_map_update_overlay(w);
 
     w->Invalidate();
 
@@ -888,13 +921,9 @@ static void window_map_scrollpaint(rct_window* w, rct_drawpixelinfo* dpi, int32_
     drawing_engine_invalidate_image(SPR_TEMP);
     gfx_draw_sprite(dpi, ImageId(SPR_TEMP), { 0, 0 });
 
-    if (w->selected_tab == PAGE_PEEPS)
-    {
-        window_map_paint_peep_overlay(dpi);
-    }
-    else
+    for (const auto& pixel : _mapOverlayPixels)
     {
-        window_map_paint_train_overlay(dpi);
+        gfx_fill_rect(dpi, { pixel.LeftTop, pixel.RightBottom }, pixel.Colour);
     }
     window_map_paint_hud_rectangle(dpi);
 }
@@ -907,6 +936,11 @@ static void window_map_init_map()
 {
     std::fill(_mapImageData.begin(), _mapImageData.end(), PALETTE_INDEX_10);
     _currentLine = 0;
+    _linesToDraw = MAXIMUM_MAP_SIZE_TECHNICAL;
+    _mapOverlayTab = -1;
+
+    // Everything gets drawn again anyway
+    map_take_changed_tiles();
 }
 
 /**
@@ -1021,7 +1055,7 @@ static void window_map_draw_tab_images(rct_window* w, rct_drawpixelinfo* dpi)
 
 /**
  *
- * part of window_map_paint_peep_overlay and window_map_paint_train_overlay
+ * part of window_map_build_peep_overlay and window_map_build_train_overlay
  */
 static MapCoordsXY window_map_transform_to_map_coords(CoordsXY c)
 {
@@ -1050,7 +1084,7 @@ static MapCoordsXY window_map_transform_to_map_coords(CoordsXY c)
     return { -x + y + MAXIMUM_MAP_SIZE_TECHNICAL - 8, x + y - 8 };
 }
 
-static void DrawMapPeepPixel(Peep* peep, const uint8_t flashColour, rct_drawpixelinfo* dpi)
+static void AddMapPeepPixel(Peep* peep, const uint8_t flashColour)
 {
     if (peep->x == LOCATION_NULL)
         return;
@@ -1069,7 +1103,7 @@ static void DrawMapPeepPixel(Peep* peep, const uint8_t flashColour, rct_drawpixe
         }
     }
 
-    gfx_fill_rect(dpi, { leftTop, rightBottom }, colour);
+    _mapOverlayPixels.push_back({ leftTop, rightBottom, colour });
 }
 
 static uint8_t MapGetGuestFlashColour()
@@ -1096,21 +1130,45 @@ static uint8_t MapGetStaffFlashColour()
     return colour;
 }
 
+/**
+ * Collects the overlay every few updates or right away when the page or the flashing changed, painting the window
+ * then only has to fill the collected pixels.
+ */
+static void window_map_update_overlay(rct_window* w)
+{
+    bool isStale = _mapOverlayTab != w->selected_tab || _mapOverlayFlashingFlags != gWindowMapFlashingFlags;
+    if (!isStale && ++_mapOverlayAge < MapOverlayRebuildInterval)
+        return;
+
+    _mapOverlayAge = 0;
+    _mapOverlayTab = w->selected_tab;
+    _mapOverlayFlashingFlags = gWindowMapFlashingFlags;
+    _mapOverlayPixels.clear();
+    if (w->selected_tab == PAGE_PEEPS)
+    {
+        window_map_build_peep_overlay();
+    }
+    else
+    {
+        window_map_build_train_overlay();
+    }
+}
+
 /**
  *
  *  rct2: 0x0068DADA
  */
-static void window_map_paint_peep_overlay(rct_drawpixelinfo* dpi)
+static void window_map_build_peep_overlay()
 {
     auto flashColour = MapGetGuestFlashColour();
     for (auto guest : EntityList<Guest>())
     {
-        DrawMapPeepPixel(guest, flashColour, dpi);
+        AddMapPeepPixel(guest, flashColour);
     }
     flashColour = MapGetStaffFlashColour();
     for (auto staff : EntityList<Staff>())
     {
-        DrawMapPeepPixel(staff, flashColour, dpi);
+        AddMapPeepPixel(staff, flashColour);
     }
 }
 
@@ -1118,7 +1176,7 @@ static void window_map_paint_peep_overlay(rct_drawpixelinfo* dpi)
  *
  *  rct2: 0x0068DBC1
  */
-static void window_map_paint_train_overlay(rct_drawpixelinfo* dpi)
+static void window_map_build_train_overlay()
 {
     for (auto train : TrainManager::View())
     {
@@ -1129,7 +1187,7 @@ static void window_map_paint_train_overlay(rct_drawpixelinfo* dpi)
 
             MapCoordsXY c = window_map_transform_to_map_coords({ vehicle->x, vehicle->y });
 
-            gfx_fill_rect(dpi, { { c.x, c.y }, { c.x, c.y } }, PALETTE_INDEX_171);
+            _mapOverlayPixels.push_back({ { c.x, c.y }, { c.x, c.y }, PALETTE_INDEX_171 });
         }
     }
 }
@@ -1541,14 +1599,35 @@ static uint16_t map_window_get_pixel_colour_ride(const CoordsXY& c)
     return colourB;
 }
 
-static void map_window_set_pixels(rct_window* w)
+static uint8_t* map_window_get_line_pixels(int32_t line, int32_t index)
 {
+    int32_t pos = (line * (MAP_WINDOW_MAP_SIZE - 1)) + MAXIMUM_MAP_SIZE_TECHNICAL - 1;
+    auto destinationPosition = ScreenCoordsXY{ (pos % MAP_WINDOW_MAP_SIZE) + index, (pos / MAP_WINDOW_MAP_SIZE) + index };
+    return _mapImageData.data() + (destinationPosition.y * MAP_WINDOW_MAP_SIZE) + destinationPosition.x;
+}
+
+static void map_window_set_tile_pixels(rct_window* w, const CoordsXY& c, uint8_t* destination)
+{
+    if (map_is_edge(c))
+        return;
+
     uint16_t colour = 0;
-    int32_t x = 0, y = 0, dx = 0, dy = 0;
+    switch (w->selected_tab)
+    {
+        case PAGE_PEEPS:
+            colour = map_window_get_pixel_colour_peep(c);
+            break;
+        case PAGE_RIDES:
+            colour = map_window_get_pixel_colour_ride(c);
+            break;
+    }
+    destination[0] = (colour >> 8) & 0xFF;
+    destination[1] = colour;
+}
 
-    int32_t pos = (_currentLine * (MAP_WINDOW_MAP_SIZE - 1)) + MAXIMUM_MAP_SIZE_TECHNICAL - 1;
-    auto destinationPosition = ScreenCoordsXY{ pos % MAP_WINDOW_MAP_SIZE, pos / MAP_WINDOW_MAP_SIZE };
-    auto destination = _mapImageData.data() + (destinationPosition.y * MAP_WINDOW_MAP_SIZE) + destinationPosition.x;
+static void map_window_set_pixels(rct_window* w)
+{
+    int32_t x = 0, y = 0, dx = 0, dy = 0;
     switch (get_current_rotation())
     {
         case 0:
@@ -1579,32 +1658,47 @@ static void map_window_set_pixels(rct_window* w)
 
     for (int32_t i = 0; i < MAXIMUM_MAP_SIZE_TECHNICAL; i++)
     {
-        if (!map_is_edge({ x, y }))
-        {
-            switch (w->selected_tab)
-            {
-                case PAGE_PEEPS:
-                    colour = map_window_get_pixel_colour_peep({ x, y });
-                    break;
-                case PAGE_RIDES:
-                    colour = map_window_get_pixel_colour_ride({ x, y });
-                    break;
-            }
-            destination[0] = (colour >> 8) & 0xFF;
-            destination[1] = colour;
-        }
+        map_window_set_tile_pixels(w, { x, y }, map_window_get_line_pixels(_currentLine, i));
         x += dx;
         y += dy;
-
-        destinationPosition.x++;
-        destinationPosition.y++;
-        destination = _mapImageData.data() + (destinationPosition.y * MAP_WINDOW_MAP_SIZE) + destinationPosition.x;
     }
     _currentLine++;
     if (_currentLine >= MAXIMUM_MAP_SIZE_TECHNICAL)
         _currentLine = 0;
 }
 
+/**
+ * Redraws the tiles invalidated since the last update, the line and index are the inverse of map_window_set_pixels.
+ */
+static void map_window_set_changed_tile_pixels(rct_window* w)
+{
+    constexpr int32_t lastTile = MAXIMUM_MAP_SIZE_TECHNICAL - 1;
+    for (const auto& tile : map_take_changed_tiles())
+    {
+        int32_t line = 0, index = 0;
+        switch (get_current_rotation())
+        {
+            case 0:
+                line = tile.x;
+                index = tile.y;
+                break;
+            case 1:
+                line = tile.y;
+                index = lastTile - tile.x;
+                break;
+            case 2:
+                line = lastTile - tile.x;
+                index = lastTile - tile.y;
+                break;
+            case 3:
+                line = lastTile - tile.y;
+                index = tile.x;
+                break;
+        }
+        map_window_set_tile_pixels(w, tile.ToCoordsXY(), map_window_get_line_pixels(line, index));
+    }
+}
+
 static CoordsXY map_window_screen_to_map(ScreenCoordsXY screenCoords)
 {
     screenCoords.x = ((screenCoords.x + 8) - MAXIMUM_MAP_SIZE_TECHNICAL) / 2;
@@ -0,0 +1,169 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <cstdio>
+#include <openrct2-ui/interface/Widget.h>
+#include <openrct2-ui/windows/Window.h>
+#include <openrct2/core/Profiling.h>
+#include <openrct2/drawing/Drawing.h>
+#include <openrct2/localisation/Localisation.h>
+
+using namespace OpenRCT2;
+
+// clang-format off
+enum WINDOW_PROFILER_WIDGET_IDX
+{
+    WIDX_BACKGROUND,
+    WIDX_TITLE,
+    WIDX_CLOSE,
+    WIDX_RECORD_ZONES,
+};
+
+static constexpr const rct_string_id WINDOW_TITLE = STR_PROFILER_TITLE;
+static constexpr const int32_t WW = 400;
+static constexpr const int32_t WH = 64;
+static constexpr const int32_t ROW_HEIGHT = 11;
+static constexpr const int32_t TABLE_TOP = 36;
+
+// Rolling window the percentiles are calculated over.
+static constexpr const std::chrono::milliseconds STATISTICS_WINDOW = std::chrono::seconds(5);
+
+// Refresh the statistics about twice a second, sorting all zones every frame would show up in the profile itself.
+static constexpr const int32_t REFRESH_FRAMES = 20;
+
+static rct_widget window_profiler_widgets[] = {
+    WINDOW_SHIM(WINDOW_TITLE, WW, WH),
+    MakeWidget({5, 18}, {WW - 10, 12}, WindowWidgetType::Checkbox, WindowColour::Secondary, STR_PROFILER_RECORD_ZONES),
+    { WIDGETS_END },
+};
+
+static void window_profiler_mouseup(rct_window* w, rct_widgetindex widgetIndex);
+static void window_profiler_update(rct_window* w);
+static void window_profiler_invalidate(rct_window* w);
+static void window_profiler_paint(rct_window* w, rct_drawpixelinfo* dpi);
+
+static rct_window_event_list window_profiler_events([](auto& events)
+{
+    events.mouse_up = &window_profiler_mouseup;
+    events.update = &window_profiler_update;
+    events.invalidate = &window_profiler_invalidate;
+    events.paint = &window_profiler_paint;
+});
+// clang-format on
+
+static std::vector<Profiling::ZoneStatistics> _zoneStatistics;
+
+static void window_profiler_refresh(rct_window* w)
+{
+    _zoneStatistics = Profiling::GetZoneStatistics(STATISTICS_WINDOW);
+
+    // Most expensive zones first, those are the ones a hitch is looked for in.
+    std::sort(_zoneStatistics.begin(), _zoneStatistics.end(), [](const auto& a, const auto& b) { return a.P99Ms > b.P99Ms; });
+
+    auto newHeight = std::max<int32_t>(WH, TABLE_TOP + ROW_HEIGHT * static_cast<int32_t>(_zoneStatistics.size() + 1) + 4);
+    if (w->height != newHeight)
+    {
+        // Invalidate the old size before growing or shrinking.
+        w->Invalidate();
+        w->height = newHeight;
+        w->min_height = newHeight;
+        w->max_height = newHeight;
+    }
+    w->Invalidate();
+}
+
+rct_window* window_profiler_open()
+{
+    auto* window = window_bring_to_front_by_class(WC_PROFILER);
+    if (window != nullptr)
+        return window;
+
+    window = WindowCreate(ScreenCoordsXY(32, 32), WW, WH, &window_profiler_events, WC_PROFILER, 0);
+    window->widgets = window_profiler_widgets;
+    window->enabled_widgets = (1ULL << WIDX_CLOSE) | (1ULL << WIDX_RECORD_ZONES);
+    WindowInitScrollWidgets(window);
+    window_profiler_refresh(window);
+    return window;
+}
+
+static void window_profiler_mouseup(rct_window* w, rct_widgetindex widgetIndex)
+{
+    switch (widgetIndex)
+    {
+        case WIDX_CLOSE:
+            window_close(w);
+            break;
+        case WIDX_RECORD_ZONES:
+            Profiling::SetEnabled(!Profiling::IsEnabled());
+            w->Invalidate();
+            break;
+    }
+}
+
+static void window_profiler_update(rct_window* w)
+{
+    w->frame_no++;
+    if (w->frame_no % REFRESH_FRAMES == 0)
+    {
+        window_profiler_refresh(w);
+    }
+}
+
+static void window_profiler_invalidate(rct_window* w)
+{
+    w->widgets[WIDX_BACKGROUND].bottom = w->height - 1;
+    WidgetSetCheckboxValue(w, WIDX_RECORD_ZONES, Profiling::IsEnabled());
+}
+
+static void window_profiler_draw_value(
+    rct_drawpixelinfo* dpi, const ScreenCoordsXY& screenCoords, const char* text, colour_t colour)
+{
+    auto ft = Formatter();
+    ft.Add<const char*>(text);
+    DrawTextBasic(dpi, screenCoords, STR_STRING, ft, { colour, TextAlignment::RIGHT });
+}
+
+static void window_profiler_paint(rct_window* w, rct_drawpixelinfo* dpi)
+{
+    WindowDrawWidgets(w, dpi);
+
+    static constexpr const int32_t ColumnRight[] = { 220, 265, 310, 355, 395 };
+    static constexpr const rct_string_id ColumnHeaders[] = {
+        STR_PROFILER_CALLS, STR_PROFILER_P50, STR_PROFILER_P95, STR_PROFILER_P99, STR_PROFILER_MAX,
+    };
+
+    auto screenCoords = w->windowPos + ScreenCoordsXY{ 5, TABLE_TOP };
+    DrawTextBasic(dpi, screenCoords, STR_PROFILER_ZONE, {}, { w->colours[1] });
+    for (size_t i = 0; i < std::size(ColumnHeaders); i++)
+    {
+        DrawTextBasic(
+            dpi, { w->windowPos.x + ColumnRight[i], screenCoords.y }, ColumnHeaders[i], {},
+            { w->colours[1], TextAlignment::RIGHT });
+    }
+
+    char buffer[32];
+    for (const auto& zone : _zoneStatistics)
+    {
+        screenCoords.y += ROW_HEIGHT;
+
+        auto ft = Formatter();
+        ft.Add<const char*>(zone.Name.c_str());
+        DrawTextEllipsised(dpi, screenCoords, ColumnRight[0] - 50, STR_STRING, ft, { w->colours[1] });
+
+        const double values[] = { zone.P50Ms, zone.P95Ms, zone.P99Ms, zone.MaxMs };
+        snprintf(buffer, sizeof(buffer), "%zu", zone.Count);
+        window_profiler_draw_value(dpi, { w->windowPos.x + ColumnRight[0], screenCoords.y }, buffer, w->colours[1]);
+        for (size_t i = 0; i < std::size(values); i++)
+        {
+            snprintf(buffer, sizeof(buffer), "%.3f", values[i]);
+            window_profiler_draw_value(dpi, { w->windowPos.x + ColumnRight[i + 1], screenCoords.y }, buffer, w->colours[1]);
+        }
+    }
+}
@@ -26,7 +26,6 @@
 #    include <openrct2/platform/platform.h>
 #    include <openrct2/sprites.h>
 #    include <openrct2/util/Util.h>
-#    include <tuple>
 
 #    define WWIDTH_MIN 500
 #    define WHEIGHT_MIN 300
@@ -36,7 +35,8 @@
 
 static char _playerName[32 + 1];
 static ServerList _serverList;
-static std::future<std::tuple<std::vector<ServerListEntry>, rct_string_id>> _fetchFuture;
+static std::future<std::vector<ServerListEntry>> _fetchLocalFuture;
+static std::future<std::vector<ServerListEntry>> _fetchOnlineFuture;
 static uint32_t _numPlayersOnline = 0;
 static rct_string_id _statusText = STR_SERVER_LIST_CONNECTING;
 
@@ -158,7 +158,8 @@ rct_window* window_server_list_open()
 static void window_server_list_close(rct_window* w)
 {
     _serverList = {};
-    _fetchFuture = {};
+    _fetchLocalFuture = {};
+    _fetchOnlineFuture = {};
 }
 
 static void window_server_list_mouseup(rct_window* w, rct_widgetindex widgetIndex)
@@ -551,7 +552,7 @@ static void join_server(std::string address)
 
 static void server_list_fetch_servers_begin()
 {
-    if (_fetchFuture.valid())
+    if (_fetchLocalFuture.valid() || _fetchOnlineFuture.valid())
     {
         // A fetch is already in progress
         return;
@@ -559,72 +560,61 @@ static void server_list_fetch_servers_begin()
 
     _serverList.Clear();
     _serverList.ReadAndAddFavourites();
+    _serverList.ReadAndAddCachedServers();
+    _numPlayersOnline = _serverList.GetTotalPlayerCount();
     _statusText = STR_SERVER_LIST_CONNECTING;
 
-    _fetchFuture = std::async(std::launch::async, [] {
-        // Spin off background fetches
-        auto lanF = _serverList.FetchLocalServerListAsync();
-        auto wanF = _serverList.FetchOnlineServerListAsync();
+    // Both fetches are merged as soon as they are done, the LAN broadcast always waits for late replies
+    _fetchLocalFuture = _serverList.FetchLocalServerListAsync();
+    _fetchOnlineFuture = _serverList.FetchOnlineServerListAsync();
+    if (!_fetchOnlineFuture.valid())
+    {
+        _statusText = STR_SERVER_LIST_NO_CONNECTION;
+    }
+}
+
+static bool server_list_is_future_ready(const std::future<std::vector<ServerListEntry>>& future)
+{
+    return future.valid() && future.wait_for(std::chrono::seconds::zero()) == std::future_status::ready;
+}
 
-        // Merge or deal with errors
-        std::vector<ServerListEntry> allEntries;
+static void server_list_fetch_servers_check(rct_window* w)
+{
+    if (server_list_is_future_ready(_fetchLocalFuture))
+    {
         try
         {
-            auto entries = lanF.get();
-            allEntries.insert(allEntries.end(), entries.begin(), entries.end());
+            _serverList.AddRange(_fetchLocalFuture.get());
         }
-        catch (...)
+        catch (const std::exception& e)
         {
+            log_warning("Unable to query LAN servers: %s", e.what());
         }
+        _fetchLocalFuture = {};
+        _numPlayersOnline = _serverList.GetTotalPlayerCount();
+        w->Invalidate();
+    }
 
-        auto status = STR_NONE;
+    if (server_list_is_future_ready(_fetchOnlineFuture))
+    {
         try
         {
-            auto entries = wanF.get();
-            allEntries.insert(allEntries.end(), entries.begin(), entries.end());
+            _serverList.SetOnlineServers(_fetchOnlineFuture.get());
+            _serverList.WriteCachedServers();
+            _statusText = STR_X_PLAYERS_ONLINE;
         }
         catch (const MasterServerException& e)
         {
-            status = e.StatusText;
+            _statusText = e.StatusText;
         }
-        catch (...)
+        catch (const std::exception& e)
         {
-            status = STR_SERVER_LIST_NO_CONNECTION;
-        }
-        return std::make_tuple(allEntries, status);
-    });
-}
-
-static void server_list_fetch_servers_check(rct_window* w)
-{
-    if (_fetchFuture.valid())
-    {
-        auto status = _fetchFuture.wait_for(std::chrono::seconds::zero());
-        if (status == std::future_status::ready)
-        {
-            try
-            {
-                auto [entries, statusText] = _fetchFuture.get();
-                _serverList.AddRange(entries);
-                _numPlayersOnline = _serverList.GetTotalPlayerCount();
-                _statusText = STR_X_PLAYERS_ONLINE;
-                if (statusText != STR_NONE)
-                {
-                    _statusText = statusText;
-                }
-            }
-            catch (const MasterServerException& e)
-            {
-                _statusText = e.StatusText;
-            }
-            catch (const std::exception& e)
-            {
-                _statusText = STR_SERVER_LIST_NO_CONNECTION;
-                log_warning("Unable to connect to master server: %s", e.what());
-            }
-            _fetchFuture = {};
-            w->Invalidate();
+            _statusText = STR_SERVER_LIST_NO_CONNECTION;
+            log_warning("Unable to connect to master server: %s", e.what());
         }
+        _fetchOnlineFuture = {};
+        _numPlayersOnline = _serverList.GetTotalPlayerCount();
+        w->Invalidate();
     }
 }
 
@@ -2301,6 +2301,15 @@ static void window_tile_inspector_scrollpaint(rct_window* w, rct_drawpixelinfo*
     {
         if (tileElement == nullptr)
             break;
+
+        // Only rows inside the visible part of the list are drawn, tiles can hold hundreds of elements
+        if (screenCoords.y + SCROLLABLE_ROW_HEIGHT <= dpi->y || screenCoords.y >= dpi->y + dpi->height)
+        {
+            screenCoords.y -= SCROLLABLE_ROW_HEIGHT;
+            i++;
+            continue;
+        }
+
         const bool selectedRow = i == windowTileInspectorSelectedIndex;
         const bool hoveredRow = i == windowTileInspectorHighlightedIndex;
         int32_t type = tileElement->GetType();
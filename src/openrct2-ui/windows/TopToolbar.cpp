@@ -39,6 +39,7 @@
 #include <openrct2/actions/PauseToggleAction.h>
 #include <openrct2/actions/SetCheatAction.h>
 #include <openrct2/actions/SmallSceneryPlaceAction.h>
+#include <openrct2/actions/SmallSceneryScatterAction.h>
 #include <openrct2/actions/SmallScenerySetColourAction.h>
 #include <openrct2/actions/SurfaceSetStyleAction.h>
 #include <openrct2/actions/WallPlaceAction.h>
@@ -150,6 +151,7 @@ enum TOP_TOOLBAR_VIEW_MENU_DDIDX {
 enum TOP_TOOLBAR_DEBUG_DDIDX {
     DDIDX_CONSOLE = 0,
     DDIDX_DEBUG_PAINT = 1,
+    DDIDX_PROFILER = 2,
 
     TOP_TOOLBAR_DEBUG_COUNT
 };
@@ -1723,13 +1725,19 @@ static void window_top_toolbar_scenery_tool_down(const ScreenCoordsXY& windowPos
             if (gridPos.isNull())
                 return;
 
-            int32_t quantity = 1;
             bool isCluster = gWindowSceneryScatterEnabled
                 && (network_get_mode() != NETWORK_MODE_CLIENT
                     || network_can_perform_command(network_get_current_player_group_index(), -2));
 
+            uint8_t zAttemptRange = 1;
+            if (gSceneryPlaceZ != 0 && gSceneryShiftPressed)
+            {
+                zAttemptRange = 20;
+            }
+
             if (isCluster)
             {
+                uint16_t quantity = gWindowSceneryScatterSize;
                 switch (gWindowSceneryScatterDensity)
                 {
                     case ScatterToolDensity::LowDensity:
@@ -1744,96 +1752,59 @@ static void window_top_toolbar_scenery_tool_down(const ScreenCoordsXY& windowPos
                         quantity = gWindowSceneryScatterSize * 3;
                         break;
                 }
-            }
 
-            bool forceError = true;
-            for (int32_t q = 0; q < quantity; q++)
-            {
-                int32_t zCoordinate = gSceneryPlaceZ;
-                auto* sceneryEntry = get_small_scenery_entry(selectedScenery);
-
-                int16_t cur_grid_x = gridPos.x;
-                int16_t cur_grid_y = gridPos.y;
-
-                if (isCluster)
-                {
-                    if (!scenery_small_entry_has_flag(sceneryEntry, SMALL_SCENERY_FLAG_FULL_TILE))
+                // The whole cluster is one action, only the seed of its placements has to be sent
+                auto sceneryScatterAction = SmallSceneryScatterAction(
+                    { gridPos, gSceneryPlaceZ, gSceneryPlaceRotation }, quadrant, selectedScenery,
+                    gWindowSceneryPrimaryColour, gWindowScenerySecondaryColour, gWindowSceneryScatterSize, quantity,
+                    util_rand(), zAttemptRange);
+                sceneryScatterAction.SetCallback([=](const GameAction* ga, const GameActions::Result* result) {
+                    if (result->Error == GameActions::Status::Ok)
                     {
-                        quadrant = util_rand() & 3;
+                        OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::PlaceItem, result->Position);
                     }
+                });
+                GameActions::Execute(&sceneryScatterAction);
 
-                    int16_t grid_x_offset = (util_rand() % gWindowSceneryScatterSize) - (gWindowSceneryScatterSize / 2);
-                    int16_t grid_y_offset = (util_rand() % gWindowSceneryScatterSize) - (gWindowSceneryScatterSize / 2);
-                    if (gWindowSceneryScatterSize % 2 == 0)
-                    {
-                        grid_x_offset += 1;
-                        grid_y_offset += 1;
-                    }
-                    cur_grid_x += grid_x_offset * COORDS_XY_STEP;
-                    cur_grid_y += grid_y_offset * COORDS_XY_STEP;
-
-                    if (!scenery_small_entry_has_flag(sceneryEntry, SMALL_SCENERY_FLAG_ROTATABLE))
-                    {
-                        gSceneryPlaceRotation = (gSceneryPlaceRotation + 1) & 3;
-                    }
+                // Non-rotatable scenery turns for every placement of the cluster
+                auto* sceneryEntry = get_small_scenery_entry(selectedScenery);
+                if (sceneryEntry != nullptr && !scenery_small_entry_has_flag(sceneryEntry, SMALL_SCENERY_FLAG_ROTATABLE))
+                {
+                    gSceneryPlaceRotation = (gSceneryPlaceRotation + quantity) & 3;
                 }
+                break;
+            }
 
-                uint8_t zAttemptRange = 1;
-                if (gSceneryPlaceZ != 0 && gSceneryShiftPressed)
+            int32_t zCoordinate = gSceneryPlaceZ;
+            // Try find a valid z coordinate
+            for (; zAttemptRange != 0; zAttemptRange--)
+            {
+                auto smallSceneryPlaceAction = SmallSceneryPlaceAction(
+                    { gridPos, gSceneryPlaceZ, gSceneryPlaceRotation }, quadrant, selectedScenery,
+                    gWindowSceneryPrimaryColour, gWindowScenerySecondaryColour);
+                auto res = GameActions::Query(&smallSceneryPlaceAction);
+                if (res->Error == GameActions::Status::Ok || res->Error == GameActions::Status::InsufficientFunds)
                 {
-                    zAttemptRange = 20;
+                    break;
                 }
-
-                auto success = GameActions::Status::Unknown;
-                // Try find a valid z coordinate
-                for (; zAttemptRange != 0; zAttemptRange--)
+                if (zAttemptRange != 1)
                 {
-                    auto smallSceneryPlaceAction = SmallSceneryPlaceAction(
-                        { cur_grid_x, cur_grid_y, gSceneryPlaceZ, gSceneryPlaceRotation }, quadrant, selectedScenery,
-                        gWindowSceneryPrimaryColour, gWindowScenerySecondaryColour);
-                    auto res = GameActions::Query(&smallSceneryPlaceAction);
-                    success = res->Error;
-                    if (res->Error == GameActions::Status::Ok)
-                    {
-                        break;
-                    }
-
-                    if (res->Error == GameActions::Status::InsufficientFunds)
-                    {
-                        break;
-                    }
-                    if (zAttemptRange != 1)
-                    {
-                        gSceneryPlaceZ += 8;
-                    }
+                    gSceneryPlaceZ += 8;
                 }
+            }
 
-                // Actually place
-                if (success == GameActions::Status::Ok || ((q + 1 == quantity) && forceError))
+            // Actually place, showing the error if it still fails
+            auto smallSceneryPlaceAction = SmallSceneryPlaceAction(
+                { gridPos, gSceneryPlaceZ, gSceneryPlaceRotation }, quadrant, selectedScenery, gWindowSceneryPrimaryColour,
+                gWindowScenerySecondaryColour);
+            smallSceneryPlaceAction.SetCallback([=](const GameAction* ga, const GameActions::Result* result) {
+                if (result->Error == GameActions::Status::Ok)
                 {
-                    auto smallSceneryPlaceAction = SmallSceneryPlaceAction(
-                        { cur_grid_x, cur_grid_y, gSceneryPlaceZ, gSceneryPlaceRotation }, quadrant, selectedScenery,
-                        gWindowSceneryPrimaryColour, gWindowScenerySecondaryColour);
-
-                    smallSceneryPlaceAction.SetCallback([=](const GameAction* ga, const GameActions::Result* result) {
-                        if (result->Error == GameActions::Status::Ok)
-                        {
-                            OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::PlaceItem, result->Position);
-                        }
-                    });
-                    auto res = GameActions::Execute(&smallSceneryPlaceAction);
-                    if (res->Error == GameActions::Status::Ok)
-                    {
-                        forceError = false;
-                    }
-
-                    if (res->Error == GameActions::Status::InsufficientFunds)
-                    {
-                        break;
-                    }
+                    OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::PlaceItem, result->Position);
                 }
-                gSceneryPlaceZ = zCoordinate;
-            }
+            });
+            GameActions::Execute(&smallSceneryPlaceAction);
+            gSceneryPlaceZ = zCoordinate;
             break;
         }
         case SCENERY_TYPE_PATH_ITEM:
@@ -3523,12 +3494,15 @@ static void top_toolbar_init_debug_menu(rct_window* w, rct_widget* widget)
     gDropdownItemsArgs[DDIDX_CONSOLE] = STR_DEBUG_DROPDOWN_CONSOLE;
     gDropdownItemsFormat[DDIDX_DEBUG_PAINT] = STR_TOGGLE_OPTION;
     gDropdownItemsArgs[DDIDX_DEBUG_PAINT] = STR_DEBUG_DROPDOWN_DEBUG_PAINT;
+    gDropdownItemsFormat[DDIDX_PROFILER] = STR_TOGGLE_OPTION;
+    gDropdownItemsArgs[DDIDX_PROFILER] = STR_DEBUG_DROPDOWN_PROFILER;
 
     WindowDropdownShowText(
         { w->windowPos.x + widget->left, w->windowPos.y + widget->top }, widget->height() + 1, w->colours[0] | 0x80,
         Dropdown::Flag::StayOpen, TOP_TOOLBAR_DEBUG_COUNT);
 
     Dropdown::SetChecked(DDIDX_DEBUG_PAINT, window_find_by_class(WC_DEBUG_PAINT) != nullptr);
+    Dropdown::SetChecked(DDIDX_PROFILER, window_find_by_class(WC_PROFILER) != nullptr);
 }
 
 static void top_toolbar_init_network_menu(rct_window* w, rct_widget* widget)
@@ -3568,6 +3542,16 @@ static void top_toolbar_debug_menu_dropdown(int16_t dropdownIndex)
                     window_close_by_class(WC_DEBUG_PAINT);
                 }
                 break;
+            case DDIDX_PROFILER:
+                if (window_find_by_class(WC_PROFILER) == nullptr)
+                {
+                    context_open_window(WC_PROFILER);
+                }
+                else
+                {
+                    window_close_by_class(WC_PROFILER);
+                }
+                break;
         }
     }
 }
@@ -15,6 +15,7 @@
 #include <openrct2/OpenRCT2.h>
 #include <openrct2/audio/audio.h>
 #include <openrct2/config/Config.h>
+#include <openrct2/core/File.h>
 #include <openrct2/core/String.hpp>
 #include <openrct2/drawing/IDrawingEngine.h>
 #include <openrct2/localisation/Localisation.h>
@@ -23,6 +24,8 @@
 #include <openrct2/ride/TrackDesignRepository.h>
 #include <openrct2/sprites.h>
 #include <openrct2/windows/Intent.h>
+#include <deque>
+#include <memory>
 #include <vector>
 
 static constexpr const rct_string_id WINDOW_TITLE = STR_SELECT_DESIGN;
@@ -94,11 +97,30 @@ static std::vector<track_design_file_ref> _trackDesigns;
 static utf8 _filterString[USER_STRING_MAX_LENGTH];
 static std::vector<uint16_t> _filteredTrackIds;
 static uint16_t _loadedTrackDesignIndex;
-static std::unique_ptr<TrackDesign> _loadedTrackDesign;
-static std::vector<uint8_t> _trackDesignPreviewPixels;
+
+struct TrackDesignPreview
+{
+    std::string Path;
+    uint64_t LastModified = 0;
+    // Null when the design could not be loaded, so it is not tried again on every frame.
+    std::unique_ptr<TrackDesign> Design;
+    std::vector<uint8_t> Pixels;
+};
+
+// Previews of the designs shown recently, most recently used first. Drawing a preview loads the design and places it
+// on a temporary map, which is far too slow to repeat every time the mouse moves over a design in a long list.
+static std::deque<std::shared_ptr<TrackDesignPreview>> _previewCache;
+static constexpr size_t MaxCachedPreviews = 16;
+// How many designs above and below the selected one get their preview drawn ahead of time.
+static constexpr int32_t PrerenderDistance = 2;
+
+static std::shared_ptr<TrackDesignPreview> _loadedPreview;
+static TrackDesign* _loadedTrackDesign;
 
 static void track_list_load_designs(RideSelection item);
 static bool track_list_load_design_for_preview(utf8* path);
+static void track_list_prerender_previews(rct_window* w);
+static void track_list_clear_previews();
 
 /**
  *
@@ -146,9 +168,7 @@ rct_window* window_track_list_open(RideSelection item)
     window_push_others_right(w);
     _currentTrackPieceDirection = 2;
 
-    _trackDesignPreviewPixels.resize(4 * TRACK_PREVIEW_IMAGE_SIZE);
-
-    _loadedTrackDesign = nullptr;
+    track_list_clear_previews();
     _loadedTrackDesignIndex = TRACK_DESIGN_INDEX_UNLOADED;
 
     return w;
@@ -195,9 +215,7 @@ static void window_track_list_filter_list()
 static void window_track_list_close(rct_window* w)
 {
     // Dispose track design and preview
-    _loadedTrackDesign = nullptr;
-    _trackDesignPreviewPixels.clear();
-    _trackDesignPreviewPixels.shrink_to_fit();
+    track_list_clear_previews();
 
     // Dispose track list
     for (auto& trackDesign : _trackDesigns)
@@ -307,6 +325,8 @@ static void window_track_list_mouseup(rct_window* w, rct_widgetindex widgetIndex
             break;
         case WIDX_TOGGLE_SCENERY:
             gTrackDesignSceneryToggle = !gTrackDesignSceneryToggle;
+            // The previews show the scenery or not, so they all need drawing again
+            track_list_clear_previews();
             _loadedTrackDesignIndex = TRACK_DESIGN_INDEX_UNLOADED;
             w->Invalidate();
             break;
@@ -423,6 +443,8 @@ static void window_track_list_update(rct_window* w)
         w->Invalidate();
         w->track_list.reload_track_designs = false;
     }
+
+    track_list_prerender_previews(w);
 }
 
 /**
@@ -552,7 +574,7 @@ static void window_track_list_paint(rct_window* w, rct_drawpixelinfo* dpi)
     screenPos = w->windowPos + ScreenCoordsXY{ widget->midX(), widget->midY() };
 
     rct_g1_element g1temp = {};
-    g1temp.offset = _trackDesignPreviewPixels.data() + (_currentTrackPieceDirection * TRACK_PREVIEW_IMAGE_SIZE);
+    g1temp.offset = _loadedPreview->Pixels.data() + (_currentTrackPieceDirection * TRACK_PREVIEW_IMAGE_SIZE);
     g1temp.width = 370;
     g1temp.height = 217;
     g1temp.flags = G1_FLAG_BMP;
@@ -810,13 +832,96 @@ static void track_list_load_designs(RideSelection item)
     window_track_list_filter_list();
 }
 
+static void track_list_clear_previews()
+{
+    _loadedPreview = nullptr;
+    _loadedTrackDesign = nullptr;
+    _previewCache.clear();
+}
+
+/**
+ * Gets the preview of a design from the cache, or loads the design and draws its preview. A cached preview is only
+ * used while the file has not been modified since it was drawn.
+ */
+static std::shared_ptr<TrackDesignPreview> track_list_get_preview(const utf8* path)
+{
+    auto lastModified = File::GetLastModified(path);
+    auto it = std::find_if(_previewCache.begin(), _previewCache.end(), [path](const auto& preview) {
+        return preview->Path == path;
+    });
+    if (it != _previewCache.end())
+    {
+        auto preview = *it;
+        _previewCache.erase(it);
+        if (preview->LastModified == lastModified)
+        {
+            _previewCache.push_front(preview);
+            return preview;
+        }
+    }
+
+    auto preview = std::make_shared<TrackDesignPreview>();
+    preview->Path = path;
+    preview->LastModified = lastModified;
+    preview->Design = track_design_open(path);
+    if (preview->Design != nullptr)
+    {
+        preview->Pixels.resize(4 * TRACK_PREVIEW_IMAGE_SIZE);
+        track_design_draw_preview(preview->Design.get(), preview->Pixels.data());
+    }
+
+    _previewCache.push_front(preview);
+    if (_previewCache.size() > MaxCachedPreviews)
+    {
+        _previewCache.pop_back();
+    }
+    return preview;
+}
+
+static bool track_list_is_preview_cached(const utf8* path)
+{
+    return std::any_of(
+        _previewCache.begin(), _previewCache.end(), [path](const auto& preview) { return preview->Path == path; });
+}
+
 static bool track_list_load_design_for_preview(utf8* path)
 {
-    _loadedTrackDesign = track_design_open(path);
-    if (_loadedTrackDesign != nullptr)
+    _loadedPreview = track_list_get_preview(path);
+    _loadedTrackDesign = _loadedPreview->Design.get();
+    return _loadedTrackDesign != nullptr;
+}
+
+/**
+ * Draws the preview of one of the designs around the selected one, so they show straight away when the selection
+ * moves. Only one is drawn per update to keep the window responsive.
+ */
+static void track_list_prerender_previews(rct_window* w)
+{
+    if (_loadedTrackDesignIndex == TRACK_DESIGN_INDEX_UNLOADED)
+        return;
+
+    int32_t selectedIndex = w->selected_list_item;
+    if (!(gScreenFlags & SCREEN_FLAGS_TRACK_MANAGER))
+    {
+        // Skip the "Build a custom design" item
+        selectedIndex--;
+    }
+    if (selectedIndex < 0)
+        return;
+
+    for (int32_t distance = 1; distance <= PrerenderDistance; distance++)
     {
-        track_design_draw_preview(_loadedTrackDesign.get(), _trackDesignPreviewPixels.data());
-        return true;
+        for (int32_t listIndex : { selectedIndex + distance, selectedIndex - distance })
+        {
+            if (listIndex < 0 || static_cast<size_t>(listIndex) >= _filteredTrackIds.size())
+                continue;
+
+            const utf8* path = _trackDesigns[_filteredTrackIds[listIndex]].path;
+            if (!track_list_is_preview_cached(path))
+            {
+                track_list_get_preview(path);
+                return;
+            }
+        }
     }
-    return false;
 }
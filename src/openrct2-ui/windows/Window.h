@@ -17,6 +17,7 @@
 
 using loadsave_callback = void (*)(int32_t result, const utf8* path);
 using scenarioselect_callback = void (*)(const utf8* path);
+struct Guest;
 struct Peep;
 struct TileElement;
 struct Vehicle;
@@ -92,10 +93,13 @@ rct_window* window_ride_refurbish_prompt_open(Ride* ride);
 rct_window* window_sign_open(rct_windownumber number);
 rct_window* window_sign_small_open(rct_windownumber number);
 rct_window* window_player_open(uint8_t id);
+rct_window* window_profiler_open();
 rct_window* window_new_campaign_open(int16_t campaignType);
 
 rct_window* window_install_track_open(const utf8* path);
 void window_guest_list_refresh_list();
+void window_guest_list_update_guest(Guest* guest);
+void window_guest_list_remove_guest(Guest* guest);
 rct_window* window_guest_list_open();
 rct_window* window_guest_list_open_with_filter(GuestListFilterType type, int32_t index);
 rct_window* window_staff_fire_prompt_open(Peep* peep);
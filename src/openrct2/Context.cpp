@@ -19,6 +19,7 @@
 #include "GameStateSnapshots.h"
 #include "Input.h"
 #include "Intro.h"
+#include "MemoryReport.h"
 #include "OpenRCT2.h"
 #include "ParkImporter.h"
 #include "PlatformEnvironment.h"
@@ -36,7 +37,10 @@
 #include "core/Http.h"
 #include "core/MemoryStream.h"
 #include "core/Path.hpp"
+#include "core/Profiling.h"
+#include "core/StartupTimings.h"
 #include "core/String.hpp"
+#include "core/TaskScheduler.h"
 #include "drawing/IDrawingEngine.h"
 #include "drawing/LightFX.h"
 #include "interface/Chat.h"
@@ -68,6 +72,7 @@
 #include "world/Sprite.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <exception>
 #include <future>
@@ -101,6 +106,11 @@ namespace OpenRCT2
         std::unique_ptr<IScenarioRepository> _scenarioRepository;
         std::unique_ptr<IReplayManager> _replayManager;
         std::unique_ptr<IGameStateSnapshots> _gameStateSnapshots;
+
+        // Repository scans running in the background
+        std::shared_future<void> _objectRepositoryLoad;
+        std::shared_future<void> _trackDesignRepositoryScan;
+        std::shared_future<void> _scenarioRepositoryScan;
 #ifdef __ENABLE_DISCORD__
         std::unique_ptr<DiscordService> _discordService;
 #endif
@@ -163,6 +173,14 @@ namespace OpenRCT2
             // NOTE: We must shutdown all systems here before Instance is set back to null.
             //       If objects use GetContext() in their destructor things won't go well.
 
+            // The background scans use GetContext() as well.
+            WaitForBackgroundScan(_objectRepositoryLoad);
+            WaitForBackgroundScan(_trackDesignRepositoryScan);
+            WaitForBackgroundScan(_scenarioRepositoryScan);
+
+            // Make sure an autosave being written in the background is complete before exiting
+            game_autosave_wait();
+
             GameActions::ClearQueue();
             network_close();
             window_close_all();
@@ -228,11 +246,13 @@ namespace OpenRCT2
 
         ITrackDesignRepository* GetTrackDesignRepository() override
         {
+            WaitForBackgroundScan(_trackDesignRepositoryScan);
             return _trackDesignRepository.get();
         }
 
         IScenarioRepository* GetScenarioRepository() override
         {
+            WaitForBackgroundScan(_scenarioRepositoryScan);
             return _scenarioRepository.get();
         }
 
@@ -346,9 +366,18 @@ namespace OpenRCT2
                 throw std::runtime_error("Context already initialised.");
             }
             _initialised = true;
+            StartupTimings::ScopedPhase initialisePhase("Initialise");
 
             crash_init();
 
+            TaskSchedulerOptions schedulerOptions;
+            schedulerOptions.WorkerCount = static_cast<size_t>(std::max(gConfigGeneral.worker_threads, 0));
+            schedulerOptions.FirstCpu = gConfigGeneral.worker_thread_first_cpu;
+            if (!TaskScheduler::Configure(schedulerOptions))
+            {
+                log_verbose("Task scheduler already running, worker thread settings apply after a restart.");
+            }
+
             if (gConfigGeneral.last_run_version != nullptr && String::Equals(gConfigGeneral.last_run_version, OPENRCT2_VERSION))
             {
                 gOpenRCT2ShowChangelog = false;
@@ -362,6 +391,7 @@ namespace OpenRCT2
 
             try
             {
+                StartupTimings::ScopedPhase phase("Language");
                 _localisationService->OpenLanguage(gConfigGeneral.language);
             }
             catch (const std::exception& e)
@@ -437,26 +467,46 @@ namespace OpenRCT2
 
             if (!gOpenRCT2Headless)
             {
+                StartupTimings::ScopedPhase phase("Window");
                 _uiContext->CreateWindow();
             }
 
             EnsureUserContentDirectoriesExist();
 
-            // TODO Ideally we want to delay this until we show the title so that we can
-            //      still open the game window and draw a progress screen for the creation
-            //      of the object cache.
-            _objectRepository->LoadOrConstruct(_localisationService->GetCurrentLanguage());
+            // The repositories are scanned in the background while the rest of the game initialises. Only the object
+            // repository is required for the title screen, track designs and scenarios are waited for once they are
+            // first requested.
+            // TODO Ideally we want to delay waiting for the objects until we show the title so that we can
+            //      draw a progress screen for the creation of the object cache.
+            auto language = _localisationService->GetCurrentLanguage();
+            auto loadObjects = [this, language]() {
+                StartupTimings::ScopedPhase phase("Object repository");
+                _objectRepository->LoadOrConstruct(language);
+            };
+            _objectRepositoryLoad = std::async(std::launch::async, loadObjects).share();
+
+            // Track designs are imported with the objects they use, so wait for those to be loaded first.
+            auto scanTrackDesigns = [this, language, objects = _objectRepositoryLoad]() {
+                objects.wait();
+                StartupTimings::ScopedPhase phase("Track design repository");
+                RunBackgroundScan("track designs", [&]() { _trackDesignRepository->Scan(language); });
+            };
+            _trackDesignRepositoryScan = std::async(std::launch::async, scanTrackDesigns).share();
 
-            // TODO Like objects, this can take a while if there are a lot of track designs
-            //      its also really something really we might want to do in the background
-            //      as its not required until the player wants to place a new ride.
-            _trackDesignRepository->Scan(_localisationService->GetCurrentLanguage());
+            auto scanScenarios = [this, language]() {
+                StartupTimings::ScopedPhase phase("Scenario repository");
+                RunBackgroundScan("scenarios", [&]() { _scenarioRepository->Scan(language); });
+            };
+            _scenarioRepositoryScan = std::async(std::launch::async, scanScenarios).share();
 
-            _scenarioRepository->Scan(_localisationService->GetCurrentLanguage());
-            TitleSequenceManager::Scan();
+            {
+                StartupTimings::ScopedPhase phase("Title sequences");
+                TitleSequenceManager::Scan();
+            }
 
             if (!gOpenRCT2Headless)
             {
+                StartupTimings::ScopedPhase phase("Audio");
                 Init();
                 PopulateDevices();
                 InitRideSoundsAndInfo();
@@ -478,15 +528,27 @@ namespace OpenRCT2
 #endif
             }
 
+            // Rethrows if the object repository could not be loaded.
+            {
+                StartupTimings::ScopedPhase phase("Wait for objects");
+                _objectRepositoryLoad.get();
+            }
+
             gScenarioTicks = 0;
             input_reset_place_obj_modifier();
             viewport_init_all();
 
-            _gameState = std::make_unique<GameState>();
-            _gameState->InitAll(150);
+            {
+                StartupTimings::ScopedPhase phase("Game state");
+                _gameState = std::make_unique<GameState>();
+                _gameState->InitAll(150);
+            }
 
             _titleScreen = std::make_unique<TitleScreen>(*_gameState);
-            _uiContext->Initialise();
+            {
+                StartupTimings::ScopedPhase phase("UI");
+                _uiContext->Initialise();
+            }
 
             return true;
         }
@@ -494,6 +556,7 @@ namespace OpenRCT2
         void InitialiseDrawingEngine() final override
         {
             assert(_drawingEngine == nullptr);
+            StartupTimings::ScopedPhase phase("Drawing engine");
 
             _drawingEngineType = gConfigGeneral.drawing_engine;
 
@@ -760,13 +823,25 @@ namespace OpenRCT2
 
         bool LoadBaseGraphics()
         {
-            if (!gfx_load_g1(*_env))
             {
-                return false;
+                StartupTimings::ScopedPhase phase("G1");
+                if (!gfx_load_g1(*_env))
+                {
+                    return false;
+                }
+            }
+            {
+                StartupTimings::ScopedPhase phase("G2");
+                gfx_load_g2();
+            }
+            {
+                StartupTimings::ScopedPhase phase("CSG");
+                gfx_load_csg();
+            }
+            {
+                StartupTimings::ScopedPhase phase("Fonts");
+                font_sprite_initialise_characters();
             }
-            gfx_load_g2();
-            gfx_load_csg();
-            font_sprite_initialise_characters();
             return true;
         }
 
@@ -803,6 +878,7 @@ namespace OpenRCT2
                 }
             }
 
+            const auto startupActionStart = Profiling::GetTimestamp();
             switch (gOpenRCT2StartupAction)
             {
                 case StartupAction::Intro:
@@ -911,6 +987,18 @@ namespace OpenRCT2
             }
 #endif // DISABLE_NETWORK
 
+            StartupTimings::RecordPhase("Startup action", startupActionStart, Profiling::GetTimestamp());
+            StartupTimings::Finish();
+
+            if (gOpenRCT2MemoryReport)
+            {
+                for (const auto& line : FormatMemoryReport(GetMemoryReport()))
+                {
+                    Console::WriteLine("%s", line.c_str());
+                }
+                return;
+            }
+
             _stdInOutConsole.Start();
             RunGameLoop();
         }
@@ -935,6 +1023,7 @@ namespace OpenRCT2
         {
             log_verbose("begin openrct2 loop");
             _finished = false;
+            Profiling::SetThreadName("Main");
 
 #ifndef __EMSCRIPTEN__
             _variableFrame = ShouldRunVariableFrame();
@@ -962,11 +1051,8 @@ namespace OpenRCT2
                 _lastTick = 0;
                 _variableFrame = useVariableFrame;
 
-                // Switching from variable to fixed frame requires reseting
-                // of entity positions back to end of tick positions
-                auto& tweener = EntityTweener::Get();
-                tweener.Restore();
-                tweener.Reset();
+                // Switching from variable to fixed frame draws entities at their end of tick positions again
+                EntityTweener::Get().Reset();
             }
 
             if (useVariableFrame)
@@ -1012,9 +1098,11 @@ namespace OpenRCT2
 
             if (!_isWindowMinimised && !gOpenRCT2Headless)
             {
+                Profiling::ScopedZone zone("Draw frame");
                 _drawingEngine->BeginDraw();
                 _painter->Paint(*_drawingEngine);
                 _drawingEngine->EndDraw();
+                RecordInputLatency();
             }
         }
 
@@ -1038,8 +1126,11 @@ namespace OpenRCT2
 
             _uiContext->ProcessMessages();
 
+            bool ticked = false;
             while (_accumulator >= GAME_UPDATE_TIME_MS)
             {
+                ticked = true;
+
                 // Get the original position of each sprite
                 if (draw)
                     tweener.PreTick();
@@ -1058,12 +1149,31 @@ namespace OpenRCT2
 
             if (draw)
             {
+                // Input is handled by the game ticks, between them the low latency mode at least keeps the tool at
+                // the cursor. Not in multiplayer, where every ghost the tool places is sent to the server.
+                if (!ticked && gConfigGeneral.low_latency_input && network_get_mode() == NETWORK_MODE_NONE
+                    && !(gScreenFlags & SCREEN_FLAGS_TITLE_DEMO))
+                {
+                    _uiContext->GetWindowManager()->UpdateToolAtCursor();
+                }
+
                 const float alpha = std::min(_accumulator / static_cast<float>(GAME_UPDATE_TIME_MS), 1.0f);
                 tweener.Tween(alpha);
 
+                Profiling::ScopedZone zone("Draw frame");
                 _drawingEngine->BeginDraw();
                 _painter->Paint(*_drawingEngine);
                 _drawingEngine->EndDraw();
+                RecordInputLatency();
+            }
+        }
+
+        void RecordInputLatency()
+        {
+            const auto inputTimestamp = _uiContext->TakeInputTimestamp();
+            if (inputTimestamp != 0)
+            {
+                _painter->RecordInputLatency(platform_get_ticks() - inputTimestamp);
             }
         }
 
@@ -1102,6 +1212,13 @@ namespace OpenRCT2
 #endif
 
             chat_update();
+
+            // Only once the initial scan is done, so the repository is never updated from two threads
+            if (_trackDesignRepositoryScan.valid()
+                && _trackDesignRepositoryScan.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+            {
+                _trackDesignRepository->ApplyFileChanges(_localisationService->GetCurrentLanguage());
+            }
 #ifdef ENABLE_SCRIPTING
             _scriptEngine.Update();
 #endif
@@ -1142,6 +1259,26 @@ namespace OpenRCT2
             }
         }
 
+        template<typename TFunc> static void RunBackgroundScan(const char* name, TFunc&& func)
+        {
+            try
+            {
+                func();
+            }
+            catch (const std::exception& e)
+            {
+                log_error("Unable to scan %s: %s", name, e.what());
+            }
+        }
+
+        static void WaitForBackgroundScan(const std::shared_future<void>& scan)
+        {
+            if (scan.valid())
+            {
+                scan.wait();
+            }
+        }
+
         /**
          * Copy saved games and landscapes to user directory
          */
@@ -486,16 +486,14 @@ bool window_editor_object_selection_select_object(uint8_t isMasterObject, int32_
         return false;
     }
 
-    int32_t numObjects = static_cast<int32_t>(object_repository_get_items_count());
-    // Get repository item index
-    int32_t index = -1;
+    // Get repository item index, items are stored contiguously so this does not need a search
     const ObjectRepositoryItem* items = object_repository_get_items();
-    for (int32_t i = 0; i < numObjects; i++)
+    auto index = item - items;
+    if (index < 0 || static_cast<size_t>(index) >= object_repository_get_items_count()
+        || static_cast<size_t>(index) >= _objectSelectionFlags.size())
     {
-        if (&items[i] == item)
-        {
-            index = i;
-        }
+        set_object_selection_error(isMasterObject, STR_OBJECT_SELECTION_ERR_OBJECT_DATA_NOT_FOUND);
+        return false;
     }
 
     uint8_t* selectionFlags = &_objectSelectionFlags[index];
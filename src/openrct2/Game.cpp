@@ -40,6 +40,7 @@
 #include "peep/Peep.h"
 #include "peep/Staff.h"
 #include "platform/Platform2.h"
+#include "rct2/S6Exporter.h"
 #include "rct1/RCT1.h"
 #include "ride/Ride.h"
 #include "ride/RideRatings.h"
@@ -69,6 +70,7 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <future>
 #include <iterator>
 #include <memory>
 
@@ -722,16 +724,87 @@ static void limit_autosave_count(const size_t numberOfFilesToKeep, bool processL
     }
 }
 
+// The autosave that is being written in the background, only one is written at a time.
+static std::future<void> _autosaveWrite;
+
+void game_autosave_wait()
+{
+    if (_autosaveWrite.valid())
+    {
+        _autosaveWrite.wait();
+        _autosaveWrite = {};
+    }
+}
+
+/**
+ * Converts the park into the S6 structure on the game thread and leaves compressing and writing it to a background
+ * thread. The file is written under a temporary name first and renamed once complete, so a crash or a full disk never
+ * leaves a truncated autosave behind.
+ */
+static void game_autosave_write(const std::string& path, bool isScenario)
+{
+    log_verbose("game_autosave_write(%s)", path.c_str());
+
+    viewport_set_saved_view();
+
+    auto exporter = std::make_shared<S6Exporter>();
+    try
+    {
+        exporter->RemoveTracklessRides = true;
+        exporter->Export();
+    }
+    catch (const std::exception& e)
+    {
+        log_error("Unable to save park: '%s'", e.what());
+        Console::Error::WriteLine("Could not autosave the scenario. Is the save folder writeable?");
+        return;
+    }
+
+    _autosaveWrite = std::async(std::launch::async, [exporter, path, isScenario]() {
+        auto tempPath = path + ".tmp";
+        try
+        {
+            if (isScenario)
+            {
+                exporter->SaveScenario(tempPath.c_str());
+            }
+            else
+            {
+                exporter->SaveGame(tempPath.c_str());
+            }
+
+            // Moving onto an existing file fails on some platforms
+            if (!platform_file_move(tempPath.c_str(), path.c_str()))
+            {
+                platform_file_delete(path.c_str());
+                if (!platform_file_move(tempPath.c_str(), path.c_str()))
+                {
+                    throw std::runtime_error("Unable to rename " + tempPath);
+                }
+            }
+        }
+        catch (const std::exception& e)
+        {
+            log_error("Unable to save park: '%s'", e.what());
+            Console::Error::WriteLine("Could not autosave the scenario. Is the save folder writeable?");
+            platform_file_delete(tempPath.c_str());
+        }
+    });
+}
+
 void game_autosave()
 {
+    // Let the previous autosave finish before the old autosaves are counted and removed
+    game_autosave_wait();
+
     const char* subDirectory = "save";
     const char* fileExtension = ".sv6";
-    uint32_t saveFlags = 0x80000000;
+    bool isScenario = false;
     if (gScreenFlags & SCREEN_FLAGS_EDITOR)
     {
         subDirectory = "landscape";
         fileExtension = ".sc6";
-        saveFlags |= 2;
+        isScenario = true;
     }
 
     // Retrieve current time
@@ -762,8 +835,7 @@ void game_autosave()
         platform_file_copy(path, backupPath, true);
     }
 
-    if (!scenario_save(path, saveFlags))
-        Console::Error::WriteLine("Could not autosave the scenario. Is the save folder writeable?");
+    game_autosave_write(path, isScenario);
 }
 
 static void game_load_or_quit_no_save_prompt_callback(int32_t result, const utf8* path)
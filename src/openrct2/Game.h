@@ -103,6 +103,7 @@ enum class GameCommand : int32_t
     GuestSetFlags,            // GA
     SetDate,                  // GA
     Custom,                   // GA
+    ScatterSmallScenery,      // GA
     Count,
 };
 
@@ -172,6 +173,7 @@ void save_game_as();
 void save_game_cmd(const utf8* name = nullptr);
 void save_game_with_name(const utf8* name);
 void game_autosave();
+void game_autosave_wait();
 void game_convert_strings_to_utf8();
 void game_convert_strings_to_rct2(rct_s6_data* s6);
 void utf8_to_rct2_self(char* buffer, size_t length);
@@ -17,12 +17,15 @@
 #include "Input.h"
 #include "OpenRCT2.h"
 #include "ReplayManager.h"
+#include "TickWatchdog.h"
 #include "actions/GameAction.h"
 #include "config/Config.h"
+#include "core/Profiling.h"
 #include "interface/Screenshot.h"
 #include "localisation/Date.h"
 #include "localisation/Localisation.h"
 #include "management/NewsItem.h"
+#include "network/NetworkMetricsExporter.h"
 #include "network/network.h"
 #include "peep/Staff.h"
 #include "platform/Platform2.h"
@@ -32,6 +35,7 @@
 #include "title/TitleScreen.h"
 #include "title/TitleSequencePlayer.h"
 #include "ui/UiContext.h"
+#include "util/Util.h"
 #include "windows/Intent.h"
 #include "world/Climate.h"
 #include "world/MapAnimation.h"
@@ -45,6 +49,38 @@
 using namespace OpenRCT2;
 using namespace OpenRCT2::Scripting;
 
+// Profiler zone names of each LogicTimePart, in the same order.
+static constexpr const char* LogicTimePartZoneNames[] = {
+    "Network update",
+    "Date",
+    "Scenario",
+    "Climate",
+    "Map tiles",
+    "Map stash provisional elements",
+    "Map path wide flags",
+    "Peeps",
+    "Map restore provisional elements",
+    "Vehicles",
+    "Misc entities",
+    "Rides",
+    "Park",
+    "Research",
+    "Ride ratings",
+    "Ride measurements",
+    "News",
+    "Map animations",
+    "Sounds",
+    "Game actions",
+    "Network flush",
+    "Scripts",
+};
+static_assert(std::size(LogicTimePartZoneNames) == LOGIC_TIME_PART_COUNT);
+
+const char* OpenRCT2::GetLogicTimePartName(LogicTimePart part)
+{
+    return LogicTimePartZoneNames[EnumValue(part)];
+}
+
 GameState::GameState()
 {
     _park = std::make_unique<Park>();
@@ -243,9 +279,17 @@ void GameState::Update()
 
 void GameState::UpdateLogic(LogicTimings* timings)
 {
+    Profiling::ScopedZone tickZone("Tick");
+    TickWatchdog::ScopedTick watchdogTick;
+    NetworkMetrics::ScopedTick metricsTick;
     auto start_time = std::chrono::high_resolution_clock::now();
+    auto partStart = Profiling::GetTimestamp();
+
+    auto report_time = [timings, start_time, &partStart](LogicTimePart part) {
+        auto partEnd = Profiling::GetTimestamp();
+        Profiling::RecordZone(GetLogicTimePartName(part), partStart, partEnd);
+        partStart = partEnd;
 
-    auto report_time = [timings, start_time](LogicTimePart part) {
         if (timings != nullptr)
         {
             timings->TimingInfo[part][timings->CurrentIdx] = std::chrono::high_resolution_clock::now() - start_time;
@@ -342,13 +386,19 @@ void GameState::UpdateLogic(LogicTimings* timings)
     News::UpdateCurrentItem();
     report_time(LogicTimePart::News);
 
+    // Also removes finished animations, so it has to run even without anything to draw.
     map_animation_invalidate_all();
     report_time(LogicTimePart::MapAnimation);
-    vehicle_sounds_update();
-    peep_update_crowd_noise();
-    climate_update_sound();
-    report_time(LogicTimePart::Sounds);
-    editor_open_windows_for_current_step();
+
+    // Sounds and windows only present the game state, there is nobody to present it to when running headless.
+    if (!gOpenRCT2Headless)
+    {
+        vehicle_sounds_update();
+        peep_update_crowd_noise();
+        climate_update_sound();
+        report_time(LogicTimePart::Sounds);
+        editor_open_windows_for_current_step();
+    }
 
     // Update windows
     // window_dispatch_update_all();
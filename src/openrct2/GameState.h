@@ -47,6 +47,13 @@ namespace OpenRCT2
         Scripts,
     };
 
+    constexpr size_t LOGIC_TIME_PART_COUNT = static_cast<size_t>(LogicTimePart::Scripts) + 1;
+
+    /**
+     * @returns the readable name of a part, which is also its profiler zone name.
+     */
+    const char* GetLogicTimePartName(LogicTimePart part);
+
     // ~6.5s at 40Hz
     constexpr size_t LOGIC_UPDATE_MEASUREMENTS_COUNT = 256;
 
@@ -21,106 +21,229 @@
 #include "world/Particle.h"
 #include "world/Sprite.h"
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
 static constexpr size_t MaximumGameStateSnapshots = 32;
 static constexpr uint32_t InvalidTick = 0xFFFFFFFF;
 
-struct GameStateSnapshot_t
+// Entities are stored in pages of consecutive indices. Pages that did not change between two captures are shared by the
+// snapshots, so keeping the whole history around costs little more than the entities that actually changed.
+static constexpr size_t SnapshotPageSize = 64;
+static constexpr size_t SnapshotPageCount = (MAX_ENTITIES + SnapshotPageSize - 1) / SnapshotPageSize;
+
+struct GameStateSnapshotPage_t
+{
+    uint32_t numSprites = 0;
+
+    // Entries of the page in the same layout as the stored sprites of a serialised snapshot.
+    OpenRCT2::MemoryStream data;
+};
+
+using GameStateSnapshotPages = std::array<std::shared_ptr<const GameStateSnapshotPage_t>, SnapshotPageCount>;
+
+static void SerialiseSprite(rct_sprite& sprite, DataSerialiser& ds)
+{
+    ds << sprite.base.Type;
+
+    switch (sprite.base.Type)
+    {
+        case EntityType::Vehicle:
+            reinterpret_cast<Vehicle&>(sprite).Serialise(ds);
+            break;
+        case EntityType::Guest:
+            reinterpret_cast<Guest&>(sprite).Serialise(ds);
+            break;
+        case EntityType::Staff:
+            reinterpret_cast<Staff&>(sprite).Serialise(ds);
+            break;
+        case EntityType::Litter:
+            reinterpret_cast<Litter&>(sprite).Serialise(ds);
+            break;
+        case EntityType::MoneyEffect:
+            reinterpret_cast<MoneyEffect&>(sprite).Serialise(ds);
+            break;
+        case EntityType::Balloon:
+            reinterpret_cast<Balloon&>(sprite).Serialise(ds);
+            break;
+        case EntityType::Duck:
+            reinterpret_cast<Duck&>(sprite).Serialise(ds);
+            break;
+        case EntityType::JumpingFountain:
+            reinterpret_cast<JumpingFountain&>(sprite).Serialise(ds);
+            break;
+        case EntityType::SteamParticle:
+            reinterpret_cast<SteamParticle&>(sprite).Serialise(ds);
+            break;
+        case EntityType::Null:
+            break;
+        default:
+            break;
+    }
+}
+
+static size_t GetPageFirstIndex(size_t pageIndex)
+{
+    return pageIndex * SnapshotPageSize;
+}
+
+static size_t GetPageEndIndex(size_t pageIndex)
+{
+    return std::min<size_t>(GetPageFirstIndex(pageIndex) + SnapshotPageSize, MAX_ENTITIES);
+}
+
+// Sprites must hold all entities of the page, indexed from the first index of the page. The size hint is usually the
+// size of the previous capture of the page, which saves growing the buffer one doubling at a time.
+static std::shared_ptr<const GameStateSnapshotPage_t> CreateSnapshotPage(
+    size_t pageIndex, rct_sprite* sprites, size_t sizeHint = 0)
 {
-    GameStateSnapshot_t& operator=(GameStateSnapshot_t&& mv) noexcept
+    auto page = std::make_shared<GameStateSnapshotPage_t>();
+    page->data.Reserve(sizeHint);
+    DataSerialiser ds(true, page->data);
+
+    const auto firstIndex = GetPageFirstIndex(pageIndex);
+    for (size_t i = firstIndex; i < GetPageEndIndex(pageIndex); i++)
     {
-        tick = mv.tick;
-        storedSprites = std::move(mv.storedSprites);
-        return *this;
+        auto& sprite = sprites[i - firstIndex];
+        if (sprite.base.Type == EntityType::Null)
+            continue;
+
+        ds << static_cast<uint32_t>(i);
+        SerialiseSprite(sprite, ds);
+        page->numSprites++;
     }
+    return page;
+}
+
+static bool SnapshotPagesEqual(const GameStateSnapshotPage_t* a, const GameStateSnapshotPage_t* b)
+{
+    if (a == b)
+        return true;
+    if (a == nullptr || b == nullptr)
+        return false;
+    return a->numSprites == b->numSprites && a->data.GetLength() == b->data.GetLength()
+        && std::memcmp(a->data.GetData(), b->data.GetData(), static_cast<size_t>(a->data.GetLength())) == 0;
+}
 
+// Fills sprites with the entities of the page, indexed from the first index of the page. If given, serialisedSprites
+// receives the serialised bytes of each entity, empty for entities that don't exist.
+static void ReadSnapshotPage(
+    size_t pageIndex, const GameStateSnapshotPage_t* page, rct_sprite* sprites,
+    std::string_view* serialisedSprites = nullptr)
+{
+    const auto firstIndex = GetPageFirstIndex(pageIndex);
+    const auto endIndex = GetPageEndIndex(pageIndex);
+    for (size_t i = firstIndex; i < endIndex; i++)
+    {
+        // By default they don't exist.
+        sprites[i - firstIndex].base.Type = EntityType::Null;
+        if (serialisedSprites != nullptr)
+            serialisedSprites[i - firstIndex] = {};
+    }
+    if (page == nullptr)
+        return;
+
+    OpenRCT2::MemoryStream stream(page->data.GetData(), page->data.GetLength());
+    DataSerialiser ds(false, stream);
+    for (uint32_t i = 0; i < page->numSprites; i++)
+    {
+        uint32_t spriteIdx{};
+        ds << spriteIdx;
+        if (spriteIdx < firstIndex || spriteIdx >= endIndex)
+        {
+            log_error("Entity index corrupted!");
+            return;
+        }
+        const auto spriteStart = stream.GetPosition();
+        SerialiseSprite(sprites[spriteIdx - firstIndex], ds);
+        if (serialisedSprites != nullptr)
+        {
+            serialisedSprites[spriteIdx - firstIndex] = std::string_view(
+                static_cast<const char*>(page->data.GetData()) + spriteStart,
+                static_cast<size_t>(stream.GetPosition() - spriteStart));
+        }
+    }
+}
+
+struct GameStateSnapshot_t
+{
     uint32_t tick = InvalidTick;
     uint32_t srand0 = 0;
 
+    GameStateSnapshotPages pages;
+
+    // Sprites of a snapshot that was read from a stream, split into pages when the snapshot is compared.
     OpenRCT2::MemoryStream storedSprites;
     OpenRCT2::MemoryStream parkParameters;
 
-    // Must pass a function that can access the sprite.
-    void SerialiseSprites(std::function<rct_sprite*(const size_t)> getEntity, const size_t numSprites, bool saving)
+    void WriteStoredSprites(OpenRCT2::MemoryStream& stream) const
     {
-        const bool loading = !saving;
-
-        storedSprites.SetPosition(0);
-        DataSerialiser ds(saving, storedSprites);
-
-        std::vector<uint32_t> indexTable;
-        indexTable.reserve(numSprites);
+        if (storedSprites.GetLength() != 0)
+        {
+            stream.Write(storedSprites.GetData(), storedSprites.GetLength());
+            return;
+        }
 
         uint32_t numSavedSprites = 0;
-
-        if (saving)
+        size_t length = sizeof(numSavedSprites);
+        for (const auto& page : pages)
         {
-            for (size_t i = 0; i < numSprites; i++)
+            if (page != nullptr)
             {
-                auto entity = getEntity(i);
-                if (entity == nullptr || entity->base.Type == EntityType::Null)
-                    continue;
-                indexTable.push_back(static_cast<uint32_t>(i));
+                numSavedSprites += page->numSprites;
+                length += static_cast<size_t>(page->data.GetLength());
             }
-            numSavedSprites = static_cast<uint32_t>(indexTable.size());
         }
 
+        stream.Reserve(static_cast<size_t>(stream.GetPosition()) + length);
+        DataSerialiser ds(true, stream);
         ds << numSavedSprites;
+        for (const auto& page : pages)
+        {
+            if (page != nullptr)
+                stream.Write(page->data.GetData(), page->data.GetLength());
+        }
+    }
 
-        if (loading)
+    void ReadStoredSprites()
+    {
+        if (storedSprites.GetLength() == 0)
+            return;
+
+        std::vector<rct_sprite> spriteList;
+        spriteList.resize(MAX_ENTITIES);
+        for (auto& sprite : spriteList)
         {
-            indexTable.resize(numSavedSprites);
+            // By default they don't exist.
+            sprite.base.Type = EntityType::Null;
         }
 
+        storedSprites.SetPosition(0);
+        DataSerialiser ds(false, storedSprites);
+
+        uint32_t numSavedSprites = 0;
+        ds << numSavedSprites;
         for (uint32_t i = 0; i < numSavedSprites; i++)
         {
-            ds << indexTable[i];
-
-            const uint32_t spriteIdx = indexTable[i];
-            rct_sprite* entity = getEntity(spriteIdx);
-            if (entity == nullptr)
+            uint32_t spriteIdx{};
+            ds << spriteIdx;
+            if (spriteIdx >= MAX_ENTITIES)
             {
                 log_error("Entity index corrupted!");
-                return;
+                break;
             }
-            auto& sprite = *entity;
-
-            ds << sprite.base.Type;
+            SerialiseSprite(spriteList[spriteIdx], ds);
+        }
 
-            switch (sprite.base.Type)
-            {
-                case EntityType::Vehicle:
-                    reinterpret_cast<Vehicle&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::Guest:
-                    reinterpret_cast<Guest&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::Staff:
-                    reinterpret_cast<Staff&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::Litter:
-                    reinterpret_cast<Litter&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::MoneyEffect:
-                    reinterpret_cast<MoneyEffect&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::Balloon:
-                    reinterpret_cast<Balloon&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::Duck:
-                    reinterpret_cast<Duck&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::JumpingFountain:
-                    reinterpret_cast<JumpingFountain&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::SteamParticle:
-                    reinterpret_cast<SteamParticle&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::Null:
-                    break;
-                default:
-                    break;
-            }
+        for (size_t pageIndex = 0; pageIndex < SnapshotPageCount; pageIndex++)
+        {
+            pages[pageIndex] = CreateSnapshotPage(pageIndex, &spriteList[GetPageFirstIndex(pageIndex)]);
         }
+        storedSprites = {};
     }
 };
 
@@ -129,6 +252,7 @@ struct GameStateSnapshots final : public IGameStateSnapshots
     virtual void Reset() override final
     {
         _snapshots.clear();
+        _capturedPages = {};
     }
 
     virtual GameStateSnapshot_t& CreateSnapshot() override final
@@ -147,10 +271,29 @@ struct GameStateSnapshots final : public IGameStateSnapshots
 
     virtual void Capture(GameStateSnapshot_t& snapshot) override final
     {
-        snapshot.SerialiseSprites(
-            [](const size_t index) { return reinterpret_cast<rct_sprite*>(GetEntity(index)); }, MAX_ENTITIES, true);
-
-        // log_info("Snapshot size: %u bytes", static_cast<uint32_t>(snapshot.storedSprites.GetLength()));
+        for (size_t pageIndex = 0; pageIndex < SnapshotPageCount; pageIndex++)
+        {
+            // A page is only serialised again when the memory of one of its entities changed since the last capture.
+            bool changed = _capturedPages[pageIndex] == nullptr;
+            for (size_t i = GetPageFirstIndex(pageIndex); i < GetPageEndIndex(pageIndex); i++)
+            {
+                const auto* entity = reinterpret_cast<const rct_sprite*>(GetEntity(i));
+                if (std::memcmp(entity, &_capturedSprites[i], sizeof(rct_sprite)) != 0)
+                {
+                    std::memcpy(&_capturedSprites[i], entity, sizeof(rct_sprite));
+                    changed = true;
+                }
+            }
+            if (changed)
+            {
+                const auto& previousPage = _capturedPages[pageIndex];
+                size_t sizeHint = previousPage != nullptr ? static_cast<size_t>(previousPage->data.GetLength()) : 0;
+                _capturedPages[pageIndex] = CreateSnapshotPage(
+                    pageIndex, &_capturedSprites[GetPageFirstIndex(pageIndex)], sizeHint);
+            }
+        }
+        snapshot.pages = _capturedPages;
+        snapshot.storedSprites = {};
     }
 
     virtual const GameStateSnapshot_t* GetLinkedSnapshot(uint32_t tick) const override final
@@ -167,24 +310,19 @@ struct GameStateSnapshots final : public IGameStateSnapshots
     {
         ds << snapshot.tick;
         ds << snapshot.srand0;
-        ds << snapshot.storedSprites;
-        ds << snapshot.parkParameters;
-    }
-
-    std::vector<rct_sprite> BuildSpriteList(GameStateSnapshot_t& snapshot) const
-    {
-        std::vector<rct_sprite> spriteList;
-        spriteList.resize(MAX_ENTITIES);
-
-        for (auto& sprite : spriteList)
+        if (ds.IsSaving())
         {
-            // By default they don't exist.
-            sprite.base.Type = EntityType::Null;
+            OpenRCT2::MemoryStream storedSprites;
+            snapshot.WriteStoredSprites(storedSprites);
+            ds << storedSprites;
         }
-
-        snapshot.SerialiseSprites([&spriteList](const size_t index) { return &spriteList[index]; }, MAX_ENTITIES, false);
-
-        return spriteList;
+        else
+        {
+            snapshot.pages = {};
+            snapshot.storedSprites = {};
+            ds << snapshot.storedSprites;
+        }
+        ds << snapshot.parkParameters;
     }
 
 #define COMPARE_FIELD(struc, field)                                                                                            \
@@ -582,50 +720,78 @@ struct GameStateSnapshots final : public IGameStateSnapshots
         res.srand0Left = base.srand0;
         res.srand0Right = cmp.srand0;
 
-        std::vector<rct_sprite> spritesBase = BuildSpriteList(const_cast<GameStateSnapshot_t&>(base));
-        std::vector<rct_sprite> spritesCmp = BuildSpriteList(const_cast<GameStateSnapshot_t&>(cmp));
+        const_cast<GameStateSnapshot_t&>(base).ReadStoredSprites();
+        const_cast<GameStateSnapshot_t&>(cmp).ReadStoredSprites();
 
-        for (uint32_t i = 0; i < static_cast<uint32_t>(spritesBase.size()); i++)
-        {
-            GameStateSpriteChange_t changeData;
-            changeData.spriteIndex = i;
+        std::vector<rct_sprite> spritesBase(SnapshotPageSize);
+        std::vector<rct_sprite> spritesCmp(SnapshotPageSize);
+        std::vector<std::string_view> serialisedBase(SnapshotPageSize);
+        std::vector<std::string_view> serialisedCmp(SnapshotPageSize);
 
-            const rct_sprite& spriteBase = spritesBase[i];
-            const rct_sprite& spriteCmp = spritesCmp[i];
+        for (size_t pageIndex = 0; pageIndex < SnapshotPageCount; pageIndex++)
+        {
+            const auto firstIndex = GetPageFirstIndex(pageIndex);
+            const auto endIndex = GetPageEndIndex(pageIndex);
+
+            // Shared pages and pages with the same serialised entities have nothing to compare, which is every page
+            // without a diverged entity when comparing against a snapshot received from elsewhere.
+            const auto* pageBase = base.pages[pageIndex].get();
+            const auto* pageCmp = cmp.pages[pageIndex].get();
+            if (SnapshotPagesEqual(pageBase, pageCmp))
+                continue;
 
-            changeData.entityType = spriteBase.base.Type;
+            ReadSnapshotPage(pageIndex, pageBase, spritesBase.data(), serialisedBase.data());
+            ReadSnapshotPage(pageIndex, pageCmp, spritesCmp.data(), serialisedCmp.data());
 
-            if (spriteBase.base.Type == EntityType::Null && spriteCmp.base.Type != EntityType::Null)
-            {
-                // Sprite was added.
-                changeData.changeType = GameStateSpriteChange_t::ADDED;
-                changeData.entityType = spriteCmp.base.Type;
-            }
-            else if (spriteBase.base.Type != EntityType::Null && spriteCmp.base.Type == EntityType::Null)
+            for (size_t i = firstIndex; i < endIndex; i++)
             {
-                // Sprite was removed.
-                changeData.changeType = GameStateSpriteChange_t::REMOVED;
+                // Only entities that serialise differently are compared field by field.
+                if (serialisedBase[i - firstIndex] == serialisedCmp[i - firstIndex])
+                    continue;
+
+                GameStateSpriteChange_t changeData;
+                changeData.spriteIndex = static_cast<uint32_t>(i);
+
+                const rct_sprite& spriteBase = spritesBase[i - firstIndex];
+                const rct_sprite& spriteCmp = spritesCmp[i - firstIndex];
+
                 changeData.entityType = spriteBase.base.Type;
-            }
-            else if (spriteBase.base.Type == EntityType::Null && spriteCmp.base.Type == EntityType::Null)
-            {
-                // Do nothing.
-                changeData.changeType = GameStateSpriteChange_t::EQUAL;
-            }
-            else
-            {
-                CompareSpriteData(spriteBase, spriteCmp, changeData);
-                if (changeData.diffs.size() == 0)
+
+                if (spriteBase.base.Type == EntityType::Null && spriteCmp.base.Type != EntityType::Null)
+                {
+                    // Sprite was added.
+                    changeData.changeType = GameStateSpriteChange_t::ADDED;
+                    changeData.entityType = spriteCmp.base.Type;
+                }
+                else if (spriteBase.base.Type != EntityType::Null && spriteCmp.base.Type == EntityType::Null)
                 {
+                    // Sprite was removed.
+                    changeData.changeType = GameStateSpriteChange_t::REMOVED;
+                    changeData.entityType = spriteBase.base.Type;
+                }
+                else if (spriteBase.base.Type == EntityType::Null && spriteCmp.base.Type == EntityType::Null)
+                {
+                    // Do nothing.
                     changeData.changeType = GameStateSpriteChange_t::EQUAL;
                 }
                 else
                 {
-                    changeData.changeType = GameStateSpriteChange_t::MODIFIED;
+                    CompareSpriteData(spriteBase, spriteCmp, changeData);
+                    if (changeData.diffs.size() == 0)
+                    {
+                        changeData.changeType = GameStateSpriteChange_t::EQUAL;
+                    }
+                    else
+                    {
+                        changeData.changeType = GameStateSpriteChange_t::MODIFIED;
+                    }
                 }
-            }
 
-            res.spriteChanges.push_back(std::move(changeData));
+                if (changeData.changeType != GameStateSpriteChange_t::EQUAL)
+                {
+                    res.spriteChanges.push_back(std::move(changeData));
+                }
+            }
         }
 
         return res;
@@ -738,8 +904,37 @@ struct GameStateSnapshots final : public IGameStateSnapshots
         return true;
     }
 
+    virtual size_t GetMemoryUsage() const override final
+    {
+        size_t bytes = _capturedSprites.capacity() * sizeof(rct_sprite);
+
+        std::unordered_set<const GameStateSnapshotPage_t*> pages;
+        auto addPages = [&](const GameStateSnapshotPages& snapshotPages) {
+            for (const auto& page : snapshotPages)
+            {
+                if (page != nullptr && pages.insert(page.get()).second)
+                {
+                    bytes += sizeof(GameStateSnapshotPage_t) + static_cast<size_t>(page->data.GetLength());
+                }
+            }
+        };
+        addPages(_capturedPages);
+        for (size_t i = 0; i < _snapshots.size(); i++)
+        {
+            const auto& snapshot = *_snapshots[i];
+            bytes += sizeof(GameStateSnapshot_t) + static_cast<size_t>(snapshot.storedSprites.GetLength())
+                + static_cast<size_t>(snapshot.parkParameters.GetLength());
+            addPages(snapshot.pages);
+        }
+        return bytes;
+    }
+
 private:
     CircularBuffer<std::unique_ptr<GameStateSnapshot_t>, MaximumGameStateSnapshots> _snapshots;
+
+    // Entity memory and pages of the last capture, used to find the pages that changed since then.
+    std::vector<rct_sprite> _capturedSprites = std::vector<rct_sprite>(MAX_ENTITIES);
+    GameStateSnapshotPages _capturedPages;
 };
 
 std::unique_ptr<IGameStateSnapshots> CreateGameStateSnapshots()
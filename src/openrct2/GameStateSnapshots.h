@@ -51,6 +51,7 @@ struct GameStateCompareData_t
     uint32_t tickRight;
     uint32_t srand0Left;
     uint32_t srand0Right;
+    // Only the entities that differ between the two snapshots.
     std::vector<GameStateSpriteChange_t> spriteChanges;
 };
 
@@ -108,6 +109,11 @@ struct IGameStateSnapshots
      * Generates a string of readable text from GameStateCompareData_t
      */
     virtual std::string GetCompareDataText(const GameStateCompareData_t& cmpData) const = 0;
+
+    /*
+     * Returns the bytes held by all snapshots, pages shared between snapshots are counted once.
+     */
+    virtual size_t GetMemoryUsage() const = 0;
 };
 
 std::unique_ptr<IGameStateSnapshots> CreateGameStateSnapshots();
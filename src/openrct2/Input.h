@@ -97,6 +97,7 @@ void InputWindowPositionBegin(rct_window* w, rct_widgetindex widgetIndex, const
 
 void title_handle_keyboard_input();
 void GameHandleInput();
+void GameUpdateToolAtCursor();
 void game_handle_keyboard_input();
 void GameHandleEdgeScroll();
 int32_t GetNextKey();
@@ -0,0 +1,82 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "MemoryReport.h"
+
+#include "Context.h"
+#include "GameStateSnapshots.h"
+#include "world/Map.h"
+#include "world/Sprite.h"
+
+#include <cstdio>
+
+using namespace OpenRCT2;
+
+static size_t GetSnapshotsMemoryUsage()
+{
+    auto* context = GetContext();
+    if (context == nullptr)
+    {
+        return 0;
+    }
+    auto* snapshots = context->GetGameStateSnapshots();
+    return snapshots != nullptr ? snapshots->GetMemoryUsage() : 0;
+}
+
+std::vector<MemoryReportEntry> GetMemoryReport()
+{
+    using MemoryAccounting::Category;
+
+    std::vector<MemoryReportEntry> report;
+    for (size_t i = 0; i < static_cast<size_t>(Category::Count); i++)
+    {
+        auto category = static_cast<Category>(i);
+        size_t bytes{};
+        switch (category)
+        {
+            case Category::TileElements:
+                bytes = GetTileElementsMemoryUsage();
+                break;
+            case Category::Entities:
+                bytes = GetEntitiesMemoryUsage();
+                break;
+            case Category::SpatialIndex:
+                bytes = GetSpatialIndexMemoryUsage();
+                break;
+            case Category::Snapshots:
+                bytes = GetSnapshotsMemoryUsage();
+                break;
+            default:
+                bytes = MemoryAccounting::GetTrackedBytes(category);
+                break;
+        }
+        report.push_back({ category, bytes });
+    }
+    return report;
+}
+
+std::vector<std::string> FormatMemoryReport(const std::vector<MemoryReportEntry>& report)
+{
+    constexpr double BytesPerMiB = 1024.0 * 1024.0;
+
+    std::vector<std::string> lines;
+    char buffer[128];
+    size_t total{};
+    for (const auto& entry : report)
+    {
+        std::snprintf(
+            buffer, sizeof(buffer), "%-16s %12.2f MiB", MemoryAccounting::GetCategoryName(entry.Category),
+            entry.Bytes / BytesPerMiB);
+        lines.emplace_back(buffer);
+        total += entry.Bytes;
+    }
+    std::snprintf(buffer, sizeof(buffer), "%-16s %12.2f MiB", "total", total / BytesPerMiB);
+    lines.emplace_back(buffer);
+    return lines;
+}
@@ -0,0 +1,31 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "core/MemoryAccounting.h"
+
+#include <string>
+#include <vector>
+
+struct MemoryReportEntry
+{
+    OpenRCT2::MemoryAccounting::Category Category{};
+    size_t Bytes{};
+};
+
+/**
+ * @returns the bytes held by each subsystem, measured containers and tracked allocators alike.
+ */
+std::vector<MemoryReportEntry> GetMemoryReport();
+
+/**
+ * @returns one line per subsystem and a total, as printed by the console and --memory-report.
+ */
+std::vector<std::string> FormatMemoryReport(const std::vector<MemoryReportEntry>& report);
@@ -20,6 +20,7 @@ utf8 gSilentRecordingName[MAX_PATH] = { 0 };
 
 bool gOpenRCT2Headless = false;
 bool gOpenRCT2NoGraphics = false;
+bool gOpenRCT2MemoryReport = false;
 
 bool gOpenRCT2ShowChangelog;
 bool gOpenRCT2SilentBreakpad;
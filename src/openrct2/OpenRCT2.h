@@ -45,6 +45,7 @@ extern utf8 gCustomRCT2DataPath[MAX_PATH];
 extern utf8 gCustomPassword[MAX_PATH];
 extern bool gOpenRCT2Headless;
 extern bool gOpenRCT2NoGraphics;
+extern bool gOpenRCT2MemoryReport;
 extern bool gOpenRCT2ShowChangelog;
 extern bool gOpenRCT2SilentBreakpad;
 extern utf8 gSilentRecordingName[MAX_PATH];
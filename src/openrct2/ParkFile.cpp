@@ -0,0 +1,216 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "ParkFile.h"
+
+#include "core/IStream.hpp"
+#include "core/TaskScheduler.h"
+#include "zlib.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+using namespace OpenRCT2;
+
+// Chunks are written once and read many times, favour speed over the last few percent of size.
+static constexpr int32_t ParkFileCompressionLevel = Z_BEST_SPEED;
+
+// Limits what a corrupt index can make the reader allocate.
+static constexpr uint32_t ParkFileMaxChunks = 256;
+
+bool ParkFile::IsParkFile(IStream* stream)
+{
+    auto position = stream->GetPosition();
+    if (stream->GetLength() - position < sizeof(uint32_t))
+    {
+        return false;
+    }
+    auto magic = stream->ReadValue<uint32_t>();
+    stream->SetPosition(position);
+    return magic == Magic;
+}
+
+void ParkFileWriter::AddChunk(ParkFile::ChunkId id, const void* data, size_t length)
+{
+    _chunks.push_back({ id, static_cast<const uint8_t*>(data), length });
+}
+
+void ParkFileWriter::Save(IStream* stream) const
+{
+    std::vector<std::vector<uint8_t>> compressed(_chunks.size());
+    TaskScheduler::Get().ParallelFor(0, _chunks.size(), 1, [&](size_t i) {
+        const auto& chunk = _chunks[i];
+        auto bound = compressBound(static_cast<uLong>(chunk.Length));
+        auto& buffer = compressed[i];
+        buffer.resize(bound);
+        auto compressedLength = static_cast<uLongf>(bound);
+        if (compress2(buffer.data(), &compressedLength, chunk.Data, static_cast<uLong>(chunk.Length), ParkFileCompressionLevel)
+                != Z_OK
+            || compressedLength >= chunk.Length)
+        {
+            // Store the chunk as is, an empty buffer marks it as uncompressed
+            buffer.clear();
+        }
+        else
+        {
+            buffer.resize(compressedLength);
+        }
+    });
+
+    stream->WriteValue<uint32_t>(ParkFile::Magic);
+    stream->WriteValue<uint32_t>(ParkFile::Version);
+    stream->WriteValue<uint32_t>(static_cast<uint32_t>(_chunks.size()));
+    for (size_t i = 0; i < _chunks.size(); i++)
+    {
+        bool isCompressed = !compressed[i].empty();
+        stream->WriteValue<uint32_t>(static_cast<uint32_t>(_chunks[i].Id));
+        stream->WriteValue<uint32_t>(
+            static_cast<uint32_t>(isCompressed ? ParkFile::Compression::Zlib : ParkFile::Compression::None));
+        stream->WriteValue<uint64_t>(_chunks[i].Length);
+        stream->WriteValue<uint64_t>(isCompressed ? compressed[i].size() : _chunks[i].Length);
+    }
+    for (size_t i = 0; i < _chunks.size(); i++)
+    {
+        if (compressed[i].empty())
+        {
+            stream->Write(_chunks[i].Data, _chunks[i].Length);
+        }
+        else
+        {
+            stream->Write(compressed[i].data(), compressed[i].size());
+        }
+    }
+}
+
+void ParkFileReader::Load(IStream* stream)
+{
+    if (stream->ReadValue<uint32_t>() != ParkFile::Magic)
+    {
+        throw std::runtime_error("Not a park file.");
+    }
+    auto version = stream->ReadValue<uint32_t>();
+    if (version > ParkFile::Version)
+    {
+        throw std::runtime_error("Park file version " + std::to_string(version) + " is not supported.");
+    }
+    auto numChunks = stream->ReadValue<uint32_t>();
+    if (numChunks > ParkFileMaxChunks)
+    {
+        throw std::runtime_error("Park file is corrupt.");
+    }
+
+    _chunks.clear();
+    _chunks.resize(numChunks);
+    std::vector<uint64_t> storedLengths(numChunks);
+    uint64_t totalStoredLength = 0;
+    for (uint32_t i = 0; i < numChunks; i++)
+    {
+        auto& chunk = _chunks[i];
+        chunk.Id = static_cast<ParkFile::ChunkId>(stream->ReadValue<uint32_t>());
+        chunk.Compression = static_cast<ParkFile::Compression>(stream->ReadValue<uint32_t>());
+        chunk.Length = stream->ReadValue<uint64_t>();
+        storedLengths[i] = stream->ReadValue<uint64_t>();
+        if (chunk.Compression != ParkFile::Compression::None && chunk.Compression != ParkFile::Compression::Zlib)
+        {
+            throw std::runtime_error("Park file uses an unsupported compression.");
+        }
+        totalStoredLength += storedLengths[i];
+    }
+    if (totalStoredLength > stream->GetLength() - stream->GetPosition())
+    {
+        throw std::runtime_error("Park file is truncated.");
+    }
+
+    for (uint32_t i = 0; i < numChunks; i++)
+    {
+        auto& chunk = _chunks[i];
+        chunk.Data.resize(static_cast<size_t>(storedLengths[i]));
+        stream->Read(chunk.Data.data(), chunk.Data.size());
+    }
+}
+
+bool ParkFileReader::HasChunk(ParkFile::ChunkId id) const
+{
+    return FindChunk(id) != nullptr;
+}
+
+size_t ParkFileReader::GetChunkLength(ParkFile::ChunkId id) const
+{
+    auto chunk = FindChunk(id);
+    return chunk != nullptr ? static_cast<size_t>(chunk->Length) : 0;
+}
+
+size_t ParkFileReader::ReadChunk(ParkFile::ChunkId id, void* dst, size_t capacity) const
+{
+    auto chunk = FindChunk(id);
+    if (chunk == nullptr)
+    {
+        throw std::runtime_error("Park file is missing chunk " + std::to_string(static_cast<uint32_t>(id)) + ".");
+    }
+    DecompressChunk(*chunk, dst, capacity);
+    return static_cast<size_t>(chunk->Length);
+}
+
+void ParkFileReader::ReadChunks(const std::vector<ChunkRead>& reads) const
+{
+    std::atomic<bool> failed{ false };
+    TaskScheduler::Get().ParallelFor(0, reads.size(), 1, [&](size_t i) {
+        auto chunk = FindChunk(reads[i].Id);
+        if (chunk == nullptr)
+        {
+            return;
+        }
+        try
+        {
+            DecompressChunk(*chunk, reads[i].Destination, reads[i].Capacity);
+        }
+        catch (const std::exception&)
+        {
+            failed = true;
+        }
+    });
+    if (failed)
+    {
+        throw std::runtime_error("Park file is corrupt.");
+    }
+}
+
+const ParkFileReader::Chunk* ParkFileReader::FindChunk(ParkFile::ChunkId id) const
+{
+    auto it = std::find_if(_chunks.begin(), _chunks.end(), [id](const Chunk& chunk) { return chunk.Id == id; });
+    return it != _chunks.end() ? &*it : nullptr;
+}
+
+void ParkFileReader::DecompressChunk(const Chunk& chunk, void* dst, size_t capacity)
+{
+    if (chunk.Length > capacity)
+    {
+        throw std::runtime_error("Park file chunk is too large.");
+    }
+
+    if (chunk.Compression == ParkFile::Compression::None)
+    {
+        if (chunk.Data.size() != chunk.Length)
+        {
+            throw std::runtime_error("Park file is corrupt.");
+        }
+        std::memcpy(dst, chunk.Data.data(), chunk.Data.size());
+        return;
+    }
+
+    auto length = static_cast<uLongf>(chunk.Length);
+    auto result = uncompress(static_cast<Bytef*>(dst), &length, chunk.Data.data(), static_cast<uLong>(chunk.Data.size()));
+    if (result != Z_OK || length != chunk.Length)
+    {
+        throw std::runtime_error("Park file is corrupt.");
+    }
+}
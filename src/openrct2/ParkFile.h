@@ -0,0 +1,122 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "common.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace OpenRCT2
+{
+    struct IStream;
+
+    /**
+     * The native park container. The file starts with an index of all chunks, followed by the chunks themselves which
+     * are compressed independently of each other. Chunks can therefore be compressed and decompressed in parallel and
+     * only the chunks that are needed have to be decompressed.
+     */
+    namespace ParkFile
+    {
+        constexpr uint32_t Magic = 0x4B524150; // PARK
+        constexpr uint32_t Version = 1;
+
+        enum class ChunkId : uint32_t
+        {
+            Header = 1,
+            Info = 2,
+            PackedObjects = 3,
+            Objects = 4,
+            General = 5,
+            TileElements = 6,
+            Entities = 7,
+            Park = 8,
+            Rides = 9,
+            Misc = 10,
+        };
+
+        enum class Compression : uint32_t
+        {
+            None = 0,
+            Zlib = 1,
+        };
+
+        /**
+         * Checks whether the stream contains a park file at its current position, without moving the position.
+         */
+        bool IsParkFile(IStream* stream);
+    } // namespace ParkFile
+
+    class ParkFileWriter
+    {
+    private:
+        struct Chunk
+        {
+            ParkFile::ChunkId Id{};
+            const uint8_t* Data{};
+            size_t Length{};
+        };
+
+        std::vector<Chunk> _chunks;
+
+    public:
+        /**
+         * Adds a chunk to the file, the data is not copied and has to stay valid until Save returns.
+         */
+        void AddChunk(ParkFile::ChunkId id, const void* data, size_t length);
+        void Save(IStream* stream) const;
+    };
+
+    class ParkFileReader
+    {
+    public:
+        struct ChunkRead
+        {
+            ParkFile::ChunkId Id{};
+            void* Destination{};
+            size_t Capacity{};
+        };
+
+    private:
+        struct Chunk
+        {
+            ParkFile::ChunkId Id{};
+            ParkFile::Compression Compression{};
+            uint64_t Length{};
+            std::vector<uint8_t> Data;
+        };
+
+        std::vector<Chunk> _chunks;
+
+    public:
+        /**
+         * Reads the index and the compressed chunks, the chunks are only decompressed once they are read.
+         */
+        void Load(IStream* stream);
+
+        bool HasChunk(ParkFile::ChunkId id) const;
+        size_t GetChunkLength(ParkFile::ChunkId id) const;
+
+        /**
+         * Decompresses a chunk into dst, throws if the chunk does not exist or is larger than capacity.
+         * @returns the length of the chunk.
+         */
+        size_t ReadChunk(ParkFile::ChunkId id, void* dst, size_t capacity) const;
+
+        /**
+         * Decompresses several chunks in parallel, missing chunks are skipped.
+         */
+        void ReadChunks(const std::vector<ChunkRead>& reads) const;
+
+    private:
+        const Chunk* FindChunk(ParkFile::ChunkId id) const;
+        static void DecompressChunk(const Chunk& chunk, void* dst, size_t capacity);
+    };
+} // namespace OpenRCT2
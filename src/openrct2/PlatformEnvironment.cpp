@@ -12,6 +12,7 @@
 #include "OpenRCT2.h"
 #include "config/Config.h"
 #include "core/Path.hpp"
+#include "core/StartupTimings.h"
 #include "core/String.hpp"
 #include "platform/Platform2.h"
 #include "platform/platform.h"
@@ -51,6 +52,7 @@ public:
             case DIRBASE::OPENRCT2:
             case DIRBASE::USER:
             case DIRBASE::CONFIG:
+            case DIRBASE::CACHE:
                 directoryName = DirectoryNamesOpenRCT2[static_cast<size_t>(did)];
                 break;
         }
@@ -87,6 +89,7 @@ private:
             case PATHID::CACHE_OBJECTS:
             case PATHID::CACHE_TRACKS:
             case PATHID::CACHE_SCENARIOS:
+            case PATHID::CACHE_SERVERS:
                 return DIRBASE::CACHE;
             case PATHID::MP_DAT:
                 return DIRBASE::RCT1;
@@ -163,10 +166,13 @@ std::unique_ptr<IPlatformEnvironment> OpenRCT2::CreatePlatformEnvironment()
 
     // Now load the config so we can get the RCT1 and RCT2 paths
     auto configPath = env->GetFilePath(PATHID::CONFIG);
-    config_set_defaults();
-    if (!config_open(configPath.c_str()))
     {
-        config_save(configPath.c_str());
+        StartupTimings::ScopedPhase phase("Config");
+        config_set_defaults();
+        if (!config_open(configPath.c_str()))
+        {
+            config_save(configPath.c_str());
+        }
     }
     if (String::IsNullOrEmpty(gCustomRCT1DataPath))
     {
@@ -229,6 +235,8 @@ const char * PlatformEnvironment::DirectoryNamesOpenRCT2[] =
     "replay",               // REPLAY
     "desyncs",              // DESYNCS
     "crash",                // CRASH
+    "hitches",              // LOG_HITCHES
+    "plugin",               // CACHE_PLUGIN
 };
 
 const char * PlatformEnvironment::FileNames[] =
@@ -239,6 +247,7 @@ const char * PlatformEnvironment::FileNames[] =
     "objects.idx",          // CACHE_OBJECTS
     "tracks.idx",           // CACHE_TRACKS
     "scenarios.idx",        // CACHE_SCENARIOS
+    "servers.idx",          // CACHE_SERVERS
     "Data" PATH_SEPARATOR "mp.dat", // MP_DAT
     "groups.json",          // NETWORK_GROUPS
     "servers.cfg",          // NETWORK_SERVERS
@@ -31,25 +31,27 @@ namespace OpenRCT2
 
     enum class DIRID
     {
-        DATA,        // Contains g1.dat, music etc.
-        LANDSCAPE,   // Contains scenario editor landscapes (SC6).
-        LANGUAGE,    // Contains language packs.
-        LOG_CHAT,    // Contains chat logs.
-        LOG_SERVER,  // Contains server logs.
-        NETWORK_KEY, // Contains the user's public and private keys.
-        OBJECT,      // Contains objects.
-        PLUGIN,      // Contains plugins (.js).
-        SAVE,        // Contains saved games (SV6).
-        SCENARIO,    // Contains scenarios (SC6).
-        SCREENSHOT,  // Contains screenshots.
-        SEQUENCE,    // Contains title sequences.
-        SHADER,      // Contains OpenGL shaders.
-        THEME,       // Contains interface themes.
-        TRACK,       // Contains track designs.
-        HEIGHTMAP,   // Contains heightmap data.
-        REPLAY,      // Contains recorded replays.
-        LOG_DESYNCS, // Contains desync reports.
-        CRASH,       // Contains crash dumps.
+        DATA,         // Contains g1.dat, music etc.
+        LANDSCAPE,    // Contains scenario editor landscapes (SC6).
+        LANGUAGE,     // Contains language packs.
+        LOG_CHAT,     // Contains chat logs.
+        LOG_SERVER,   // Contains server logs.
+        NETWORK_KEY,  // Contains the user's public and private keys.
+        OBJECT,       // Contains objects.
+        PLUGIN,       // Contains plugins (.js).
+        SAVE,         // Contains saved games (SV6).
+        SCENARIO,     // Contains scenarios (SC6).
+        SCREENSHOT,   // Contains screenshots.
+        SEQUENCE,     // Contains title sequences.
+        SHADER,       // Contains OpenGL shaders.
+        THEME,        // Contains interface themes.
+        TRACK,        // Contains track designs.
+        HEIGHTMAP,    // Contains heightmap data.
+        REPLAY,       // Contains recorded replays.
+        LOG_DESYNCS,  // Contains desync reports.
+        CRASH,        // Contains crash dumps.
+        LOG_HITCHES,  // Contains dumps of ticks that took too long.
+        CACHE_PLUGIN, // Contains compiled plugins.
     };
 
     enum class PATHID
@@ -60,6 +62,7 @@ namespace OpenRCT2
         CACHE_OBJECTS,           // Object repository cache (objects.idx).
         CACHE_TRACKS,            // Track repository cache (tracks.idx).
         CACHE_SCENARIOS,         // Scenario repository cache (scenarios.idx).
+        CACHE_SERVERS,           // Last fetched master server list (servers.idx).
         MP_DAT,                  // Mega Park data, Steam RCT1 only (\RCTdeluxe_install\Data\mp.dat)
         NETWORK_GROUPS,          // Server groups with permissions (groups.json).
         NETWORK_SERVERS,         // Saved servers (servers.cfg).
@@ -11,6 +11,7 @@
 
 #include "Context.h"
 #include "Game.h"
+#include "GameState.h"
 #include "GameStateSnapshots.h"
 #include "OpenRCT2.h"
 #include "ParkImporter.h"
@@ -34,7 +35,10 @@
 #include "world/Sprite.h"
 #include "zlib.h"
 
+#include <algorithm>
 #include <chrono>
+#include <deque>
+#include <future>
 #include <memory>
 #include <vector>
 
@@ -69,6 +73,17 @@ namespace OpenRCT2
         }
     };
 
+    /**
+     * The whole park at a tick of a replay, so playback can seek to a later tick without simulating the replay from its
+     * start. Holds the compressed park data, park parameters and cheats.
+     */
+    struct ReplayKeyframe
+    {
+        uint32_t tick = 0;
+        uint64_t uncompressedSize = 0;
+        OpenRCT2::MemoryStream data;
+    };
+
     struct ReplayRecordFile
     {
         uint32_t magic;
@@ -94,6 +109,10 @@ namespace OpenRCT2
         std::vector<std::pair<uint32_t, rct_sprite_checksum>> checksums;
         uint32_t checksumIndex;
         OpenRCT2::MemoryStream gameStateSnapshots;
+        std::multiset<ReplayCommand>::const_iterator nextCommand;
+        std::deque<ReplayKeyframe> keyframes;
+        // Keyframes still being compressed, declared after the keyframes so they finish before those are destroyed.
+        std::vector<std::future<void>> pendingKeyframes;
     };
 
     class ReplayManager final : public IReplayManager
@@ -103,6 +122,8 @@ namespace OpenRCT2
         static constexpr int ReplayCompressionLevel = 9;
         static constexpr int NormalRecordingChecksumTicks = 1;
         static constexpr int SilentRecordingChecksumTicks = 40; // Same as network server
+        // About five minutes of game time.
+        static constexpr uint32_t KeyframeTicks = 40 * 60 * 5;
 
         enum class ReplayMode
         {
@@ -166,6 +187,12 @@ namespace OpenRCT2
                 _nextChecksumTick = gCurrentTicks + ChecksumTicksDelta();
             }
 
+            if ((_mode == ReplayMode::RECORDING || _mode == ReplayMode::NORMALISATION) && gCurrentTicks >= _nextKeyframeTick)
+            {
+                AddKeyframe();
+                _nextKeyframeTick = gCurrentTicks + KeyframeTicks;
+            }
+
             if (_mode == ReplayMode::RECORDING)
             {
                 if (gCurrentTicks >= _currentRecording->tickEnd)
@@ -195,7 +222,7 @@ namespace OpenRCT2
                 ReplayCommands();
 
                 // If we run out of commands we can just stop
-                if (_currentReplay->commands.empty())
+                if (_currentReplay->nextCommand == _currentReplay->commands.end())
                 {
                     StopPlayback();
                     StopRecording();
@@ -267,6 +294,7 @@ namespace OpenRCT2
             _currentRecording = std::move(replayData);
             _recordType = rt;
             _nextChecksumTick = gCurrentTicks + 1;
+            _nextKeyframeTick = gCurrentTicks + KeyframeTicks;
 
             return true;
         }
@@ -292,6 +320,11 @@ namespace OpenRCT2
 
             TakeGameStateSnapshot(_currentRecording->gameStateSnapshots);
 
+            for (auto& pendingKeyframe : _currentRecording->pendingKeyframes)
+            {
+                pendingKeyframe.wait();
+            }
+
             // Serialise Body.
             DataSerialiser recSerialiser(true);
             Serialise(recSerialiser, *_currentRecording);
@@ -316,6 +349,17 @@ namespace OpenRCT2
             fileSerialiser << file.uncompressedSize;
             fileSerialiser << file.data;
 
+            // Keyframes follow the compressed body, so they can be read without decompressing each other. Older
+            // versions of the game stop reading after the body.
+            uint32_t numKeyframes = static_cast<uint32_t>(_currentRecording->keyframes.size());
+            fileSerialiser << numKeyframes;
+            for (auto& keyframe : _currentRecording->keyframes)
+            {
+                fileSerialiser << keyframe.tick;
+                fileSerialiser << keyframe.uncompressedSize;
+                fileSerialiser << keyframe.data;
+            }
+
             bool result = false;
 
             const std::string& outFile = _currentRecording->filePath;
@@ -371,6 +415,7 @@ namespace OpenRCT2
                 info.Ticks = data->tickEnd - data->tickStart;
             info.NumCommands = static_cast<uint32_t>(data->commands.size());
             info.NumChecksums = static_cast<uint32_t>(data->checksums.size());
+            info.NumKeyframes = static_cast<uint32_t>(data->keyframes.size());
 
             return true;
         }
@@ -439,6 +484,7 @@ namespace OpenRCT2
 
             _currentReplay = std::move(replayData);
             _currentReplay->checksumIndex = 0;
+            _currentReplay->nextCommand = _currentReplay->commands.begin();
             _faultyChecksumIndex = -1;
 
             // Make sure game is not paused.
@@ -455,6 +501,52 @@ namespace OpenRCT2
             return _faultyChecksumIndex != -1;
         }
 
+        virtual bool SeekPlayback(uint32_t ticks) override
+        {
+            if (_mode != ReplayMode::PLAYING)
+                return false;
+
+            auto& replay = *_currentReplay;
+            uint32_t tick = replay.tickStart + std::min(ticks, replay.tickEnd - replay.tickStart);
+
+            const ReplayKeyframe* keyframe = nullptr;
+            for (const auto& candidate : replay.keyframes)
+            {
+                if (candidate.tick <= tick)
+                    keyframe = &candidate;
+            }
+
+            // Going back always needs a reload, going forward only when a keyframe is closer than the current tick.
+            bool reload = tick < gCurrentTicks || (keyframe != nullptr && keyframe->tick > gCurrentTicks);
+            if (reload)
+            {
+                bool loaded = keyframe != nullptr ? LoadKeyframe(*keyframe) : LoadReplayDataMap(replay);
+                if (!loaded)
+                {
+                    log_error("Unable to load the replay at tick %u.", keyframe != nullptr ? keyframe->tick : replay.tickStart);
+                    return false;
+                }
+                gCurrentTicks = keyframe != nullptr ? keyframe->tick : replay.tickStart;
+
+                ReplayCommand firstCommand;
+                firstCommand.tick = gCurrentTicks;
+                replay.nextCommand = replay.commands.lower_bound(firstCommand);
+
+                auto checksum = std::lower_bound(
+                    replay.checksums.begin(), replay.checksums.end(), gCurrentTicks,
+                    [](const auto& entry, uint32_t checksumTick) { return entry.first < checksumTick; });
+                replay.checksumIndex = static_cast<uint32_t>(checksum - replay.checksums.begin());
+                _faultyChecksumIndex = -1;
+            }
+
+            auto* gameState = GetContext()->GetGameState();
+            while (gCurrentTicks < tick && IsReplaying())
+            {
+                gameState->UpdateLogic();
+            }
+            return true;
+        }
+
         virtual bool StopPlayback() override
         {
             if (_mode != ReplayMode::PLAYING && _mode != ReplayMode::NORMALISATION)
@@ -513,17 +605,97 @@ namespace OpenRCT2
             }
         }
 
+        /**
+         * Exports the park for a keyframe. The export has to happen between ticks on the game thread, the slow part
+         * of writing and compressing it is left to a background job.
+         */
+        void AddKeyframe()
+        {
+            auto exporter = std::make_shared<S6Exporter>();
+            exporter->ExportObjectsList = GetContext()->GetObjectManager().GetPackableObjects();
+            exporter->Export();
+
+            auto parkParams = std::make_shared<MemoryStream>();
+            DataSerialiser parkParamsDs(true, *parkParams);
+            SerialiseParkParameters(parkParamsDs);
+
+            auto cheatData = std::make_shared<MemoryStream>();
+            DataSerialiser cheatDataDs(true, *cheatData);
+            SerialiseCheats(cheatDataDs);
+
+            auto& keyframe = _currentRecording->keyframes.emplace_back();
+            keyframe.tick = gCurrentTicks;
+            _currentRecording->pendingKeyframes.push_back(
+                std::async(std::launch::async, [&keyframe, exporter, parkParams, cheatData]() {
+                    MemoryStream parkData;
+                    exporter->SaveGame(&parkData);
+
+                    DataSerialiser ds(true);
+                    ds << parkData;
+                    ds << *parkParams;
+                    ds << *cheatData;
+
+                    const auto& stream = ds.GetStream();
+                    uLong compressLength = compressBound(static_cast<uLong>(stream.GetLength()));
+                    auto compressBuf = std::make_unique<unsigned char[]>(compressLength);
+                    compress2(
+                        compressBuf.get(), &compressLength, static_cast<const unsigned char*>(stream.GetData()),
+                        static_cast<uLong>(stream.GetLength()), ReplayCompressionLevel);
+
+                    keyframe.uncompressedSize = stream.GetLength();
+                    keyframe.data.Write(compressBuf.get(), compressLength);
+                }));
+        }
+
+        bool LoadKeyframe(const ReplayKeyframe& keyframe)
+        {
+            auto buffer = std::make_unique<unsigned char[]>(keyframe.uncompressedSize);
+            uLong outSize = static_cast<uLong>(keyframe.uncompressedSize);
+            uncompress(
+                buffer.get(), &outSize, static_cast<const unsigned char*>(keyframe.data.GetData()),
+                static_cast<uLong>(keyframe.data.GetLength()));
+            if (outSize != keyframe.uncompressedSize)
+            {
+                return false;
+            }
+
+            MemoryStream parkData;
+            MemoryStream parkParams;
+            MemoryStream cheatData;
+            try
+            {
+                MemoryStream stream(buffer.get(), outSize);
+                DataSerialiser ds(false, stream);
+                ds << parkData;
+                ds << parkParams;
+                ds << cheatData;
+            }
+            catch (const std::exception& ex)
+            {
+                log_error("Exception: %s", ex.what());
+                return false;
+            }
+            return LoadReplayState(parkData, parkParams, cheatData);
+        }
+
         bool LoadReplayDataMap(ReplayRecordData& data)
+        {
+            return LoadReplayState(data.parkData, data.parkParams, data.cheatData);
+        }
+
+        bool LoadReplayState(MemoryStream& parkData, MemoryStream& parkParams, MemoryStream& cheatData)
         {
             try
             {
-                data.parkData.SetPosition(0);
+                parkData.SetPosition(0);
+                parkParams.SetPosition(0);
+                cheatData.SetPosition(0);
 
                 auto context = GetContext();
                 auto& objManager = context->GetObjectManager();
                 auto importer = ParkImporter::CreateS6(context->GetObjectRepository());
 
-                auto loadResult = importer->LoadFromStream(&data.parkData, false);
+                auto loadResult = importer->LoadFromStream(&parkData, false);
                 objManager.LoadObjects(loadResult.RequiredObjects.data(), loadResult.RequiredObjects.size());
 
                 importer->Import();
@@ -531,13 +703,13 @@ namespace OpenRCT2
                 EntityTweener::Get().Reset();
 
                 // Load all map global variables.
-                DataSerialiser parkParamsDs(false, data.parkParams);
+                DataSerialiser parkParamsDs(false, parkParams);
                 SerialiseParkParameters(parkParamsDs);
 
                 // New cheats might not be serialised, make sure they are using their defaults.
                 CheatsReset();
 
-                DataSerialiser cheatDataDs(false, data.cheatData);
+                DataSerialiser cheatDataDs(false, cheatData);
                 SerialiseCheats(cheatDataDs);
 
                 game_load_init();
@@ -575,7 +747,7 @@ namespace OpenRCT2
          * @param stream
          * @return
          */
-        bool TryDecompress(MemoryStream& stream)
+        bool TryDecompress(MemoryStream& stream, ReplayRecordData& data)
         {
             ReplayRecordFile recFile;
             stream.SetPosition(0);
@@ -588,6 +760,20 @@ namespace OpenRCT2
                 fileSerializer << recFile.uncompressedSize;
                 fileSerializer << recFile.data;
 
+                // Replays recorded before keyframes were added end after the body.
+                if (stream.GetPosition() < stream.GetLength())
+                {
+                    uint32_t numKeyframes = 0;
+                    fileSerializer << numKeyframes;
+                    for (uint32_t i = 0; i < numKeyframes; i++)
+                    {
+                        auto& keyframe = data.keyframes.emplace_back();
+                        fileSerializer << keyframe.tick;
+                        fileSerializer << keyframe.uncompressedSize;
+                        fileSerializer << keyframe.data;
+                    }
+                }
+
                 auto buff = std::make_unique<unsigned char[]>(recFile.uncompressedSize);
                 unsigned long outSize = recFile.uncompressedSize;
                 uncompress(
@@ -631,7 +817,7 @@ namespace OpenRCT2
             if (!loaded)
                 return false;
 
-            if (!TryDecompress(stream))
+            if (!TryDecompress(stream, data))
                 return false;
 
             stream.SetPosition(0);
@@ -825,10 +1011,11 @@ namespace OpenRCT2
         void ReplayCommands()
         {
             auto& replayQueue = _currentReplay->commands;
+            auto& nextCommand = _currentReplay->nextCommand;
 
-            while (replayQueue.begin() != replayQueue.end())
+            while (nextCommand != replayQueue.end())
             {
-                const ReplayCommand& command = (*replayQueue.begin());
+                const ReplayCommand& command = *nextCommand;
 
                 if (_mode == ReplayMode::PLAYING)
                 {
@@ -864,7 +1051,8 @@ namespace OpenRCT2
                         window_scroll_to_location(mainWindow, result->Position);
                 }
 
-                replayQueue.erase(replayQueue.begin());
+                // Commands are kept so playback can seek back to an earlier tick.
+                nextCommand++;
             }
         }
 
@@ -876,6 +1064,7 @@ namespace OpenRCT2
         uint32_t _commandId = 0;
         uint32_t _nextChecksumTick = 0;
         uint32_t _nextReplayTick = 0;
+        uint32_t _nextKeyframeTick = 0;
         RecordType _recordType = RecordType::NORMAL;
     };
 
@@ -28,6 +28,7 @@ namespace OpenRCT2
         uint64_t TimeRecorded;
         uint32_t NumCommands;
         uint32_t NumChecksums;
+        uint32_t NumKeyframes;
         std::string Name;
         std::string FilePath;
     };
@@ -60,6 +61,11 @@ namespace OpenRCT2
 
         virtual bool StartPlayback(const std::string& file) = 0;
         virtual bool IsPlaybackStateMismatching() const = 0;
+        /**
+         * Moves playback to the given number of ticks since the start of the replay, by loading the closest keyframe
+         * before it and simulating the remaining ticks. Must not be called during a game tick.
+         */
+        virtual bool SeekPlayback(uint32_t ticks) = 0;
         virtual bool StopPlayback() = 0;
 
         virtual bool NormaliseReplay(const std::string& inputFile, const std::string& outputFile) = 0;
@@ -0,0 +1,225 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TickWatchdog.h"
+
+#include "Context.h"
+#include "Game.h"
+#include "GameStateSnapshots.h"
+#include "PlatformEnvironment.h"
+#include "actions/GameAction.h"
+#include "config/Config.h"
+#include "core/DataSerialiser.h"
+#include "core/File.h"
+#include "core/FileScanner.h"
+#include "core/FileStream.h"
+#include "core/Path.hpp"
+#include "platform/platform.h"
+#include "scenario/Scenario.h"
+#include "scripting/ScriptEngine.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace OpenRCT2;
+
+// A slow tick is often followed by more of them, and writing a dump takes long enough to cause the next one.
+static constexpr Profiling::Timestamp HitchDumpCooldown = 30ULL * 1000 * 1000 * 1000;
+
+static constexpr double NanosecondsPerMillisecond = 1000.0 * 1000.0;
+
+namespace
+{
+    struct RecordedGameAction
+    {
+        std::string Name;
+        int32_t Player{};
+        uint32_t Flags{};
+        GameActions::Status Status{};
+        double TimeMs{};
+    };
+} // namespace
+
+// Only touched on the game thread.
+static bool _inTick;
+static std::vector<RecordedGameAction> _tickActions;
+static bool _hasDumped;
+static Profiling::Timestamp _lastDump;
+
+// Snapshots of hitches are kept apart from the network snapshots, so they never push out a snapshot a desync report needs.
+static std::unique_ptr<IGameStateSnapshots> _snapshots;
+
+static void WriteSnapshot(const std::string& path, uint32_t tick)
+{
+    if (_snapshots == nullptr)
+    {
+        _snapshots = CreateGameStateSnapshots();
+    }
+    _snapshots->Reset();
+
+    auto& snapshot = _snapshots->CreateSnapshot();
+    _snapshots->Capture(snapshot);
+    _snapshots->LinkSnapshot(snapshot, tick, scenario_rand_state().s0);
+
+    FileStream stream(path, FILE_MODE_WRITE);
+    DataSerialiser ds(true, stream);
+    _snapshots->SerialiseSnapshot(snapshot, ds);
+}
+
+static void WriteReport(const std::string& path, uint32_t tick, double timeMs)
+{
+    auto* fp = std::fopen(path.c_str(), "wt");
+    if (fp == nullptr)
+    {
+        throw std::runtime_error("Unable to open " + path);
+    }
+
+    std::fprintf(fp, "Tick %u took %.3f ms, the threshold is %d ms.\n", tick, timeMs, gConfigGeneral.tick_watchdog_threshold);
+
+    // Zones that ended during the tick, the trace next to this report has the zones of all threads around it.
+    auto window = std::chrono::milliseconds(static_cast<int64_t>(std::ceil(timeMs)) + 1);
+    std::fprintf(fp, "\nProfiler zones:\n");
+    std::fprintf(fp, "%-32s %8s %10s %10s\n", "Zone", "Calls", "p50 ms", "Max ms");
+    for (const auto& zone : Profiling::GetZoneStatistics(window))
+    {
+        std::fprintf(fp, "%-32s %8zu %10.3f %10.3f\n", zone.Name.c_str(), zone.Count, zone.P50Ms, zone.MaxMs);
+    }
+
+    std::fprintf(fp, "\nGame actions (%zu):\n", _tickActions.size());
+    std::fprintf(fp, "%-32s %8s %10s %8s %10s\n", "Action", "Player", "Flags", "Status", "Time ms");
+    for (const auto& action : _tickActions)
+    {
+        std::fprintf(
+            fp, "%-32s %8d 0x%08X %8d %10.3f\n", action.Name.c_str(), action.Player, action.Flags,
+            static_cast<int32_t>(action.Status), action.TimeMs);
+    }
+
+#ifdef ENABLE_SCRIPTING
+    // The plugin counters are totals since they were last reset, compare two dumps to single out a tick.
+    std::fprintf(fp, "\nPlugins:\n");
+    std::fprintf(fp, "%-32s %-32s %10s %10s %10s\n", "Plugin", "Category", "Calls", "Total ms", "Max ms");
+    for (const auto& counter : GetContext()->GetScriptEngine().GetPerformanceStats())
+    {
+        std::fprintf(
+            fp, "%-32s %-32s %10" PRIu64 " %10.3f %10.3f\n", counter.Plugin.c_str(), counter.Category.c_str(),
+            counter.Calls, counter.TotalTime.count() / NanosecondsPerMillisecond,
+            counter.MaxTime.count() / NanosecondsPerMillisecond);
+    }
+#endif
+
+    std::fclose(fp);
+}
+
+// Removes the oldest dumps, every dump is a group of files sharing the name of its report.
+static void RemoveOldDumps(const std::string& directory)
+{
+    std::vector<std::string> reports;
+    auto scanner = Path::ScanDirectory(Path::Combine(directory, "hitch_*.txt"), false);
+    while (scanner->Next())
+    {
+        reports.push_back(scanner->GetPath());
+    }
+
+    auto maxDumps = static_cast<size_t>(std::max(gConfigGeneral.tick_watchdog_max_dumps, 1));
+    if (reports.size() <= maxDumps)
+    {
+        return;
+    }
+
+    // Names start with the time of the hitch, so they sort from old to new.
+    std::sort(reports.begin(), reports.end());
+    for (size_t i = 0; i < reports.size() - maxDumps; i++)
+    {
+        auto stem = reports[i].substr(0, reports[i].size() - 4);
+        File::Delete(reports[i]);
+        File::Delete(stem + ".trace.json");
+        File::Delete(stem + ".snapshot");
+    }
+}
+
+static void DumpHitch(uint32_t tick, double timeMs)
+{
+    auto env = GetContext()->GetPlatformEnvironment();
+    auto directory = env->GetDirectoryPath(DIRBASE::USER, DIRID::LOG_HITCHES);
+    if (!platform_ensure_directory_exists(directory.c_str()))
+    {
+        log_error("Unable to create directory '%s'.", directory.c_str());
+        return;
+    }
+
+    char name[64];
+    std::snprintf(
+        name, sizeof(name), "hitch_%020" PRIu64 "_%u", static_cast<uint64_t>(platform_get_datetime_now_utc()), tick);
+    auto stem = Path::Combine(directory, name);
+
+    WriteReport(stem + ".txt", tick, timeMs);
+    Profiling::ExportChromeTrace(stem + ".trace.json");
+    WriteSnapshot(stem + ".snapshot", tick);
+    RemoveOldDumps(directory);
+
+    log_warning("Tick %u took %.1f ms, wrote hitch dump '%s'.", tick, timeMs, stem.c_str());
+}
+
+TickWatchdog::ScopedTick::ScopedTick()
+{
+    if (gConfigGeneral.tick_watchdog_threshold <= 0)
+    {
+        return;
+    }
+
+    _active = true;
+    _tick = gCurrentTicks;
+    _start = Profiling::GetTimestamp();
+    _inTick = true;
+    _tickActions.clear();
+}
+
+TickWatchdog::ScopedTick::~ScopedTick()
+{
+    if (!_active)
+    {
+        return;
+    }
+    _inTick = false;
+
+    auto end = Profiling::GetTimestamp();
+    auto timeMs = (end - _start) / NanosecondsPerMillisecond;
+    if (timeMs < gConfigGeneral.tick_watchdog_threshold || (_hasDumped && end - _lastDump < HitchDumpCooldown))
+    {
+        return;
+    }
+
+    try
+    {
+        DumpHitch(_tick, timeMs);
+    }
+    catch (const std::exception& e)
+    {
+        log_error("Unable to write hitch dump: %s", e.what());
+    }
+    _hasDumped = true;
+    _lastDump = Profiling::GetTimestamp();
+}
+
+void TickWatchdog::RecordGameAction(
+    const GameAction& action, const GameActions::Result& result, Profiling::Timestamp start, Profiling::Timestamp end)
+{
+    if (!_inTick)
+    {
+        return;
+    }
+    _tickActions.push_back(
+        { action.GetName(), action.GetPlayer().id, action.GetFlags(), result.Error, (end - start) / NanosecondsPerMillisecond });
+}
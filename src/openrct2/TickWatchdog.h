@@ -0,0 +1,50 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "core/Profiling.h"
+
+#include <cstdint>
+
+struct GameAction;
+namespace GameActions
+{
+    class Result;
+}
+
+/**
+ * Looks out for ticks that take longer than the tick_watchdog_threshold setting and dumps what happened during them to
+ * the hitches directory: the profiler zones, the game actions that were executed, the time spent in plugins and a
+ * snapshot of the entities. Only the last tick_watchdog_max_dumps hitches are kept.
+ */
+namespace OpenRCT2::TickWatchdog
+{
+    /**
+     * Watches the tick that runs during the lifetime of the object.
+     */
+    class ScopedTick
+    {
+    private:
+        bool _active{};
+        uint32_t _tick{};
+        Profiling::Timestamp _start{};
+
+    public:
+        ScopedTick();
+        ScopedTick(const ScopedTick&) = delete;
+        ~ScopedTick();
+    };
+
+    /**
+     * Remembers an executed action for the dump of the current tick, does nothing when the watchdog is disabled.
+     */
+    void RecordGameAction(
+        const GameAction& action, const GameActions::Result& result, Profiling::Timestamp start, Profiling::Timestamp end);
+} // namespace OpenRCT2::TickWatchdog
@@ -17,6 +17,7 @@
 #include "../world/LargeScenery.h"
 #include "../world/Location.hpp"
 #include "../world/Map.h"
+#include "../world/Scenery.h"
 #include "FootpathRemoveAction.h"
 #include "LargeSceneryRemoveAction.h"
 #include "SmallSceneryRemoveAction.h"
@@ -69,6 +70,7 @@ GameActions::Result::Ptr ClearAction::QueryExecute(bool executing) const
     auto error = GameActions::Status::Ok;
     rct_string_id errorMessage = STR_NONE;
     money32 totalCost = 0;
+    LargeSceneryVisitedSet visitedLargeScenery;
 
     auto x0 = std::max(_range.GetLeft(), 32);
     auto y0 = std::max(_range.GetTop(), 32);
@@ -81,7 +83,7 @@ GameActions::Result::Ptr ClearAction::QueryExecute(bool executing) const
         {
             if (LocationValid({ x, y }) && MapCanClearAt({ x, y }))
             {
-                auto cost = ClearSceneryFromTile({ x, y }, executing);
+                auto cost = ClearSceneryFromTile({ x, y }, executing, visitedLargeScenery);
                 if (cost != MONEY32_UNDEFINED)
                 {
                     noValidTiles = false;
@@ -96,11 +98,6 @@ GameActions::Result::Ptr ClearAction::QueryExecute(bool executing) const
         }
     }
 
-    if (_itemsToClear & CLEARABLE_ITEMS::SCENERY_LARGE)
-    {
-        ResetClearLargeSceneryFlag();
-    }
-
     if (noValidTiles)
     {
         result->Error = error;
@@ -111,7 +108,8 @@ GameActions::Result::Ptr ClearAction::QueryExecute(bool executing) const
     return result;
 }
 
-money32 ClearAction::ClearSceneryFromTile(const CoordsXY& tilePos, bool executing) const
+money32 ClearAction::ClearSceneryFromTile(
+    const CoordsXY& tilePos, bool executing, LargeSceneryVisitedSet& visitedLargeScenery) const
 {
     // Pass down all flags.
     TileElement* tileElement = nullptr;
@@ -183,7 +181,8 @@ money32 ClearAction::ClearSceneryFromTile(const CoordsXY& tilePos, bool executin
                     }
                     break;
                 case TILE_ELEMENT_TYPE_LARGE_SCENERY:
-                    if (_itemsToClear & CLEARABLE_ITEMS::SCENERY_LARGE)
+                    if ((_itemsToClear & CLEARABLE_ITEMS::SCENERY_LARGE)
+                        && VisitLargeScenery(tilePos, *tileElement->AsLargeScenery(), visitedLargeScenery))
                     {
                         auto removeSceneryAction = LargeSceneryRemoveAction(
                             { tilePos, tileElement->GetBaseZ(), tileElement->GetDirection() },
@@ -207,25 +206,18 @@ money32 ClearAction::ClearSceneryFromTile(const CoordsXY& tilePos, bool executin
     return totalCost;
 }
 
-void ClearAction::ResetClearLargeSceneryFlag()
+bool ClearAction::VisitLargeScenery(
+    const CoordsXY& tilePos, const LargeSceneryElement& sceneryElement, LargeSceneryVisitedSet& visitedLargeScenery)
 {
-    // TODO: Improve efficiency of this
-    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
-    {
-        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
-        {
-            auto tileElement = map_get_first_element_at(TileCoordsXY{ x, y }.ToCoordsXY());
-            do
-            {
-                if (tileElement == nullptr)
-                    break;
-                if (tileElement->GetType() == TILE_ELEMENT_TYPE_LARGE_SCENERY)
-                {
-                    tileElement->AsLargeScenery()->SetIsAccounted(false);
-                }
-            } while (!(tileElement++)->IsLastForTile());
-        }
-    }
+    auto* sceneryEntry = sceneryElement.GetEntry();
+    if (sceneryEntry == nullptr)
+        return true;
+
+    const auto direction = sceneryElement.GetDirection();
+    const auto& tile = sceneryEntry->tiles[sceneryElement.GetSequenceIndex()];
+    auto origin = tilePos - CoordsXY{ tile.x_offset, tile.y_offset }.Rotate(direction);
+    auto originZ = sceneryElement.GetBaseZ() - tile.z_offset;
+    return visitedLargeScenery.emplace(origin.x, origin.y, originZ, direction, sceneryElement.GetEntryIndex()).second;
 }
 
 bool ClearAction::MapCanClearAt(const CoordsXY& location)
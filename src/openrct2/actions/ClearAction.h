@@ -13,6 +13,9 @@
 #include "../management/Finance.h"
 #include "GameAction.h"
 
+#include <set>
+#include <tuple>
+
 using namespace OpenRCT2;
 
 using ClearableItems = uint8_t;
@@ -24,6 +27,9 @@ namespace CLEARABLE_ITEMS
     constexpr ClearableItems SCENERY_FOOTPATH = 1 << 2;
 } // namespace CLEARABLE_ITEMS
 
+// The origin tile, base height, direction and entry of each large scenery an action has come across.
+using LargeSceneryVisitedSet = std::set<std::tuple<int32_t, int32_t, int32_t, Direction, ObjectEntryIndex>>;
+
 DEFINE_GAME_ACTION(ClearAction, GameCommand::ClearScenery, GameActions::Result)
 {
 private:
@@ -41,13 +47,14 @@ public:
 private:
     GameActions::Result::Ptr CreateResult() const;
     GameActions::Result::Ptr QueryExecute(bool executing) const;
-    money32 ClearSceneryFromTile(const CoordsXY& tilePos, bool executing) const;
+    money32 ClearSceneryFromTile(const CoordsXY& tilePos, bool executing, LargeSceneryVisitedSet& visitedLargeScenery) const;
 
     /**
-     * Function to clear the flag that is set to prevent cost duplication
-     * when using the clear scenery tool with large scenery.
+     * Returns false if the large scenery has already been accounted for by this action, to prevent cost duplication
+     * when the cleared area overlaps multiple tiles of the same large scenery.
      */
-    static void ResetClearLargeSceneryFlag();
+    static bool VisitLargeScenery(
+        const CoordsXY& tilePos, const LargeSceneryElement& sceneryElement, LargeSceneryVisitedSet& visitedLargeScenery);
 
     static bool MapCanClearAt(const CoordsXY& location);
 };
@@ -141,12 +141,19 @@ GameActions::Result::Ptr FootpathPlaceAction::Execute() const
     auto tileElement = map_get_footpath_element_slope(_loc, _slope);
     if (tileElement == nullptr)
     {
-        return ElementInsertExecute(std::move(res));
+        res = ElementInsertExecute(std::move(res));
     }
     else
     {
-        return ElementUpdateExecute(tileElement, std::move(res));
+        res = ElementUpdateExecute(tileElement, std::move(res));
     }
+
+    // Ghosts only exist on this client, they must not change the paths around them
+    if (res->Error == GameActions::Status::Ok && !(GetFlags() & GAME_COMMAND_FLAG_GHOST))
+    {
+        footpath_update_path_wide_flags_around(_loc);
+    }
+    return res;
 }
 
 GameActions::Result::Ptr FootpathPlaceAction::ElementUpdateQuery(PathElement* pathElement, GameActions::Result::Ptr res) const
@@ -97,6 +97,10 @@ GameActions::Result::Ptr FootpathRemoveAction::Execute() const
         map_invalidate_tile_full(_loc);
         tile_element_remove(footpathElement);
         footpath_update_queue_chains();
+        if (!(GetFlags() & GAME_COMMAND_FLAG_GHOST))
+        {
+            footpath_update_path_wide_flags_around(_loc);
+        }
 
         // Remove the spawn point (if there is one in the current tile)
         gPeepSpawns.erase(
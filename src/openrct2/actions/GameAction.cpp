@@ -11,6 +11,7 @@
 
 #include "../Context.h"
 #include "../ReplayManager.h"
+#include "../TickWatchdog.h"
 #include "../core/Guard.hpp"
 #include "../core/Memory.hpp"
 #include "../core/MemoryStream.h"
@@ -29,11 +30,80 @@
 
 #include <algorithm>
 #include <iterator>
+#include <optional>
 
 using namespace OpenRCT2;
 
 namespace GameActions
 {
+    static constexpr size_t ResultBlockSize = 64;
+    static constexpr size_t ResultBlockClasses = 4;
+    static constexpr size_t MaxPooledResultsPerClass = 32;
+
+    struct ResultPool
+    {
+        std::array<std::array<void*, MaxPooledResultsPerClass>, ResultBlockClasses> Blocks{};
+        std::array<size_t, ResultBlockClasses> Count{};
+
+        ~ResultPool();
+    };
+
+    static thread_local ResultPool _resultPool;
+    // Trivially destructible, so it can still be read while the pool of an exiting thread is being torn down.
+    static thread_local bool _resultPoolDestroyed;
+
+    ResultPool::~ResultPool()
+    {
+        for (size_t i = 0; i < ResultBlockClasses; i++)
+        {
+            for (size_t j = 0; j < Count[i]; j++)
+            {
+                ::operator delete(Blocks[i][j]);
+            }
+            Count[i] = 0;
+        }
+        _resultPoolDestroyed = true;
+    }
+
+    static constexpr size_t GetResultBlockClass(size_t size)
+    {
+        return (size + ResultBlockSize - 1) / ResultBlockSize - 1;
+    }
+
+    void* Result::operator new(size_t size)
+    {
+        const auto blockClass = GetResultBlockClass(size);
+        if (blockClass >= ResultBlockClasses)
+        {
+            return ::operator new(size);
+        }
+
+        if (!_resultPoolDestroyed)
+        {
+            auto& count = _resultPool.Count[blockClass];
+            if (count != 0)
+            {
+                return _resultPool.Blocks[blockClass][--count];
+            }
+        }
+        return ::operator new((blockClass + 1) * ResultBlockSize);
+    }
+
+    void Result::operator delete(void* ptr, size_t size)
+    {
+        const auto blockClass = GetResultBlockClass(size);
+        if (blockClass < ResultBlockClasses && !_resultPoolDestroyed)
+        {
+            auto& count = _resultPool.Count[blockClass];
+            if (count < MaxPooledResultsPerClass)
+            {
+                _resultPool.Blocks[blockClass][count++] = ptr;
+                return;
+            }
+        }
+        ::operator delete(ptr);
+    }
+
     Result::Result(GameActions::Status error, rct_string_id message)
     {
         Error = error;
@@ -87,11 +157,13 @@ namespace GameActions
     {
         uint32_t tick;
         uint32_t uniqueId;
+        uint32_t queuedTime;
         GameAction::Ptr action;
 
         explicit QueuedGameAction(uint32_t t, std::unique_ptr<GameAction>&& ga, uint32_t id)
             : tick(t)
             , uniqueId(id)
+            , queuedTime(platform_get_ticks())
             , action(std::move(ga))
         {
         }
@@ -113,6 +185,21 @@ namespace GameActions
     static std::multiset<QueuedGameAction> _actionQueue;
     static uint32_t _nextUniqueId = 0;
     static bool _suspended = false;
+    static QueueStats _queueStats;
+
+    static void RecordQueueWaitTime(uint32_t waitTime)
+    {
+        _queueStats.Processed++;
+        _queueStats.TotalWaitTime += waitTime;
+        _queueStats.MaxWaitTime = std::max(_queueStats.MaxWaitTime, waitTime);
+
+        size_t bucket = 0;
+        while (bucket < QueueStats::HistogramSize - 1 && waitTime >= (1u << bucket))
+        {
+            bucket++;
+        }
+        _queueStats.WaitHistogram[bucket]++;
+    }
 
     GameActionFactory Register(GameCommand id, GameActionFactory factory)
     {
@@ -219,6 +306,7 @@ namespace GameActions
                 network_send_game_action(action);
             }
 
+            RecordQueueWaitTime(platform_get_ticks() - queued.queuedTime);
             _actionQueue.erase(_actionQueue.begin());
         }
     }
@@ -228,6 +316,13 @@ namespace GameActions
         _actionQueue.clear();
     }
 
+    QueueStats GetQueueStats()
+    {
+        auto stats = _queueStats;
+        stats.Depth = _actionQueue.size();
+        return stats;
+    }
+
     void Initialize()
     {
         static bool initialized = false;
@@ -340,14 +435,18 @@ namespace GameActions
         return "sp";
     }
 
+    // Actions can execute other actions, so every level of nesting takes its own log stream from the pool.
+    static MemoryStreamPool _actionLogPool;
+    static constexpr size_t ActionLogCapacityHint = 256;
+
     struct ActionLogContext_t
     {
-        MemoryStream output;
+        PooledMemoryStream output{ _actionLogPool, ActionLogCapacityHint };
     };
 
     static void LogActionBegin(ActionLogContext_t& ctx, const GameAction* action)
     {
-        MemoryStream& output = ctx.output;
+        MemoryStream& output = *ctx.output;
 
         char temp[128] = {};
         snprintf(
@@ -356,7 +455,7 @@ namespace GameActions
 
         output.Write(temp, strlen(temp));
 
-        DataSerialiser ds(true, ctx.output, true); // Logging mode.
+        DataSerialiser ds(true, output, true); // Logging mode.
 
         // Write all parameters into output as text.
         action->Serialise(ds);
@@ -364,7 +463,7 @@ namespace GameActions
 
     static void LogActionFinish(ActionLogContext_t& ctx, const GameAction* action, const GameActions::Result::Ptr& result)
     {
-        MemoryStream& output = ctx.output;
+        MemoryStream& output = *ctx.output;
 
         char temp[128] = {};
 
@@ -449,10 +548,17 @@ namespace GameActions
                 }
             }
 
-            ActionLogContext_t logContext;
-            LogActionBegin(logContext, action);
+            // Tools place and remove ghosts on every cursor move and they never leave this client, so they are only
+            // described in the log when verbose logging is enabled.
+            std::optional<ActionLogContext_t> logContext;
+            if (!(flags & GAME_COMMAND_FLAG_GHOST) || _log_levels[EnumValue(DiagnosticLevel::Verbose)])
+            {
+                logContext.emplace();
+                LogActionBegin(*logContext, action);
+            }
 
             // Execute the action, changing the game state
+            auto executeStart = OpenRCT2::Profiling::GetTimestamp();
             result = action->Execute();
 #ifdef ENABLE_SCRIPTING
             if (result->Error == GameActions::Status::Ok)
@@ -463,7 +569,11 @@ namespace GameActions
             }
 #endif
 
-            LogActionFinish(logContext, action, result);
+            if (logContext.has_value())
+            {
+                LogActionFinish(*logContext, action, result);
+            }
+            OpenRCT2::TickWatchdog::RecordGameAction(*action, *result, executeStart, OpenRCT2::Profiling::GetTimestamp());
 
             // If not top level just give away the result.
             if (!topLevel)
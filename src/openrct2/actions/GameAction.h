@@ -140,6 +140,11 @@ namespace GameActions
 
         std::string GetErrorTitle() const;
         std::string GetErrorMessage() const;
+
+        // Results are created and destroyed for every query, nested action and tile of an area tool, so they are
+        // recycled through a small per thread pool rather than going through the allocator each time.
+        static void* operator new(size_t size);
+        static void operator delete(void* ptr, size_t size);
     };
 
     class ConstructClearResult final : public Result
@@ -400,6 +405,21 @@ namespace GameActions
     void ProcessQueue();
     void ClearQueue();
 
+    // Real time the queued actions waited before they got executed, in milliseconds.
+    struct QueueStats
+    {
+        static constexpr size_t HistogramSize = 12;
+
+        size_t Depth{};
+        uint64_t Processed{};
+        uint64_t TotalWaitTime{};
+        uint32_t MaxWaitTime{};
+        // Bucket 0 counts the waits below 1 ms, bucket i those below 2^i ms not counted before. The last bucket also
+        // counts all longer waits.
+        std::array<uint64_t, HistogramSize> WaitHistogram{};
+    };
+    QueueStats GetQueueStats();
+
     GameAction::Ptr Create(GameCommand id);
     GameAction::Ptr Clone(const GameAction* action);
 
@@ -68,6 +68,7 @@
 #include "SignSetStyleAction.h"
 #include "SmallSceneryPlaceAction.h"
 #include "SmallSceneryRemoveAction.h"
+#include "SmallSceneryScatterAction.h"
 #include "SmallScenerySetColourAction.h"
 #include "StaffFireAction.h"
 #include "StaffHireNewAction.h"
@@ -147,6 +148,7 @@ namespace GameActions
         Register<WallRemoveAction>();
         Register<WallSetColourAction>();
         Register<SmallSceneryPlaceAction>();
+        Register<SmallSceneryScatterAction>();
         Register<SmallSceneryRemoveAction>();
         Register<SmallScenerySetColourAction>();
         Register<LargeSceneryPlaceAction>();
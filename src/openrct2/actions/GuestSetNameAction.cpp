@@ -97,6 +97,7 @@ GameActions::Result::Ptr GuestSetNameAction::Execute() const
     gfx_invalidate_screen();
 
     auto intent = Intent(INTENT_ACTION_REFRESH_GUEST_LIST);
+    intent.putExtra(INTENT_EXTRA_PEEP, guest);
     context_broadcast_intent(&intent);
 
     auto res = std::make_unique<GameActions::Result>();
@@ -49,6 +49,7 @@ GameActions::Result::Ptr LandLowerAction::Query() const
 
 GameActions::Result::Ptr LandLowerAction::Execute() const
 {
+    MapInvalidationBatch invalidationBatch;
     return QueryExecute(true);
 }
 
@@ -50,6 +50,7 @@ GameActions::Result::Ptr LandRaiseAction::Query() const
 
 GameActions::Result::Ptr LandRaiseAction::Execute() const
 {
+    MapInvalidationBatch invalidationBatch;
     return QueryExecute(true);
 }
 
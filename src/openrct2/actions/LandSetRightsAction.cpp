@@ -60,6 +60,7 @@ GameActions::Result::Ptr LandSetRightsAction::Query() const
 
 GameActions::Result::Ptr LandSetRightsAction::Execute() const
 {
+    MapInvalidationBatch invalidationBatch;
     return QueryExecute(true);
 }
 
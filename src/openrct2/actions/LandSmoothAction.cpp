@@ -52,6 +52,7 @@ GameActions::Result::Ptr LandSmoothAction::Query() const
 
 GameActions::Result::Ptr LandSmoothAction::Execute() const
 {
+    MapInvalidationBatch invalidationBatch;
     return SmoothLand(true);
 }
 
@@ -52,8 +52,6 @@ GameActions::Result::Ptr LargeSceneryRemoveAction::Query() const
 {
     GameActions::Result::Ptr res = std::make_unique<GameActions::Result>();
 
-    const uint32_t flags = GetFlags();
-
     int32_t z = tile_element_height(_loc);
     res->Position.x = _loc.x + 16;
     res->Position.y = _loc.y + 16;
@@ -80,7 +78,6 @@ GameActions::Result::Ptr LargeSceneryRemoveAction::Query() const
 
     auto firstTile = CoordsXYZ{ _loc.x, _loc.y, _loc.z } - rotatedOffsets;
 
-    bool calculate_cost = true;
     for (int32_t i = 0; sceneryEntry->tiles[i].x_offset != -1; i++)
     {
         auto currentTileRotatedOffset = CoordsXYZ{
@@ -102,20 +99,9 @@ GameActions::Result::Ptr LargeSceneryRemoveAction::Query() const
         {
             return MakeResult(GameActions::Status::NoClearance, STR_CANT_REMOVE_THIS, STR_LAND_NOT_OWNED_BY_PARK);
         }
-        // Prevent duplicate costs when using the clear scenery tool that overlaps multiple large
-        // scenery tile elements.
-        if (flags & GAME_COMMAND_FLAG_PATH_SCENERY)
-        {
-            if (tileElement->AsLargeScenery()->IsAccounted())
-                calculate_cost = false;
-
-            // Sets the flag to prevent this being counted in additional calls
-            tileElement->AsLargeScenery()->SetIsAccounted(true);
-        }
     }
 
-    if (calculate_cost)
-        res->Cost = sceneryEntry->removal_price * 10;
+    res->Cost = sceneryEntry->removal_price * 10;
 
     return res;
 }
@@ -0,0 +1,200 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "SmallSceneryScatterAction.h"
+
+#include "../localisation/StringIds.h"
+#include "../management/Finance.h"
+#include "../world/Map.h"
+#include "../world/SmallScenery.h"
+#include "SmallSceneryPlaceAction.h"
+
+#include <random>
+
+SmallSceneryScatterAction::SmallSceneryScatterAction(
+    const CoordsXYZD& loc, uint8_t quadrant, ObjectEntryIndex sceneryType, uint8_t primaryColour, uint8_t secondaryColour,
+    uint16_t size, uint16_t quantity, uint32_t seed, uint8_t zAttemptRange)
+    : _loc(loc)
+    , _quadrant(quadrant)
+    , _sceneryType(sceneryType)
+    , _primaryColour(primaryColour)
+    , _secondaryColour(secondaryColour)
+    , _size(size)
+    , _quantity(quantity)
+    , _seed(seed)
+    , _zAttemptRange(zAttemptRange)
+{
+}
+
+void SmallSceneryScatterAction::AcceptParameters(GameActionParameterVisitor& visitor)
+{
+    visitor.Visit(_loc);
+    visitor.Visit("quadrant", _quadrant);
+    visitor.Visit("object", _sceneryType);
+    visitor.Visit("primaryColour", _primaryColour);
+    visitor.Visit("secondaryColour", _secondaryColour);
+    visitor.Visit("size", _size);
+    visitor.Visit("quantity", _quantity);
+    visitor.Visit("seed", _seed);
+    visitor.Visit("zAttemptRange", _zAttemptRange);
+}
+
+uint32_t SmallSceneryScatterAction::GetCooldownTime() const
+{
+    return 20;
+}
+
+void SmallSceneryScatterAction::Serialise(DataSerialiser& stream)
+{
+    GameAction::Serialise(stream);
+
+    stream << DS_TAG(_loc) << DS_TAG(_quadrant) << DS_TAG(_sceneryType) << DS_TAG(_primaryColour) << DS_TAG(_secondaryColour)
+           << DS_TAG(_size) << DS_TAG(_quantity) << DS_TAG(_seed) << DS_TAG(_zAttemptRange);
+}
+
+GameActions::Result::Ptr SmallSceneryScatterAction::Query() const
+{
+    return QueryExecute(false);
+}
+
+GameActions::Result::Ptr SmallSceneryScatterAction::Execute() const
+{
+    MapInvalidationBatch invalidationBatch;
+    return QueryExecute(true);
+}
+
+/**
+ * Generates the positions of the cluster the same way the scatter tool used to for every individual placement, but
+ * from the action's own seed. The raw generator output is used so the sequence is identical on every platform.
+ */
+std::vector<SmallSceneryScatterAction::Placement> SmallSceneryScatterAction::GetPlacements() const
+{
+    std::vector<Placement> placements;
+    auto* sceneryEntry = get_small_scenery_entry(_sceneryType);
+    if (sceneryEntry == nullptr)
+        return placements;
+
+    bool isFullTile = scenery_small_entry_has_flag(sceneryEntry, SMALL_SCENERY_FLAG_FULL_TILE);
+    bool isRotatable = scenery_small_entry_has_flag(sceneryEntry, SMALL_SCENERY_FLAG_ROTATABLE);
+
+    std::mt19937 random(_seed);
+    auto rotation = _loc.direction;
+    placements.reserve(_quantity);
+    for (uint16_t i = 0; i < _quantity; i++)
+    {
+        uint8_t quadrant = _quadrant;
+        if (!isFullTile)
+        {
+            quadrant = random() & 3;
+        }
+
+        int32_t offsetX = static_cast<int32_t>(random() % _size) - (_size / 2);
+        int32_t offsetY = static_cast<int32_t>(random() % _size) - (_size / 2);
+        if (_size % 2 == 0)
+        {
+            offsetX += 1;
+            offsetY += 1;
+        }
+
+        if (!isRotatable)
+        {
+            rotation = (rotation + 1) & 3;
+        }
+
+        placements.push_back(
+            { { _loc.x + offsetX * COORDS_XY_STEP, _loc.y + offsetY * COORDS_XY_STEP, _loc.z, rotation }, quadrant });
+    }
+    return placements;
+}
+
+GameActions::Result::Ptr SmallSceneryScatterAction::QueryExecute(bool executing) const
+{
+    auto result = MakeResult();
+    result->ErrorTitle = STR_CANT_POSITION_THIS_HERE;
+    result->Expenditure = ExpenditureType::Landscaping;
+    result->Position = _loc.ToTileCentre();
+
+    if (_size == 0 || _size > MaxSize || _quantity == 0 || _quantity > _size * MaxQuantityPerSize)
+    {
+        log_error("Invalid scatter size %u or quantity %u", _size, _quantity);
+        return MakeResult(GameActions::Status::InvalidParameters, STR_CANT_POSITION_THIS_HERE);
+    }
+
+    auto placements = GetPlacements();
+    if (placements.empty())
+    {
+        log_error("Invalid small scenery type %u", _sceneryType);
+        return MakeResult(GameActions::Status::InvalidParameters, STR_CANT_POSITION_THIS_HERE);
+    }
+
+    // Scenery placed by this action affects the placements after it, so the query can only tell whether anything at
+    // all can be placed. Execute then places the cluster in order in a single pass.
+    GameActions::Result::Ptr lastFailure;
+    money32 totalCost = 0;
+    bool anyPlaced = false;
+    for (const auto& placement : placements)
+    {
+        auto loc = placement.Loc;
+        GameActions::Result::Ptr placeResult;
+        for (uint8_t zAttempt = std::max<uint8_t>(_zAttemptRange, 1); zAttempt != 0; zAttempt--)
+        {
+            auto placeAction = SmallSceneryPlaceAction(loc, placement.Quadrant, _sceneryType, _primaryColour, _secondaryColour);
+            placeAction.SetFlags(GetFlags());
+            placeResult = GameActions::QueryNested(&placeAction);
+            if (placeResult->Error == GameActions::Status::Ok || placeResult->Error == GameActions::Status::InsufficientFunds)
+            {
+                break;
+            }
+            if (zAttempt != 1)
+            {
+                loc.z += 8;
+            }
+        }
+
+        if (placeResult->Error == GameActions::Status::Ok)
+        {
+            // Place as much of the cluster as the park can afford, like individual placements would
+            if (!finance_check_affordability(totalCost + placeResult->Cost, GetFlags()))
+            {
+                break;
+            }
+        }
+
+        if (placeResult->Error == GameActions::Status::Ok && executing)
+        {
+            auto placeAction = SmallSceneryPlaceAction(loc, placement.Quadrant, _sceneryType, _primaryColour, _secondaryColour);
+            placeAction.SetFlags(GetFlags());
+            placeResult = GameActions::ExecuteNested(&placeAction);
+        }
+
+        if (placeResult->Error == GameActions::Status::Ok)
+        {
+            anyPlaced = true;
+            totalCost += placeResult->Cost;
+            result->Position = placeResult->Position;
+        }
+        else if (placeResult->Error == GameActions::Status::InsufficientFunds)
+        {
+            lastFailure = std::move(placeResult);
+            break;
+        }
+        else
+        {
+            lastFailure = std::move(placeResult);
+        }
+    }
+
+    if (!anyPlaced && lastFailure != nullptr)
+    {
+        return lastFailure;
+    }
+
+    result->Cost = totalCost;
+    return result;
+}
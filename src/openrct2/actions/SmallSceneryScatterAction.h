@@ -0,0 +1,60 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "GameAction.h"
+
+#include <vector>
+
+/**
+ * Places a cluster of small scenery around a tile, at positions derived from a seed so every peer computes the same
+ * placements from the same few parameters.
+ */
+DEFINE_GAME_ACTION(SmallSceneryScatterAction, GameCommand::ScatterSmallScenery, GameActions::Result)
+{
+public:
+    static constexpr uint16_t MaxSize = 64;
+    static constexpr uint16_t MaxQuantityPerSize = 3;
+
+private:
+    CoordsXYZD _loc;
+    uint8_t _quadrant{};
+    ObjectEntryIndex _sceneryType{};
+    uint8_t _primaryColour{};
+    uint8_t _secondaryColour{};
+    uint16_t _size{};
+    uint16_t _quantity{};
+    uint32_t _seed{};
+    uint8_t _zAttemptRange{ 1 };
+
+    struct Placement
+    {
+        CoordsXYZD Loc;
+        uint8_t Quadrant;
+    };
+
+public:
+    SmallSceneryScatterAction() = default;
+    SmallSceneryScatterAction(
+        const CoordsXYZD& loc, uint8_t quadrant, ObjectEntryIndex sceneryType, uint8_t primaryColour, uint8_t secondaryColour,
+        uint16_t size, uint16_t quantity, uint32_t seed, uint8_t zAttemptRange);
+
+    void AcceptParameters(GameActionParameterVisitor & visitor) override;
+
+    uint32_t GetCooldownTime() const override;
+
+    void Serialise(DataSerialiser & stream) override;
+    GameActions::Result::Ptr Query() const override;
+    GameActions::Result::Ptr Execute() const override;
+
+private:
+    GameActions::Result::Ptr QueryExecute(bool executing) const;
+    std::vector<Placement> GetPlacements() const;
+};
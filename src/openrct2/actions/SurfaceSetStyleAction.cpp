@@ -173,6 +173,16 @@ GameActions::Result::Ptr SurfaceSetStyleAction::Execute() const
     res->Position.y = yMid;
     res->Position.z = heightMid;
 
+    // Resolve the surface object once instead of for every tile of the area.
+    const TerrainSurfaceObject* surfaceObject = nullptr;
+    if (_surfaceStyle != OBJECT_ENTRY_INDEX_NULL)
+    {
+        auto& objManager = OpenRCT2::GetContext()->GetObjectManager();
+        surfaceObject = static_cast<TerrainSurfaceObject*>(
+            objManager.GetLoadedObject(ObjectType::TerrainSurface, _surfaceStyle));
+    }
+
+    MapInvalidationBatch invalidationBatch;
     money32 surfaceCost = 0;
     money32 edgeCost = 0;
     for (CoordsXY coords = { validRange.GetLeft(), validRange.GetTop() }; coords.x <= validRange.GetRight();
@@ -201,9 +211,6 @@ GameActions::Result::Ptr SurfaceSetStyleAction::Execute() const
 
                 if (_surfaceStyle != curSurfaceStyle)
                 {
-                    auto& objManager = OpenRCT2::GetContext()->GetObjectManager();
-                    const auto surfaceObject = static_cast<TerrainSurfaceObject*>(
-                        objManager.GetLoadedObject(ObjectType::TerrainSurface, _surfaceStyle));
                     if (surfaceObject != nullptr)
                     {
                         surfaceCost += surfaceObject->Price;
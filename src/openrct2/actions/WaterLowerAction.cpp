@@ -37,6 +37,7 @@ GameActions::Result::Ptr WaterLowerAction::Query() const
 
 GameActions::Result::Ptr WaterLowerAction::Execute() const
 {
+    MapInvalidationBatch invalidationBatch;
     return QueryExecute(true);
 }
 
@@ -37,6 +37,7 @@ GameActions::Result::Ptr WaterRaiseAction::Query() const
 
 GameActions::Result::Ptr WaterRaiseAction::Execute() const
 {
+    MapInvalidationBatch invalidationBatch;
     return QueryExecute(true);
 }
 
@@ -0,0 +1,199 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../Context.h"
+#    include "../Game.h"
+#    include "../Intro.h"
+#    include "../OpenRCT2.h"
+#    include "../peep/GuestPathfinding.h"
+#    include "../peep/Peep.h"
+#    include "../platform/Platform2.h"
+#    include "../platform/platform.h"
+#    include "../world/Footpath.h"
+#    include "../world/Map.h"
+#    include "../world/TileElementsView.h"
+
+#    include <algorithm>
+#    include <benchmark/benchmark.h>
+#    include <cstdint>
+#    include <random>
+#    include <string>
+#    include <vector>
+
+using namespace OpenRCT2;
+
+static constexpr size_t BenchPathfindPairs = 256;
+
+// A fixed seed, so every run of a park searches the same routes.
+static constexpr uint32_t BenchPathfindSeed = 0x5A4F1D;
+
+static std::vector<TileCoordsXYZ> GetPathTiles()
+{
+    std::vector<TileCoordsXYZ> tiles;
+    for (int32_t y = 0; y < gMapSize; y++)
+    {
+        for (int32_t x = 0; x < gMapSize; x++)
+        {
+            auto coords = TileCoordsXY{ x, y }.ToCoordsXY();
+            for (auto* pathElement : TileElementsView<PathElement>(coords))
+            {
+                if (!pathElement->IsQueue())
+                {
+                    tiles.push_back({ x, y, pathElement->base_height });
+                }
+            }
+        }
+    }
+    return tiles;
+}
+
+// Runs peep_pathfind_choose_direction for a guest from random path tiles to random path tiles of the park, every call
+// starting with an empty search cache like the first guest of a tick does.
+static void BM_pathfind(benchmark::State& state, const std::string& filename)
+{
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        state.SkipWithError("Context initialization failed.");
+        return;
+    }
+    if (!context->LoadParkFromFile(filename))
+    {
+        state.SkipWithError("Failed to load file!");
+        return;
+    }
+
+    gIntroState = IntroState::None;
+    gScreenFlags = SCREEN_FLAGS_PLAYING;
+
+    auto pathTiles = GetPathTiles();
+    if (pathTiles.empty())
+    {
+        state.SkipWithError("The park has no paths.");
+        return;
+    }
+
+    std::mt19937 random(BenchPathfindSeed);
+    std::uniform_int_distribution<size_t> distribution(0, pathTiles.size() - 1);
+    std::vector<std::pair<TileCoordsXYZ, TileCoordsXYZ>> pairs;
+    for (size_t i = 0; i < BenchPathfindPairs; i++)
+    {
+        pairs.emplace_back(pathTiles[distribution(random)], pathTiles[distribution(random)]);
+    }
+
+    auto* guest = Guest::Generate(pairs[0].first.ToCoordsXYZ().ToTileCentre());
+    if (guest == nullptr)
+    {
+        state.SkipWithError("Unable to create a guest.");
+        return;
+    }
+    guest->OutsideOfPark = false;
+
+    gPeepPathFindIgnoreForeignQueues = true;
+    gPeepPathFindQueueRideIndex = RIDE_ID_NULL;
+
+    peep_pathfind_reset_stats();
+    for (auto _ : state)
+    {
+        for (const auto& [start, goal] : pairs)
+        {
+            peep_pathfind_clear_search_cache();
+            guest->ResetPathfindGoal();
+            gPeepPathFindGoalPosition = goal;
+            benchmark::DoNotOptimize(peep_pathfind_choose_direction(start, guest));
+        }
+    }
+    peep_pathfind_clear_search_cache();
+    peep_sprite_remove(guest);
+
+    const auto stats = peep_pathfind_get_stats();
+    const auto calls = static_cast<double>(std::max<uint64_t>(stats.Calls, 1));
+    state.counters["Calls"] = benchmark::Counter(static_cast<double>(stats.Calls), benchmark::Counter::kIsRate);
+    state.counters["Tiles/call"] = static_cast<double>(stats.TilesChecked) / calls;
+    state.counters["Junctions/call"] = static_cast<double>(stats.JunctionsVisited) / calls;
+    state.counters["MaxDepth"] = stats.MaxDepth;
+    state.counters["TileLimit%"] = 100.0 * static_cast<double>(stats.TileLimitCalls) / calls;
+    state.counters["JunctionLimit%"] = 100.0 * static_cast<double>(stats.JunctionLimitCalls) / calls;
+    state.counters["Failed%"] = 100.0 * static_cast<double>(stats.FailedCalls) / calls;
+    state.counters["us/call"] = static_cast<double>(stats.TotalTime) / 1000.0 / calls;
+    state.counters["MaxCall_us"] = static_cast<double>(stats.MaxTime) / 1000.0;
+}
+
+static int CmdlineForBenchPathfind(int argc, const char* const* argv)
+{
+    // Google benchmark does stuff to argv. It doesn't modify the pointees,
+    // but it wants to reorder the pointers, so present a copy of them.
+    std::vector<char*> argv_for_benchmark;
+
+    // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
+    argv_for_benchmark.push_back(nullptr);
+
+    // Extract file names from argument list. If there is no such file, consider it benchmark option.
+    for (int i = 0; i < argc; i++)
+    {
+        if (Platform::FileExists(argv[i]))
+        {
+            benchmark::RegisterBenchmark(argv[i], BM_pathfind, std::string(argv[i]))->Unit(benchmark::kMillisecond);
+        }
+        else
+        {
+            argv_for_benchmark.push_back(const_cast<char*>(argv[i]));
+        }
+    }
+    // Update argc with all the changes made
+    argc = static_cast<int>(argv_for_benchmark.size());
+    ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
+    if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
+        return -1;
+
+    core_init();
+    gOpenRCT2Headless = true;
+
+    ::benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
+
+static exitcode_t HandleBenchPathfind(CommandLineArgEnumerator* argEnumerator)
+{
+    const char* const* argv = static_cast<const char* const*>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = CmdlineForBenchPathfind(argc, argv);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+#else
+static exitcode_t HandleBenchPathfind(CommandLineArgEnumerator* argEnumerator)
+{
+    log_error("Sorry, Google benchmark not enabled in this build");
+    return EXITCODE_FAIL;
+}
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchPathfindCommands[]{
+#ifdef USE_BENCHMARK
+    DefineCommand(
+        "",
+        "<file>... [--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
+        "[--benchmark_repetitions=<num_repetitions>] [--benchmark_report_aggregates_only={true|false}] "
+        "[--benchmark_format=<console|json|csv>] [--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>] "
+        "[--benchmark_color={auto|true|false}] [--benchmark_counters_tabular={true|false}] [--v=<verbosity>]",
+        nullptr, HandleBenchPathfind),
+    CommandTableEnd
+#else
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchPathfind), CommandTableEnd
+#endif // USE_BENCHMARK
+};
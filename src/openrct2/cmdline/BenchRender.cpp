@@ -0,0 +1,161 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../Context.h"
+#    include "../Game.h"
+#    include "../Intro.h"
+#    include "../OpenRCT2.h"
+#    include "../drawing/X8DrawingEngine.h"
+#    include "../interface/Screenshot.h"
+#    include "../interface/Viewport.h"
+#    include "../platform/Platform2.h"
+#    include "../platform/platform.h"
+#    include "../world/Map.h"
+
+#    include <benchmark/benchmark.h>
+#    include <chrono>
+#    include <cstdint>
+#    include <string>
+#    include <vector>
+
+using namespace OpenRCT2;
+using namespace OpenRCT2::Drawing;
+
+static constexpr int32_t BenchRenderZoomLevels = 4;
+static constexpr int32_t BenchRenderRotations = 4;
+
+// Renders the whole park like a giant screenshot and reports how long each paint stage took per iteration.
+static void BM_render(benchmark::State& state, const std::string& filename, int32_t zoom, int32_t rotation)
+{
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        state.SkipWithError("Context initialization failed.");
+        return;
+    }
+    if (!context->LoadParkFromFile(filename))
+    {
+        state.SkipWithError("Failed to load file!");
+        return;
+    }
+
+    gIntroState = IntroState::None;
+    gScreenFlags = SCREEN_FLAGS_PLAYING;
+    gCurrentRotation = rotation;
+
+    auto viewport = GetGiantViewport(gMapSize, rotation, zoom);
+    std::vector<uint8_t> pixels(static_cast<size_t>(viewport.width) * viewport.height);
+
+    X8DrawingEngine drawingEngine(context->GetUiContext());
+    rct_drawpixelinfo dpi;
+    dpi.bits = pixels.data();
+    dpi.width = viewport.width;
+    dpi.height = viewport.height;
+    dpi.DrawingEngine = &drawingEngine;
+
+    PaintStageTimings timings;
+    for (auto _ : state)
+    {
+        reset_all_sprite_quadrant_placements();
+        viewport_render(&dpi, &viewport, 0, 0, viewport.width, viewport.height, nullptr, &timings);
+        benchmark::DoNotOptimize(pixels.data());
+    }
+
+    const auto iterations = static_cast<double>(std::max<int64_t>(state.iterations(), 1));
+    auto perIteration = [iterations](std::chrono::duration<double> time) {
+        return std::chrono::duration<double, std::milli>(time).count() / iterations;
+    };
+    state.counters["Generate_ms"] = perIteration(timings.Generate);
+    state.counters["Arrange_ms"] = perIteration(timings.Arrange);
+    state.counters["Draw_ms"] = perIteration(timings.Draw);
+    state.counters["PaintEntries"] = static_cast<double>(timings.PaintEntries) / iterations;
+    state.counters["Pixels"] = static_cast<double>(pixels.size());
+}
+
+static int CmdlineForBenchRender(int argc, const char* const* argv)
+{
+    // Google benchmark does stuff to argv. It doesn't modify the pointees,
+    // but it wants to reorder the pointers, so present a copy of them.
+    std::vector<char*> argv_for_benchmark;
+
+    // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
+    argv_for_benchmark.push_back(nullptr);
+
+    // Extract file names from argument list. If there is no such file, consider it benchmark option.
+    for (int i = 0; i < argc; i++)
+    {
+        if (Platform::FileExists(argv[i]))
+        {
+            for (int32_t zoom = 0; zoom < BenchRenderZoomLevels; zoom++)
+            {
+                for (int32_t rotation = 0; rotation < BenchRenderRotations; rotation++)
+                {
+                    auto name = std::string(argv[i]) + "/zoom:" + std::to_string(zoom) + "/rotation:"
+                        + std::to_string(rotation);
+                    benchmark::RegisterBenchmark(name.c_str(), BM_render, std::string(argv[i]), zoom, rotation)
+                        ->Unit(benchmark::kMillisecond);
+                }
+            }
+        }
+        else
+        {
+            argv_for_benchmark.push_back(const_cast<char*>(argv[i]));
+        }
+    }
+    // Update argc with all the changes made
+    argc = static_cast<int>(argv_for_benchmark.size());
+    ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
+    if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
+        return -1;
+
+    core_init();
+    gOpenRCT2Headless = true;
+
+    ::benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
+
+static exitcode_t HandleBenchRender(CommandLineArgEnumerator* argEnumerator)
+{
+    const char* const* argv = static_cast<const char* const*>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = CmdlineForBenchRender(argc, argv);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+#else
+static exitcode_t HandleBenchRender(CommandLineArgEnumerator* argEnumerator)
+{
+    log_error("Sorry, Google benchmark not enabled in this build");
+    return EXITCODE_FAIL;
+}
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchRenderCommands[]{
+#ifdef USE_BENCHMARK
+    DefineCommand(
+        "",
+        "<file>... [--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
+        "[--benchmark_repetitions=<num_repetitions>] [--benchmark_report_aggregates_only={true|false}] "
+        "[--benchmark_format=<console|json|csv>] [--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>] "
+        "[--benchmark_color={auto|true|false}] [--benchmark_counters_tabular={true|false}] [--v=<verbosity>]",
+        nullptr, HandleBenchRender),
+    CommandTableEnd
+#else
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchRender), CommandTableEnd
+#endif // USE_BENCHMARK
+};
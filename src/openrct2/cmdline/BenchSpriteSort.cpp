@@ -17,8 +17,12 @@
 #    include "../OpenRCT2.h"
 #    include "../audio/audio.h"
 #    include "../core/Console.hpp"
+#    include "../core/FileStream.h"
 #    include "../core/Imaging.h"
+#    include "../core/Path.hpp"
+#    include "../core/String.hpp"
 #    include "../drawing/Drawing.h"
+#    include "../drawing/X8DrawingEngine.h"
 #    include "../interface/Viewport.h"
 #    include "../localisation/Localisation.h"
 #    include "../paint/Paint.h"
@@ -29,112 +33,271 @@
 #    include "../world/Park.h"
 #    include "../world/Surface.h"
 
+#    include <algorithm>
 #    include <benchmark/benchmark.h>
 #    include <cstdint>
 #    include <iterator>
+#    include <limits>
+#    include <memory>
+#    include <string>
 #    include <vector>
 
+using namespace OpenRCT2;
+using namespace OpenRCT2::Drawing;
+
+// Recordings of the paint sessions of a park, so every paint stage can be benchmarked without setting up the park.
+// The entries are stored as they are in memory, a recording can only be used by builds with the same paint structs.
+static constexpr const char* PaintRecordingExtension = ".paintsessions";
+static constexpr uint32_t PaintRecordingMagic = 0x53505052; // RPPS
+static constexpr uint32_t PaintRecordingVersion = 1;
+
+struct PaintSessionRecording
+{
+    // The park the sessions were generated from, generating and drawing them again needs its map and objects.
+    std::string ParkPath;
+    std::vector<RecordedPaintSession> Sessions;
+};
+
+template<typename T> static T* fixup_pointer(std::vector<paint_entry>& entries, T* ptr)
+{
+    if (ptr == reinterpret_cast<T*>(-1))
+    {
+        return nullptr;
+    }
+    auto index = reinterpret_cast<size_t>(ptr) / sizeof(paint_entry);
+    return reinterpret_cast<T*>(&entries[index]);
+}
+
+// Turns the entry offsets written by record_session back into pointers, following the same structure it walked.
 static void fixup_pointers(std::vector<RecordedPaintSession>& s)
 {
-    for (size_t i = 0; i < s.size(); i++)
+    for (auto& recordedSession : s)
     {
-        auto& entries = s[i].Entries;
-        auto& quadrants = s[i].Session.Quadrants;
-        for (size_t j = 0; j < entries.size(); j++)
+        auto& entries = recordedSession.Entries;
+        std::vector<paint_struct*> pending;
+        for (auto& quadrant : recordedSession.Session.Quadrants)
         {
-            if (entries[j].basic.next_quadrant_ps == reinterpret_cast<paint_struct*>(-1))
-            {
-                entries[j].basic.next_quadrant_ps = nullptr;
-            }
-            else
+            quadrant = fixup_pointer(entries, quadrant);
+            if (quadrant != nullptr)
             {
-                auto nextQuadrantPs = reinterpret_cast<size_t>(entries[j].basic.next_quadrant_ps) / sizeof(paint_entry);
-                entries[j].basic.next_quadrant_ps = &s[i].Entries[nextQuadrantPs].basic;
+                pending.push_back(quadrant);
             }
         }
-        for (size_t j = 0; j < std::size(quadrants); j++)
+
+        std::vector<bool> visited(entries.size());
+        while (!pending.empty())
         {
-            if (quadrants[j] == reinterpret_cast<paint_struct*>(-1))
+            auto* ps = pending.back();
+            pending.pop_back();
+            auto index = reinterpret_cast<paint_entry*>(ps) - entries.data();
+            if (visited[index])
             {
-                quadrants[j] = nullptr;
+                continue;
             }
-            else
+            visited[index] = true;
+
+            ps->next_quadrant_ps = fixup_pointer(entries, ps->next_quadrant_ps);
+            ps->children = fixup_pointer(entries, ps->children);
+            ps->attached_ps = fixup_pointer(entries, ps->attached_ps);
+            for (auto* attached = ps->attached_ps; attached != nullptr; attached = attached->next)
             {
-                auto ps = reinterpret_cast<size_t>(quadrants[j]) / sizeof(paint_entry);
-                quadrants[j] = &entries[ps].basic;
+                attached->next = fixup_pointer(entries, attached->next);
+            }
+            if (ps->next_quadrant_ps != nullptr)
+            {
+                pending.push_back(ps->next_quadrant_ps);
+            }
+            if (ps->children != nullptr)
+            {
+                pending.push_back(ps->children);
             }
         }
     }
 }
 
-static std::vector<RecordedPaintSession> extract_paint_session(std::string_view parkFileName)
+static bool load_park(const std::string& parkFileName)
+{
+    // The draw and generate benchmarks of the same park run one after another, only load it again for a different park.
+    static std::string loadedPark;
+    if (loadedPark == parkFileName)
+    {
+        return true;
+    }
+    if (!GetContext()->LoadParkFromFile(parkFileName))
+    {
+        loadedPark.clear();
+        return false;
+    }
+    loadedPark = parkFileName;
+
+    gIntroState = IntroState::None;
+    gScreenFlags = SCREEN_FLAGS_PLAYING;
+    return true;
+}
+
+static std::vector<RecordedPaintSession> extract_paint_session(const std::string& parkFileName)
 {
-    core_init();
-    gOpenRCT2Headless = true;
-    auto context = OpenRCT2::CreateContext();
     std::vector<RecordedPaintSession> sessions;
     log_info("Starting...");
-    if (context->Initialise())
+    if (!load_park(parkFileName))
     {
-        drawing_engine_init();
-        if (!context->LoadParkFromFile(std::string(parkFileName)))
-        {
-            log_error("Failed to load park!");
-            return {};
-        }
-
-        gIntroState = IntroState::None;
-        gScreenFlags = SCREEN_FLAGS_PLAYING;
+        log_error("Failed to load park!");
+        return {};
+    }
 
-        int32_t mapSize = gMapSize;
-        int32_t resolutionWidth = (mapSize * 32 * 2);
-        int32_t resolutionHeight = (mapSize * 32 * 1);
+    int32_t mapSize = gMapSize;
+    int32_t resolutionWidth = (mapSize * 32 * 2);
+    int32_t resolutionHeight = (mapSize * 32 * 1);
 
-        resolutionWidth += 8;
-        resolutionHeight += 128;
+    resolutionWidth += 8;
+    resolutionHeight += 128;
 
-        rct_viewport viewport;
-        viewport.pos = { 0, 0 };
-        viewport.width = resolutionWidth;
-        viewport.height = resolutionHeight;
-        viewport.view_width = viewport.width;
-        viewport.view_height = viewport.height;
-        viewport.var_11 = 0;
-        viewport.flags = 0;
+    rct_viewport viewport;
+    viewport.pos = { 0, 0 };
+    viewport.width = resolutionWidth;
+    viewport.height = resolutionHeight;
+    viewport.view_width = viewport.width;
+    viewport.view_height = viewport.height;
+    viewport.var_11 = 0;
+    viewport.flags = 0;
 
-        int32_t customX = (gMapSize / 2) * 32 + 16;
-        int32_t customY = (gMapSize / 2) * 32 + 16;
+    int32_t customX = (gMapSize / 2) * 32 + 16;
+    int32_t customY = (gMapSize / 2) * 32 + 16;
 
-        int32_t x = 0, y = 0;
-        int32_t z = tile_element_height({ customX, customY });
-        x = customY - customX;
-        y = ((customX + customY) / 2) - z;
+    int32_t x = 0, y = 0;
+    int32_t z = tile_element_height({ customX, customY });
+    x = customY - customX;
+    y = ((customX + customY) / 2) - z;
 
-        viewport.viewPos = { x - ((viewport.view_width) / 2), y - ((viewport.view_height) / 2) };
-        viewport.zoom = 0;
-        gCurrentRotation = 0;
+    viewport.viewPos = { x - ((viewport.view_width) / 2), y - ((viewport.view_height) / 2) };
+    viewport.zoom = 0;
+    gCurrentRotation = 0;
 
-        // Ensure sprites appear regardless of rotation
-        reset_all_sprite_quadrant_placements();
+    // Ensure sprites appear regardless of rotation
+    reset_all_sprite_quadrant_placements();
 
-        rct_drawpixelinfo dpi;
-        dpi.x = 0;
-        dpi.y = 0;
-        dpi.width = resolutionWidth;
-        dpi.height = resolutionHeight;
-        dpi.pitch = 0;
-        dpi.bits = static_cast<uint8_t*>(malloc(dpi.width * dpi.height));
+    rct_drawpixelinfo dpi;
+    dpi.x = 0;
+    dpi.y = 0;
+    dpi.width = resolutionWidth;
+    dpi.height = resolutionHeight;
+    dpi.pitch = 0;
+    dpi.bits = static_cast<uint8_t*>(malloc(dpi.width * dpi.height));
 
-        log_info("Obtaining sprite data...");
-        viewport_render(&dpi, &viewport, 0, 0, viewport.width, viewport.height, &sessions);
+    log_info("Obtaining sprite data...");
+    viewport_render(&dpi, &viewport, 0, 0, viewport.width, viewport.height, &sessions);
 
-        free(dpi.bits);
-        drawing_engine_dispose();
-    }
+    free(dpi.bits);
     log_info("Got %u paint sessions.", std::size(sessions));
     return sessions;
 }
 
+static void save_paint_session_recording(const PaintSessionRecording& recording, const std::string& path)
+{
+    auto fs = FileStream(path, FILE_MODE_WRITE);
+    fs.WriteValue<uint32_t>(PaintRecordingMagic);
+    fs.WriteValue<uint32_t>(PaintRecordingVersion);
+    fs.WriteValue<uint32_t>(sizeof(PaintSessionCore));
+    fs.WriteValue<uint32_t>(sizeof(paint_entry));
+    fs.WriteString(recording.ParkPath);
+    fs.WriteValue<uint32_t>(static_cast<uint32_t>(recording.Sessions.size()));
+    for (const auto& session : recording.Sessions)
+    {
+        fs.WriteValue<int16_t>(session.X);
+        fs.WriteValue<int16_t>(session.Y);
+        fs.WriteValue<int16_t>(session.Width);
+        fs.WriteValue<int16_t>(session.Height);
+        fs.WriteValue<int8_t>(static_cast<int8_t>(session.Zoom));
+        fs.Write(&session.Session, sizeof(PaintSessionCore));
+        fs.WriteValue<uint32_t>(static_cast<uint32_t>(session.Entries.size()));
+        fs.WriteArray(session.Entries.data(), session.Entries.size());
+    }
+}
+
+static PaintSessionRecording load_paint_session_recording(const std::string& path)
+{
+    auto fs = FileStream(path, FILE_MODE_OPEN);
+    if (fs.ReadValue<uint32_t>() != PaintRecordingMagic)
+    {
+        throw IOException("Not a paint session recording.");
+    }
+    if (fs.ReadValue<uint32_t>() != PaintRecordingVersion || fs.ReadValue<uint32_t>() != sizeof(PaintSessionCore)
+        || fs.ReadValue<uint32_t>() != sizeof(paint_entry))
+    {
+        throw IOException("The paint session recording was made by an incompatible build.");
+    }
+
+    PaintSessionRecording recording;
+    recording.ParkPath = fs.ReadStdString();
+    recording.Sessions.resize(fs.ReadValue<uint32_t>());
+    for (auto& session : recording.Sessions)
+    {
+        session.X = fs.ReadValue<int16_t>();
+        session.Y = fs.ReadValue<int16_t>();
+        session.Width = fs.ReadValue<int16_t>();
+        session.Height = fs.ReadValue<int16_t>();
+        session.Zoom = fs.ReadValue<int8_t>();
+        fs.Read(&session.Session, sizeof(PaintSessionCore));
+        session.Entries.resize(fs.ReadValue<uint32_t>());
+        fs.Read(session.Entries.data(), session.Entries.size() * sizeof(paint_entry));
+    }
+    return recording;
+}
+
+/**
+ * Pixels for all columns of a recording, laid out like the screenshot they were recorded from.
+ */
+class RecordingCanvas
+{
+private:
+    std::vector<uint8_t> _pixels;
+    int32_t _left{};
+    int32_t _top{};
+    int32_t _width{};
+
+public:
+    explicit RecordingCanvas(const std::vector<RecordedPaintSession>& sessions)
+    {
+        if (sessions.empty())
+            return;
+
+        int32_t right = std::numeric_limits<int32_t>::min();
+        int32_t bottom = std::numeric_limits<int32_t>::min();
+        _left = std::numeric_limits<int32_t>::max();
+        _top = std::numeric_limits<int32_t>::max();
+        for (const auto& session : sessions)
+        {
+            _left = std::min<int32_t>(_left, session.X);
+            _top = std::min<int32_t>(_top, session.Y);
+            right = std::max<int32_t>(right, session.X + session.Width);
+            bottom = std::max<int32_t>(bottom, session.Y + session.Height);
+        }
+        const auto zoom = sessions[0].Zoom;
+        _width = (right - _left) / zoom;
+        _pixels.resize(static_cast<size_t>(_width) * ((bottom - _top) / zoom));
+    }
+
+    rct_drawpixelinfo GetDPI(const RecordedPaintSession& session, IDrawingEngine* drawingEngine)
+    {
+        rct_drawpixelinfo dpi;
+        dpi.x = session.X;
+        dpi.y = session.Y;
+        dpi.width = session.Width;
+        dpi.height = session.Height;
+        dpi.zoom_level = session.Zoom;
+        dpi.bits = _pixels.data() + (session.X - _left) / session.Zoom
+            + static_cast<size_t>((session.Y - _top) / session.Zoom) * _width;
+        dpi.pitch = _width - session.Width / session.Zoom;
+        dpi.DrawingEngine = drawingEngine;
+        return dpi;
+    }
+
+    const uint8_t* GetPixels() const
+    {
+        return _pixels.data();
+    }
+};
+
 // This function is based on benchgfx_render_screenshots
 static void BM_paint_session_arrange(benchmark::State& state, const std::vector<RecordedPaintSession> inputSessions)
 {
@@ -150,13 +313,98 @@ static void BM_paint_session_arrange(benchmark::State& state, const std::vector<
         state.PauseTiming();
         std::copy_n(local_s, std::size(sessions), sessions.begin());
         state.ResumeTiming();
-        PaintSessionArrange(&sessions[0].Session);
+        for (auto& session : sessions)
+        {
+            PaintSessionArrange(&session.Session);
+        }
         benchmark::DoNotOptimize(sessions);
     }
     state.SetItemsProcessed(state.iterations() * std::size(sessions));
+
+    size_t paintStructCount = 0;
+    for (const auto& session : inputSessions)
+    {
+        paintStructCount += session.Entries.size();
+    }
+    state.counters["PaintStructs"] = static_cast<double>(paintStructCount);
     delete[] local_s;
 }
 
+// Draws the arranged sessions with PaintDrawStructs, which is where the sprite blitters spend their time.
+static void BM_paint_session_draw(benchmark::State& state, const PaintSessionRecording& recording)
+{
+    if (!load_park(recording.ParkPath))
+    {
+        state.SkipWithError("Failed to load the recorded park!");
+        return;
+    }
+
+    auto recordedSessions = recording.Sessions;
+    fixup_pointers(recordedSessions);
+
+    X8DrawingEngine drawingEngine(GetContext()->GetUiContext());
+    RecordingCanvas canvas(recordedSessions);
+    std::vector<std::unique_ptr<paint_session>> sessions;
+    for (auto& recordedSession : recordedSessions)
+    {
+        PaintSessionArrange(&recordedSession.Session);
+        auto& session = sessions.emplace_back(std::make_unique<paint_session>());
+        static_cast<PaintSessionCore&>(*session) = recordedSession.Session;
+        session->DPI = canvas.GetDPI(recordedSession, &drawingEngine);
+    }
+
+    for (auto _ : state)
+    {
+        for (auto& session : sessions)
+        {
+            PaintDrawStructs(session.get());
+        }
+        benchmark::DoNotOptimize(canvas.GetPixels());
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(sessions));
+}
+
+static void BM_paint_session_generate(benchmark::State& state, const PaintSessionRecording& recording)
+{
+    if (recording.Sessions.empty() || !load_park(recording.ParkPath))
+    {
+        state.SkipWithError("Failed to load the recorded park!");
+        return;
+    }
+
+    gCurrentRotation = recording.Sessions[0].Session.CurrentRotation;
+    reset_all_sprite_quadrant_placements();
+
+    RecordingCanvas canvas(recording.Sessions);
+    std::vector<rct_drawpixelinfo> dpis;
+    for (const auto& recordedSession : recording.Sessions)
+    {
+        dpis.push_back(canvas.GetDPI(recordedSession, nullptr));
+    }
+
+    size_t paintStructCount = 0;
+    for (auto _ : state)
+    {
+        paintStructCount = 0;
+        for (size_t i = 0; i < dpis.size(); i++)
+        {
+            auto* session = PaintSessionAlloc(&dpis[i], recording.Sessions[i].Session.ViewFlags);
+            PaintSessionGenerate(session);
+            paintStructCount += session->PaintEntryChain.GetCount();
+            PaintSessionFree(session);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(dpis));
+    state.counters["PaintStructs"] = static_cast<double>(paintStructCount);
+}
+
+static void register_paint_session_benchmarks(const std::string& name, const PaintSessionRecording& recording)
+{
+    benchmark::RegisterBenchmark(name.c_str(), BM_paint_session_arrange, recording.Sessions);
+    benchmark::RegisterBenchmark((name + "/draw").c_str(), BM_paint_session_draw, recording);
+    benchmark::RegisterBenchmark((name + "/generate").c_str(), BM_paint_session_generate, recording);
+}
+
 static int cmdline_for_bench_sprite_sort(int argc, const char** argv)
 {
     {
@@ -173,6 +421,18 @@ static int cmdline_for_bench_sprite_sort(int argc, const char** argv)
         benchmark::RegisterBenchmark("baseline", BM_paint_session_arrange, sessions);
     }
 
+    core_init();
+    gOpenRCT2Headless = true;
+
+    // The recorded sessions refer to sprites and the park they came from, so keep the context for the benchmarks.
+    auto context = CreateContext();
+    if (!context->Initialise())
+    {
+        log_error("Context initialization failed.");
+        return -1;
+    }
+    drawing_engine_init();
+
     // Google benchmark does stuff to argv. It doesn't modify the pointees,
     // but it wants to reorder the pointers, so present a copy of them.
     std::vector<char*> argv_for_benchmark;
@@ -180,15 +440,53 @@ static int cmdline_for_bench_sprite_sort(int argc, const char** argv)
     // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
     argv_for_benchmark.push_back(nullptr);
 
+    std::string saveDirectory;
+    constexpr std::string_view saveSessionsOption = "--save-sessions=";
+
     // Extract file names from argument list. If there is no such file, consider it benchmark option.
     for (int i = 0; i < argc; i++)
     {
-        if (Platform::FileExists(argv[i]))
+        if (String::StartsWith(argv[i], saveSessionsOption))
         {
-            // Register benchmark for sv6 if valid
-            std::vector<RecordedPaintSession> sessions = extract_paint_session(argv[i]);
-            if (!sessions.empty())
-                benchmark::RegisterBenchmark(argv[i], BM_paint_session_arrange, sessions);
+            saveDirectory = std::string(argv[i]).substr(saveSessionsOption.size());
+        }
+        else if (Platform::FileExists(argv[i]))
+        {
+            PaintSessionRecording recording;
+            if (String::Equals(Path::GetExtension(argv[i]), PaintRecordingExtension, true))
+            {
+                try
+                {
+                    recording = load_paint_session_recording(argv[i]);
+                }
+                catch (const std::exception& e)
+                {
+                    log_error("Unable to load '%s': %s", argv[i], e.what());
+                    continue;
+                }
+            }
+            else
+            {
+                // Register benchmark for sv6 if valid
+                recording.ParkPath = Path::GetAbsolute(argv[i]);
+                recording.Sessions = extract_paint_session(argv[i]);
+                if (!saveDirectory.empty() && !recording.Sessions.empty())
+                {
+                    auto path = Path::Combine(
+                        saveDirectory, Path::GetFileNameWithoutExtension(std::string(argv[i])) + PaintRecordingExtension);
+                    try
+                    {
+                        save_paint_session_recording(recording, path);
+                        log_info("Saved paint sessions to '%s'.", path.c_str());
+                    }
+                    catch (const std::exception& e)
+                    {
+                        log_error("Unable to save '%s': %s", path.c_str(), e.what());
+                    }
+                }
+            }
+            if (!recording.Sessions.empty())
+                register_paint_session_benchmarks(argv[i], recording);
         }
         else
         {
@@ -201,6 +499,8 @@ static int cmdline_for_bench_sprite_sort(int argc, const char** argv)
     if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
         return -1;
     ::benchmark::RunSpecifiedBenchmarks();
+
+    drawing_engine_dispose();
     return 0;
 }
 
@@ -228,7 +528,7 @@ const CommandLineCommand CommandLine::BenchSpriteSortCommands[]{
 #ifdef USE_BENCHMARK
     DefineCommand(
         "",
-        "[<file>]... [--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
+        "[--save-sessions=<directory>] [<file>]... [--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
         "[--benchmark_repetitions=<num_repetitions>] [--benchmark_report_aggregates_only={true|false}] "
         "[--benchmark_format=<console|json|csv>] [--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>] "
         "[--benchmark_color={auto|true|false}] [--benchmark_counters_tabular={true|false}] [--v=<verbosity>]",
@@ -13,18 +13,34 @@
 
 #    include "../Context.h"
 #    include "../GameState.h"
+#    include "../GameStateSnapshots.h"
 #    include "../OpenRCT2.h"
+#    include "../core/FileScanner.h"
+#    include "../core/Path.hpp"
+#    include "../peep/GuestPathfinding.h"
+#    include "../peep/Peep.h"
 #    include "../platform/Platform2.h"
 #    include "../platform/platform.h"
+#    include "../ride/Ride.h"
+#    include "../ride/RideRatings.h"
+#    include "../ride/Vehicle.h"
+#    include "../world/EntityList.h"
+#    include "../world/Map.h"
+#    include "../world/Sprite.h"
 
+#    include <algorithm>
 #    include <benchmark/benchmark.h>
 #    include <cstdint>
 #    include <iterator>
 #    include <numeric>
+#    include <string>
 #    include <vector>
 
 using namespace OpenRCT2;
 
+// Save formats picked up when a directory is given, e.g. test/tests/testdata/parks.
+static constexpr const char* BenchParkPattern = "*.sv4;*.sv6;*.sc4;*.sc6;*.sea;*.park";
+
 static void BM_update(benchmark::State& state, const std::string& filename)
 {
     std::unique_ptr<IContext> context(CreateContext());
@@ -49,14 +65,14 @@ static void BM_update(benchmark::State& state, const std::string& filename)
             context->GetGameState()->UpdateLogic(timingToUse);
         }
         state.SetItemsProcessed(state.iterations());
-        auto accumulator = [timings](LogicTimePart part) -> double {
-            std::chrono::duration<double> timesum;
+        auto accumulator = [&timings](LogicTimePart part) -> double {
+            std::chrono::duration<double> timesum{};
             for (const auto& timing : timings)
             {
-                timesum = std::accumulate(
+                timesum += std::accumulate(
                     timing.TimingInfo.at(part).begin(), timing.TimingInfo.at(part).end(), std::chrono::duration<double>());
             }
-            return std::chrono::duration_cast<std::chrono::milliseconds>(timesum).count();
+            return std::chrono::duration<double, std::milli>(timesum).count();
         };
         state.counters["NetworkUpdateAcc_ms"] = accumulator(LogicTimePart::NetworkUpdate);
         state.counters["DateAcc_ms"] = accumulator(LogicTimePart::Date);
@@ -87,6 +103,190 @@ static void BM_update(benchmark::State& state, const std::string& filename)
     }
 }
 
+static void BM_entity_tile_queries(benchmark::State& state, const std::string& filename)
+{
+    std::unique_ptr<IContext> context(CreateContext());
+    if (context->Initialise())
+    {
+        if (!filename.empty() && !context->LoadParkFromFile(filename))
+        {
+            state.SkipWithError("Failed to load file!");
+        }
+
+        // Queries every tile of the map, like collision checks and painting do for the tiles they touch.
+        uint64_t entitiesFound = 0;
+        for (auto _ : state)
+        {
+            for (int32_t y = 0; y < gMapSize; y++)
+            {
+                for (int32_t x = 0; x < gMapSize; x++)
+                {
+                    for (auto* entity : EntityTileList(TileCoordsXY{ x, y }.ToCoordsXY()))
+                    {
+                        benchmark::DoNotOptimize(entity);
+                        entitiesFound++;
+                    }
+                }
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * gMapSize * gMapSize);
+        state.counters["Entities"] = static_cast<double>(entitiesFound) / std::max<int64_t>(state.iterations(), 1);
+    }
+    else
+    {
+        state.SkipWithError("Context initialization failed.");
+    }
+}
+
+// Loads the park for one of the isolated subsystem benchmarks, returns nullptr after skipping the benchmark on failure.
+static std::unique_ptr<IContext> LoadBenchmarkPark(benchmark::State& state, const std::string& filename)
+{
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        state.SkipWithError("Context initialization failed.");
+        return nullptr;
+    }
+    if (!context->LoadParkFromFile(filename))
+    {
+        state.SkipWithError("Failed to load file!");
+        return nullptr;
+    }
+    return context;
+}
+
+static void BM_guest_update(benchmark::State& state, const std::string& filename)
+{
+    auto context = LoadBenchmarkPark(state, filename);
+    if (context == nullptr)
+        return;
+
+    for (auto _ : state)
+    {
+        peep_update_all();
+    }
+    state.SetItemsProcessed(state.iterations() * GetEntityListCount(EntityType::Guest));
+    state.counters["Guests"] = static_cast<double>(GetEntityListCount(EntityType::Guest));
+}
+
+// Runs the path finding of every walking guest, without the rest of the guest update, and without the search results
+// shared between guests within a tick.
+static void BM_pathfinding(benchmark::State& state, const std::string& filename)
+{
+    auto context = LoadBenchmarkPark(state, filename);
+    if (context == nullptr)
+        return;
+
+    int64_t searches = 0;
+    for (auto _ : state)
+    {
+        for (auto* guest : EntityList<Guest>())
+        {
+            if (guest->State == PeepState::Walking)
+            {
+                benchmark::DoNotOptimize(guest_path_finding(guest));
+                searches++;
+            }
+        }
+        peep_pathfind_clear_search_cache();
+    }
+    state.SetItemsProcessed(searches);
+    state.counters["Searches"] = static_cast<double>(searches) / std::max<int64_t>(state.iterations(), 1);
+}
+
+static void BM_vehicle_update(benchmark::State& state, const std::string& filename)
+{
+    auto context = LoadBenchmarkPark(state, filename);
+    if (context == nullptr)
+        return;
+
+    for (auto _ : state)
+    {
+        vehicle_update_all();
+    }
+    state.SetItemsProcessed(state.iterations() * GetEntityListCount(EntityType::Vehicle));
+    state.counters["Vehicles"] = static_cast<double>(GetEntityListCount(EntityType::Vehicle));
+}
+
+// Rates every open ride from start to finish, the game spreads this over many ticks.
+static void BM_ride_ratings(benchmark::State& state, const std::string& filename)
+{
+    auto context = LoadBenchmarkPark(state, filename);
+    if (context == nullptr)
+        return;
+
+    int64_t ridesRated = 0;
+    for (auto _ : state)
+    {
+        for (const auto& ride : GetRideManager())
+        {
+            ride_ratings_update_ride(ride);
+            ridesRated++;
+        }
+    }
+    state.SetItemsProcessed(ridesRated);
+    state.counters["Rides"] = static_cast<double>(ridesRated) / std::max<int64_t>(state.iterations(), 1);
+}
+
+static void BM_map_update_tiles(benchmark::State& state, const std::string& filename)
+{
+    auto context = LoadBenchmarkPark(state, filename);
+    if (context == nullptr)
+        return;
+
+    for (auto _ : state)
+    {
+        map_update_tiles();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_entity_checksum(benchmark::State& state, const std::string& filename)
+{
+    auto context = LoadBenchmarkPark(state, filename);
+    if (context == nullptr)
+        return;
+
+    for (auto _ : state)
+    {
+        auto checksums = entity_checksum_tree();
+        benchmark::DoNotOptimize(checksums);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_snapshot_capture(benchmark::State& state, const std::string& filename)
+{
+    auto context = LoadBenchmarkPark(state, filename);
+    if (context == nullptr)
+        return;
+
+    auto* snapshots = context->GetGameStateSnapshots();
+    for (auto _ : state)
+    {
+        auto& snapshot = snapshots->CreateSnapshot();
+        snapshots->Capture(snapshot);
+        benchmark::DoNotOptimize(&snapshot);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Benchmarks are named after the file name rather than the path of the park so the results of different machines can
+// be compared over time, e.g. with --benchmark_out=<file> --benchmark_out_format=json.
+static void RegisterParkBenchmarks(const std::string& path)
+{
+    auto name = Path::GetFileName(path);
+    benchmark::RegisterBenchmark(name.c_str(), BM_update, path);
+    benchmark::RegisterBenchmark((name + "/guest_update").c_str(), BM_guest_update, path);
+    benchmark::RegisterBenchmark((name + "/pathfinding").c_str(), BM_pathfinding, path);
+    benchmark::RegisterBenchmark((name + "/vehicle_update").c_str(), BM_vehicle_update, path);
+    benchmark::RegisterBenchmark((name + "/ride_ratings").c_str(), BM_ride_ratings, path);
+    benchmark::RegisterBenchmark((name + "/map_update_tiles").c_str(), BM_map_update_tiles, path);
+    benchmark::RegisterBenchmark((name + "/entity_checksum").c_str(), BM_entity_checksum, path);
+    benchmark::RegisterBenchmark((name + "/snapshot_capture").c_str(), BM_snapshot_capture, path);
+    benchmark::RegisterBenchmark((name + "/entity_tile_queries").c_str(), BM_entity_tile_queries, path);
+}
+
 static int CmdlineForBenchSpriteSort(int argc, const char* const* argv)
 {
     // Add a baseline test on an empty park
@@ -99,13 +299,27 @@ static int CmdlineForBenchSpriteSort(int argc, const char* const* argv)
     // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
     argv_for_benchmark.push_back(nullptr);
 
-    // Extract file names from argument list. If there is no such file, consider it benchmark option.
+    // Extract file and directory names from argument list. If there is no such file, consider it benchmark option.
     for (int i = 0; i < argc; i++)
     {
         if (Platform::FileExists(argv[i]))
         {
-            // Register benchmark for sv6 if valid
-            benchmark::RegisterBenchmark(argv[i], BM_update, argv[i]);
+            RegisterParkBenchmarks(argv[i]);
+        }
+        else if (Path::DirectoryExists(argv[i]))
+        {
+            // Sort the parks so the benchmarks of a corpus always run in the same order.
+            std::vector<std::string> parks;
+            auto scanner = Path::ScanDirectory(Path::Combine(argv[i], BenchParkPattern), false);
+            while (scanner->Next())
+            {
+                parks.push_back(scanner->GetPath());
+            }
+            std::sort(parks.begin(), parks.end());
+            for (const auto& park : parks)
+            {
+                RegisterParkBenchmarks(park);
+            }
         }
         else
         {
@@ -149,7 +363,7 @@ const CommandLineCommand CommandLine::BenchUpdateCommands[]{
 #ifdef USE_BENCHMARK
     DefineCommand(
         "",
-        "<file>... [--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
+        "<file|directory>... [--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
         "[--benchmark_repetitions=<num_repetitions>] [--benchmark_report_aggregates_only={true|false}] "
         "[--benchmark_format=<console|json|csv>] [--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>] "
         "[--benchmark_color={auto|true|false}] [--benchmark_counters_tabular={true|false}] [--v=<verbosity>]",
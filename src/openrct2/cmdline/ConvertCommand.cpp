@@ -7,20 +7,53 @@
  * OpenRCT2 is licensed under the GNU General Public License version 3.
  *****************************************************************************/
 
+#include "../Context.h"
 #include "../FileClassifier.h"
 #include "../OpenRCT2.h"
 #include "../ParkImporter.h"
 #include "../common.h"
 #include "../core/Console.hpp"
+#include "../core/File.h"
+#include "../core/FileScanner.h"
+#include "../core/MemoryStream.h"
 #include "../core/Path.hpp"
+#include "../core/String.hpp"
 #include "../interface/Window.h"
+#include "../object/ObjectManager.h"
+#include "../platform/platform.h"
 #include "../rct2/S6Exporter.h"
+#include "../scenario/Scenario.h"
 #include "CommandLine.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <future>
 #include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace OpenRCT2;
+
+struct BatchConvertItem
+{
+    std::string SourcePath;
+    std::string DestinationPath;
+    uint32_t SourceFileType{};
+};
+
+struct PendingBatchWrite
+{
+    size_t ItemIndex{};
+    std::future<void> Result;
+};
 
 static void WriteConvertFromAndToMessage(uint32_t sourceFileType, uint32_t destinationFileType);
 static const utf8* GetFileTypeFriendlyName(uint32_t fileType);
+static std::vector<BatchConvertItem> GetBatchConvertItems(const std::string& source, const std::string& destinationDirectory);
+static std::unique_ptr<S6Exporter> ImportAndExportPark(
+    IContext& context, const BatchConvertItem& item, const std::vector<uint8_t>& data);
 
 exitcode_t CommandLine::HandleCommandConvert(CommandLineArgEnumerator* enumerator)
 {
@@ -55,9 +88,10 @@ exitcode_t CommandLine::HandleCommandConvert(CommandLineArgEnumerator* enumerato
     uint32_t destinationFileType = get_file_extension_type(destinationPath);
 
     // Validate target type
-    if (destinationFileType != FILE_EXTENSION_SC6 && destinationFileType != FILE_EXTENSION_SV6)
+    if (destinationFileType != FILE_EXTENSION_SC6 && destinationFileType != FILE_EXTENSION_SV6
+        && destinationFileType != FILE_EXTENSION_PARK)
     {
-        Console::Error::WriteLine("Only conversion to .SC6 or .SV4 is supported.");
+        Console::Error::WriteLine("Only conversion to .SC6, .SV6 or .PARK is supported.");
         return EXITCODE_FAIL;
     }
 
@@ -81,8 +115,15 @@ exitcode_t CommandLine::HandleCommandConvert(CommandLineArgEnumerator* enumerato
                 return EXITCODE_FAIL;
             }
             break;
+        case FILE_EXTENSION_PARK:
+            if (destinationFileType == FILE_EXTENSION_PARK)
+            {
+                Console::Error::WriteLine("File is already a park file.");
+                return EXITCODE_FAIL;
+            }
+            break;
         default:
-            Console::Error::WriteLine("Only conversion from .SC4, .SV4, .SC6 or .SV6 is supported.");
+            Console::Error::WriteLine("Only conversion from .SC4, .SV4, .SC6, .SV6 or .PARK is supported.");
             return EXITCODE_FAIL;
     }
 
@@ -122,6 +163,10 @@ exitcode_t CommandLine::HandleCommandConvert(CommandLineArgEnumerator* enumerato
         {
             exporter->SaveScenario(destinationPath);
         }
+        else if (destinationFileType == FILE_EXTENSION_PARK)
+        {
+            exporter->SaveParkFile(destinationPath);
+        }
         else
         {
             exporter->SaveGame(destinationPath);
@@ -137,6 +182,230 @@ exitcode_t CommandLine::HandleCommandConvert(CommandLineArgEnumerator* enumerato
     return EXITCODE_OK;
 }
 
+/**
+ * Converts all parks of a directory or listed in a manifest with one path per line. The parks are converted one at a
+ * time as they are imported into the global game state, but the files are read ahead and written behind the
+ * conversion on up to jobs threads, all using the same initialised context.
+ */
+exitcode_t CommandLine::HandleCommandConvertBatch(CommandLineArgEnumerator* enumerator)
+{
+    exitcode_t result = CommandLine::HandleCommandDefault();
+    if (result != EXITCODE_CONTINUE)
+    {
+        return result;
+    }
+
+    const utf8* rawSourcePath;
+    if (!enumerator->TryPopString(&rawSourcePath))
+    {
+        Console::Error::WriteLine("Expected a source directory or manifest.");
+        return EXITCODE_FAIL;
+    }
+
+    const utf8* rawDestinationPath;
+    if (!enumerator->TryPopString(&rawDestinationPath))
+    {
+        Console::Error::WriteLine("Expected a destination directory.");
+        return EXITCODE_FAIL;
+    }
+
+    int32_t jobs = static_cast<int32_t>(std::max(std::thread::hardware_concurrency(), 1U));
+    if (enumerator->TryPopInteger(&jobs) && jobs < 1)
+    {
+        Console::Error::WriteLine("The number of jobs must be at least 1.");
+        return EXITCODE_FAIL;
+    }
+    const auto maxPendingFiles = static_cast<size_t>(jobs);
+
+    auto sourcePath = Path::GetAbsolute(rawSourcePath);
+    auto destinationDirectory = Path::GetAbsolute(rawDestinationPath);
+    std::vector<BatchConvertItem> items;
+    try
+    {
+        items = GetBatchConvertItems(sourcePath, destinationDirectory);
+    }
+    catch (const std::exception& ex)
+    {
+        Console::Error::WriteLine("Unable to read '%s': %s", sourcePath.c_str(), ex.what());
+        return EXITCODE_FAIL;
+    }
+    if (items.empty())
+    {
+        Console::Error::WriteLine("No .SC4, .SV4, .SC6 or .SV6 files found.");
+        return EXITCODE_FAIL;
+    }
+
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    Console::WriteLine("Converting %zu parks using %d jobs...", items.size(), jobs);
+    const auto startTime = std::chrono::steady_clock::now();
+
+    size_t numFailed = 0;
+    auto reportFailure = [&numFailed, &items](size_t itemIndex, const char* message) {
+        Console::Error::WriteLine("Unable to convert '%s': %s", items[itemIndex].SourcePath.c_str(), message);
+        numFailed++;
+    };
+    auto finishWrite = [&reportFailure](PendingBatchWrite& write) {
+        try
+        {
+            write.Result.get();
+        }
+        catch (const std::exception& ex)
+        {
+            reportFailure(write.ItemIndex, ex.what());
+        }
+    };
+
+    std::deque<std::future<std::vector<uint8_t>>> reads;
+    std::deque<PendingBatchWrite> writes;
+    size_t nextRead = 0;
+    for (size_t i = 0; i < items.size(); i++)
+    {
+        for (; nextRead < items.size() && reads.size() < maxPendingFiles; nextRead++)
+        {
+            auto path = items[nextRead].SourcePath;
+            reads.push_back(std::async(std::launch::async, [path]() { return File::ReadAllBytes(path); }));
+        }
+
+        auto read = std::move(reads.front());
+        reads.pop_front();
+        try
+        {
+            const auto& item = items[i];
+            auto exporter = std::shared_ptr<S6Exporter>(ImportAndExportPark(*context, item, read.get()));
+            platform_ensure_directory_exists(Path::GetDirectory(item.DestinationPath).c_str());
+
+            while (writes.size() >= maxPendingFiles)
+            {
+                finishWrite(writes.front());
+                writes.pop_front();
+            }
+            auto isScenario = item.SourceFileType == FILE_EXTENSION_SC4 || item.SourceFileType == FILE_EXTENSION_SC6;
+            auto destinationPath = item.DestinationPath;
+            auto write = std::async(std::launch::async, [exporter, isScenario, destinationPath]() {
+                if (isScenario)
+                {
+                    exporter->SaveScenario(destinationPath.c_str());
+                }
+                else
+                {
+                    exporter->SaveGame(destinationPath.c_str());
+                }
+            });
+            writes.push_back({ i, std::move(write) });
+        }
+        catch (const std::exception& ex)
+        {
+            reportFailure(i, ex.what());
+        }
+    }
+    for (auto& write : writes)
+    {
+        finishWrite(write);
+    }
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+    auto numConverted = items.size() - numFailed;
+    Console::WriteLine("Converted %zu of %zu parks in %.3f s.", numConverted, items.size(), elapsed.count());
+    if (elapsed.count() > 0)
+    {
+        Console::WriteLine("%.2f parks per second.", numConverted / elapsed.count());
+    }
+    return numFailed == 0 ? EXITCODE_OK : EXITCODE_FAIL;
+}
+
+static std::vector<BatchConvertItem> GetBatchConvertItems(const std::string& source, const std::string& destinationDirectory)
+{
+    std::vector<BatchConvertItem> items;
+    auto addItem = [&items, &destinationDirectory](const std::string& path, const std::string& relativePath) {
+        auto fileType = get_file_extension_type(path.c_str());
+        const char* extension;
+        switch (fileType)
+        {
+            case FILE_EXTENSION_SC4:
+            case FILE_EXTENSION_SC6:
+                extension = ".sc6";
+                break;
+            case FILE_EXTENSION_SV4:
+            case FILE_EXTENSION_SV6:
+                extension = ".sv6";
+                break;
+            default:
+                Console::Error::WriteLine("Skipping '%s', only .SC4, .SV4, .SC6 or .SV6 are supported.", path.c_str());
+                return;
+        }
+
+        auto fileName = Path::GetFileNameWithoutExtension(relativePath) + extension;
+        auto destinationPath = Path::Combine(destinationDirectory, Path::GetDirectory(relativePath), fileName);
+        items.push_back({ path, destinationPath, fileType });
+    };
+
+    if (Path::DirectoryExists(source))
+    {
+        // Keep the directory structure so parks with the same name in different directories do not collide
+        auto scanner = Path::ScanDirectory(Path::Combine(source, "*.sc4;*.sv4;*.sc6;*.sv6"), true);
+        while (scanner->Next())
+        {
+            addItem(scanner->GetPath(), scanner->GetPathRelative());
+        }
+    }
+    else
+    {
+        for (const auto& line : File::ReadAllLines(source))
+        {
+            auto path = String::Trim(line);
+            if (!path.empty())
+            {
+                path = Path::GetAbsolute(path);
+                addItem(path, Path::GetFileName(path));
+            }
+        }
+    }
+    return items;
+}
+
+static std::unique_ptr<S6Exporter> ImportAndExportPark(
+    IContext& context, const BatchConvertItem& item, const std::vector<uint8_t>& data)
+{
+    std::unique_ptr<IParkImporter> importer;
+    if (item.SourceFileType == FILE_EXTENSION_SC4 || item.SourceFileType == FILE_EXTENSION_SV4)
+    {
+        importer = ParkImporter::CreateS4();
+    }
+    else
+    {
+        importer = ParkImporter::CreateS6(context.GetObjectRepository());
+    }
+
+    auto isScenario = item.SourceFileType == FILE_EXTENSION_SC4 || item.SourceFileType == FILE_EXTENSION_SC6;
+    auto stream = MemoryStream(data.data(), data.size());
+    auto result = importer->LoadFromStream(&stream, isScenario, false, item.SourcePath.c_str());
+    context.GetObjectManager().LoadObjects(result.RequiredObjects.data(), result.RequiredObjects.size());
+    importer->Import();
+    if (isScenario)
+    {
+        // We are converting a scenario, so reset the park
+        scenario_begin();
+    }
+
+    auto exporter = std::make_unique<S6Exporter>();
+
+    // HACK remove the main window so it saves the park with the
+    //      correct initial view
+    window_close_by_class(WC_MAIN_WINDOW);
+
+    exporter->Export();
+    return exporter;
+}
+
 static void WriteConvertFromAndToMessage(uint32_t sourceFileType, uint32_t destinationFileType)
 {
     const utf8* sourceFileTypeName = GetFileTypeFriendlyName(sourceFileType);
@@ -157,6 +426,8 @@ static const utf8* GetFileTypeFriendlyName(uint32_t fileType)
             return "RollerCoaster Tycoon 2 scenario";
         case FILE_EXTENSION_SV6:
             return "RollerCoaster Tycoon 2 saved game";
+        case FILE_EXTENSION_PARK:
+            return "OpenRCT2 park file";
     }
 
     assert(false);
@@ -0,0 +1,380 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Context.h"
+#include "../Game.h"
+#include "../GameState.h"
+#include "../OpenRCT2.h"
+#include "../ReplayManager.h"
+#include "../core/Console.hpp"
+#include "../core/Json.hpp"
+#include "../core/Memory.hpp"
+#include "../core/Path.hpp"
+#include "../drawing/X8DrawingEngine.h"
+#include "../interface/Viewport.h"
+#include "../platform/platform.h"
+#include "CommandLine.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace OpenRCT2;
+using namespace OpenRCT2::Drawing;
+
+// Size of the viewport rendered each tick with --render, centred on the saved view of the replayed park.
+static constexpr int32_t ReplayBenchRenderWidth = 1920;
+static constexpr int32_t ReplayBenchRenderHeight = 1080;
+
+static bool _render = false;
+static utf8* _baselinePath = nullptr;
+static utf8* _saveBaselinePath = nullptr;
+static float _threshold = 10.0f;
+
+// clang-format off
+static constexpr const CommandLineOptionDefinition ReplayBenchOptions[]
+{
+    { CMDLINE_TYPE_SWITCH, &_render,           NAC, "render",        "render a headless viewport every tick"                     },
+    { CMDLINE_TYPE_STRING, &_baselinePath,     NAC, "baseline",      "compare the results against a baseline written before"     },
+    { CMDLINE_TYPE_STRING, &_saveBaselinePath, NAC, "save-baseline", "write the results as a baseline to the given file"         },
+    { CMDLINE_TYPE_REAL,   &_threshold,        NAC, "threshold",     "percentage a baseline percentile may be exceeded by (10)"  },
+    OptionTableEnd
+};
+
+static exitcode_t HandleReplayBench(CommandLineArgEnumerator* argEnumerator);
+
+const CommandLineCommand CommandLine::ReplayBenchCommands[]
+{
+    // Main commands
+    DefineCommand("", "<replay>... [--render] [--baseline=<file>] [--save-baseline=<file>] [--threshold=<percent>]", ReplayBenchOptions, HandleReplayBench),
+    CommandTableEnd
+};
+// clang-format on
+
+struct ReplayBenchPercentiles
+{
+    double P50Ms{};
+    double P95Ms{};
+    double P99Ms{};
+    double MaxMs{};
+};
+
+struct ReplayBenchResult
+{
+    std::string Name;
+    size_t Ticks{};
+    ReplayBenchPercentiles Tick;
+    ReplayBenchPercentiles Render;
+    std::array<double, LOGIC_TIME_PART_COUNT> PartMeanMs{};
+};
+
+static ReplayBenchPercentiles GetPercentiles(std::vector<double>& samplesMs)
+{
+    ReplayBenchPercentiles result;
+    if (samplesMs.empty())
+    {
+        return result;
+    }
+
+    // Nearest rank, so that every reported value is a tick that actually happened.
+    std::sort(samplesMs.begin(), samplesMs.end());
+    auto percentile = [&samplesMs](double p) {
+        auto rank = static_cast<size_t>(std::ceil(p * samplesMs.size()));
+        return samplesMs[std::clamp<size_t>(rank, 1, samplesMs.size()) - 1];
+    };
+    result.P50Ms = percentile(0.50);
+    result.P95Ms = percentile(0.95);
+    result.P99Ms = percentile(0.99);
+    result.MaxMs = samplesMs.back();
+    return result;
+}
+
+static bool RunReplayBench(const std::string& path, ReplayBenchResult& result)
+{
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return false;
+    }
+
+    auto* replayManager = context->GetReplayManager();
+    if (!replayManager->StartPlayback(path))
+    {
+        Console::Error::WriteLine("Unable to start the replay '%s'.", path.c_str());
+        return false;
+    }
+
+    rct_viewport viewport{};
+    std::vector<uint8_t> pixels;
+    std::unique_ptr<X8DrawingEngine> drawingEngine;
+    rct_drawpixelinfo dpi;
+    if (_render)
+    {
+        viewport.width = ReplayBenchRenderWidth;
+        viewport.height = ReplayBenchRenderHeight;
+        viewport.zoom = gSavedViewZoom;
+        viewport.view_width = viewport.width * viewport.zoom;
+        viewport.view_height = viewport.height * viewport.zoom;
+        viewport.viewPos = gSavedView - ScreenCoordsXY{ viewport.view_width / 2, viewport.view_height / 2 };
+        gCurrentRotation = gSavedViewRotation;
+        reset_all_sprite_quadrant_placements();
+
+        pixels.resize(static_cast<size_t>(viewport.width) * viewport.height);
+        drawingEngine = std::make_unique<X8DrawingEngine>(context->GetUiContext());
+        dpi.bits = pixels.data();
+        dpi.width = viewport.width;
+        dpi.height = viewport.height;
+        dpi.DrawingEngine = drawingEngine.get();
+    }
+
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+    constexpr auto NotReported = std::chrono::duration<double>(-1);
+
+    std::vector<double> tickTimes;
+    std::vector<double> renderTimes;
+    std::array<double, LOGIC_TIME_PART_COUNT> partTotalMs{};
+    LogicTimings timings;
+    auto* gameState = context->GetGameState();
+    while (replayManager->IsReplaying())
+    {
+        // Parts are reported as the time since the start of the tick, parts a tick skips keep the sentinel.
+        auto timingIdx = timings.CurrentIdx;
+        for (size_t i = 0; i < LOGIC_TIME_PART_COUNT; i++)
+        {
+            timings.TimingInfo[static_cast<LogicTimePart>(i)][timingIdx] = NotReported;
+        }
+
+        auto tickStart = std::chrono::steady_clock::now();
+        gameState->UpdateLogic(&timings);
+        tickTimes.push_back(Milliseconds(std::chrono::steady_clock::now() - tickStart).count());
+
+        std::chrono::duration<double> partStart{};
+        for (size_t i = 0; i < LOGIC_TIME_PART_COUNT; i++)
+        {
+            auto partEnd = timings.TimingInfo[static_cast<LogicTimePart>(i)][timingIdx];
+            if (partEnd != NotReported)
+            {
+                partTotalMs[i] += Milliseconds(partEnd - partStart).count();
+                partStart = partEnd;
+            }
+        }
+
+        if (replayManager->IsPlaybackStateMismatching())
+        {
+            Console::Error::WriteLine("The replay '%s' no longer matches the recorded game state.", path.c_str());
+            return false;
+        }
+
+        if (_render)
+        {
+            auto renderStart = std::chrono::steady_clock::now();
+            viewport_render(&dpi, &viewport, 0, 0, viewport.width, viewport.height);
+            renderTimes.push_back(Milliseconds(std::chrono::steady_clock::now() - renderStart).count());
+        }
+    }
+
+    result.Name = Path::GetFileName(path);
+    result.Ticks = tickTimes.size();
+    result.Tick = GetPercentiles(tickTimes);
+    result.Render = GetPercentiles(renderTimes);
+    for (size_t i = 0; i < LOGIC_TIME_PART_COUNT; i++)
+    {
+        result.PartMeanMs[i] = result.Ticks != 0 ? partTotalMs[i] / result.Ticks : 0;
+    }
+    return true;
+}
+
+static void PrintResult(const ReplayBenchResult& result)
+{
+    auto printPercentiles = [](const char* name, const ReplayBenchPercentiles& percentiles) {
+        Console::WriteLine(
+            "  %-34s %9.3f %9.3f %9.3f %9.3f", name, percentiles.P50Ms, percentiles.P95Ms, percentiles.P99Ms,
+            percentiles.MaxMs);
+    };
+
+    Console::WriteLine("%s: %zu ticks", result.Name.c_str(), result.Ticks);
+    Console::WriteLine("  %-34s %9s %9s %9s %9s", "", "p50 ms", "p95 ms", "p99 ms", "max ms");
+    printPercentiles("Tick", result.Tick);
+    if (_render)
+    {
+        printPercentiles("Render", result.Render);
+    }
+    Console::WriteLine("  %-34s %9s", "", "mean ms");
+    for (size_t i = 0; i < LOGIC_TIME_PART_COUNT; i++)
+    {
+        Console::WriteLine("  %-34s %9.3f", GetLogicTimePartName(static_cast<LogicTimePart>(i)), result.PartMeanMs[i]);
+    }
+}
+
+static json_t PercentilesToJson(const ReplayBenchPercentiles& percentiles)
+{
+    return { { "p50", percentiles.P50Ms }, { "p95", percentiles.P95Ms }, { "p99", percentiles.P99Ms },
+             { "max", percentiles.MaxMs } };
+}
+
+static json_t ResultsToJson(const std::vector<ReplayBenchResult>& results)
+{
+    json_t replays = json_t::object();
+    for (const auto& result : results)
+    {
+        json_t parts = json_t::object();
+        for (size_t i = 0; i < LOGIC_TIME_PART_COUNT; i++)
+        {
+            parts[GetLogicTimePartName(static_cast<LogicTimePart>(i))] = result.PartMeanMs[i];
+        }
+
+        json_t replay = {
+            { "ticks", result.Ticks },
+            { "tick", PercentilesToJson(result.Tick) },
+            { "parts", parts },
+        };
+        if (_render)
+        {
+            replay["render"] = PercentilesToJson(result.Render);
+        }
+        replays[result.Name] = replay;
+    }
+    return { { "replays", replays } };
+}
+
+/**
+ * Compares the tick and render percentiles against the baseline, the breakdown per part is only printed to help
+ * finding the cause as parts are too short to be compared on their own.
+ * @returns false if any percentile exceeds its baseline by more than the threshold.
+ */
+static bool CompareWithBaseline(const std::vector<ReplayBenchResult>& results, const json_t& baseline)
+{
+    const auto factor = 1.0 + _threshold / 100.0;
+    auto replays = Json::AsObject(baseline["replays"]);
+
+    bool withinThreshold = true;
+    auto compare = [&](const std::string& replay, const char* name, const ReplayBenchPercentiles& current,
+                       const json_t& base) {
+        const std::pair<const char*, double> values[] = {
+            { "p50", current.P50Ms },
+            { "p95", current.P95Ms },
+            { "p99", current.P99Ms },
+        };
+        for (const auto& [key, value] : values)
+        {
+            auto baseValue = Json::GetNumber<double>(base[key]);
+            if (baseValue > 0 && value > baseValue * factor)
+            {
+                Console::WriteLine(
+                    "%s: %s %s regressed from %.3f ms to %.3f ms (+%.1f%%)", replay.c_str(), name, key, baseValue, value,
+                    (value / baseValue - 1.0) * 100.0);
+                withinThreshold = false;
+            }
+        }
+    };
+
+    for (const auto& result : results)
+    {
+        if (!replays.contains(result.Name))
+        {
+            Console::WriteLine("%s: not in the baseline.", result.Name.c_str());
+            continue;
+        }
+
+        auto base = Json::AsObject(replays[result.Name]);
+        compare(result.Name, "tick", result.Tick, Json::AsObject(base["tick"]));
+        if (_render && base.contains("render"))
+        {
+            compare(result.Name, "render", result.Render, Json::AsObject(base["render"]));
+        }
+
+        auto baseParts = Json::AsObject(base["parts"]);
+        for (size_t i = 0; i < LOGIC_TIME_PART_COUNT; i++)
+        {
+            const auto* partName = GetLogicTimePartName(static_cast<LogicTimePart>(i));
+            auto baseValue = Json::GetNumber<double>(baseParts[partName]);
+            if (baseValue > 0)
+            {
+                Console::WriteLine(
+                    "  %-34s %9.3f -> %9.3f ms (%+.1f%%)", partName, baseValue, result.PartMeanMs[i],
+                    (result.PartMeanMs[i] / baseValue - 1.0) * 100.0);
+            }
+        }
+    }
+    return withinThreshold;
+}
+
+static exitcode_t HandleReplayBench(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+
+    std::string baselinePath = _baselinePath != nullptr ? _baselinePath : "";
+    std::string saveBaselinePath = _saveBaselinePath != nullptr ? _saveBaselinePath : "";
+    Memory::Free(_baselinePath);
+    Memory::Free(_saveBaselinePath);
+
+    if (argc < 1)
+    {
+        Console::Error::WriteLine("Missing arguments <replay>...");
+        return EXITCODE_FAIL;
+    }
+
+    core_init();
+    gOpenRCT2Headless = true;
+    // Images are only needed to render the viewport.
+    gOpenRCT2NoGraphics = !_render;
+
+    std::vector<ReplayBenchResult> results;
+    for (int32_t i = 0; i < argc; i++)
+    {
+        ReplayBenchResult result;
+        if (!RunReplayBench(argv[i], result))
+        {
+            return EXITCODE_FAIL;
+        }
+        PrintResult(result);
+        results.push_back(std::move(result));
+    }
+
+    if (!saveBaselinePath.empty())
+    {
+        try
+        {
+            Json::WriteToFile(saveBaselinePath.c_str(), ResultsToJson(results));
+            Console::WriteLine("Baseline written to %s", saveBaselinePath.c_str());
+        }
+        catch (const std::exception& e)
+        {
+            Console::Error::WriteLine("Unable to write the baseline: %s", e.what());
+            return EXITCODE_FAIL;
+        }
+    }
+
+    if (!baselinePath.empty())
+    {
+        json_t baseline;
+        try
+        {
+            baseline = Json::ReadFromFile(baselinePath.c_str());
+        }
+        catch (const std::exception& e)
+        {
+            Console::Error::WriteLine("Unable to read the baseline: %s", e.what());
+            return EXITCODE_FAIL;
+        }
+        if (!CompareWithBaseline(results, baseline))
+        {
+            Console::Error::WriteLine("Performance regressed by more than %.1f%%.", _threshold);
+            return EXITCODE_FAIL;
+        }
+        Console::WriteLine("All replays are within %.1f%% of the baseline.", _threshold);
+    }
+    return EXITCODE_OK;
+}
@@ -16,6 +16,7 @@
 #include "../core/Guard.hpp"
 #include "../core/Memory.hpp"
 #include "../core/Path.hpp"
+#include "../core/StartupTimings.h"
 #include "../core/String.hpp"
 #include "../localisation/Language.h"
 #include "../network/network.h"
@@ -52,6 +53,8 @@ static bool _all = false;
 static bool _about = false;
 static bool _verbose = false;
 static bool _headless = false;
+static bool _memoryReport = false;
+static utf8* _startupTimings = nullptr;
 static utf8* _password = nullptr;
 static utf8* _userDataPath = nullptr;
 static utf8* _openrct2DataPath = nullptr;
@@ -69,6 +72,8 @@ static constexpr const CommandLineOptionDefinition StandardOptions[]
     { CMDLINE_TYPE_SWITCH,  &_about,            NAC, "about",              "show information about " OPENRCT2_NAME                      },
     { CMDLINE_TYPE_SWITCH,  &_verbose,          NAC, "verbose",            "log verbose messages"                                       },
     { CMDLINE_TYPE_SWITCH,  &_headless,         NAC, "headless",           "run " OPENRCT2_NAME " headless" IMPLIES_SILENT_BREAKPAD     },
+    { CMDLINE_TYPE_SWITCH,  &_memoryReport,     NAC, "memory-report",      "print the memory held by each subsystem once loaded and exit" },
+    { CMDLINE_TYPE_STRING,  &_startupTimings,   NAC, "startup-timings",    "write the time taken by each start up phase to a JSON file" },
 #ifndef DISABLE_NETWORK                                                    
     { CMDLINE_TYPE_INTEGER, &_port,             NAC, "port",               "port to use for hosting or joining a server"                },
     { CMDLINE_TYPE_STRING,  &_address,          NAC, "address",            "address to listen on when hosting a server"                 },
@@ -128,6 +133,7 @@ const CommandLineCommand CommandLine::RootCommands[]
 #endif
     DefineCommand("set-rct2", "<path>",                 StandardOptions, HandleCommandSetRCT2),
     DefineCommand("convert",  "<source> <destination>", StandardOptions, CommandLine::HandleCommandConvert),
+    DefineCommand("convert-batch", "<source directory|manifest> <destination directory> [jobs]", StandardOptions, CommandLine::HandleCommandConvertBatch),
     DefineCommand("scan-objects", "<path>",             StandardOptions, HandleCommandScanObjects),
     DefineCommand("handle-uri", "openrct2://.../",      StandardOptions, CommandLine::HandleCommandUri),
 
@@ -139,9 +145,12 @@ const CommandLineCommand CommandLine::RootCommands[]
     DefineSubCommand("screenshot",      CommandLine::ScreenshotCommands       ),
     DefineSubCommand("sprite",          CommandLine::SpriteCommands           ),
     DefineSubCommand("benchgfx",        CommandLine::BenchGfxCommands         ),
+    DefineSubCommand("benchpathfind",   CommandLine::BenchPathfindCommands    ),
+    DefineSubCommand("benchrender",     CommandLine::BenchRenderCommands      ),
     DefineSubCommand("benchspritesort", CommandLine::BenchSpriteSortCommands  ),
     DefineSubCommand("benchsimulate",   CommandLine::BenchUpdateCommands      ),
     DefineSubCommand("simulate",        CommandLine::SimulateCommands         ),
+    DefineSubCommand("replay-bench",    CommandLine::ReplayBenchCommands      ),
     CommandTableEnd
 };
 
@@ -195,6 +204,13 @@ exitcode_t CommandLine::HandleCommandDefault()
 
     gOpenRCT2Headless = _headless;
     gOpenRCT2NoGraphics = _headless;
+    gOpenRCT2MemoryReport = _memoryReport;
+
+    if (_startupTimings != nullptr)
+    {
+        OpenRCT2::StartupTimings::SetReportPath(_startupTimings);
+        Memory::Free(_startupTimings);
+    }
     gOpenRCT2SilentBreakpad = _silentBreakpad || _headless;
 
     if (_userDataPath != nullptr)
@@ -35,6 +35,7 @@ const CommandLineCommand CommandLine::ScreenshotCommands[]
     // Main commands
     DefineCommand("", "<file> <output_image> <width> <height> [<x> <y> <zoom> <rotation>]", ScreenshotOptionsDef, HandleScreenshot),
     DefineCommand("", "<file> <output_image> giant <zoom> <rotation>",                      ScreenshotOptionsDef, HandleScreenshot),
+    DefineCommand("", "batch",                                                              ScreenshotOptionsDef, HandleScreenshot),
     CommandTableEnd
 };
 // clang-format on
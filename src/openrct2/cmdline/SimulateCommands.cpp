@@ -17,6 +17,7 @@
 #include "../world/Sprite.h"
 #include "CommandLine.hpp"
 
+#include <chrono>
 #include <cstdlib>
 #include <memory>
 
@@ -59,11 +60,19 @@ static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator)
         }
 
         Console::WriteLine("Running %d ticks...", ticks);
+        auto* gameState = context->GetGameState();
+        const auto startTime = std::chrono::steady_clock::now();
         for (uint32_t i = 0; i < ticks; i++)
         {
-            context->GetGameState()->UpdateLogic();
+            gameState->UpdateLogic();
         }
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
         Console::WriteLine("Completed: %s", sprite_checksum().ToString().c_str());
+        if (elapsed.count() > 0)
+        {
+            Console::WriteLine(
+                "Simulated %u ticks in %.3f s (%.0f ticks per second)", ticks, elapsed.count(), ticks / elapsed.count());
+        }
     }
     else
     {
@@ -15,6 +15,7 @@
 #include "../core/Console.hpp"
 #include "../core/File.h"
 #include "../core/FileStream.h"
+#include "../core/Imaging.h"
 #include "../core/Memory.hpp"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
@@ -183,6 +184,7 @@ namespace Config
                 "drawing_engine", DrawingEngine::Software, Enum_DrawingEngine);
             model->uncap_fps = reader->GetBoolean("uncap_fps", false);
             model->use_vsync = reader->GetBoolean("use_vsync", true);
+            model->low_latency_input = reader->GetBoolean("low_latency_input", false);
             model->virtual_floor_style = reader->GetEnum<VirtualFloorStyles>(
                 "virtual_floor_style", VirtualFloorStyles::Glassy, Enum_VirtualFloorStyle);
             model->date_format = reader->GetEnum<int32_t>("date_format", platform_get_locale_date_format(), Enum_DateFormat);
@@ -209,6 +211,7 @@ namespace Config
                 "scale_quality", ScaleQuality::SmoothNearestNeighbour, Enum_ScaleQuality);
             model->show_fps = reader->GetBoolean("show_fps", false);
             model->multithreading = reader->GetBoolean("multi_threading", false);
+            model->texture_memory_budget = reader->GetInt32("texture_memory_budget", 0);
             model->trap_cursor = reader->GetBoolean("trap_cursor", false);
             model->auto_open_shops = reader->GetBoolean("auto_open_shops", false);
             model->scenario_select_mode = reader->GetInt32("scenario_select_mode", SCENARIO_SELECT_MODE_ORIGIN);
@@ -223,10 +226,17 @@ namespace Config
             model->zoom_to_cursor = reader->GetBoolean("zoom_to_cursor", true);
             model->render_weather_effects = reader->GetBoolean("render_weather_effects", true);
             model->render_weather_gloom = reader->GetBoolean("render_weather_gloom", true);
+            model->low_detail_zoom_level = reader->GetInt32("low_detail_zoom_level", 2);
             model->show_guest_purchases = reader->GetBoolean("show_guest_purchases", false);
             model->show_real_names_of_guests = reader->GetBoolean("show_real_names_of_guests", true);
             model->allow_early_completion = reader->GetBoolean("allow_early_completion", false);
+            model->tick_watchdog_threshold = reader->GetInt32("tick_watchdog_threshold", 0);
+            model->tick_watchdog_max_dumps = reader->GetInt32("tick_watchdog_max_dumps", 10);
+            model->worker_threads = reader->GetInt32("worker_threads", 0);
+            model->worker_thread_first_cpu = reader->GetInt32("worker_thread_first_cpu", -1);
             model->transparent_screenshot = reader->GetBoolean("transparent_screenshot", true);
+            model->screenshot_compression_level = reader->GetInt32(
+                "screenshot_compression_level", PngWriteOptions::DefaultCompressionLevel);
             model->transparent_water = reader->GetBoolean("transparent_water", true);
             model->last_version_check_time = reader->GetInt64("last_version_check_time", 0);
         }
@@ -266,6 +276,7 @@ namespace Config
         writer->WriteEnum<DrawingEngine>("drawing_engine", model->drawing_engine, Enum_DrawingEngine);
         writer->WriteBoolean("uncap_fps", model->uncap_fps);
         writer->WriteBoolean("use_vsync", model->use_vsync);
+        writer->WriteBoolean("low_latency_input", model->low_latency_input);
         writer->WriteEnum<int32_t>("date_format", model->date_format, Enum_DateFormat);
         writer->WriteBoolean("auto_staff", model->auto_staff_placement);
         writer->WriteBoolean("handymen_mow_default", model->handymen_mow_default);
@@ -286,6 +297,7 @@ namespace Config
         writer->WriteEnum<ScaleQuality>("scale_quality", model->scale_quality, Enum_ScaleQuality);
         writer->WriteBoolean("show_fps", model->show_fps);
         writer->WriteBoolean("multi_threading", model->multithreading);
+        writer->WriteInt32("texture_memory_budget", model->texture_memory_budget);
         writer->WriteBoolean("trap_cursor", model->trap_cursor);
         writer->WriteBoolean("auto_open_shops", model->auto_open_shops);
         writer->WriteInt32("scenario_select_mode", model->scenario_select_mode);
@@ -300,11 +312,17 @@ namespace Config
         writer->WriteBoolean("zoom_to_cursor", model->zoom_to_cursor);
         writer->WriteBoolean("render_weather_effects", model->render_weather_effects);
         writer->WriteBoolean("render_weather_gloom", model->render_weather_gloom);
+        writer->WriteInt32("low_detail_zoom_level", model->low_detail_zoom_level);
         writer->WriteBoolean("show_guest_purchases", model->show_guest_purchases);
         writer->WriteBoolean("show_real_names_of_guests", model->show_real_names_of_guests);
         writer->WriteBoolean("allow_early_completion", model->allow_early_completion);
+        writer->WriteInt32("tick_watchdog_threshold", model->tick_watchdog_threshold);
+        writer->WriteInt32("tick_watchdog_max_dumps", model->tick_watchdog_max_dumps);
+        writer->WriteInt32("worker_threads", model->worker_threads);
+        writer->WriteInt32("worker_thread_first_cpu", model->worker_thread_first_cpu);
         writer->WriteEnum<VirtualFloorStyles>("virtual_floor_style", model->virtual_floor_style, Enum_VirtualFloorStyle);
         writer->WriteBoolean("transparent_screenshot", model->transparent_screenshot);
+        writer->WriteInt32("screenshot_compression_level", model->screenshot_compression_level);
         writer->WriteBoolean("transparent_water", model->transparent_water);
         writer->WriteInt64("last_version_check_time", model->last_version_check_time);
     }
@@ -422,6 +440,8 @@ namespace Config
             model->log_server_actions = reader->GetBoolean("log_server_actions", false);
             model->pause_server_if_no_clients = reader->GetBoolean("pause_server_if_no_clients", false);
             model->desync_debugging = reader->GetBoolean("desync_debugging", false);
+            model->metrics_port = reader->GetInt32("metrics_port", 0);
+            model->metrics_address = reader->GetString("metrics_address", "");
         }
     }
 
@@ -449,6 +469,8 @@ namespace Config
         writer->WriteBoolean("log_server_actions", model->log_server_actions);
         writer->WriteBoolean("pause_server_if_no_clients", model->pause_server_if_no_clients);
         writer->WriteBoolean("desync_debugging", model->desync_debugging);
+        writer->WriteInt32("metrics_port", model->metrics_port);
+        writer->WriteString("metrics_address", model->metrics_address);
     }
 
     static void ReadNotifications(IIniReader* reader)
@@ -550,6 +572,7 @@ namespace Config
             auto model = &gConfigPlugin;
             model->enable_hot_reloading = reader->GetBoolean("enable_hot_reloading", false);
             model->allowed_hosts = reader->GetString("allowed_hosts", "");
+            model->call_time_budget = reader->GetInt32("call_time_budget", 0);
         }
     }
 
@@ -559,6 +582,7 @@ namespace Config
         writer->WriteSection("plugin");
         writer->WriteBoolean("enable_hot_reloading", model->enable_hot_reloading);
         writer->WriteString("allowed_hosts", model->allowed_hosts);
+        writer->WriteInt32("call_time_budget", model->call_time_budget);
     }
 
     static bool SetDefaults()
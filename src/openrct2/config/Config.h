@@ -40,8 +40,10 @@ struct GeneralConfiguration
     ScaleQuality scale_quality;
     bool uncap_fps;
     bool use_vsync;
+    bool low_latency_input;
     bool show_fps;
     bool multithreading;
+    int32_t texture_memory_budget;
     bool minimize_fullscreen_focus_loss;
     bool disable_screensaver;
 
@@ -55,9 +57,11 @@ struct GeneralConfiguration
     bool upper_case_banners;
     bool render_weather_effects;
     bool render_weather_gloom;
+    int32_t low_detail_zoom_level;
     bool disable_lightning_effect;
     bool show_guest_purchases;
     bool transparent_screenshot;
+    int32_t screenshot_compression_level;
     bool transparent_water;
 
     // Localisation
@@ -97,6 +101,10 @@ struct GeneralConfiguration
     bool steam_overlay_pause;
     bool show_real_names_of_guests;
     bool allow_early_completion;
+    int32_t tick_watchdog_threshold;
+    int32_t tick_watchdog_max_dumps;
+    int32_t worker_threads;
+    int32_t worker_thread_first_cpu;
 
     // Loading and saving
     bool confirmation_prompt;
@@ -162,6 +170,8 @@ struct NetworkConfiguration
     bool log_server_actions;
     bool pause_server_if_no_clients;
     bool desync_debugging;
+    int32_t metrics_port;
+    std::string metrics_address;
 };
 
 struct NotificationConfiguration
@@ -208,6 +218,7 @@ struct PluginConfiguration
 {
     bool enable_hot_reloading;
     std::string allowed_hosts;
+    int32_t call_time_budget;
 };
 
 enum class Sort : int32_t
@@ -9,8 +9,6 @@
 
 #include "ChecksumStream.h"
 
-#include "Endianness.h"
-
 #include <cstddef>
 
 namespace OpenRCT2
@@ -25,21 +23,10 @@ namespace OpenRCT2
 
     void ChecksumStream::Write(const void* buffer, uint64_t length)
     {
-        uint64_t* hash = reinterpret_cast<uint64_t*>(_checksum.data());
         for (size_t i = 0; i < length; i += sizeof(uint64_t))
         {
             const auto maxLen = std::min<size_t>(sizeof(uint64_t), length - i);
-
-            uint64_t temp{};
-            std::memcpy(&temp, reinterpret_cast<const std::byte*>(buffer) + i, maxLen);
-
-            // Always use value as little endian, most common systems are little.
-#    if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
-            temp = ByteSwapBE(temp);
-#    endif
-
-            *hash ^= temp;
-            *hash *= Prime;
+            Mix(reinterpret_cast<const std::byte*>(buffer) + i, maxLen);
         }
     }
 
@@ -10,8 +10,12 @@
 #pragma once
 
 #include "../common.h"
+#include "Endianness.h"
 #include "IStream.hpp"
 
+#include <algorithm>
+#include <cstring>
+
 namespace OpenRCT2
 {
     /**
@@ -25,6 +29,22 @@ namespace OpenRCT2
         static constexpr uint64_t Seed = 0xcbf29ce484222325ULL;
         static constexpr uint64_t Prime = 0x00000100000001B3ULL;
 
+        // Folds up to 8 bytes into the hash, zero padded, as one chunk.
+        void Mix(const std::byte* data, size_t length)
+        {
+            uint64_t temp{};
+            std::memcpy(&temp, data, length);
+
+            // Always use value as little endian, most common systems are little.
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+            temp = ByteSwapBE(temp);
+#endif
+
+            uint64_t* hash = reinterpret_cast<uint64_t*>(_checksum.data());
+            *hash ^= temp;
+            *hash *= Prime;
+        }
+
     public:
         ChecksumStream(std::array<std::byte, 20>& buf);
 
@@ -96,9 +116,16 @@ namespace OpenRCT2
             Write<16>(buffer);
         }
 
+        /**
+         * Same result as Write(buffer, N), but the size is known so the chunk loop unrolls for the single fields the
+         * serialiser writes.
+         */
         template<size_t N> void Write(const void* buffer)
         {
-            Write(buffer, N);
+            for (size_t i = 0; i < N; i += sizeof(uint64_t))
+            {
+                Mix(reinterpret_cast<const std::byte*>(buffer) + i, std::min(sizeof(uint64_t), N - i));
+            }
         }
 
         uint64_t TryRead(void* buffer, uint64_t length) override
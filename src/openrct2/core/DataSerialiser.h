@@ -12,19 +12,148 @@
 #include "DataSerialiserTraits.h"
 #include "MemoryStream.h"
 
+#include <array>
 #include <type_traits>
 
+/**
+ * Fixed size values that can be copied straight into or out of a memory stream, without going through their
+ * DataSerializerTraits and the virtual stream interface for every field. The bytes written must be the same as the
+ * ones of the traits: integers are byte swapped, enums and booleans are stored as they are in memory.
+ */
+template<typename T, typename = void> struct DataSerialiserDirect
+{
+    static constexpr bool Enabled = false;
+};
+
+template<typename T> struct DataSerialiserDirectScalar
+{
+    static constexpr bool Enabled = true;
+    static constexpr bool NeedsSwap = std::is_integral_v<T> && !std::is_same_v<T, bool> && sizeof(T) > 1;
+
+    static T Convert(T value)
+    {
+        if constexpr (NeedsSwap)
+            return ByteSwapBE(value);
+        else
+            return value;
+    }
+
+    static void Encode(OpenRCT2::MemoryStream& stream, const T& value)
+    {
+        T temp = Convert(value);
+        stream.Write<sizeof(T)>(&temp);
+    }
+
+    static void Decode(OpenRCT2::MemoryStream& stream, T& value)
+    {
+        T temp;
+        stream.Read<sizeof(T)>(&temp);
+        value = Convert(temp);
+    }
+};
+
+// Only the integers that use DataSerializerTraitsIntegral, other integral types may be encoded differently.
+template<typename T>
+struct DataSerialiserDirect<
+    T, std::enable_if_t<std::is_integral_v<T> && std::is_base_of_v<DataSerializerTraitsIntegral<T>, DataSerializerTraits<T>>>>
+    : public DataSerialiserDirectScalar<T>
+{
+};
+
+template<typename T>
+struct DataSerialiserDirect<T, std::enable_if_t<std::is_enum_v<T> || std::is_same_v<T, bool>>>
+    : public DataSerialiserDirectScalar<T>
+{
+};
+
+/**
+ * A run of direct values with a 16 bit length prefix, written as a single block.
+ */
+template<typename T, size_t TSize> struct DataSerialiserDirectArray
+{
+    static constexpr bool Enabled = true;
+    using Element = DataSerialiserDirect<T>;
+
+    static void Encode(OpenRCT2::MemoryStream& stream, const T* values)
+    {
+        uint16_t len = ByteSwapBE(static_cast<uint16_t>(TSize));
+        stream.Write<sizeof(len)>(&len);
+        if constexpr (Element::NeedsSwap)
+        {
+            std::array<T, TSize> temp;
+            for (size_t i = 0; i < TSize; i++)
+                temp[i] = Element::Convert(values[i]);
+            stream.Write(temp.data(), sizeof(temp));
+        }
+        else
+        {
+            stream.Write(values, sizeof(T) * TSize);
+        }
+    }
+
+    static void Decode(OpenRCT2::MemoryStream& stream, T* values)
+    {
+        uint16_t len;
+        stream.Read<sizeof(len)>(&len);
+        if (ByteSwapBE(len) != TSize)
+            throw std::runtime_error("Invalid size, can't decode");
+
+        stream.Read(values, sizeof(T) * TSize);
+        if constexpr (Element::NeedsSwap)
+        {
+            for (size_t i = 0; i < TSize; i++)
+                values[i] = Element::Convert(values[i]);
+        }
+    }
+};
+
+// C arrays only for the element types DataSerializerTraitsPODArray is used for.
+template<typename T, size_t TSize>
+struct DataSerialiserDirect<
+    T[TSize], std::enable_if_t<std::is_base_of_v<DataSerializerTraitsPODArray<T, TSize>, DataSerializerTraits<T[TSize]>>>>
+    : public DataSerialiserDirectArray<T, TSize>
+{
+    static void Encode(OpenRCT2::MemoryStream& stream, const T (&values)[TSize])
+    {
+        DataSerialiserDirectArray<T, TSize>::Encode(stream, values);
+    }
+
+    static void Decode(OpenRCT2::MemoryStream& stream, T (&values)[TSize])
+    {
+        DataSerialiserDirectArray<T, TSize>::Decode(stream, values);
+    }
+};
+
+template<typename T, size_t TSize>
+struct DataSerialiserDirect<std::array<T, TSize>, std::enable_if_t<DataSerialiserDirect<T>::Enabled>>
+    : public DataSerialiserDirectArray<T, TSize>
+{
+    static void Encode(OpenRCT2::MemoryStream& stream, const std::array<T, TSize>& values)
+    {
+        DataSerialiserDirectArray<T, TSize>::Encode(stream, values.data());
+    }
+
+    static void Decode(OpenRCT2::MemoryStream& stream, std::array<T, TSize>& values)
+    {
+        DataSerialiserDirectArray<T, TSize>::Decode(stream, values.data());
+    }
+};
+
 class DataSerialiser
 {
 private:
     OpenRCT2::MemoryStream _stream;
     OpenRCT2::IStream& _activeStream;
+    // Set when the active stream is a memory stream and the serialiser is not logging, direct values are then copied
+    // into it without calling through the stream interface.
+    OpenRCT2::MemoryStream* _memoryStream = nullptr;
     bool _isSaving = false;
     bool _isLogging = false;
 
 public:
     DataSerialiser(bool isSaving)
         : _activeStream(_stream)
+        , _memoryStream(&_stream)
         , _isSaving(isSaving)
         , _isLogging(false)
     {
@@ -32,6 +161,7 @@ public:
 
     DataSerialiser(bool isSaving, OpenRCT2::IStream& stream, bool isLogging = false)
         : _activeStream(stream)
+        , _memoryStream(isLogging ? nullptr : dynamic_cast<OpenRCT2::MemoryStream*>(&stream))
         , _isSaving(isSaving)
         , _isLogging(isLogging)
     {
@@ -59,6 +189,18 @@ public:
 
     template<typename T> DataSerialiser& operator<<(const T& data)
     {
+        if constexpr (DataSerialiserDirect<T>::Enabled)
+        {
+            if (_memoryStream != nullptr)
+            {
+                if (_isSaving)
+                    DataSerialiserDirect<T>::Encode(*_memoryStream, data);
+                else
+                    DataSerialiserDirect<T>::Decode(*_memoryStream, const_cast<T&>(data));
+                return *this;
+            }
+        }
+
         if (!_isLogging)
         {
             if (_isSaving)
@@ -17,11 +17,13 @@
 #include "FileStream.h"
 #include "JobPool.h"
 #include "Path.hpp"
+#include "StartupTimings.h"
 
 #include <chrono>
-#include <list>
+#include <optional>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 template<typename TItem> class FileIndex
@@ -35,18 +37,41 @@ private:
         uint32_t PathChecksum = 0;
     };
 
+    struct ScannedFile
+    {
+        std::string Path;
+        uint64_t Size = 0;
+        uint64_t LastModified = 0;
+    };
+
     struct ScanResult
     {
         DirectoryStats const Stats;
-        std::vector<std::string> const Files;
+        std::vector<ScannedFile> const Files;
 
-        ScanResult(DirectoryStats stats, std::vector<std::string> files)
+        ScanResult(DirectoryStats stats, std::vector<ScannedFile> files)
             : Stats(stats)
-            , Files(files)
+            , Files(std::move(files))
         {
         }
     };
 
+    /**
+     * A file as it was recorded in the index, the item is only valid if the file could be indexed.
+     */
+    struct IndexedFile
+    {
+        ScannedFile File;
+        bool HasItem = false;
+        TItem Item{};
+    };
+
+    struct IndexData
+    {
+        DirectoryStats Stats;
+        std::vector<IndexedFile> Files;
+    };
+
     struct FileIndexHeader
     {
         uint32_t HeaderSize = sizeof(FileIndexHeader);
@@ -55,11 +80,11 @@ private:
         uint8_t VersionB = 0;
         uint16_t LanguageId = 0;
         DirectoryStats Stats;
-        uint32_t NumItems = 0;
+        uint32_t NumFiles = 0;
     };
 
     // Index file format version which when incremented forces a rebuild
-    static constexpr uint8_t FILE_INDEX_VERSION = 4;
+    static constexpr uint8_t FILE_INDEX_VERSION = 5;
 
     std::string const _name;
     uint32_t const _magicNumber;
@@ -95,31 +120,37 @@ public:
     virtual ~FileIndex() = default;
 
     /**
-     * Queries and directories and loads the index header. If the index is up to date,
-     * the items are loaded from the index and returned, otherwise the index is rebuilt.
+     * Queries and directories and loads the index. If the index is up to date, the items are loaded from the index and
+     * returned, otherwise only the files that were added or changed since the index was written are indexed again.
      */
     std::vector<TItem> LoadOrBuild(int32_t language) const
     {
-        std::vector<TItem> items;
         auto scanResult = Scan();
-        auto readIndexResult = ReadIndexFile(language, scanResult.Stats);
-        if (std::get<0>(readIndexResult))
+        auto indexData = ReadIndexFile(language);
+        if (indexData.has_value())
         {
-            // Index was loaded
-            items = std::get<1>(readIndexResult);
-        }
-        else
-        {
-            // Index was not loaded
-            items = Build(language, scanResult);
+            const auto& stats = indexData->Stats;
+            if (stats.TotalFiles == scanResult.Stats.TotalFiles && stats.TotalFileSize == scanResult.Stats.TotalFileSize
+                && stats.FileDateModifiedChecksum == scanResult.Stats.FileDateModifiedChecksum
+                && stats.PathChecksum == scanResult.Stats.PathChecksum)
+            {
+                // Directory is the same, just use the saved items
+                OpenRCT2::StartupTimings::RecordIndexStatus(_name, OpenRCT2::StartupTimings::IndexStatus::Warm);
+                return GetItems(indexData->Files);
+            }
+
+            Console::WriteLine("%s out of date", _name.c_str());
+            OpenRCT2::StartupTimings::RecordIndexStatus(_name, OpenRCT2::StartupTimings::IndexStatus::Updated);
+            return Build(language, scanResult, std::move(indexData->Files));
         }
-        return items;
+        OpenRCT2::StartupTimings::RecordIndexStatus(_name, OpenRCT2::StartupTimings::IndexStatus::Cold);
+        return Build(language, scanResult, {});
     }
 
     std::vector<TItem> Rebuild(int32_t language) const
     {
         auto scanResult = Scan();
-        auto items = Build(language, scanResult);
+        auto items = Build(language, scanResult, {});
         return items;
     }
 
@@ -139,7 +170,7 @@ private:
     ScanResult Scan() const
     {
         DirectoryStats stats{};
-        std::vector<std::string> files;
+        std::vector<ScannedFile> files;
         for (const auto& directory : SearchPaths)
         {
             auto absoluteDirectory = Path::GetAbsolute(directory);
@@ -159,52 +190,88 @@ private:
                 stats.FileDateModifiedChecksum = ror32(stats.FileDateModifiedChecksum, 5);
                 stats.PathChecksum += GetPathChecksum(path);
 
-                files.push_back(std::move(path));
+                files.push_back({ std::move(path), fileInfo->Size, fileInfo->LastModified });
             }
         }
         return ScanResult(stats, files);
     }
 
     void BuildRange(
-        int32_t language, const ScanResult& scanResult, size_t rangeStart, size_t rangeEnd, std::vector<TItem>& items,
-        std::atomic<size_t>& processed, std::mutex& printLock) const
+        int32_t language, std::vector<IndexedFile>& files, const std::vector<size_t>& filesToIndex, size_t rangeStart,
+        size_t rangeEnd, std::atomic<size_t>& processed, std::mutex& printLock) const
     {
-        items.reserve(rangeEnd - rangeStart);
         for (size_t i = rangeStart; i < rangeEnd; i++)
         {
-            const auto& filePath = scanResult.Files.at(i);
+            auto& file = files[filesToIndex[i]];
 
             if (_log_levels[static_cast<uint8_t>(DiagnosticLevel::Verbose)])
             {
                 std::lock_guard<std::mutex> lock(printLock);
-                log_verbose("FileIndex:Indexing '%s'", filePath.c_str());
+                log_verbose("FileIndex:Indexing '%s'", file.File.Path.c_str());
             }
 
-            auto item = Create(language, filePath);
-            if (std::get<0>(item))
+            auto item = Create(language, file.File.Path);
+            file.HasItem = std::get<0>(item);
+            if (file.HasItem)
             {
-                items.push_back(std::get<1>(item));
+                file.Item = std::move(std::get<1>(item));
             }
 
             processed++;
         }
     }
 
-    std::vector<TItem> Build(int32_t language, const ScanResult& scanResult) const
+    /**
+     * Indexes the scanned files. Files that are listed in the previous index with the same size and modification date
+     * keep their indexed item, all other files are passed to Create.
+     */
+    std::vector<TItem> Build(int32_t language, const ScanResult& scanResult, std::vector<IndexedFile> previousFiles) const
     {
-        std::vector<TItem> allItems;
-        Console::WriteLine("Building %s (%zu items)", _name.c_str(), scanResult.Files.size());
+        std::unordered_map<std::string, IndexedFile*> previousFilesByPath;
+        previousFilesByPath.reserve(previousFiles.size());
+        for (auto& previousFile : previousFiles)
+        {
+            previousFilesByPath.emplace(previousFile.File.Path, &previousFile);
+        }
+
+        std::vector<IndexedFile> files(scanResult.Files.size());
+        std::vector<size_t> filesToIndex;
+        for (size_t i = 0; i < scanResult.Files.size(); i++)
+        {
+            const auto& scannedFile = scanResult.Files[i];
+            files[i].File = scannedFile;
+
+            auto it = previousFilesByPath.find(scannedFile.Path);
+            if (it != previousFilesByPath.end() && it->second->File.Size == scannedFile.Size
+                && it->second->File.LastModified == scannedFile.LastModified)
+            {
+                files[i].HasItem = it->second->HasItem;
+                files[i].Item = std::move(it->second->Item);
+            }
+            else
+            {
+                filesToIndex.push_back(i);
+            }
+        }
+
+        if (previousFiles.empty())
+        {
+            Console::WriteLine("Building %s (%zu items)", _name.c_str(), filesToIndex.size());
+        }
+        else
+        {
+            Console::WriteLine(
+                "Updating %s (%zu of %zu items changed)", _name.c_str(), filesToIndex.size(), scanResult.Files.size());
+        }
 
         auto startTime = std::chrono::high_resolution_clock::now();
 
-        const size_t totalCount = scanResult.Files.size();
+        const size_t totalCount = filesToIndex.size();
         if (totalCount > 0)
         {
             JobPool jobPool;
             std::mutex printLock; // For verbose prints.
 
-            std::list<std::vector<TItem>> containers;
-
             size_t stepSize = 100; // Handpicked, seems to work well with 4/8 cores.
 
             std::atomic<size_t> processed = ATOMIC_VAR_INIT(0);
@@ -221,77 +288,96 @@ private:
                     stepSize = totalCount - rangeStart;
                 }
 
-                auto& items = containers.emplace_back();
-
                 jobPool.AddTask(std::bind(
-                    &FileIndex<TItem>::BuildRange, this, language, std::cref(scanResult), rangeStart, rangeStart + stepSize,
-                    std::ref(items), std::ref(processed), std::ref(printLock)));
+                    &FileIndex<TItem>::BuildRange, this, language, std::ref(files), std::cref(filesToIndex), rangeStart,
+                    rangeStart + stepSize, std::ref(processed), std::ref(printLock)));
 
                 reportProgress();
             }
 
             jobPool.Join(reportProgress);
-
-            for (const auto& itr : containers)
-            {
-                allItems.insert(allItems.end(), itr.begin(), itr.end());
-            }
         }
 
-        WriteIndexFile(language, scanResult.Stats, allItems);
+        WriteIndexFile(language, scanResult.Stats, files);
 
         auto endTime = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration<float>(endTime - startTime);
-        Console::WriteLine("Finished building %s in %.2f seconds.", _name.c_str(), duration.count());
+        if (totalCount > 0 && duration.count() > 0)
+        {
+            Console::WriteLine(
+                "Finished building %s in %.2f seconds (%.0f items per second).", _name.c_str(), duration.count(),
+                totalCount / duration.count());
+        }
+        else
+        {
+            Console::WriteLine("Finished building %s in %.2f seconds.", _name.c_str(), duration.count());
+        }
 
-        return allItems;
+        return GetItems(files);
     }
 
-    std::tuple<bool, std::vector<TItem>> ReadIndexFile(int32_t language, const DirectoryStats& stats) const
+    static std::vector<TItem> GetItems(std::vector<IndexedFile>& files)
     {
-        bool loadedItems = false;
         std::vector<TItem> items;
-        if (File::Exists(_indexPath))
+        items.reserve(files.size());
+        for (auto& file : files)
         {
-            try
+            if (file.HasItem)
             {
-                log_verbose("FileIndex:Loading index: '%s'", _indexPath.c_str());
-                auto fs = OpenRCT2::FileStream(_indexPath, OpenRCT2::FILE_MODE_OPEN);
-
-                // Read header, check if we need to re-scan
-                auto header = fs.ReadValue<FileIndexHeader>();
-                if (header.HeaderSize == sizeof(FileIndexHeader) && header.MagicNumber == _magicNumber
-                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language
-                    && header.Stats.TotalFiles == stats.TotalFiles && header.Stats.TotalFileSize == stats.TotalFileSize
-                    && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
-                    && header.Stats.PathChecksum == stats.PathChecksum)
-                {
-                    items.reserve(header.NumItems);
-                    DataSerialiser ds(false, fs);
-                    // Directory is the same, just read the saved items
-                    for (uint32_t i = 0; i < header.NumItems; i++)
-                    {
-                        TItem item;
-                        Serialise(ds, item);
-                        items.emplace_back(std::move(item));
-                    }
-                    loadedItems = true;
-                }
-                else
-                {
-                    Console::WriteLine("%s out of date", _name.c_str());
-                }
+                items.push_back(std::move(file.Item));
             }
-            catch (const std::exception& e)
+        }
+        return items;
+    }
+
+    std::optional<IndexData> ReadIndexFile(int32_t language) const
+    {
+        if (!File::Exists(_indexPath))
+        {
+            return std::nullopt;
+        }
+
+        try
+        {
+            log_verbose("FileIndex:Loading index: '%s'", _indexPath.c_str());
+            auto fs = OpenRCT2::FileStream(_indexPath, OpenRCT2::FILE_MODE_OPEN);
+
+            // Read header, an index of another version or language can not be reused at all
+            auto header = fs.ReadValue<FileIndexHeader>();
+            if (header.HeaderSize != sizeof(FileIndexHeader) || header.MagicNumber != _magicNumber
+                || header.VersionA != FILE_INDEX_VERSION || header.VersionB != _version || header.LanguageId != language)
+            {
+                Console::WriteLine("%s out of date", _name.c_str());
+                return std::nullopt;
+            }
+
+            IndexData indexData;
+            indexData.Stats = header.Stats;
+            indexData.Files.resize(header.NumFiles);
+
+            DataSerialiser ds(false, fs);
+            for (auto& file : indexData.Files)
             {
-                Console::Error::WriteLine("Unable to load index: '%s'.", _indexPath.c_str());
-                Console::Error::WriteLine("%s", e.what());
+                ds << file.File.Path;
+                ds << file.File.Size;
+                ds << file.File.LastModified;
+                ds << file.HasItem;
+                if (file.HasItem)
+                {
+                    Serialise(ds, file.Item);
+                }
             }
+            return indexData;
         }
-        return std::make_tuple(loadedItems, std::move(items));
+        catch (const std::exception& e)
+        {
+            Console::Error::WriteLine("Unable to load index: '%s'.", _indexPath.c_str());
+            Console::Error::WriteLine("%s", e.what());
+        }
+        return std::nullopt;
     }
 
-    void WriteIndexFile(int32_t language, const DirectoryStats& stats, std::vector<TItem>& items) const
+    void WriteIndexFile(int32_t language, const DirectoryStats& stats, std::vector<IndexedFile>& files) const
     {
         try
         {
@@ -306,14 +392,21 @@ private:
             header.VersionB = _version;
             header.LanguageId = language;
             header.Stats = stats;
-            header.NumItems = static_cast<uint32_t>(items.size());
+            header.NumFiles = static_cast<uint32_t>(files.size());
             fs.WriteValue(header);
 
             DataSerialiser ds(true, fs);
-            // Write items
-            for (auto& item : items)
+            // Write files and their items
+            for (auto& file : files)
             {
-                Serialise(ds, item);
+                ds << file.File.Path;
+                ds << file.File.Size;
+                ds << file.File.LastModified;
+                ds << file.HasItem;
+                if (file.HasItem)
+                {
+                    Serialise(ds, file.Item);
+                }
             }
         }
         catch (const std::exception& e)
@@ -15,6 +15,7 @@
 
 #if defined(__unix__) || (defined(__APPLE__) && defined(__MACH__))
 #    include <dirent.h>
+#    include <fcntl.h>
 #    include <sys/stat.h>
 #    include <sys/types.h>
 #    include <unistd.h>
@@ -164,17 +165,8 @@ public:
 
     virtual void GetDirectoryChildren(std::vector<DirectoryChild>& children, const std::string& path) abstract;
 
-private:
-    void PushState(const std::string& directory)
-    {
-        DirectoryState newState;
-        newState.Path = directory;
-        newState.Index = -1;
-        GetDirectoryChildren(newState.Listing, directory);
-        _directoryStack.push(newState);
-    }
-
-    bool PatternMatch(const std::string& fileName)
+protected:
+    bool PatternMatch(const std::string& fileName) const
     {
         for (const auto& pattern : _patterns)
         {
@@ -186,6 +178,16 @@ private:
         return false;
     }
 
+private:
+    void PushState(const std::string& directory)
+    {
+        DirectoryState newState;
+        newState.Path = directory;
+        newState.Index = -1;
+        GetDirectoryChildren(newState.Listing, directory);
+        _directoryStack.push(newState);
+    }
+
     static std::vector<std::string> GetPatterns(const std::string& delimitedPatterns)
     {
         std::vector<std::string> patterns;
@@ -228,8 +230,10 @@ public:
         auto pattern = path + "\\*";
         auto wPattern = String::ToWideChar(pattern.c_str());
 
+        // The short 8.3 names are never used, and skipping them saves a lookup per file on network drives
         WIN32_FIND_DATAW findData;
-        HANDLE hFile = FindFirstFileW(wPattern.c_str(), &findData);
+        HANDLE hFile = FindFirstFileExW(
+            wPattern.c_str(), FindExInfoBasic, &findData, FindExSearchNameMatch, nullptr, FIND_FIRST_EX_LARGE_FETCH);
         if (hFile != INVALID_HANDLE_VALUE)
         {
             do
@@ -282,16 +286,22 @@ public:
         int32_t count = scandir(path.c_str(), &namelist, FilterFunc, alphasort);
         if (count > 0)
         {
+            // Stat relative to the directory, so the path is not resolved again for every file
+            int32_t directoryFd = open(path.c_str(), O_RDONLY | O_DIRECTORY);
             for (int32_t i = 0; i < count; i++)
             {
                 const struct dirent* node = namelist[i];
                 if (!String::Equals(node->d_name, ".") && !String::Equals(node->d_name, ".."))
                 {
-                    children.push_back(CreateChild(path.c_str(), node));
+                    children.push_back(CreateChild(directoryFd, path, node));
                 }
                 free(namelist[i]);
             }
             free(namelist);
+            if (directoryFd != -1)
+            {
+                close(directoryFd);
+            }
         }
     }
 
@@ -301,7 +311,7 @@ private:
         return 1;
     }
 
-    static DirectoryChild CreateChild(const utf8* directory, const struct dirent* node)
+    DirectoryChild CreateChild(int32_t directoryFd, const std::string& directory, const struct dirent* node) const
     {
         DirectoryChild result;
         result.Name = std::string(node->d_name);
@@ -313,16 +323,26 @@ private:
         {
             result.Type = DIRECTORY_CHILD_TYPE::DC_FILE;
 
-            // Get the full path of the file
-            size_t pathSize = String::SizeOf(directory) + 1 + String::SizeOf(node->d_name) + 1;
-            utf8* path = Memory::Allocate<utf8>(pathSize);
-            String::Set(path, pathSize, directory);
-            Path::Append(path, pathSize, node->d_name);
+            // A regular file that does not match is never returned, so its size and date are not needed. Links and
+            // unknown types still need the stat to tell whether they are directories.
+            if (node->d_type == DT_REG && !PatternMatch(result.Name))
+            {
+                return result;
+            }
 
             struct stat statInfo
             {
             };
-            int32_t statRes = stat(path, &statInfo);
+            int32_t statRes;
+            if (directoryFd != -1)
+            {
+                statRes = fstatat(directoryFd, node->d_name, &statInfo, 0);
+            }
+            else
+            {
+                auto path = Path::Combine(directory, node->d_name);
+                statRes = stat(path.c_str(), &statInfo);
+            }
             if (statRes != -1)
             {
                 result.Size = statInfo.st_size;
@@ -333,8 +353,6 @@ private:
                     result.Type = DIRECTORY_CHILD_TYPE::DC_DIRECTORY;
                 }
             }
-
-            Memory::Free(path);
         }
         return result;
     }
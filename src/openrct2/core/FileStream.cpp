@@ -58,7 +58,7 @@ namespace OpenRCT2
                 _canWrite = true;
                 break;
             case FILE_MODE_APPEND:
-                mode = "a";
+                mode = "ab";
                 _canRead = false;
                 _canWrite = true;
                 break;
@@ -25,6 +25,9 @@
 #include "FileWatcher.h"
 
 #if defined(__linux__)
+// Files that are written, or moved into, out of or deleted from a watched directory
+static constexpr uint32_t FileChangedMask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE;
+
 FileWatcher::FileDescriptor::~FileDescriptor()
 {
     Close();
@@ -60,7 +63,7 @@ void FileWatcher::FileDescriptor::Close()
 
 FileWatcher::WatchDescriptor::WatchDescriptor(int fd, const std::string& path)
     : Fd(fd)
-    , Wd(inotify_add_watch(fd, path.c_str(), IN_CLOSE_WRITE))
+    , Wd(inotify_add_watch(fd, path.c_str(), FileChangedMask))
     , Path(path)
 {
     if (Wd >= 0)
@@ -134,8 +137,8 @@ void FileWatcher::WatchDirectory()
     std::array<char, 1024> eventData;
     DWORD bytesReturned;
     while (ReadDirectoryChangesW(
-        _directoryHandle, eventData.data(), static_cast<DWORD>(eventData.size()), TRUE, FILE_NOTIFY_CHANGE_LAST_WRITE,
-        &bytesReturned, nullptr, nullptr))
+        _directoryHandle, eventData.data(), static_cast<DWORD>(eventData.size()), TRUE,
+        FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME, &bytesReturned, nullptr, nullptr))
     {
         auto onFileChanged = OnFileChanged;
         if (onFileChanged)
@@ -170,7 +173,7 @@ void FileWatcher::WatchDirectory()
                 while (offset < length)
                 {
                     auto e = reinterpret_cast<inotify_event*>(eventData.data() + offset);
-                    if ((e->mask & IN_CLOSE_WRITE) && !(e->mask & IN_ISDIR))
+                    if ((e->mask & FileChangedMask) && !(e->mask & IN_ISDIR))
                     {
                         log_verbose("FileWatcher: inotify event received for %s", e->name);
 
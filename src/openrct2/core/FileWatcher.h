@@ -19,7 +19,7 @@ typedef void* HANDLE;
 #endif
 
 /**
- * Creates a new thread that watches a directory tree for file modifications.
+ * Creates a new thread that watches a directory tree for files being written, created, renamed or deleted.
  */
 class FileWatcher
 {
@@ -150,9 +150,23 @@ namespace Http
         return body;
     }
 
+    /**
+     * Returns the session shared by all requests. WinHTTP keeps a pool of open connections per session, so repeated
+     * requests to the same server reuse the connection and TLS session.
+     */
+    static HINTERNET GetSession()
+    {
+        static HINTERNET session = []() {
+            auto userAgent = String::ToWideChar(OPENRCT2_USER_AGENT);
+            return WinHttpOpen(
+                userAgent.c_str(), WINHTTP_ACCESS_TYPE_DEFAULT_PROXY, WINHTTP_NO_PROXY_NAME, WINHTTP_NO_PROXY_BYPASS, 0);
+        }();
+        return session;
+    }
+
     Response Do(const Request& req)
     {
-        HINTERNET hSession{}, hConnect{}, hRequest{};
+        HINTERNET hConnect{}, hRequest{};
         try
         {
             URL_COMPONENTS url{};
@@ -166,9 +180,7 @@ namespace Http
             if (!WinHttpCrackUrl(wUrl.c_str(), 0, 0, &url))
                 throw std::invalid_argument("Unable to parse URI.");
 
-            auto userAgent = String::ToWideChar(OPENRCT2_USER_AGENT);
-            hSession = WinHttpOpen(
-                userAgent.c_str(), WINHTTP_ACCESS_TYPE_DEFAULT_PROXY, WINHTTP_NO_PROXY_NAME, WINHTTP_NO_PROXY_BYPASS, 0);
+            auto hSession = GetSession();
             if (hSession == nullptr)
                 ThrowWin32Exception("WinHttpOpen");
 
@@ -219,9 +231,8 @@ namespace Http
             }
             response.header = std::move(headers);
 
-            WinHttpCloseHandle(hSession);
-            WinHttpCloseHandle(hConnect);
             WinHttpCloseHandle(hRequest);
+            WinHttpCloseHandle(hConnect);
             return response;
         }
         catch ([[maybe_unused]] const std::exception& e)
@@ -229,9 +240,8 @@ namespace Http
 #    ifdef DEBUG
             Console::Error::WriteLine("HTTP request failed: %s", e.what());
 #    endif
-            WinHttpCloseHandle(hSession);
-            WinHttpCloseHandle(hConnect);
             WinHttpCloseHandle(hRequest);
+            WinHttpCloseHandle(hConnect);
             throw;
         }
     }
@@ -81,11 +81,23 @@ namespace Http
         return 0;
     }
 
-    Response Do(const Request& req)
+    /**
+     * Returns the calling thread's handle, reset to the default options. The handle keeps its connections open across
+     * requests, so repeated requests to the same server reuse the connection and TLS session.
+     */
+    static CURL* GetThreadHandle()
     {
-        CURL* curl = curl_easy_init();
-        std::shared_ptr<void> _(nullptr, [curl](...) { curl_easy_cleanup(curl); });
+        thread_local std::unique_ptr<CURL, decltype(&curl_easy_cleanup)> handle(curl_easy_init(), &curl_easy_cleanup);
+        if (handle != nullptr)
+        {
+            curl_easy_reset(handle.get());
+        }
+        return handle.get();
+    }
 
+    Response Do(const Request& req)
+    {
+        CURL* curl = GetThreadHandle();
         if (!curl)
             throw std::runtime_error("Failed to initialize curl");
 
@@ -122,7 +134,7 @@ namespace Http
         curl_easy_setopt(curl, CURLOPT_USERAGENT, OPENRCT2_USER_AGENT);
 
         curl_slist* chunk = nullptr;
-        std::shared_ptr<void> __(nullptr, [chunk](...) { curl_slist_free_all(chunk); });
+        std::shared_ptr<void> _(nullptr, [&chunk](...) { curl_slist_free_all(chunk); });
         for (auto header : req.header)
         {
             std::string hs = header.first + ": " + header.second;
@@ -0,0 +1,99 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_HTTP
+
+#    include "Http.h"
+
+#    include <condition_variable>
+#    include <deque>
+#    include <mutex>
+#    include <utility>
+
+namespace Http
+{
+    /**
+     * Runs asynchronous requests on a few long lived threads. Each thread keeps its connections open between requests,
+     * so requests to the same host after the first one skip the connection and TLS handshake.
+     */
+    class RequestQueue
+    {
+    private:
+        struct PendingRequest
+        {
+            Request Req;
+            std::function<void(Response& res)> Callback;
+        };
+
+        std::mutex _mutex;
+        std::condition_variable _condition;
+        std::deque<PendingRequest> _pending;
+        size_t _workerCount{};
+        size_t _idleWorkers{};
+
+    public:
+        static RequestQueue& Get()
+        {
+            // Never destroyed, workers may still be waiting on it while the process exits.
+            static auto* queue = new RequestQueue();
+            return *queue;
+        }
+
+        void Enqueue(const Request& req, std::function<void(Response& res)> fn)
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _pending.push_back({ req, std::move(fn) });
+            if (_idleWorkers == 0 && _workerCount < MaxConcurrentRequests)
+            {
+                _workerCount++;
+                std::thread(&RequestQueue::WorkerMain, this).detach();
+            }
+            else
+            {
+                _condition.notify_one();
+            }
+        }
+
+    private:
+        void WorkerMain()
+        {
+            while (true)
+            {
+                PendingRequest pending;
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _idleWorkers++;
+                    _condition.wait(lock, [this]() { return !_pending.empty(); });
+                    _idleWorkers--;
+                    pending = std::move(_pending.front());
+                    _pending.pop_front();
+                }
+
+                Response res{};
+                try
+                {
+                    res = Do(pending.Req);
+                }
+                catch (std::exception& e)
+                {
+                    res.error = e.what();
+                    continue;
+                }
+                pending.Callback(res);
+            }
+        }
+    };
+
+    void DoAsync(const Request& req, std::function<void(Response& res)> fn)
+    {
+        RequestQueue::Get().Enqueue(req, std::move(fn));
+    }
+} // namespace Http
+
+#endif // DISABLE_HTTP
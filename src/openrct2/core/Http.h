@@ -52,25 +52,15 @@ namespace Http
         bool forceIPv4{};
     };
 
+    // Number of requests DoAsync runs at the same time, any further requests wait for one of them to finish.
+    constexpr size_t MaxConcurrentRequests = 4;
+
     Response Do(const Request& req);
 
-    inline void DoAsync(const Request& req, std::function<void(Response& res)> fn)
-    {
-        auto thread = std::thread([=]() {
-            Response res{};
-            try
-            {
-                res = Do(req);
-            }
-            catch (std::exception& e)
-            {
-                res.error = e.what();
-                return;
-            }
-            fn(res);
-        });
-        thread.detach();
-    }
+    /**
+     * Runs the request on one of the shared HTTP threads, fn is called from that thread unless the request failed.
+     */
+    void DoAsync(const Request& req, std::function<void(Response& res)> fn);
 } // namespace Http
 
 #endif // DISABLE_HTTP
@@ -162,7 +162,24 @@ namespace Imaging
         }
     }
 
-    static void WritePng(std::ostream& ostream, const Image& image)
+    static void ApplyPngWriteOptions(png_structp png_ptr, const Image& image, const PngWriteOptions& options)
+    {
+        if (options.CompressionLevel == PngWriteOptions::DefaultCompressionLevel)
+            return;
+
+        auto level = std::clamp(options.CompressionLevel, 0, 9);
+        png_set_compression_level(png_ptr, level);
+        if (level <= 3 && image.Depth != 8)
+        {
+            // Adaptive filtering tries all five filters on every row which costs more than the deflate at these levels.
+            // Palette images are never filtered by default.
+            png_set_filter(png_ptr, PNG_FILTER_TYPE_BASE, PNG_FILTER_SUB);
+        }
+    }
+
+    static void WritePng(
+        std::ostream& ostream, const Image& image, uint32_t stripHeight, const ImageStripFunc& getStrip,
+        const PngWriteOptions& options)
     {
         png_structp png_ptr = nullptr;
         png_colorp png_palette = nullptr;
@@ -209,6 +226,7 @@ namespace Imaging
             }
 
             png_set_write_fn(png_ptr, &ostream, PngWriteData, PngFlush);
+            ApplyPngWriteOptions(png_ptr, image, options);
 
             // Set error handler
             if (setjmp(png_jmpbuf(png_ptr)))
@@ -231,11 +249,16 @@ namespace Imaging
             png_write_info(png_ptr, info_ptr);
 
             // Write pixels
-            auto pixels = image.Pixels.data();
-            for (uint32_t y = 0; y < image.Height; y++)
+            stripHeight = std::max<uint32_t>(stripHeight, 1);
+            for (uint32_t top = 0; top < image.Height; top += stripHeight)
             {
-                png_write_row(png_ptr, const_cast<png_byte*>(pixels));
-                pixels += image.Stride;
+                const auto count = std::min(stripHeight, image.Height - top);
+                auto pixels = getStrip(top, count);
+                for (uint32_t y = 0; y < count; y++)
+                {
+                    png_write_row(png_ptr, const_cast<png_byte*>(pixels));
+                    pixels += image.Stride;
+                }
             }
 
             png_write_end(png_ptr, nullptr);
@@ -329,14 +352,15 @@ namespace Imaging
         return ReadFromStream(istream, format);
     }
 
-    void WriteToFile(std::string_view path, const Image& image, IMAGE_FORMAT format)
+    void WriteToFile(std::string_view path, const Image& image, IMAGE_FORMAT format, const PngWriteOptions& options)
     {
         switch (format)
         {
             case IMAGE_FORMAT::AUTOMATIC:
-                WriteToFile(path, image, GetImageFormatFromPath(path));
+                WriteToFile(path, image, GetImageFormatFromPath(path), options);
                 break;
             case IMAGE_FORMAT::PNG:
+            case IMAGE_FORMAT::PNG_32:
             {
 #if defined(_WIN32) && !defined(__MINGW32__)
                 auto pathW = String::ToWideChar(path);
@@ -344,11 +368,27 @@ namespace Imaging
 #else
                 std::ofstream fs(std::string(path), std::ios::binary);
 #endif
-                WritePng(fs, image);
+                WritePng(
+                    fs, image, image.Height,
+                    [&image](uint32_t top, uint32_t) { return image.Pixels.data() + static_cast<size_t>(top) * image.Stride; },
+                    options);
                 break;
             }
             default:
                 throw std::runtime_error(EXCEPTION_IMAGE_FORMAT_UNKNOWN);
         }
     }
+
+    void WriteStripsToFile(
+        std::string_view path, const Image& image, uint32_t stripHeight, const ImageStripFunc& getStrip,
+        const PngWriteOptions& options)
+    {
+#if defined(_WIN32) && !defined(__MINGW32__)
+        auto pathW = String::ToWideChar(path);
+        std::ofstream fs(pathW, std::ios::binary);
+#else
+        std::ofstream fs(std::string(path), std::ios::binary);
+#endif
+        WritePng(fs, image, stripHeight, getStrip, options);
+    }
 } // namespace Imaging
@@ -44,12 +44,37 @@ struct Image
 
 using ImageReaderFunc = std::function<Image(std::istream&, IMAGE_FORMAT)>;
 
+// Returns the pixels of rows [top, top + count) of an image, each row Stride bytes after the previous one.
+using ImageStripFunc = std::function<const uint8_t*(uint32_t top, uint32_t count)>;
+
+/**
+ * How PNGs are compressed when written. Lower levels encode faster but produce larger files.
+ */
+struct PngWriteOptions
+{
+    static constexpr int32_t DefaultCompressionLevel = -1;
+
+    // zlib compression level, from 0 (no compression) to 9 (smallest files), or -1 for zlib's default. Fast levels
+    // (up to 3) also use a single cheap row filter for 32-bit images instead of trying every filter on each row.
+    int32_t CompressionLevel = DefaultCompressionLevel;
+};
+
 namespace Imaging
 {
     IMAGE_FORMAT GetImageFormatFromPath(std::string_view path);
     Image ReadFromFile(std::string_view path, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
     Image ReadFromBuffer(const std::vector<uint8_t>& buffer, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
-    void WriteToFile(std::string_view path, const Image& image, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
+    void WriteToFile(
+        std::string_view path, const Image& image, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC,
+        const PngWriteOptions& options = {});
+
+    /**
+     * Writes a PNG without holding all of its pixels in memory. The image only provides the size, depth, stride and
+     * palette, the pixels are requested from getStrip in consecutive strips of at most stripHeight rows.
+     */
+    void WriteStripsToFile(
+        std::string_view path, const Image& image, uint32_t stripHeight, const ImageStripFunc& getStrip,
+        const PngWriteOptions& options = {});
 
     void SetReader(IMAGE_FORMAT format, ImageReaderFunc impl);
 } // namespace Imaging
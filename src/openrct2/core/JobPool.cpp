@@ -9,117 +9,89 @@
 
 #include "JobPool.h"
 
-#include <algorithm>
-#include <cassert>
+#include <chrono>
 
-JobPool::TaskData::TaskData(std::function<void()> workFn, std::function<void()> completionFn)
+using namespace OpenRCT2;
+
+JobPool::TaskData::TaskData(std::function<void()> workFn, std::function<void()> completionFn, JobPool* pool)
     : WorkFn(workFn)
     , CompletionFn(completionFn)
+    , Pool(pool)
 {
 }
 
-JobPool::JobPool(size_t maxThreads)
+JobPool::~JobPool()
 {
-    maxThreads = std::min<size_t>(maxThreads, std::thread::hardware_concurrency());
-    for (size_t n = 0; n < maxThreads; n++)
-    {
-        _threads.emplace_back(&JobPool::ProcessQueue, this);
-    }
+    _group.Wait();
 }
 
-JobPool::~JobPool()
+void JobPool::AddTask(std::function<void()> workFn, std::function<void()> completionFn)
 {
+    const TaskData* taskData;
     {
         unique_lock lock(_mutex);
-        _shouldStop = true;
-        _condPending.notify_all();
-    }
-
-    for (auto& th : _threads)
-    {
-        assert(th.joinable() != false);
-        th.join();
+        taskData = &_tasks.emplace_back(workFn, completionFn, this);
     }
-}
-
-void JobPool::AddTask(std::function<void()> workFn, std::function<void()> completionFn)
-{
-    unique_lock lock(_mutex);
-    _pending.emplace_back(workFn, completionFn);
-    _condPending.notify_one();
+    _pending++;
+    TaskScheduler::Get().Submit(_group, &JobPool::RunTask, const_cast<TaskData*>(taskData), 0, 1);
 }
 
 void JobPool::Join(std::function<void()> reportFn)
 {
-    unique_lock lock(_mutex);
     while (true)
     {
-        // Wait for the queue to become empty or having completed tasks.
-        _condComplete.wait(lock, [this]() { return (_pending.empty() && _processing == 0) || !_completed.empty(); });
-
-        // Dispatch all completion callbacks if there are any.
-        while (!_completed.empty())
-        {
-            auto taskData = _completed.front();
-            _completed.pop_front();
-
-            if (taskData.CompletionFn)
-            {
-                lock.unlock();
+        // Help running the tasks, wake up regularly to dispatch completion callbacks and report progress.
+        bool done = _group.WaitFor(std::chrono::milliseconds(100));
 
-                taskData.CompletionFn();
-
-                lock.lock();
-            }
-        }
+        RunCompletions();
 
         if (reportFn)
         {
-            lock.unlock();
-
             reportFn();
-
-            lock.lock();
         }
 
-        // If everything is empty and no more work has to be done we can stop waiting.
-        if (_completed.empty() && _pending.empty() && _processing == 0)
+        if (done)
         {
             break;
         }
     }
+
+    unique_lock lock(_mutex);
+    _tasks.clear();
 }
 
 size_t JobPool::CountPending()
 {
-    return _pending.size();
+    return _pending;
+}
+
+void JobPool::RunTask(void* context, size_t, size_t)
+{
+    auto* taskData = static_cast<const TaskData*>(context);
+    auto* pool = taskData->Pool;
+    pool->_pending--;
+
+    taskData->WorkFn();
+
+    unique_lock lock(pool->_mutex);
+    pool->_completed.push_back(taskData);
 }
 
-void JobPool::ProcessQueue()
+void JobPool::RunCompletions()
 {
     unique_lock lock(_mutex);
-    do
+    while (!_completed.empty())
     {
-        // Wait for work or cancellation.
-        _condPending.wait(lock, [this]() { return _shouldStop || !_pending.empty(); });
+        auto* taskData = _completed.front();
+        _completed.pop_front();
 
-        if (!_pending.empty())
+        if (taskData->CompletionFn)
         {
-            _processing++;
-
-            auto taskData = _pending.front();
-            _pending.pop_front();
-
             lock.unlock();
 
-            taskData.WorkFn();
+            taskData->CompletionFn();
 
             lock.lock();
-
-            _completed.push_back(std::move(taskData));
-
-            _processing--;
-            _condComplete.notify_one();
         }
-    } while (!_shouldStop);
+    }
 }
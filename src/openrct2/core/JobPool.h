@@ -9,14 +9,15 @@
 
 #pragma once
 
-#include <atomic>
-#include <condition_variable>
+#include "TaskScheduler.h"
+
 #include <deque>
 #include <functional>
 #include <mutex>
-#include <thread>
-#include <vector>
 
+/**
+ * Runs a batch of tasks on the shared TaskScheduler, completion functions are called from the thread calling Join.
+ */
 class JobPool
 {
 private:
@@ -24,23 +25,22 @@ private:
     {
         const std::function<void()> WorkFn;
         const std::function<void()> CompletionFn;
+        JobPool* const Pool;
 
-        TaskData(std::function<void()> workFn, std::function<void()> completionFn);
+        TaskData(std::function<void()> workFn, std::function<void()> completionFn, JobPool* pool);
     };
 
-    std::atomic_bool _shouldStop = { false };
-    std::atomic<size_t> _processing = { 0 };
-    std::vector<std::thread> _threads;
-    std::deque<TaskData> _pending;
-    std::deque<TaskData> _completed;
-    std::condition_variable _condPending;
-    std::condition_variable _condComplete;
+    OpenRCT2::TaskGroup _group;
+    // Deque so that references to submitted tasks stay valid while more are added.
+    std::deque<TaskData> _tasks;
+    std::deque<const TaskData*> _completed;
+    std::atomic<size_t> _pending = { 0 };
     std::mutex _mutex;
 
     using unique_lock = std::unique_lock<std::mutex>;
 
 public:
-    JobPool(size_t maxThreads = 255);
+    JobPool() = default;
     ~JobPool();
 
     void AddTask(std::function<void()> workFn, std::function<void()> completionFn = nullptr);
@@ -48,5 +48,6 @@ public:
     size_t CountPending();
 
 private:
-    void ProcessQueue();
+    static void RunTask(void* context, size_t begin, size_t end);
+    void RunCompletions();
 };
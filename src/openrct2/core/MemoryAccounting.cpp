@@ -0,0 +1,46 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "MemoryAccounting.h"
+
+#include <array>
+#include <atomic>
+#include <iterator>
+
+using namespace OpenRCT2;
+
+static constexpr size_t CategoryCount = static_cast<size_t>(MemoryAccounting::Category::Count);
+
+static constexpr const char* CategoryNames[] = {
+    "tile_elements", "entities", "spatial_index", "object_images", "textures", "snapshots", "scripting",
+};
+static_assert(std::size(CategoryNames) == CategoryCount, "A name is required for every category");
+
+// Updated by scripting heaps on their own threads, relaxed ordering is enough as the counters are only ever reported.
+static std::array<std::atomic<size_t>, CategoryCount> _trackedBytes{};
+
+const char* MemoryAccounting::GetCategoryName(Category category)
+{
+    return CategoryNames[static_cast<size_t>(category)];
+}
+
+void MemoryAccounting::Add(Category category, size_t bytes)
+{
+    _trackedBytes[static_cast<size_t>(category)].fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void MemoryAccounting::Remove(Category category, size_t bytes)
+{
+    _trackedBytes[static_cast<size_t>(category)].fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+size_t MemoryAccounting::GetTrackedBytes(Category category)
+{
+    return _trackedBytes[static_cast<size_t>(category)].load(std::memory_order_relaxed);
+}
@@ -0,0 +1,43 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Bytes held by the major subsystems. Allocators that come and go (object images, textures, scripting heaps) add and
+ * remove their allocations as they happen, large containers that are owned by a single subsystem are measured when a
+ * report is made instead, see GetMemoryReport.
+ */
+namespace OpenRCT2::MemoryAccounting
+{
+    enum class Category : uint8_t
+    {
+        TileElements,
+        Entities,
+        SpatialIndex,
+        ObjectImages,
+        Textures,
+        Snapshots,
+        Scripting,
+        Count,
+    };
+
+    const char* GetCategoryName(Category category);
+
+    void Add(Category category, size_t bytes);
+    void Remove(Category category, size_t bytes);
+
+    /**
+     * @returns the bytes added and not yet removed for the category.
+     */
+    size_t GetTrackedBytes(Category category);
+} // namespace OpenRCT2::MemoryAccounting
@@ -0,0 +1,116 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef _WIN32
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#include "FileStream.h"
+#include "MemoryMappedFile.h"
+#include "String.hpp"
+
+namespace OpenRCT2
+{
+#ifdef _WIN32
+    static uint8_t* MapFile(const std::string& path, size_t& length)
+    {
+        auto pathW = String::ToWideChar(path);
+        auto file = CreateFileW(
+            pathW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return nullptr;
+        }
+
+        uint8_t* data = nullptr;
+        LARGE_INTEGER fileSize{};
+        if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0)
+        {
+            auto mapping = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+            if (mapping != nullptr)
+            {
+                data = static_cast<uint8_t*>(MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0));
+                if (data != nullptr)
+                {
+                    length = static_cast<size_t>(fileSize.QuadPart);
+                }
+
+                // The view keeps the mapping alive.
+                CloseHandle(mapping);
+            }
+        }
+        CloseHandle(file);
+        return data;
+    }
+
+    static void UnmapFile(uint8_t* data, size_t)
+    {
+        UnmapViewOfFile(data);
+    }
+#else
+    static uint8_t* MapFile(const std::string& path, size_t& length)
+    {
+        auto fd = open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            return nullptr;
+        }
+
+        uint8_t* data = nullptr;
+        struct stat fileStat;
+        if (fstat(fd, &fileStat) == 0 && S_ISREG(fileStat.st_mode) && fileStat.st_size > 0)
+        {
+            auto* address = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            if (address != MAP_FAILED)
+            {
+                data = static_cast<uint8_t*>(address);
+                length = static_cast<size_t>(fileStat.st_size);
+            }
+        }
+
+        // The mapping stays valid after the descriptor is closed.
+        close(fd);
+        return data;
+    }
+
+    static void UnmapFile(uint8_t* data, size_t length)
+    {
+        munmap(data, length);
+    }
+#endif
+
+    MemoryMappedFile::MemoryMappedFile(const std::string& path)
+    {
+        _data = MapFile(path, _length);
+        if (_data != nullptr)
+        {
+            _mapped = true;
+            return;
+        }
+
+        // Throws if the file can not be opened at all.
+        FileStream fs(path, FILE_MODE_OPEN);
+        _length = static_cast<size_t>(fs.GetLength());
+        _buffer = fs.ReadArray<uint8_t>(_length);
+        _data = _buffer.get();
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        if (_mapped)
+        {
+            UnmapFile(_data, _length);
+        }
+    }
+} // namespace OpenRCT2
@@ -0,0 +1,54 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <memory>
+#include <string>
+
+namespace OpenRCT2
+{
+    /**
+     * Maps a whole file into memory. The pages are loaded by the OS on first access and are mapped copy-on-write, so
+     * writing to the data stays private to the process. Reads the file into memory instead if it cannot be mapped.
+     */
+    class MemoryMappedFile final
+    {
+    private:
+        uint8_t* _data = nullptr;
+        size_t _length = 0;
+        bool _mapped = false;
+        std::unique_ptr<uint8_t[]> _buffer;
+
+    public:
+        explicit MemoryMappedFile(const std::string& path);
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+        ~MemoryMappedFile();
+
+        uint8_t* GetData()
+        {
+            return _data;
+        }
+        const uint8_t* GetData() const
+        {
+            return _data;
+        }
+        size_t GetLength() const
+        {
+            return _length;
+        }
+        bool IsMapped() const
+        {
+            return _mapped;
+        }
+    };
+} // namespace OpenRCT2
@@ -0,0 +1,94 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "MemoryMappedFileStream.h"
+
+namespace OpenRCT2
+{
+    MemoryMappedFileStream::MemoryMappedFileStream(const std::string& path)
+        : _file(path)
+        , _view(_file.GetData(), _file.GetLength(), MEMORY_ACCESS::READ)
+    {
+    }
+
+    const void* MemoryMappedFileStream::GetData() const
+    {
+        return _file.GetData();
+    }
+
+    bool MemoryMappedFileStream::CanRead() const
+    {
+        return true;
+    }
+
+    bool MemoryMappedFileStream::CanWrite() const
+    {
+        return false;
+    }
+
+    uint64_t MemoryMappedFileStream::GetLength() const
+    {
+        return _view.GetLength();
+    }
+
+    uint64_t MemoryMappedFileStream::GetPosition() const
+    {
+        return _view.GetPosition();
+    }
+
+    void MemoryMappedFileStream::SetPosition(uint64_t position)
+    {
+        _view.SetPosition(position);
+    }
+
+    void MemoryMappedFileStream::Seek(int64_t offset, int32_t origin)
+    {
+        _view.Seek(offset, origin);
+    }
+
+    void MemoryMappedFileStream::Read(void* buffer, uint64_t length)
+    {
+        _view.Read(buffer, length);
+    }
+
+    void MemoryMappedFileStream::Read1(void* buffer)
+    {
+        _view.Read<1>(buffer);
+    }
+
+    void MemoryMappedFileStream::Read2(void* buffer)
+    {
+        _view.Read<2>(buffer);
+    }
+
+    void MemoryMappedFileStream::Read4(void* buffer)
+    {
+        _view.Read<4>(buffer);
+    }
+
+    void MemoryMappedFileStream::Read8(void* buffer)
+    {
+        _view.Read<8>(buffer);
+    }
+
+    void MemoryMappedFileStream::Read16(void* buffer)
+    {
+        _view.Read<16>(buffer);
+    }
+
+    void MemoryMappedFileStream::Write(const void*, uint64_t)
+    {
+        throw IOException("Stream is read only.");
+    }
+
+    uint64_t MemoryMappedFileStream::TryRead(void* buffer, uint64_t length)
+    {
+        return _view.TryRead(buffer, length);
+    }
+} // namespace OpenRCT2
@@ -0,0 +1,58 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "IStream.hpp"
+#include "MemoryMappedFile.h"
+#include "MemoryStream.h"
+
+#include <string>
+
+namespace OpenRCT2
+{
+    /**
+     * A read only stream over a memory mapped file. GetData returns the mapped file, so readers can use the data in
+     * place instead of reading it into their own buffers.
+     */
+    class MemoryMappedFileStream final : public IStream
+    {
+    private:
+        MemoryMappedFile _file;
+        MemoryStream _view;
+
+    public:
+        explicit MemoryMappedFileStream(const std::string& path);
+
+        const void* GetData() const override;
+
+        ///////////////////////////////////////////////////////////////////////////
+        // ISteam methods
+        ///////////////////////////////////////////////////////////////////////////
+        bool CanRead() const override;
+        bool CanWrite() const override;
+
+        uint64_t GetLength() const override;
+        uint64_t GetPosition() const override;
+        void SetPosition(uint64_t position) override;
+        void Seek(int64_t offset, int32_t origin) override;
+
+        void Read(void* buffer, uint64_t length) override;
+        void Read1(void* buffer) override;
+        void Read2(void* buffer) override;
+        void Read4(void* buffer) override;
+        void Read8(void* buffer) override;
+        void Read16(void* buffer) override;
+
+        void Write(const void* buffer, uint64_t length) override;
+
+        uint64_t TryRead(void* buffer, uint64_t length) override;
+    };
+} // namespace OpenRCT2
@@ -89,6 +89,11 @@ namespace OpenRCT2
     {
         if (this != &mv)
         {
+            if (_access & MEMORY_ACCESS::OWNER)
+            {
+                Memory::Free(_data);
+            }
+
             _access = mv._access;
             _dataCapacity = mv._dataCapacity;
             _data = mv._data;
@@ -122,6 +127,25 @@ namespace OpenRCT2
         return _data;
     }
 
+    size_t MemoryStream::GetCapacity() const
+    {
+        return _dataCapacity;
+    }
+
+    void MemoryStream::Reserve(size_t capacity)
+    {
+        if (_access & MEMORY_ACCESS::OWNER)
+        {
+            EnsureCapacity(capacity);
+        }
+    }
+
+    void MemoryStream::Clear()
+    {
+        _dataSize = 0;
+        _position = _data;
+    }
+
     bool MemoryStream::CanRead() const
     {
         return (_access & MEMORY_ACCESS::READ) != 0;
@@ -279,4 +303,34 @@ namespace OpenRCT2
         }
     }
 
+    MemoryStream MemoryStreamPool::Acquire(size_t capacityHint)
+    {
+        MemoryStream stream;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_streams.empty())
+            {
+                // The most recently released stream is the one most likely to already be big enough.
+                stream = std::move(_streams.back());
+                _streams.pop_back();
+            }
+        }
+        stream.Clear();
+        stream.Reserve(capacityHint);
+        return stream;
+    }
+
+    void MemoryStreamPool::Release(MemoryStream&& stream)
+    {
+        // Streams that gave their data away or grew unusually large are not worth holding on to.
+        if (!(stream._access & MEMORY_ACCESS::OWNER) || stream._dataCapacity == 0 || stream._dataCapacity > MaxStreamCapacity)
+            return;
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_streams.size() < MaxStreams)
+        {
+            _streams.push_back(std::move(stream));
+        }
+    }
+
 } // namespace OpenRCT2
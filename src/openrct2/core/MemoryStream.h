@@ -13,6 +13,7 @@
 #include "IStream.hpp"
 
 #include <algorithm>
+#include <mutex>
 #include <vector>
 
 namespace OpenRCT2
@@ -29,6 +30,8 @@ namespace OpenRCT2
      */
     class MemoryStream final : public IStream
     {
+        friend class MemoryStreamPool;
+
     private:
         uint8_t _access = MEMORY_ACCESS::READ | MEMORY_ACCESS::WRITE | MEMORY_ACCESS::OWNER;
         size_t _dataCapacity = 0;
@@ -52,6 +55,19 @@ namespace OpenRCT2
         void* GetDataCopy() const;
         void* TakeData();
 
+        size_t GetCapacity() const;
+
+        /**
+         * Grows the buffer of an owning stream to hold at least the given number of bytes, so a caller that knows
+         * roughly how much it is going to write only allocates once.
+         */
+        void Reserve(size_t capacity);
+
+        /**
+         * Empties the stream but keeps its buffer, so the stream can be written again without allocating.
+         */
+        void Clear();
+
         ///////////////////////////////////////////////////////////////////////////
         // ISteam methods
         ///////////////////////////////////////////////////////////////////////////
@@ -116,4 +132,56 @@ namespace OpenRCT2
         void EnsureCapacity(size_t capacity);
     };
 
+    /**
+     * Keeps the buffers of released streams around so code that builds a short-lived stream very often, such as the
+     * game action log or the game state snapshots sent to clients, does not allocate and grow a new buffer every time.
+     */
+    class MemoryStreamPool final
+    {
+    private:
+        static constexpr size_t MaxStreams = 8;
+        static constexpr size_t MaxStreamCapacity = 1024 * 1024;
+
+        std::mutex _mutex;
+        std::vector<MemoryStream> _streams;
+
+    public:
+        MemoryStream Acquire(size_t capacityHint = 0);
+        void Release(MemoryStream&& stream);
+    };
+
+    /**
+     * A stream taken from a pool for the lifetime of this object.
+     */
+    class PooledMemoryStream final
+    {
+    private:
+        MemoryStreamPool& _pool;
+        MemoryStream _stream;
+
+    public:
+        explicit PooledMemoryStream(MemoryStreamPool& pool, size_t capacityHint = 0)
+            : _pool(pool)
+            , _stream(pool.Acquire(capacityHint))
+        {
+        }
+        PooledMemoryStream(const PooledMemoryStream&) = delete;
+        PooledMemoryStream& operator=(const PooledMemoryStream&) = delete;
+
+        ~PooledMemoryStream()
+        {
+            _pool.Release(std::move(_stream));
+        }
+
+        MemoryStream& operator*()
+        {
+            return _stream;
+        }
+
+        MemoryStream* operator->()
+        {
+            return &_stream;
+        }
+    };
+
 } // namespace OpenRCT2
@@ -0,0 +1,223 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "Profiling.h"
+
+#include "../Diagnostic.h"
+#include "Json.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+
+using namespace OpenRCT2;
+using namespace OpenRCT2::Profiling;
+
+namespace
+{
+    struct Zone
+    {
+        const char* Name{};
+        Timestamp Start{};
+        Timestamp End{};
+    };
+
+    struct ThreadZones
+    {
+        std::mutex Mutex;
+        std::vector<Zone> Zones;
+        size_t Next{};
+        size_t Count{};
+        size_t Index{};
+        const char* Name{};
+    };
+
+    struct ThreadZonesCopy
+    {
+        size_t Index{};
+        const char* Name{};
+        std::vector<Zone> Zones;
+    };
+} // namespace
+
+static std::atomic<bool> _enabled{ true };
+
+// Threads are never removed so the zones of finished threads can still be exported.
+static std::mutex _threadsMutex;
+static std::vector<std::shared_ptr<ThreadZones>> _threads;
+static thread_local std::shared_ptr<ThreadZones> _currentThread;
+
+static ThreadZones& GetCurrentThreadZones()
+{
+    if (_currentThread == nullptr)
+    {
+        auto threadZones = std::make_shared<ThreadZones>();
+
+        std::lock_guard<std::mutex> lock(_threadsMutex);
+        threadZones->Index = _threads.size();
+        _threads.push_back(threadZones);
+        _currentThread = std::move(threadZones);
+    }
+    return *_currentThread;
+}
+
+// Copies the zones of every thread, oldest first, holding the lock of each thread only while copying it.
+static std::vector<ThreadZonesCopy> CopyAllZones()
+{
+    std::vector<std::shared_ptr<ThreadZones>> threads;
+    {
+        std::lock_guard<std::mutex> lock(_threadsMutex);
+        threads = _threads;
+    }
+
+    std::vector<ThreadZonesCopy> result;
+    for (const auto& threadZones : threads)
+    {
+        auto& copy = result.emplace_back();
+        std::lock_guard<std::mutex> lock(threadZones->Mutex);
+        copy.Index = threadZones->Index;
+        copy.Name = threadZones->Name;
+        copy.Zones.reserve(threadZones->Count);
+        auto first = (threadZones->Next + ZonesPerThread - threadZones->Count) % ZonesPerThread;
+        for (size_t i = 0; i < threadZones->Count; i++)
+        {
+            copy.Zones.push_back(threadZones->Zones[(first + i) % ZonesPerThread]);
+        }
+    }
+    return result;
+}
+
+bool Profiling::IsEnabled()
+{
+    return _enabled;
+}
+
+void Profiling::SetEnabled(bool enabled)
+{
+    _enabled = enabled;
+}
+
+Timestamp Profiling::GetTimestamp()
+{
+    static const auto epoch = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::steady_clock::now() - epoch;
+    return static_cast<Timestamp>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+void Profiling::RecordZone(const char* name, Timestamp start, Timestamp end)
+{
+    if (!_enabled)
+    {
+        return;
+    }
+
+    auto& threadZones = GetCurrentThreadZones();
+    std::lock_guard<std::mutex> lock(threadZones.Mutex);
+    if (threadZones.Zones.empty())
+    {
+        // Only allocated once the thread records something, naming a thread should not cost the whole buffer.
+        threadZones.Zones.resize(ZonesPerThread);
+    }
+    threadZones.Zones[threadZones.Next] = { name, start, end };
+    threadZones.Next = (threadZones.Next + 1) % ZonesPerThread;
+    threadZones.Count = std::min(threadZones.Count + 1, ZonesPerThread);
+}
+
+void Profiling::SetThreadName(const char* name)
+{
+    auto& threadZones = GetCurrentThreadZones();
+    std::lock_guard<std::mutex> lock(threadZones.Mutex);
+    threadZones.Name = name;
+}
+
+std::vector<ZoneStatistics> Profiling::GetZoneStatistics(std::chrono::milliseconds window)
+{
+    const auto now = GetTimestamp();
+    const auto windowNs = static_cast<Timestamp>(std::chrono::duration_cast<std::chrono::nanoseconds>(window).count());
+    const auto cutoff = now > windowNs ? now - windowNs : 0;
+
+    // Zones with the same name can come from different literals, so group them by their text.
+    std::map<std::string, std::vector<Timestamp>> durations;
+    for (const auto& threadZones : CopyAllZones())
+    {
+        for (const auto& zone : threadZones.Zones)
+        {
+            if (zone.End >= cutoff)
+            {
+                durations[zone.Name].push_back(zone.End - zone.Start);
+            }
+        }
+    }
+
+    std::vector<ZoneStatistics> result;
+    for (auto& [name, zoneDurations] : durations)
+    {
+        std::sort(zoneDurations.begin(), zoneDurations.end());
+        auto percentile = [&zoneDurations](double p) {
+            auto index = std::min(static_cast<size_t>(p * zoneDurations.size()), zoneDurations.size() - 1);
+            return zoneDurations[index] / 1000000.0;
+        };
+
+        auto& statistics = result.emplace_back();
+        statistics.Name = name;
+        statistics.Count = zoneDurations.size();
+        statistics.P50Ms = percentile(0.50);
+        statistics.P95Ms = percentile(0.95);
+        statistics.P99Ms = percentile(0.99);
+        statistics.MaxMs = zoneDurations.back() / 1000000.0;
+    }
+    return result;
+}
+
+bool Profiling::ExportChromeTrace(const std::string& path)
+{
+    auto events = json_t::array();
+    for (const auto& threadZones : CopyAllZones())
+    {
+        if (threadZones.Name != nullptr)
+        {
+            events.push_back({
+                { "name", "thread_name" },
+                { "ph", "M" },
+                { "pid", 1 },
+                { "tid", threadZones.Index },
+                { "args", { { "name", threadZones.Name } } },
+            });
+        }
+        for (const auto& zone : threadZones.Zones)
+        {
+            // Trace event timestamps are in microseconds.
+            events.push_back({
+                { "name", zone.Name },
+                { "ph", "X" },
+                { "pid", 1 },
+                { "tid", threadZones.Index },
+                { "ts", zone.Start / 1000.0 },
+                { "dur", (zone.End - zone.Start) / 1000.0 },
+            });
+        }
+    }
+
+    json_t trace = {
+        { "traceEvents", std::move(events) },
+        { "displayTimeUnit", "ms" },
+    };
+    try
+    {
+        Json::WriteToFile(path.c_str(), trace, -1);
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        log_error("Unable to write trace to '%s': %s", path.c_str(), e.what());
+        return false;
+    }
+}
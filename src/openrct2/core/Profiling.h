@@ -0,0 +1,86 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Records named zones of time into a ring buffer per thread, so the last few seconds of every thread can be looked at
+ * when something takes too long. Recording a zone only takes the lock of the own thread's buffer, which is never
+ * contended unless the zones are being read at the same time.
+ */
+namespace OpenRCT2::Profiling
+{
+    // Nanoseconds since the profiler was started.
+    using Timestamp = uint64_t;
+
+    // Number of zones each thread keeps, older zones get overwritten.
+    constexpr size_t ZonesPerThread = 32768;
+
+    struct ZoneStatistics
+    {
+        std::string Name;
+        size_t Count{};
+        double P50Ms{};
+        double P95Ms{};
+        double P99Ms{};
+        double MaxMs{};
+    };
+
+    bool IsEnabled();
+    void SetEnabled(bool enabled);
+
+    Timestamp GetTimestamp();
+
+    /**
+     * Records a zone for the current thread, name has to stay valid for the lifetime of the program so use literals.
+     */
+    void RecordZone(const char* name, Timestamp start, Timestamp end);
+
+    /**
+     * Names the current thread in exported traces, name has to stay valid for the lifetime of the program.
+     */
+    void SetThreadName(const char* name);
+
+    /**
+     * @returns the duration percentiles of each zone that ended within the given time, sorted by name.
+     */
+    std::vector<ZoneStatistics> GetZoneStatistics(std::chrono::milliseconds window);
+
+    /**
+     * Writes all recorded zones as trace event JSON which can be opened with chrome://tracing or Perfetto.
+     */
+    bool ExportChromeTrace(const std::string& path);
+
+    class ScopedZone
+    {
+    private:
+        const char* _name;
+        Timestamp _start;
+
+    public:
+        explicit ScopedZone(const char* name)
+            : _name(name)
+            , _start(GetTimestamp())
+        {
+        }
+        ScopedZone(const ScopedZone&) = delete;
+        ScopedZone& operator=(const ScopedZone&) = delete;
+
+        ~ScopedZone()
+        {
+            RecordZone(_name, _start, GetTimestamp());
+        }
+    };
+} // namespace OpenRCT2::Profiling
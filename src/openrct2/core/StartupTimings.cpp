@@ -0,0 +1,150 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "StartupTimings.h"
+
+#include "../Diagnostic.h"
+#include "Json.hpp"
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace OpenRCT2;
+
+namespace
+{
+    struct StartupPhase
+    {
+        const char* Name{};
+        Profiling::Timestamp Start{};
+        Profiling::Timestamp End{};
+        bool Background{};
+    };
+
+    struct StartupIndex
+    {
+        std::string Name;
+        StartupTimings::IndexStatus Status{};
+    };
+} // namespace
+
+// Taken during static initialisation, which runs on the main thread before main.
+static const Profiling::Timestamp _processStart = Profiling::GetTimestamp();
+static const std::thread::id _mainThread = std::this_thread::get_id();
+
+static std::mutex _mutex;
+static std::vector<StartupPhase> _phases;
+static std::vector<StartupIndex> _indexes;
+static std::string _reportPath;
+static bool _finished;
+
+static double ToMilliseconds(Profiling::Timestamp time)
+{
+    return time / 1000000.0;
+}
+
+static const char* GetIndexStatusName(StartupTimings::IndexStatus status)
+{
+    switch (status)
+    {
+        case StartupTimings::IndexStatus::Warm:
+            return "warm";
+        case StartupTimings::IndexStatus::Updated:
+            return "updated";
+        case StartupTimings::IndexStatus::Cold:
+            return "cold";
+    }
+    return "";
+}
+
+void StartupTimings::RecordPhase(const char* name, Profiling::Timestamp start, Profiling::Timestamp end)
+{
+    Profiling::RecordZone(name, start, end);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_finished)
+    {
+        _phases.push_back({ name, start, end, std::this_thread::get_id() != _mainThread });
+    }
+}
+
+void StartupTimings::RecordIndexStatus(const std::string& indexName, IndexStatus status)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_finished)
+    {
+        _indexes.push_back({ indexName, status });
+    }
+}
+
+void StartupTimings::SetReportPath(const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _reportPath = path;
+}
+
+void StartupTimings::Finish()
+{
+    const auto end = Profiling::GetTimestamp();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_finished)
+    {
+        return;
+    }
+    _finished = true;
+
+    log_verbose("Start up took %.1f ms", ToMilliseconds(end - _processStart));
+    for (const auto& phase : _phases)
+    {
+        log_verbose(
+            "  %-24s %9.1f ms (at %.1f ms%s)", phase.Name, ToMilliseconds(phase.End - phase.Start),
+            ToMilliseconds(phase.Start - _processStart), phase.Background ? ", in the background" : "");
+    }
+    for (const auto& index : _indexes)
+    {
+        log_verbose("  %-24s %s", index.Name.c_str(), GetIndexStatusName(index.Status));
+    }
+
+    if (_reportPath.empty())
+    {
+        return;
+    }
+
+    json_t phases = json_t::array();
+    for (const auto& phase : _phases)
+    {
+        phases.push_back({
+            { "name", phase.Name },
+            { "start_ms", ToMilliseconds(phase.Start - _processStart) },
+            { "duration_ms", ToMilliseconds(phase.End - phase.Start) },
+            { "background", phase.Background },
+        });
+    }
+    json_t indexes = json_t::array();
+    for (const auto& index : _indexes)
+    {
+        indexes.push_back({ { "name", index.Name }, { "status", GetIndexStatusName(index.Status) } });
+    }
+    json_t report = {
+        { "total_ms", ToMilliseconds(end - _processStart) },
+        { "phases", phases },
+        { "indexes", indexes },
+    };
+
+    try
+    {
+        Json::WriteToFile(_reportPath.c_str(), report);
+    }
+    catch (const std::exception& e)
+    {
+        log_error("Unable to write the start up timings to %s: %s", _reportPath.c_str(), e.what());
+    }
+}
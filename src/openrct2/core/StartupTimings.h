@@ -0,0 +1,73 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "Profiling.h"
+
+#include <string>
+
+/**
+ * Records how long each phase of starting the game takes, from the start of the process until the title screen or the
+ * park given on the command line is shown. Phases can be recorded from the background threads that scan the
+ * repositories, and the state of the file index caches is kept so cold and warm starts can be told apart.
+ */
+namespace OpenRCT2::StartupTimings
+{
+    enum class IndexStatus
+    {
+        // The index was up to date and loaded as is.
+        Warm,
+        // Only the files that changed since the index was written were read again.
+        Updated,
+        // There was no usable index, all files were read.
+        Cold,
+    };
+
+    /**
+     * Records a phase, name has to stay valid for the lifetime of the program so use literals. Safe to call from any
+     * thread.
+     */
+    void RecordPhase(const char* name, Profiling::Timestamp start, Profiling::Timestamp end);
+
+    void RecordIndexStatus(const std::string& indexName, IndexStatus status);
+
+    /**
+     * Also write the timings as JSON to the given file once the start up is finished.
+     */
+    void SetReportPath(const std::string& path);
+
+    /**
+     * Marks the start up as finished. The timings are logged as verbose messages and written to the report file if one
+     * was set, only the first call does anything. Background phases that have not finished by then are left out.
+     */
+    void Finish();
+
+    /**
+     * Records the phase that runs during the lifetime of the object.
+     */
+    class ScopedPhase
+    {
+    private:
+        const char* _name;
+        Profiling::Timestamp _start;
+
+    public:
+        ScopedPhase(const char* name)
+            : _name(name)
+            , _start(Profiling::GetTimestamp())
+        {
+        }
+        ScopedPhase(const ScopedPhase&) = delete;
+        ~ScopedPhase()
+        {
+            RecordPhase(_name, _start, Profiling::GetTimestamp());
+        }
+    };
+} // namespace OpenRCT2::StartupTimings
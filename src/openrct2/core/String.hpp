@@ -209,27 +209,21 @@ public:
         }
         char32_t operator*() const
         {
+            // ASCII is by far the most common, so it is decoded here rather than by the full decoder
+            auto ch = static_cast<uint8_t>(_str[_index]);
+            if (ch < 0x80)
+                return ch;
             return GetNextCodepoint(&_str[_index], nullptr);
         }
         iterator& operator++()
         {
-            if (_index < _str.size())
-            {
-                const utf8* nextch;
-                GetNextCodepoint(&_str[_index], &nextch);
-                _index = nextch - _str.data();
-            }
+            Advance();
             return *this;
         }
         iterator operator++(int)
         {
             auto result = *this;
-            if (_index < _str.size())
-            {
-                const utf8* nextch;
-                GetNextCodepoint(&_str[_index], &nextch);
-                _index = nextch - _str.data();
-            }
+            Advance();
             return result;
         }
 
@@ -239,6 +233,22 @@ public:
         }
 
         static char32_t GetNextCodepoint(const char* ch, const char** next);
+
+    private:
+        void Advance()
+        {
+            if (_index < _str.size())
+            {
+                if (!(static_cast<uint8_t>(_str[_index]) & 0x80))
+                {
+                    _index++;
+                    return;
+                }
+                const utf8* nextch;
+                GetNextCodepoint(&_str[_index], &nextch);
+                _index = nextch - _str.data();
+            }
+        }
     };
 
     CodepointView(std::string_view str)
@@ -0,0 +1,314 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef _WIN32
+#    include <windows.h>
+#elif defined(__linux__)
+#    include <sched.h>
+#endif
+
+#include "TaskScheduler.h"
+
+#include "Profiling.h"
+
+#include <bitset>
+#include <cassert>
+#include <limits>
+
+using namespace OpenRCT2;
+
+static constexpr size_t NotAWorker = std::numeric_limits<size_t>::max();
+
+static std::mutex _optionsMutex;
+static TaskSchedulerOptions _options;
+static bool _schedulerCreated;
+
+// Index of the queue owned by the current thread, only set for worker threads.
+static thread_local size_t _currentWorkerQueue = NotAWorker;
+
+TaskGroup::~TaskGroup()
+{
+    Wait();
+}
+
+bool TaskGroup::IsDone() const
+{
+    return _pending == 0;
+}
+
+void TaskGroup::Wait()
+{
+    while (!WaitFor(std::chrono::milliseconds(100)))
+    {
+    }
+}
+
+bool TaskGroup::WaitFor(std::chrono::milliseconds timeout)
+{
+    auto& scheduler = TaskScheduler::Get();
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!IsDone())
+    {
+        if (!scheduler.RunPendingTask())
+        {
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= deadline)
+            {
+                return false;
+            }
+
+            // Tasks of this group are running on other threads, wake up regularly in case new work gets queued.
+            auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now);
+            scheduler.WaitForGroup(*this, std::min(remaining, std::chrono::milliseconds(1)));
+        }
+    }
+    return true;
+}
+
+bool TaskScheduler::WorkQueue::PushBack(const Task& task)
+{
+    std::lock_guard<std::mutex> lock(Mutex);
+    if (Count == QueueCapacity)
+    {
+        return false;
+    }
+    Tasks[(Head + Count) % QueueCapacity] = task;
+    Count++;
+    return true;
+}
+
+bool TaskScheduler::WorkQueue::PopBack(Task& task)
+{
+    std::lock_guard<std::mutex> lock(Mutex);
+    if (Count == 0)
+    {
+        return false;
+    }
+    Count--;
+    task = Tasks[(Head + Count) % QueueCapacity];
+    return true;
+}
+
+bool TaskScheduler::WorkQueue::PopFront(Task& task)
+{
+    std::lock_guard<std::mutex> lock(Mutex);
+    if (Count == 0)
+    {
+        return false;
+    }
+    task = Tasks[Head];
+    Head = (Head + 1) % QueueCapacity;
+    Count--;
+    return true;
+}
+
+TaskScheduler::TaskScheduler(const TaskSchedulerOptions& options)
+    : _firstCpu(options.FirstCpu)
+{
+    // The calling thread helps while it waits, so by default leave one hardware thread for it.
+    auto workerCount = options.WorkerCount != 0 ? options.WorkerCount : GetAvailableHardwareThreads() - 1;
+
+    // One queue per worker plus the injection queue for all other threads.
+    for (size_t i = 0; i <= workerCount; i++)
+    {
+        _queues.push_back(std::make_unique<WorkQueue>());
+    }
+    for (size_t i = 0; i < workerCount; i++)
+    {
+        _workers.emplace_back(&TaskScheduler::WorkerMain, this, i);
+    }
+}
+
+TaskScheduler::~TaskScheduler()
+{
+    {
+        std::lock_guard<std::mutex> lock(_sleepMutex);
+        _shouldStop = true;
+    }
+    _wakeCondition.notify_all();
+
+    for (auto& worker : _workers)
+    {
+        assert(worker.joinable());
+        worker.join();
+    }
+}
+
+bool TaskScheduler::Configure(const TaskSchedulerOptions& options)
+{
+    std::lock_guard<std::mutex> lock(_optionsMutex);
+    if (_schedulerCreated)
+    {
+        return false;
+    }
+    _options = options;
+    return true;
+}
+
+TaskScheduler& TaskScheduler::Get()
+{
+    static TaskScheduler scheduler([]() {
+        std::lock_guard<std::mutex> lock(_optionsMutex);
+        _schedulerCreated = true;
+        return _options;
+    }());
+    return scheduler;
+}
+
+size_t TaskScheduler::GetAvailableHardwareThreads()
+{
+    // Respect the CPUs the process has been restricted to, e.g. by taskset or a container, rather than counting all
+    // CPUs of the machine.
+#ifdef _WIN32
+    DWORD_PTR processMask{};
+    DWORD_PTR systemMask{};
+    if (GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask) && processMask != 0)
+    {
+        return std::bitset<sizeof(processMask) * 8>(processMask).count();
+    }
+#elif defined(__linux__)
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    if (sched_getaffinity(0, sizeof(cpuSet), &cpuSet) == 0 && CPU_COUNT(&cpuSet) > 0)
+    {
+        return static_cast<size_t>(CPU_COUNT(&cpuSet));
+    }
+#endif
+    return std::max(std::thread::hardware_concurrency(), 1U);
+}
+
+void TaskScheduler::PinCurrentThread(int32_t cpu)
+{
+#ifdef _WIN32
+    if (cpu < static_cast<int32_t>(sizeof(DWORD_PTR) * 8))
+    {
+        SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(1) << cpu);
+    }
+#elif defined(__linux__)
+    if (cpu < CPU_SETSIZE)
+    {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(cpu, &cpuSet);
+        sched_setaffinity(0, sizeof(cpuSet), &cpuSet);
+    }
+#else
+    // Thread placement can only be hinted at on macOS, leave it to the operating system.
+    (void)cpu;
+#endif
+}
+
+size_t TaskScheduler::GetWorkerCount() const
+{
+    return _workers.size();
+}
+
+void TaskScheduler::Submit(TaskGroup& group, TaskFunction function, void* context, size_t begin, size_t end)
+{
+    Task task{ function, context, begin, end, &group };
+    group._pending++;
+
+    if (_workers.empty())
+    {
+        Execute(task);
+        return;
+    }
+
+    _queuedTasks++;
+    if (!_queues[GetQueueIndexForCurrentThread()]->PushBack(task))
+    {
+        // The queue is full, run the task right away rather than growing the queue.
+        _queuedTasks--;
+        Execute(task);
+        return;
+    }
+
+    if (_sleepingWorkers > 0)
+    {
+        std::lock_guard<std::mutex> lock(_sleepMutex);
+        _wakeCondition.notify_one();
+    }
+}
+
+bool TaskScheduler::RunPendingTask()
+{
+    Task task;
+    if (TryTakeTask(GetQueueIndexForCurrentThread(), task))
+    {
+        Execute(task);
+        return true;
+    }
+    return false;
+}
+
+size_t TaskScheduler::GetQueueIndexForCurrentThread() const
+{
+    return _currentWorkerQueue == NotAWorker ? _workers.size() : _currentWorkerQueue;
+}
+
+bool TaskScheduler::TryTakeTask(size_t queueIndex, Task& task)
+{
+    if (_queuedTasks == 0)
+    {
+        return false;
+    }
+
+    // Newest task of the own queue first as its data is most likely still in cache, then steal the oldest tasks of
+    // the other queues.
+    bool found = _queues[queueIndex]->PopBack(task);
+    for (size_t i = 1; !found && i < _queues.size(); i++)
+    {
+        found = _queues[(queueIndex + i) % _queues.size()]->PopFront(task);
+    }
+    if (found)
+    {
+        _queuedTasks--;
+    }
+    return found;
+}
+
+void TaskScheduler::Execute(const Task& task)
+{
+    task.Function(task.Context, task.Begin, task.End);
+    if (--task.Group->_pending == 0)
+    {
+        std::lock_guard<std::mutex> lock(_doneMutex);
+        _doneCondition.notify_all();
+    }
+}
+
+void TaskScheduler::WaitForGroup(const TaskGroup& group, std::chrono::milliseconds timeout)
+{
+    std::unique_lock<std::mutex> lock(_doneMutex);
+    _doneCondition.wait_for(lock, timeout, [&group]() { return group.IsDone(); });
+}
+
+void TaskScheduler::WorkerMain(size_t queueIndex)
+{
+    _currentWorkerQueue = queueIndex;
+    Profiling::SetThreadName("Task worker");
+    if (_firstCpu >= 0)
+    {
+        PinCurrentThread(_firstCpu + static_cast<int32_t>(queueIndex));
+    }
+    while (!_shouldStop)
+    {
+        Task task;
+        if (TryTakeTask(queueIndex, task))
+        {
+            Execute(task);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(_sleepMutex);
+        _sleepingWorkers++;
+        _wakeCondition.wait(lock, [this]() { return _shouldStop || _queuedTasks > 0; });
+        _sleepingWorkers--;
+    }
+}
@@ -0,0 +1,181 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace OpenRCT2
+{
+    class TaskGroup;
+
+    using TaskFunction = void (*)(void* context, size_t begin, size_t end);
+
+    /**
+     * A unit of work, the function is called with the context and the index range it has to process. Tasks are plain
+     * values so submitting them requires no allocation.
+     */
+    struct Task
+    {
+        TaskFunction Function{};
+        void* Context{};
+        size_t Begin{};
+        size_t End{};
+        TaskGroup* Group{};
+    };
+
+    /**
+     * Tracks a set of submitted tasks so they can be waited on. Waiting threads help executing pending tasks, so waiting
+     * from within a task or on a machine without worker threads does not dead lock.
+     */
+    class TaskGroup
+    {
+        friend class TaskScheduler;
+
+    private:
+        std::atomic<size_t> _pending{};
+
+    public:
+        TaskGroup() = default;
+        TaskGroup(const TaskGroup&) = delete;
+        TaskGroup& operator=(const TaskGroup&) = delete;
+        ~TaskGroup();
+
+        bool IsDone() const;
+        void Wait();
+
+        /**
+         * Waits until all tasks of the group are done or the timeout expired.
+         * @returns true if all tasks are done.
+         */
+        bool WaitFor(std::chrono::milliseconds timeout);
+    };
+
+    struct TaskSchedulerOptions
+    {
+        // Number of worker threads, 0 uses one less than the number of hardware threads the process may run on.
+        size_t WorkerCount{};
+        // Pins worker n to CPU FirstCpu + n, so instances sharing a machine can be given separate CPUs. -1 lets the
+        // operating system place the workers.
+        int32_t FirstCpu = -1;
+    };
+
+    /**
+     * Process wide work stealing scheduler. Every worker owns a queue it pushes to and pops from the back, idle workers
+     * steal from the front of the other queues. Threads that are not workers submit to a shared injection queue.
+     */
+    class TaskScheduler
+    {
+    private:
+        static constexpr size_t QueueCapacity = 1024;
+
+        struct WorkQueue
+        {
+            std::mutex Mutex;
+            std::array<Task, QueueCapacity> Tasks;
+            size_t Head{};
+            size_t Count{};
+
+            bool PushBack(const Task& task);
+            bool PopBack(Task& task);
+            bool PopFront(Task& task);
+        };
+
+        std::vector<std::unique_ptr<WorkQueue>> _queues;
+        std::vector<std::thread> _workers;
+        std::atomic<size_t> _queuedTasks{};
+        std::atomic<size_t> _sleepingWorkers{};
+        std::atomic_bool _shouldStop{ false };
+        std::mutex _sleepMutex;
+        std::condition_variable _wakeCondition;
+        std::mutex _doneMutex;
+        std::condition_variable _doneCondition;
+
+        int32_t _firstCpu{};
+
+        explicit TaskScheduler(const TaskSchedulerOptions& options);
+
+    public:
+        ~TaskScheduler();
+
+        /**
+         * Sets the options the scheduler is created with, only has an effect before the first call to Get.
+         * @returns false if the scheduler is already running.
+         */
+        static bool Configure(const TaskSchedulerOptions& options);
+        static TaskScheduler& Get();
+
+        size_t GetWorkerCount() const;
+
+        void Submit(TaskGroup& group, TaskFunction function, void* context, size_t begin, size_t end);
+
+        /**
+         * Calls func(i) for every i in [begin, end), split into tasks of grainSize indices, and waits for all of them.
+         */
+        template<typename TFunc> void ParallelFor(size_t begin, size_t end, size_t grainSize, const TFunc& func)
+        {
+            if (begin >= end)
+                return;
+
+            grainSize = std::max<size_t>(grainSize, 1);
+            if (_workers.empty() || end - begin <= grainSize)
+            {
+                for (size_t i = begin; i < end; i++)
+                {
+                    func(i);
+                }
+                return;
+            }
+
+            TaskGroup group;
+            auto* context = const_cast<void*>(static_cast<const void*>(&func));
+            for (size_t start = begin; start < end; start += grainSize)
+            {
+                Submit(group, &InvokeRange<TFunc>, context, start, std::min(start + grainSize, end));
+            }
+            group.Wait();
+        }
+
+        /**
+         * Runs one pending task on the calling thread if there is any.
+         * @returns true if a task was run.
+         */
+        bool RunPendingTask();
+
+    private:
+        template<typename TFunc> static void InvokeRange(void* context, size_t begin, size_t end)
+        {
+            const auto& func = *static_cast<const TFunc*>(context);
+            for (size_t i = begin; i < end; i++)
+            {
+                func(i);
+            }
+        }
+
+        static size_t GetAvailableHardwareThreads();
+        static void PinCurrentThread(int32_t cpu);
+
+        size_t GetQueueIndexForCurrentThread() const;
+        bool TryTakeTask(size_t queueIndex, Task& task);
+        void Execute(const Task& task);
+        void WaitForGroup(const TaskGroup& group, std::chrono::milliseconds timeout);
+        void WorkerMain(size_t queueIndex);
+
+        friend class TaskGroup;
+    };
+} // namespace OpenRCT2
@@ -12,6 +12,7 @@
 #include "IStream.hpp"
 
 #include <algorithm>
+#include <unordered_map>
 #ifndef __ANDROID__
 #    include <zip.h>
 #endif
@@ -74,6 +75,10 @@ private:
     ZIP_ACCESS _access;
     std::vector<std::vector<uint8_t>> _writeBuffers;
 
+    // Normalised path to entry index, only used for read access as the entries can not change then. Saves normalising
+    // every entry name each time a file is looked up, which adds up for objects with many images.
+    std::unordered_map<std::string, size_t> _indexByPath;
+
 public:
     ZipArchive(std::string_view path, ZIP_ACCESS access)
     {
@@ -91,6 +96,16 @@ public:
         }
 
         _access = access;
+        if (access == ZIP_ACCESS::READ)
+        {
+            auto numFiles = GetNumFiles();
+            _indexByPath.reserve(numFiles);
+            for (size_t i = 0; i < numFiles; i++)
+            {
+                // Keep the first entry for duplicate paths, same as the linear search
+                _indexByPath.emplace(NormalisePath(GetFileName(i)), i);
+            }
+        }
     }
 
     ~ZipArchive() override
@@ -127,6 +142,21 @@ public:
         }
     }
 
+    std::optional<size_t> GetIndexFromPath(std::string_view path) const override
+    {
+        if (_access != ZIP_ACCESS::READ)
+        {
+            return IZipArchive::GetIndexFromPath(path);
+        }
+
+        auto it = _indexByPath.find(NormalisePath(path));
+        if (!path.empty() && it != _indexByPath.end())
+        {
+            return it->second;
+        }
+        return std::nullopt;
+    }
+
     std::vector<uint8_t> GetFileData(std::string_view path) const override
     {
         std::vector<uint8_t> result;
@@ -47,7 +47,7 @@ struct IZipArchive
     virtual void DeleteFile(std::string_view path) abstract;
     virtual void RenameFile(std::string_view path, std::string_view newPath) abstract;
 
-    std::optional<size_t> GetIndexFromPath(std::string_view path) const;
+    virtual std::optional<size_t> GetIndexFromPath(std::string_view path) const;
     bool Exists(std::string_view path) const;
 };
 
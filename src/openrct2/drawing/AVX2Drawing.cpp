@@ -42,6 +42,22 @@ void mask_avx2(
     }
 }
 
+void remap_run_avx2(const uint8_t* RESTRICT src, const uint8_t* RESTRICT remapped, uint8_t* RESTRICT dst, int32_t count)
+{
+    const __m256i zero = {};
+    int32_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m256i source = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        const __m256i colour = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(remapped + i));
+        const __m256i dest = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        const __m256i transparent = _mm256_or_si256(_mm256_cmpeq_epi8(source, zero), _mm256_cmpeq_epi8(colour, zero));
+        const __m256i blended = _mm256_blendv_epi8(colour, dest, transparent);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), blended);
+    }
+    remap_run_scalar(src + i, remapped + i, dst + i, count - i);
+}
+
 #else
 
 #    ifdef OPENRCT2_X86
@@ -55,4 +71,9 @@ void mask_avx2(
     openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
 }
 
+void remap_run_avx2(const uint8_t* RESTRICT src, const uint8_t* RESTRICT remapped, uint8_t* RESTRICT dst, int32_t count)
+{
+    openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
+}
+
 #endif // __AVX2__
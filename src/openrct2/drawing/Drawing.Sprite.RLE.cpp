@@ -7,10 +7,36 @@
  * OpenRCT2 is licensed under the GNU General Public License version 3.
  *****************************************************************************/
 
+#include "../sprites.h"
 #include "Drawing.h"
 
 #include <algorithm>
+#include <array>
 #include <cstring>
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+// The length of a pixel run is stored in 7 bits.
+static constexpr int32_t RLEMaxRunLength = 0x7F;
+
+// Every zoomed out level samples a quarter of the pixels of the previous one, so the cache is only ever a fraction of
+// the size of the sprites drawn zoomed out. It stops growing once it is full.
+static constexpr size_t MinifiedRLESpriteCacheMaxSize = 32 * 1024 * 1024;
+
+struct MinifiedRLESprite
+{
+    std::vector<uint8_t> Data;
+    rct_g1_element Element{};
+    bool IsValid{};
+};
+
+// Keyed by image index, zoom level and the first row that is sampled.
+static std::unordered_map<uint32_t, MinifiedRLESprite> _minifiedRLESprites;
+static std::shared_mutex _minifiedRLESpritesMutex;
+static size_t _minifiedRLESpritesSize;
 
 template<DrawBlendOp TBlendOp, size_t TZoom> static void FASTCALL DrawRLESpriteMagnify(DrawSpriteArgs& args)
 {
@@ -163,6 +189,31 @@ template<DrawBlendOp TBlendOp, size_t TZoom> static void FASTCALL DrawRLESpriteM
                     std::memcpy(dst, src, numPixels);
                 }
             }
+            else if constexpr (((TBlendOp & BLEND_SRC) != 0) != ((TBlendOp & BLEND_DST) != 0))
+            {
+                // Do the palette lookups first so the transparency test and the store can be done for the whole run at
+                // once by the vectorised kernel.
+                auto& paletteMap = args.PalMap;
+                uint8_t samples[RLEMaxRunLength];
+                uint8_t remapped[RLEMaxRunLength];
+                int32_t count = 0;
+                for (int32_t p = 0; p < numPixels; p += zoom, count++)
+                {
+                    samples[count] = src[p];
+                    if constexpr ((TBlendOp & BLEND_SRC) != 0)
+                    {
+                        remapped[count] = paletteMap[src[p]];
+                    }
+                    else
+                    {
+                        remapped[count] = paletteMap[dst[count]];
+                    }
+                }
+                if (count > 0)
+                {
+                    remap_run_fn(samples, remapped, dst, count);
+                }
+            }
             else
             {
                 auto& paletteMap = args.PalMap;
@@ -235,3 +286,169 @@ void FASTCALL gfx_rle_sprite_to_buffer(DrawSpriteArgs& args)
         DrawRLESprite<BLEND_TRANSPARENT>(args);
     }
 }
+
+static uint32_t GetMinifiedRLESpriteKey(uint32_t imageIndex, int32_t zoomLevel, int32_t firstRow)
+{
+    return (imageIndex << 5) | (zoomLevel << 3) | firstRow;
+}
+
+/**
+ * Takes every zoom-th pixel of every zoom-th row of the sprite, starting at the given row. These are exactly the pixels
+ * DrawRLESpriteMinify samples when the rows of the sprite line up with the given row.
+ */
+static bool BuildMinifiedRLESprite(const rct_g1_element& source, int32_t zoomLevel, int32_t firstRow, MinifiedRLESprite& result)
+{
+    const int32_t zoom = 1 << zoomLevel;
+    const int32_t width = (source.width + zoom - 1) / zoom;
+    const int32_t height = source.height > firstRow ? (source.height - firstRow + zoom - 1) / zoom : 0;
+
+    // Runs start at an 8-bit column
+    std::array<uint8_t, 256> pixels;
+    std::array<bool, 256> isOpaque;
+    if (width > static_cast<int32_t>(pixels.size()))
+        return false;
+
+    auto& data = result.Data;
+    data.resize(static_cast<size_t>(height) * 2);
+    for (int32_t row = 0; row < height; row++)
+    {
+        isOpaque.fill(false);
+
+        auto y = firstRow + row * zoom;
+        uint16_t lineOffset = source.offset[y * 2] | (source.offset[y * 2 + 1] << 8);
+        auto nextRun = source.offset + lineOffset;
+        auto isEndOfLine = false;
+        while (!isEndOfLine)
+        {
+            auto src = nextRun;
+            auto dataSize = *src++;
+            auto firstPixelX = *src++;
+            isEndOfLine = (dataSize & 0x80) != 0;
+            dataSize &= 0x7F;
+            nextRun = src + dataSize;
+
+            for (int32_t i = 0; i < dataSize; i++)
+            {
+                auto x = firstPixelX + i;
+                if (x % zoom == 0 && x < source.width)
+                {
+                    pixels[x / zoom] = src[i];
+                    isOpaque[x / zoom] = true;
+                }
+            }
+        }
+
+        auto lineStart = data.size();
+        if (lineStart > std::numeric_limits<uint16_t>::max())
+            return false;
+        data[row * 2] = lineStart & 0xFF;
+        data[row * 2 + 1] = (lineStart >> 8) & 0xFF;
+
+        // Every line has at least one run, an empty one if there are no pixels on it
+        auto lastRun = lineStart;
+        auto hasRun = false;
+        for (int32_t x = 0; x < width;)
+        {
+            if (!isOpaque[x])
+            {
+                x++;
+                continue;
+            }
+
+            auto start = x;
+            while (x < width && isOpaque[x] && x - start < RLEMaxRunLength)
+            {
+                x++;
+            }
+            lastRun = data.size();
+            data.push_back(static_cast<uint8_t>(x - start));
+            data.push_back(static_cast<uint8_t>(start));
+            data.insert(data.end(), pixels.begin() + start, pixels.begin() + x);
+            hasRun = true;
+        }
+        if (!hasRun)
+        {
+            data.push_back(0);
+            data.push_back(0);
+        }
+        data[lastRun] |= 0x80;
+    }
+
+    result.Element.width = width;
+    result.Element.height = height;
+    result.Element.flags = source.flags & ~G1_FLAG_HAS_ZOOM_SPRITE;
+    return true;
+}
+
+/**
+ * Gets the RLE sprite that holds the pixels of the given sprite sampled at the given zoom level, starting at the given
+ * row, building it the first time it is needed. Its offsets are zero, the caller places it. Returns nullptr for images
+ * whose pixels can change while they are drawn and when the cache is full.
+ */
+const rct_g1_element* gfx_get_minified_rle_sprite(
+    uint32_t imageIndex, const rct_g1_element& source, int32_t zoomLevel, int32_t firstRow)
+{
+    bool isStatic = imageIndex < SPR_SCROLLING_TEXT_START
+        || (imageIndex >= SPR_IMAGE_LIST_BEGIN && imageIndex < SPR_IMAGE_LIST_END);
+    if (!isStatic || zoomLevel <= 0 || zoomLevel > 3)
+        return nullptr;
+
+    auto key = GetMinifiedRLESpriteKey(imageIndex, zoomLevel, firstRow);
+    {
+        std::shared_lock lock(_minifiedRLESpritesMutex);
+        auto it = _minifiedRLESprites.find(key);
+        if (it != _minifiedRLESprites.end())
+        {
+            return it->second.IsValid ? &it->second.Element : nullptr;
+        }
+    }
+
+    MinifiedRLESprite sprite;
+    sprite.IsValid = BuildMinifiedRLESprite(source, zoomLevel, firstRow, sprite);
+    if (!sprite.IsValid)
+    {
+        sprite.Data.clear();
+    }
+
+    std::unique_lock lock(_minifiedRLESpritesMutex);
+    if (_minifiedRLESpritesSize + sprite.Data.size() > MinifiedRLESpriteCacheMaxSize)
+        return nullptr;
+
+    auto [it, inserted] = _minifiedRLESprites.emplace(key, std::move(sprite));
+    if (inserted)
+    {
+        it->second.Element.offset = it->second.Data.data();
+        _minifiedRLESpritesSize += it->second.Data.size();
+    }
+    return it->second.IsValid ? &it->second.Element : nullptr;
+}
+
+/**
+ * Forgets the minified versions of an image whose pixels have been replaced. Images only change while nothing is drawn.
+ */
+void gfx_invalidate_minified_rle_sprite(uint32_t imageIndex)
+{
+    std::unique_lock lock(_minifiedRLESpritesMutex);
+    if (_minifiedRLESprites.empty())
+        return;
+
+    for (int32_t zoomLevel = 1; zoomLevel <= 3; zoomLevel++)
+    {
+        for (int32_t firstRow = 0; firstRow < (1 << zoomLevel); firstRow++)
+        {
+            auto it = _minifiedRLESprites.find(GetMinifiedRLESpriteKey(imageIndex, zoomLevel, firstRow));
+            if (it != _minifiedRLESprites.end())
+            {
+                _minifiedRLESpritesSize -= it->second.Data.size();
+                _minifiedRLESprites.erase(it);
+            }
+        }
+    }
+}
+
+void gfx_invalidate_minified_rle_sprites()
+{
+    std::unique_lock lock(_minifiedRLESpritesMutex);
+    _minifiedRLESprites.clear();
+    _minifiedRLESpritesSize = 0;
+}
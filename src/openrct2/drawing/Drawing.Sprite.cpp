@@ -12,6 +12,7 @@
 #include "../PlatformEnvironment.h"
 #include "../config/Config.h"
 #include "../core/FileStream.h"
+#include "../core/MemoryMappedFile.h"
 #include "../core/Path.hpp"
 #include "../platform/platform.h"
 #include "../sprites.h"
@@ -21,6 +22,9 @@
 #include "ScrollingText.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
 #include <memory>
 #include <stdexcept>
 #include <vector>
@@ -68,10 +72,9 @@ static inline uint32_t rctc_to_rct2_index(uint32_t image)
 }
 // clang-format on
 
-static void read_and_convert_gxdat(IStream* stream, size_t count, bool is_rctc, rct_g1_element* elements)
+static void read_and_convert_gxdat(
+    const rct_g1_element_32bit* g1Elements32, size_t count, bool is_rctc, rct_g1_element* elements)
 {
-    auto g1Elements32 = std::make_unique<rct_g1_element_32bit[]>(count);
-    stream->Read(g1Elements32.get(), count * sizeof(rct_g1_element_32bit));
     if (is_rctc)
     {
         // Process RCTC's g1.dat file
@@ -178,6 +181,17 @@ void mask_scalar(
     }
 }
 
+void remap_run_scalar(const uint8_t* RESTRICT src, const uint8_t* RESTRICT remapped, uint8_t* RESTRICT dst, int32_t count)
+{
+    for (int32_t i = 0; i < count; i++)
+    {
+        if (src[i] != 0 && remapped[i] != 0)
+        {
+            dst[i] = remapped[i];
+        }
+    }
+}
+
 static rct_gx _g1 = {};
 static rct_gx _g2 = {};
 static rct_gx _csg = {};
@@ -188,6 +202,47 @@ static rct_g1_element _g1Temp = {};
 static std::vector<rct_g1_element> _imageListElements;
 bool gTinyFontAntiAliased = false;
 
+static void gfx_clear_remap_tables();
+
+/**
+ * Maps a graphics file consisting of the header, the element table and the pixel data. Only the pages of the sprites
+ * that are drawn get loaded.
+ */
+static void map_gxdat(rct_gx& gx, const std::string& path)
+{
+    gx.data = std::make_unique<MemoryMappedFile>(path);
+    if (gx.data->GetLength() < sizeof(rct_g1_header))
+    {
+        throw std::runtime_error("Graphics file is too small");
+    }
+    std::memcpy(&gx.header, gx.data->GetData(), sizeof(rct_g1_header));
+
+    const auto expectedLength = sizeof(rct_g1_header)
+        + (static_cast<uint64_t>(gx.header.num_entries) * sizeof(rct_g1_element_32bit)) + gx.header.total_size;
+    if (gx.data->GetLength() < expectedLength)
+    {
+        throw std::runtime_error("Graphics file is truncated");
+    }
+}
+
+static const rct_g1_element_32bit* get_gxdat_elements(const rct_gx& gx)
+{
+    return reinterpret_cast<const rct_g1_element_32bit*>(gx.data->GetData() + sizeof(rct_g1_header));
+}
+
+static uint8_t* get_gxdat_pixels(const rct_gx& gx)
+{
+    return gx.data->GetData() + sizeof(rct_g1_header) + (gx.header.num_entries * sizeof(rct_g1_element_32bit));
+}
+
+static void fix_gxdat_offsets(rct_gx& gx, uint8_t* pixels)
+{
+    for (auto& element : gx.elements)
+    {
+        element.offset += reinterpret_cast<uintptr_t>(pixels);
+    }
+}
+
 /**
  *
  *  rct2: 0x00678998
@@ -198,8 +253,7 @@ bool gfx_load_g1(const IPlatformEnvironment& env)
     try
     {
         auto path = Path::Combine(env.GetDirectoryPath(DIRBASE::RCT2, DIRID::DATA), "g1.dat");
-        auto fs = FileStream(path, FILE_MODE_OPEN);
-        _g1.header = fs.ReadValue<rct_g1_header>();
+        map_gxdat(_g1, path);
 
         log_verbose("g1.dat, number of entries: %u", _g1.header.num_entries);
 
@@ -208,26 +262,21 @@ bool gfx_load_g1(const IPlatformEnvironment& env)
             throw std::runtime_error("Not enough elements in g1.dat");
         }
 
-        // Read element headers
+        // Convert element headers
         bool is_rctc = _g1.header.num_entries == SPR_RCTC_G1_END;
         _g1.elements.resize(_g1.header.num_entries);
-        read_and_convert_gxdat(&fs, _g1.header.num_entries, is_rctc, _g1.elements.data());
+        read_and_convert_gxdat(get_gxdat_elements(_g1), _g1.header.num_entries, is_rctc, _g1.elements.data());
         gTinyFontAntiAliased = is_rctc;
 
-        // Read element data
-        _g1.data = fs.ReadArray<uint8_t>(_g1.header.total_size);
-
         // Fix entry data offsets
-        for (uint32_t i = 0; i < _g1.header.num_entries; i++)
-        {
-            _g1.elements[i].offset += reinterpret_cast<uintptr_t>(_g1.data.get());
-        }
+        fix_gxdat_offsets(_g1, get_gxdat_pixels(_g1));
         return true;
     }
     catch (const std::exception&)
     {
         _g1.elements.clear();
         _g1.elements.shrink_to_fit();
+        _g1.data.reset();
 
         log_fatal("Unable to load g1 graphics");
         if (!gOpenRCT2Headless)
@@ -241,6 +290,9 @@ bool gfx_load_g1(const IPlatformEnvironment& env)
 
 void gfx_unload_g1()
 {
+    // The remap tables are built from palettes in g1.
+    gfx_clear_remap_tables();
+    gfx_invalidate_minified_rle_sprites();
     _g1.data.reset();
     _g1.elements.clear();
     _g1.elements.shrink_to_fit();
@@ -248,6 +300,7 @@ void gfx_unload_g1()
 
 void gfx_unload_g2()
 {
+    gfx_invalidate_minified_rle_sprites();
     _g2.data.reset();
     _g2.elements.clear();
     _g2.elements.shrink_to_fit();
@@ -255,6 +308,7 @@ void gfx_unload_g2()
 
 void gfx_unload_csg()
 {
+    gfx_invalidate_minified_rle_sprites();
     _csg.data.reset();
     _csg.elements.clear();
     _csg.elements.shrink_to_fit();
@@ -270,27 +324,21 @@ bool gfx_load_g2()
     safe_strcat_path(path, "g2.dat", MAX_PATH);
     try
     {
-        auto fs = FileStream(path, FILE_MODE_OPEN);
-        _g2.header = fs.ReadValue<rct_g1_header>();
+        map_gxdat(_g2, path);
 
-        // Read element headers
+        // Convert element headers
         _g2.elements.resize(_g2.header.num_entries);
-        read_and_convert_gxdat(&fs, _g2.header.num_entries, false, _g2.elements.data());
-
-        // Read element data
-        _g2.data = fs.ReadArray<uint8_t>(_g2.header.total_size);
+        read_and_convert_gxdat(get_gxdat_elements(_g2), _g2.header.num_entries, false, _g2.elements.data());
 
         // Fix entry data offsets
-        for (uint32_t i = 0; i < _g2.header.num_entries; i++)
-        {
-            _g2.elements[i].offset += reinterpret_cast<uintptr_t>(_g2.data.get());
-        }
+        fix_gxdat_offsets(_g2, get_gxdat_pixels(_g2));
         return true;
     }
     catch (const std::exception&)
     {
         _g2.elements.clear();
         _g2.elements.shrink_to_fit();
+        _g2.data.reset();
 
         log_fatal("Unable to load g2 graphics");
         if (!gOpenRCT2Headless)
@@ -317,9 +365,9 @@ bool gfx_load_csg()
     try
     {
         auto fileHeader = FileStream(pathHeaderPath, FILE_MODE_OPEN);
-        auto fileData = FileStream(pathDataPath, FILE_MODE_OPEN);
+        _csg.data = std::make_unique<MemoryMappedFile>(pathDataPath);
         size_t fileHeaderSize = fileHeader.GetLength();
-        size_t fileDataSize = fileData.GetLength();
+        size_t fileDataSize = _csg.data->GetLength();
 
         _csg.header.num_entries = static_cast<uint32_t>(fileHeaderSize / sizeof(rct_g1_element_32bit));
         _csg.header.total_size = static_cast<uint32_t>(fileDataSize);
@@ -327,20 +375,19 @@ bool gfx_load_csg()
         if (!CsgIsUsable(_csg))
         {
             log_warning("Cannot load CSG1.DAT, it has too few entries. Only CSG1.DAT from Loopy Landscapes will work.");
+            _csg.data.reset();
             return false;
         }
 
         // Read element headers
+        auto csgElements32 = fileHeader.ReadArray<rct_g1_element_32bit>(_csg.header.num_entries);
         _csg.elements.resize(_csg.header.num_entries);
-        read_and_convert_gxdat(&fileHeader, _csg.header.num_entries, false, _csg.elements.data());
-
-        // Read element data
-        _csg.data = fileData.ReadArray<uint8_t>(_csg.header.total_size);
+        read_and_convert_gxdat(csgElements32.get(), _csg.header.num_entries, false, _csg.elements.data());
 
         // Fix entry data offsets
+        fix_gxdat_offsets(_csg, _csg.data->GetData());
         for (uint32_t i = 0; i < _csg.header.num_entries; i++)
         {
-            _csg.elements[i].offset += reinterpret_cast<uintptr_t>(_csg.data.get());
             // RCT1 used zoomed offsets that counted from the beginning of the file, rather than from the current sprite.
             if (_csg.elements[i].flags & G1_FLAG_HAS_ZOOM_SPRITE)
             {
@@ -354,12 +401,91 @@ bool gfx_load_csg()
     {
         _csg.elements.clear();
         _csg.elements.shrink_to_fit();
+        _csg.data.reset();
 
         log_error("Unable to load csg graphics");
         return false;
     }
 }
 
+// Remap tables of sprites with secondary (and tertiary) colours, built on first use and shared by all drawing threads.
+// Indexed by primary, secondary and tertiary colour, where the tertiary slot 0 means no tertiary colour.
+static constexpr size_t RemapTableColourCount = 32;
+static constexpr size_t RemapTableCount = RemapTableColourCount * RemapTableColourCount * (RemapTableColourCount + 1);
+using RemapTable = std::array<uint8_t, 256>;
+static std::array<std::atomic<RemapTable*>, RemapTableCount> _remapTables{};
+
+static void gfx_build_remap_table(ImageId imageId, RemapTable& table)
+{
+    std::copy_n(imageId.HasTertiary() ? gOtherPalette : gPeepPalette, table.size(), table.begin());
+    auto paletteMap = PaletteMap(table.data(), 1, static_cast<uint16_t>(table.size()));
+    if (imageId.HasTertiary())
+    {
+        auto tertiaryPaletteMap = GetPaletteMapForColour(imageId.GetTertiary());
+        if (tertiaryPaletteMap)
+        {
+            paletteMap.Copy(
+                PALETTE_OFFSET_REMAP_TERTIARY, *tertiaryPaletteMap, PALETTE_OFFSET_REMAP_PRIMARY, PALETTE_LENGTH_REMAP);
+        }
+    }
+
+    auto primaryPaletteMap = GetPaletteMapForColour(imageId.GetPrimary());
+    if (primaryPaletteMap)
+    {
+        paletteMap.Copy(PALETTE_OFFSET_REMAP_PRIMARY, *primaryPaletteMap, PALETTE_OFFSET_REMAP_PRIMARY, PALETTE_LENGTH_REMAP);
+    }
+
+    auto secondaryPaletteMap = GetPaletteMapForColour(imageId.GetSecondary());
+    if (secondaryPaletteMap)
+    {
+        paletteMap.Copy(
+            PALETTE_OFFSET_REMAP_SECONDARY, *secondaryPaletteMap, PALETTE_OFFSET_REMAP_PRIMARY, PALETTE_LENGTH_REMAP);
+    }
+}
+
+static const RemapTable& gfx_get_remap_table(ImageId imageId)
+{
+    size_t tertiarySlot = imageId.HasTertiary() ? imageId.GetTertiary() + 1 : 0;
+    if (tertiarySlot > RemapTableColourCount)
+    {
+        // Not a colour, too rare to be worth caching.
+        static thread_local RemapTable uncachedTable;
+        gfx_build_remap_table(imageId, uncachedTable);
+        return uncachedTable;
+    }
+
+    auto& slot = _remapTables[(tertiarySlot * RemapTableColourCount + imageId.GetSecondary()) * RemapTableColourCount
+                              + imageId.GetPrimary()];
+    auto* table = slot.load(std::memory_order_acquire);
+    if (table == nullptr)
+    {
+        auto newTable = std::make_unique<RemapTable>();
+        gfx_build_remap_table(imageId, *newTable);
+
+        // Another thread may have built the same table in the meantime, keep whichever got stored first.
+        if (slot.compare_exchange_strong(table, newTable.get(), std::memory_order_acq_rel))
+        {
+            table = newTable.release();
+        }
+    }
+    return *table;
+}
+
+static void gfx_clear_remap_tables()
+{
+    for (auto& slot : _remapTables)
+    {
+        delete slot.exchange(nullptr);
+    }
+}
+
+static bool gfx_draw_minified_rle_sprite(
+    rct_drawpixelinfo* dpi, ImageId imageId, const rct_g1_element& g1, const ScreenCoordsXY& coords,
+    const PaletteMap& paletteMap);
+static void gfx_draw_sprite_element_software(
+    rct_drawpixelinfo* dpi, ImageId imageId, const rct_g1_element& g1Element, const ScreenCoordsXY& coords,
+    const PaletteMap& paletteMap);
+
 static std::optional<PaletteMap> FASTCALL gfx_draw_sprite_get_palette(ImageId imageId)
 {
     if (!imageId.HasSecondary())
@@ -373,33 +499,9 @@ static std::optional<PaletteMap> FASTCALL gfx_draw_sprite_get_palette(ImageId im
     }
     else
     {
-        auto paletteMap = PaletteMap(gPeepPalette);
-        if (imageId.HasTertiary())
-        {
-            paletteMap = PaletteMap(gOtherPalette);
-            auto tertiaryPaletteMap = GetPaletteMapForColour(imageId.GetTertiary());
-            if (tertiaryPaletteMap)
-            {
-                paletteMap.Copy(
-                    PALETTE_OFFSET_REMAP_TERTIARY, *tertiaryPaletteMap, PALETTE_OFFSET_REMAP_PRIMARY, PALETTE_LENGTH_REMAP);
-            }
-        }
-
-        auto primaryPaletteMap = GetPaletteMapForColour(imageId.GetPrimary());
-        if (primaryPaletteMap)
-        {
-            paletteMap.Copy(
-                PALETTE_OFFSET_REMAP_PRIMARY, *primaryPaletteMap, PALETTE_OFFSET_REMAP_PRIMARY, PALETTE_LENGTH_REMAP);
-        }
-
-        auto secondaryPaletteMap = GetPaletteMapForColour(imageId.GetSecondary());
-        if (secondaryPaletteMap)
-        {
-            paletteMap.Copy(
-                PALETTE_OFFSET_REMAP_SECONDARY, *secondaryPaletteMap, PALETTE_OFFSET_REMAP_PRIMARY, PALETTE_LENGTH_REMAP);
-        }
-
-        return paletteMap;
+        // The table is never written once built, the map only needs a mutable pointer for its other users.
+        auto& table = gfx_get_remap_table(imageId);
+        return PaletteMap(const_cast<uint8_t*>(table.data()), 1, static_cast<uint16_t>(table.size()));
     }
 }
 
@@ -459,6 +561,63 @@ void FASTCALL gfx_draw_sprite_palette_set_software(
         return;
     }
 
+    if (dpi->zoom_level > 0 && (g1->flags & G1_FLAG_RLE_COMPRESSION)
+        && gfx_draw_minified_rle_sprite(dpi, imageId, *g1, coords, paletteMap))
+    {
+        return;
+    }
+
+    gfx_draw_sprite_element_software(dpi, imageId, *g1, coords, paletteMap);
+}
+
+/**
+ * Draws a sprite that is zoomed out from the copy of the pixels that are sampled at that zoom level, instead of skipping
+ * over the pixels of the full sprite. Only done when the drawing area lines up with the zoom level, otherwise the
+ * sampled pixels would not be the same.
+ */
+static bool gfx_draw_minified_rle_sprite(
+    rct_drawpixelinfo* dpi, ImageId imageId, const rct_g1_element& g1, const ScreenCoordsXY& coords,
+    const PaletteMap& paletteMap)
+{
+    auto zoomLevel = static_cast<int8_t>(dpi->zoom_level);
+    int32_t zoomMask = (1 << zoomLevel) - 1;
+    if ((dpi->x & zoomMask) != 0 || (dpi->y & zoomMask) != 0 || (dpi->width & zoomMask) != 0
+        || (dpi->height & zoomMask) != 0)
+    {
+        return false;
+    }
+
+    // Where the zoomed out drawing of the full sprite puts its first column, and the first row it samples
+    int32_t left = (coords.x + g1.x_offset) & ~zoomMask;
+    int32_t top = coords.y - zoomMask + g1.y_offset;
+    int32_t firstRow = -top & zoomMask;
+
+    const auto* minified = gfx_get_minified_rle_sprite(imageId.GetIndex(), g1, zoomLevel, firstRow);
+    if (minified == nullptr)
+    {
+        return false;
+    }
+
+    rct_drawpixelinfo zoomedDpi = *dpi;
+    zoomedDpi.x = dpi->x >> zoomLevel;
+    zoomedDpi.y = dpi->y >> zoomLevel;
+    zoomedDpi.width = dpi->width >> zoomLevel;
+    zoomedDpi.height = dpi->height >> zoomLevel;
+    zoomedDpi.zoom_level = 0;
+
+    const auto spriteCoords = ScreenCoordsXY{ left >> zoomLevel, (top + firstRow) >> zoomLevel };
+    gfx_draw_sprite_element_software(&zoomedDpi, imageId, *minified, spriteCoords, paletteMap);
+    return true;
+}
+
+static void gfx_draw_sprite_element_software(
+    rct_drawpixelinfo* dpi, ImageId imageId, const rct_g1_element& g1Element, const ScreenCoordsXY& coords,
+    const PaletteMap& paletteMap)
+{
+    const auto* g1 = &g1Element;
+    int32_t x = coords.x;
+    int32_t y = coords.y;
+
     // Its used super often so we will define it to a separate variable.
     auto zoom_level = dpi->zoom_level;
     int32_t zoom_mask = zoom_level > 0 ? 0xFFFFFFFF * zoom_level : 0xFFFFFFFF;
@@ -766,6 +925,7 @@ void gfx_set_g1_element(int32_t imageId, const rct_g1_element* g1)
                     _imageListElements.resize(std::max<size_t>(256, _imageListElements.size() * 2));
                 }
                 _imageListElements[idx] = *g1;
+                gfx_invalidate_minified_rle_sprite(imageId);
             }
         }
     }
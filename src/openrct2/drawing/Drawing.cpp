@@ -13,6 +13,7 @@
 #include "../OpenRCT2.h"
 #include "../common.h"
 #include "../core/Guard.hpp"
+#include "../interface/Window.h"
 #include "../object/Object.h"
 #include "../platform/platform.h"
 #include "../sprites.h"
@@ -24,16 +25,15 @@
 
 const PaletteMap& PaletteMap::GetDefault()
 {
-    static bool initialised = false;
+    // Initialised once in a thread safe way, viewport columns may be drawn from several threads.
     static uint8_t data[256];
-    static PaletteMap defaultMap(data);
-    if (!initialised)
-    {
+    static PaletteMap defaultMap = []() {
         for (size_t i = 0; i < sizeof(data); i++)
         {
             data[i] = static_cast<uint8_t>(i);
         }
-    }
+        return PaletteMap(data);
+    }();
     return defaultMap;
 }
 
@@ -552,22 +552,28 @@ void (*mask_fn)(
     int32_t maskWrap, int32_t colourWrap, int32_t dstWrap)
     = nullptr;
 
+void (*remap_run_fn)(const uint8_t* RESTRICT src, const uint8_t* RESTRICT remapped, uint8_t* RESTRICT dst, int32_t count)
+    = remap_run_scalar;
+
 void mask_init()
 {
     if (avx2_available())
     {
         log_verbose("registering AVX2 mask function");
         mask_fn = mask_avx2;
+        remap_run_fn = remap_run_avx2;
     }
     else if (sse41_available())
     {
         log_verbose("registering SSE4.1 mask function");
         mask_fn = mask_sse4_1;
+        remap_run_fn = remap_run_sse4_1;
     }
     else
     {
         log_verbose("registering scalar mask function");
         mask_fn = mask_scalar;
+        remap_run_fn = remap_run_scalar;
     }
 }
 
@@ -652,6 +658,8 @@ void load_palette()
 void gfx_invalidate_screen()
 {
     gfx_set_dirty_blocks({ { 0, 0 }, { context_get_width(), context_get_height() } });
+    window_invalidate_all_surface_caches();
+    viewport_invalidate_paint_cache();
 }
 
 /*
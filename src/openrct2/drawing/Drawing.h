@@ -11,6 +11,7 @@
 #define _DRAWING_H_
 
 #include "../common.h"
+#include "../core/MemoryMappedFile.h"
 #include "../interface/Colour.h"
 #include "../interface/ZoomLevel.h"
 #include "../world/Location.hpp"
@@ -99,7 +100,7 @@ struct rct_gx
 {
     rct_g1_header header;
     std::vector<rct_g1_element> elements;
-    std::unique_ptr<uint8_t[]> data;
+    std::unique_ptr<OpenRCT2::MemoryMappedFile> data;
 };
 
 struct rct_drawpixelinfo
@@ -717,6 +718,10 @@ size_t ImageListGetMaximum();
 void FASTCALL gfx_sprite_to_buffer(DrawSpriteArgs& args);
 void FASTCALL gfx_bmp_sprite_to_buffer(DrawSpriteArgs& args);
 void FASTCALL gfx_rle_sprite_to_buffer(DrawSpriteArgs& args);
+const rct_g1_element* gfx_get_minified_rle_sprite(
+    uint32_t imageIndex, const rct_g1_element& source, int32_t zoomLevel, int32_t firstRow);
+void gfx_invalidate_minified_rle_sprite(uint32_t imageIndex);
+void gfx_invalidate_minified_rle_sprites();
 void FASTCALL gfx_draw_sprite(rct_drawpixelinfo* dpi, ImageId image_id, const ScreenCoordsXY& coords);
 void FASTCALL gfx_draw_sprite(rct_drawpixelinfo* dpi, int32_t image_id, const ScreenCoordsXY& coords, uint32_t tertiary_colour);
 void FASTCALL
@@ -767,6 +772,8 @@ class Formatter;
 int32_t scrolling_text_setup(
     struct paint_session* session, rct_string_id stringId, Formatter& ft, uint16_t scroll, uint16_t scrollingMode,
     colour_t colour);
+// Width of the formatted text in the tiny font, cached until the scrolling text is invalidated.
+uint16_t scrolling_text_get_width(rct_string_id stringId, Formatter& ft);
 
 rct_size16 FASTCALL gfx_get_sprite_size(uint32_t image_id);
 size_t g1_calculate_data_size(const rct_g1_element* g1);
@@ -786,6 +793,14 @@ extern void (*mask_fn)(
     int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
     int32_t maskWrap, int32_t colourWrap, int32_t dstWrap);
 
+// Writes remapped[i] to dst[i] for every pixel where neither src[i] nor remapped[i] is transparent. Used for the pixel
+// runs of RLE sprites once the palette lookup has been done.
+void remap_run_scalar(const uint8_t* RESTRICT src, const uint8_t* RESTRICT remapped, uint8_t* RESTRICT dst, int32_t count);
+void remap_run_sse4_1(const uint8_t* RESTRICT src, const uint8_t* RESTRICT remapped, uint8_t* RESTRICT dst, int32_t count);
+void remap_run_avx2(const uint8_t* RESTRICT src, const uint8_t* RESTRICT remapped, uint8_t* RESTRICT dst, int32_t count);
+
+extern void (*remap_run_fn)(const uint8_t* RESTRICT src, const uint8_t* RESTRICT remapped, uint8_t* RESTRICT dst, int32_t count);
+
 std::optional<uint32_t> GetPaletteG1Index(colour_t paletteId);
 std::optional<PaletteMap> GetPaletteMapForColour(colour_t paletteId);
 
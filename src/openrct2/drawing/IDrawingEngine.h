@@ -32,6 +32,11 @@ enum DRAWING_ENGINE_FLAGS
      * Whether or not the engine will only draw changed blocks of the screen each frame.
      */
     DEF_DIRTY_OPTIMISATIONS = 1 << 0,
+
+    /**
+     * Whether or not the engine can draw to disjoint parts of a DPI from several threads at once.
+     */
+    DEF_PARALLEL_DRAWING = 1 << 1,
 };
 
 struct rct_drawpixelinfo;
@@ -72,6 +77,12 @@ namespace OpenRCT2::Drawing
         virtual DRAWING_ENGINE_FLAGS GetFlags() abstract;
 
         virtual void InvalidateImage(uint32_t image) abstract;
+
+        /**
+         * Number of draw calls the engine issued to the graphics device for the last frame, 0 if the engine does not
+         * draw through one.
+         */
+        virtual uint32_t GetDrawCallCount() const abstract;
     };
 
     struct IDrawingEngineFactory
@@ -17,6 +17,7 @@
 #    include "../interface/Viewport.h"
 #    include "../interface/Window.h"
 #    include "../interface/Window_internal.h"
+#    include "../core/TaskScheduler.h"
 #    include "../paint/Paint.h"
 #    include "../ride/Ride.h"
 #    include "../ride/Vehicle.h"
@@ -30,6 +31,11 @@
 #    include <cmath>
 #    include <cstring>
 
+#    if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#        define LIGHTFX_SSE2
+#        include <emmintrin.h>
+#    endif
+
 static uint8_t _bakedLightTexture_lantern_0[32 * 32];
 static uint8_t _bakedLightTexture_lantern_1[64 * 64];
 static uint8_t _bakedLightTexture_lantern_2[128 * 128];
@@ -87,6 +93,8 @@ static ZoomLevel _current_view_zoom_back_delay = 0;
 
 static GamePalette gPalette_light;
 
+static constexpr size_t LightsPerTask = 16;
+
 static uint8_t calc_light_intensity_lantern(int32_t x, int32_t y)
 {
     double distance = static_cast<double>(x * x + y * y);
@@ -191,220 +199,240 @@ void lightfx_update_buffers(rct_drawpixelinfo* info)
 
 extern void viewport_paint_setup();
 
-void lightfx_prepare_light_list()
+/**
+ * Works out how much of a light is visible by hit testing a few points around it, and scales the light for the zoom
+ * level. Each light only touches its own entry, so lights can be prepared on several threads.
+ */
+static void lightfx_prepare_light(lightlist_entry* entry, uint32_t viewFlags)
 {
-    for (uint32_t light = 0; light < LightListCurrentCountFront; light++)
+    if (entry->z == 0x7FFF)
     {
-        lightlist_entry* entry = &_LightListFront[light];
+        entry->lightIntensity = 0xFF;
+        return;
+    }
 
-        if (entry->z == 0x7FFF)
-        {
-            entry->lightIntensity = 0xFF;
-            continue;
-        }
+    CoordsXYZ coord_3d = { /* .x = */ entry->x,
+                           /* .y = */ entry->y,
+                           /* .z = */ entry->z };
 
-        CoordsXYZ coord_3d = { /* .x = */ entry->x,
-                               /* .y = */ entry->y,
-                               /* .z = */ entry->z };
+    int32_t posOnScreenX = entry->viewCoords.x - _current_view_x_front;
+    int32_t posOnScreenY = entry->viewCoords.y - _current_view_y_front;
 
-        int32_t posOnScreenX = entry->viewCoords.x - _current_view_x_front;
-        int32_t posOnScreenY = entry->viewCoords.y - _current_view_y_front;
+    posOnScreenX = posOnScreenX / _current_view_zoom_front;
+    posOnScreenY = posOnScreenY / _current_view_zoom_front;
 
-        posOnScreenX = posOnScreenX / _current_view_zoom_front;
-        posOnScreenY = posOnScreenY / _current_view_zoom_front;
+    if ((posOnScreenX < -128) || (posOnScreenY < -128) || (posOnScreenX > _pixelInfo.width + 128)
+        || (posOnScreenY > _pixelInfo.height + 128))
+    {
+        entry->lightType = LightType::None;
+        return;
+    }
 
-        if ((posOnScreenX < -128) || (posOnScreenY < -128) || (posOnScreenX > _pixelInfo.width + 128)
-            || (posOnScreenY > _pixelInfo.height + 128))
-        {
-            entry->lightType = LightType::None;
-            continue;
-        }
+    uint32_t lightIntensityOccluded = 0x0;
+
+    int32_t dirVecX = 707;
+    int32_t dirVecY = 707;
+
+    switch (_current_view_rotation_front)
+    {
+        case 0:
+            dirVecX = 707;
+            dirVecY = 707;
+            break;
+        case 1:
+            dirVecX = -707;
+            dirVecY = 707;
+            break;
+        case 2:
+            dirVecX = -707;
+            dirVecY = -707;
+            break;
+        case 3:
+            dirVecX = 707;
+            dirVecY = -707;
+            break;
+        default:
+            dirVecX = 0;
+            dirVecY = 0;
+            break;
+    }
+
+    int32_t tileOffsetX = 0;
+    int32_t tileOffsetY = 0;
+    switch (_current_view_rotation_front)
+    {
+        case 0:
+            tileOffsetX = 0;
+            tileOffsetY = 0;
+            break;
+        case 1:
+            tileOffsetX = 16;
+            tileOffsetY = 0;
+            break;
+        case 2:
+            tileOffsetX = 32;
+            tileOffsetY = 32;
+            break;
+        case 3:
+            tileOffsetX = 0;
+            tileOffsetY = 16;
+            break;
+    }
 
-        uint32_t lightIntensityOccluded = 0x0;
+    int32_t mapFrontDiv = 1 * _current_view_zoom_front;
 
-        int32_t dirVecX = 707;
-        int32_t dirVecY = 707;
+    // clang-format off
+    static constexpr int16_t offsetPattern[26] = {
+        0, 0,
+        -4, 0, 0, -3, 4, 0, 0, 3,
+        -2, -1, -1, -1, 2, 1, 1, 1,
+        -3, -2, -3, 2, 3, -2, 3, 2,
+    };
+    // clang-format on
+
+    // Light occlusion code
+    if (true)
+    {
+        int32_t totalSamplePoints = 5;
+        int32_t startSamplePoint = 1;
 
-        switch (_current_view_rotation_front)
+        if (entry->qualifier == LightFXQualifier::Map)
         {
-            case 0:
-                dirVecX = 707;
-                dirVecY = 707;
-                break;
-            case 1:
-                dirVecX = -707;
-                dirVecY = 707;
-                break;
-            case 2:
-                dirVecX = -707;
-                dirVecY = -707;
-                break;
-            case 3:
-                dirVecX = 707;
-                dirVecY = -707;
-                break;
-            default:
-                dirVecX = 0;
-                dirVecY = 0;
-                break;
+            startSamplePoint = 0;
+            totalSamplePoints = 1;
         }
 
-        int32_t tileOffsetX = 0;
-        int32_t tileOffsetY = 0;
-        switch (_current_view_rotation_front)
+        for (int32_t pat = startSamplePoint; pat < totalSamplePoints; pat++)
         {
-            case 0:
-                tileOffsetX = 0;
-                tileOffsetY = 0;
-                break;
-            case 1:
-                tileOffsetX = 16;
-                tileOffsetY = 0;
-                break;
-            case 2:
-                tileOffsetX = 32;
-                tileOffsetY = 32;
-                break;
-            case 3:
-                tileOffsetX = 0;
-                tileOffsetY = 16;
-                break;
-        }
+            CoordsXY mapCoord{};
 
-        int32_t mapFrontDiv = 1 * _current_view_zoom_front;
+            TileElement* tileElement = nullptr;
 
-        // clang-format off
-        static int16_t offsetPattern[26] = {
-            0, 0,
-            -4, 0, 0, -3, 4, 0, 0, 3,
-            -2, -1, -1, -1, 2, 1, 1, 1,
-            -3, -2, -3, 2, 3, -2, 3, 2,
-        };
-        // clang-format on
+            ViewportInteractionItem interactionType = ViewportInteractionItem::None;
 
-        // Light occlusion code
-        if (true)
-        {
-            int32_t totalSamplePoints = 5;
-            int32_t startSamplePoint = 1;
+            // based on get_map_coordinates_from_pos_window
+            rct_drawpixelinfo dpi;
+            dpi.x = entry->viewCoords.x + offsetPattern[0 + pat * 2] / mapFrontDiv;
+            dpi.y = entry->viewCoords.y + offsetPattern[1 + pat * 2] / mapFrontDiv;
+            dpi.height = 1;
+            dpi.zoom_level = _current_view_zoom_front;
+            dpi.width = 1;
+
+            paint_session* session = PaintSessionAlloc(&dpi, viewFlags);
+            PaintSessionGenerate(session);
+            PaintSessionArrange(session);
+            auto info = set_interaction_info_from_paint_session(session, ViewportInteractionItemAll);
+            PaintSessionFree(session);
 
-            if (entry->qualifier == LightFXQualifier::Map)
+            //  log_warning("[%i, %i]", dpi->x, dpi->y);
+
+            mapCoord = info.Loc;
+            mapCoord.x += tileOffsetX;
+            mapCoord.y += tileOffsetY;
+            interactionType = info.SpriteType;
+            tileElement = info.Element;
+
+            int32_t minDist = 0;
+            int32_t baseHeight = (-999) * COORDS_Z_STEP;
+
+            if (interactionType != ViewportInteractionItem::Entity && tileElement)
             {
-                startSamplePoint = 0;
-                totalSamplePoints = 1;
+                baseHeight = tileElement->GetBaseZ();
             }
 
-            for (int32_t pat = startSamplePoint; pat < totalSamplePoints; pat++)
+            minDist = (baseHeight - coord_3d.z) / 2;
+
+            int32_t deltaX = mapCoord.x - coord_3d.x;
+            int32_t deltaY = mapCoord.y - coord_3d.y;
+
+            int32_t projDot = (dirVecX * deltaX + dirVecY * deltaY) / 1000;
+
+            projDot = std::max(minDist, projDot);
+
+            if (projDot < 5)
             {
-                CoordsXY mapCoord{};
-
-                TileElement* tileElement = nullptr;
-
-                ViewportInteractionItem interactionType = ViewportInteractionItem::None;
-
-                auto* w = window_get_main();
-                if (w != nullptr)
-                {
-                    // based on get_map_coordinates_from_pos_window
-                    rct_drawpixelinfo dpi;
-                    dpi.x = entry->viewCoords.x + offsetPattern[0 + pat * 2] / mapFrontDiv;
-                    dpi.y = entry->viewCoords.y + offsetPattern[1 + pat * 2] / mapFrontDiv;
-                    dpi.height = 1;
-                    dpi.zoom_level = _current_view_zoom_front;
-                    dpi.width = 1;
-
-                    paint_session* session = PaintSessionAlloc(&dpi, w->viewport->flags);
-                    PaintSessionGenerate(session);
-                    PaintSessionArrange(session);
-                    auto info = set_interaction_info_from_paint_session(session, ViewportInteractionItemAll);
-                    PaintSessionFree(session);
-
-                    //  log_warning("[%i, %i]", dpi->x, dpi->y);
-
-                    mapCoord = info.Loc;
-                    mapCoord.x += tileOffsetX;
-                    mapCoord.y += tileOffsetY;
-                    interactionType = info.SpriteType;
-                    tileElement = info.Element;
-                }
-
-                int32_t minDist = 0;
-                int32_t baseHeight = (-999) * COORDS_Z_STEP;
-
-                if (interactionType != ViewportInteractionItem::Entity && tileElement)
-                {
-                    baseHeight = tileElement->GetBaseZ();
-                }
-
-                minDist = (baseHeight - coord_3d.z) / 2;
-
-                int32_t deltaX = mapCoord.x - coord_3d.x;
-                int32_t deltaY = mapCoord.y - coord_3d.y;
-
-                int32_t projDot = (dirVecX * deltaX + dirVecY * deltaY) / 1000;
-
-                projDot = std::max(minDist, projDot);
-
-                if (projDot < 5)
-                {
-                    lightIntensityOccluded += 100;
-                }
-                else
-                {
-                    lightIntensityOccluded += std::max(0, 200 - (projDot * 20));
-                }
-
-                //  log_warning("light %i [%i, %i, %i], [%i, %i] minDist to %i: %i; projdot: %i", light, coord_3d.x, coord_3d.y,
-                //  coord_3d.z, mapCoord.x, mapCoord.y, baseHeight, minDist, projDot);
-
-                if (pat == 0)
-                {
-                    if (lightIntensityOccluded == 100)
-                        break;
-                    if (_current_view_zoom_front > 2)
-                        break;
-                    totalSamplePoints += 4;
-                }
-                else if (pat == 4)
-                {
-                    if (_current_view_zoom_front > 1)
-                        break;
-                    if (lightIntensityOccluded == 0 || lightIntensityOccluded == 500)
-                        break;
-                    // lastSampleCount = lightIntensityOccluded / 500;
-                    //  break;
-                    totalSamplePoints += 4;
-                }
-                else if (pat == 8)
-                {
-                    break;
-                }
+                lightIntensityOccluded += 100;
+            }
+            else
+            {
+                lightIntensityOccluded += std::max(0, 200 - (projDot * 20));
             }
 
-            totalSamplePoints -= startSamplePoint;
+            //  log_warning("light %i [%i, %i, %i], [%i, %i] minDist to %i: %i; projdot: %i", light, coord_3d.x, coord_3d.y,
+            //  coord_3d.z, mapCoord.x, mapCoord.y, baseHeight, minDist, projDot);
 
-            if (lightIntensityOccluded == 0)
+            if (pat == 0)
             {
-                entry->lightType = LightType::None;
-                continue;
+                if (lightIntensityOccluded == 100)
+                    break;
+                if (_current_view_zoom_front > 2)
+                    break;
+                totalSamplePoints += 4;
+            }
+            else if (pat == 4)
+            {
+                if (_current_view_zoom_front > 1)
+                    break;
+                if (lightIntensityOccluded == 0 || lightIntensityOccluded == 500)
+                    break;
+                // lastSampleCount = lightIntensityOccluded / 500;
+                //  break;
+                totalSamplePoints += 4;
+            }
+            else if (pat == 8)
+            {
+                break;
             }
+        }
+
+        totalSamplePoints -= startSamplePoint;
 
-            entry->lightIntensity = std::min<uint32_t>(
-                0xFF, (entry->lightIntensity * lightIntensityOccluded) / (totalSamplePoints * 100));
+        if (lightIntensityOccluded == 0)
+        {
+            entry->lightType = LightType::None;
+            return;
         }
-        entry->lightIntensity = std::max<uint32_t>(
-            0x00, entry->lightIntensity - static_cast<int8_t>(_current_view_zoom_front) * 5);
 
-        if (_current_view_zoom_front > 0)
+        entry->lightIntensity = std::min<uint32_t>(
+            0xFF, (entry->lightIntensity * lightIntensityOccluded) / (totalSamplePoints * 100));
+    }
+    entry->lightIntensity = std::max<uint32_t>(
+        0x00, entry->lightIntensity - static_cast<int8_t>(_current_view_zoom_front) * 5);
+
+    if (_current_view_zoom_front > 0)
+    {
+        if (GetLightTypeSize(entry->lightType) < static_cast<int8_t>(_current_view_zoom_front))
         {
-            if (GetLightTypeSize(entry->lightType) < static_cast<int8_t>(_current_view_zoom_front))
-            {
-                entry->lightType = LightType::None;
-                continue;
-            }
+            entry->lightType = LightType::None;
+            return;
+        }
+
+        entry->lightType = SetLightTypeSize(
+            entry->lightType, GetLightTypeSize(entry->lightType) - static_cast<int8_t>(_current_view_zoom_front));
+    }
+}
+
+void lightfx_prepare_light_list()
+{
+    auto* w = window_get_main();
+    if (w == nullptr || w->viewport == nullptr)
+    {
+        return;
+    }
 
-            entry->lightType = SetLightTypeSize(
-                entry->lightType, GetLightTypeSize(entry->lightType) - static_cast<int8_t>(_current_view_zoom_front));
+    // Every light runs up to nine hit tests, which makes this the most expensive part of a night time frame.
+    const uint32_t viewFlags = w->viewport->flags;
+    if (gConfigGeneral.multithreading)
+    {
+        OpenRCT2::TaskScheduler::Get().ParallelFor(0, LightListCurrentCountFront, LightsPerTask, [viewFlags](size_t light) {
+            lightfx_prepare_light(&_LightListFront[light], viewFlags);
+        });
+    }
+    else
+    {
+        for (uint32_t light = 0; light < LightListCurrentCountFront; light++)
+        {
+            lightfx_prepare_light(&_LightListFront[light], viewFlags);
         }
     }
 }
@@ -450,6 +478,53 @@ void lightfx_update_viewport_settings()
     }
 }
 
+/**
+ * Adds one row of a light texture to the light buffer, saturating at full brightness.
+ */
+static void lightfx_add_light_row(uint8_t* dst, const uint8_t* src, int32_t width, uint32_t intensity)
+{
+    int32_t x = 0;
+#    ifdef LIGHTFX_SSE2
+    if (intensity == 0xFF)
+    {
+        for (; x + 16 <= width; x += 16)
+        {
+            auto light = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x));
+            auto current = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + x));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x), _mm_adds_epu8(current, light));
+        }
+    }
+    else
+    {
+        // The light times (1 + intensity) fits in 16 bits, so the scaling can be done on unsigned 16-bit lanes.
+        const auto scale = _mm_set1_epi16(static_cast<int16_t>(1 + intensity));
+        const auto zero = _mm_setzero_si128();
+        for (; x + 16 <= width; x += 16)
+        {
+            auto light = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x));
+            auto lo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(light, zero), scale), 8);
+            auto hi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(light, zero), scale), 8);
+            auto current = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + x));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x), _mm_adds_epu8(current, _mm_packus_epi16(lo, hi)));
+        }
+    }
+#    endif
+    if (intensity == 0xFF)
+    {
+        for (; x < width; x++)
+        {
+            dst[x] = std::min(0xFF, dst[x] + src[x]);
+        }
+    }
+    else
+    {
+        for (; x < width; x++)
+        {
+            dst[x] = std::min<uint32_t>(0xFF, dst[x] + ((src[x] * (1 + intensity)) >> 8));
+        }
+    }
+}
+
 void lightfx_render_lights_to_frontbuffer()
 {
     if (_light_rendered_buffer_front == nullptr)
@@ -585,35 +660,11 @@ void lightfx_render_lights_to_frontbuffer()
         bufReadSkip = bufReadWidth - bufWriteWidth;
         bufWriteSkip = _pixelInfo.width - bufWriteWidth;
 
-        if (entry->lightIntensity == 0xFF)
+        for (int32_t y = 0; y < bufWriteHeight; y++)
         {
-            for (int32_t y = 0; y < bufWriteHeight; y++)
-            {
-                for (int32_t x = 0; x < bufWriteWidth; x++)
-                {
-                    *bufWriteBase = std::min(0xFF, *bufWriteBase + *bufReadBase);
-                    bufWriteBase++;
-                    bufReadBase++;
-                }
-
-                bufWriteBase += bufWriteSkip;
-                bufReadBase += bufReadSkip;
-            }
-        }
-        else
-        {
-            for (int32_t y = 0; y < bufWriteHeight; y++)
-            {
-                for (int32_t x = 0; x < bufWriteWidth; x++)
-                {
-                    *bufWriteBase = std::min(0xFF, *bufWriteBase + (((*bufReadBase) * (1 + entry->lightIntensity)) >> 8));
-                    bufWriteBase++;
-                    bufReadBase++;
-                }
-
-                bufWriteBase += bufWriteSkip;
-                bufReadBase += bufReadSkip;
-            }
+            lightfx_add_light_row(bufWriteBase, bufReadBase, bufWriteWidth, entry->lightIntensity);
+            bufWriteBase += bufWriteWidth + bufWriteSkip;
+            bufReadBase += bufWriteWidth + bufReadSkip;
         }
     }
 }
@@ -13,6 +13,7 @@
 #include "../config/Config.h"
 #include "../drawing/Drawing.h"
 #include "../interface/Screenshot.h"
+#include "../interface/Viewport.h"
 #include "../localisation/StringIds.h"
 #include "../paint/Painter.h"
 #include "../platform/Platform2.h"
@@ -153,6 +154,8 @@ void drawing_engine_set_vsync(bool vsync)
 
 void gfx_set_dirty_blocks(const ScreenRect& rect)
 {
+    viewport_invalidate_interaction_cache();
+
     auto drawingEngine = GetDrawingEngine();
     if (drawingEngine != nullptr)
     {
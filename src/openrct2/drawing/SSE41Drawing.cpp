@@ -56,6 +56,23 @@ void mask_sse4_1(
     }
 }
 
+void remap_run_sse4_1(const uint8_t* RESTRICT src, const uint8_t* RESTRICT remapped, uint8_t* RESTRICT dst, int32_t count)
+{
+    const __m128i zero128 = {};
+    int32_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i source = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const __m128i colour = _mm_loadu_si128(reinterpret_cast<const __m128i*>(remapped + i));
+        const __m128i dest = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        const __m128i transparent = _mm_or_si128(_mm_cmpeq_epi8(source, zero128), _mm_cmpeq_epi8(colour, zero128));
+        // _mm_blendv_epi8 is SSE4.1
+        const __m128i blended = _mm_blendv_epi8(colour, dest, transparent);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), blended);
+    }
+    remap_run_scalar(src + i, remapped + i, dst + i, count - i);
+}
+
 #else
 
 #    ifdef OPENRCT2_X86
@@ -69,4 +86,9 @@ void mask_sse4_1(
     openrct2_assert(false, "SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
 }
 
+void remap_run_sse4_1(const uint8_t* RESTRICT src, const uint8_t* RESTRICT remapped, uint8_t* RESTRICT dst, int32_t count)
+{
+    openrct2_assert(false, "SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
 #endif // __SSE4_1__
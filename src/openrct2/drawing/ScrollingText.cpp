@@ -21,30 +21,102 @@
 #include "TTF.h"
 
 #include <algorithm>
+#include <cstring>
+#include <limits>
 #include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
 
 using namespace OpenRCT2;
 
-struct rct_draw_scroll_text
+struct ScrollingTextKey
 {
     rct_string_id string_id;
     uint8_t string_args[32];
     colour_t colour;
+    bool upper_case;
+    bool true_type;
+
+    bool operator==(const ScrollingTextKey& other) const
+    {
+        return string_id == other.string_id && colour == other.colour && upper_case == other.upper_case
+            && true_type == other.true_type && std::memcmp(string_args, other.string_args, sizeof(string_args)) == 0;
+    }
+};
+
+struct ScrollingTextKeyHash
+{
+    size_t operator()(const ScrollingTextKey& key) const
+    {
+        // FNV-1a
+        uint32_t hash = 0x811C9DC5;
+        auto mix = [&hash](const uint8_t* data, size_t len) {
+            for (size_t i = 0; i < len; i++)
+            {
+                hash = (hash ^ data[i]) * 0x01000193;
+            }
+        };
+        mix(reinterpret_cast<const uint8_t*>(&key.string_id), sizeof(key.string_id));
+        mix(key.string_args, sizeof(key.string_args));
+        mix(&key.colour, sizeof(key.colour));
+        hash ^= (key.upper_case ? 1 : 0) | (key.true_type ? 2 : 0);
+        return hash;
+    }
+};
+
+/**
+ * One column of rendered text. Rows with their bit set in full are drawn in colour, rows with their bit set in blend
+ * are shaded against what is already in the bitmap.
+ */
+struct ScrollingTextColumn
+{
+    uint8_t full;
+    uint8_t blend;
+    colour_t colour;
+};
+
+/**
+ * The whole text rendered once as a strip of columns. Scrolling only changes which columns are copied into the
+ * bitmap, so a new scroll position never needs the string to be formatted or rasterised again.
+ */
+struct ScrollingTextStrip
+{
+    std::vector<ScrollingTextColumn> columns;
+    // Columns past the end of the strip repeat the columns from this index onwards.
+    size_t repeat_start{};
+    size_t max_columns{};
+    uint32_t last_used{};
+
+    const ScrollingTextColumn& GetColumn(size_t index) const
+    {
+        if (index < columns.size())
+            return columns[index];
+        return columns[repeat_start + (index - repeat_start) % (columns.size() - repeat_start)];
+    }
+};
+
+struct rct_draw_scroll_text
+{
+    ScrollingTextKey key;
     uint16_t position;
     uint16_t mode;
     uint32_t id;
     uint8_t bitmap[64 * 40];
 };
 
+static constexpr size_t MaxScrollingTextStrips = 1024;
+
 static rct_draw_scroll_text _drawScrollTextList[OpenRCT2::MaxScrollingTextEntries];
+static std::unordered_map<ScrollingTextKey, ScrollingTextStrip, ScrollingTextKeyHash> _scrollingTextStrips;
+static std::unordered_map<ScrollingTextKey, uint16_t, ScrollingTextKeyHash> _scrollingTextWidths;
 static uint8_t _characterBitmaps[FONT_SPRITE_GLYPH_COUNT + SPR_G2_GLYPH_COUNT][8];
 static uint32_t _drawSCrollNextIndex = 0;
 static std::mutex _scrollingTextMutex;
+static std::mutex _scrollingTextTtfMutex;
 
-static void scrolling_text_set_bitmap_for_sprite(
-    std::string_view text, int32_t scroll, uint8_t* bitmap, const int16_t* scrollPositionOffsets, colour_t colour);
-static void scrolling_text_set_bitmap_for_ttf(
-    std::string_view text, int32_t scroll, uint8_t* bitmap, const int16_t* scrollPositionOffsets, colour_t colour);
+static ScrollingTextStrip scrolling_text_create_strip_for_sprite(std::string_view text, colour_t colour);
+static ScrollingTextStrip scrolling_text_create_strip_for_ttf(std::string_view text, colour_t colour);
 
 void scrolling_text_initialise_bitmaps()
 {
@@ -119,6 +191,9 @@ void scrolling_text_initialise_bitmaps()
 
         gfx_set_g1_element(imageId, &g1);
     }
+
+    // The glyphs may have changed, so any text rendered with the old ones is stale
+    scrolling_text_invalidate();
 }
 
 static uint8_t* font_sprite_get_codepoint_bitmap(int32_t codepoint)
@@ -134,41 +209,41 @@ static uint8_t* font_sprite_get_codepoint_bitmap(int32_t codepoint)
     }
 }
 
-static int32_t scrolling_text_get_matching_or_oldest(
-    rct_string_id stringId, Formatter& ft, uint16_t scroll, uint16_t scrollingMode, colour_t colour)
+static size_t scrolling_text_get_matching_or_oldest(
+    const ScrollingTextKey& key, uint16_t scroll, uint16_t scrollingMode, bool& matched)
 {
     uint32_t oldestId = 0xFFFFFFFF;
-    int32_t scrollIndex = -1;
+    size_t scrollIndex = 0;
     for (size_t i = 0; i < std::size(_drawScrollTextList); i++)
     {
         rct_draw_scroll_text* scrollText = &_drawScrollTextList[i];
         if (oldestId >= scrollText->id)
         {
             oldestId = scrollText->id;
-            scrollIndex = static_cast<int32_t>(i);
+            scrollIndex = i;
         }
 
         // If exact match return the matching index
-        if (scrollText->string_id == stringId
-            && std::memcmp(scrollText->string_args, ft.Buf(), sizeof(scrollText->string_args)) == 0
-            && scrollText->colour == colour && scrollText->position == scroll && scrollText->mode == scrollingMode)
+        if (scrollText->position == scroll && scrollText->mode == scrollingMode && scrollText->key == key)
         {
             scrollText->id = _drawSCrollNextIndex;
-            return static_cast<int32_t>(i + SPR_SCROLLING_TEXT_START);
+            matched = true;
+            return i;
         }
     }
+    matched = false;
     return scrollIndex;
 }
 
-static void scrolling_text_format(utf8* dst, size_t size, rct_draw_scroll_text* scrollText)
+static void scrolling_text_format(utf8* dst, size_t size, const ScrollingTextKey& key)
 {
-    if (gConfigGeneral.upper_case_banners)
+    if (key.upper_case)
     {
-        format_string_to_upper(dst, size, scrollText->string_id, scrollText->string_args);
+        format_string_to_upper(dst, size, key.string_id, key.string_args);
     }
     else
     {
-        format_string(dst, size, scrollText->string_id, scrollText->string_args);
+        format_string(dst, size, key.string_id, key.string_args);
     }
 }
 
@@ -1440,18 +1515,116 @@ static constexpr const int16_t* _scrollPositions[MAX_SCROLLING_TEXT_MODES] = {
 
 void scrolling_text_invalidate()
 {
+    std::scoped_lock<std::mutex> lock(_scrollingTextMutex);
     for (auto& scrollText : _drawScrollTextList)
     {
-        scrollText.string_id = 0;
-        std::memset(scrollText.string_args, 0, sizeof(scrollText.string_args));
+        scrollText.key.string_id = 0;
+        std::memset(scrollText.key.string_args, 0, sizeof(scrollText.key.string_args));
+    }
+    _scrollingTextStrips.clear();
+    _scrollingTextWidths.clear();
+}
+
+static void scrolling_text_draw_strip(
+    const ScrollingTextStrip& strip, size_t scroll, uint8_t* bitmap, const int16_t* scrollPositionOffsets)
+{
+    if (strip.columns.empty())
+        return;
+
+    // Skip any non-displayed columns
+    for (size_t column = scroll; column < strip.max_columns; column++, scrollPositionOffsets++)
+    {
+        int16_t scrollPosition = *scrollPositionOffsets;
+        if (scrollPosition == -1)
+            return;
+
+        if (scrollPosition > -1)
+        {
+            const auto& src = strip.GetColumn(column);
+            auto dst = &bitmap[scrollPosition];
+            for (uint8_t row = 0; row < 8; row++)
+            {
+                auto mask = static_cast<uint8_t>(1 << row);
+                if (src.full & mask)
+                {
+                    *dst = src.colour;
+                }
+                else if (src.blend & mask)
+                {
+                    *dst = blendColours(src.colour, *dst);
+                }
+
+                // Jump to next row
+                dst += 64;
+            }
+        }
+    }
+}
+
+static ScrollingTextStrip scrolling_text_create_strip(const ScrollingTextKey& key)
+{
+    // Create the string to draw
+    utf8 scrollString[256];
+    scrolling_text_format(scrollString, sizeof(scrollString), key);
+
+    if (key.true_type)
+    {
+        return scrolling_text_create_strip_for_ttf(scrollString, key.colour);
+    }
+    return scrolling_text_create_strip_for_sprite(scrollString, key.colour);
+}
+
+/**
+ * Returns the image of the text at the given scroll position, drawing it from the cached strip if needed. Returns
+ * std::nullopt when the text has not been rendered yet. Must be called with _scrollingTextMutex held.
+ */
+static std::optional<uint32_t> scrolling_text_get_image(const ScrollingTextKey& key, uint16_t scroll, uint16_t scrollingMode)
+{
+    bool matched;
+    auto scrollIndex = scrolling_text_get_matching_or_oldest(key, scroll, scrollingMode, matched);
+    uint32_t imageId = SPR_SCROLLING_TEXT_START + static_cast<uint32_t>(scrollIndex);
+    if (matched)
+        return imageId;
+
+    auto it = _scrollingTextStrips.find(key);
+    if (it == _scrollingTextStrips.end())
+        return std::nullopt;
+
+    auto& strip = it->second;
+    strip.last_used = _drawSCrollNextIndex;
+
+    auto scrollText = &_drawScrollTextList[scrollIndex];
+    scrollText->key = key;
+    scrollText->position = scroll;
+    scrollText->mode = scrollingMode;
+    scrollText->id = _drawSCrollNextIndex;
+
+    std::fill_n(scrollText->bitmap, 320 * 8, 0x00);
+    scrolling_text_draw_strip(strip, scroll, scrollText->bitmap, _scrollPositions[scrollingMode]);
+
+    drawing_engine_invalidate_image(imageId);
+    return imageId;
+}
+
+static void scrolling_text_add_strip(const ScrollingTextKey& key, ScrollingTextStrip&& strip)
+{
+    if (_scrollingTextStrips.find(key) != _scrollingTextStrips.end())
+        return;
+
+    if (_scrollingTextStrips.size() >= MaxScrollingTextStrips)
+    {
+        auto oldest = std::min_element(
+            _scrollingTextStrips.begin(), _scrollingTextStrips.end(),
+            [](const auto& a, const auto& b) { return a.second.last_used < b.second.last_used; });
+        _scrollingTextStrips.erase(oldest);
     }
+    strip.last_used = _drawSCrollNextIndex;
+    _scrollingTextStrips.emplace(key, std::move(strip));
 }
 
 int32_t scrolling_text_setup(
     paint_session* session, rct_string_id stringId, Formatter& ft, uint16_t scroll, uint16_t scrollingMode, colour_t colour)
 {
-    std::scoped_lock<std::mutex> lock(_scrollingTextMutex);
-
     assert(scrollingMode < MAX_SCROLLING_TEXT_MODES);
 
     rct_drawpixelinfo* dpi = &session->DPI;
@@ -1459,51 +1632,70 @@ int32_t scrolling_text_setup(
     if (dpi->zoom_level > 0)
         return SPR_SCROLLING_TEXT_DEFAULT;
 
-    _drawSCrollNextIndex++;
+    ScrollingTextKey key{};
+    key.string_id = stringId;
     ft.Rewind();
-    int32_t scrollIndex = scrolling_text_get_matching_or_oldest(stringId, ft, scroll, scrollingMode, colour);
-    if (scrollIndex >= SPR_SCROLLING_TEXT_START)
-        return scrollIndex;
+    std::memcpy(key.string_args, ft.Buf(), sizeof(key.string_args));
+    key.colour = colour;
+    key.upper_case = gConfigGeneral.upper_case_banners;
+    key.true_type = LocalisationService_UseTrueTypeFont();
 
-    // Setup scrolling text
-    auto scrollText = &_drawScrollTextList[scrollIndex];
-    scrollText->string_id = stringId;
-    std::memcpy(scrollText->string_args, ft.Buf(), sizeof(scrollText->string_args));
-    scrollText->colour = colour;
-    scrollText->position = scroll;
-    scrollText->mode = scrollingMode;
-    scrollText->id = _drawSCrollNextIndex;
+    {
+        std::scoped_lock<std::mutex> lock(_scrollingTextMutex);
+        _drawSCrollNextIndex++;
+        auto imageId = scrolling_text_get_image(key, scroll, scrollingMode);
+        if (imageId.has_value())
+            return *imageId;
+    }
 
-    // Create the string to draw
-    utf8 scrollString[256];
-    scrolling_text_format(scrollString, 256, scrollText);
+    // Format and rasterise the text without holding the lock, so other paint sessions are not held up while
+    // they scroll text that is already cached or render different text at the same time.
+    auto strip = scrolling_text_create_strip(key);
 
-    const int16_t* scrollingModePositions = _scrollPositions[scrollingMode];
+    std::scoped_lock<std::mutex> lock(_scrollingTextMutex);
+    scrolling_text_add_strip(key, std::move(strip));
+    return scrolling_text_get_image(key, scroll, scrollingMode).value_or(SPR_SCROLLING_TEXT_DEFAULT);
+}
+
+uint16_t scrolling_text_get_width(rct_string_id stringId, Formatter& ft)
+{
+    ScrollingTextKey key{};
+    key.string_id = stringId;
+    ft.Rewind();
+    std::memcpy(key.string_args, ft.Buf(), sizeof(key.string_args));
+    key.upper_case = gConfigGeneral.upper_case_banners;
+    key.true_type = LocalisationService_UseTrueTypeFont();
 
-    std::fill_n(scrollText->bitmap, 320 * 8, 0x00);
-    if (LocalisationService_UseTrueTypeFont())
     {
-        scrolling_text_set_bitmap_for_ttf(scrollString, scroll, scrollText->bitmap, scrollingModePositions, colour);
+        std::scoped_lock<std::mutex> lock(_scrollingTextMutex);
+        auto it = _scrollingTextWidths.find(key);
+        if (it != _scrollingTextWidths.end())
+            return it->second;
     }
-    else
+
+    utf8 scrollString[256];
+    scrolling_text_format(scrollString, sizeof(scrollString), key);
+    auto width = static_cast<uint16_t>(gfx_get_string_width(scrollString, FontSpriteBase::TINY));
+
+    std::scoped_lock<std::mutex> lock(_scrollingTextMutex);
+    if (_scrollingTextWidths.size() >= MaxScrollingTextStrips)
     {
-        scrolling_text_set_bitmap_for_sprite(scrollString, scroll, scrollText->bitmap, scrollingModePositions, colour);
+        _scrollingTextWidths.clear();
     }
-
-    uint32_t imageId = SPR_SCROLLING_TEXT_START + scrollIndex;
-    drawing_engine_invalidate_image(imageId);
-    return imageId;
+    _scrollingTextWidths.emplace(key, width);
+    return width;
 }
 
-static void scrolling_text_set_bitmap_for_sprite(
-    std::string_view text, int32_t scroll, uint8_t* bitmap, const int16_t* scrollPositionOffsets, colour_t colour)
+static ScrollingTextStrip scrolling_text_create_strip_for_sprite(std::string_view text, colour_t colour)
 {
+    ScrollingTextStrip strip;
     auto characterColour = colour;
     auto fmt = FmtString(text);
 
-    // Repeat string a maximum of four times (eliminates possibility of infinite loop)
-    for (auto i = 0; i < 4; i++)
+    // The second pass starts in the colour the first one ended with, any later pass is the same as the second.
+    for (auto i = 0; i < 2; i++)
     {
+        strip.repeat_start = strip.columns.size();
         for (const auto& token : fmt)
         {
             if (token.IsLiteral())
@@ -1515,30 +1707,7 @@ static void scrolling_text_set_bitmap_for_sprite(
                     auto characterBitmap = font_sprite_get_codepoint_bitmap(codepoint);
                     for (; characterWidth != 0; characterWidth--, characterBitmap++)
                     {
-                        // Skip any non-displayed columns
-                        if (scroll != 0)
-                        {
-                            scroll--;
-                            continue;
-                        }
-
-                        int16_t scrollPosition = *scrollPositionOffsets;
-                        if (scrollPosition == -1)
-                            return;
-
-                        if (scrollPosition > -1)
-                        {
-                            auto dst = &bitmap[scrollPosition];
-                            for (uint8_t char_bitmap = *characterBitmap; char_bitmap != 0; char_bitmap >>= 1)
-                            {
-                                if (char_bitmap & 1)
-                                    *dst = characterColour;
-
-                                // Jump to next row
-                                dst += 64;
-                            }
-                        }
-                        scrollPositionOffsets++;
+                        strip.columns.push_back({ *characterBitmap, 0, characterColour });
                     }
                 }
             }
@@ -1553,17 +1722,20 @@ static void scrolling_text_set_bitmap_for_sprite(
             }
         }
     }
+
+    // Repeat string a maximum of four times (eliminates possibility of infinite loop)
+    strip.max_columns = (strip.columns.size() - strip.repeat_start) * 4;
+    return strip;
 }
 
-static void scrolling_text_set_bitmap_for_ttf(
-    std::string_view text, int32_t scroll, uint8_t* bitmap, const int16_t* scrollPositionOffsets, colour_t colour)
+static ScrollingTextStrip scrolling_text_create_strip_for_ttf(std::string_view text, colour_t colour)
 {
+    ScrollingTextStrip strip;
 #ifndef NO_TTF
     auto fontDesc = ttf_get_font_from_sprite_base(FontSpriteBase::TINY);
     if (fontDesc->font == nullptr)
     {
-        scrolling_text_set_bitmap_for_sprite(text, scroll, bitmap, scrollPositionOffsets, colour);
-        return;
+        return scrolling_text_create_strip_for_sprite(text, colour);
     }
 
     thread_local std::string ttfBuffer;
@@ -1587,10 +1759,12 @@ static void scrolling_text_set_bitmap_for_ttf(
         }
     }
 
+    // The surface is owned by the TTF cache, so stop another paint session evicting it while it is being read.
+    std::scoped_lock<std::mutex> lock(_scrollingTextTtfMutex);
     auto surface = ttf_surface_cache_get_or_add(fontDesc->font, ttfBuffer.c_str());
     if (surface == nullptr)
     {
-        return;
+        return strip;
     }
 
     int32_t pitch = surface->pitch;
@@ -1606,46 +1780,29 @@ static void scrolling_text_set_bitmap_for_ttf(
 
     bool use_hinting = gConfigFonts.enable_hinting && fontDesc->hinting_threshold > 0;
 
-    for (int32_t x = 0;; x++)
+    // The text wraps around until the scroll positions run out.
+    strip.max_columns = std::numeric_limits<size_t>::max();
+    strip.columns.reserve(std::max(width, 0));
+    for (int32_t x = 0; x < width; x++)
     {
-        if (x >= width)
-            x = 0;
-
-        // Skip any non-displayed columns
-        if (scroll == 0)
+        ScrollingTextColumn column{ 0, 0, colour };
+        for (int32_t y = min_vpos; y < max_vpos; y++)
         {
-            int16_t scrollPosition = *scrollPositionOffsets;
-            if (scrollPosition == -1)
-                return;
-
-            if (scrollPosition > -1)
+            auto mask = static_cast<uint8_t>(1 << (y - min_vpos));
+            uint8_t src_pixel = src[y * pitch + x];
+            if ((!use_hinting && src_pixel != 0) || src_pixel > 140)
             {
-                uint8_t* dst = &bitmap[scrollPosition];
-
-                for (int32_t y = min_vpos; y < max_vpos; y++)
-                {
-                    uint8_t src_pixel = src[y * pitch + x];
-                    if ((!use_hinting && src_pixel != 0) || src_pixel > 140)
-                    {
-                        // Centre of the glyph: use full colour.
-                        *dst = colour;
-                    }
-                    else if (use_hinting && src_pixel > fontDesc->hinting_threshold)
-                    {
-                        // Simulate font hinting by shading the background colour instead.
-                        *dst = blendColours(colour, *dst);
-                    }
-
-                    // Jump to next row
-                    dst += 64;
-                }
+                // Centre of the glyph: use full colour.
+                column.full |= mask;
+            }
+            else if (use_hinting && src_pixel > fontDesc->hinting_threshold)
+            {
+                // Simulate font hinting by shading the background colour instead.
+                column.blend |= mask;
             }
-            scrollPositionOffsets++;
-        }
-        else
-        {
-            scroll--;
         }
+        strip.columns.push_back(column);
     }
 #endif // NO_TTF
+    return strip;
 }
@@ -29,6 +29,9 @@ static bool _ttfInitialised = false;
 
 #    define TTF_SURFACE_CACHE_SIZE 256
 #    define TTF_GETWIDTH_CACHE_SIZE 1024
+// How many entries after the hashed one a string may be stored in. Limits the work of a miss, which is common for text
+// that changes every frame such as numbers.
+#    define TTF_CACHE_PROBE_LENGTH 16
 
 struct ttf_cache_entry
 {
@@ -228,13 +231,17 @@ TTFSurface* ttf_surface_cache_get_or_add(TTF_Font* font, std::string_view text)
 
     FontLockHelper<std::mutex> lock(_mutex);
 
-    for (int32_t i = 0; i < TTF_SURFACE_CACHE_SIZE; i++)
+    ttf_cache_entry* oldestEntry = nullptr;
+    for (int32_t i = 0; i < TTF_CACHE_PROBE_LENGTH; i++)
     {
         entry = &_ttfSurfaceCache[index];
 
         // Check if entry is a hit
         if (entry->surface == nullptr)
+        {
+            oldestEntry = entry;
             break;
+        }
         if (entry->font == font && String::Equals(entry->text, text))
         {
             _ttfSurfaceCacheHitCount++;
@@ -245,16 +252,21 @@ TTFSurface* ttf_surface_cache_get_or_add(TTF_Font* font, std::string_view text)
         // If entry hasn't been used for a while, replace it
         if (entry->lastUseTick < gCurrentDrawCount - 64)
         {
+            oldestEntry = entry;
             break;
         }
+        if (oldestEntry == nullptr || entry->lastUseTick < oldestEntry->lastUseTick)
+        {
+            oldestEntry = entry;
+        }
 
         // Check if next entry is a hit
         if (++index >= TTF_SURFACE_CACHE_SIZE)
             index = 0;
     }
 
-    // Cache miss, replace entry with new surface
-    entry = &_ttfSurfaceCache[index];
+    // Cache miss, replace the least recently used entry with new surface
+    entry = oldestEntry;
     ttf_surface_cache_dispose(entry);
 
     TTFSurface* surface = ttf_render(font, text);
@@ -304,13 +316,17 @@ uint32_t ttf_getwidth_cache_get_or_add(TTF_Font* font, std::string_view text)
 
     FontLockHelper<std::mutex> lock(_mutex);
 
-    for (int32_t i = 0; i < TTF_GETWIDTH_CACHE_SIZE; i++)
+    ttf_getwidth_cache_entry* oldestEntry = nullptr;
+    for (int32_t i = 0; i < TTF_CACHE_PROBE_LENGTH; i++)
     {
         entry = &_ttfGetWidthCache[index];
 
         // Check if entry is a hit
         if (entry->text == nullptr)
+        {
+            oldestEntry = entry;
             break;
+        }
         if (entry->font == font && String::Equals(entry->text, text))
         {
             _ttfGetWidthCacheHitCount++;
@@ -321,16 +337,21 @@ uint32_t ttf_getwidth_cache_get_or_add(TTF_Font* font, std::string_view text)
         // If entry hasn't been used for a while, replace it
         if (entry->lastUseTick < gCurrentDrawCount - 64)
         {
+            oldestEntry = entry;
             break;
         }
+        if (oldestEntry == nullptr || entry->lastUseTick < oldestEntry->lastUseTick)
+        {
+            oldestEntry = entry;
+        }
 
         // Check if next entry is a hit
         if (++index >= TTF_GETWIDTH_CACHE_SIZE)
             index = 0;
     }
 
-    // Cache miss, replace entry with new width
-    entry = &_ttfGetWidthCache[index];
+    // Cache miss, replace the least recently used entry with new width
+    entry = oldestEntry;
     ttf_getwidth_cache_dispose(entry);
 
     int32_t width, height;
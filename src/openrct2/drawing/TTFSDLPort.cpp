@@ -86,6 +86,11 @@ in the result FT_Bitmap after the FT_Render_Glyph() call. */
 #    define CACHED_BITMAP 0x01
 #    define CACHED_PIXMAP 0x02
 
+/* Glyphs are cached in sets of two, so two glyphs that map to the same set do not keep replacing each other. This
+matters for scripts with thousands of glyphs, where a single direct mapped slot per set thrashes. */
+#    define GLYPH_CACHE_SETS 521 /* a prime */
+#    define GLYPH_CACHE_WAYS 2
+
 /* Cached glyph information */
 struct c_glyph
 {
@@ -132,7 +137,8 @@ struct _TTF_Font
 
     /* Cache for style-transformed glyphs */
     c_glyph* current;
-    c_glyph cache[257]; /* 257 is a prime */
+    c_glyph cache[GLYPH_CACHE_SETS * GLYPH_CACHE_WAYS];
+    uint8_t cache_last_used[GLYPH_CACHE_SETS];
 
     /* We are responsible for closing the font stream */
     FILE* src;
@@ -970,13 +976,22 @@ static FT_Error Load_Glyph(TTF_Font* font, uint16_t ch, c_glyph* cached, int wan
 static FT_Error Find_Glyph(TTF_Font* font, uint16_t ch, int want)
 {
     int retval = 0;
-    int hsize = sizeof(font->cache) / sizeof(font->cache[0]);
-
-    int h = ch % hsize;
-    font->current = &font->cache[h];
 
-    if (font->current->cached != ch)
-        Flush_Glyph(font->current);
+    int set = ch % GLYPH_CACHE_SETS;
+    c_glyph* ways = &font->cache[set * GLYPH_CACHE_WAYS];
+    int way = 0;
+    while (way < GLYPH_CACHE_WAYS && ways[way].cached != ch)
+    {
+        way++;
+    }
+    if (way == GLYPH_CACHE_WAYS)
+    {
+        /* Replace the glyph of the set that was not used last */
+        way = (font->cache_last_used[set] + 1) % GLYPH_CACHE_WAYS;
+        Flush_Glyph(&ways[way]);
+    }
+    font->cache_last_used[set] = static_cast<uint8_t>(way);
+    font->current = &ways[way];
 
     if ((font->current->stored & want) != want)
     {
@@ -13,6 +13,7 @@
 #include "../Game.h"
 #include "../Intro.h"
 #include "../config/Config.h"
+#include "../core/TaskScheduler.h"
 #include "../interface/Screenshot.h"
 #include "../interface/Viewport.h"
 #include "../interface/Window.h"
@@ -32,6 +33,12 @@ using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
 using namespace OpenRCT2::Ui;
 
+// Below these sizes the work is not worth handing to the task scheduler
+static constexpr uint32_t ParallelWeatherPixels = 16384;
+static constexpr size_t WeatherRowsPerTask = 64;
+static constexpr int32_t ParallelFilterPixels = 65536;
+static constexpr size_t FilterRowsPerTask = 64;
+
 X8WeatherDrawer::X8WeatherDrawer()
 {
     _weatherPixels = new WeatherPixel[_weatherPixelsCapacity];
@@ -60,32 +67,30 @@ void X8WeatherDrawer::Draw(
     uint32_t pixelOffset = (_screenDPI->pitch + _screenDPI->width) * y + x;
     uint8_t patternYPos = patternStartYOffset % patternYSpace;
 
-    uint8_t* screenBits = _screenDPI->bits;
-
-    // Stores the colours of changed pixels
-    WeatherPixel* newPixels = &_weatherPixels[_weatherPixelsCount];
+    // Work out where the pixels of every row are stored first, so the rows can be drawn independently
+    _weatherRows.clear();
+    uint32_t weatherPixelsCount = _weatherPixelsCount;
     for (; height != 0; height--)
     {
         auto patternX = pattern[patternYPos * 2];
         if (patternX != 0xFF)
         {
-            if (_weatherPixelsCount < (_weatherPixelsCapacity - static_cast<uint32_t>(width)))
+            if (weatherPixelsCount < (_weatherPixelsCapacity - static_cast<uint32_t>(width)))
             {
                 uint32_t finalPixelOffset = width + pixelOffset;
 
                 uint32_t xPixelOffset = pixelOffset;
                 xPixelOffset += (static_cast<uint8_t>(patternX - patternStartXOffset)) % patternXSpace;
 
-                auto patternPixel = pattern[patternYPos * 2 + 1];
-                for (; xPixelOffset < finalPixelOffset; xPixelOffset += patternXSpace)
+                uint32_t numPixels = 0;
+                if (xPixelOffset < finalPixelOffset)
                 {
-                    uint8_t current_pixel = screenBits[xPixelOffset];
-                    screenBits[xPixelOffset] = patternPixel;
-                    _weatherPixelsCount++;
-
-                    // Store colour and position
-                    *newPixels++ = { xPixelOffset, current_pixel };
+                    numPixels = (finalPixelOffset - xPixelOffset + patternXSpace - 1) / patternXSpace;
                 }
+
+                auto patternPixel = pattern[patternYPos * 2 + 1];
+                _weatherRows.push_back({ xPixelOffset, numPixels, weatherPixelsCount, patternPixel });
+                weatherPixelsCount += numPixels;
             }
         }
 
@@ -93,6 +98,36 @@ void X8WeatherDrawer::Draw(
         patternYPos++;
         patternYPos %= patternYSpace;
     }
+
+    uint8_t* screenBits = _screenDPI->bits;
+    auto drawRow = [this, screenBits, patternXSpace](size_t i) {
+        const auto& row = _weatherRows[i];
+
+        // Stores the colours of changed pixels
+        WeatherPixel* newPixels = &_weatherPixels[row.FirstPixel];
+        uint32_t xPixelOffset = row.Position;
+        for (uint32_t j = 0; j < row.NumPixels; j++, xPixelOffset += patternXSpace)
+        {
+            uint8_t current_pixel = screenBits[xPixelOffset];
+            screenBits[xPixelOffset] = row.Colour;
+
+            // Store colour and position
+            *newPixels++ = { xPixelOffset, current_pixel };
+        }
+    };
+
+    if (gConfigGeneral.multithreading && weatherPixelsCount - _weatherPixelsCount >= ParallelWeatherPixels)
+    {
+        TaskScheduler::Get().ParallelFor(0, _weatherRows.size(), WeatherRowsPerTask, drawRow);
+    }
+    else
+    {
+        for (size_t i = 0; i < _weatherRows.size(); i++)
+        {
+            drawRow(i);
+        }
+    }
+    _weatherPixelsCount = weatherPixelsCount;
 }
 
 void X8WeatherDrawer::Restore()
@@ -101,16 +136,30 @@ void X8WeatherDrawer::Restore()
     {
         uint32_t numPixels = (_screenDPI->width + _screenDPI->pitch) * _screenDPI->height;
         uint8_t* bits = _screenDPI->bits;
-        for (uint32_t i = 0; i < _weatherPixelsCount; i++)
-        {
-            WeatherPixel weatherPixel = _weatherPixels[i];
-            if (weatherPixel.Position >= numPixels)
+        auto restoreRange = [this, numPixels, bits](size_t block) {
+            size_t end = std::min<size_t>((block + 1) * ParallelWeatherPixels, _weatherPixelsCount);
+            for (size_t i = block * ParallelWeatherPixels; i < end; i++)
             {
-                // Pixel out of bounds, bail
-                break;
+                WeatherPixel weatherPixel = _weatherPixels[i];
+                // Skip pixels that are out of bounds since the screen was resized
+                if (weatherPixel.Position < numPixels)
+                {
+                    bits[weatherPixel.Position] = weatherPixel.Colour;
+                }
             }
+        };
 
-            bits[weatherPixel.Position] = weatherPixel.Colour;
+        size_t numBlocks = (_weatherPixelsCount + ParallelWeatherPixels - 1) / ParallelWeatherPixels;
+        if (gConfigGeneral.multithreading)
+        {
+            TaskScheduler::Get().ParallelFor(0, numBlocks, 1, restoreRange);
+        }
+        else
+        {
+            for (size_t i = 0; i < numBlocks; i++)
+            {
+                restoreRange(i);
+            }
         }
         _weatherPixelsCount = 0;
     }
@@ -123,7 +172,6 @@ void X8WeatherDrawer::Restore()
 
 X8DrawingEngine::X8DrawingEngine([[maybe_unused]] const std::shared_ptr<Ui::IUiContext>& uiContext)
 {
-    _drawingContext = new X8DrawingContext(this);
     _bitsDPI.DrawingEngine = this;
 #ifdef __ENABLE_LIGHTFX__
     lightfx_set_available(true);
@@ -133,7 +181,6 @@ X8DrawingEngine::X8DrawingEngine([[maybe_unused]] const std::shared_ptr<Ui::IUiC
 
 X8DrawingEngine::~X8DrawingEngine()
 {
-    delete _drawingContext;
     delete[] _dirtyGrid.Blocks;
     delete[] _bits;
 }
@@ -272,8 +319,12 @@ std::string X8DrawingEngine::Screenshot()
 
 IDrawingContext* X8DrawingEngine::GetDrawingContext(rct_drawpixelinfo* dpi)
 {
-    _drawingContext->SetDPI(dpi);
-    return _drawingContext;
+    // Viewport columns can be drawn from several threads, each of them gets a context of its own so they don't overwrite
+    // each other's DPI.
+    thread_local X8DrawingContext drawingContext(nullptr);
+    drawingContext = X8DrawingContext(this);
+    drawingContext.SetDPI(dpi);
+    return &drawingContext;
 }
 
 rct_drawpixelinfo* X8DrawingEngine::GetDrawingPixelInfo()
@@ -283,7 +334,7 @@ rct_drawpixelinfo* X8DrawingEngine::GetDrawingPixelInfo()
 
 DRAWING_ENGINE_FLAGS X8DrawingEngine::GetFlags()
 {
-    return DEF_DIRTY_OPTIMISATIONS;
+    return static_cast<DRAWING_ENGINE_FLAGS>(DEF_DIRTY_OPTIMISATIONS | DEF_PARALLEL_DRAWING);
 }
 
 void X8DrawingEngine::InvalidateImage([[maybe_unused]] uint32_t image)
@@ -291,6 +342,12 @@ void X8DrawingEngine::InvalidateImage([[maybe_unused]] uint32_t image)
     // Not applicable for this engine
 }
 
+uint32_t X8DrawingEngine::GetDrawCallCount() const
+{
+    // Not applicable for this engine
+    return 0;
+}
+
 rct_drawpixelinfo* X8DrawingEngine::GetDPI()
 {
     return &_bitsDPI;
@@ -709,14 +766,26 @@ void X8DrawingContext::FilterRect(FilterPaletteID palette, int32_t left, int32_t
 
         // Fill the rectangle with the colours from the colour table
         auto c = height / dpi->zoom_level;
-        for (int32_t i = 0; i < c; i++)
-        {
+        auto filterRow = [dst, step, scaled_width, &paletteMap](size_t i) {
             uint8_t* nextdst = dst + step * i;
             for (int32_t j = 0; j < scaled_width; j++)
             {
                 auto index = *(nextdst + j);
                 *(nextdst + j) = (*paletteMap)[index];
             }
+        };
+
+        // Weather gloom and transparent windows filter large parts of the screen, split those into bands of rows
+        if (gConfigGeneral.multithreading && c * scaled_width >= ParallelFilterPixels)
+        {
+            TaskScheduler::Get().ParallelFor(0, c, FilterRowsPerTask, filterRow);
+        }
+        else
+        {
+            for (int32_t i = 0; i < c; i++)
+            {
+                filterRow(i);
+            }
         }
     }
 }
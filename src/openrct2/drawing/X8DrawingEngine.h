@@ -13,6 +13,8 @@
 #include "IDrawingContext.h"
 #include "IDrawingEngine.h"
 
+#include <vector>
+
 namespace OpenRCT2
 {
     namespace Ui
@@ -44,11 +46,20 @@ namespace OpenRCT2
                 uint8_t Colour;
             };
 
+            struct WeatherRow
+            {
+                uint32_t Position;
+                uint32_t NumPixels;
+                uint32_t FirstPixel;
+                uint8_t Colour;
+            };
+
             static constexpr uint32_t MaxWeatherPixels = 0xFFFE;
 
             size_t _weatherPixelsCapacity = MaxWeatherPixels;
             uint32_t _weatherPixelsCount = 0;
             WeatherPixel* _weatherPixels = nullptr;
+            std::vector<WeatherRow> _weatherRows;
             rct_drawpixelinfo* _screenDPI = nullptr;
 
         public:
@@ -83,7 +94,6 @@ namespace OpenRCT2
 #endif
 
             X8WeatherDrawer _weatherDrawer;
-            X8DrawingContext* _drawingContext;
 
         public:
             explicit X8DrawingEngine(const std::shared_ptr<Ui::IUiContext>& uiContext);
@@ -113,6 +123,7 @@ namespace OpenRCT2
             rct_drawpixelinfo* GetDrawingPixelInfo() override;
             DRAWING_ENGINE_FLAGS GetFlags() override;
             void InvalidateImage(uint32_t image) override;
+            uint32_t GetDrawCallCount() const override;
 
             rct_drawpixelinfo* GetDPI();
 
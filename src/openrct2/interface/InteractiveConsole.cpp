@@ -12,6 +12,7 @@
 #include "../Context.h"
 #include "../EditorObjectSelectionSession.h"
 #include "../Game.h"
+#include "../MemoryReport.h"
 #include "../OpenRCT2.h"
 #include "../PlatformEnvironment.h"
 #include "../ReplayManager.h"
@@ -25,6 +26,7 @@
 #include "../core/Console.hpp"
 #include "../core/Guard.hpp"
 #include "../core/Path.hpp"
+#include "../core/Profiling.h"
 #include "../core/String.hpp"
 #include "../drawing/Drawing.h"
 #include "../drawing/Font.h"
@@ -40,11 +42,13 @@
 #include "../object/ObjectList.h"
 #include "../object/ObjectManager.h"
 #include "../object/ObjectRepository.h"
+#include "../peep/GuestPathfinding.h"
 #include "../peep/Staff.h"
 #include "../platform/platform.h"
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
 #include "../ride/Vehicle.h"
+#include "../scripting/ScriptEngine.h"
 #include "../util/Util.h"
 #include "../windows/Intent.h"
 #include "../world/Climate.h"
@@ -55,6 +59,7 @@
 #include "Viewport.h"
 
 #include <algorithm>
+#include <cinttypes>
 #include <cmath>
 #include <cstdarg>
 #include <cstdlib>
@@ -1192,6 +1197,10 @@ static int32_t cc_open(InteractiveConsole& console, const arguments_t& argv)
         {
             context_open_window(WC_OPTIONS);
         }
+        else if (argv[0] == "profiler")
+        {
+            context_open_window(WC_PROFILER);
+        }
         else if (argv[0] == "themes")
         {
             context_open_window(WC_THEMES);
@@ -1510,10 +1519,15 @@ static int32_t cc_replay_start(InteractiveConsole& console, const arguments_t& a
                              "  Date Recorded: %s\n"
                              "  Ticks: %u\n"
                              "  Commands: %u\n"
-                             "  Checksums: %u";
+                             "  Checksums: %u\n"
+                             "  Keyframes: %u";
 
-        console.WriteFormatLine(logFmt, info.FilePath.c_str(), recordingDate, info.Ticks, info.NumCommands, info.NumChecksums);
-        Console::WriteLine(logFmt, info.FilePath.c_str(), recordingDate, info.Ticks, info.NumCommands, info.NumChecksums);
+        console.WriteFormatLine(
+            logFmt, info.FilePath.c_str(), recordingDate, info.Ticks, info.NumCommands, info.NumChecksums,
+            info.NumKeyframes);
+        Console::WriteLine(
+            logFmt, info.FilePath.c_str(), recordingDate, info.Ticks, info.NumCommands, info.NumChecksums,
+            info.NumKeyframes);
 
         return 1;
     }
@@ -1539,6 +1553,38 @@ static int32_t cc_replay_stop(InteractiveConsole& console, const arguments_t& ar
     return 0;
 }
 
+static int32_t cc_replay_seek(InteractiveConsole& console, const arguments_t& argv)
+{
+    if (network_get_mode() != NETWORK_MODE_NONE)
+    {
+        console.WriteFormatLine("This command is currently not supported in multiplayer mode.");
+        return 0;
+    }
+
+    if (argv.size() < 1)
+    {
+        console.WriteFormatLine("Parameters required <ticks>");
+        return 0;
+    }
+
+    auto* replayManager = OpenRCT2::GetContext()->GetReplayManager();
+    OpenRCT2::ReplayRecordInfo info;
+    if (!replayManager->IsReplaying() || !replayManager->GetCurrentReplayInfo(info))
+    {
+        console.WriteFormatLine("Replay currently not playing");
+        return 0;
+    }
+
+    auto ticks = static_cast<uint32_t>(atol(argv[0].c_str()));
+    if (replayManager->SeekPlayback(ticks))
+    {
+        console.WriteFormatLine("Replay at tick %u of %u", std::min(ticks, info.Ticks), info.Ticks);
+        return 1;
+    }
+
+    return 0;
+}
+
 static int32_t cc_replay_normalise(InteractiveConsole& console, const arguments_t& argv)
 {
     if (network_get_mode() != NETWORK_MODE_NONE)
@@ -1574,6 +1620,117 @@ static int32_t cc_replay_normalise(InteractiveConsole& console, const arguments_
     return 0;
 }
 
+static int32_t cc_pathfind_stats(InteractiveConsole& console, const arguments_t& argv)
+{
+    if (!argv.empty() && argv[0] == "reset")
+    {
+        peep_pathfind_reset_stats();
+        console.WriteLine("Pathfinding counters reset.");
+        return 0;
+    }
+
+    auto stats = peep_pathfind_get_stats();
+    auto perCall = [&stats](uint64_t value) {
+        return stats.Calls == 0 ? 0.0 : static_cast<double>(value) / static_cast<double>(stats.Calls);
+    };
+    console.WriteFormatLine("Calls:              %" PRIu64, stats.Calls);
+    console.WriteFormatLine("Searches:           %" PRIu64 " (%" PRIu64 " cached)", stats.Searches, stats.CachedSearches);
+    console.WriteFormatLine("Tiles checked:      %" PRIu64 " (%.1f per call)", stats.TilesChecked, perCall(stats.TilesChecked));
+    console.WriteFormatLine(
+        "Junctions visited:  %" PRIu64 " (%.1f per call)", stats.JunctionsVisited, perCall(stats.JunctionsVisited));
+    console.WriteFormatLine("Max search depth:   %" PRIu32, stats.MaxDepth);
+    console.WriteFormatLine("Tile limit hit:     %" PRIu64 " calls", stats.TileLimitCalls);
+    console.WriteFormatLine("Junction limit hit: %" PRIu64 " calls", stats.JunctionLimitCalls);
+    console.WriteFormatLine("No direction found: %" PRIu64 " calls", stats.FailedCalls);
+    console.WriteFormatLine(
+        "Time:               %.2f ms (%.3f us per call, max %.3f us)", stats.TotalTime / 1000000.0,
+        perCall(stats.TotalTime) / 1000.0, stats.MaxTime / 1000.0);
+    return 0;
+}
+
+static int32_t cc_plugin_stats(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+#ifdef ENABLE_SCRIPTING
+    auto& scriptEngine = GetContext()->GetScriptEngine();
+    if (!argv.empty() && argv[0] == "reset")
+    {
+        scriptEngine.ResetPerformanceStats();
+        console.WriteLine("Plugin performance counters reset.");
+        return 0;
+    }
+
+    auto stats = scriptEngine.GetPerformanceStats();
+    if (stats.empty())
+    {
+        console.WriteLine("No plugin calls recorded.");
+        return 0;
+    }
+
+    console.WriteFormatLine("%-24s %-24s %10s %12s %10s %8s", "Plugin", "Category", "Calls", "Total ms", "Max ms", "Budget");
+    for (const auto& counter : stats)
+    {
+        auto totalMs = std::chrono::duration<double, std::milli>(counter.TotalTime).count();
+        auto maxMs = std::chrono::duration<double, std::milli>(counter.MaxTime).count();
+        console.WriteFormatLine(
+            "%-24s %-24s %10" PRIu64 " %12.2f %10.2f %8" PRIu64, counter.Plugin.c_str(), counter.Category.c_str(),
+            counter.Calls, totalMs, maxMs, counter.OverBudgetCalls);
+    }
+#else
+    console.WriteLineError("Plugins are not supported in this build.");
+#endif
+    return 0;
+}
+
+static int32_t cc_profiler(InteractiveConsole& console, const arguments_t& argv)
+{
+    if (!argv.empty() && (argv[0] == "enable" || argv[0] == "disable"))
+    {
+        OpenRCT2::Profiling::SetEnabled(argv[0] == "enable");
+        console.WriteFormatLine("Profiler %s.", OpenRCT2::Profiling::IsEnabled() ? "enabled" : "disabled");
+        return 0;
+    }
+    if (!argv.empty() && argv[0] == "export")
+    {
+        if (argv.size() < 2)
+        {
+            console.WriteLineError("Usage: profiler export <file>");
+            return 1;
+        }
+        if (!OpenRCT2::Profiling::ExportChromeTrace(argv[1]))
+        {
+            console.WriteLineError("Unable to write the trace.");
+            return 1;
+        }
+        console.WriteFormatLine("Trace written to %s, open it with chrome://tracing or Perfetto.", argv[1].c_str());
+        return 0;
+    }
+
+    auto stats = OpenRCT2::Profiling::GetZoneStatistics(std::chrono::seconds(5));
+    if (stats.empty())
+    {
+        console.WriteLine("No zones recorded.");
+        return 0;
+    }
+
+    console.WriteFormatLine("%-32s %8s %10s %10s %10s %10s", "Zone", "Calls", "p50 ms", "p95 ms", "p99 ms", "Max ms");
+    for (const auto& zone : stats)
+    {
+        console.WriteFormatLine(
+            "%-32s %8zu %10.3f %10.3f %10.3f %10.3f", zone.Name.c_str(), zone.Count, zone.P50Ms, zone.P95Ms, zone.P99Ms,
+            zone.MaxMs);
+    }
+    return 0;
+}
+
+static int32_t cc_memory_report(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    for (const auto& line : FormatMemoryReport(GetMemoryReport()))
+    {
+        console.WriteLine(line);
+    }
+    return 0;
+}
+
 static int32_t cc_mp_desync(InteractiveConsole& console, const arguments_t& argv)
 {
     int32_t desyncType = 0;
@@ -1763,6 +1920,7 @@ static constexpr const utf8* console_window_table[] = {
     "scenario_options",
     "objective_options",
     "options",
+    "profiler",
     "themes",
     "title_sequences"
 };
@@ -1785,8 +1943,12 @@ static constexpr const console_command console_command_table[] = {
                                     "This is a safer method opposed to \"open object_selection\".",
                                     "load_object <objectfilenodat>" },
     { "load_park", cc_load_park, "Load park from save directory or by absolute path", "load_park <filename>" },
+    { "memory_report", cc_memory_report, "Shows the memory held by tile elements, entities, objects, textures, snapshots and plugins.", "memory_report" },
     { "object_count", cc_object_count, "Shows the number of objects of each type in the scenario.", "object_count" },
     { "open", cc_open, "Opens the window with the give name.", "open <window>." },
+    { "pathfind_stats", cc_pathfind_stats, "Shows the work done by guest and staff pathfinding since the last reset.", "pathfind_stats [reset]" },
+    { "plugin_stats", cc_plugin_stats, "Shows the time spent in each plugin, most expensive first.", "plugin_stats [reset]" },
+    { "profiler", cc_profiler, "Shows the time spent in each profiler zone over the last 5 seconds, or exports all recorded zones as a trace.", "profiler [enable|disable|export <file>]" },
     { "quit", cc_close, "Closes the console.", "quit" },
     { "remove_park_fences", cc_remove_park_fences, "Removes all park fences from the surface", "remove_park_fences" },
     { "remove_unused_objects", cc_remove_unused_objects, "Removes all the unused objects from the object selection.", "remove_unused_objects" },
@@ -1804,6 +1966,7 @@ static constexpr const console_command console_command_table[] = {
     { "replay_stoprecord", cc_replay_stoprecord, "Stops recording a new replay.", "replay_stoprecord"},
     { "replay_start", cc_replay_start, "Starts a replay", "replay_start <name>"},
     { "replay_stop", cc_replay_stop, "Stops the replay", "replay_stop"},
+    { "replay_seek", cc_replay_seek, "Moves the replay to a tick from its start", "replay_seek <ticks>"},
     { "replay_normalise", cc_replay_normalise, "Normalises the replay to remove all gaps", "replay_normalise <input file> <output file>"},
     { "mp_desync", cc_mp_desync, "Forces a multiplayer desync", "cc_mp_desync [desync_type, 0 = Random t-shirt color on random guest, 1 = Remove random guest ]"},
 
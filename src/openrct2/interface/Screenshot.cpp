@@ -29,12 +29,19 @@
 #include "../world/Surface.h"
 #include "Viewport.h"
 
+#include <algorithm>
 #include <cctype>
 #include <chrono>
+#include <condition_variable>
 #include <cstdlib>
+#include <deque>
+#include <iostream>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <thread>
+#include <vector>
 
 using namespace std::literals::string_literals;
 using namespace OpenRCT2;
@@ -42,6 +49,13 @@ using namespace OpenRCT2::Drawing;
 
 uint8_t gScreenshotCountdown = 0;
 
+static PngWriteOptions GetScreenshotWriteOptions()
+{
+    PngWriteOptions options;
+    options.CompressionLevel = gConfigGeneral.screenshot_compression_level;
+    return options;
+}
+
 static bool WriteDpiToFile(std::string_view path, const rct_drawpixelinfo* dpi, const GamePalette& palette)
 {
     auto const pixels8 = dpi->bits;
@@ -55,7 +69,7 @@ static bool WriteDpiToFile(std::string_view path, const rct_drawpixelinfo* dpi,
         image.Stride = dpi->width + dpi->pitch;
         image.Palette = std::make_unique<GamePalette>(palette);
         image.Pixels = std::vector<uint8_t>(pixels8, pixels8 + pixelsLen);
-        Imaging::WriteToFile(path, image, IMAGE_FORMAT::PNG);
+        Imaging::WriteToFile(path, image, IMAGE_FORMAT::PNG, GetScreenshotWriteOptions());
         return true;
     }
     catch (const std::exception& e)
@@ -196,7 +210,7 @@ std::string screenshot_dump_png_32bpp(int32_t width, int32_t height, const void*
         image.Depth = 32;
         image.Stride = width * 4;
         image.Pixels = std::vector<uint8_t>(pixels8, pixels8 + pixelsLen);
-        Imaging::WriteToFile(path->c_str(), image, IMAGE_FORMAT::PNG_32);
+        Imaging::WriteToFile(path->c_str(), image, IMAGE_FORMAT::PNG_32, GetScreenshotWriteOptions());
         return *path;
     }
     catch (const std::exception& e)
@@ -335,7 +349,7 @@ static void ReleaseDPI(rct_drawpixelinfo& dpi)
     dpi.height = 0;
 }
 
-static rct_viewport GetGiantViewport(int32_t mapSize, int32_t rotation, ZoomLevel zoom)
+rct_viewport GetGiantViewport(int32_t mapSize, int32_t rotation, ZoomLevel zoom)
 {
     // Get the tile coordinates of each corner
     auto leftTileCoords = GetEdgeTile(mapSize, rotation, EdgeType::LEFT, false);
@@ -363,7 +377,9 @@ static rct_viewport GetGiantViewport(int32_t mapSize, int32_t rotation, ZoomLeve
     return viewport;
 }
 
-static void RenderViewport(IDrawingEngine* drawingEngine, const rct_viewport& viewport, rct_drawpixelinfo& dpi)
+static void RenderViewport(
+    IDrawingEngine* drawingEngine, const rct_viewport& viewport, rct_drawpixelinfo& dpi,
+    PaintStageTimings* timings = nullptr)
 {
     // Ensure sprites appear regardless of rotation
     reset_all_sprite_quadrant_placements();
@@ -375,12 +391,59 @@ static void RenderViewport(IDrawingEngine* drawingEngine, const rct_viewport& vi
         drawingEngine = tempDrawingEngine.get();
     }
     dpi.DrawingEngine = drawingEngine;
-    viewport_render(&dpi, &viewport, 0, 0, viewport.width, viewport.height);
+    viewport_render(&dpi, &viewport, 0, 0, viewport.width, viewport.height, nullptr, timings);
+}
+
+/**
+ * Renders the viewport in strips of at most ScreenshotStripHeight rows which are written to the PNG as they are done,
+ * so the memory needed for huge images is bounded by the strip size rather than by the whole image.
+ */
+static bool RenderViewportToFile(std::string_view path, const rct_viewport& viewport, const GamePalette& palette)
+{
+    constexpr int16_t ScreenshotStripHeight = 1024;
+
+    auto stripViewport = viewport;
+    stripViewport.height = std::min(viewport.height, ScreenshotStripHeight);
+    stripViewport.view_height = stripViewport.height * viewport.zoom;
+
+    auto dpi = CreateDPI(stripViewport);
+    try
+    {
+        X8DrawingEngine drawingEngine(GetContext()->GetUiContext());
+
+        Image image;
+        image.Width = viewport.width;
+        image.Height = viewport.height;
+        image.Depth = 8;
+        image.Stride = viewport.width;
+        image.Palette = std::make_unique<GamePalette>(palette);
+        Imaging::WriteStripsToFile(
+            path, image, stripViewport.height, [&](uint32_t top, uint32_t count) -> const uint8_t* {
+                stripViewport.viewPos.y = viewport.viewPos.y + static_cast<int32_t>(top) * viewport.zoom;
+                stripViewport.height = static_cast<int16_t>(count);
+                stripViewport.view_height = stripViewport.height * viewport.zoom;
+
+                // The buffer still holds the previous strip
+                dpi.height = stripViewport.height;
+                std::memset(dpi.bits, PALETTE_INDEX_0, static_cast<size_t>(dpi.width) * dpi.height);
+
+                RenderViewport(&drawingEngine, stripViewport, dpi);
+                return dpi.bits;
+            },
+            GetScreenshotWriteOptions());
+        ReleaseDPI(dpi);
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        log_error("Unable to write png: %s", e.what());
+        ReleaseDPI(dpi);
+        return false;
+    }
 }
 
 void screenshot_giant()
 {
-    rct_drawpixelinfo dpi{};
     try
     {
         auto path = screenshot_get_next_path();
@@ -409,10 +472,10 @@ void screenshot_giant()
             viewport.flags |= VIEWPORT_FLAG_TRANSPARENT_BACKGROUND;
         }
 
-        dpi = CreateDPI(viewport);
-
-        RenderViewport(nullptr, viewport, dpi);
-        WriteDpiToFile(path->c_str(), &dpi, gPalette);
+        if (!RenderViewportToFile(path->c_str(), viewport, gPalette))
+        {
+            throw std::runtime_error("Giant screenshot failed, unable to write the image.");
+        }
 
         // Show user that screenshot saved successfully
         Formatter ft;
@@ -425,8 +488,6 @@ void screenshot_giant()
         log_error("%s", e.what());
         context_show_error(STR_SCREENSHOT_FAILED, STR_NONE, {});
     }
-
-    ReleaseDPI(dpi);
 }
 
 // TODO: Move this at some point into a more appropriate place.
@@ -448,9 +509,10 @@ static void benchgfx_render_screenshots(const char* inputPath, std::unique_ptr<I
     gIntroState = IntroState::None;
     gScreenFlags = SCREEN_FLAGS_PLAYING;
 
-    // Create Viewport and DPI for every rotation and zoom.
+    // Create Viewport and DPI for every rotation and zoom, fully zoomed out included as that is where the most paint
+    // entries per pixel are generated.
     constexpr int32_t MAX_ROTATIONS = 4;
-    constexpr int32_t MAX_ZOOM_LEVEL = 3;
+    constexpr int32_t MAX_ZOOM_LEVEL = 4; // Up to and including ZoomLevel::max()
     std::array<rct_drawpixelinfo, MAX_ROTATIONS * MAX_ZOOM_LEVEL> dpis;
     std::array<rct_viewport, MAX_ROTATIONS * MAX_ZOOM_LEVEL> viewports;
 
@@ -458,8 +520,8 @@ static void benchgfx_render_screenshots(const char* inputPath, std::unique_ptr<I
     {
         for (int32_t rotation = 0; rotation < MAX_ROTATIONS; rotation++)
         {
-            auto& viewport = viewports[zoom * MAX_ZOOM_LEVEL + rotation];
-            auto& dpi = dpis[zoom * MAX_ZOOM_LEVEL + rotation];
+            auto& viewport = viewports[zoom * MAX_ROTATIONS + rotation];
+            auto& dpi = dpis[zoom * MAX_ROTATIONS + rotation];
             viewport = GetGiantViewport(gMapSize, rotation, zoom);
             dpi = CreateDPI(viewport);
         }
@@ -473,10 +535,14 @@ static void benchgfx_render_screenshots(const char* inputPath, std::unique_ptr<I
 
         std::array<double, MAX_ZOOM_LEVEL> zoomAverages;
 
+        // Taking the stage timings paints all columns on this thread.
+        std::array<PaintStageTimings, MAX_ZOOM_LEVEL> zoomTimings;
+
         // Render at every zoom.
         for (int32_t zoom = 0; zoom < MAX_ZOOM_LEVEL; zoom++)
         {
             double zoomLevelTime = 0.0;
+            auto& timings = zoomTimings[zoom];
 
             // Render at every rotation.
             for (int32_t rotation = 0; rotation < MAX_ROTATIONS; rotation++)
@@ -484,9 +550,10 @@ static void benchgfx_render_screenshots(const char* inputPath, std::unique_ptr<I
                 // N iterations.
                 for (uint32_t i = 0; i < iterationCount; i++)
                 {
-                    auto& dpi = dpis[zoom * MAX_ZOOM_LEVEL + rotation];
-                    auto& viewport = viewports[zoom * MAX_ZOOM_LEVEL + rotation];
-                    double elapsed = MeasureFunctionTime([&viewport, &dpi]() { RenderViewport(nullptr, viewport, dpi); });
+                    auto& dpi = dpis[zoom * MAX_ROTATIONS + rotation];
+                    auto& viewport = viewports[zoom * MAX_ROTATIONS + rotation];
+                    double elapsed = MeasureFunctionTime(
+                        [&viewport, &dpi, &timings]() { RenderViewport(nullptr, viewport, dpi, &timings); });
                     totalTime += elapsed;
                     zoomLevelTime += elapsed;
                 }
@@ -507,6 +574,18 @@ static void benchgfx_render_screenshots(const char* inputPath, std::unique_ptr<I
         }
         std::printf("Total average: %.06fs, %.f FPS\n", average, 1.0 / average);
         std::printf("Time: %.05fs\n", totalTime);
+
+        // Per render, the arrange and draw stages are what level of detail and culling work has to bring down.
+        const auto renderCount = static_cast<double>(MAX_ROTATIONS * iterationCount);
+        std::printf("\n%-7s %14s %14s %14s %14s\n", "Zoom", "Paint entries", "Generate (ms)", "Arrange (ms)", "Draw (ms)");
+        for (int32_t zoom = 0; zoom < MAX_ZOOM_LEVEL; zoom++)
+        {
+            const auto& timings = zoomTimings[zoom];
+            std::printf(
+                "%-7d %14.0f %14.3f %14.3f %14.3f\n", zoom, static_cast<double>(timings.PaintEntries) / renderCount,
+                timings.Generate.count() * 1000.0 / renderCount, timings.Arrange.count() * 1000.0 / renderCount,
+                timings.Draw.count() * 1000.0 / renderCount);
+        }
     }
     catch (const std::exception& e)
     {
@@ -597,6 +676,201 @@ static void ApplyOptions(const ScreenshotOptions* options, rct_viewport& viewpor
     }
 }
 
+static bool IsValidScreenshotJob(const char* const* argv, int32_t argc)
+{
+    bool giantScreenshot = (argc == 5) && _stricmp(argv[2], "giant") == 0;
+    return argc == 4 || argc == 8 || giantScreenshot;
+}
+
+/**
+ * Returns the viewport for the arguments after <file> <output_image> of a screenshot and sets the rotation to render
+ * it at. The park has to be loaded already.
+ */
+static rct_viewport GetScreenshotViewport(const char* const* argv, int32_t argc)
+{
+    rct_viewport viewport{};
+    if (argc == 5 && _stricmp(argv[2], "giant") == 0)
+    {
+        auto zoom = std::atoi(argv[3]);
+        auto rotation = std::atoi(argv[4]) & 3;
+        viewport = GetGiantViewport(gMapSize, rotation, zoom);
+        gCurrentRotation = rotation;
+        return viewport;
+    }
+
+    bool customLocation = false;
+    bool centreMapX = false;
+    bool centreMapY = false;
+    int32_t resolutionWidth = std::atoi(argv[2]);
+    int32_t resolutionHeight = std::atoi(argv[3]);
+    int32_t customX = 0;
+    int32_t customY = 0;
+    int32_t customZoom = 0;
+    int32_t customRotation = 0;
+    if (argc == 8)
+    {
+        customLocation = true;
+        if (argv[4][0] == 'c')
+            centreMapX = true;
+        else
+            customX = std::atoi(argv[4]);
+
+        if (argv[5][0] == 'c')
+            centreMapY = true;
+        else
+            customY = std::atoi(argv[5]);
+
+        customZoom = std::atoi(argv[6]);
+        customRotation = std::atoi(argv[7]) & 3;
+    }
+
+    int32_t mapSize = gMapSize;
+    if (resolutionWidth == 0 || resolutionHeight == 0)
+    {
+        resolutionWidth = (mapSize * 32 * 2) >> customZoom;
+        resolutionHeight = (mapSize * 32 * 1) >> customZoom;
+
+        resolutionWidth += 8;
+        resolutionHeight += 128;
+    }
+
+    viewport.width = resolutionWidth;
+    viewport.height = resolutionHeight;
+    viewport.view_width = viewport.width;
+    viewport.view_height = viewport.height;
+    if (customLocation)
+    {
+        if (centreMapX)
+            customX = (mapSize / 2) * 32 + 16;
+        if (centreMapY)
+            customY = (mapSize / 2) * 32 + 16;
+
+        int32_t z = tile_element_height({ customX, customY });
+        CoordsXYZ coords3d = { customX, customY, z };
+
+        auto coords2d = translate_3d_to_2d_with_z(customRotation, coords3d);
+
+        viewport.viewPos = { coords2d.x - ((viewport.view_width << customZoom) / 2),
+                             coords2d.y - ((viewport.view_height << customZoom) / 2) };
+        viewport.zoom = customZoom;
+        gCurrentRotation = customRotation;
+    }
+    else
+    {
+        viewport.viewPos = { gSavedView - ScreenCoordsXY{ (viewport.view_width / 2), (viewport.view_height / 2) } };
+        viewport.zoom = gSavedViewZoom;
+        gCurrentRotation = gSavedViewRotation;
+    }
+    return viewport;
+}
+
+static void LoadScreenshotPark(IContext& context, const char* path)
+{
+    if (!context.LoadParkFromFile(path))
+    {
+        throw std::runtime_error("Failed to load park.");
+    }
+
+    gIntroState = IntroState::None;
+    gScreenFlags = SCREEN_FLAGS_PLAYING;
+}
+
+/**
+ * Splits a job of a screenshot batch into its arguments, arguments containing spaces can be put in double quotes.
+ */
+static std::vector<std::string> SplitScreenshotJob(const std::string& line)
+{
+    std::vector<std::string> args;
+    std::string arg;
+    bool hasArg = false;
+    bool inQuotes = false;
+    for (auto c : line)
+    {
+        if (c == '"')
+        {
+            inQuotes = !inQuotes;
+            hasArg = true;
+        }
+        else if (!inQuotes && std::isspace(static_cast<unsigned char>(c)))
+        {
+            if (hasArg)
+            {
+                args.push_back(std::move(arg));
+                arg.clear();
+                hasArg = false;
+            }
+        }
+        else
+        {
+            arg.push_back(c);
+            hasArg = true;
+        }
+    }
+    if (hasArg)
+    {
+        args.push_back(std::move(arg));
+    }
+    return args;
+}
+
+/**
+ * Renders the screenshot jobs read from the standard input until it is closed, one job per line with the same
+ * arguments as a single screenshot. The context, the object repository and the loaded objects are kept between jobs,
+ * and the park is only loaded again when the job is for another file or the file has changed. Every job is answered
+ * with a line, "OK <output_image>" once the image is written or "ERROR <reason>".
+ */
+static void RunScreenshotBatch(IContext& context, const ScreenshotOptions* options)
+{
+    std::string loadedPath;
+    fs::file_time_type loadedWriteTime{};
+
+    std::string line;
+    while (std::getline(std::cin, line))
+    {
+        auto args = SplitScreenshotJob(line);
+        if (args.empty())
+            continue;
+
+        std::vector<const char*> argv;
+        for (const auto& arg : args)
+        {
+            argv.push_back(arg.c_str());
+        }
+        auto argc = static_cast<int32_t>(argv.size());
+
+        try
+        {
+            if (!IsValidScreenshotJob(argv.data(), argc))
+            {
+                throw std::runtime_error("Invalid screenshot job.");
+            }
+
+            auto writeTime = fs::last_write_time(fs::u8path(args[0]));
+            if (args[0] != loadedPath || writeTime != loadedWriteTime)
+            {
+                loadedPath.clear();
+                LoadScreenshotPark(context, argv[0]);
+                loadedPath = args[0];
+                loadedWriteTime = writeTime;
+            }
+
+            auto viewport = GetScreenshotViewport(argv.data(), argc);
+            ApplyOptions(options, viewport);
+
+            if (!RenderViewportToFile(argv[1], viewport, gPalette))
+            {
+                throw std::runtime_error("Unable to write the screenshot.");
+            }
+            std::printf("OK %s\n", argv[1]);
+        }
+        catch (const std::exception& e)
+        {
+            std::printf("ERROR %s\n", e.what());
+        }
+        std::fflush(stdout);
+    }
+}
+
 int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOptions* options)
 {
     // Don't include options in the count (they have been handled by CommandLine::ParseOptions already)
@@ -610,25 +884,19 @@ int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOption
         }
     }
 
-    bool giantScreenshot = (argc == 5) && _stricmp(argv[2], "giant") == 0;
-    if (argc != 4 && argc != 8 && !giantScreenshot)
+    bool batch = (argc == 1) && _stricmp(argv[0], "batch") == 0;
+    if (!batch && !IsValidScreenshotJob(argv, argc))
     {
         std::printf("Usage: openrct2 screenshot <file> <output_image> <width> <height> [<x> <y> <zoom> <rotation>]\n");
         std::printf("Usage: openrct2 screenshot <file> <output_image> giant <zoom> <rotation>\n");
+        std::printf("Usage: openrct2 screenshot batch\n");
         return -1;
     }
 
     int32_t exitCode = 1;
-    rct_drawpixelinfo dpi;
     try
     {
         core_init();
-        bool customLocation = false;
-        bool centreMapX = false;
-        bool centreMapY = false;
-
-        const char* inputPath = argv[0];
-        const char* outputPath = argv[1];
 
         gOpenRCT2Headless = true;
         auto context = CreateContext();
@@ -639,99 +907,31 @@ int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOption
 
         drawing_engine_init();
 
-        if (!context->LoadParkFromFile(inputPath))
-        {
-            throw std::runtime_error("Failed to load park.");
-        }
-
-        gIntroState = IntroState::None;
-        gScreenFlags = SCREEN_FLAGS_PLAYING;
-
-        rct_viewport viewport{};
-        if (giantScreenshot)
+        if (batch)
         {
-            auto zoom = std::atoi(argv[3]);
-            auto rotation = std::atoi(argv[4]) & 3;
-            viewport = GetGiantViewport(gMapSize, rotation, zoom);
-            gCurrentRotation = rotation;
+            RunScreenshotBatch(*context, options);
         }
         else
         {
-            int32_t resolutionWidth = std::atoi(argv[2]);
-            int32_t resolutionHeight = std::atoi(argv[3]);
-            int32_t customX = 0;
-            int32_t customY = 0;
-            int32_t customZoom = 0;
-            int32_t customRotation = 0;
-            if (argc == 8)
-            {
-                customLocation = true;
-                if (argv[4][0] == 'c')
-                    centreMapX = true;
-                else
-                    customX = std::atoi(argv[4]);
-
-                if (argv[5][0] == 'c')
-                    centreMapY = true;
-                else
-                    customY = std::atoi(argv[5]);
-
-                customZoom = std::atoi(argv[6]);
-                customRotation = std::atoi(argv[7]) & 3;
-            }
+            const char* inputPath = argv[0];
+            const char* outputPath = argv[1];
 
-            int32_t mapSize = gMapSize;
-            if (resolutionWidth == 0 || resolutionHeight == 0)
-            {
-                resolutionWidth = (mapSize * 32 * 2) >> customZoom;
-                resolutionHeight = (mapSize * 32 * 1) >> customZoom;
+            LoadScreenshotPark(*context, inputPath);
 
-                resolutionWidth += 8;
-                resolutionHeight += 128;
-            }
+            auto viewport = GetScreenshotViewport(argv, argc);
+            ApplyOptions(options, viewport);
 
-            viewport.width = resolutionWidth;
-            viewport.height = resolutionHeight;
-            viewport.view_width = viewport.width;
-            viewport.view_height = viewport.height;
-            if (customLocation)
+            if (!RenderViewportToFile(outputPath, viewport, gPalette))
             {
-                if (centreMapX)
-                    customX = (mapSize / 2) * 32 + 16;
-                if (centreMapY)
-                    customY = (mapSize / 2) * 32 + 16;
-
-                int32_t z = tile_element_height({ customX, customY });
-                CoordsXYZ coords3d = { customX, customY, z };
-
-                auto coords2d = translate_3d_to_2d_with_z(customRotation, coords3d);
-
-                viewport.viewPos = { coords2d.x - ((viewport.view_width << customZoom) / 2),
-                                     coords2d.y - ((viewport.view_height << customZoom) / 2) };
-                viewport.zoom = customZoom;
-                gCurrentRotation = customRotation;
-            }
-            else
-            {
-                viewport.viewPos = { gSavedView - ScreenCoordsXY{ (viewport.view_width / 2), (viewport.view_height / 2) } };
-                viewport.zoom = gSavedViewZoom;
-                gCurrentRotation = gSavedViewRotation;
+                throw std::runtime_error("Unable to write the screenshot.");
             }
         }
-
-        ApplyOptions(options, viewport);
-
-        dpi = CreateDPI(viewport);
-
-        RenderViewport(nullptr, viewport, dpi);
-        WriteDpiToFile(outputPath, &dpi, gPalette);
     }
     catch (const std::exception& e)
     {
         std::printf("%s\n", e.what());
         exitCode = -1;
     }
-    ReleaseDPI(dpi);
 
     drawing_engine_dispose();
 
@@ -753,6 +953,138 @@ static bool IsPathChildOf(fs::path x, const fs::path& parent)
     return false;
 }
 
+/**
+ * Writes captured images on a background thread, so a capture only costs the game thread the rendering. The pixel
+ * buffers of written images are kept for the next captures, which for timelapses are all the same size.
+ */
+class CaptureImageWriter
+{
+private:
+    static constexpr size_t MaxPendingImages = 4;
+
+    struct PendingImage
+    {
+        std::string Path;
+        Image Data;
+        PngWriteOptions Options;
+    };
+
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    std::deque<PendingImage> _pending;
+    std::vector<std::vector<uint8_t>> _freeBuffers;
+    std::thread _thread;
+    bool _stopping{};
+
+public:
+    ~CaptureImageWriter()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stopping = true;
+        }
+        _condition.notify_all();
+        if (_thread.joinable())
+        {
+            _thread.join();
+        }
+    }
+
+    std::vector<uint8_t> GetBuffer(size_t size)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = std::find_if(_freeBuffers.begin(), _freeBuffers.end(), [size](const std::vector<uint8_t>& buffer) {
+            return buffer.size() == size;
+        });
+        if (it == _freeBuffers.end())
+        {
+            return std::vector<uint8_t>(size);
+        }
+        auto buffer = std::move(*it);
+        _freeBuffers.erase(it);
+        return buffer;
+    }
+
+    void Write(std::string path, Image image, const PngWriteOptions& options)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+
+        // Wait for the writer to catch up rather than holding on to an unbounded number of images
+        _condition.wait(lock, [this]() { return _pending.size() < MaxPendingImages; });
+        _pending.push_back({ std::move(path), std::move(image), options });
+        if (!_thread.joinable())
+        {
+            _thread = std::thread([this]() { Run(); });
+        }
+        lock.unlock();
+        _condition.notify_all();
+    }
+
+private:
+    void Run()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (true)
+        {
+            // Pending images are still written when stopping
+            _condition.wait(lock, [this]() { return _stopping || !_pending.empty(); });
+            if (_pending.empty())
+            {
+                return;
+            }
+
+            auto pending = std::move(_pending.front());
+            _pending.pop_front();
+            lock.unlock();
+            _condition.notify_all();
+
+            try
+            {
+                Imaging::WriteToFile(pending.Path, pending.Data, IMAGE_FORMAT::PNG, pending.Options);
+            }
+            catch (const std::exception& e)
+            {
+                log_error("Unable to write png: %s", e.what());
+            }
+
+            lock.lock();
+            if (_freeBuffers.size() >= MaxPendingImages)
+            {
+                _freeBuffers.erase(_freeBuffers.begin());
+            }
+            _freeBuffers.push_back(std::move(pending.Data.Pixels));
+        }
+    }
+};
+
+static CaptureImageWriter _captureImageWriter;
+
+/**
+ * Renders the viewport into one buffer and leaves the encoding to the capture writer.
+ */
+static void RenderViewportToFileAsync(std::string path, const rct_viewport& viewport, const GamePalette& palette)
+{
+    auto pixels = _captureImageWriter.GetBuffer(static_cast<size_t>(viewport.width) * viewport.height);
+
+    // The buffer may still hold a previous capture
+    std::fill(pixels.begin(), pixels.end(), PALETTE_INDEX_0);
+
+    rct_drawpixelinfo dpi;
+    dpi.width = viewport.width;
+    dpi.height = viewport.height;
+    dpi.bits = pixels.data();
+    RenderViewport(nullptr, viewport, dpi);
+
+    Image image;
+    image.Width = viewport.width;
+    image.Height = viewport.height;
+    image.Depth = 8;
+    image.Stride = viewport.width;
+    image.Palette = std::make_unique<GamePalette>(palette);
+    image.Pixels = std::move(pixels);
+    _captureImageWriter.Write(std::move(path), std::move(image), GetScreenshotWriteOptions());
+}
+
 static std::string ResolveFilenameForCapture(const fs::path& filename)
 {
     if (filename.empty())
@@ -819,11 +1151,19 @@ void CaptureImage(const CaptureOptions& options)
         viewport.flags |= VIEWPORT_FLAG_TRANSPARENT_BACKGROUND;
     }
 
+    // Views of a few screens are written in the background. Giant captures are written in strips to bound their memory,
+    // and automatic filenames are picked from the files that exist, so both are still written before returning.
+    constexpr int64_t MaxAsyncCapturePixels = 4096 * 4096;
     auto outputPath = ResolveFilenameForCapture(options.Filename);
-    auto dpi = CreateDPI(viewport);
-    RenderViewport(nullptr, viewport, dpi);
-    WriteDpiToFile(outputPath, &dpi, gPalette);
-    ReleaseDPI(dpi);
+    if (options.View && !options.Filename.empty()
+        && static_cast<int64_t>(viewport.width) * viewport.height <= MaxAsyncCapturePixels)
+    {
+        RenderViewportToFileAsync(std::move(outputPath), viewport, gPalette);
+    }
+    else
+    {
+        RenderViewportToFile(outputPath, viewport, gPalette);
+    }
 
     gCurrentRotation = backupRotation;
 }
@@ -19,6 +19,7 @@
 #include <string>
 
 struct rct_drawpixelinfo;
+struct rct_viewport;
 
 extern uint8_t gScreenshotCountdown;
 
@@ -62,3 +63,8 @@ int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOption
 int32_t cmdline_for_gfxbench(const char** argv, int32_t argc);
 
 void CaptureImage(const CaptureOptions& options);
+
+/**
+ * Returns a viewport showing the whole map at the given rotation and zoom.
+ */
+rct_viewport GetGiantViewport(int32_t mapSize, int32_t rotation, ZoomLevel zoom);
@@ -15,7 +15,8 @@
 #include "../OpenRCT2.h"
 #include "../config/Config.h"
 #include "../core/Guard.hpp"
-#include "../core/JobPool.h"
+#include "../core/Profiling.h"
+#include "../core/TaskScheduler.h"
 #include "../drawing/Drawing.h"
 #include "../drawing/IDrawingEngine.h"
 #include "../paint/Paint.h"
@@ -27,13 +28,16 @@
 #include "../ui/WindowManager.h"
 #include "../world/Climate.h"
 #include "../world/EntityList.h"
+#include "../world/EntityTweener.h"
 #include "../world/Map.h"
 #include "Colour.h"
 #include "Window.h"
 #include "Window_internal.h"
 
 #include <algorithm>
+#include <array>
 #include <cstring>
+#include <limits>
 #include <list>
 #include <unordered_map>
 
@@ -47,8 +51,63 @@ uint8_t gShowConstuctionRightsRefCount;
 static std::list<rct_viewport> _viewports;
 rct_viewport* g_music_tracking_viewport;
 
-static std::unique_ptr<JobPool> _paintJobs;
-static std::vector<paint_session*> _paintColumns;
+struct PaintColumn
+{
+    paint_session* Session;
+    int16_t X;
+    int16_t Width;
+    // Whether the session is kept for the next frames, and whether it already came from there.
+    bool Cacheable = false;
+    bool Cached = false;
+};
+
+/**
+ * An arranged paint session of a column that was painted before. It is drawn again as long as the column covers the
+ * same part of the same target and nothing inside it was invalidated.
+ */
+struct PaintColumnCacheEntry
+{
+    paint_session* Session;
+    uint32_t ViewFlags;
+    uint8_t Rotation;
+    uint32_t Tick;
+    uint32_t Generation;
+    uint32_t LastUsedFrame;
+};
+
+static constexpr int16_t PaintStripWidth = 32;
+static constexpr int16_t PaintMaxColumnWidth = PaintStripWidth * 16;
+static constexpr uint32_t PaintMinColumnCost = 256;
+static constexpr size_t PaintColumnsPerThread = 4;
+static constexpr size_t PaintColumnCacheSize = 128;
+
+static std::vector<PaintColumn> _paintColumns;
+
+// Number of paint entries of each 32 pixel wide strip the last time it was painted, indexed by the strip's x.
+static std::array<uint16_t, 2048> _paintStripCosts;
+
+static std::vector<PaintColumnCacheEntry> _paintColumnCache;
+static uint32_t _paintColumnCacheGeneration = 1;
+static uint32_t _paintColumnCacheFrame;
+
+/**
+ * The result of a recent hit test. Tools and tooltips ask for the same pixel several times per frame, often with
+ * different filters, so the results are kept until anything on screen is invalidated.
+ */
+struct InteractionCacheEntry
+{
+    uint32_t Generation = 0;
+    ScreenCoordsXY ViewLoc;
+    ZoomLevel Zoom;
+    uint32_t ViewFlags = 0;
+    uint8_t Rotation = 0;
+    uint16_t Filter = 0;
+    InteractionInfo Info;
+};
+
+static std::array<InteractionCacheEntry, 4> _interactionCache;
+static size_t _interactionCacheNext;
+static uint32_t _interactionCacheGeneration = 1;
 
 ScreenCoordsXY gSavedView;
 ZoomLevel gSavedViewZoom;
@@ -57,7 +116,6 @@ uint8_t gSavedViewRotation;
 paint_entry* gNextFreePaintStruct;
 uint8_t gCurrentRotation;
 
-static uint32_t _currentImageType;
 InteractionInfo::InteractionInfo(const paint_struct* ps)
     : Loc(ps->map_x, ps->map_y)
     , Element(ps->tileElement)
@@ -217,6 +275,27 @@ void viewports_invalidate(int32_t left, int32_t top, int32_t right, int32_t bott
     }
 }
 
+/**
+ * Returns whether invalidating the given area would affect any viewport that is not covered by other windows.
+ */
+bool viewports_overlap(int32_t left, int32_t top, int32_t right, int32_t bottom, int32_t maxZoom)
+{
+    for (const auto& vp : _viewports)
+    {
+        if (maxZoom != -1 && vp.zoom > maxZoom)
+            continue;
+        if (vp.visibility == VisibilityCache::Covered)
+            continue;
+
+        if (right > vp.viewPos.x && bottom > vp.viewPos.y && left < vp.viewPos.x + vp.view_width
+            && top < vp.viewPos.y + vp.view_height)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 /**
  *
  *  rct2: 0x00689174
@@ -647,12 +726,14 @@ void viewport_update_sprite_follow(rct_window* window)
         {
             return;
         }
-        int32_t height = (tile_element_height({ sprite->x, sprite->y })) - 16;
-        int32_t underground = sprite->z < height;
+        // Follow the entity where it is drawn, so the view moves as smoothly as the entity
+        const auto spritePos = EntityTweener::Get().GetRenderState(*sprite).Position;
+        int32_t height = (tile_element_height(spritePos)) - 16;
+        int32_t underground = spritePos.z < height;
 
         viewport_set_underground_flag(underground, window, window->viewport);
 
-        auto centreLoc = centre_2d_coordinates({ sprite->x, sprite->y, sprite->z }, window->viewport);
+        auto centreLoc = centre_2d_coordinates(spritePos, window->viewport);
         if (centreLoc)
         {
             window->savedViewPos = *centreLoc;
@@ -806,7 +887,7 @@ void viewport_update_smart_vehicle_follow(rct_window* window)
  */
 void viewport_render(
     rct_drawpixelinfo* dpi, const rct_viewport* viewport, int32_t left, int32_t top, int32_t right, int32_t bottom,
-    std::vector<RecordedPaintSession>* sessions)
+    std::vector<RecordedPaintSession>* sessions, PaintStageTimings* timings)
 {
     if (right <= viewport->pos.x)
         return;
@@ -836,7 +917,7 @@ void viewport_render(
     top += viewport->viewPos.y;
     bottom += viewport->viewPos.y;
 
-    viewport_paint(viewport, dpi, left, top, right, bottom, sessions);
+    viewport_paint(viewport, dpi, left, top, right, bottom, sessions, timings);
 
 #ifdef DEBUG_SHOW_DIRTY_BOX
     if (viewport != g_viewport_list)
@@ -857,69 +938,123 @@ static void record_session(
     auto& recordedSession = recorded_sessions->at(record_index);
     recordedSession.Session = *session;
     recordedSession.Entries.resize(session->PaintEntryChain.GetCount());
+    recordedSession.X = session->DPI.x;
+    recordedSession.Y = session->DPI.y;
+    recordedSession.Width = session->DPI.width;
+    recordedSession.Height = session->DPI.height;
+    recordedSession.Zoom = session->DPI.zoom_level;
 
     // Mind the offset needs to be calculated against the original `session`, not `session_copy`
-    std::unordered_map<paint_struct*, paint_struct*> entryRemap;
+    std::unordered_map<const void*, size_t> entryIndices;
 
     // Copy all entries
-    auto paintIndex = 0;
+    size_t paintIndex = 0;
     auto chain = session->PaintEntryChain.Head;
     while (chain != nullptr)
     {
         for (size_t i = 0; i < chain->Count; i++)
         {
             auto& src = chain->PaintStructs[i];
-            auto& dst = recordedSession.Entries[paintIndex++];
-            dst = src;
-            entryRemap[&src.basic] = reinterpret_cast<paint_struct*>(i * sizeof(paint_entry));
+            entryIndices[&src] = paintIndex;
+            recordedSession.Entries[paintIndex++] = src;
+        }
+        if (chain == session->PaintEntryChain.Current)
+        {
+            // Nodes past the current one are kept from earlier frames
+            break;
         }
         chain = chain->Next;
     }
-    entryRemap[nullptr] = reinterpret_cast<paint_struct*>(-1);
 
-    // Remap all entries
-    for (auto& ps : recordedSession.Entries)
-    {
-        auto& ptr = ps.basic.next_quadrant_ps;
-        auto it = entryRemap.find(ptr);
-        if (it == entryRemap.end())
+    auto toOffset = [&entryIndices](auto* ptr) -> decltype(ptr) {
+        if (ptr == nullptr)
+        {
+            return reinterpret_cast<decltype(ptr)>(-1);
+        }
+        auto it = entryIndices.find(ptr);
+        if (it == entryIndices.end())
         {
             assert(false);
-            ptr = nullptr;
+            return reinterpret_cast<decltype(ptr)>(-1);
         }
-        else
+        return reinterpret_cast<decltype(ptr)>(it->second * sizeof(paint_entry));
+    };
+
+    // The entries do not know which member of the union they are, so walk the generated structure from the quadrants
+    // and remap the pointers of every paint struct and attached paint struct found on the way. String entries have no
+    // pointers that are used again.
+    std::vector<const paint_struct*> pending;
+    std::vector<bool> visited(recordedSession.Entries.size());
+    for (size_t i = 0; i < std::size(session->Quadrants); i++)
+    {
+        recordedSession.Session.Quadrants[i] = toOffset(session->Quadrants[i]);
+        if (session->Quadrants[i] != nullptr)
         {
-            ptr = it->second;
+            pending.push_back(session->Quadrants[i]);
         }
     }
-    for (auto& ptr : recordedSession.Session.Quadrants)
+    while (!pending.empty())
     {
-        auto it = entryRemap.find(ptr);
-        if (it == entryRemap.end())
+        const auto* ps = pending.back();
+        pending.pop_back();
+        auto it = entryIndices.find(ps);
+        if (it == entryIndices.end() || visited[it->second])
         {
-            assert(false);
-            ptr = nullptr;
+            continue;
         }
-        else
+        visited[it->second] = true;
+
+        auto& dst = recordedSession.Entries[it->second].basic;
+        dst.next_quadrant_ps = toOffset(ps->next_quadrant_ps);
+        dst.children = toOffset(ps->children);
+        dst.attached_ps = toOffset(ps->attached_ps);
+        for (const auto* attached = ps->attached_ps; attached != nullptr; attached = attached->next)
         {
-            ptr = it->second;
+            auto attachedIt = entryIndices.find(attached);
+            if (attachedIt != entryIndices.end())
+            {
+                recordedSession.Entries[attachedIt->second].attached.next = toOffset(attached->next);
+            }
+        }
+        if (ps->next_quadrant_ps != nullptr)
+        {
+            pending.push_back(ps->next_quadrant_ps);
+        }
+        if (ps->children != nullptr)
+        {
+            pending.push_back(ps->children);
         }
     }
 }
 
 static void viewport_fill_column(
-    paint_session* session, std::vector<RecordedPaintSession>* recorded_sessions, size_t record_index)
+    paint_session* session, std::vector<RecordedPaintSession>* recorded_sessions, size_t record_index,
+    PaintStageTimings* timings = nullptr)
 {
+    const auto generateStart = OpenRCT2::Profiling::GetTimestamp();
     PaintSessionGenerate(session);
+    const auto generateEnd = OpenRCT2::Profiling::GetTimestamp();
+    OpenRCT2::Profiling::RecordZone("Paint generate", generateStart, generateEnd);
     if (recorded_sessions != nullptr)
     {
         record_session(session, recorded_sessions, record_index);
     }
+    const auto arrangeStart = OpenRCT2::Profiling::GetTimestamp();
     PaintSessionArrange(session);
+    const auto arrangeEnd = OpenRCT2::Profiling::GetTimestamp();
+    OpenRCT2::Profiling::RecordZone("Paint arrange", arrangeStart, arrangeEnd);
+    if (timings != nullptr)
+    {
+        timings->Generate += std::chrono::nanoseconds(generateEnd - generateStart);
+        timings->Arrange += std::chrono::nanoseconds(arrangeEnd - arrangeStart);
+        timings->PaintEntries += session->PaintEntryChain.GetCount();
+    }
 }
 
-static void viewport_paint_column(paint_session* session)
+static void viewport_draw_column(paint_session* session)
 {
+    OpenRCT2::Profiling::ScopedZone zone("Paint draw");
+
     if (session->ViewFlags
             & (VIEWPORT_FLAG_HIDE_VERTICAL | VIEWPORT_FLAG_HIDE_BASE | VIEWPORT_FLAG_UNDERGROUND_INSIDE
                | VIEWPORT_FLAG_CLIP_VIEW)
@@ -940,13 +1075,238 @@ static void viewport_paint_column(paint_session* session)
     {
         viewport_paint_weather_gloom(&session->DPI);
     }
+}
+
+static bool viewport_column_dpi_equals(const rct_drawpixelinfo& a, const rct_drawpixelinfo& b)
+{
+    return a.bits == b.bits && a.x == b.x && a.y == b.y && a.width == b.width && a.height == b.height && a.pitch == b.pitch
+        && a.zoom_level == b.zoom_level && a.remX == b.remX && a.remY == b.remY && a.DrawingEngine == b.DrawingEngine;
+}
+
+static bool viewport_column_cache_entry_is_current(const PaintColumnCacheEntry& entry)
+{
+    return entry.Generation == _paintColumnCacheGeneration && entry.Tick == gCurrentTicks
+        && entry.Rotation == get_current_rotation();
+}
+
+/**
+ * Frees the cached columns that can not be used anymore.
+ */
+static void viewport_prune_column_cache()
+{
+    auto it = std::remove_if(_paintColumnCache.begin(), _paintColumnCache.end(), [](const PaintColumnCacheEntry& entry) {
+        if (viewport_column_cache_entry_is_current(entry))
+            return false;
+        PaintSessionFree(entry.Session);
+        return true;
+    });
+    _paintColumnCache.erase(it, _paintColumnCache.end());
+}
+
+static paint_session* viewport_take_cached_column(const rct_drawpixelinfo& dpi, uint32_t viewFlags)
+{
+    for (auto& entry : _paintColumnCache)
+    {
+        if (entry.ViewFlags == viewFlags && viewport_column_dpi_equals(entry.Session->DPI, dpi)
+            && viewport_column_cache_entry_is_current(entry))
+        {
+            entry.LastUsedFrame = _paintColumnCacheFrame;
+            return entry.Session;
+        }
+    }
+    return nullptr;
+}
 
+static void viewport_store_cached_column(paint_session* session)
+{
+    if (_paintColumnCache.size() >= PaintColumnCacheSize)
+    {
+        auto oldest = std::min_element(
+            _paintColumnCache.begin(), _paintColumnCache.end(),
+            [](const auto& a, const auto& b) { return a.LastUsedFrame < b.LastUsedFrame; });
+        PaintSessionFree(oldest->Session);
+        _paintColumnCache.erase(oldest);
+    }
+    _paintColumnCache.push_back({ session, session->ViewFlags, get_current_rotation(), gCurrentTicks,
+                                  _paintColumnCacheGeneration, _paintColumnCacheFrame });
+}
+
+static void viewport_finish_column(const PaintColumn& column)
+{
+    paint_session* session = column.Session;
     if (session->PSStringHead != nullptr)
     {
         PaintDrawMoneyStructs(&session->DPI, session->PSStringHead);
     }
 
-    PaintSessionFree(session);
+    if (column.Cached)
+        return;
+
+    if (column.Cacheable)
+    {
+        viewport_store_cached_column(session);
+    }
+    else
+    {
+        PaintSessionFree(session);
+    }
+}
+
+static void viewport_paint_columns(const rct_drawpixelinfo& dpi, PaintStageTimings* timings)
+{
+    // The columns cover disjoint parts of the DPI so they can be drawn at the same time if the engine allows it. Text
+    // and releasing the sessions stay on this thread.
+    auto* drawingEngine = dpi.DrawingEngine;
+    if (gConfigGeneral.multithreading && timings == nullptr && drawingEngine != nullptr
+        && (drawingEngine->GetFlags() & DEF_PARALLEL_DRAWING))
+    {
+        OpenRCT2::TaskScheduler::Get().ParallelFor(
+            0, _paintColumns.size(), 1, [](size_t i) { viewport_draw_column(_paintColumns[i].Session); });
+    }
+    else
+    {
+        const auto drawStart = std::chrono::high_resolution_clock::now();
+        for (auto& column : _paintColumns)
+        {
+            viewport_draw_column(column.Session);
+        }
+        if (timings != nullptr)
+        {
+            timings->Draw += std::chrono::high_resolution_clock::now() - drawStart;
+        }
+    }
+
+    for (const auto& column : _paintColumns)
+    {
+        viewport_finish_column(column);
+    }
+}
+
+static paint_session* viewport_create_column(const rct_drawpixelinfo& dpi, uint32_t viewFlags, int16_t x, int16_t width)
+{
+    paint_session* session = PaintSessionAlloc(const_cast<rct_drawpixelinfo*>(&dpi), viewFlags);
+
+    rct_drawpixelinfo& dpi2 = session->DPI;
+    if (x >= dpi2.x)
+    {
+        int16_t leftPitch = x - dpi2.x;
+        dpi2.width -= leftPitch;
+        dpi2.bits += leftPitch / dpi2.zoom_level;
+        dpi2.pitch += leftPitch / dpi2.zoom_level;
+        dpi2.x = x;
+    }
+
+    int16_t paintRight = dpi2.x + dpi2.width;
+    if (paintRight >= x + width)
+    {
+        int16_t rightPitch = paintRight - x - width;
+        paintRight -= rightPitch;
+        dpi2.pitch += rightPitch / dpi2.zoom_level;
+    }
+    dpi2.width = paintRight - dpi2.x;
+    return session;
+}
+
+static size_t viewport_get_strip_cost_index(int16_t x)
+{
+    return static_cast<uint16_t>(x) / PaintStripWidth % _paintStripCosts.size();
+}
+
+static void viewport_set_strip_cost(int16_t x, uint32_t cost)
+{
+    _paintStripCosts[viewport_get_strip_cost_index(x)] = static_cast<uint16_t>(
+        std::min<uint32_t>(cost, std::numeric_limits<uint16_t>::max()));
+}
+
+/**
+ * Paints the area in columns whose width is based on how many paint entries the strips contained the last time they
+ * were painted. Empty strips are merged into wide columns to save the per session overhead, busy strips are split so a
+ * single column does not hold up the frame.
+ */
+static void viewport_paint_adaptive_columns(
+    const rct_drawpixelinfo& dpi, uint32_t viewFlags, int16_t alignedX, int16_t rightBorder)
+{
+    uint32_t totalCost = 0;
+    for (int16_t x = alignedX; x < rightBorder; x += PaintStripWidth)
+    {
+        totalCost += _paintStripCosts[viewport_get_strip_cost_index(x)];
+    }
+
+    // Aim for a few columns per thread so the scheduler can balance what the estimate got wrong.
+    const auto threadCount = OpenRCT2::TaskScheduler::Get().GetWorkerCount() + 1;
+    const uint32_t targetCost = std::max<uint32_t>(
+        static_cast<uint32_t>(totalCost / (threadCount * PaintColumnsPerThread)), PaintMinColumnCost);
+
+    int16_t x = alignedX;
+    while (x < rightBorder)
+    {
+        const uint32_t stripCost = _paintStripCosts[viewport_get_strip_cost_index(x)];
+        const int16_t halfWidth = PaintStripWidth / 2;
+        const int16_t halfX = x + halfWidth;
+        if (stripCost > targetCost * 2 && x >= dpi.x && halfX < rightBorder)
+        {
+            _paintColumns.push_back({ viewport_create_column(dpi, viewFlags, x, halfWidth), x, halfWidth });
+            _paintColumns.push_back({ viewport_create_column(dpi, viewFlags, halfX, halfWidth), halfX, halfWidth });
+            x += PaintStripWidth;
+            continue;
+        }
+
+        int16_t width = PaintStripWidth;
+        uint32_t columnCost = stripCost;
+        while (width < PaintMaxColumnWidth && x + width < rightBorder)
+        {
+            const uint32_t nextCost = _paintStripCosts[viewport_get_strip_cost_index(x + width)];
+            if (columnCost + nextCost > targetCost)
+                break;
+            columnCost += nextCost;
+            width += PaintStripWidth;
+        }
+        _paintColumns.push_back({ viewport_create_column(dpi, viewFlags, x, width), x, width });
+        x += width;
+    }
+
+    // Columns that were painted before and have not been invalidated since only need to be drawn again.
+    _paintColumnCacheFrame++;
+    viewport_prune_column_cache();
+    for (auto& column : _paintColumns)
+    {
+        column.Cacheable = true;
+        auto* cachedSession = viewport_take_cached_column(column.Session->DPI, viewFlags);
+        if (cachedSession != nullptr)
+        {
+            PaintSessionFree(column.Session);
+            column.Session = cachedSession;
+            column.Cached = true;
+        }
+    }
+
+    OpenRCT2::TaskScheduler::Get().ParallelFor(0, _paintColumns.size(), 1, [](size_t i) {
+        if (!_paintColumns[i].Cached)
+        {
+            viewport_fill_column(_paintColumns[i].Session, nullptr, 0);
+        }
+    });
+
+    // Both halves of a split strip add up to its cost, merged strips share the cost of their column evenly.
+    for (size_t i = 0; i < _paintColumns.size(); i++)
+    {
+        const auto& column = _paintColumns[i];
+        auto cost = static_cast<uint32_t>(column.Session->PaintEntryChain.GetCount());
+        if (column.Width < PaintStripWidth)
+        {
+            cost += static_cast<uint32_t>(_paintColumns[++i].Session->PaintEntryChain.GetCount());
+            viewport_set_strip_cost(column.X, cost);
+            continue;
+        }
+
+        const int16_t strips = column.Width / PaintStripWidth;
+        for (int16_t strip = 0; strip < strips; strip++)
+        {
+            viewport_set_strip_cost(column.X + strip * PaintStripWidth, cost / strips);
+        }
+    }
+
+    viewport_paint_columns(dpi, nullptr);
 }
 
 /**
@@ -961,7 +1321,7 @@ static void viewport_paint_column(paint_session* session)
  */
 void viewport_paint(
     const rct_viewport* viewport, rct_drawpixelinfo* dpi, int16_t left, int16_t top, int16_t right, int16_t bottom,
-    std::vector<RecordedPaintSession>* recorded_sessions)
+    std::vector<RecordedPaintSession>* recorded_sessions, PaintStageTimings* timings)
 {
     uint32_t viewFlags = viewport->flags;
     uint16_t width = right - left;
@@ -998,18 +1358,17 @@ void viewport_paint(
     // make sure, the compare operation is done in int16_t to avoid the loop becoming an infiniteloop.
     // this as well as the [x += 32] in the loop causes signed integer overflow -> undefined behaviour.
     const int16_t rightBorder = dpi1.x + dpi1.width;
-    const int16_t alignedX = floor2(dpi1.x, 32);
+    const int16_t alignedX = floor2(dpi1.x, PaintStripWidth);
 
     _paintColumns.clear();
 
-    bool useMultithreading = gConfigGeneral.multithreading;
-    if (useMultithreading && _paintJobs == nullptr)
-    {
-        _paintJobs = std::make_unique<JobPool>();
-    }
-    else if (useMultithreading == false && _paintJobs != nullptr)
+    // Stage timings are only taken when all columns are painted on this thread.
+    bool useMultithreading = gConfigGeneral.multithreading && timings == nullptr;
+
+    if (useMultithreading && recorded_sessions == nullptr)
     {
-        _paintJobs.reset();
+        viewport_paint_adaptive_columns(dpi1, viewFlags, alignedX, rightBorder);
+        return;
     }
 
     // Create space to record sessions and keep track which index is being drawn
@@ -1017,55 +1376,30 @@ void viewport_paint(
     if (recorded_sessions != nullptr)
     {
         const uint16_t columnSize = rightBorder - alignedX;
-        const uint16_t columnCount = (columnSize + 31) / 32;
+        const uint16_t columnCount = (columnSize + PaintStripWidth - 1) / PaintStripWidth;
         recorded_sessions->resize(columnCount);
     }
 
     // Splits the area into 32 pixel columns and renders them
-    for (x = alignedX; x < rightBorder; x += 32, index++)
+    for (x = alignedX; x < rightBorder; x += PaintStripWidth, index++)
     {
-        paint_session* session = PaintSessionAlloc(&dpi1, viewFlags);
-        _paintColumns.push_back(session);
-
-        rct_drawpixelinfo& dpi2 = session->DPI;
-        if (x >= dpi2.x)
-        {
-            int16_t leftPitch = x - dpi2.x;
-            dpi2.width -= leftPitch;
-            dpi2.bits += leftPitch / dpi2.zoom_level;
-            dpi2.pitch += leftPitch / dpi2.zoom_level;
-            dpi2.x = x;
-        }
-
-        int16_t paintRight = dpi2.x + dpi2.width;
-        if (paintRight >= x + 32)
-        {
-            int16_t rightPitch = paintRight - x - 32;
-            paintRight -= rightPitch;
-            dpi2.pitch += rightPitch / dpi2.zoom_level;
-        }
-        dpi2.width = paintRight - dpi2.x;
+        paint_session* session = viewport_create_column(dpi1, viewFlags, x, PaintStripWidth);
+        _paintColumns.push_back({ session, x, PaintStripWidth });
 
-        if (useMultithreading)
+        if (!useMultithreading)
         {
-            _paintJobs->AddTask(
-                [session, recorded_sessions, index]() -> void { viewport_fill_column(session, recorded_sessions, index); });
-        }
-        else
-        {
-            viewport_fill_column(session, recorded_sessions, index);
+            viewport_fill_column(session, recorded_sessions, index, timings);
         }
     }
 
     if (useMultithreading)
     {
-        _paintJobs->Join();
+        OpenRCT2::TaskScheduler::Get().ParallelFor(0, _paintColumns.size(), 1, [recorded_sessions](size_t i) {
+            viewport_fill_column(_paintColumns[i].Session, recorded_sessions, i);
+        });
     }
 
-    for (auto column : _paintColumns)
-    {
-        viewport_paint_column(column);
-    }
+    viewport_paint_columns(dpi1, timings);
 }
 
 static void viewport_paint_weather_gloom(rct_drawpixelinfo* dpi)
@@ -1156,6 +1490,40 @@ CoordsXY viewport_coord_to_map_coord(const ScreenCoordsXY& coords, int32_t z)
     return ret.Rotate(inverseRotation);
 }
 
+/**
+ * Returns the tiles an entity has to be on for a sprite reaching up to margin pixels from its position to be visible
+ * in the viewport, at any height. The range is clamped to the map.
+ */
+MapRange viewport_get_entity_map_range(const rct_viewport* viewport, int32_t margin)
+{
+    const int32_t left = viewport->viewPos.x - margin;
+    const int32_t top = viewport->viewPos.y - margin;
+    const int32_t right = viewport->viewPos.x + viewport->view_width + margin;
+    const int32_t bottom = viewport->viewPos.y + viewport->view_height + margin;
+
+    CoordsXY mapMin = { std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::max() };
+    CoordsXY mapMax = { std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::min() };
+    for (const auto& screenCoords : { ScreenCoordsXY{ left, top }, ScreenCoordsXY{ right, top },
+                                      ScreenCoordsXY{ left, bottom }, ScreenCoordsXY{ right, bottom } })
+    {
+        for (int32_t z : { 0, MAX_ELEMENT_HEIGHT * COORDS_Z_STEP })
+        {
+            auto mapCoords = viewport_coord_to_map_coord(screenCoords, z);
+            mapMin.x = std::min(mapMin.x, mapCoords.x);
+            mapMin.y = std::min(mapMin.y, mapCoords.y);
+            mapMax.x = std::max(mapMax.x, mapCoords.x);
+            mapMax.y = std::max(mapMax.y, mapCoords.y);
+        }
+    }
+
+    // One extra tile on every side for rounding in the projection
+    constexpr int32_t mapLimit = (MAXIMUM_MAP_SIZE_TECHNICAL - 1) * COORDS_XY_STEP;
+    return { std::clamp(floor2(mapMin.x, COORDS_XY_STEP) - COORDS_XY_STEP, 0, mapLimit),
+             std::clamp(floor2(mapMin.y, COORDS_XY_STEP) - COORDS_XY_STEP, 0, mapLimit),
+             std::clamp(floor2(mapMax.x, COORDS_XY_STEP) + COORDS_XY_STEP, 0, mapLimit),
+             std::clamp(floor2(mapMax.y, COORDS_XY_STEP) + COORDS_XY_STEP, 0, mapLimit) };
+}
+
 /**
  *
  *  rct2: 0x00664689
@@ -1469,7 +1837,7 @@ static bool is_pixel_present_rle(const uint8_t* esi, int16_t x_start_point, int1
  * @return value originally stored in 0x00141F569
  */
 static bool is_sprite_interacted_with_palette_set(
-    rct_drawpixelinfo* dpi, int32_t imageId, const ScreenCoordsXY& coords, const PaletteMap& paletteMap)
+    rct_drawpixelinfo* dpi, int32_t imageId, const ScreenCoordsXY& coords, const PaletteMap& paletteMap, uint32_t imageType)
 {
     const rct_g1_element* g1 = gfx_get_g1_element(imageId & 0x7FFFF);
     if (g1 == nullptr)
@@ -1498,7 +1866,7 @@ static bool is_sprite_interacted_with_palette_set(
             };
 
             return is_sprite_interacted_with_palette_set(
-                &zoomed_dpi, imageId - g1->zoomed_offset, { coords.x / 2, coords.y / 2 }, paletteMap);
+                &zoomed_dpi, imageId - g1->zoomed_offset, { coords.x / 2, coords.y / 2 }, paletteMap, imageType);
         }
     }
 
@@ -1597,7 +1965,6 @@ static bool is_sprite_interacted_with_palette_set(
     }
 
     uint8_t* offset = g1->offset + (yStartPoint * g1->width) + xStartPoint;
-    uint32_t imageType = _currentImageType;
 
     if (!(g1->flags & G1_FLAG_1))
     {
@@ -1616,10 +1983,11 @@ static bool is_sprite_interacted_with_palette_set(
 static bool is_sprite_interacted_with(rct_drawpixelinfo* dpi, int32_t imageId, const ScreenCoordsXY& coords)
 {
     auto paletteMap = PaletteMap::GetDefault();
+    uint32_t imageType = 0;
     imageId &= ~IMAGE_TYPE_TRANSPARENT;
     if (imageId & IMAGE_TYPE_REMAP)
     {
-        _currentImageType = IMAGE_TYPE_REMAP;
+        imageType = IMAGE_TYPE_REMAP;
         int32_t index = (imageId >> 19) & 0x7F;
         if (imageId & IMAGE_TYPE_REMAP_2_PLUS)
         {
@@ -1630,11 +1998,7 @@ static bool is_sprite_interacted_with(rct_drawpixelinfo* dpi, int32_t imageId, c
             paletteMap = *pm;
         }
     }
-    else
-    {
-        _currentImageType = 0;
-    }
-    return is_sprite_interacted_with_palette_set(dpi, imageId, coords, paletteMap);
+    return is_sprite_interacted_with_palette_set(dpi, imageId, coords, paletteMap, imageType);
 }
 
 /**
@@ -1720,6 +2084,18 @@ InteractionInfo get_map_coordinates_from_pos_window(rct_window* window, const Sc
             viewLoc.x &= (0xFFFF * myviewport->zoom) & 0xFFFF;
             viewLoc.y &= (0xFFFF * myviewport->zoom) & 0xFFFF;
         }
+
+        auto filter = static_cast<uint16_t>(flags & 0xFFFF);
+        auto rotation = get_current_rotation();
+        for (const auto& entry : _interactionCache)
+        {
+            if (entry.Generation == _interactionCacheGeneration && entry.ViewLoc == viewLoc && entry.Zoom == myviewport->zoom
+                && entry.ViewFlags == myviewport->flags && entry.Rotation == rotation && entry.Filter == filter)
+            {
+                return entry.Info;
+            }
+        }
+
         rct_drawpixelinfo dpi;
         dpi.x = viewLoc.x;
         dpi.y = viewLoc.y;
@@ -1730,17 +2106,57 @@ InteractionInfo get_map_coordinates_from_pos_window(rct_window* window, const Sc
         paint_session* session = PaintSessionAlloc(&dpi, myviewport->flags);
         PaintSessionGenerate(session);
         PaintSessionArrange(session);
-        info = set_interaction_info_from_paint_session(session, flags & 0xFFFF);
+        info = set_interaction_info_from_paint_session(session, filter);
         PaintSessionFree(session);
+
+        auto& entry = _interactionCache[_interactionCacheNext];
+        _interactionCacheNext = (_interactionCacheNext + 1) % _interactionCache.size();
+        entry = { _interactionCacheGeneration, viewLoc, myviewport->zoom, myviewport->flags, rotation, filter, info };
     }
     return info;
 }
 
+/**
+ * Forgets the results of previous hit tests. Called whenever part of the screen is invalidated, as anything that
+ * changes what is drawn can also change what is under the cursor.
+ */
+void viewport_invalidate_interaction_cache()
+{
+    _interactionCacheGeneration++;
+}
+
+void viewport_invalidate_paint_cache()
+{
+    _paintColumnCacheGeneration++;
+}
+
+/**
+ * Drops the cached columns that overlap the given area, in 2D map coordinates at zoom 0.
+ */
+static void viewport_invalidate_cached_columns(int32_t left, int32_t top, int32_t right, int32_t bottom)
+{
+    auto it = std::remove_if(
+        _paintColumnCache.begin(), _paintColumnCache.end(), [left, top, right, bottom](const PaintColumnCacheEntry& entry) {
+            const auto& dpi = entry.Session->DPI;
+            if (right <= dpi.x || left >= dpi.x + dpi.width || bottom <= dpi.y || top >= dpi.y + dpi.height)
+                return false;
+            PaintSessionFree(entry.Session);
+            return true;
+        });
+    _paintColumnCache.erase(it, _paintColumnCache.end());
+}
+
 /**
  * Left, top, right and bottom represent 2D map coordinates at zoom 0.
  */
 void viewport_invalidate(const rct_viewport* viewport, int32_t left, int32_t top, int32_t right, int32_t bottom)
 {
+    viewport_invalidate_interaction_cache();
+    if (!_paintColumnCache.empty())
+    {
+        viewport_invalidate_cached_columns(left, top, right, bottom);
+    }
+
     // if unknown viewport visibility, use the containing window to discover the status
     if (viewport->visibility == VisibilityCache::Unknown)
     {
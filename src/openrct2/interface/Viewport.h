@@ -13,12 +13,25 @@
 #include "../world/Location.hpp"
 #include "Window.h"
 
+#include <chrono>
 #include <limits>
 #include <optional>
 #include <vector>
 
 struct paint_session;
 struct RecordedPaintSession;
+
+/**
+ * Time spent in each stage of painting viewports and the number of paint entries generated, summed over all paint
+ * columns.
+ */
+struct PaintStageTimings
+{
+    std::chrono::duration<double> Generate{};
+    std::chrono::duration<double> Arrange{};
+    std::chrono::duration<double> Draw{};
+    uint64_t PaintEntries{};
+};
 struct paint_struct;
 struct rct_drawpixelinfo;
 struct Peep;
@@ -109,6 +122,7 @@ void viewport_create(
     char flags, uint16_t sprite);
 void viewport_remove(rct_viewport* viewport);
 void viewports_invalidate(int32_t left, int32_t top, int32_t right, int32_t bottom, int32_t maxZoom = -1);
+bool viewports_overlap(int32_t left, int32_t top, int32_t right, int32_t bottom, int32_t maxZoom = -1);
 void viewport_update_position(rct_window* window);
 void viewport_update_sprite_follow(rct_window* window);
 void viewport_update_smart_sprite_follow(rct_window* window);
@@ -117,14 +131,15 @@ void viewport_update_smart_staff_follow(rct_window* window, Peep* peep);
 void viewport_update_smart_vehicle_follow(rct_window* window);
 void viewport_render(
     rct_drawpixelinfo* dpi, const rct_viewport* viewport, int32_t left, int32_t top, int32_t right, int32_t bottom,
-    std::vector<RecordedPaintSession>* sessions = nullptr);
+    std::vector<RecordedPaintSession>* sessions = nullptr, PaintStageTimings* timings = nullptr);
 void viewport_paint(
     const rct_viewport* viewport, rct_drawpixelinfo* dpi, int16_t left, int16_t top, int16_t right, int16_t bottom,
-    std::vector<RecordedPaintSession>* sessions = nullptr);
+    std::vector<RecordedPaintSession>* sessions = nullptr, PaintStageTimings* timings = nullptr);
 
 CoordsXYZ viewport_adjust_for_map_height(const ScreenCoordsXY& startCoords);
 
 CoordsXY viewport_coord_to_map_coord(const ScreenCoordsXY& coords, int32_t z);
+MapRange viewport_get_entity_map_range(const rct_viewport* viewport, int32_t margin);
 std::optional<CoordsXY> screen_pos_to_map_pos(const ScreenCoordsXY& screenCoords, int32_t* direction);
 
 void show_gridlines();
@@ -137,6 +152,8 @@ void viewport_set_visibility(uint8_t mode);
 
 InteractionInfo get_map_coordinates_from_pos(const ScreenCoordsXY& screenCoords, int32_t flags);
 InteractionInfo get_map_coordinates_from_pos_window(rct_window* window, const ScreenCoordsXY& screenCoords, int32_t flags);
+void viewport_invalidate_interaction_cache();
+void viewport_invalidate_paint_cache();
 
 InteractionInfo set_interaction_info_from_paint_session(paint_session* session, uint16_t filter);
 InteractionInfo ViewportInteractionGetItemLeft(const ScreenCoordsXY& screenCoords);
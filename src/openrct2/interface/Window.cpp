@@ -17,7 +17,9 @@
 #include "../audio/audio.h"
 #include "../config/Config.h"
 #include "../core/Guard.hpp"
+#include "../core/Profiling.h"
 #include "../drawing/Drawing.h"
+#include "../drawing/IDrawingEngine.h"
 #include "../interface/Cursors.h"
 #include "../localisation/Localisation.h"
 #include "../localisation/StringIds.h"
@@ -34,6 +36,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <functional>
 #include <iterator>
 #include <list>
@@ -53,6 +56,9 @@ uint16_t gWindowUpdateTicks;
 uint16_t gWindowMapFlashingFlags;
 colour_t gCurrentWindowColours[4];
 
+// Bumped to make every window repaint its offscreen copy
+static uint32_t _windowSurfaceCacheGeneration;
+
 // converted from uint16_t values at 0x009A41EC - 0x009A4230
 // these are percentage coordinates of the viewport to centre to, if a window is obscuring a location, the next is tried
 // clang-format off
@@ -86,6 +92,7 @@ namespace WindowCloseFlags
 
 static void window_draw_core(rct_drawpixelinfo* dpi, rct_window* w, int32_t left, int32_t top, int32_t right, int32_t bottom);
 static void window_draw_single(rct_drawpixelinfo* dpi, rct_window* w, int32_t left, int32_t top, int32_t right, int32_t bottom);
+static bool window_draw_from_surface_cache(rct_drawpixelinfo* dpi, rct_window* w);
 
 std::list<std::shared_ptr<rct_window>>::iterator window_get_iterator(const rct_window* w)
 {
@@ -518,6 +525,7 @@ void widget_invalidate(rct_window* w, rct_widgetindex widgetIndex)
 
     gfx_set_dirty_blocks({ { w->windowPos + ScreenCoordsXY{ widget->left, widget->top } },
                            { w->windowPos + ScreenCoordsXY{ widget->right + 1, widget->bottom + 1 } } });
+    w->surface_cache.SetDirty(widget->left, widget->top, widget->right + 1, widget->bottom + 1);
 }
 
 template<typename _TPred> static void widget_invalidate_by_condition(_TPred pred)
@@ -1233,7 +1241,124 @@ static void window_draw_single(rct_drawpixelinfo* dpi, rct_window* w, int32_t le
     gCurrentWindowColours[2] = NOT_TRANSLUCENT(w->colours[2]);
     gCurrentWindowColours[3] = NOT_TRANSLUCENT(w->colours[3]);
 
-    window_event_paint_call(w, dpi);
+    if (!window_draw_from_surface_cache(dpi, w))
+    {
+        window_event_paint_call(w, dpi);
+    }
+}
+
+/**
+ * Invalidates the offscreen copies of all windows, for changes that affect the contents of every window such as the
+ * language or the currency.
+ */
+void window_invalidate_all_surface_caches()
+{
+    _windowSurfaceCacheGeneration++;
+}
+
+static bool window_can_use_surface_cache(const rct_drawpixelinfo* dpi, const rct_window* w)
+{
+    if (!(w->flags & WF_CACHE_SURFACE) || (w->flags & (WF_TRANSPARENT | WF_NO_BACKGROUND)))
+        return false;
+    if (w->viewport != nullptr || w->width <= 0 || w->height <= 0)
+        return false;
+
+    // Translucent windows blend with whatever is behind them, so they can not be stored on their own
+    for (int32_t i = 0; i < 4; i++)
+    {
+        if (w->colours[i] & COLOUR_FLAG_TRANSLUCENT)
+            return false;
+    }
+
+    // Only engines that draw into an 8-bit frame buffer can blit the copy
+    return dpi->zoom_level == 0 && dpi->DrawingEngine != nullptr
+        && (dpi->DrawingEngine->GetFlags() & DEF_DIRTY_OPTIMISATIONS);
+}
+
+/**
+ * Everything other than the invalidated regions that decides what the window looks like, the offscreen copy is
+ * repainted in full when this changes.
+ */
+static uint64_t window_get_surface_cache_key(const rct_window* w)
+{
+    uint64_t key = 14695981039346656037ULL;
+    auto mix = [&key](uint64_t value) {
+        key = (key ^ value) * 1099511628211ULL;
+        key ^= key >> 32;
+    };
+    mix(_windowSurfaceCacheGeneration);
+    mix((static_cast<uint64_t>(static_cast<uint16_t>(w->width)) << 16) | static_cast<uint16_t>(w->height));
+    mix(reinterpret_cast<uintptr_t>(w->widgets));
+    mix(w->pressed_widgets);
+    mix(w->disabled_widgets);
+    mix(static_cast<uint16_t>(w->page));
+    mix(w->flags & WF_WHITE_BORDER_MASK);
+    for (auto colour : w->colours)
+    {
+        mix(colour);
+    }
+    return key;
+}
+
+/**
+ * Repaints the dirty region of the offscreen copy of the window and copies the region of dpi from it.
+ * @returns false if the window has to be painted directly.
+ */
+static bool window_draw_from_surface_cache(rct_drawpixelinfo* dpi, rct_window* w)
+{
+    if (!window_can_use_surface_cache(dpi, w))
+        return false;
+
+    // dpi has already been cropped to the window
+    const int32_t srcX = dpi->x - w->windowPos.x;
+    const int32_t srcY = dpi->y - w->windowPos.y;
+    if (srcX < 0 || srcY < 0 || srcX + dpi->width > w->width || srcY + dpi->height > w->height)
+        return false;
+
+    auto& cache = w->surface_cache;
+    const auto key = window_get_surface_cache_key(w);
+    const auto size = static_cast<size_t>(w->width) * w->height;
+    if (cache.Key != key || cache.Pixels.size() != size)
+    {
+        cache.Pixels.resize(size);
+        cache.Key = key;
+        cache.ClearDirty();
+        cache.SetDirty(0, 0, w->width, w->height);
+    }
+
+    if (cache.IsDirty())
+    {
+        const auto left = std::max(cache.DirtyLeft, 0);
+        const auto top = std::max(cache.DirtyTop, 0);
+        const auto right = std::min<int32_t>(cache.DirtyRight, w->width);
+        const auto bottom = std::min<int32_t>(cache.DirtyBottom, w->height);
+
+        // Clear first so invalidations made while painting are picked up next time
+        cache.ClearDirty();
+        if (left < right && top < bottom)
+        {
+            rct_drawpixelinfo cacheDpi;
+            cacheDpi.bits = cache.Pixels.data() + static_cast<size_t>(top) * w->width + left;
+            cacheDpi.x = w->windowPos.x + left;
+            cacheDpi.y = w->windowPos.y + top;
+            cacheDpi.width = right - left;
+            cacheDpi.height = bottom - top;
+            cacheDpi.pitch = w->width - cacheDpi.width;
+            cacheDpi.DrawingEngine = dpi->DrawingEngine;
+            window_event_paint_call(w, &cacheDpi);
+        }
+    }
+
+    const uint8_t* src = cache.Pixels.data() + static_cast<size_t>(srcY) * w->width + srcX;
+    uint8_t* dst = dpi->bits;
+    const auto dstStride = static_cast<size_t>(dpi->width) + dpi->pitch;
+    for (int32_t y = 0; y < dpi->height; y++)
+    {
+        std::memcpy(dst, src, dpi->width);
+        src += w->width;
+        dst += dstStride;
+    }
+    return true;
 }
 
 /**
@@ -2080,6 +2205,7 @@ bool window_is_visible(rct_window* w)
  */
 void window_draw_all(rct_drawpixelinfo* dpi, int16_t left, int16_t top, int16_t right, int16_t bottom)
 {
+    OpenRCT2::Profiling::ScopedZone zone("Draw windows");
     auto windowDPI = dpi->Crop({ left, top }, { right - left, bottom - top });
     window_visit_each([&windowDPI, left, top, right, bottom](rct_window* w) {
         if (w->flags & WF_TRANSPARENT)
@@ -371,6 +371,7 @@ enum WINDOW_FLAGS
     WF_RESIZABLE = (1 << 8),
     WF_NO_AUTO_CLOSE = (1 << 9), // Don't auto close this window if too many windows are open
     WF_10 = (1 << 10),
+    WF_CACHE_SURFACE = (1 << 11), // Keep an offscreen copy of the window and only repaint the invalidated parts of it
     WF_WHITE_BORDER_ONE = (1 << 12),
     WF_WHITE_BORDER_MASK = (1 << 12) | (1 << 13),
 
@@ -486,6 +487,7 @@ enum
     WC_DEBUG_PAINT = 130,
     WC_VIEW_CLIPPING = 131,
     WC_OBJECT_LOAD_ERROR = 132,
+    WC_PROFILER = 133,
 
     // Only used for colour schemes
     WC_STAFF = 220,
@@ -753,6 +755,7 @@ rct_widgetindex window_find_widget_from_point(rct_window* w, const ScreenCoordsX
 void window_invalidate_by_class(rct_windowclass cls);
 void window_invalidate_by_number(rct_windowclass cls, rct_windownumber number);
 void window_invalidate_all();
+void window_invalidate_all_surface_caches();
 void widget_invalidate(rct_window* w, rct_widgetindex widgetIndex);
 void widget_invalidate_by_class(rct_windowclass cls, rct_widgetindex widgetIndex);
 void widget_invalidate_by_number(rct_windowclass cls, rct_windownumber number, rct_widgetindex widgetIndex);
@@ -43,6 +43,7 @@ void rct_window::ScrollToViewport()
 void rct_window::Invalidate()
 {
     gfx_set_dirty_blocks({ windowPos, windowPos + ScreenCoordsXY{ width, height } });
+    surface_cache.SetDirty(0, 0, width, height);
 }
 
 void rct_window::RemoveViewport()
@@ -11,8 +11,10 @@
 
 #include "Window.h"
 
+#include <algorithm>
 #include <list>
 #include <memory>
+#include <vector>
 
 enum class TileInspectorPage : int16_t;
 
@@ -25,6 +27,48 @@ struct rct_object_entry;
 #    pragma GCC diagnostic ignored "-Wsuggest-final-types"
 #endif
 
+/**
+ * Offscreen copy of a window with WF_CACHE_SURFACE. Only the dirty region, relative to the window, is repainted into it
+ * before the requested parts are copied to the screen.
+ */
+struct WindowSurfaceCache
+{
+    std::vector<uint8_t> Pixels;
+    uint64_t Key{};
+    int32_t DirtyLeft{};
+    int32_t DirtyTop{};
+    int32_t DirtyRight{};
+    int32_t DirtyBottom{};
+
+    bool IsDirty() const
+    {
+        return DirtyLeft < DirtyRight && DirtyTop < DirtyBottom;
+    }
+
+    void SetDirty(int32_t left, int32_t top, int32_t right, int32_t bottom)
+    {
+        if (IsDirty())
+        {
+            DirtyLeft = std::min(DirtyLeft, left);
+            DirtyTop = std::min(DirtyTop, top);
+            DirtyRight = std::max(DirtyRight, right);
+            DirtyBottom = std::max(DirtyBottom, bottom);
+        }
+        else
+        {
+            DirtyLeft = left;
+            DirtyTop = top;
+            DirtyRight = right;
+            DirtyBottom = bottom;
+        }
+    }
+
+    void ClearDirty()
+    {
+        DirtyLeft = DirtyTop = DirtyRight = DirtyBottom = 0;
+    }
+};
+
 /**
  * Window structure
  * size: 0x4C0
@@ -102,6 +146,7 @@ struct rct_window
     colour_t colours[6]{};
     VisibilityCache visibility{};
     uint16_t viewport_smart_follow_sprite = SPRITE_INDEX_NULL; // Handles setting viewport target sprite etc
+    WindowSurfaceCache surface_cache;
 
     void SetLocation(const CoordsXYZ& coords);
     void ScrollToViewport();
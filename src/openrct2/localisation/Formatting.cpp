@@ -9,13 +9,16 @@
 
 #include "Formatting.h"
 
+#include "../Context.h"
 #include "../config/Config.h"
 #include "../util/Util.h"
 #include "Localisation.h"
+#include "LocalisationService.h"
 #include "StringIds.h"
 
 #include <cmath>
 #include <cstdint>
+#include <unordered_map>
 
 namespace OpenRCT2
 {
@@ -86,8 +89,21 @@ namespace OpenRCT2
         update();
     }
 
+    FmtString::iterator::iterator(const std::vector<token>& t, size_t i)
+        : tokens(&t)
+        , index(i)
+    {
+        update();
+    }
+
     void FmtString::iterator::update()
     {
+        if (tokens != nullptr)
+        {
+            current = index < tokens->size() ? (*tokens)[index] : token();
+            return;
+        }
+
         auto i = index;
         if (i >= str.size())
         {
@@ -202,9 +218,9 @@ namespace OpenRCT2
 
     FmtString::iterator& FmtString::iterator::operator++()
     {
-        if (index < str.size())
+        if (!eol())
         {
-            index += current.text.size();
+            index += tokens != nullptr ? 1 : current.text.size();
             update();
         }
         return *this;
@@ -213,17 +229,13 @@ namespace OpenRCT2
     FmtString::iterator FmtString::iterator::operator++(int)
     {
         auto result = *this;
-        if (index < str.size())
-        {
-            index += current.text.size();
-            update();
-        }
+        ++(*this);
         return result;
     }
 
     bool FmtString::iterator::eol() const
     {
-        return index >= str.size();
+        return index >= (tokens != nullptr ? tokens->size() : str.size());
     }
 
     FmtString::FmtString(std::string&& s)
@@ -242,13 +254,23 @@ namespace OpenRCT2
     {
     }
 
+    FmtString::FmtString(std::string_view s, const std::vector<token>& tokens)
+        : _str(s)
+        , _tokens(&tokens)
+    {
+    }
+
     FmtString::iterator FmtString::begin() const
     {
+        if (_tokens != nullptr)
+            return iterator(*_tokens, 0);
         return iterator(_str, 0);
     }
 
     FmtString::iterator FmtString::end() const
     {
+        if (_tokens != nullptr)
+            return iterator(*_tokens, _tokens->size());
         return iterator(_str, _str.size());
     }
 
@@ -624,10 +646,37 @@ namespace OpenRCT2
         return id >= REAL_NAME_START && id <= REAL_NAME_END;
     }
 
+    struct TokenisedString
+    {
+        const char* Source{};
+        uint32_t Generation{};
+        std::vector<FmtString::token> Tokens;
+    };
+
     FmtString GetFmtStringById(rct_string_id id)
     {
-        auto fmtc = language_get_string(id);
-        return FmtString(fmtc);
+        const auto& localisationService = GetContext()->GetLocalisationService();
+        auto fmtc = localisationService.GetString(id);
+        if (fmtc == nullptr)
+        {
+            return FmtString(fmtc);
+        }
+
+        // Every thread keeps its own tokens, strings are formatted by the paint threads as well.
+        thread_local std::unordered_map<rct_string_id, TokenisedString> tokenisedStrings;
+        auto generation = localisationService.GetStringsGeneration();
+        auto& tokenised = tokenisedStrings[id];
+        if (tokenised.Source != fmtc || tokenised.Generation != generation)
+        {
+            tokenised.Source = fmtc;
+            tokenised.Generation = generation;
+            tokenised.Tokens.clear();
+            for (const auto& token : FmtString(fmtc))
+            {
+                tokenised.Tokens.push_back(token);
+            }
+        }
+        return FmtString(fmtc, tokenised.Tokens);
     }
 
     FormatBuffer& GetThreadFormatStream()
@@ -149,9 +149,14 @@ namespace OpenRCT2
 
     class FmtString
     {
+    public:
+        struct token;
+
     private:
         std::string_view _str;
         std::string _strOwned;
+        // Tokens of _str parsed in advance, so iterating does not have to parse the string again.
+        const std::vector<token>* _tokens{};
 
     public:
         struct token
@@ -171,13 +176,16 @@ namespace OpenRCT2
         {
         private:
             std::string_view str;
-            size_t index;
+            const std::vector<token>* tokens{};
+            size_t index{};
             token current;
 
             void update();
 
         public:
+            iterator() = default;
             iterator(std::string_view s, size_t i);
+            iterator(const std::vector<token>& t, size_t i);
             bool operator==(iterator& rhs);
             bool operator!=(iterator& rhs);
             token CreateToken(size_t len);
@@ -192,12 +200,59 @@ namespace OpenRCT2
         FmtString(std::string&& s);
         FmtString(std::string_view s);
         FmtString(const char* s);
+        FmtString(std::string_view s, const std::vector<token>& tokens);
         iterator begin() const;
         iterator end() const;
 
         std::string WithoutFormatTokens() const;
     };
 
+    /**
+     * A stack of the strings being formatted, the outer string and any string ids it refers to. Strings rarely nest
+     * deeply, so the first few levels are kept inline to avoid allocating for every call.
+     */
+    class FormatIteratorStack
+    {
+        static constexpr size_t InlineCapacity = 8;
+
+        FmtString::iterator _inline[InlineCapacity];
+        std::vector<FmtString::iterator> _overflow;
+        size_t _size{};
+
+    public:
+        bool empty() const
+        {
+            return _size == 0;
+        }
+
+        FmtString::iterator& top()
+        {
+            return _size <= InlineCapacity ? _inline[_size - 1] : _overflow.back();
+        }
+
+        void push(const FmtString::iterator& it)
+        {
+            if (_size < InlineCapacity)
+            {
+                _inline[_size] = it;
+            }
+            else
+            {
+                _overflow.push_back(it);
+            }
+            _size++;
+        }
+
+        void pop()
+        {
+            if (_size > InlineCapacity)
+            {
+                _overflow.pop_back();
+            }
+            _size--;
+        }
+    };
+
     template<typename T> void FormatArgument(FormatBuffer& ss, FormatToken token, T arg);
 
     bool IsRealNameStringId(rct_string_id id);
@@ -206,7 +261,7 @@ namespace OpenRCT2
     FormatBuffer& GetThreadFormatStream();
     size_t CopyStringStreamToBuffer(char* buffer, size_t bufferLen, FormatBuffer& ss);
 
-    inline void FormatString(FormatBuffer& ss, std::stack<FmtString::iterator>& stack)
+    inline void FormatString(FormatBuffer& ss, FormatIteratorStack& stack)
     {
         while (!stack.empty())
         {
@@ -225,7 +280,7 @@ namespace OpenRCT2
     }
 
     template<typename TArg0, typename... TArgs>
-    static void FormatString(FormatBuffer& ss, std::stack<FmtString::iterator>& stack, TArg0 arg0, TArgs&&... argN)
+    static void FormatString(FormatBuffer& ss, FormatIteratorStack& stack, TArg0 arg0, TArgs&&... argN)
     {
         while (!stack.empty())
         {
@@ -268,7 +323,7 @@ namespace OpenRCT2
 
     template<typename... TArgs> static void FormatString(FormatBuffer& ss, const FmtString& fmt, TArgs&&... argN)
     {
-        std::stack<FmtString::iterator> stack;
+        FormatIteratorStack stack;
         stack.push(fmt.begin());
         FormatString(ss, stack, argN...);
     }
@@ -10,17 +10,24 @@
 #include "LanguagePack.h"
 
 #include "../common.h"
+#include "../core/File.h"
 #include "../core/FileStream.h"
 #include "../core/Memory.hpp"
+#include "../core/MemoryMappedFile.h"
+#include "../core/MemoryStream.h"
+#include "../core/Path.hpp"
 #include "../core/RTL.h"
 #include "../core/String.hpp"
 #include "../core/StringBuilder.h"
 #include "../core/StringReader.h"
+#include "../platform/platform.h"
 #include "Language.h"
 #include "Localisation.h"
 
 #include <algorithm>
+#include <limits>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 // Don't try to load more than language files that exceed 64 MiB
@@ -34,34 +41,99 @@ constexpr int32_t ObjectOverrideMaxStringCount = 3;
 constexpr rct_string_id ScenarioOverrideBase = 0x7000;
 constexpr int32_t ScenarioOverrideMaxStringCount = 3;
 
+// Strings are stored as offsets into one block of NUL terminated strings, which is also the layout of the cache file
+constexpr uint32_t NoString = std::numeric_limits<uint32_t>::max();
+// Marks offsets of strings set at runtime, the rest of the offset is the index into the runtime string list
+constexpr uint32_t RuntimeStringFlag = 0x80000000;
+
+constexpr uint32_t LANGUAGE_CACHE_MAGIC = 0x4B50434C; // LCPK
+constexpr uint16_t LANGUAGE_CACHE_VERSION = 1;
+
+#pragma pack(push, 1)
 struct ObjectOverride
 {
     char name[8] = { 0 };
-    std::string strings[ObjectOverrideMaxStringCount];
+    uint32_t strings[ObjectOverrideMaxStringCount] = { NoString, NoString, NoString };
 };
+assert_struct_size(ObjectOverride, 20);
 
 struct ScenarioOverride
 {
-    std::string filename;
-    std::string strings[ScenarioOverrideMaxStringCount];
+    uint32_t filename = NoString;
+    uint32_t strings[ScenarioOverrideMaxStringCount] = { NoString, NoString, NoString };
+};
+assert_struct_size(ScenarioOverride, 16);
+
+struct LanguageCacheHeader
+{
+    uint32_t Magic;
+    uint16_t Version;
+    uint16_t LanguageId;
+    uint64_t SourceSize;
+    uint64_t SourceLastModified;
+    uint32_t NumStrings;
+    uint32_t NumObjectOverrides;
+    uint32_t NumScenarioOverrides;
+    uint32_t StringDataSize;
 };
+assert_struct_size(LanguageCacheHeader, 40);
+#pragma pack(pop)
 
 class LanguagePack final : public ILanguagePack
 {
 private:
     uint16_t const _id;
-    std::vector<std::string> _strings;
+    std::vector<uint32_t> _strings;
     std::vector<ObjectOverride> _objectOverrides;
     std::vector<ScenarioOverride> _scenarioOverrides;
 
+    // Block of all strings read from the file, either owned or within the mapped cache file
+    std::vector<char> _stringData;
+    std::unique_ptr<OpenRCT2::MemoryMappedFile> _cacheFile;
+    const char* _stringBase = nullptr;
+
+    // Strings set at runtime, such as object names
+    std::vector<std::string> _runtimeStrings;
+    std::vector<uint32_t> _freeRuntimeStrings;
+
     ///////////////////////////////////////////////////////////////////////////
     // Parsing work data
     ///////////////////////////////////////////////////////////////////////////
     std::string _currentGroup;
     ObjectOverride* _currentObjectOverride = nullptr;
     ScenarioOverride* _currentScenarioOverride = nullptr;
+    std::unordered_map<std::string, uint32_t> _internedStrings;
 
 public:
+    /**
+     * Loads the language pack from the cache if it was written for the same source file, otherwise parses the source
+     * file and writes a new cache. Caching is skipped if cachePath is empty.
+     */
+    static LanguagePack* FromFile(uint16_t id, const utf8* path, const std::string& cachePath)
+    {
+        Guard::ArgumentNotNull(path);
+
+        uint64_t sourceSize = 0;
+        uint64_t sourceLastModified = 0;
+        if (!cachePath.empty())
+        {
+            sourceSize = File::GetSize(path);
+            sourceLastModified = File::GetLastModified(path);
+            auto cachedPack = FromCache(id, cachePath, sourceSize, sourceLastModified);
+            if (cachedPack != nullptr)
+            {
+                return cachedPack;
+            }
+        }
+
+        auto result = FromFile(id, path);
+        if (result != nullptr && !cachePath.empty())
+        {
+            result->WriteCache(cachePath, sourceSize, sourceLastModified);
+        }
+        return result;
+    }
+
     static LanguagePack* FromFile(uint16_t id, const utf8* path)
     {
         Guard::ArgumentNotNull(path);
@@ -116,6 +188,7 @@ public:
         _currentGroup = std::string();
         _currentObjectOverride = nullptr;
         _currentScenarioOverride = nullptr;
+        _internedStrings = {};
     }
 
     uint16_t GetId() const override
@@ -130,17 +203,19 @@ public:
 
     void RemoveString(rct_string_id stringId) override
     {
-        if (_strings.size() >= static_cast<size_t>(stringId))
+        if (_strings.size() > static_cast<size_t>(stringId))
         {
-            _strings[stringId] = std::string();
+            FreeRuntimeString(_strings[stringId]);
+            _strings[stringId] = NoString;
         }
     }
 
     void SetString(rct_string_id stringId, const std::string& str) override
     {
-        if (_strings.size() >= static_cast<size_t>(stringId))
+        if (_strings.size() > static_cast<size_t>(stringId))
         {
-            _strings[stringId] = str;
+            FreeRuntimeString(_strings[stringId]);
+            _strings[stringId] = AddRuntimeString(str);
         }
     }
 
@@ -152,10 +227,9 @@ public:
             int32_t ooIndex = offset / ScenarioOverrideMaxStringCount;
             int32_t ooStringIndex = offset % ScenarioOverrideMaxStringCount;
 
-            if (_scenarioOverrides.size() > static_cast<size_t>(ooIndex)
-                && !_scenarioOverrides[ooIndex].strings[ooStringIndex].empty())
+            if (_scenarioOverrides.size() > static_cast<size_t>(ooIndex))
             {
-                return _scenarioOverrides[ooIndex].strings[ooStringIndex].c_str();
+                return GetStringAt(_scenarioOverrides[ooIndex].strings[ooStringIndex]);
             }
             else
             {
@@ -168,10 +242,9 @@ public:
             int32_t ooIndex = offset / ObjectOverrideMaxStringCount;
             int32_t ooStringIndex = offset % ObjectOverrideMaxStringCount;
 
-            if (_objectOverrides.size() > static_cast<size_t>(ooIndex)
-                && !_objectOverrides[ooIndex].strings[ooStringIndex].empty())
+            if (_objectOverrides.size() > static_cast<size_t>(ooIndex))
             {
-                return _objectOverrides[ooIndex].strings[ooStringIndex].c_str();
+                return GetStringAt(_objectOverrides[ooIndex].strings[ooStringIndex]);
             }
             else
             {
@@ -180,9 +253,9 @@ public:
         }
         else
         {
-            if ((_strings.size() > static_cast<size_t>(stringId)) && !_strings[stringId].empty())
+            if (_strings.size() > static_cast<size_t>(stringId))
             {
-                return _strings[stringId].c_str();
+                return GetStringAt(_strings[stringId]);
             }
             else
             {
@@ -200,7 +273,7 @@ public:
         {
             if (std::string_view(objectOverride.name, 8) == legacyIdentifier)
             {
-                if (objectOverride.strings[index].empty())
+                if (objectOverride.strings[index] == NoString)
                 {
                     return STR_NONE;
                 }
@@ -220,9 +293,9 @@ public:
         int32_t ooIndex = 0;
         for (const ScenarioOverride& scenarioOverride : _scenarioOverrides)
         {
-            if (String::Equals(scenarioOverride.filename.c_str(), scenarioFilename, true))
+            if (String::Equals(GetStringOrEmpty(scenarioOverride.filename), scenarioFilename, true))
             {
-                if (scenarioOverride.strings[index].empty())
+                if (scenarioOverride.strings[index] == NoString)
                 {
                     return STR_NONE;
                 }
@@ -235,6 +308,228 @@ public:
     }
 
 private:
+    /**
+     * @returns the string at the given offset or nullptr if it is empty.
+     */
+    const utf8* GetStringAt(uint32_t offset) const
+    {
+        if (offset == NoString)
+        {
+            return nullptr;
+        }
+        if (offset & RuntimeStringFlag)
+        {
+            const auto& str = _runtimeStrings[offset & ~RuntimeStringFlag];
+            return str.empty() ? nullptr : str.c_str();
+        }
+        return _stringBase + offset;
+    }
+
+    const utf8* GetStringOrEmpty(uint32_t offset) const
+    {
+        auto str = GetStringAt(offset);
+        return str == nullptr ? "" : str;
+    }
+
+    /**
+     * Adds a string read from the file to the string block, identical strings share the same offset.
+     */
+    uint32_t InternString(const std::string& str)
+    {
+        if (str.empty())
+        {
+            return NoString;
+        }
+
+        auto it = _internedStrings.find(str);
+        if (it != _internedStrings.end())
+        {
+            return it->second;
+        }
+
+        auto offset = static_cast<uint32_t>(_stringData.size());
+        _stringData.insert(_stringData.end(), str.begin(), str.end());
+        _stringData.push_back('\0');
+        _stringBase = _stringData.data();
+        _internedStrings.emplace(str, offset);
+        return offset;
+    }
+
+    uint32_t AddRuntimeString(const std::string& str)
+    {
+        if (str.empty())
+        {
+            return NoString;
+        }
+
+        uint32_t index;
+        if (_freeRuntimeStrings.empty())
+        {
+            index = static_cast<uint32_t>(_runtimeStrings.size());
+            _runtimeStrings.push_back(str);
+        }
+        else
+        {
+            index = _freeRuntimeStrings.back();
+            _freeRuntimeStrings.pop_back();
+            _runtimeStrings[index] = str;
+        }
+        return index | RuntimeStringFlag;
+    }
+
+    void FreeRuntimeString(uint32_t offset)
+    {
+        if (offset != NoString && (offset & RuntimeStringFlag))
+        {
+            auto index = offset & ~RuntimeStringFlag;
+            _runtimeStrings[index] = std::string();
+            _freeRuntimeStrings.push_back(index);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Cache
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // The cache holds the parsed tables and the string block as they are in memory. It is mapped rather than read, so the
+    // string block is never copied and its pages are shared between all processes using the same language.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    LanguagePack(uint16_t id)
+        : _id(id)
+    {
+    }
+
+    static LanguagePack* FromCache(uint16_t id, const std::string& cachePath, uint64_t sourceSize, uint64_t sourceLastModified)
+    {
+        if (!File::Exists(cachePath))
+        {
+            return nullptr;
+        }
+
+        try
+        {
+            auto cacheFile = std::make_unique<OpenRCT2::MemoryMappedFile>(cachePath);
+            auto data = cacheFile->GetData();
+            auto length = static_cast<uint64_t>(cacheFile->GetLength());
+            if (length < sizeof(LanguageCacheHeader))
+            {
+                return nullptr;
+            }
+
+            LanguageCacheHeader header;
+            std::memcpy(&header, data, sizeof(header));
+            if (header.Magic != LANGUAGE_CACHE_MAGIC || header.Version != LANGUAGE_CACHE_VERSION || header.LanguageId != id
+                || header.SourceSize != sourceSize || header.SourceLastModified != sourceLastModified)
+            {
+                return nullptr;
+            }
+
+            uint64_t expectedLength = sizeof(LanguageCacheHeader) + (header.NumStrings * uint64_t(sizeof(uint32_t)))
+                + (header.NumObjectOverrides * uint64_t(sizeof(ObjectOverride)))
+                + (header.NumScenarioOverrides * uint64_t(sizeof(ScenarioOverride))) + header.StringDataSize;
+            if (length != expectedLength)
+            {
+                return nullptr;
+            }
+
+            auto pack = std::unique_ptr<LanguagePack>(new LanguagePack(id));
+            auto stream = OpenRCT2::MemoryStream(data, static_cast<size_t>(length));
+            stream.SetPosition(sizeof(LanguageCacheHeader));
+            pack->_strings.resize(header.NumStrings);
+            stream.Read(pack->_strings.data(), pack->_strings.size() * sizeof(uint32_t));
+            pack->_objectOverrides.resize(header.NumObjectOverrides);
+            stream.Read(pack->_objectOverrides.data(), pack->_objectOverrides.size() * sizeof(ObjectOverride));
+            pack->_scenarioOverrides.resize(header.NumScenarioOverrides);
+            stream.Read(pack->_scenarioOverrides.data(), pack->_scenarioOverrides.size() * sizeof(ScenarioOverride));
+            pack->_stringBase = reinterpret_cast<const char*>(data + stream.GetPosition());
+
+            if (!pack->ValidateOffsets(header.StringDataSize))
+            {
+                log_warning("Language cache '%s' is corrupt.", cachePath.c_str());
+                return nullptr;
+            }
+
+            pack->_cacheFile = std::move(cacheFile);
+            return pack.release();
+        }
+        catch (const std::exception& ex)
+        {
+            log_warning("Unable to read language cache '%s': %s", cachePath.c_str(), ex.what());
+            return nullptr;
+        }
+    }
+
+    bool ValidateOffsets(uint32_t stringDataSize) const
+    {
+        // Every string must start within the block and the block must end with a terminator
+        if (stringDataSize != 0 && _stringBase[stringDataSize - 1] != '\0')
+        {
+            return false;
+        }
+        auto isValid = [stringDataSize](uint32_t offset) { return offset == NoString || offset < stringDataSize; };
+        if (!std::all_of(_strings.begin(), _strings.end(), isValid))
+        {
+            return false;
+        }
+        for (const auto& objectOverride : _objectOverrides)
+        {
+            if (!std::all_of(std::begin(objectOverride.strings), std::end(objectOverride.strings), isValid))
+            {
+                return false;
+            }
+        }
+        for (const auto& scenarioOverride : _scenarioOverrides)
+        {
+            if (!isValid(scenarioOverride.filename)
+                || !std::all_of(std::begin(scenarioOverride.strings), std::end(scenarioOverride.strings), isValid))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void WriteCache(const std::string& cachePath, uint64_t sourceSize, uint64_t sourceLastModified) const
+    {
+        try
+        {
+            LanguageCacheHeader header{};
+            header.Magic = LANGUAGE_CACHE_MAGIC;
+            header.Version = LANGUAGE_CACHE_VERSION;
+            header.LanguageId = _id;
+            header.SourceSize = sourceSize;
+            header.SourceLastModified = sourceLastModified;
+            header.NumStrings = static_cast<uint32_t>(_strings.size());
+            header.NumObjectOverrides = static_cast<uint32_t>(_objectOverrides.size());
+            header.NumScenarioOverrides = static_cast<uint32_t>(_scenarioOverrides.size());
+            header.StringDataSize = static_cast<uint32_t>(_stringData.size());
+
+            OpenRCT2::MemoryStream stream;
+            stream.WriteValue(header);
+            stream.Write(_strings.data(), _strings.size() * sizeof(uint32_t));
+            stream.Write(_objectOverrides.data(), _objectOverrides.size() * sizeof(ObjectOverride));
+            stream.Write(_scenarioOverrides.data(), _scenarioOverrides.size() * sizeof(ScenarioOverride));
+            stream.Write(_stringData.data(), _stringData.size());
+
+            // Write to a new file and move it over the old cache, other processes may still have the old one mapped
+            platform_ensure_directory_exists(Path::GetDirectory(cachePath).c_str());
+            auto tempPath = cachePath + ".tmp";
+            File::WriteAllBytes(tempPath, stream.GetData(), stream.GetLength());
+            if (File::Exists(cachePath))
+            {
+                File::Delete(cachePath);
+            }
+            if (!File::Move(tempPath, cachePath))
+            {
+                File::Delete(tempPath);
+            }
+        }
+        catch (const std::exception& ex)
+        {
+            log_warning("Unable to write language cache '%s': %s", cachePath.c_str(), ex.what());
+        }
+    }
+
     ObjectOverride* GetObjectOverride(const std::string& objectIdentifier)
     {
         for (auto& oo : _objectOverrides)
@@ -251,7 +546,7 @@ private:
     {
         for (auto& so : _scenarioOverrides)
         {
-            if (String::Equals(so.strings[0], scenarioIdentifier.c_str(), true))
+            if (String::Equals(GetStringOrEmpty(so.strings[0]), scenarioIdentifier.c_str(), true))
             {
                 return &so;
             }
@@ -450,7 +745,7 @@ private:
 
                 _scenarioOverrides.emplace_back();
                 _currentScenarioOverride = &_scenarioOverrides[_scenarioOverrides.size() - 1];
-                _currentScenarioOverride->filename = std::string(sb.GetBuffer());
+                _currentScenarioOverride->filename = InternString(std::string(sb.GetBuffer()));
             }
         }
     }
@@ -559,19 +854,19 @@ private:
             // Make sure the list is big enough to contain this string id
             if (static_cast<size_t>(stringId) >= _strings.size())
             {
-                _strings.resize(stringId + 1);
+                _strings.resize(stringId + 1, NoString);
             }
-            _strings[stringId] = s;
+            _strings[stringId] = InternString(s);
         }
         else
         {
             if (_currentObjectOverride != nullptr)
             {
-                _currentObjectOverride->strings[stringId] = s;
+                _currentObjectOverride->strings[stringId] = InternString(s);
             }
             else
             {
-                _currentScenarioOverride->strings[stringId] = s;
+                _currentScenarioOverride->strings[stringId] = InternString(s);
             }
         }
     }
@@ -585,6 +880,12 @@ namespace LanguagePackFactory
         return languagePack;
     }
 
+    ILanguagePack* FromFile(uint16_t id, const utf8* path, const std::string& cachePath)
+    {
+        auto languagePack = LanguagePack::FromFile(id, path, cachePath);
+        return languagePack;
+    }
+
     ILanguagePack* FromText(uint16_t id, const utf8* text)
     {
         auto languagePack = LanguagePack::FromText(id, text);
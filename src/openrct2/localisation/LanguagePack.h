@@ -31,5 +31,10 @@ struct ILanguagePack
 namespace LanguagePackFactory
 {
     ILanguagePack* FromFile(uint16_t id, const utf8* path);
+
+    /**
+     * As above but loads the parsed language pack from cachePath if it is up to date, otherwise writes it there.
+     */
+    ILanguagePack* FromFile(uint16_t id, const utf8* path, const std::string& cachePath);
     ILanguagePack* FromText(uint16_t id, const utf8* text);
 } // namespace LanguagePackFactory
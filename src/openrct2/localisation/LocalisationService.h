@@ -11,6 +11,7 @@
 
 #include "../common.h"
 
+#include <atomic>
 #include <memory>
 #include <stack>
 #include <string>
@@ -36,6 +37,7 @@ namespace OpenRCT2::Localisation
         std::unique_ptr<ILanguagePack> _languageFallback;
         std::unique_ptr<ILanguagePack> _languageCurrent;
         std::stack<rct_string_id> _availableObjectStringIds;
+        std::atomic<uint32_t> _stringsGeneration{};
 
     public:
         int32_t GetCurrentLanguage() const
@@ -46,6 +48,13 @@ namespace OpenRCT2::Localisation
         {
             return _useTrueTypeFont;
         }
+        /**
+         * Changes whenever strings are added, removed or replaced, so anything derived from them can tell it is stale.
+         */
+        uint32_t GetStringsGeneration() const
+        {
+            return _stringsGeneration;
+        }
         void UseTrueTypeFont(bool value)
         {
             _useTrueTypeFont = value;
@@ -59,6 +68,7 @@ namespace OpenRCT2::Localisation
             const std::string& scenarioFilename) const;
         rct_string_id GetObjectOverrideStringId(std::string_view legacyIdentifier, uint8_t index) const;
         std::string GetLanguagePath(uint32_t languageId) const;
+        std::string GetLanguageCachePath(uint32_t languageId) const;
 
         void OpenLanguage(int32_t id);
         void CloseLanguages();
@@ -3910,6 +3910,16 @@ enum
 
     STR_SHORTCUT_GIANT_SCREENSHOT = 6456,
 
+    STR_DEBUG_DROPDOWN_PROFILER = 6457,
+    STR_PROFILER_TITLE = 6458,
+    STR_PROFILER_RECORD_ZONES = 6459,
+    STR_PROFILER_ZONE = 6460,
+    STR_PROFILER_CALLS = 6461,
+    STR_PROFILER_P50 = 6462,
+    STR_PROFILER_P95 = 6463,
+    STR_PROFILER_P99 = 6464,
+    STR_PROFILER_MAX = 6465,
+
     // Have to include resource strings (from scenarios and objects) for the time being now that language is partially working
     /* MAX_STR_COUNT = 32768 */ // MAX_STR_COUNT - upper limit for number of strings, not the current count strings
 };
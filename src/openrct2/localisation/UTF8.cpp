@@ -9,8 +9,31 @@
 
 #include "Localisation.h"
 
+#include <cstring>
 #include <wchar.h>
 
+/**
+ * Returns the number of bytes at the start of the given text that are plain ASCII, checking eight bytes at a time.
+ */
+static size_t utf8_get_ascii_run_length(const utf8* text, size_t length)
+{
+    constexpr uint64_t HighBits = 0x8080808080808080ULL;
+
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t))
+    {
+        uint64_t block;
+        std::memcpy(&block, text + i, sizeof(block));
+        if (block & HighBits)
+            break;
+    }
+    while (i < length && !(text[i] & 0x80))
+    {
+        i++;
+    }
+    return i;
+}
+
 uint32_t utf8_get_next(const utf8* char_ptr, const utf8** nextchar_ptr)
 {
     int32_t result;
@@ -98,10 +121,17 @@ int32_t utf8_get_codepoint_length(char32_t codepoint)
 int32_t utf8_length(const utf8* text)
 {
     const utf8* ch = text;
+    const utf8* end = text + std::strlen(text);
 
     int32_t count = 0;
-    while (utf8_get_next(ch, &ch) != 0)
+    while (ch < end)
     {
+        // Runs of ASCII are one codepoint per byte, only decode the multi-byte sequences
+        auto asciiLength = utf8_get_ascii_run_length(ch, end - ch);
+        count += static_cast<int32_t>(asciiLength);
+        ch += asciiLength;
+        if (ch >= end || utf8_get_next(ch, &ch) == 0)
+            break;
         count++;
     }
     return count;
@@ -74,8 +74,16 @@ bool award_is_positive(int32_t type)
 
 #pragma region Award checks
 
+/** Guests thinking about litter, disgusting paths or vandalism. */
+static uint32_t award_get_untidy_thought_count(const ParkGuestStatistics& guestStatistics)
+{
+    return guestStatistics.GetFreshThoughtCount(PeepThoughtType::BadLitter)
+        + guestStatistics.GetFreshThoughtCount(PeepThoughtType::PathDisgusting)
+        + guestStatistics.GetFreshThoughtCount(PeepThoughtType::Vandalism);
+}
+
 /** More than 1/16 of the total guests must be thinking untidy thoughts. */
-static bool award_is_deserved_most_untidy(int32_t activeAwardTypes)
+static bool award_is_deserved_most_untidy(int32_t activeAwardTypes, const ParkGuestStatistics& guestStatistics)
 {
     if (activeAwardTypes & EnumToFlag(ParkAward::MostBeautiful))
         return false;
@@ -84,58 +92,28 @@ static bool award_is_deserved_most_untidy(int32_t activeAwardTypes)
     if (activeAwardTypes & EnumToFlag(ParkAward::MostTidy))
         return false;
 
-    uint32_t negativeCount = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        if (peep->Thoughts[0].freshness > 5)
-            continue;
-
-        if (peep->Thoughts[0].type == PeepThoughtType::BadLitter || peep->Thoughts[0].type == PeepThoughtType::PathDisgusting
-            || peep->Thoughts[0].type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
+    const auto negativeCount = award_get_untidy_thought_count(guestStatistics);
 
     return (negativeCount > gNumGuestsInPark / 16);
 }
 
 /** More than 1/64 of the total guests must be thinking tidy thoughts and less than 6 guests thinking untidy thoughts. */
-static bool award_is_deserved_most_tidy(int32_t activeAwardTypes)
+static bool award_is_deserved_most_tidy(int32_t activeAwardTypes, const ParkGuestStatistics& guestStatistics)
 {
     if (activeAwardTypes & EnumToFlag(ParkAward::MostUntidy))
         return false;
     if (activeAwardTypes & EnumToFlag(ParkAward::MostDisappointing))
         return false;
 
-    uint32_t positiveCount = 0;
-    uint32_t negativeCount = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        if (peep->Thoughts[0].freshness > 5)
-            continue;
-
-        if (peep->Thoughts[0].type == PeepThoughtType::VeryClean)
-            positiveCount++;
-
-        if (peep->Thoughts[0].type == PeepThoughtType::BadLitter || peep->Thoughts[0].type == PeepThoughtType::PathDisgusting
-            || peep->Thoughts[0].type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
+    const auto positiveCount = guestStatistics.GetFreshThoughtCount(PeepThoughtType::VeryClean);
+    const auto negativeCount = award_get_untidy_thought_count(guestStatistics);
 
     return (negativeCount <= 5 && positiveCount > gNumGuestsInPark / 64);
 }
 
 /** At least 6 open roller coasters. */
-static bool award_is_deserved_best_rollercoasters([[maybe_unused]] int32_t activeAwardTypes)
+static bool award_is_deserved_best_rollercoasters(
+    [[maybe_unused]] int32_t activeAwardTypes, [[maybe_unused]] const ParkGuestStatistics& guestStatistics)
 {
     auto rollerCoasters = 0;
     for (const auto& ride : GetRideManager())
@@ -162,7 +140,7 @@ static bool award_is_deserved_best_rollercoasters([[maybe_unused]] int32_t activ
 }
 
 /** Entrance fee is 0.10 less than half of the total ride value. */
-static bool award_is_deserved_best_value(int32_t activeAwardTypes)
+static bool award_is_deserved_best_value(int32_t activeAwardTypes, [[maybe_unused]] const ParkGuestStatistics& guestStatistics)
 {
     if (activeAwardTypes & EnumToFlag(ParkAward::WorstValue))
         return false;
@@ -183,39 +161,21 @@ static bool award_is_deserved_best_value(int32_t activeAwardTypes)
 }
 
 /** More than 1/128 of the total guests must be thinking scenic thoughts and fewer than 16 untidy thoughts. */
-static bool award_is_deserved_most_beautiful(int32_t activeAwardTypes)
+static bool award_is_deserved_most_beautiful(int32_t activeAwardTypes, const ParkGuestStatistics& guestStatistics)
 {
     if (activeAwardTypes & EnumToFlag(ParkAward::MostUntidy))
         return false;
     if (activeAwardTypes & EnumToFlag(ParkAward::MostDisappointing))
         return false;
 
-    uint32_t positiveCount = 0;
-    uint32_t negativeCount = 0;
-    auto list = EntityList<Guest>();
-    for (auto peep : list)
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        if (peep->Thoughts[0].freshness > 5)
-            continue;
-
-        if (peep->Thoughts[0].type == PeepThoughtType::Scenery)
-            positiveCount++;
-
-        if (peep->Thoughts[0].type == PeepThoughtType::BadLitter || peep->Thoughts[0].type == PeepThoughtType::PathDisgusting
-            || peep->Thoughts[0].type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
+    const auto positiveCount = guestStatistics.GetFreshThoughtCount(PeepThoughtType::Scenery);
+    const auto negativeCount = award_get_untidy_thought_count(guestStatistics);
 
     return (negativeCount <= 15 && positiveCount > gNumGuestsInPark / 128);
 }
 
 /** Entrance fee is more than total ride value. */
-static bool award_is_deserved_worst_value(int32_t activeAwardTypes)
+static bool award_is_deserved_worst_value(int32_t activeAwardTypes, [[maybe_unused]] const ParkGuestStatistics& guestStatistics)
 {
     if (activeAwardTypes & EnumToFlag(ParkAward::BestValue))
         return false;
@@ -231,16 +191,9 @@ static bool award_is_deserved_worst_value(int32_t activeAwardTypes)
 }
 
 /** No more than 2 people who think the vandalism is bad and no crashes. */
-static bool award_is_deserved_safest([[maybe_unused]] int32_t activeAwardTypes)
+static bool award_is_deserved_safest([[maybe_unused]] int32_t activeAwardTypes, const ParkGuestStatistics& guestStatistics)
 {
-    auto peepsWhoDislikeVandalism = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-        if (peep->Thoughts[0].freshness <= 5 && peep->Thoughts[0].type == PeepThoughtType::Vandalism)
-            peepsWhoDislikeVandalism++;
-    }
+    const auto peepsWhoDislikeVandalism = guestStatistics.GetFreshThoughtCount(PeepThoughtType::Vandalism);
 
     if (peepsWhoDislikeVandalism > 2)
         return false;
@@ -258,7 +211,7 @@ static bool award_is_deserved_safest([[maybe_unused]] int32_t activeAwardTypes)
 }
 
 /** All staff types, at least 20 staff, one staff per 32 peeps. */
-static bool award_is_deserved_best_staff(int32_t activeAwardTypes)
+static bool award_is_deserved_best_staff(int32_t activeAwardTypes, [[maybe_unused]] const ParkGuestStatistics& guestStatistics)
 {
     if (activeAwardTypes & EnumToFlag(ParkAward::MostUntidy))
         return false;
@@ -270,7 +223,7 @@ static bool award_is_deserved_best_staff(int32_t activeAwardTypes)
 }
 
 /** At least 7 shops, 4 unique, one shop per 128 guests and no more than 12 hungry guests. */
-static bool award_is_deserved_best_food(int32_t activeAwardTypes)
+static bool award_is_deserved_best_food(int32_t activeAwardTypes, const ParkGuestStatistics& guestStatistics)
 {
     if (activeAwardTypes & EnumToFlag(ParkAward::WorstFood))
         return false;
@@ -301,20 +254,12 @@ static bool award_is_deserved_best_food(int32_t activeAwardTypes)
         return false;
 
     // Count hungry peeps
-    auto hungryPeeps = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        if (peep->Thoughts[0].freshness <= 5 && peep->Thoughts[0].type == PeepThoughtType::Hungry)
-            hungryPeeps++;
-    }
+    const auto hungryPeeps = guestStatistics.GetFreshThoughtCount(PeepThoughtType::Hungry);
     return (hungryPeeps <= 12);
 }
 
 /** No more than 2 unique shops, less than one shop per 256 guests and more than 15 hungry guests. */
-static bool award_is_deserved_worst_food(int32_t activeAwardTypes)
+static bool award_is_deserved_worst_food(int32_t activeAwardTypes, const ParkGuestStatistics& guestStatistics)
 {
     if (activeAwardTypes & EnumToFlag(ParkAward::BestFood))
         return false;
@@ -345,20 +290,13 @@ static bool award_is_deserved_worst_food(int32_t activeAwardTypes)
         return false;
 
     // Count hungry peeps
-    auto hungryPeeps = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        if (peep->Thoughts[0].freshness <= 5 && peep->Thoughts[0].type == PeepThoughtType::Hungry)
-            hungryPeeps++;
-    }
+    const auto hungryPeeps = guestStatistics.GetFreshThoughtCount(PeepThoughtType::Hungry);
     return (hungryPeeps > 15);
 }
 
 /** At least 4 restrooms, 1 restroom per 128 guests and no more than 16 guests who think they need the restroom. */
-static bool award_is_deserved_best_restrooms([[maybe_unused]] int32_t activeAwardTypes)
+static bool award_is_deserved_best_restrooms(
+    [[maybe_unused]] int32_t activeAwardTypes, const ParkGuestStatistics& guestStatistics)
 {
     // Count open restrooms
     const auto& rideManager = GetRideManager();
@@ -375,20 +313,13 @@ static bool award_is_deserved_best_restrooms([[maybe_unused]] int32_t activeAwar
         return false;
 
     // Count number of guests who are thinking they need the restroom
-    auto guestsWhoNeedRestroom = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        if (peep->Thoughts[0].freshness <= 5 && peep->Thoughts[0].type == PeepThoughtType::Toilet)
-            guestsWhoNeedRestroom++;
-    }
+    const auto guestsWhoNeedRestroom = guestStatistics.GetFreshThoughtCount(PeepThoughtType::Toilet);
     return (guestsWhoNeedRestroom <= 16);
 }
 
 /** More than half of the rides have satisfaction <= 6 and park rating <= 650. */
-static bool award_is_deserved_most_disappointing(int32_t activeAwardTypes)
+static bool award_is_deserved_most_disappointing(
+    int32_t activeAwardTypes, [[maybe_unused]] const ParkGuestStatistics& guestStatistics)
 {
     if (activeAwardTypes & EnumToFlag(ParkAward::BestValue))
         return false;
@@ -415,7 +346,8 @@ static bool award_is_deserved_most_disappointing(int32_t activeAwardTypes)
 }
 
 /** At least 6 open water rides. */
-static bool award_is_deserved_best_water_rides([[maybe_unused]] int32_t activeAwardTypes)
+static bool award_is_deserved_best_water_rides(
+    [[maybe_unused]] int32_t activeAwardTypes, [[maybe_unused]] const ParkGuestStatistics& guestStatistics)
 {
     auto waterRides = 0;
     for (const auto& ride : GetRideManager())
@@ -443,7 +375,8 @@ static bool award_is_deserved_best_water_rides([[maybe_unused]] int32_t activeAw
 }
 
 /** At least 6 custom designed rides. */
-static bool award_is_deserved_best_custom_designed_rides(int32_t activeAwardTypes)
+static bool award_is_deserved_best_custom_designed_rides(
+    int32_t activeAwardTypes, [[maybe_unused]] const ParkGuestStatistics& guestStatistics)
 {
     if (activeAwardTypes & EnumToFlag(ParkAward::MostDisappointing))
         return false;
@@ -466,7 +399,8 @@ static bool award_is_deserved_best_custom_designed_rides(int32_t activeAwardType
     return (customDesignedRides >= 6);
 }
 
-static bool award_is_deserved_most_dazzling_ride_colours(int32_t activeAwardTypes)
+static bool award_is_deserved_most_dazzling_ride_colours(
+    int32_t activeAwardTypes, [[maybe_unused]] const ParkGuestStatistics& guestStatistics)
 {
     /** At least 5 colourful rides and more than half of the rides are colourful. */
     static constexpr const colour_t dazzling_ride_colours[] = { COLOUR_BRIGHT_PURPLE, COLOUR_BRIGHT_GREEN, COLOUR_LIGHT_ORANGE,
@@ -499,26 +433,19 @@ static bool award_is_deserved_most_dazzling_ride_colours(int32_t activeAwardType
 }
 
 /** At least 10 peeps and more than 1/64 of total guests are lost or can't find something. */
-static bool award_is_deserved_most_confusing_layout([[maybe_unused]] int32_t activeAwardTypes)
+static bool award_is_deserved_most_confusing_layout(
+    [[maybe_unused]] int32_t activeAwardTypes, const ParkGuestStatistics& guestStatistics)
 {
-    uint32_t peepsCounted = 0;
-    uint32_t peepsLost = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        peepsCounted++;
-        if (peep->Thoughts[0].freshness <= 5
-            && (peep->Thoughts[0].type == PeepThoughtType::Lost || peep->Thoughts[0].type == PeepThoughtType::CantFind))
-            peepsLost++;
-    }
+    const auto peepsCounted = guestStatistics.GuestsInPark;
+    const auto peepsLost = guestStatistics.GetFreshThoughtCount(PeepThoughtType::Lost)
+        + guestStatistics.GetFreshThoughtCount(PeepThoughtType::CantFind);
 
     return (peepsLost >= 10 && peepsLost >= peepsCounted / 64);
 }
 
 /** At least 10 open gentle rides. */
-static bool award_is_deserved_best_gentle_rides([[maybe_unused]] int32_t activeAwardTypes)
+static bool award_is_deserved_best_gentle_rides(
+    [[maybe_unused]] int32_t activeAwardTypes, [[maybe_unused]] const ParkGuestStatistics& guestStatistics)
 {
     auto gentleRides = 0;
     for (const auto& ride : GetRideManager())
@@ -545,7 +472,7 @@ static bool award_is_deserved_best_gentle_rides([[maybe_unused]] int32_t activeA
     return (gentleRides >= 10);
 }
 
-using award_deserved_check = bool (*)(int32_t);
+using award_deserved_check = bool (*)(int32_t, const ParkGuestStatistics&);
 
 static constexpr const award_deserved_check _awardChecks[] = {
     award_is_deserved_most_untidy,
@@ -567,9 +494,9 @@ static constexpr const award_deserved_check _awardChecks[] = {
     award_is_deserved_best_gentle_rides,
 };
 
-static bool award_is_deserved(int32_t awardType, int32_t activeAwardTypes)
+static bool award_is_deserved(int32_t awardType, int32_t activeAwardTypes, const ParkGuestStatistics& guestStatistics)
 {
-    return _awardChecks[awardType](activeAwardTypes);
+    return _awardChecks[awardType](activeAwardTypes, guestStatistics);
 }
 
 #pragma endregion
@@ -587,7 +514,7 @@ void award_reset()
  *
  *  rct2: 0x0066A86C
  */
-void award_update_all()
+void award_update_all(const ParkGuestStatistics& guestStatistics)
 {
     // Only add new awards if park is open
     if (gParkFlags & PARK_FLAGS_PARK_OPEN)
@@ -614,7 +541,7 @@ void award_update_all()
             } while (activeAwardTypes & (1 << awardType));
 
             // Check if award is deserved
-            if (award_is_deserved(awardType, activeAwardTypes))
+            if (award_is_deserved(awardType, activeAwardTypes, guestStatistics))
             {
                 // Add award
                 gCurrentAwards[freeAwardEntryIndex].Type = awardType;
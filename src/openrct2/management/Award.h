@@ -11,6 +11,8 @@
 
 #include "../common.h"
 
+struct ParkGuestStatistics;
+
 struct Award
 {
     uint16_t Time;
@@ -45,4 +47,4 @@ extern Award gCurrentAwards[MAX_AWARDS];
 
 bool award_is_positive(int32_t type);
 void award_reset();
-void award_update_all();
+void award_update_all(const ParkGuestStatistics& guestStatistics);
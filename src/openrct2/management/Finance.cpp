@@ -23,6 +23,9 @@
 #include "../windows/Intent.h"
 #include "../world/Park.h"
 
+#include <algorithm>
+#include <cstring>
+
 // Monthly research funding costs
 const money32 research_cost_table[RESEARCH_FUNDING_COUNT] = {
     MONEY(0, 00),   // No funding
@@ -314,20 +317,12 @@ void finance_shift_expenditure_table()
         gHistoricalProfit += sum;
     }
 
-    // Shift the table
-    for (size_t i = EXPENDITURE_TABLE_MONTH_COUNT - 1; i >= 1; i--)
-    {
-        for (size_t j = 0; j < static_cast<int32_t>(ExpenditureType::Count); j++)
-        {
-            gExpenditureTable[i][j] = gExpenditureTable[i - 1][j];
-        }
-    }
+    // Shift the table, the months are contiguous so this is a single move of all but the oldest month
+    std::memmove(
+        &gExpenditureTable[1], &gExpenditureTable[0], sizeof(gExpenditureTable[0]) * (EXPENDITURE_TABLE_MONTH_COUNT - 1));
 
     // Zero the beginning of the table, which is the new month
-    for (uint32_t i = 0; i < static_cast<int32_t>(ExpenditureType::Count); i++)
-    {
-        gExpenditureTable[0][i] = 0;
-    }
+    std::fill(std::begin(gExpenditureTable[0]), std::end(gExpenditureTable[0]), 0);
 
     window_invalidate_by_class(WC_FINANCES);
 }
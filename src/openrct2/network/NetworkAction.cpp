@@ -245,6 +245,7 @@ const std::array<NetworkAction, static_cast<size_t>(NetworkPermission::Count)> N
         "PERMISSION_TOGGLE_SCENERY_CLUSTER",
         {
             GameCommand::ToggleSceneryCluster,
+            GameCommand::ScatterSmallScenery,
         },
     },
     NetworkAction{
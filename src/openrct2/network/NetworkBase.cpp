@@ -31,13 +31,14 @@
 #include "network.h"
 
 #include <algorithm>
+#include <cinttypes>
 #include <iterator>
 #include <stdexcept>
 
 // This string specifies which version of network stream current build uses.
 // It is used for making sure only compatible builds get connected, even within
 // single OpenRCT2 version.
-#define NETWORK_STREAM_VERSION "3"
+#define NETWORK_STREAM_VERSION "11"
 #define NETWORK_STREAM_ID OPENRCT2_VERSION "-" NETWORK_STREAM_VERSION
 
 static Peep* _pickup_peep = nullptr;
@@ -133,6 +134,7 @@ NetworkBase::NetworkBase()
     client_command_handlers[NetworkCommand::ObjectsList] = &NetworkBase::Client_Handle_OBJECTS_LIST;
     client_command_handlers[NetworkCommand::Scripts] = &NetworkBase::Client_Handle_SCRIPTS;
     client_command_handlers[NetworkCommand::GameState] = &NetworkBase::Client_Handle_GAMESTATE;
+    client_command_handlers[NetworkCommand::GameActionBatch] = &NetworkBase::Client_Handle_GAME_ACTION_BATCH;
 
     server_command_handlers[NetworkCommand::Auth] = &NetworkBase::Server_Handle_AUTH;
     server_command_handlers[NetworkCommand::Chat] = &NetworkBase::Server_Handle_CHAT;
@@ -203,6 +205,7 @@ void NetworkBase::Close()
         player_list.clear();
         group_list.clear();
         _serverTickData.clear();
+        _pendingGameActions.clear();
         _pendingPlayerLists.clear();
         _pendingPlayerInfo.clear();
 
@@ -237,6 +240,7 @@ void NetworkBase::CloseConnection()
     {
         _listenSocket.reset();
         _advertiser.reset();
+        _metricsExporter.reset();
     }
 
     mode = NETWORK_MODE_NONE;
@@ -406,6 +410,12 @@ bool NetworkBase::BeginServer(uint16_t port, const std::string& address)
     listening_port = port;
     _serverState.gamestateSnapshotsEnabled = gConfigNetwork.desync_debugging;
     _advertiser = CreateServerAdvertiser(listening_port);
+    _disconnectedStats = {};
+    if (gConfigNetwork.metrics_port > 0)
+    {
+        _metricsExporter = CreateMetricsExporter(
+            gConfigNetwork.metrics_address, static_cast<uint16_t>(gConfigNetwork.metrics_port));
+    }
 
     game_load_scripts();
 
@@ -497,6 +507,7 @@ void NetworkBase::Flush()
     }
     else
     {
+        Server_Send_GAME_ACTIONS();
         for (auto& it : client_connection_list)
         {
             it->SendQueuedPackets();
@@ -506,13 +517,30 @@ void NetworkBase::Flush()
 
 void NetworkBase::UpdateServer()
 {
+    if (!_lastMapExport.packets.empty() && _lastMapExport.tick != gCurrentTicks)
+    {
+        // The export is outdated, don't hold on to it.
+        _lastMapExport = {};
+    }
+
+    std::vector<const ITcpSocket*> sockets;
+    sockets.reserve(client_connection_list.size());
+    for (auto& connection : client_connection_list)
+    {
+        sockets.push_back(connection->Socket.get());
+    }
+    auto readable = GetReadableSockets(sockets);
+
+    size_t connectionIndex = 0;
     for (auto& connection : client_connection_list)
     {
+        bool hasData = readable[connectionIndex++];
+
         // This can be called multiple times before the connection is removed.
         if (!connection->IsValid())
             continue;
 
-        if (!ProcessConnection(*connection))
+        if (!ProcessConnection(*connection, hasData))
         {
             connection->Disconnect();
         }
@@ -534,6 +562,11 @@ void NetworkBase::UpdateServer()
         _advertiser->Update();
     }
 
+    if (_metricsExporter != nullptr)
+    {
+        _metricsExporter->Update([this]() { return GetMetricsSample(); });
+    }
+
     std::unique_ptr<ITcpSocket> tcpSocket = _listenSocket->Accept();
     if (tcpSocket != nullptr)
     {
@@ -718,6 +751,12 @@ const char* NetworkBase::FormatChat(NetworkPlayer* fromplayer, const char* text)
 }
 
 void NetworkBase::SendPacketToClients(const NetworkPacket& packet, bool front, bool gameCmd)
+{
+    // Encode once, all connections share the same immutable buffer.
+    SendPacketToClients(packet.Encode(), front, gameCmd);
+}
+
+void NetworkBase::SendPacketToClients(const NetworkSharedPacket& encodedPacket, bool front, bool gameCmd)
 {
     for (auto& client_connection : client_connection_list)
     {
@@ -732,8 +771,7 @@ void NetworkBase::SendPacketToClients(const NetworkPacket& packet, bool front, b
                 continue;
             }
         }
-        auto packetCopy = packet;
-        client_connection->QueuePacket(std::move(packetCopy), front);
+        client_connection->QueuePacket(encodedPacket, front);
     }
 }
 
@@ -758,11 +796,20 @@ bool NetworkBase::CheckSRAND(uint32_t tick, uint32_t srand0)
 
     if (!storedTick.spriteHash.empty())
     {
-        rct_sprite_checksum checksum = sprite_checksum();
-        std::string clientSpriteHash = checksum.ToString();
+        auto checksums = entity_checksum_tree();
+        std::string clientSpriteHash = checksums.ToString();
         if (clientSpriteHash != storedTick.spriteHash)
         {
             log_info("Sprite hash mismatch, client = %s, server = %s", clientSpriteHash.c_str(), storedTick.spriteHash.c_str());
+            for (size_t i = 0; i < checksums.Buckets.size(); i++)
+            {
+                if (checksums.Buckets[i] != storedTick.spriteHashBuckets[i])
+                {
+                    log_info(
+                        "Sprite hash mismatch in sprites %u to %u", EntityChecksumTree::GetBucketFirstIndex(i),
+                        EntityChecksumTree::GetBucketFirstIndex(i + 1) - 1);
+                }
+            }
             return false;
         }
     }
@@ -1166,6 +1213,19 @@ void NetworkBase::AppendServerLog(const std::string& s)
 
 void NetworkBase::CloseServerLog()
 {
+    if (GetMode() == NETWORK_MODE_SERVER)
+    {
+        AppendServerLogStats("Traffic of all connected clients:", GetStats());
+
+        auto queueStats = GameActions::GetQueueStats();
+        char text[256];
+        snprintf(
+            text, sizeof(text), "Game actions processed: %" PRIu64 ", average wait: %" PRIu64 " ms, longest wait: %u ms",
+            queueStats.Processed, queueStats.Processed == 0 ? 0 : queueStats.TotalWaitTime / queueStats.Processed,
+            queueStats.MaxWaitTime);
+        AppendServerLog(text);
+    }
+
     // Log server stopped event
     char logMessage[256];
     if (GetMode() == NETWORK_MODE_CLIENT)
@@ -1318,6 +1378,23 @@ void NetworkBase::Client_Send_HEARTBEAT(NetworkConnection& connection) const
     connection.QueuePacket(std::move(packet));
 }
 
+static void AddStats(NetworkStats_t& stats, const NetworkStats_t& other)
+{
+    for (size_t n = 0; n < EnumValue(NetworkStatisticsGroup::Max); n++)
+    {
+        stats.bytesReceived[n] += other.bytesReceived[n];
+        stats.bytesSent[n] += other.bytesSent[n];
+    }
+    for (size_t n = 0; n < EnumValue(NetworkCommand::Max); n++)
+    {
+        const auto& commandStats = other.commands[n];
+        stats.commands[n].bytesReceived += commandStats.bytesReceived;
+        stats.commands[n].bytesSent += commandStats.bytesSent;
+        stats.commands[n].packetsReceived += commandStats.packetsReceived;
+        stats.commands[n].packetsSent += commandStats.packetsSent;
+    }
+}
+
 NetworkStats_t NetworkBase::GetStats() const
 {
     NetworkStats_t stats = {};
@@ -1329,16 +1406,45 @@ NetworkStats_t NetworkBase::GetStats() const
     {
         for (auto& connection : client_connection_list)
         {
-            for (size_t n = 0; n < EnumValue(NetworkStatisticsGroup::Max); n++)
-            {
-                stats.bytesReceived[n] += connection->Stats.bytesReceived[n];
-                stats.bytesSent[n] += connection->Stats.bytesSent[n];
-            }
+            AddStats(stats, connection->Stats);
         }
     }
     return stats;
 }
 
+NetworkMetricsSample NetworkBase::GetMetricsSample() const
+{
+    NetworkMetricsSample sample;
+    sample.Stats = GetStats();
+    AddStats(sample.Stats, _disconnectedStats);
+    sample.Players = player_list.size();
+    sample.Connections = client_connection_list.size();
+    for (auto& connection : client_connection_list)
+    {
+        sample.OutboundPackets += connection->GetOutboundPacketCount();
+    }
+    return sample;
+}
+
+void NetworkBase::AppendServerLogStats(const std::string& title, const NetworkStats_t& stats)
+{
+    AppendServerLog(title);
+    for (size_t n = 0; n < EnumValue(NetworkCommand::Max); n++)
+    {
+        const auto& commandStats = stats.commands[n];
+        const char* name = GetNetworkCommandName(static_cast<NetworkCommand>(n));
+        if (name == nullptr || (commandStats.packetsReceived == 0 && commandStats.packetsSent == 0))
+            continue;
+
+        char text[256];
+        snprintf(
+            text, sizeof(text), "  %s: received %" PRIu64 " packets (%" PRIu64 " bytes), sent %" PRIu64 " packets (%" PRIu64
+            " bytes)", name, commandStats.packetsReceived, commandStats.bytesReceived, commandStats.packetsSent,
+            commandStats.bytesSent);
+        AppendServerLog(text);
+    }
+}
+
 void NetworkBase::Server_Send_AUTH(NetworkConnection& connection)
 {
     uint8_t new_playerid = 0;
@@ -1375,26 +1481,44 @@ void NetworkBase::Server_Send_MAP(NetworkConnection* connection)
         objects = objManager.GetPackableObjects();
     }
 
-    auto header = save_for_network(objects);
-    if (header.empty())
+    // The game state only changes while a tick is processed, game actions received in between are queued for the next
+    // tick. Clients requesting the same objects within one tick can therefore share the exported map.
+    if (_lastMapExport.packets.empty() || _lastMapExport.tick != gCurrentTicks || _lastMapExport.objects != objects)
     {
-        if (connection)
+        _lastMapExport = {};
+
+        auto header = save_for_network(objects);
+        if (header.empty())
         {
-            connection->SetLastDisconnectReason(STR_MULTIPLAYER_CONNECTION_CLOSED);
-            connection->Disconnect();
+            if (connection)
+            {
+                connection->SetLastDisconnectReason(STR_MULTIPLAYER_CONNECTION_CLOSED);
+                connection->Disconnect();
+            }
+            return;
         }
-        return;
+        size_t chunksize = CHUNK_SIZE;
+        for (size_t i = 0; i < header.size(); i += chunksize)
+        {
+            size_t datasize = std::min(chunksize, header.size() - i);
+            NetworkPacket packet(NetworkCommand::Map);
+            packet << static_cast<uint32_t>(header.size()) << static_cast<uint32_t>(i);
+            packet.Write(&header[i], datasize);
+            _lastMapExport.packets.push_back(packet.Encode());
+        }
+        _lastMapExport.tick = gCurrentTicks;
+        _lastMapExport.objects = objects;
     }
-    size_t chunksize = CHUNK_SIZE;
-    for (size_t i = 0; i < header.size(); i += chunksize)
+    else
+    {
+        log_verbose("Reusing the map exported for another client this tick");
+    }
+
+    for (const auto& packet : _lastMapExport.packets)
     {
-        size_t datasize = std::min(chunksize, header.size() - i);
-        NetworkPacket packet(NetworkCommand::Map);
-        packet << static_cast<uint32_t>(header.size()) << static_cast<uint32_t>(i);
-        packet.Write(&header[i], datasize);
         if (connection)
         {
-            connection->QueuePacket(std::move(packet));
+            connection->QueuePacket(packet);
         }
         else
         {
@@ -1405,37 +1529,20 @@ void NetworkBase::Server_Send_MAP(NetworkConnection* connection)
 
 std::vector<uint8_t> NetworkBase::save_for_network(const std::vector<const ObjectRepositoryItem*>& objects) const
 {
-    std::vector<uint8_t> header;
-    bool RLEState = gUseRLE;
-    gUseRLE = false;
-
+    // The park file compresses its chunks itself, so the map is sent as is.
+    // Leave some room for the park to have grown since the last export, maps are easily several megabytes.
     auto ms = OpenRCT2::MemoryStream();
+    ms.Reserve(_lastMapSize + _lastMapSize / 8);
     if (!SaveMap(&ms, objects))
     {
         log_warning("Failed to export map.");
-        return header;
+        return {};
     }
-    gUseRLE = RLEState;
-
-    const void* data = ms.GetData();
-    int32_t size = ms.GetLength();
 
-    auto compressed = util_zlib_deflate(static_cast<const uint8_t*>(data), size);
-    if (compressed != std::nullopt)
-    {
-        std::string headerString = "open2_sv6_zlib";
-        header.resize(headerString.size() + 1 + compressed->size());
-        std::memcpy(&header[0], headerString.c_str(), headerString.size() + 1);
-        std::memcpy(&header[headerString.size() + 1], compressed->data(), compressed->size());
-        log_verbose("Sending map of size %u bytes, compressed to %u bytes", size, headerString.size() + 1 + compressed->size());
-    }
-    else
-    {
-        log_warning("Failed to compress the data, falling back to non-compressed sv6.");
-        header.resize(size);
-        std::memcpy(header.data(), data, size);
-    }
-    return header;
+    _lastMapSize = static_cast<size_t>(ms.GetLength());
+    const auto* data = static_cast<const uint8_t*>(ms.GetData());
+    log_verbose("Sending map of %u bytes", ms.GetLength());
+    return std::vector<uint8_t>(data, data + ms.GetLength());
 }
 
 void NetworkBase::Client_Send_CHAT(const char* text)
@@ -1491,14 +1598,53 @@ void NetworkBase::Client_Send_GAME_ACTION(const GameAction* action)
 
 void NetworkBase::Server_Send_GAME_ACTION(const GameAction* action)
 {
-    NetworkPacket packet(NetworkCommand::GameAction);
-
     DataSerialiser stream(true);
     action->Serialise(stream);
 
-    packet << gCurrentTicks << action->GetType() << stream;
+    // Relayed together with the other actions of the tick when the network gets flushed.
+    const auto& ms = stream.GetStream();
+    const auto* data = static_cast<const uint8_t*>(ms.GetData());
+    _pendingGameActions.push_back(
+        { gCurrentTicks, action->GetType(), std::vector<uint8_t>(data, data + ms.GetLength()) });
+}
 
-    SendPacketToClients(packet);
+void NetworkBase::Server_Send_GAME_ACTIONS()
+{
+    for (auto it = _pendingGameActions.begin(); it != _pendingGameActions.end();)
+    {
+        // Actions of the same tick share one packet, split when the packet would get too large.
+        auto batchEnd = it;
+        size_t batchSize = 0;
+        while (batchEnd != _pendingGameActions.end() && batchEnd->tick == it->tick)
+        {
+            size_t entrySize = sizeof(GameCommand) + sizeof(uint16_t) + batchEnd->data.size();
+            if (batchEnd != it && batchSize + entrySize > CHUNK_SIZE)
+                break;
+            batchSize += entrySize;
+            batchEnd++;
+        }
+
+        if (batchEnd - it == 1)
+        {
+            NetworkPacket packet(NetworkCommand::GameAction);
+            packet << it->tick << it->type;
+            packet.Write(it->data.data(), it->data.size());
+            SendPacketToClients(packet);
+        }
+        else
+        {
+            NetworkPacket packet(NetworkCommand::GameActionBatch);
+            packet << it->tick << static_cast<uint16_t>(batchEnd - it);
+            for (auto entry = it; entry != batchEnd; entry++)
+            {
+                packet << entry->type << static_cast<uint16_t>(entry->data.size());
+                packet.Write(entry->data.data(), entry->data.size());
+            }
+            SendPacketToClients(packet);
+        }
+        it = batchEnd;
+    }
+    _pendingGameActions.clear();
 }
 
 void NetworkBase::Server_Send_TICK()
@@ -1521,8 +1667,12 @@ void NetworkBase::Server_Send_TICK()
     packet << flags;
     if (flags & NETWORK_TICK_FLAG_CHECKSUMS)
     {
-        rct_sprite_checksum checksum = sprite_checksum();
-        packet.WriteString(checksum.ToString().c_str());
+        auto checksums = entity_checksum_tree();
+        packet.WriteString(checksums.ToString().c_str());
+        for (auto bucket : checksums.Buckets)
+        {
+            packet << bucket;
+        }
     }
 
     SendPacketToClients(packet);
@@ -1655,15 +1805,13 @@ void NetworkBase::Server_Send_EVENT_PLAYER_DISCONNECTED(const char* playerName,
     SendPacketToClients(packet);
 }
 
-bool NetworkBase::ProcessConnection(NetworkConnection& connection)
+bool NetworkBase::ProcessConnection(NetworkConnection& connection, bool hasData)
 {
-    NetworkReadPacket packetStatus;
-
     uint32_t countProcessed = 0;
-    do
+    while (hasData)
     {
         countProcessed++;
-        packetStatus = connection.ReadPacket();
+        auto packetStatus = connection.ReadPacket();
         switch (packetStatus)
         {
             case NetworkReadPacket::Disconnected:
@@ -1688,7 +1836,8 @@ bool NetworkBase::ProcessConnection(NetworkConnection& connection)
                 // could not read anything from socket
                 break;
         }
-    } while (packetStatus == NetworkReadPacket::Success && countProcessed < MaxPacketsPerUpdate);
+        hasData = packetStatus == NetworkReadPacket::Success && countProcessed < MaxPacketsPerUpdate;
+    }
 
     if (!connection.ReceivedPacketRecently())
     {
@@ -1939,6 +2088,10 @@ void NetworkBase::ProcessDisconnectedClients()
         connection->SendQueuedPackets();
         connection->Socket->Disconnect();
 
+        AppendServerLogStats(
+            std::string("Traffic of connection from ") + connection->Socket->GetHostName() + ":", connection->Stats);
+        AddStats(_disconnectedStats, connection->Stats);
+
         ServerClientDisconnected(connection);
         RemovePlayer(connection);
 
@@ -2189,7 +2342,8 @@ void NetworkBase::Server_Handle_REQUEST_GAMESTATE(NetworkConnection& connection,
     const GameStateSnapshot_t* snapshot = snapshots->GetLinkedSnapshot(tick);
     if (snapshot)
     {
-        MemoryStream snapshotMemory;
+        auto& snapshotMemory = _gameStateSnapshotStream;
+        snapshotMemory.Clear();
         DataSerialiser ds(true, snapshotMemory);
 
         snapshots->SerialiseSnapshot(const_cast<GameStateSnapshot_t&>(*snapshot), ds);
@@ -2407,8 +2561,8 @@ void NetworkBase::Client_Handle_GAMESTATE(NetworkConnection& connection, Network
 
     if (offset == 0)
     {
-        // Reset
-        _serverGameState = MemoryStream();
+        // Reset, keeping the buffer of the previous game state.
+        _serverGameState.Clear();
     }
 
     _serverGameState.SetPosition(offset);
@@ -2675,29 +2829,8 @@ void NetworkBase::Client_Handle_MAP([[maybe_unused]] NetworkConnection& connecti
         GameActions::ResumeQueue();
 
         context_force_close_window_by_class(WC_NETWORK_STATUS);
-        bool has_to_free = false;
-        uint8_t* data = &chunk_buffer[0];
-        size_t data_size = size;
-        // zlib-compressed
-        if (strcmp("open2_sv6_zlib", reinterpret_cast<char*>(&chunk_buffer[0])) == 0)
-        {
-            log_verbose("Received zlib-compressed sv6 map");
-            has_to_free = true;
-            size_t header_len = strlen("open2_sv6_zlib") + 1;
-            data = util_zlib_inflate(&chunk_buffer[header_len], size - header_len, &data_size);
-            if (data == nullptr)
-            {
-                log_warning("Failed to decompress data sent from server.");
-                Close();
-                return;
-            }
-        }
-        else
-        {
-            log_verbose("Assuming received map is in plain sv6 format");
-        }
 
-        auto ms = MemoryStream(data, data_size);
+        auto ms = MemoryStream(chunk_buffer.data(), size);
         if (LoadMap(&ms))
         {
             game_load_init();
@@ -2725,10 +2858,6 @@ void NetworkBase::Client_Handle_MAP([[maybe_unused]] NetworkConnection& connecti
             auto loadOrQuitAction = LoadOrQuitAction(LoadOrQuitModes::OpenSavePrompt, PromptMode::SaveBeforeQuit);
             GameActions::Execute(&loadOrQuitAction);
         }
-        if (has_to_free)
-        {
-            free(data);
-        }
     }
 }
 
@@ -2747,9 +2876,6 @@ bool NetworkBase::LoadMap(IStream* stream)
         EntityTweener::Get().Reset();
         AutoCreateMapAnimations();
 
-        // Read checksum
-        [[maybe_unused]] uint32_t checksum = stream->ReadValue<uint32_t>();
-
         // Read other data not in normal save files
         gGamePaused = stream->ReadValue<uint32_t>();
         _guestGenerationProbability = stream->ReadValue<uint32_t>();
@@ -2797,7 +2923,7 @@ bool NetworkBase::SaveMap(IStream* stream, const std::vector<const ObjectReposit
         auto s6exporter = std::make_unique<S6Exporter>();
         s6exporter->ExportObjectsList = objects;
         s6exporter->Export();
-        s6exporter->SaveGame(stream);
+        s6exporter->SaveParkFile(stream);
 
         // Write other data not in normal save files
         stream->WriteValue<uint32_t>(gGamePaused);
@@ -2917,11 +3043,41 @@ void NetworkBase::Client_Handle_GAME_ACTION([[maybe_unused]] NetworkConnection&
     GameCommand actionType;
     packet >> tick >> actionType;
 
-    MemoryStream stream;
     const size_t size = packet.Header.Size - packet.BytesRead;
-    stream.WriteArray(packet.Read(size), size);
-    stream.SetPosition(0);
+    const uint8_t* data = packet.Read(size);
+    if (data == nullptr)
+    {
+        return;
+    }
+    Client_EnqueueGameAction(tick, actionType, data, size);
+}
+
+void NetworkBase::Client_Handle_GAME_ACTION_BATCH([[maybe_unused]] NetworkConnection& connection, NetworkPacket& packet)
+{
+    uint32_t tick;
+    uint16_t count;
+    packet >> tick >> count;
+
+    for (uint16_t i = 0; i < count; i++)
+    {
+        GameCommand actionType;
+        uint16_t size;
+        packet >> actionType >> size;
 
+        const uint8_t* data = packet.Read(size);
+        if (data == nullptr)
+        {
+            log_error("Received truncated game action batch.");
+            return;
+        }
+        Client_EnqueueGameAction(tick, actionType, data, size);
+    }
+}
+
+void NetworkBase::Client_EnqueueGameAction(uint32_t tick, GameCommand actionType, const uint8_t* data, size_t size)
+{
+    // Deserialise straight from the packet buffer.
+    MemoryStream stream(data, size);
     DataSerialiser ds(false, stream);
 
     GameAction::Ptr action = GameActions::Create(actionType);
@@ -2975,6 +3131,13 @@ void NetworkBase::Server_Handle_GAME_ACTION(NetworkConnection& connection, Netwo
             Server_Send_SHOWERROR(connection, STR_CANT_DO_THIS, STR_PERMISSION_DENIED);
             return;
         }
+
+        // Scattering scenery places it as well, which is a separate permission
+        if (actionType == GameCommand::ScatterSmallScenery && group->CanPerformCommand(GameCommand::PlaceScenery) == false)
+        {
+            Server_Send_SHOWERROR(connection, STR_CANT_DO_THIS, STR_PERMISSION_DENIED);
+            return;
+        }
     }
 
     // Create and enqueue the action.
@@ -3007,10 +3170,15 @@ void NetworkBase::Server_Handle_GAME_ACTION(NetworkConnection& connection, Netwo
         }
     }
 
-    DataSerialiser stream(false);
+    // Deserialise straight from the packet buffer.
     const size_t size = packet.Header.Size - packet.BytesRead;
-    stream.GetStream().WriteArray(packet.Read(size), size);
-    stream.GetStream().SetPosition(0);
+    const uint8_t* data = packet.Read(size);
+    if (data == nullptr)
+    {
+        return;
+    }
+    MemoryStream packetStream(data, size);
+    DataSerialiser stream(false, packetStream);
 
     ga->Serialise(stream);
     // Set player to sender, should be 0 if sent from client.
@@ -3038,6 +3206,10 @@ void NetworkBase::Client_Handle_TICK([[maybe_unused]] NetworkConnection& connect
         {
             tickData.spriteHash = text;
         }
+        for (auto& bucket : tickData.spriteHashBuckets)
+        {
+            packet >> bucket;
+        }
     }
 
     // Don't let the history grow too much.
@@ -1,8 +1,10 @@
 #pragma once
 
 #include "../actions/GameAction.h"
+#include "../world/Sprite.h"
 #include "NetworkConnection.h"
 #include "NetworkGroup.h"
+#include "NetworkMetricsExporter.h"
 #include "NetworkPlayer.h"
 #include "NetworkServerAdvertiser.h"
 #include "NetworkTypes.h"
@@ -42,8 +44,9 @@ public: // Common
     void AppendChatLog(const std::string& s);
     void CloseChatLog();
     NetworkStats_t GetStats() const;
+    NetworkMetricsSample GetMetricsSample() const;
     json_t GetServerInfoAsJson() const;
-    bool ProcessConnection(NetworkConnection& connection);
+    bool ProcessConnection(NetworkConnection& connection, bool hasData = true);
     void CloseConnection();
     NetworkPlayer* AddPlayer(const std::string& name, const std::string& keyhash);
     void ProcessPacket(NetworkConnection& connection, NetworkPacket& packet);
@@ -59,6 +62,7 @@ public: // Server
     uint8_t GetGroupIDByHash(const std::string& keyhash);
     void BeginServerLog();
     void AppendServerLog(const std::string& s);
+    void AppendServerLogStats(const std::string& title, const NetworkStats_t& stats);
     void CloseServerLog();
     void DecayCooldown(NetworkPlayer* player);
     void AddClient(std::unique_ptr<ITcpSocket>&& socket);
@@ -78,6 +82,7 @@ public: // Server
     void Server_Send_MAP(NetworkConnection* connection = nullptr);
     void Server_Send_CHAT(const char* text, const std::vector<uint8_t>& playerIds = {});
     void Server_Send_GAME_ACTION(const GameAction* action);
+    void Server_Send_GAME_ACTIONS();
     void Server_Send_TICK();
     void Server_Send_PLAYERINFO(int32_t playerId);
     void Server_Send_PLAYERLIST();
@@ -114,6 +119,7 @@ public: // Client
     void ProcessDisconnectedClients();
     static const char* FormatChat(NetworkPlayer* fromplayer, const char* text);
     void SendPacketToClients(const NetworkPacket& packet, bool front = false, bool gameCmd = false);
+    void SendPacketToClients(const NetworkSharedPacket& packet, bool front = false, bool gameCmd = false);
     bool CheckSRAND(uint32_t tick, uint32_t srand0);
     bool CheckDesynchronizaton();
     void RequestStateSnapshot();
@@ -140,6 +146,8 @@ public: // Client
     void Client_Handle_MAP(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_CHAT(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_GAME_ACTION(NetworkConnection& connection, NetworkPacket& packet);
+    void Client_Handle_GAME_ACTION_BATCH(NetworkConnection& connection, NetworkPacket& packet);
+    void Client_EnqueueGameAction(uint32_t tick, GameCommand actionType, const uint8_t* data, size_t size);
     void Client_Handle_TICK(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_PLAYERINFO(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_PLAYERLIST(NetworkConnection& connection, NetworkPacket& packet);
@@ -185,15 +193,38 @@ private: // Common Data
     bool wsa_initialized = false;
 
 private: // Server Data
+    struct PendingGameAction
+    {
+        uint32_t tick = 0;
+        GameCommand type{};
+        std::vector<uint8_t> data;
+    };
+
+    struct MapExport
+    {
+        uint32_t tick = 0;
+        std::vector<const ObjectRepositoryItem*> objects;
+        std::vector<NetworkSharedPacket> packets;
+    };
+
     std::unordered_map<NetworkCommand, CommandHandler> server_command_handlers;
     std::unique_ptr<ITcpSocket> _listenSocket;
     std::unique_ptr<INetworkServerAdvertiser> _advertiser;
+    std::unique_ptr<INetworkMetricsExporter> _metricsExporter;
+    // Traffic of the clients that have left, so the exported counters never go back.
+    NetworkStats_t _disconnectedStats = {};
     std::list<std::unique_ptr<NetworkConnection>> client_connection_list;
     std::string _serverLogPath;
     std::string _serverLogFilenameFormat = "%Y%m%d-%H%M%S.txt";
     std::ofstream _server_log_fs;
     uint16_t listening_port = 0;
     bool _playerListInvalidated = false;
+    MapExport _lastMapExport;
+    // Size of the last exported map, used to size the buffer of the next export up front.
+    mutable size_t _lastMapSize = 0;
+    // Reused for every game state snapshot requested by a client.
+    OpenRCT2::MemoryStream _gameStateSnapshotStream;
+    std::vector<PendingGameAction> _pendingGameActions;
 
 private: // Client Data
     struct PlayerListUpdate
@@ -206,6 +237,7 @@ private: // Client Data
         uint32_t srand0;
         uint32_t tick;
         std::string spriteHash;
+        std::array<uint64_t, EntityChecksumTree::BucketCount> spriteHashBuckets{};
     };
 
     std::unordered_map<NetworkCommand, CommandHandler> client_command_handlers;
@@ -69,28 +69,29 @@ NetworkReadPacket NetworkConnection::ReadPacket()
     // Read packet body.
     {
         // NOTE: BytesTransfered includes the header length, this will not underflow.
-        const size_t missingLength = header.Size - (InboundPacket.BytesTransferred - sizeof(header));
-
-        uint8_t buffer[NetworkBufferSize];
+        const size_t bodyBytesRead = InboundPacket.BytesTransferred - sizeof(header);
+        const size_t missingLength = header.Size - bodyBytesRead;
 
         if (missingLength > 0)
         {
-            NetworkReadPacket status = Socket->ReceiveData(buffer, std::min(missingLength, NetworkBufferSize), &bytesRead);
+            // Receive straight into the packet, its buffer keeps its capacity between packets.
+            InboundPacket.Data.resize(header.Size);
+            NetworkReadPacket status = Socket->ReceiveData(
+                InboundPacket.Data.data() + bodyBytesRead, std::min(missingLength, NetworkBufferSize), &bytesRead);
             if (status != NetworkReadPacket::Success)
             {
                 return status;
             }
 
             InboundPacket.BytesTransferred += bytesRead;
-            InboundPacket.Write(buffer, bytesRead);
         }
 
-        if (InboundPacket.Data.size() == header.Size)
+        if (InboundPacket.BytesTransferred - sizeof(header) == header.Size)
         {
             // Received complete packet.
             _lastPacketTime = platform_get_ticks();
 
-            RecordPacketStats(InboundPacket, false);
+            RecordPacketStats(InboundPacket.GetCommand(), InboundPacket.BytesTransferred, false);
 
             return NetworkReadPacket::Success;
         }
@@ -99,22 +100,9 @@ NetworkReadPacket NetworkConnection::ReadPacket()
     return NetworkReadPacket::MoreData;
 }
 
-bool NetworkConnection::SendPacket(NetworkPacket& packet)
+bool NetworkConnection::SendPacket(OutboundPacket& packet)
 {
-    auto header = packet.Header;
-
-    std::vector<uint8_t> buffer;
-    buffer.reserve(sizeof(header) + header.Size);
-
-    // NOTE: For compatibility reasons for the master server we need to add sizeof(Header.Id) to the size.
-    // Previously the Id field was not part of the header rather part of the body.
-    header.Size += sizeof(header.Id);
-    header.Size = Convert::HostToNetwork(header.Size);
-    header.Id = ByteSwapBE(header.Id);
-
-    buffer.insert(buffer.end(), reinterpret_cast<uint8_t*>(&header), reinterpret_cast<uint8_t*>(&header) + sizeof(header));
-    buffer.insert(buffer.end(), packet.Data.begin(), packet.Data.end());
-
+    const auto& buffer = packet.Packet->Buffer;
     size_t bufferSize = buffer.size() - packet.BytesTransferred;
     size_t sent = Socket->SendData(buffer.data() + packet.BytesTransferred, bufferSize);
     if (sent > 0)
@@ -125,16 +113,23 @@ bool NetworkConnection::SendPacket(NetworkPacket& packet)
     bool sendComplete = packet.BytesTransferred == buffer.size();
     if (sendComplete)
     {
-        RecordPacketStats(packet, true);
+        RecordPacketStats(packet.Packet->Id, packet.BytesTransferred, true);
     }
     return sendComplete;
 }
 
-void NetworkConnection::QueuePacket(NetworkPacket&& packet, bool front)
+void NetworkConnection::QueuePacket(const NetworkPacket& packet, bool front)
 {
     if (AuthStatus == NetworkAuth::Ok || !packet.CommandRequiresAuth())
     {
-        packet.Header.Size = static_cast<uint16_t>(packet.Data.size());
+        QueuePacket(packet.Encode(), front);
+    }
+}
+
+void NetworkConnection::QueuePacket(const NetworkSharedPacket& packet, bool front)
+{
+    if (AuthStatus == NetworkAuth::Ok || !packet->RequiresAuth)
+    {
         if (front)
         {
             // If the first packet was already partially sent add new packet to second position
@@ -142,16 +137,16 @@ void NetworkConnection::QueuePacket(NetworkPacket&& packet, bool front)
             {
                 auto it = _outboundPackets.begin();
                 it++; // Second position
-                _outboundPackets.insert(it, std::move(packet));
+                _outboundPackets.insert(it, { packet });
             }
             else
             {
-                _outboundPackets.push_front(std::move(packet));
+                _outboundPackets.push_front({ packet });
             }
         }
         else
         {
-            _outboundPackets.push_back(std::move(packet));
+            _outboundPackets.push_back({ packet });
         }
     }
 }
@@ -174,6 +169,11 @@ void NetworkConnection::SendQueuedPackets()
     }
 }
 
+size_t NetworkConnection::GetOutboundPacketCount() const
+{
+    return _outboundPackets.size();
+}
+
 void NetworkConnection::ResetLastPacketTime()
 {
     _lastPacketTime = platform_get_ticks();
@@ -218,14 +218,15 @@ void NetworkConnection::SetLastDisconnectReason(const rct_string_id string_id, v
     SetLastDisconnectReason(buffer);
 }
 
-void NetworkConnection::RecordPacketStats(const NetworkPacket& packet, bool sending)
+void NetworkConnection::RecordPacketStats(NetworkCommand command, size_t size, bool sending)
 {
-    uint32_t packetSize = static_cast<uint32_t>(packet.BytesTransferred);
+    uint32_t packetSize = static_cast<uint32_t>(size);
     NetworkStatisticsGroup trafficGroup;
 
-    switch (packet.GetCommand())
+    switch (command)
     {
         case NetworkCommand::GameAction:
+        case NetworkCommand::GameActionBatch:
             trafficGroup = NetworkStatisticsGroup::Commands;
             break;
         case NetworkCommand::Map:
@@ -236,15 +237,26 @@ void NetworkConnection::RecordPacketStats(const NetworkPacket& packet, bool send
             break;
     }
 
+    auto* commandStats = command < NetworkCommand::Max ? &Stats.commands[EnumValue(command)] : nullptr;
     if (sending)
     {
         Stats.bytesSent[EnumValue(trafficGroup)] += packetSize;
         Stats.bytesSent[EnumValue(NetworkStatisticsGroup::Total)] += packetSize;
+        if (commandStats != nullptr)
+        {
+            commandStats->bytesSent += packetSize;
+            commandStats->packetsSent++;
+        }
     }
     else
     {
         Stats.bytesReceived[EnumValue(trafficGroup)] += packetSize;
         Stats.bytesReceived[EnumValue(NetworkStatisticsGroup::Total)] += packetSize;
+        if (commandStats != nullptr)
+        {
+            commandStats->bytesReceived += packetSize;
+            commandStats->packetsReceived++;
+        }
     }
 }
 
@@ -0,0 +1,358 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "NetworkMetricsExporter.h"
+
+#include <array>
+#include <cstdint>
+
+using namespace OpenRCT2;
+
+// Upper bounds of the tick duration buckets in seconds, a tick is due every 25 ms.
+static constexpr std::array<double, 10> TickDurationBuckets = {
+    0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1.0,
+};
+
+// The last bucket counts the ticks longer than all bounds.
+static std::array<uint64_t, TickDurationBuckets.size() + 1> _tickDurationHistogram;
+static uint64_t _tickDurationSum;
+
+void NetworkMetrics::RecordTickDuration(Profiling::Timestamp duration)
+{
+    _tickDurationSum += duration;
+
+    auto seconds = duration / 1000000000.0;
+    size_t bucket = 0;
+    while (bucket < TickDurationBuckets.size() && seconds > TickDurationBuckets[bucket])
+    {
+        bucket++;
+    }
+    _tickDurationHistogram[bucket]++;
+}
+
+#ifndef DISABLE_NETWORK
+
+#    include "../Game.h"
+#    include "../MemoryReport.h"
+#    include "../actions/GameAction.h"
+#    include "../core/Console.hpp"
+#    include "../core/String.hpp"
+#    include "../peep/Peep.h"
+#    include "../platform/platform.h"
+#    include "../world/EntityList.h"
+#    include "NetworkPacket.h"
+#    include "Socket.h"
+
+#    include <algorithm>
+#    include <cinttypes>
+#    include <cstdarg>
+#    include <cstdio>
+#    include <iterator>
+#    include <vector>
+
+// Scrapers send a few hundred bytes, anything much larger is not a scrape.
+static constexpr size_t MaxRequestSize = 8192;
+static constexpr size_t MaxClients = 8;
+static constexpr uint32_t ClientTimeout = 5000;
+
+static constexpr const char* EntityTypeNames[] = {
+    "vehicle",
+    "guest",
+    "staff",
+    "litter",
+    "steam_particle",
+    "money_effect",
+    "crashed_vehicle_particle",
+    "explosion_cloud",
+    "crash_splash",
+    "explosion_flare",
+    "jumping_fountain",
+    "balloon",
+    "duck",
+};
+static_assert(std::size(EntityTypeNames) == EnumValue(EntityType::Count));
+
+static void AppendFormat(std::string& output, const char* format, ...)
+{
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    output += buffer;
+}
+
+static void AppendHeader(std::string& output, const char* name, const char* type, const char* help)
+{
+    AppendFormat(output, "# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+}
+
+static void AppendTickMetrics(std::string& output)
+{
+    AppendHeader(output, "openrct2_tick_duration_seconds", "histogram", "Time spent updating the game state per tick.");
+    uint64_t count = 0;
+    for (size_t i = 0; i < TickDurationBuckets.size(); i++)
+    {
+        count += _tickDurationHistogram[i];
+        AppendFormat(
+            output, "openrct2_tick_duration_seconds_bucket{le=\"%g\"} %" PRIu64 "\n", TickDurationBuckets[i], count);
+    }
+    count += _tickDurationHistogram.back();
+    AppendFormat(output, "openrct2_tick_duration_seconds_bucket{le=\"+Inf\"} %" PRIu64 "\n", count);
+    AppendFormat(output, "openrct2_tick_duration_seconds_sum %.9f\n", _tickDurationSum / 1000000000.0);
+    AppendFormat(output, "openrct2_tick_duration_seconds_count %" PRIu64 "\n", count);
+
+    AppendHeader(output, "openrct2_ticks", "gauge", "Current game tick.");
+    AppendFormat(output, "openrct2_ticks %" PRIu32 "\n", gCurrentTicks);
+}
+
+static void AppendParkMetrics(std::string& output)
+{
+    AppendHeader(output, "openrct2_entities", "gauge", "Number of entities by type.");
+    for (size_t i = 0; i < std::size(EntityTypeNames); i++)
+    {
+        AppendFormat(
+            output, "openrct2_entities{type=\"%s\"} %u\n", EntityTypeNames[i],
+            GetEntityListCount(static_cast<EntityType>(i)));
+    }
+
+    AppendHeader(output, "openrct2_guests_in_park", "gauge", "Number of guests inside the park.");
+    AppendFormat(output, "openrct2_guests_in_park %" PRIu32 "\n", gNumGuestsInPark);
+}
+
+static void AppendNetworkMetrics(std::string& output, const NetworkMetricsSample& sample)
+{
+    AppendHeader(output, "openrct2_players", "gauge", "Number of players, including the server.");
+    AppendFormat(output, "openrct2_players %zu\n", sample.Players);
+    AppendHeader(output, "openrct2_connections", "gauge", "Number of client connections.");
+    AppendFormat(output, "openrct2_connections %zu\n", sample.Connections);
+    AppendHeader(output, "openrct2_outbound_packets", "gauge", "Number of packets waiting to be sent to clients.");
+    AppendFormat(output, "openrct2_outbound_packets %zu\n", sample.OutboundPackets);
+
+    AppendHeader(output, "openrct2_network_bytes_total", "counter", "Bytes transferred by network command.");
+    for (size_t i = 0; i < EnumValue(NetworkCommand::Max); i++)
+    {
+        const auto* name = GetNetworkCommandName(static_cast<NetworkCommand>(i));
+        if (name == nullptr)
+            continue;
+
+        const auto& commandStats = sample.Stats.commands[i];
+        AppendFormat(
+            output, "openrct2_network_bytes_total{command=\"%s\",direction=\"received\"} %" PRIu64 "\n", name,
+            commandStats.bytesReceived);
+        AppendFormat(
+            output, "openrct2_network_bytes_total{command=\"%s\",direction=\"sent\"} %" PRIu64 "\n", name,
+            commandStats.bytesSent);
+    }
+
+    AppendHeader(output, "openrct2_network_packets_total", "counter", "Packets transferred by network command.");
+    for (size_t i = 0; i < EnumValue(NetworkCommand::Max); i++)
+    {
+        const auto* name = GetNetworkCommandName(static_cast<NetworkCommand>(i));
+        if (name == nullptr)
+            continue;
+
+        const auto& commandStats = sample.Stats.commands[i];
+        AppendFormat(
+            output, "openrct2_network_packets_total{command=\"%s\",direction=\"received\"} %" PRIu64 "\n", name,
+            commandStats.packetsReceived);
+        AppendFormat(
+            output, "openrct2_network_packets_total{command=\"%s\",direction=\"sent\"} %" PRIu64 "\n", name,
+            commandStats.packetsSent);
+    }
+}
+
+static void AppendGameActionMetrics(std::string& output)
+{
+    auto queueStats = GameActions::GetQueueStats();
+
+    AppendHeader(output, "openrct2_game_action_queue_depth", "gauge", "Number of game actions waiting for their tick.");
+    AppendFormat(output, "openrct2_game_action_queue_depth %zu\n", queueStats.Depth);
+
+    // Bucket i of the queue histogram counts the waits below 2^i ms, the last one all longer waits.
+    AppendHeader(
+        output, "openrct2_game_action_queue_wait_seconds", "histogram", "Time game actions waited in the queue.");
+    uint64_t count = 0;
+    for (size_t i = 0; i < queueStats.WaitHistogram.size() - 1; i++)
+    {
+        count += queueStats.WaitHistogram[i];
+        AppendFormat(
+            output, "openrct2_game_action_queue_wait_seconds_bucket{le=\"%g\"} %" PRIu64 "\n", (1U << i) / 1000.0,
+            count);
+    }
+    count += queueStats.WaitHistogram.back();
+    AppendFormat(output, "openrct2_game_action_queue_wait_seconds_bucket{le=\"+Inf\"} %" PRIu64 "\n", count);
+    AppendFormat(output, "openrct2_game_action_queue_wait_seconds_sum %.3f\n", queueStats.TotalWaitTime / 1000.0);
+    AppendFormat(output, "openrct2_game_action_queue_wait_seconds_count %" PRIu64 "\n", queueStats.Processed);
+}
+
+static void AppendMemoryMetrics(std::string& output)
+{
+    AppendHeader(output, "openrct2_memory_bytes", "gauge", "Bytes held by each subsystem.");
+    for (const auto& entry : GetMemoryReport())
+    {
+        AppendFormat(
+            output, "openrct2_memory_bytes{category=\"%s\"} %zu\n", MemoryAccounting::GetCategoryName(entry.Category),
+            entry.Bytes);
+    }
+}
+
+static std::string FormatMetrics(const NetworkMetricsSample& sample)
+{
+    std::string output;
+    AppendTickMetrics(output);
+    AppendParkMetrics(output);
+    AppendNetworkMetrics(output, sample);
+    AppendGameActionMetrics(output);
+    AppendMemoryMetrics(output);
+    return output;
+}
+
+static std::string FormatResponse(const char* status, const char* contentType, const std::string& body)
+{
+    std::string response;
+    AppendFormat(
+        response, "HTTP/1.1 %s\r\nContent-Type: %s\r\nContent-Length: %zu\r\nConnection: close\r\n\r\n", status,
+        contentType, body.size());
+    response += body;
+    return response;
+}
+
+class NetworkMetricsExporter final : public INetworkMetricsExporter
+{
+private:
+    struct Client
+    {
+        std::unique_ptr<ITcpSocket> Socket;
+        std::string Request;
+        std::string Response;
+        size_t BytesSent{};
+        uint32_t ConnectTime{};
+        bool Done{};
+    };
+
+    std::unique_ptr<ITcpSocket> _listenSocket;
+    std::vector<Client> _clients;
+
+public:
+    NetworkMetricsExporter(const std::string& address, uint16_t port)
+    {
+        _listenSocket = CreateTcpSocket();
+        try
+        {
+            _listenSocket->Listen(address, port);
+            auto* szAddress = address.empty() ? "*" : address.c_str();
+            Console::WriteLine("Serving metrics on http://%s:%hu/metrics", szAddress, port);
+        }
+        catch (const std::exception& ex)
+        {
+            Console::Error::WriteLine("Unable to serve metrics: %s", ex.what());
+            _listenSocket.reset();
+        }
+    }
+
+    void Update(const std::function<NetworkMetricsSample()>& sampler) override
+    {
+        if (_listenSocket == nullptr)
+            return;
+
+        while (_clients.size() < MaxClients)
+        {
+            auto socket = _listenSocket->Accept();
+            if (socket == nullptr)
+                break;
+
+            Client client;
+            client.Socket = std::move(socket);
+            client.ConnectTime = platform_get_ticks();
+            _clients.push_back(std::move(client));
+        }
+
+        auto now = platform_get_ticks();
+        for (auto& client : _clients)
+        {
+            if (client.Response.empty())
+            {
+                ReadRequest(client, sampler);
+            }
+            if (!client.Response.empty())
+            {
+                WriteResponse(client);
+            }
+            if (now - client.ConnectTime > ClientTimeout)
+            {
+                client.Done = true;
+            }
+        }
+
+        _clients.erase(
+            std::remove_if(_clients.begin(), _clients.end(), [](const Client& client) { return client.Done; }),
+            _clients.end());
+    }
+
+private:
+    static void ReadRequest(Client& client, const std::function<NetworkMetricsSample()>& sampler)
+    {
+        char buffer[1024];
+        size_t bytesRead = 0;
+        auto result = client.Socket->ReceiveData(buffer, sizeof(buffer), &bytesRead);
+        if (result == NetworkReadPacket::Disconnected)
+        {
+            client.Done = true;
+            return;
+        }
+        client.Request.append(buffer, bytesRead);
+
+        // Only the request line matters, the headers are skipped once they are complete.
+        if (client.Request.find("\r\n\r\n") == std::string::npos)
+        {
+            if (client.Request.size() > MaxRequestSize)
+            {
+                client.Response = FormatResponse("413 Payload Too Large", "text/plain", "Request too large\n");
+            }
+            return;
+        }
+
+        if (String::StartsWith(client.Request, "GET /metrics ") || String::StartsWith(client.Request, "GET /metrics?"))
+        {
+            client.Response = FormatResponse(
+                "200 OK", "text/plain; version=0.0.4; charset=utf-8", FormatMetrics(sampler()));
+        }
+        else
+        {
+            client.Response = FormatResponse("404 Not Found", "text/plain", "Not found\n");
+        }
+    }
+
+    static void WriteResponse(Client& client)
+    {
+        try
+        {
+            client.BytesSent += client.Socket->SendData(
+                client.Response.data() + client.BytesSent, client.Response.size() - client.BytesSent);
+        }
+        catch (const std::exception&)
+        {
+            client.Done = true;
+            return;
+        }
+        if (client.BytesSent >= client.Response.size())
+        {
+            client.Socket->Disconnect();
+            client.Done = true;
+        }
+    }
+};
+
+std::unique_ptr<INetworkMetricsExporter> CreateMetricsExporter(const std::string& address, uint16_t port)
+{
+    return std::make_unique<NetworkMetricsExporter>(address, port);
+}
+
+#endif // DISABLE_NETWORK
@@ -0,0 +1,76 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "../core/Profiling.h"
+#include "NetworkTypes.h"
+
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace OpenRCT2::NetworkMetrics
+{
+    /**
+     * Adds the duration of a game tick to the tick duration histogram, only touched on the game thread.
+     */
+    void RecordTickDuration(Profiling::Timestamp duration);
+
+    /**
+     * Records the duration of the tick that runs during the lifetime of the object.
+     */
+    class ScopedTick
+    {
+    private:
+        Profiling::Timestamp _start;
+
+    public:
+        ScopedTick()
+            : _start(Profiling::GetTimestamp())
+        {
+        }
+        ScopedTick(const ScopedTick&) = delete;
+        ~ScopedTick()
+        {
+            RecordTickDuration(Profiling::GetTimestamp() - _start);
+        }
+    };
+} // namespace OpenRCT2::NetworkMetrics
+
+/**
+ * Everything the exporter can not gather by itself, filled in by the server when a scrape comes in.
+ */
+struct NetworkMetricsSample
+{
+    // Traffic since the server was started, including the clients that have left.
+    NetworkStats_t Stats{};
+    size_t Players{};
+    size_t Connections{};
+    size_t OutboundPackets{};
+};
+
+/**
+ * Serves the health of a server in the Prometheus text format on http://<address>:<port>/metrics, so a fleet of
+ * dedicated servers can be scraped into dashboards.
+ */
+struct INetworkMetricsExporter
+{
+    virtual ~INetworkMetricsExporter()
+    {
+    }
+
+    /**
+     * Answers pending scrapes, the sampler is only called when there is one to answer.
+     */
+    virtual void Update(const std::function<NetworkMetricsSample()>& sampler) abstract;
+};
+
+std::unique_ptr<INetworkMetricsExporter> CreateMetricsExporter(const std::string& address, uint16_t port);
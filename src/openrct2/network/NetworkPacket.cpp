@@ -11,10 +11,65 @@
 
 #    include "NetworkPacket.h"
 
+#    include "../core/Endianness.h"
 #    include "NetworkTypes.h"
+#    include "Socket.h"
 
 #    include <memory>
 
+const char* GetNetworkCommandName(NetworkCommand command)
+{
+    switch (command)
+    {
+        case NetworkCommand::Auth:
+            return "auth";
+        case NetworkCommand::Map:
+            return "map";
+        case NetworkCommand::Chat:
+            return "chat";
+        case NetworkCommand::Tick:
+            return "tick";
+        case NetworkCommand::PlayerList:
+            return "playerList";
+        case NetworkCommand::Ping:
+            return "ping";
+        case NetworkCommand::PingList:
+            return "pingList";
+        case NetworkCommand::DisconnectMessage:
+            return "disconnectMessage";
+        case NetworkCommand::GameInfo:
+            return "gameInfo";
+        case NetworkCommand::ShowError:
+            return "showError";
+        case NetworkCommand::GroupList:
+            return "groupList";
+        case NetworkCommand::Event:
+            return "event";
+        case NetworkCommand::Token:
+            return "token";
+        case NetworkCommand::ObjectsList:
+            return "objectsList";
+        case NetworkCommand::MapRequest:
+            return "mapRequest";
+        case NetworkCommand::GameAction:
+            return "gameAction";
+        case NetworkCommand::PlayerInfo:
+            return "playerInfo";
+        case NetworkCommand::RequestGameState:
+            return "requestGameState";
+        case NetworkCommand::GameState:
+            return "gameState";
+        case NetworkCommand::Scripts:
+            return "scripts";
+        case NetworkCommand::Heartbeat:
+            return "heartbeat";
+        case NetworkCommand::GameActionBatch:
+            return "gameActionBatch";
+        default:
+            return nullptr;
+    }
+}
+
 NetworkPacket::NetworkPacket(NetworkCommand id)
     : Header{ 0, id }
 {
@@ -42,7 +97,7 @@ void NetworkPacket::Clear()
     Data.clear();
 }
 
-bool NetworkPacket::CommandRequiresAuth()
+bool NetworkPacket::CommandRequiresAuth() const
 {
     switch (GetCommand())
     {
@@ -60,6 +115,25 @@ bool NetworkPacket::CommandRequiresAuth()
     }
 }
 
+NetworkSharedPacket NetworkPacket::Encode() const
+{
+    auto encoded = std::make_shared<NetworkEncodedPacket>();
+    encoded->Id = GetCommand();
+    encoded->RequiresAuth = CommandRequiresAuth();
+
+    // NOTE: For compatibility reasons for the master server we need to add sizeof(Header.Id) to the size.
+    // Previously the Id field was not part of the header rather part of the body.
+    PacketHeader header{ static_cast<uint16_t>(Data.size() + sizeof(Header.Id)), Header.Id };
+    header.Size = Convert::HostToNetwork(header.Size);
+    header.Id = ByteSwapBE(header.Id);
+
+    encoded->Buffer.reserve(sizeof(header) + Data.size());
+    encoded->Buffer.insert(
+        encoded->Buffer.end(), reinterpret_cast<uint8_t*>(&header), reinterpret_cast<uint8_t*>(&header) + sizeof(header));
+    encoded->Buffer.insert(encoded->Buffer.end(), Data.begin(), Data.end());
+    return encoded;
+}
+
 void NetworkPacket::Write(const void* bytes, size_t size)
 {
     const uint8_t* src = reinterpret_cast<const uint8_t*>(bytes);
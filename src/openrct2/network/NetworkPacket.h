@@ -25,6 +25,20 @@ struct PacketHeader
 static_assert(sizeof(PacketHeader) == 6);
 #pragma pack(pop)
 
+/**
+ * Immutable wire encoding of a packet, header included. A packet sent to several connections is encoded once and the
+ * same buffer is queued on all of them.
+ */
+struct NetworkEncodedPacket
+{
+    NetworkCommand Id = NetworkCommand::Invalid;
+    bool RequiresAuth = true;
+    std::vector<uint8_t> Buffer;
+};
+using NetworkSharedPacket = std::shared_ptr<const NetworkEncodedPacket>;
+
+const char* GetNetworkCommandName(NetworkCommand command);
+
 struct NetworkPacket final
 {
     NetworkPacket() = default;
@@ -36,7 +50,9 @@ struct NetworkPacket final
     NetworkCommand GetCommand() const;
 
     void Clear();
-    bool CommandRequiresAuth();
+    bool CommandRequiresAuth() const;
+
+    NetworkSharedPacket Encode() const;
 
     const uint8_t* Read(size_t size);
     const utf8* ReadString();
@@ -83,6 +83,7 @@ enum class NetworkCommand : uint32_t
     GameState,
     Scripts,
     Heartbeat,
+    GameActionBatch,
     Max,
     Invalid = static_cast<uint32_t>(-1),
 };
@@ -141,8 +142,17 @@ enum class NetworkStatisticsGroup : uint32_t
     Max,
 };
 
+struct NetworkCommandStats_t
+{
+    uint64_t bytesReceived;
+    uint64_t bytesSent;
+    uint64_t packetsReceived;
+    uint64_t packetsSent;
+};
+
 struct NetworkStats_t
 {
     uint64_t bytesReceived[EnumValue(NetworkStatisticsGroup::Max)];
     uint64_t bytesSent[EnumValue(NetworkStatisticsGroup::Max)];
+    NetworkCommandStats_t commands[EnumValue(NetworkCommand::Max)];
 };
@@ -28,9 +28,22 @@
 #    include <algorithm>
 #    include <numeric>
 #    include <optional>
+#    include <thread>
+#    include <unordered_set>
 
 using namespace OpenRCT2;
 
+// Header of the server list cache, bump the version when the layout of the entries changes.
+static constexpr uint32_t SERVER_CACHE_MAGIC = 0x56525353; // SSRV
+static constexpr uint16_t SERVER_CACHE_VERSION = 1;
+
+static const std::string& GetNetworkVersion()
+{
+    // Compared for every pair of entries while sorting, lists from the master server can hold thousands of servers.
+    static const std::string version = network_get_version();
+    return version;
+}
+
 int32_t ServerListEntry::CompareTo(const ServerListEntry& other) const
 {
     const auto& a = *this;
@@ -46,8 +59,8 @@ int32_t ServerListEntry::CompareTo(const ServerListEntry& other) const
         return a.Local ? -1 : 1;
     }
 
-    bool serverACompatible = a.Version == network_get_version();
-    bool serverBCompatible = b.Version == network_get_version();
+    bool serverACompatible = a.Version == GetNetworkVersion();
+    bool serverBCompatible = b.Version == GetNetworkVersion();
     if (serverACompatible != serverBCompatible)
     {
         return serverACompatible ? -1 : 1;
@@ -68,7 +81,7 @@ int32_t ServerListEntry::CompareTo(const ServerListEntry& other) const
 
 bool ServerListEntry::IsVersionValid() const
 {
-    return Version.empty() || Version == network_get_version();
+    return Version.empty() || Version == GetNetworkVersion();
 }
 
 std::optional<ServerListEntry> ServerListEntry::FromJson(json_t& server)
@@ -113,20 +126,19 @@ std::optional<ServerListEntry> ServerListEntry::FromJson(json_t& server)
 
 void ServerList::Sort()
 {
+    std::sort(_serverEntries.begin(), _serverEntries.end(), [](const ServerListEntry& a, const ServerListEntry& b) {
+        return a.CompareTo(b) < 0;
+    });
+
+    // Keep the first entry of every address, a favourite may still be listed next to the same server found online.
+    std::unordered_set<std::string> seenAddresses[2];
     _serverEntries.erase(
-        std::unique(
+        std::remove_if(
             _serverEntries.begin(), _serverEntries.end(),
-            [](const ServerListEntry& a, const ServerListEntry& b) {
-                if (a.Favourite == b.Favourite)
-                {
-                    return String::Equals(a.Address, b.Address, true);
-                }
-                return false;
+            [&seenAddresses](const ServerListEntry& entry) {
+                return !seenAddresses[entry.Favourite ? 1 : 0].insert(String::ToUpper(entry.Address)).second;
             }),
         _serverEntries.end());
-    std::sort(_serverEntries.begin(), _serverEntries.end(), [](const ServerListEntry& a, const ServerListEntry& b) {
-        return a.CompareTo(b) < 0;
-    });
 }
 
 ServerListEntry& ServerList::GetServer(size_t index)
@@ -238,7 +250,102 @@ bool ServerList::WriteFavourites(const std::vector<ServerListEntry>& entries) co
     }
 }
 
-std::future<std::vector<ServerListEntry>> ServerList::FetchLocalServerListAsync(const INetworkEndpoint& broadcastEndpoint) const
+std::vector<ServerListEntry> ServerList::ReadCachedServers() const
+{
+    std::vector<ServerListEntry> entries;
+    try
+    {
+        auto env = GetContext()->GetPlatformEnvironment();
+        auto path = env->GetFilePath(PATHID::CACHE_SERVERS);
+        if (Platform::FileExists(path))
+        {
+            auto fs = FileStream(path, FILE_MODE_OPEN);
+            if (fs.ReadValue<uint32_t>() != SERVER_CACHE_MAGIC || fs.ReadValue<uint16_t>() != SERVER_CACHE_VERSION)
+            {
+                log_verbose("Server list cache is out of date.");
+                return entries;
+            }
+
+            auto numEntries = fs.ReadValue<uint32_t>();
+            entries.reserve(numEntries);
+            for (size_t i = 0; i < numEntries; i++)
+            {
+                ServerListEntry serverInfo;
+                serverInfo.Address = fs.ReadStdString();
+                serverInfo.Name = fs.ReadStdString();
+                serverInfo.Description = fs.ReadStdString();
+                serverInfo.Version = fs.ReadStdString();
+                serverInfo.RequiresPassword = fs.ReadValue<uint8_t>() != 0;
+                serverInfo.Players = fs.ReadValue<uint8_t>();
+                serverInfo.MaxPlayers = fs.ReadValue<uint8_t>();
+                entries.push_back(std::move(serverInfo));
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        log_error("Unable to read server list cache: %s", e.what());
+        entries = std::vector<ServerListEntry>();
+    }
+    return entries;
+}
+
+void ServerList::ReadAndAddCachedServers()
+{
+    AddRange(ReadCachedServers());
+}
+
+bool ServerList::WriteCachedServers() const
+{
+    std::vector<const ServerListEntry*> onlineServers;
+    for (const auto& entry : _serverEntries)
+    {
+        if (!entry.Favourite && !entry.Local)
+        {
+            onlineServers.push_back(&entry);
+        }
+    }
+
+    try
+    {
+        auto env = GetContext()->GetPlatformEnvironment();
+        auto path = env->GetFilePath(PATHID::CACHE_SERVERS);
+        Path::CreateDirectory(Path::GetDirectory(path));
+
+        auto fs = FileStream(path, FILE_MODE_WRITE);
+        fs.WriteValue<uint32_t>(SERVER_CACHE_MAGIC);
+        fs.WriteValue<uint16_t>(SERVER_CACHE_VERSION);
+        fs.WriteValue<uint32_t>(static_cast<uint32_t>(onlineServers.size()));
+        for (const auto* entry : onlineServers)
+        {
+            fs.WriteString(entry->Address);
+            fs.WriteString(entry->Name);
+            fs.WriteString(entry->Description);
+            fs.WriteString(entry->Version);
+            fs.WriteValue<uint8_t>(entry->RequiresPassword ? 1 : 0);
+            fs.WriteValue<uint8_t>(entry->Players);
+            fs.WriteValue<uint8_t>(entry->MaxPlayers);
+        }
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        log_error("Unable to write server list cache: %s", e.what());
+        return false;
+    }
+}
+
+void ServerList::SetOnlineServers(const std::vector<ServerListEntry>& entries)
+{
+    _serverEntries.erase(
+        std::remove_if(
+            _serverEntries.begin(), _serverEntries.end(),
+            [](const ServerListEntry& entry) { return !entry.Favourite && !entry.Local; }),
+        _serverEntries.end());
+    AddRange(entries);
+}
+
+std::future<std::vector<ServerListEntry>> ServerList::FetchLocalServerListAsync(const INetworkEndpoint& broadcastEndpoint)
 {
     auto broadcastAddress = broadcastEndpoint.GetHostname();
     return std::async(std::launch::async, [broadcastAddress] {
@@ -296,34 +403,46 @@ std::future<std::vector<ServerListEntry>> ServerList::FetchLocalServerListAsync(
 
 std::future<std::vector<ServerListEntry>> ServerList::FetchLocalServerListAsync() const
 {
-    return std::async(std::launch::async, [&] {
-        // Get all possible LAN broadcast addresses
-        auto broadcastEndpoints = GetBroadcastAddresses();
-
-        // Spin off a fetch for each broadcast address
-        std::vector<std::future<std::vector<ServerListEntry>>> futures;
-        for (const auto& broadcastEndpoint : broadcastEndpoints)
+    // Runs on a detached thread like the HTTP requests, so dropping the future while the broadcasts still wait for
+    // replies does not block the caller.
+    auto p = std::make_shared<std::promise<std::vector<ServerListEntry>>>();
+    auto f = p->get_future();
+    std::thread([p] {
+        try
         {
-            auto f = FetchLocalServerListAsync(*broadcastEndpoint);
-            futures.push_back(std::move(f));
-        }
+            // Get all possible LAN broadcast addresses
+            auto broadcastEndpoints = GetBroadcastAddresses();
 
-        // Wait and merge all results
-        std::vector<ServerListEntry> mergedEntries;
-        for (auto& f : futures)
-        {
-            try
+            // Spin off a fetch for each broadcast address
+            std::vector<std::future<std::vector<ServerListEntry>>> futures;
+            for (const auto& broadcastEndpoint : broadcastEndpoints)
             {
-                auto entries = f.get();
-                mergedEntries.insert(mergedEntries.begin(), entries.begin(), entries.end());
+                auto bf = FetchLocalServerListAsync(*broadcastEndpoint);
+                futures.push_back(std::move(bf));
             }
-            catch (...)
+
+            // Wait and merge all results
+            std::vector<ServerListEntry> mergedEntries;
+            for (auto& bf : futures)
             {
-                // Ignore any exceptions from a particular broadcast fetch
+                try
+                {
+                    auto entries = bf.get();
+                    mergedEntries.insert(mergedEntries.begin(), entries.begin(), entries.end());
+                }
+                catch (...)
+                {
+                    // Ignore any exceptions from a particular broadcast fetch
+                }
             }
+            p->set_value(std::move(mergedEntries));
         }
-        return mergedEntries;
-    });
+        catch (...)
+        {
+            p->set_exception(std::current_exception());
+        }
+    }).detach();
+    return f;
 }
 
 std::future<std::vector<ServerListEntry>> ServerList::FetchOnlineServerListAsync() const
@@ -53,7 +53,8 @@ private:
     void Sort();
     std::vector<ServerListEntry> ReadFavourites() const;
     bool WriteFavourites(const std::vector<ServerListEntry>& entries) const;
-    std::future<std::vector<ServerListEntry>> FetchLocalServerListAsync(const INetworkEndpoint& broadcastEndpoint) const;
+    std::vector<ServerListEntry> ReadCachedServers() const;
+    static std::future<std::vector<ServerListEntry>> FetchLocalServerListAsync(const INetworkEndpoint& broadcastEndpoint);
 
 public:
     ServerListEntry& GetServer(size_t index);
@@ -65,6 +66,18 @@ public:
     void ReadAndAddFavourites();
     void WriteFavourites() const;
 
+    /**
+     * Adds the servers of the last successful master server fetch, so the list can be shown before the master server
+     * responded.
+     */
+    void ReadAndAddCachedServers();
+    bool WriteCachedServers() const;
+
+    /**
+     * Replaces all servers that are neither favourites nor local with the given entries.
+     */
+    void SetOnlineServers(const std::vector<ServerListEntry>& entries);
+
     std::future<std::vector<ServerListEntry>> FetchLocalServerListAsync() const;
     std::future<std::vector<ServerListEntry>> FetchOnlineServerListAsync() const;
     uint32_t GetTotalPlayerCount() const;
@@ -29,6 +29,8 @@
     #include <ws2tcpip.h>
 
     #define LAST_SOCKET_ERROR() WSAGetLastError()
+    #define poll WSAPoll
+    using nfds_t = ULONG;
     #undef EWOULDBLOCK
     #define EWOULDBLOCK WSAEWOULDBLOCK
     #ifndef SHUT_RD
@@ -49,6 +51,7 @@
     #include <netdb.h>
     #include <netinet/in.h>
     #include <netinet/tcp.h>
+    #include <poll.h>
     #include <sys/ioctl.h>
     #include <sys/socket.h>
     #include "../common.h"
@@ -281,6 +284,11 @@ public:
         return _error.empty() ? nullptr : _error.c_str();
     }
 
+    SOCKET GetSocket() const
+    {
+        return _socket;
+    }
+
     void SetNoDelay(bool noDelay) override
     {
         if (_socket != INVALID_SOCKET)
@@ -994,6 +1002,35 @@ std::vector<std::unique_ptr<INetworkEndpoint>> GetBroadcastAddresses()
     return baddresses;
 }
 
+std::vector<bool> GetReadableSockets(const std::vector<const ITcpSocket*>& sockets)
+{
+    std::vector<bool> readable(sockets.size(), true);
+
+    std::vector<pollfd> fds;
+    std::vector<size_t> fdSocketIndex;
+    fds.reserve(sockets.size());
+    fdSocketIndex.reserve(sockets.size());
+    for (size_t i = 0; i < sockets.size(); i++)
+    {
+        auto tcpSocket = dynamic_cast<const TcpSocket*>(sockets[i]);
+        if (tcpSocket != nullptr && tcpSocket->GetStatus() == SocketStatus::Connected)
+        {
+            fds.push_back({ tcpSocket->GetSocket(), POLLIN, 0 });
+            fdSocketIndex.push_back(i);
+        }
+    }
+
+    if (!fds.empty() && poll(fds.data(), static_cast<nfds_t>(fds.size()), 0) != SOCKET_ERROR)
+    {
+        for (size_t i = 0; i < fds.size(); i++)
+        {
+            // Errors and hang ups are reported as readable so the following read picks them up.
+            readable[fdSocketIndex[i]] = fds[i].revents != 0;
+        }
+    }
+    return readable;
+}
+
 namespace Convert
 {
     uint16_t HostToNetwork(uint16_t value)
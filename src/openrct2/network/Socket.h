@@ -102,6 +102,12 @@ std::unique_ptr<ITcpSocket> CreateTcpSocket();
 std::unique_ptr<IUdpSocket> CreateUdpSocket();
 std::vector<std::unique_ptr<INetworkEndpoint>> GetBroadcastAddresses();
 
+/**
+ * Checks with a single poll which of the given sockets have data (or a disconnect) waiting to be read, so idle
+ * connections do not cost a read call each. Sockets that can not be polled are reported as readable.
+ */
+std::vector<bool> GetReadableSockets(const std::vector<const ITcpSocket*>& sockets);
+
 namespace Convert
 {
     uint16_t HostToNetwork(uint16_t value);
@@ -16,6 +16,7 @@
 #include "../core/FileScanner.h"
 #include "../core/IStream.hpp"
 #include "../core/Json.hpp"
+#include "../core/MemoryAccounting.h"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
 #include "../drawing/ImageImporter.h"
@@ -78,6 +79,16 @@ struct ImageTable::RequiredImage
     {
         delete[] g1.offset;
     }
+
+    /**
+     * Hands the image data over to the caller, who becomes responsible for deleting it.
+     */
+    rct_g1_element Release()
+    {
+        auto result = g1;
+        g1.offset = nullptr;
+        return result;
+    }
 };
 
 std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::ParseImages(IReadObjectContext* context, std::string s)
@@ -307,6 +318,7 @@ std::string ImageTable::FindLegacyObject(const std::string& name)
 
 ImageTable::~ImageTable()
 {
+    MemoryAccounting::Remove(MemoryAccounting::Category::ObjectImages, _dataSize);
     if (_data == nullptr)
     {
         for (auto& entry : _entries)
@@ -328,7 +340,7 @@ void ImageTable::Read(IReadObjectContext* context, OpenRCT2::IStream* stream)
         uint32_t numImages = stream->ReadValue<uint32_t>();
         uint32_t imageDataSize = stream->ReadValue<uint32_t>();
 
-        uint64_t headerTableSize = numImages * 16;
+        uint64_t headerTableSize = static_cast<uint64_t>(numImages) * 16;
         uint64_t remainingBytes = stream->GetLength() - stream->GetPosition() - headerTableSize;
         if (remainingBytes > imageDataSize)
         {
@@ -347,6 +359,7 @@ void ImageTable::Read(IReadObjectContext* context, OpenRCT2::IStream* stream)
         // Read g1 element headers
         uintptr_t imageDataBase = reinterpret_cast<uintptr_t>(data.get());
         std::vector<rct_g1_element> newEntries;
+        newEntries.reserve(numImages);
         for (uint32_t i = 0; i < numImages; i++)
         {
             rct_g1_element g1Element{};
@@ -376,6 +389,7 @@ void ImageTable::Read(IReadObjectContext* context, OpenRCT2::IStream* stream)
         }
 
         _data = std::move(data);
+        AddDataSize(dataSize);
         _entries.insert(_entries.end(), newEntries.begin(), newEntries.end());
     }
     catch (const std::exception&)
@@ -412,12 +426,20 @@ void ImageTable::ReadJson(IReadObjectContext* context, json_t& root)
             }
         }
 
-        // Now add all the images to the image table
+        // Now add all the images to the image table, the data of the required images is moved rather than copied
         auto imagesStartIndex = GetCount();
+        size_t numRequiredImages = 0;
         for (const auto& img : allImages)
         {
-            const auto& g1 = img->g1;
-            AddImage(&g1);
+            for (auto* zoomImg = img.get(); zoomImg != nullptr; zoomImg = zoomImg->next_zoom.get())
+            {
+                numRequiredImages++;
+            }
+        }
+        _entries.reserve(_entries.size() + numRequiredImages);
+        for (auto& img : allImages)
+        {
+            AddOwnedImage(img->Release());
         }
 
         // Add all the zoom images at the very end of the image table.
@@ -425,7 +447,7 @@ void ImageTable::ReadJson(IReadObjectContext* context, json_t& root)
         for (size_t j = 0; j < allImages.size(); j++)
         {
             const auto tableIndex = imagesStartIndex + j;
-            const auto* img = allImages[j].get();
+            auto* img = allImages[j].get();
             if (img->next_zoom != nullptr)
             {
                 img = img->next_zoom.get();
@@ -436,12 +458,12 @@ void ImageTable::ReadJson(IReadObjectContext* context, json_t& root)
 
                 while (img != nullptr)
                 {
-                    auto g1b = img->g1;
+                    auto g1b = img->Release();
                     if (img->next_zoom != nullptr)
                     {
                         g1b.zoomed_offset = -1;
                     }
-                    AddImage(&g1b);
+                    AddOwnedImage(g1b);
                     img = img->next_zoom.get();
                 }
             }
@@ -461,6 +483,29 @@ void ImageTable::AddImage(const rct_g1_element* g1)
     {
         newg1.offset = new uint8_t[length];
         std::copy_n(g1->offset, length, newg1.offset);
+        AddDataSize(length);
     }
     _entries.push_back(std::move(newg1));
 }
+
+void ImageTable::AddOwnedImage(const rct_g1_element& g1)
+{
+    auto newg1 = g1;
+    auto length = g1_calculate_data_size(&g1);
+    if (length == 0)
+    {
+        delete[] newg1.offset;
+        newg1.offset = nullptr;
+    }
+    else
+    {
+        AddDataSize(length);
+    }
+    _entries.push_back(newg1);
+}
+
+void ImageTable::AddDataSize(size_t size)
+{
+    _dataSize += size;
+    MemoryAccounting::Add(MemoryAccounting::Category::ObjectImages, size);
+}
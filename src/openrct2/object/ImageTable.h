@@ -28,6 +28,9 @@ private:
     std::unique_ptr<uint8_t[]> _data;
     std::vector<rct_g1_element> _entries;
 
+    // Bytes of image data owned by the table, reported as object images in the memory accounting.
+    size_t _dataSize{};
+
     /**
      * Container for a G1 image, additional information and RAII. Used by ReadJson
      */
@@ -42,6 +45,13 @@ private:
     static std::vector<int32_t> ParseRange(std::string s);
     static std::string FindLegacyObject(const std::string& name);
 
+    /**
+     * Adds an image whose data was allocated with new[], the table takes ownership of the data.
+     */
+    void AddOwnedImage(const rct_g1_element& g1);
+
+    void AddDataSize(size_t size);
+
 public:
     ImageTable() = default;
     ImageTable(const ImageTable&) = delete;
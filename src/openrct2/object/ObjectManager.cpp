@@ -13,6 +13,7 @@
 #include "../ParkImporter.h"
 #include "../core/Console.hpp"
 #include "../core/Memory.hpp"
+#include "../core/TaskScheduler.h"
 #include "../localisation/StringIds.h"
 #include "../util/Util.h"
 #include "FootpathItemObject.h"
@@ -27,11 +28,15 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <memory>
-#include <mutex>
-#include <thread>
+#include <unordered_map>
 #include <unordered_set>
 
+// Legacy data pointers of the loaded objects by type, rebuilt by the object manager whenever objects are loaded or
+// unloaded so that entry lookups from entity and paint code do not need to go through the context.
+static std::array<std::vector<void*>, EnumValue(ObjectType::Count)> _loadedObjectLegacyData;
+
 class ObjectManager final : public IObjectManager
 {
 private:
@@ -50,11 +55,16 @@ public:
 
         UpdateSceneryGroupIndexes();
         ResetTypeToRideEntryIndexMap();
+        UpdateLegacyDataCache();
     }
 
     ~ObjectManager() override
     {
         UnloadAll();
+        for (auto& legacyData : _loadedObjectLegacyData)
+        {
+            legacyData.clear();
+        }
     }
 
     Object* GetLoadedObject(size_t index) override
@@ -127,6 +137,7 @@ public:
         LoadDefaultObjects();
         UpdateSceneryGroupIndexes();
         ResetTypeToRideEntryIndexMap();
+        UpdateLegacyDataCache();
         log_verbose("%u / %u new objects loaded", numNewLoadedObjects, requiredObjects.size());
     }
 
@@ -155,6 +166,7 @@ public:
         {
             UpdateSceneryGroupIndexes();
             ResetTypeToRideEntryIndexMap();
+            UpdateLegacyDataCache();
         }
     }
 
@@ -166,6 +178,7 @@ public:
         }
         UpdateSceneryGroupIndexes();
         ResetTypeToRideEntryIndexMap();
+        UpdateLegacyDataCache();
     }
 
     void ResetObjects() override
@@ -180,6 +193,7 @@ public:
         }
         UpdateSceneryGroupIndexes();
         ResetTypeToRideEntryIndexMap();
+        UpdateLegacyDataCache();
     }
 
     std::vector<const ObjectRepositoryItem*> GetPackableObjects() override
@@ -365,6 +379,7 @@ private:
                         _loadedObjects[*slot] = std::move(object);
                         UpdateSceneryGroupIndexes();
                         ResetTypeToRideEntryIndexMap();
+                        UpdateLegacyDataCache();
                     }
                 }
             }
@@ -627,83 +642,63 @@ private:
         return requiredObjects;
     }
 
-    template<typename T, typename TFunc> static void ParallelFor(const std::vector<T>& items, TFunc func)
-    {
-        auto partitions = std::thread::hardware_concurrency();
-        auto partitionSize = (items.size() + (partitions - 1)) / partitions;
-        std::vector<std::thread> threads;
-        for (size_t n = 0; n < partitions; n++)
-        {
-            auto begin = n * partitionSize;
-            auto end = std::min(items.size(), begin + partitionSize);
-            threads.emplace_back(
-                [func](size_t pbegin, size_t pend) {
-                    for (size_t i = pbegin; i < pend; i++)
-                    {
-                        func(i);
-                    }
-                },
-                begin, end);
-        }
-        for (auto& t : threads)
-        {
-            t.join();
-        }
-    }
-
     std::vector<std::unique_ptr<Object>> LoadObjects(
         std::vector<const ObjectRepositoryItem*>& requiredObjects, size_t* outNewObjectsLoaded)
     {
-        std::vector<std::unique_ptr<Object>> objects;
-        std::vector<Object*> loadedObjects;
-        std::vector<rct_object_entry> badObjects;
-        objects.resize(OBJECT_ENTRY_COUNT);
-        loadedObjects.reserve(OBJECT_ENTRY_COUNT);
+        using Clock = std::chrono::steady_clock;
+        const auto resolveStart = Clock::now();
 
-        // Read objects
-        std::mutex commonMutex;
-        ParallelFor(requiredObjects, [this, &commonMutex, requiredObjects, &objects, &badObjects, &loadedObjects](size_t i) {
+        // Split the required objects into the ones that are already loaded and the ones that still have to be read
+        std::vector<size_t> objectsToKeep;
+        std::vector<size_t> objectsToRead;
+        for (size_t i = 0; i < requiredObjects.size(); i++)
+        {
             auto requiredObject = requiredObjects[i];
-            std::unique_ptr<Object> object;
             if (requiredObject != nullptr)
             {
-                auto loadedObject = requiredObject->LoadedObject;
-                if (loadedObject == nullptr)
+                if (requiredObject->LoadedObject == nullptr)
                 {
-                    // Object requires to be loaded, if the object successfully loads it will register it
-                    // as a loaded object otherwise placed into the badObjects list.
-                    object = _objectRepository.LoadObject(requiredObject);
-                    std::lock_guard<std::mutex> guard(commonMutex);
-                    if (object == nullptr)
-                    {
-                        badObjects.push_back(requiredObject->ObjectEntry);
-                        ReportObjectLoadProblem(&requiredObject->ObjectEntry);
-                    }
-                    else
-                    {
-                        loadedObjects.push_back(object.get());
-                        // Connect the ori to the registered object
-                        _objectRepository.RegisterLoadedObject(requiredObject, object.get());
-                    }
+                    objectsToRead.push_back(i);
                 }
                 else
                 {
-                    // The object is already loaded, given that the new list will be used as the next loaded object list,
-                    // we can move the element out safely. This is required as the resulting list must contain all loaded
-                    // objects and not just the newly loaded ones.
-                    std::lock_guard<std::mutex> guard(commonMutex);
-                    auto it = std::find_if(_loadedObjects.begin(), _loadedObjects.end(), [loadedObject](const auto& obj) {
-                        return obj.get() == loadedObject;
-                    });
-                    if (it != _loadedObjects.end())
-                    {
-                        object = std::move(*it);
-                    }
+                    objectsToKeep.push_back(i);
                 }
             }
-            objects[i] = std::move(object);
+        }
+
+        // Read, parse and decode the new objects in parallel, every task only writes to its own slot
+        const auto readStart = Clock::now();
+        std::vector<std::unique_ptr<Object>> readObjects(objectsToRead.size());
+        OpenRCT2::TaskScheduler::Get().ParallelFor(0, objectsToRead.size(), 1, [&](size_t i) {
+            readObjects[i] = _objectRepository.LoadObject(requiredObjects[objectsToRead[i]]);
         });
 
+        // Register the new objects in the order they are required so they always get the same image ids
+        const auto registerStart = Clock::now();
+        std::vector<std::unique_ptr<Object>> objects;
+        std::vector<Object*> loadedObjects;
+        std::vector<rct_object_entry> badObjects;
+        objects.resize(OBJECT_ENTRY_COUNT);
+        loadedObjects.reserve(objectsToRead.size());
+        for (size_t i = 0; i < objectsToRead.size(); i++)
+        {
+            auto requiredObject = requiredObjects[objectsToRead[i]];
+            auto& object = readObjects[i];
+            if (object == nullptr)
+            {
+                badObjects.push_back(requiredObject->ObjectEntry);
+                ReportObjectLoadProblem(&requiredObject->ObjectEntry);
+            }
+            else
+            {
+                loadedObjects.push_back(object.get());
+                // Connect the ori to the registered object
+                _objectRepository.RegisterLoadedObject(requiredObject, object.get());
+                objects[objectsToRead[i]] = std::move(object);
+            }
+        }
+
         // Load objects
         for (auto obj : loadedObjects)
         {
@@ -720,6 +715,34 @@ private:
             throw ObjectLoadException(std::move(badObjects));
         }
 
+        // The objects that are already loaded are moved out of the current list as it is replaced by the new one. This
+        // is required as the resulting list must contain all loaded objects and not just the newly loaded ones.
+        std::unordered_map<const Object*, size_t> loadedObjectIndices;
+        for (size_t i = 0; i < _loadedObjects.size(); i++)
+        {
+            if (_loadedObjects[i] != nullptr)
+            {
+                loadedObjectIndices.emplace(_loadedObjects[i].get(), i);
+            }
+        }
+        for (auto i : objectsToKeep)
+        {
+            auto it = loadedObjectIndices.find(requiredObjects[i]->LoadedObject);
+            if (it != loadedObjectIndices.end())
+            {
+                objects[i] = std::move(_loadedObjects[it->second]);
+            }
+        }
+
+        const auto endTime = Clock::now();
+        auto toMilliseconds = [](Clock::duration duration) {
+            return std::chrono::duration<double, std::milli>(duration).count();
+        };
+        log_verbose(
+            "Loaded %zu objects: resolve %.2f ms, read %.2f ms, register %.2f ms", loadedObjects.size(),
+            toMilliseconds(readStart - resolveStart), toMilliseconds(registerStart - readStart),
+            toMilliseconds(endTime - registerStart));
+
         if (outNewObjectsLoaded != nullptr)
         {
             *outNewObjectsLoaded = loadedObjects.size();
@@ -777,6 +800,24 @@ private:
         }
     }
 
+    void UpdateLegacyDataCache()
+    {
+        for (uint8_t type = 0; type < EnumValue(ObjectType::Count); type++)
+        {
+            auto& legacyData = _loadedObjectLegacyData[type];
+            auto maxObjects = static_cast<size_t>(object_entry_group_counts[type]);
+            legacyData.assign(maxObjects, nullptr);
+            for (size_t i = 0; i < maxObjects; i++)
+            {
+                auto* loadedObject = GetLoadedObject(static_cast<ObjectType>(type), i);
+                if (loadedObject != nullptr)
+                {
+                    legacyData[i] = loadedObject->GetLegacyData();
+                }
+            }
+        }
+    }
+
     static void ReportMissingObject(const rct_object_entry* entry)
     {
         utf8 objName[DAT_NAME_LENGTH + 1] = { 0 };
@@ -808,6 +849,16 @@ std::unique_ptr<IObjectManager> CreateObjectManager(IObjectRepository& objectRep
     return std::make_unique<ObjectManager>(objectRepository);
 }
 
+void* object_manager_get_loaded_object_legacy_data(ObjectType objectType, size_t index)
+{
+    const auto& legacyData = _loadedObjectLegacyData[EnumValue(objectType)];
+    if (index >= legacyData.size())
+    {
+        return nullptr;
+    }
+    return legacyData[index];
+}
+
 Object* object_manager_get_loaded_object_by_index(size_t index)
 {
     auto& objectManager = OpenRCT2::GetContext()->GetObjectManager();
@@ -45,6 +45,7 @@ struct IObjectManager
 
 std::unique_ptr<IObjectManager> CreateObjectManager(IObjectRepository& objectRepository);
 
+void* object_manager_get_loaded_object_legacy_data(ObjectType objectType, size_t index);
 Object* object_manager_get_loaded_object_by_index(size_t index);
 Object* object_manager_get_loaded_object(const ObjectEntryDescriptor& entry);
 ObjectEntryIndex object_manager_get_loaded_object_entry_index(const Object* loadedObject);
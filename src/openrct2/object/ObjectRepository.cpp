@@ -28,7 +28,6 @@
 #include "../object/Object.h"
 #include "../platform/platform.h"
 #include "../rct12/SawyerChunkReader.h"
-#include "../rct12/SawyerChunkWriter.h"
 #include "../scenario/ScenarioRepository.h"
 #include "../util/SawyerCoding.h"
 #include "../util/Util.h"
@@ -39,7 +38,10 @@
 #include "RideObject.h"
 
 #include <algorithm>
+#include <cstring>
+#include <deque>
 #include <memory>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -69,7 +71,8 @@ struct ObjectEntryEqual
     }
 };
 
-using ObjectIdentifierMap = std::unordered_map<std::string, size_t>;
+// Keys view the repository's interned identifiers, so looking up a string_view needs no temporary string
+using ObjectIdentifierMap = std::unordered_map<std::string_view, size_t>;
 using ObjectEntryMap = std::unordered_map<rct_object_entry, size_t, ObjectEntryHash, ObjectEntryEqual>;
 
 class ObjectFileIndex final : public FileIndex<ObjectRepositoryItem>
@@ -163,11 +166,18 @@ private:
 
 class ObjectRepository final : public IObjectRepository
 {
+    static constexpr size_t PackedObjectCacheMaxSize = 64 * 1024 * 1024;
+
     std::shared_ptr<IPlatformEnvironment> const _env;
     ObjectFileIndex const _fileIndex;
     std::vector<ObjectRepositoryItem> _items;
+    // One copy of every identifier, a deque so the strings never move while the map views them
+    std::deque<std::string> _identifiers;
     ObjectIdentifierMap _newItemMap;
     ObjectEntryMap _itemMap;
+    // Packed chunks of the custom objects sent to clients, by item ID
+    std::unordered_map<size_t, std::vector<uint8_t>> _packedObjectCache;
+    size_t _packedObjectCacheSize{};
 
 public:
     explicit ObjectRepository(const std::shared_ptr<IPlatformEnvironment>& env)
@@ -221,7 +231,7 @@ public:
 
     const ObjectRepositoryItem* FindObject(std::string_view identifier) const override final
     {
-        auto kvp = _newItemMap.find(std::string(identifier));
+        auto kvp = _newItemMap.find(identifier);
         if (kvp != _newItemMap.end())
         {
             return &_items[kvp->second];
@@ -367,7 +377,29 @@ private:
     {
         _items.clear();
         _newItemMap.clear();
+        _identifiers.clear();
         _itemMap.clear();
+        ClearPackedObjectCache();
+    }
+
+    void ClearPackedObjectCache()
+    {
+        _packedObjectCache.clear();
+        _packedObjectCacheSize = 0;
+    }
+
+    void MapIdentifier(const std::string& identifier, size_t index)
+    {
+        auto kvp = _newItemMap.find(identifier);
+        if (kvp != _newItemMap.end())
+        {
+            kvp->second = index;
+        }
+        else
+        {
+            const auto& interned = _identifiers.emplace_back(identifier);
+            _newItemMap.emplace(interned, index);
+        }
     }
 
     void SortItems()
@@ -376,7 +408,8 @@ private:
             return String::Compare(a.Name, b.Name) < 0;
         });
 
-        // Fix the IDs
+        // Fix the IDs, the packed objects are cached by ID
+        ClearPackedObjectCache();
         for (size_t i = 0; i < _items.size(); i++)
         {
             _items[i].Id = i;
@@ -385,13 +418,14 @@ private:
         // Rebuild item map
         _itemMap.clear();
         _newItemMap.clear();
+        _identifiers.clear();
         for (size_t i = 0; i < _items.size(); i++)
         {
             rct_object_entry entry = _items[i].ObjectEntry;
             _itemMap[entry] = i;
             if (!_items[i].Identifier.empty())
             {
-                _newItemMap[_items[i].Identifier] = i;
+                MapIdentifier(_items[i].Identifier, i);
             }
         }
     }
@@ -423,7 +457,7 @@ private:
             _items.push_back(std::move(copy));
             if (!item.Identifier.empty())
             {
-                _newItemMap[item.Identifier] = index;
+                MapIdentifier(item.Identifier, index);
             }
             _itemMap[item.ObjectEntry] = index;
             return true;
@@ -603,20 +637,50 @@ private:
             throw std::runtime_error(String::StdFormat("Unable to find object '%.8s'", entry->name));
         }
 
+        // Servers pack the same objects into the map for every client that joins, so the packed chunk of each object
+        // is only read from its file the first time.
+        auto cached = _packedObjectCache.find(item->Id);
+        if (cached == _packedObjectCache.end())
+        {
+            auto packedChunk = ReadPackedChunk(*item, entry);
+            if (_packedObjectCacheSize + packedChunk.size() > PackedObjectCacheMaxSize)
+            {
+                stream->WriteValue(*entry);
+                stream->Write(packedChunk.data(), packedChunk.size());
+                return;
+            }
+            _packedObjectCacheSize += packedChunk.size();
+            cached = _packedObjectCache.emplace(item->Id, std::move(packedChunk)).first;
+        }
+
+        // Write object data to stream
+        stream->WriteValue(*entry);
+        stream->Write(cached->second.data(), cached->second.size());
+    }
+
+    static std::vector<uint8_t> ReadPackedChunk(const ObjectRepositoryItem& item, const rct_object_entry* entry)
+    {
         // Read object data from file
-        auto fs = OpenRCT2::FileStream(item->Path, OpenRCT2::FILE_MODE_OPEN);
+        auto fs = OpenRCT2::FileStream(item.Path, OpenRCT2::FILE_MODE_OPEN);
         auto fileEntry = fs.ReadValue<rct_object_entry>();
         if (!object_entry_compare(entry, &fileEntry))
         {
             throw std::runtime_error("Header found in object file does not match object to pack.");
         }
-        auto chunkReader = SawyerChunkReader(&fs);
-        auto chunk = chunkReader.ReadChunk();
 
-        // Write object data to stream
-        auto chunkWriter = SawyerChunkWriter(stream);
-        stream->WriteValue(*entry);
-        chunkWriter.WriteChunk(chunk.get());
+        // The chunk is packed exactly as it is encoded in the file, so it is copied across without being decoded and
+        // encoded again.
+        auto header = fs.ReadValue<sawyercoding_chunk_header>();
+        if (header.encoding > CHUNK_ENCODING_ROTATE || header.length == 0
+            || header.length > fs.GetLength() - fs.GetPosition())
+        {
+            throw std::runtime_error(String::StdFormat("Object '%.8s' has a corrupt chunk.", entry->name));
+        }
+
+        std::vector<uint8_t> packedChunk(sizeof(header) + header.length);
+        std::memcpy(packedChunk.data(), &header, sizeof(header));
+        fs.Read(packedChunk.data() + sizeof(header), header.length);
+        return packedChunk;
     }
 };
 
@@ -299,85 +299,91 @@ template<> bool CheckBoundingBox<3>(const paint_struct_bound_box& initialBBox, c
     return false;
 }
 
+/**
+ * A paint struct in the array the arrange step works on. The bounds and flags are copied next to each other so the
+ * comparison loops scan contiguous memory rather than chasing next_quadrant_ps through the paint entry pool.
+ */
+struct PaintArrangeEntry
+{
+    paint_struct_bound_box Bounds;
+    uint16_t QuadrantIndex;
+    uint8_t QuadrantFlags;
+    paint_struct* PaintStruct;
+};
+
+/**
+ * Operates on the entries the same way the original linked list version did, index -1 standing in for the list head.
+ * An entry that has to be drawn earlier is moved behind the insertion point by shifting the entries in between, which
+ * keeps the resulting order identical to relinking it.
+ */
 template<uint8_t _TRotation>
-static paint_struct* PaintArrangeStructsHelperRotation(paint_struct* ps_next, uint16_t quadrantIndex, uint8_t flag)
+static int32_t PaintArrangeStructsHelperRotation(
+    std::vector<PaintArrangeEntry>& entries, int32_t start, uint16_t quadrantIndex, uint8_t flag)
 {
-    paint_struct* ps;
-    paint_struct* ps_temp;
+    const auto count = static_cast<int32_t>(entries.size());
+    int32_t ps = start;
+    int32_t ps_next = start;
     do
     {
         ps = ps_next;
-        ps_next = ps_next->next_quadrant_ps;
-        if (ps_next == nullptr)
+        ps_next = ps + 1;
+        if (ps_next >= count)
             return ps;
-    } while (quadrantIndex > ps_next->quadrant_index);
+    } while (quadrantIndex > entries[ps_next].QuadrantIndex);
 
-    // Cache the last visited node so we don't have to walk the whole list again
-    paint_struct* ps_cache = ps;
+    // Cache the last visited entry so we don't have to walk the whole array again
+    const int32_t ps_cache = ps;
 
-    ps_temp = ps;
-    do
+    for (int32_t i = ps + 1; i < count; i++)
     {
-        ps = ps->next_quadrant_ps;
-        if (ps == nullptr)
-            break;
-
-        if (ps->quadrant_index > quadrantIndex + 1)
+        auto& entry = entries[i];
+        if (entry.QuadrantIndex > quadrantIndex + 1)
         {
-            ps->quadrant_flags = PAINT_QUADRANT_FLAG_BIGGER;
+            entry.QuadrantFlags = PAINT_QUADRANT_FLAG_BIGGER;
+            break;
         }
-        else if (ps->quadrant_index == quadrantIndex + 1)
+        else if (entry.QuadrantIndex == quadrantIndex + 1)
         {
-            ps->quadrant_flags = PAINT_QUADRANT_FLAG_NEXT | PAINT_QUADRANT_FLAG_IDENTICAL;
+            entry.QuadrantFlags = PAINT_QUADRANT_FLAG_NEXT | PAINT_QUADRANT_FLAG_IDENTICAL;
         }
-        else if (ps->quadrant_index == quadrantIndex)
+        else if (entry.QuadrantIndex == quadrantIndex)
         {
-            ps->quadrant_flags = flag | PAINT_QUADRANT_FLAG_IDENTICAL;
+            entry.QuadrantFlags = flag | PAINT_QUADRANT_FLAG_IDENTICAL;
         }
-    } while (ps->quadrant_index <= quadrantIndex + 1);
-    ps = ps_temp;
+    }
 
     while (true)
     {
         while (true)
         {
-            ps_next = ps->next_quadrant_ps;
-            if (ps_next == nullptr)
+            ps_next = ps + 1;
+            if (ps_next >= count)
                 return ps_cache;
-            if (ps_next->quadrant_flags & PAINT_QUADRANT_FLAG_BIGGER)
+            if (entries[ps_next].QuadrantFlags & PAINT_QUADRANT_FLAG_BIGGER)
                 return ps_cache;
-            if (ps_next->quadrant_flags & PAINT_QUADRANT_FLAG_IDENTICAL)
+            if (entries[ps_next].QuadrantFlags & PAINT_QUADRANT_FLAG_IDENTICAL)
                 break;
             ps = ps_next;
         }
 
-        ps_next->quadrant_flags &= ~PAINT_QUADRANT_FLAG_IDENTICAL;
-        ps_temp = ps;
+        entries[ps_next].QuadrantFlags &= ~PAINT_QUADRANT_FLAG_IDENTICAL;
+        const int32_t ps_temp = ps;
 
-        const paint_struct_bound_box& initialBBox = ps_next->bounds;
+        // Copied as moving entries shifts the initial one along.
+        const paint_struct_bound_box initialBBox = entries[ps_next].Bounds;
 
-        while (true)
+        for (int32_t i = ps_next + 1; i < count; i++)
         {
-            ps = ps_next;
-            ps_next = ps_next->next_quadrant_ps;
-            if (ps_next == nullptr)
+            const auto& current = entries[i];
+            if (current.QuadrantFlags & PAINT_QUADRANT_FLAG_BIGGER)
                 break;
-            if (ps_next->quadrant_flags & PAINT_QUADRANT_FLAG_BIGGER)
-                break;
-            if (!(ps_next->quadrant_flags & PAINT_QUADRANT_FLAG_NEXT))
+            if (!(current.QuadrantFlags & PAINT_QUADRANT_FLAG_NEXT))
                 continue;
 
-            const paint_struct_bound_box& currentBBox = ps_next->bounds;
-
-            const bool compareResult = CheckBoundingBox<_TRotation>(initialBBox, currentBBox);
-
-            if (compareResult)
+            if (CheckBoundingBox<_TRotation>(initialBBox, current.Bounds))
             {
-                ps->next_quadrant_ps = ps_next->next_quadrant_ps;
-                paint_struct* ps_temp2 = ps_temp->next_quadrant_ps;
-                ps_temp->next_quadrant_ps = ps_next;
-                ps_next->next_quadrant_ps = ps_temp2;
-                ps_next = ps;
+                // Move the entry in front of the initial one, everything after it keeps its order.
+                std::rotate(entries.begin() + ps_temp + 1, entries.begin() + i, entries.begin() + i + 1);
             }
         }
 
@@ -388,37 +394,40 @@ static paint_struct* PaintArrangeStructsHelperRotation(paint_struct* ps_next, ui
 template<int TRotation> static void PaintSessionArrange(PaintSessionCore* session, bool)
 {
     paint_struct* psHead = &session->PaintHead;
-
-    paint_struct* ps = psHead;
-    ps->next_quadrant_ps = nullptr;
+    psHead->next_quadrant_ps = nullptr;
 
     uint32_t quadrantIndex = session->QuadrantBackIndex;
-    if (quadrantIndex != UINT32_MAX)
+    if (quadrantIndex == UINT32_MAX)
+        return;
+
+    // Reused between sessions painted on the same thread to avoid allocating every column.
+    thread_local std::vector<PaintArrangeEntry> entries;
+    entries.clear();
+    do
     {
-        do
+        for (auto* ps = session->Quadrants[quadrantIndex]; ps != nullptr; ps = ps->next_quadrant_ps)
         {
-            paint_struct* ps_next = session->Quadrants[quadrantIndex];
-            if (ps_next != nullptr)
-            {
-                ps->next_quadrant_ps = ps_next;
-                do
-                {
-                    ps = ps_next;
-                    ps_next = ps_next->next_quadrant_ps;
+            entries.push_back({ ps->bounds, ps->quadrant_index, ps->quadrant_flags, ps });
+        }
+    } while (++quadrantIndex <= session->QuadrantFrontIndex);
 
-                } while (ps_next != nullptr);
-            }
-        } while (++quadrantIndex <= session->QuadrantFrontIndex);
+    int32_t ps_cache = PaintArrangeStructsHelperRotation<TRotation>(
+        entries, -1, session->QuadrantBackIndex & 0xFFFF, PAINT_QUADRANT_FLAG_NEXT);
 
-        paint_struct* ps_cache = PaintArrangeStructsHelperRotation<TRotation>(
-            psHead, session->QuadrantBackIndex & 0xFFFF, PAINT_QUADRANT_FLAG_NEXT);
+    quadrantIndex = session->QuadrantBackIndex;
+    while (++quadrantIndex < session->QuadrantFrontIndex)
+    {
+        ps_cache = PaintArrangeStructsHelperRotation<TRotation>(entries, ps_cache, quadrantIndex & 0xFFFF, 0);
+    }
 
-        quadrantIndex = session->QuadrantBackIndex;
-        while (++quadrantIndex < session->QuadrantFrontIndex)
-        {
-            ps_cache = PaintArrangeStructsHelperRotation<TRotation>(ps_cache, quadrantIndex & 0xFFFF, 0);
-        }
+    paint_struct* ps = psHead;
+    for (auto& entry : entries)
+    {
+        entry.PaintStruct->quadrant_flags = entry.QuadrantFlags;
+        ps->next_quadrant_ps = entry.PaintStruct;
+        ps = entry.PaintStruct;
     }
+    ps->next_quadrant_ps = nullptr;
 }
 
 /**
@@ -1015,6 +1024,12 @@ paint_entry* PaintEntryPool::Chain::Allocate()
         }
         Current = Head;
     }
+    else if (Current->Count >= NodeSize && Current->Next != nullptr)
+    {
+        // Reuse a node kept from before the last reset
+        Current = Current->Next;
+        Current->Count = 0;
+    }
     else if (Current->Count >= NodeSize)
     {
         // We need another node
@@ -1043,6 +1058,15 @@ void PaintEntryPool::Chain::Clear()
     assert(Current == nullptr);
 }
 
+void PaintEntryPool::Chain::Reset()
+{
+    Current = Head;
+    if (Current != nullptr)
+    {
+        Current->Count = 0;
+    }
+}
+
 size_t PaintEntryPool::Chain::GetCount() const
 {
     size_t count = 0;
@@ -1050,6 +1074,10 @@ size_t PaintEntryPool::Chain::GetCount() const
     while (current != nullptr)
     {
         count += current->Count;
+        if (current == Current)
+        {
+            break;
+        }
         current = current->Next;
     }
     return count;
@@ -143,7 +143,8 @@ struct tunnel_entry
  * The internal implementation uses an unrolled linked list so that each
  * paint session can quickly allocate a new paint entry until it requires
  * another node / block of paint entries. Only the node allocation needs to
- * be thread safe.
+ * be thread safe. Chains keep their nodes across resets, the nodes
+ * past Current are spare and their Count is stale.
  */
 class PaintEntryPool
 {
@@ -172,6 +173,12 @@ public:
 
         paint_entry* Allocate();
         void Clear();
+
+        /**
+         * Makes the chain start allocating from its first node again while keeping all nodes, so sessions that are
+         * reused every frame do not have to go through the pool's lock.
+         */
+        void Reset();
         size_t GetCount() const;
     };
 
@@ -201,6 +208,8 @@ struct PaintSessionCore
     const TileElement* TrackElementOnSameHeight;
     paint_struct PaintHead;
     uint32_t ViewFlags;
+    // Set when zoomed out far enough that supports, tunnels and small details are left out.
+    bool LowDetail;
     uint32_t QuadrantBackIndex;
     uint32_t QuadrantFrontIndex;
     CoordsXY SpritePosition;
@@ -269,10 +278,22 @@ struct paint_session : public PaintSessionCore
     }
 };
 
+/**
+ * A deep copy of a paint session right after PaintSessionGenerate. Pointers to paint entries are stored as the byte
+ * offset of the entry in Entries, nullptr as -1.
+ */
 struct RecordedPaintSession
 {
     PaintSessionCore Session;
     std::vector<paint_entry> Entries;
+
+    // Area of the column in view coordinates. Together with the view flags and rotation in Session, and the map this
+    // is what PaintSessionGenerate works from.
+    int16_t X{};
+    int16_t Y{};
+    int16_t Width{};
+    int16_t Height{};
+    ZoomLevel Zoom{};
 };
 
 extern paint_session gPaintSession;
@@ -24,6 +24,9 @@
 #include "../paint/Paint.h"
 #include "../title/TitleScreen.h"
 #include "../ui/UiContext.h"
+#include "../world/Map.h"
+
+#include <algorithm>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
@@ -37,6 +40,8 @@ Painter::Painter(const std::shared_ptr<IUiContext>& uiContext)
 
 void Painter::Paint(IDrawingEngine& de)
 {
+    map_flush_invalidations();
+
     auto dpi = de.GetDrawingPixelInfo();
     if (gIntroState != IntroState::None)
     {
@@ -78,6 +83,9 @@ void Painter::Paint(IDrawingEngine& de)
         PaintFPS(dpi);
     }
     gCurrentDrawCount++;
+
+    _lastFramePaintStructCount = _paintStructCount;
+    _paintStructCount = 0;
 }
 
 void Painter::PaintReplayNotice(rct_drawpixelinfo* dpi, const char* text)
@@ -104,7 +112,15 @@ void Painter::PaintFPS(rct_drawpixelinfo* dpi)
     MeasureFPS();
 
     char buffer[64]{};
-    FormatStringToBuffer(buffer, sizeof(buffer), "{OUTLINE}{WHITE}{INT32}", _currentFPS);
+    if (_inputLatency != 0)
+    {
+        FormatStringToBuffer(
+            buffer, sizeof(buffer), "{OUTLINE}{WHITE}{INT32}  ({INT32} ms)", _currentFPS, static_cast<int32_t>(_inputLatency));
+    }
+    else
+    {
+        FormatStringToBuffer(buffer, sizeof(buffer), "{OUTLINE}{WHITE}{INT32}", _currentFPS);
+    }
 
     // Draw Text
     int32_t stringWidth = gfx_get_string_width(buffer, FontSpriteBase::MEDIUM);
@@ -124,12 +140,25 @@ void Painter::MeasureFPS()
     {
         _currentFPS = _frames;
         _frames = 0;
+        _inputLatency = _peakInputLatency;
+        _peakInputLatency = 0;
     }
     _lastSecond = currentTime;
 }
 
+void Painter::RecordInputLatency(uint32_t latency)
+{
+    _peakInputLatency = std::max(_peakInputLatency, latency);
+}
+
+uint32_t Painter::GetInputLatency() const
+{
+    return _inputLatency;
+}
+
 paint_session* Painter::CreateSession(rct_drawpixelinfo* dpi, uint32_t viewFlags)
 {
+    std::lock_guard<std::mutex> lock(_sessionMutex);
     paint_session* session = nullptr;
 
     if (_freePaintSessions.empty() == false)
@@ -149,9 +178,13 @@ paint_session* Painter::CreateSession(rct_drawpixelinfo* dpi, uint32_t viewFlags
 
     session->DPI = *dpi;
     session->ViewFlags = viewFlags;
+    session->LowDetail = static_cast<int8_t>(dpi->zoom_level) >= gConfigGeneral.low_detail_zoom_level;
     session->QuadrantBackIndex = std::numeric_limits<uint32_t>::max();
     session->QuadrantFrontIndex = 0;
-    session->PaintEntryChain = _paintStructPool.Create();
+    if (session->PaintEntryChain.Pool == nullptr)
+    {
+        session->PaintEntryChain = _paintStructPool.Create();
+    }
 
     std::fill(std::begin(session->Quadrants), std::end(session->Quadrants), nullptr);
     session->LastPS = nullptr;
@@ -167,6 +200,13 @@ paint_session* Painter::CreateSession(rct_drawpixelinfo* dpi, uint32_t viewFlags
 
 void Painter::ReleaseSession(paint_session* session)
 {
-    session->PaintEntryChain.Clear();
+    std::lock_guard<std::mutex> lock(_sessionMutex);
+    _paintStructCount += session->PaintEntryChain.GetCount();
+    session->PaintEntryChain.Reset();
     _freePaintSessions.push_back(session);
 }
+
+size_t Painter::GetPaintStructCount() const
+{
+    return _lastFramePaintStructCount;
+}
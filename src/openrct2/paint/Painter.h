@@ -14,6 +14,7 @@
 
 #include <ctime>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 struct rct_drawpixelinfo;
@@ -36,12 +37,19 @@ namespace OpenRCT2
         {
         private:
             std::shared_ptr<Ui::IUiContext> const _uiContext;
+            // Declared before the sessions as their chains return nodes to it when destroyed.
+            PaintEntryPool _paintStructPool;
             std::vector<std::unique_ptr<paint_session>> _paintSessionPool;
             std::vector<paint_session*> _freePaintSessions;
-            PaintEntryPool _paintStructPool;
+            // Sessions are also created and released by worker threads, such as the light occlusion tests.
+            std::mutex _sessionMutex;
             time_t _lastSecond = 0;
             int32_t _currentFPS = 0;
             int32_t _frames = 0;
+            uint32_t _inputLatency = 0;
+            uint32_t _peakInputLatency = 0;
+            size_t _paintStructCount = 0;
+            size_t _lastFramePaintStructCount = 0;
 
         public:
             explicit Painter(const std::shared_ptr<Ui::IUiContext>& uiContext);
@@ -50,6 +58,18 @@ namespace OpenRCT2
             paint_session* CreateSession(rct_drawpixelinfo* dpi, uint32_t viewFlags);
             void ReleaseSession(paint_session* session);
 
+            /**
+             * Number of paint structs the viewports generated while painting the last frame.
+             */
+            size_t GetPaintStructCount() const;
+
+            /**
+             * Records how long the input handled by a presented frame waited, in milliseconds. The worst latency of
+             * each second is shown next to the FPS.
+             */
+            void RecordInputLatency(uint32_t latency);
+            uint32_t GetInputLatency() const;
+
         private:
             void PaintReplayNotice(rct_drawpixelinfo* dpi, const char* text);
             void PaintFPS(rct_drawpixelinfo* dpi);
@@ -15,6 +15,10 @@
 #include "Paint.h"
 #include "tile_element/Paint.TileElement.h"
 
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
 /** rct2: 0x0097AF20, 0x0097AF21 */
 // clang-format off
 static constexpr const CoordsXY SupportBoundBoxes[] = {
@@ -467,7 +471,7 @@ bool wooden_a_supports_paint_setup(
         *underground = false;
     }
 
-    if (session->ViewFlags & VIEWPORT_FLAG_INVISIBLE_SUPPORTS)
+    if ((session->ViewFlags & VIEWPORT_FLAG_INVISIBLE_SUPPORTS) || session->LowDetail)
     {
         return false;
     }
@@ -645,7 +649,7 @@ bool wooden_b_supports_paint_setup(
 {
     bool _9E32B1 = false;
 
-    if (session->ViewFlags & VIEWPORT_FLAG_INVISIBLE_SUPPORTS)
+    if ((session->ViewFlags & VIEWPORT_FLAG_INVISIBLE_SUPPORTS) || session->LowDetail)
     {
         if (underground != nullptr)
             *underground = false; // AND
@@ -815,34 +819,82 @@ bool wooden_b_supports_paint_setup(
     return _9E32B1;
 }
 
+struct MetalSupportsImage
+{
+    uint32_t ImageId;
+    CoordsXYZ Offset;
+    CoordsXYZ BoundBoxSize;
+    CoordsXYZ BoundBoxOffset;
+};
+
 /**
- * Metal pole supports
- * @param supportType (edi)
- * @param segment (ebx)
- * @param special (ax)
- * @param height (edx)
- * @param imageColourFlags (ebp)
- *  rct2: 0x00663105
+ * The images and segment update of a metal_a_supports_paint_setup call, without the colour flags. These only depend on
+ * the arguments, the rotation and the support segments of the tile, so the same supports on the next frame can be
+ * painted from this again.
  */
-bool metal_a_supports_paint_setup(
-    paint_session* session, uint8_t supportType, uint8_t segment, int32_t special, int32_t height, uint32_t imageColourFlags)
+struct MetalSupportsPlan
 {
-    support_height* supportSegments = session->SupportSegments;
+    std::vector<MetalSupportsImage> Images;
+    uint8_t Segment;
+    uint16_t SegmentHeight;
+    bool Drawn;
 
-    if (session->ViewFlags & VIEWPORT_FLAG_INVISIBLE_SUPPORTS)
+    void Add(uint32_t imageId, const CoordsXYZ& offset, const CoordsXYZ& boundBoxSize)
     {
-        return false;
+        Images.push_back({ imageId, offset, boundBoxSize, offset });
     }
 
-    if (!(session->Unk141E9DB & PaintSessionFlags::IsPassedSurface))
+    void Add(uint32_t imageId, const CoordsXYZ& offset, const CoordsXYZ& boundBoxSize, const CoordsXYZ& boundBoxOffset)
     {
-        return false;
+        Images.push_back({ imageId, offset, boundBoxSize, boundBoxOffset });
     }
+};
 
+struct MetalSupportsKey
+{
+    support_height SupportSegments[9];
+    int32_t Special;
+    int32_t Height;
+    uint8_t Rotation;
+    uint8_t SupportType;
+    uint8_t Segment;
+    uint8_t Pad;
+
+    bool operator==(const MetalSupportsKey& other) const
+    {
+        return std::memcmp(this, &other, sizeof(*this)) == 0;
+    }
+};
+static_assert(std::has_unique_object_representations_v<MetalSupportsKey>);
+
+struct MetalSupportsCacheEntry
+{
+    MetalSupportsKey Key;
+    MetalSupportsPlan Plan;
+    bool Valid;
+};
+
+static constexpr size_t MetalSupportsCacheSize = 1024;
+
+static uint32_t metal_a_supports_key_hash(const MetalSupportsKey& key)
+{
+    // FNV-1a
+    auto data = reinterpret_cast<const uint8_t*>(&key);
+    uint32_t hash = 0x811C9DC5;
+    for (size_t i = 0; i < sizeof(key); i++)
+    {
+        hash = (hash ^ data[i]) * 0x01000193;
+    }
+    return hash;
+}
+
+static bool metal_a_supports_resolve(
+    const support_height* supportSegments, uint8_t rotation, uint8_t supportType, uint8_t segment, int32_t special,
+    int32_t height, MetalSupportsPlan& plan)
+{
     int16_t originalHeight = height;
     int32_t originalSegment = segment;
 
-    const uint8_t rotation = session->CurrentRotation;
     int16_t unk9E3294 = -1;
     if (height < supportSegments[segment].height)
     {
@@ -886,8 +938,7 @@ bool metal_a_supports_paint_setup(
         int16_t boundBoxLengthY = _97B062[ebp].y;
 
         uint32_t image_id = _metalSupportTypeToCrossbeamImages[supportType][ebp];
-        image_id |= imageColourFlags;
-        PaintAddImageAsParent(session, image_id, { xOffset, yOffset, height }, { boundBoxLengthX, boundBoxLengthY, 1 });
+        plan.Add(image_id, { xOffset, yOffset, height }, { boundBoxLengthX, boundBoxLengthY, 1 });
 
         segment = newSegment;
     }
@@ -904,9 +955,8 @@ bool metal_a_supports_paint_setup(
 
         uint32_t image_id = _97B15C[supportType].base_id;
         image_id += metal_supports_slope_image_map[supportSegments[segment].slope & TILE_ELEMENT_SURFACE_SLOPE_MASK];
-        image_id |= imageColourFlags;
 
-        PaintAddImageAsParent(session, image_id, { xOffset, yOffset, supportSegments[segment].height }, { 0, 0, 5 });
+        plan.Add(image_id, { xOffset, yOffset, supportSegments[segment].height }, { 0, 0, 5 });
 
         height = supportSegments[segment].height + 6;
     }
@@ -928,9 +978,8 @@ bool metal_a_supports_paint_setup(
 
         uint32_t image_id = _97B15C[supportType].beam_id;
         image_id += heightDiff - 1;
-        image_id |= imageColourFlags;
 
-        PaintAddImageAsParent(session, image_id, { xOffset, yOffset, height }, { 0, 0, heightDiff - 1 });
+        plan.Add(image_id, { xOffset, yOffset, height }, { 0, 0, heightDiff - 1 });
     }
 
     height += heightDiff;
@@ -956,18 +1005,17 @@ bool metal_a_supports_paint_setup(
 
         uint32_t image_id = _97B15C[supportType].beam_id;
         image_id += z - 1;
-        image_id |= imageColourFlags;
 
         if (count == 3 && z == 0x10)
             image_id++;
 
-        PaintAddImageAsParent(session, image_id, { xOffset, yOffset, height }, { 0, 0, z - 1 });
+        plan.Add(image_id, { xOffset, yOffset, height }, { 0, 0, z - 1 });
 
         height += z;
     }
 
-    supportSegments[segment].height = unk9E3294;
-    supportSegments[segment].slope = 0x20;
+    plan.Segment = segment;
+    plan.SegmentHeight = unk9E3294;
 
     height = originalHeight;
     segment = originalSegment;
@@ -1000,9 +1048,8 @@ bool metal_a_supports_paint_setup(
 
         uint32_t image_id = _97B190[supportType].beam_id;
         image_id += z - 1;
-        image_id |= imageColourFlags;
 
-        PaintAddImageAsParent(session, image_id, { xOffset, yOffset, height }, { 0, 0, 0 }, boundBoxOffset);
+        plan.Add(image_id, { xOffset, yOffset, height }, { 0, 0, 0 }, boundBoxOffset);
 
         height += z;
     }
@@ -1010,6 +1057,71 @@ bool metal_a_supports_paint_setup(
     return true;
 }
 
+/**
+ * Metal pole supports
+ * @param supportType (edi)
+ * @param segment (ebx)
+ * @param special (ax)
+ * @param height (edx)
+ * @param imageColourFlags (ebp)
+ *  rct2: 0x00663105
+ */
+bool metal_a_supports_paint_setup(
+    paint_session* session, uint8_t supportType, uint8_t segment, int32_t special, int32_t height, uint32_t imageColourFlags)
+{
+    support_height* supportSegments = session->SupportSegments;
+
+    if ((session->ViewFlags & VIEWPORT_FLAG_INVISIBLE_SUPPORTS) || session->LowDetail)
+    {
+        return false;
+    }
+
+    if (!(session->Unk141E9DB & PaintSessionFlags::IsPassedSurface))
+    {
+        return false;
+    }
+
+    MetalSupportsKey key{};
+    for (size_t i = 0; i < std::size(key.SupportSegments); i++)
+    {
+        key.SupportSegments[i].height = supportSegments[i].height;
+        key.SupportSegments[i].slope = supportSegments[i].slope;
+    }
+    key.Special = special;
+    key.Height = height;
+    key.Rotation = session->CurrentRotation;
+    key.SupportType = supportType;
+    key.Segment = segment;
+
+    // Each paint thread keeps its own cache, the key holds everything the supports depend on so it never goes stale.
+    thread_local std::vector<MetalSupportsCacheEntry> cache(MetalSupportsCacheSize);
+    auto& entry = cache[metal_a_supports_key_hash(key) % MetalSupportsCacheSize];
+    if (!entry.Valid || !(entry.Key == key))
+    {
+        entry.Key = key;
+        entry.Plan.Images.clear();
+        entry.Plan.Drawn = metal_a_supports_resolve(
+            supportSegments, key.Rotation, supportType, segment, special, height, entry.Plan);
+        entry.Valid = true;
+    }
+
+    const auto& plan = entry.Plan;
+    if (!plan.Drawn)
+    {
+        return false;
+    }
+
+    for (const auto& image : plan.Images)
+    {
+        PaintAddImageAsParent(
+            session, image.ImageId | imageColourFlags, image.Offset, image.BoundBoxSize, image.BoundBoxOffset);
+    }
+
+    supportSegments[plan.Segment].height = plan.SegmentHeight;
+    supportSegments[plan.Segment].slope = 0x20;
+    return true;
+}
+
 /**
  * Metal pole supports
  *  rct2: 0x00663584
@@ -1028,7 +1140,7 @@ bool metal_b_supports_paint_setup(
     support_height* supportSegments = session->SupportSegments;
     uint8_t originalSegment = segment;
 
-    if (session->ViewFlags & VIEWPORT_FLAG_INVISIBLE_SUPPORTS)
+    if ((session->ViewFlags & VIEWPORT_FLAG_INVISIBLE_SUPPORTS) || session->LowDetail)
     {
         return false; // AND
     }
@@ -1211,7 +1323,7 @@ bool path_a_supports_paint_setup(
         *underground = false; // AND
     }
 
-    if (session->ViewFlags & VIEWPORT_FLAG_INVISIBLE_SUPPORTS)
+    if ((session->ViewFlags & VIEWPORT_FLAG_INVISIBLE_SUPPORTS) || session->LowDetail)
     {
         return false;
     }
@@ -1357,7 +1469,7 @@ bool path_b_supports_paint_setup(
 {
     support_height* supportSegments = session->SupportSegments;
 
-    if (session->ViewFlags & VIEWPORT_FLAG_INVISIBLE_SUPPORTS)
+    if ((session->ViewFlags & VIEWPORT_FLAG_INVISIBLE_SUPPORTS) || session->LowDetail)
     {
         return false; // AND
     }
@@ -11,6 +11,7 @@
 #include "../../drawing/LightFX.h"
 #include "../../interface/Viewport.h"
 #include "../../peep/Peep.h"
+#include "../../world/EntityTweener.h"
 #include "../Paint.h"
 #include "Paint.Sprite.h"
 
@@ -20,6 +21,8 @@
  */
 template<> void PaintEntity(paint_session* session, const Peep* peep, int32_t imageDirection)
 {
+    const auto renderPos = EntityTweener::Get().GetRenderState(*peep).Position;
+
 #ifdef __ENABLE_LIGHTFX__
     if (lightfx_is_available())
     {
@@ -27,9 +30,9 @@ template<> void PaintEntity(paint_session* session, const Peep* peep, int32_t im
         {
             int16_t peep_x, peep_y, peep_z;
 
-            peep_x = peep->x;
-            peep_y = peep->y;
-            peep_z = peep->z;
+            peep_x = renderPos.x;
+            peep_y = renderPos.y;
+            peep_z = renderPos.z;
 
             switch (peep->sprite_direction)
             {
@@ -80,28 +83,35 @@ template<> void PaintEntity(paint_session* session, const Peep* peep, int32_t im
         + imageOffset * 4;
     uint32_t imageId = baseImageId | peep->TshirtColour << 19 | peep->TrousersColour << 24 | IMAGE_TYPE_REMAP
         | IMAGE_TYPE_REMAP_2_PLUS;
-    PaintAddImageAsParent(session, imageId, 0, 0, 1, 1, 11, peep->z, 0, 0, peep->z + 5);
+    PaintAddImageAsParent(session, imageId, 0, 0, 1, 1, 11, renderPos.z, 0, 0, renderPos.z + 5);
+
+    // Like the riders of vehicles, hats, balloons and umbrellas are only a pixel or two when zoomed out this far
+    if (dpi->zoom_level >= 2)
+    {
+        return;
+    }
+
     auto* guest = peep->As<Guest>();
     if (guest != nullptr)
     {
         if (baseImageId >= 10717 && baseImageId < 10749)
         {
             imageId = (baseImageId + 32) | guest->HatColour << 19 | IMAGE_TYPE_REMAP;
-            PaintAddImageAsChild(session, imageId, { 0, 0, peep->z }, { 1, 1, 11 }, { 0, 0, peep->z + 5 });
+            PaintAddImageAsChild(session, imageId, { 0, 0, renderPos.z }, { 1, 1, 11 }, { 0, 0, renderPos.z + 5 });
             return;
         }
 
         if (baseImageId >= 10781 && baseImageId < 10813)
         {
             imageId = (baseImageId + 32) | guest->BalloonColour << 19 | IMAGE_TYPE_REMAP;
-            PaintAddImageAsChild(session, imageId, { 0, 0, peep->z }, { 1, 1, 11 }, { 0, 0, peep->z + 5 });
+            PaintAddImageAsChild(session, imageId, { 0, 0, renderPos.z }, { 1, 1, 11 }, { 0, 0, renderPos.z + 5 });
             return;
         }
 
         if (baseImageId >= 11197 && baseImageId < 11229)
         {
             imageId = (baseImageId + 32) | guest->UmbrellaColour << 19 | IMAGE_TYPE_REMAP;
-            PaintAddImageAsChild(session, imageId, { 0, 0, peep->z }, { 1, 1, 11 }, { 0, 0, peep->z + 5 });
+            PaintAddImageAsChild(session, imageId, { 0, 0, renderPos.z }, { 1, 1, 11 }, { 0, 0, renderPos.z + 5 });
             return;
         }
     }
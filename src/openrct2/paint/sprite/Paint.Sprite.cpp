@@ -20,6 +20,7 @@
 #include "../../world/Climate.h"
 #include "../../world/Duck.h"
 #include "../../world/EntityList.h"
+#include "../../world/EntityTweener.h"
 #include "../../world/Fountain.h"
 #include "../../world/Litter.h"
 #include "../../world/MapAnimation.h"
@@ -44,13 +45,17 @@ void sprite_paint_setup(paint_session* session, const uint16_t x, const uint16_t
         return;
     }
 
-    rct_drawpixelinfo* dpi = &session->DPI;
+    const rct_drawpixelinfo* dpi = &session->DPI;
     if (dpi->zoom_level > 2)
     {
         return;
     }
 
     const bool highlightPathIssues = (session->ViewFlags & VIEWPORT_FLAG_HIGHLIGHT_PATH_ISSUES);
+    const auto& tweener = EntityTweener::Get();
+    const int32_t dpiRight = dpi->x + dpi->width;
+    const int32_t dpiBottom = dpi->y + dpi->height;
+    const int32_t rotationDirection = session->CurrentRotation << 3;
 
     for (const auto* spr : EntityTileList({ x, y }))
     {
@@ -70,42 +75,43 @@ void sprite_paint_setup(paint_session* session, const uint16_t x, const uint16_t
             }
         }
 
+        // Moving entities are drawn at their interpolated position when the frame rate is uncapped
+        const auto renderState = tweener.GetRenderState(*spr);
+        const auto& renderPos = renderState.Position;
+
+        // Reject entities outside the painted area before anything else, with column painting most entities of a
+        // tile are outside the column
+        if (dpiBottom <= renderState.SpriteTop || renderState.SpriteBottom <= dpi->y || dpiRight <= renderState.SpriteLeft
+            || renderState.SpriteRight <= dpi->x)
+        {
+            continue;
+        }
+
         // Only paint sprites that are below the clip height and inside the clip selection.
         // Here converting from land/path/etc height scale to pixel height scale.
         // Note: peeps/scenery on slopes will be above the base
         // height of the slope element, and consequently clipped.
         if ((session->ViewFlags & VIEWPORT_FLAG_CLIP_VIEW))
         {
-            if (spr->z > (gClipHeight * COORDS_Z_STEP))
+            if (renderPos.z > (gClipHeight * COORDS_Z_STEP))
             {
                 continue;
             }
-            if (spr->x < gClipSelectionA.x || spr->x > gClipSelectionB.x)
+            if (renderPos.x < gClipSelectionA.x || renderPos.x > gClipSelectionB.x)
             {
                 continue;
             }
-            if (spr->y < gClipSelectionA.y || spr->y > gClipSelectionB.y)
+            if (renderPos.y < gClipSelectionA.y || renderPos.y > gClipSelectionB.y)
             {
                 continue;
             }
         }
 
-        dpi = &session->DPI;
-
-        if (dpi->y + dpi->height <= spr->sprite_top || spr->sprite_bottom <= dpi->y || dpi->x + dpi->width <= spr->sprite_left
-            || spr->sprite_right <= dpi->x)
-        {
-            continue;
-        }
-
-        int32_t image_direction = session->CurrentRotation;
-        image_direction <<= 3;
-        image_direction += spr->sprite_direction;
-        image_direction &= 0x1F;
+        int32_t image_direction = (rotationDirection + spr->sprite_direction) & 0x1F;
 
         session->CurrentlyDrawnItem = spr;
-        session->SpritePosition.x = spr->x;
-        session->SpritePosition.y = spr->y;
+        session->SpritePosition.x = renderPos.x;
+        session->SpritePosition.y = renderPos.y;
         session->InteractionType = ViewportInteractionItem::Entity;
 
         switch (spr->Type)
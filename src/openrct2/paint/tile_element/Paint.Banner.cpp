@@ -43,6 +43,10 @@ void PaintBanner(paint_session* session, uint8_t direction, int32_t height, cons
         return;
 
     height -= 16;
+    if (paint_util_is_outside_dpi(session, height, bannerElement.GetClearanceZ()))
+    {
+        return;
+    }
 
     auto banner = bannerElement.GetBanner();
     if (banner == nullptr)
@@ -103,17 +107,8 @@ void PaintBanner(paint_session* session, uint8_t direction, int32_t height, cons
     auto ft = Formatter();
     banner->FormatTextTo(ft, /*addColour*/ true);
 
-    if (gConfigGeneral.upper_case_banners)
-    {
-        format_string_to_upper(gCommonStringFormatBuffer, sizeof(gCommonStringFormatBuffer), STR_BANNER_TEXT_FORMAT, ft.Data());
-    }
-    else
-    {
-        format_string(gCommonStringFormatBuffer, sizeof(gCommonStringFormatBuffer), STR_BANNER_TEXT_FORMAT, ft.Data());
-    }
-
-    uint16_t string_width = gfx_get_string_width(gCommonStringFormatBuffer, FontSpriteBase::TINY);
-    uint16_t scroll = (gCurrentTicks / 2) % string_width;
+    uint16_t stringWidth = scrolling_text_get_width(STR_BANNER_TEXT_FORMAT, ft);
+    uint16_t scroll = stringWidth > 0 ? (gCurrentTicks / 2) % stringWidth : 0;
     auto scrollIndex = scrolling_text_setup(session, STR_BANNER_TEXT_FORMAT, ft, scroll, scrollingMode, COLOUR_BLACK);
     PaintAddImageAsChild(
         session, scrollIndex, 0, 0, 1, 1, 0x15, height + 22, boundBoxOffset.x, boundBoxOffset.y, boundBoxOffset.z);
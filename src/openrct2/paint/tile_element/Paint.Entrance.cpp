@@ -182,17 +182,7 @@ static void ride_entrance_exit_paint(
             ft.Add<rct_string_id>(STR_RIDE_ENTRANCE_CLOSED);
         }
 
-        utf8 entrance_string[256];
-        if (gConfigGeneral.upper_case_banners)
-        {
-            format_string_to_upper(entrance_string, sizeof(entrance_string), STR_BANNER_TEXT_FORMAT, ft.Data());
-        }
-        else
-        {
-            format_string(entrance_string, sizeof(entrance_string), STR_BANNER_TEXT_FORMAT, ft.Data());
-        }
-
-        uint16_t stringWidth = gfx_get_string_width(entrance_string, FontSpriteBase::TINY);
+        uint16_t stringWidth = scrolling_text_get_width(STR_BANNER_TEXT_FORMAT, ft);
         uint16_t scroll = stringWidth > 0 ? (gCurrentTicks / 2) % stringWidth : 0;
 
         PaintAddImageAsChild(
@@ -292,17 +282,7 @@ static void park_entrance_paint(paint_session* session, uint8_t direction, int32
                     ft.Add<uint32_t>(0);
                 }
 
-                utf8 park_name[256];
-                if (gConfigGeneral.upper_case_banners)
-                {
-                    format_string_to_upper(park_name, sizeof(park_name), STR_BANNER_TEXT_FORMAT, ft.Data());
-                }
-                else
-                {
-                    format_string(park_name, sizeof(park_name), STR_BANNER_TEXT_FORMAT, ft.Data());
-                }
-
-                uint16_t stringWidth = gfx_get_string_width(park_name, FontSpriteBase::TINY);
+                uint16_t stringWidth = scrolling_text_get_width(STR_BANNER_TEXT_FORMAT, ft);
                 uint16_t scroll = stringWidth > 0 ? (gCurrentTicks / 2) % stringWidth : 0;
 
                 if (entrance->scrolling_mode == SCROLLING_MODE_NONE)
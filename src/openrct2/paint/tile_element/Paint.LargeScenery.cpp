@@ -440,17 +440,7 @@ void PaintLargeScenery(paint_session* session, uint8_t direction, uint16_t heigh
     {
         auto ft = Formatter();
         banner->FormatTextTo(ft);
-        utf8 signString[256];
-        if (gConfigGeneral.upper_case_banners)
-        {
-            format_string_to_upper(signString, sizeof(signString), STR_SCROLLING_SIGN_TEXT, ft.Data());
-        }
-        else
-        {
-            format_string(signString, sizeof(signString), STR_SCROLLING_SIGN_TEXT, ft.Data());
-        }
-
-        uint16_t stringWidth = gfx_get_string_width(signString, FontSpriteBase::TINY);
+        uint16_t stringWidth = scrolling_text_get_width(STR_SCROLLING_SIGN_TEXT, ft);
         uint16_t scroll = stringWidth > 0 ? (gCurrentTicks / 2) % stringWidth : 0;
         PaintAddImageAsChild(
             session, scrolling_text_setup(session, STR_SCROLLING_SIGN_TEXT, ft, scroll, scrollMode, textColour), 0, 0, 1, 1, 21,
@@ -163,7 +163,7 @@ void PaintSmallScenery(paint_session* session, uint8_t direction, int32_t height
             boxoffset.y, boxoffset.z);
     }
 
-    if (scenery_small_entry_has_flag(sceneryEntry, SMALL_SCENERY_FLAG_HAS_GLASS))
+    if (scenery_small_entry_has_flag(sceneryEntry, SMALL_SCENERY_FLAG_HAS_GLASS) && !session->LowDetail)
     {
         if (marker == 0)
         {
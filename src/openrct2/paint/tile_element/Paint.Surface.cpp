@@ -552,6 +552,9 @@ static bool tile_is_inside_clip_view(const tile_descriptor& tile)
     return true;
 }
 
+// Low detail sessions draw every edge as plain wall, without the tunnels of the track going through it.
+static constexpr const tunnel_entry NoTunnels[] = { { 0xFF, 0xFF } };
+
 static void viewport_surface_draw_tile_side_bottom(
     paint_session* session, enum edge_t edge, uint16_t height, uint8_t edgeStyle, struct tile_descriptor self,
     struct tile_descriptor neighbour, bool isWater)
@@ -602,6 +605,11 @@ static void viewport_surface_draw_tile_side_bottom(
             return;
     }
 
+    if (session->LowDetail)
+    {
+        tunnelArray = NoTunnels;
+    }
+
     bool neighbourIsClippedAway = (session->ViewFlags & VIEWPORT_FLAG_CLIP_VIEW) && !tile_is_inside_clip_view(neighbour);
 
     if (neighbour.tile_element == nullptr || neighbourIsClippedAway)
@@ -389,6 +389,44 @@ void paint_util_set_vertical_tunnel(paint_session* session, uint16_t height)
     session->VerticalTunnelHeight = height / 16;
 }
 
+/**
+ * Checks whether anything painted on the current tile between the given heights can cover the session DPI. Uses the
+ * same margins as the tile level check in sub_68B3FB so elements are only skipped when their whole tile would be.
+ */
+bool paint_util_is_outside_dpi(const paint_session* session, int32_t baseZ, int32_t clearanceZ)
+{
+    int32_t x = session->MapPosition.x;
+    int32_t y = session->MapPosition.y;
+    int32_t screenY = 0;
+    switch (session->CurrentRotation)
+    {
+        case 0:
+            screenY = x + y;
+            break;
+        case 1:
+            x += 32;
+            screenY = y - x;
+            break;
+        case 2:
+            x += 32;
+            y += 32;
+            screenY = -(x + y);
+            break;
+        case 3:
+            y += 32;
+            screenY = x - y;
+            break;
+    }
+    screenY >>= 1;
+
+    const rct_drawpixelinfo& dpi = session->DPI;
+    if (screenY - baseZ + 52 <= dpi.y)
+        return true;
+    if (screenY - clearanceZ - 32 - dpi.height >= dpi.y)
+        return true;
+    return false;
+}
+
 void paint_util_set_general_support_height(paint_session* session, int16_t height, uint8_t slope)
 {
     if (session->Support.height >= height)
@@ -100,6 +100,7 @@ void paint_util_set_general_support_height(paint_session* session, int16_t heigh
 void paint_util_force_set_general_support_height(paint_session* session, int16_t height, uint8_t slope);
 void paint_util_set_segment_support_height(paint_session* session, int32_t segments, uint16_t height, uint8_t slope);
 uint16_t paint_util_rotate_segments(uint16_t segments, uint8_t rotation);
+bool paint_util_is_outside_dpi(const paint_session* session, int32_t baseZ, int32_t clearanceZ);
 
 void tile_element_paint_setup(paint_session* session, const CoordsXY& mapCoords, bool isTrackPiecePreview = false);
 
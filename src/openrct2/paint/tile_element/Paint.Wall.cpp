@@ -190,6 +190,12 @@ void PaintWall(paint_session* session, uint8_t direction, int32_t height, const
 
     paint_util_set_general_support_height(session, 8 * wallElement.clearance_height, 0x20);
 
+    // Everything below only adds images, skip it when none of them can end up in the DPI.
+    if (paint_util_is_outside_dpi(session, height, wallElement.GetClearanceZ()))
+    {
+        return;
+    }
+
     uint32_t dword_141F710 = 0;
     if (gTrackDesignSaveMode || (session->ViewFlags & VIEWPORT_FLAG_HIGHLIGHT_PATH_ISSUES))
     {
@@ -441,17 +447,7 @@ void PaintWall(paint_session* session, uint8_t direction, int32_t height, const
     {
         auto ft = Formatter();
         banner->FormatTextTo(ft);
-        utf8 signString[256];
-        if (gConfigGeneral.upper_case_banners)
-        {
-            format_string_to_upper(signString, sizeof(signString), STR_SCROLLING_SIGN_TEXT, ft.Data());
-        }
-        else
-        {
-            format_string(signString, sizeof(signString), STR_SCROLLING_SIGN_TEXT, ft.Data());
-        }
-
-        uint16_t stringWidth = gfx_get_string_width(signString, FontSpriteBase::TINY);
+        uint16_t stringWidth = scrolling_text_get_width(STR_SCROLLING_SIGN_TEXT, ft);
         uint16_t scroll = stringWidth > 0 ? (gCurrentTicks / 2) % stringWidth : 0;
 
         PaintAddImageAsChild(
@@ -13,6 +13,7 @@
 #include "../audio/audio.h"
 #include "../config/Config.h"
 #include "../core/Guard.hpp"
+#include "../core/TaskScheduler.h"
 #include "../interface/Window_internal.h"
 #include "../localisation/Localisation.h"
 #include "../management/Finance.h"
@@ -22,6 +23,7 @@
 #include "../rct2/RCT2.h"
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
+#include "../ride/RideProximityIndex.h"
 #include "../ride/ShopItem.h"
 #include "../ride/Station.h"
 #include "../ride/Track.h"
@@ -420,6 +422,25 @@ static void peep_update_ride_nausea_growth(Guest* peep, Ride* ride);
 static bool peep_should_go_on_ride_again(Guest* peep, Ride* ride);
 static bool peep_should_preferred_intensity_increase(Guest* peep);
 static bool peep_really_liked_ride(Guest* peep, Ride* ride);
+/**
+ * Result of the parallel planning phase of peep_update_all. The ride consideration set of a guest only depends on
+ * state that guests do not modify during their update, so it can be computed ahead of the serial update and gives
+ * the same result as computing it in place.
+ */
+struct GuestRidePlan
+{
+    uint16_t SpriteIndex;
+    CoordsXY Location;
+    bool HasMap;
+    std::bitset<MAX_RIDES> RideConsideration;
+};
+
+// Sorted by sprite index once planning has finished.
+static std::vector<GuestRidePlan> _guestRidePlans;
+
+// Rides that guests without a map consider from anywhere in the park, refreshed before the guests update.
+static std::bitset<MAX_RIDES> _alwaysVisibleRides;
+
 static PeepThoughtType peep_assess_surroundings(int16_t centre_x, int16_t centre_y, int16_t centre_z);
 static void peep_update_hunger(Guest* peep);
 static void peep_decide_whether_to_leave_park(Guest* peep);
@@ -717,6 +738,16 @@ int32_t Guest::CheckEasterEggName(int32_t index) const
     return _stricmp(buffer, gPeepEasterEggNames[index]) == 0;
 }
 
+/**
+ * Moves a stat towards its target by at most step, without overshooting. Kept branch-free and free of side effects so
+ * the per-guest housekeeping stays cheap.
+ */
+static constexpr uint8_t guest_converge_stat(uint8_t value, uint8_t target, uint8_t step)
+{
+    return value >= target ? static_cast<uint8_t>(std::max<int32_t>(value - step, target))
+                           : static_cast<uint8_t>(std::min<int32_t>(value + step, target));
+}
+
 void Guest::loc_68F9F3()
 {
     // Idle peep happiness tends towards 127 (50%).
@@ -832,44 +863,11 @@ void Guest::loc_68FA89()
         WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_2;
     }
 
-    uint8_t newHappiness = Happiness;
-    uint8_t newHappinessGrowth = HappinessTarget;
-    if (newHappiness >= newHappinessGrowth)
-    {
-        newHappiness = std::max(newHappiness - 4, 0);
-        if (newHappiness < newHappinessGrowth)
-            newHappiness = newHappinessGrowth;
-    }
-    else
-    {
-        newHappiness = std::min(255, newHappiness + 4);
-        if (newHappiness > newHappinessGrowth)
-            newHappiness = newHappinessGrowth;
-    }
-
-    if (newHappiness != Happiness)
+    uint8_t newHappiness = guest_converge_stat(Happiness, HappinessTarget, 4);
+    uint8_t newNausea = guest_converge_stat(Nausea, NauseaTarget, 4);
+    if (newHappiness != Happiness || newNausea != Nausea)
     {
         Happiness = newHappiness;
-        WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_2;
-    }
-
-    uint8_t newNausea = Nausea;
-    uint8_t newNauseaGrowth = NauseaTarget;
-    if (newNausea >= newNauseaGrowth)
-    {
-        newNausea = std::max(newNausea - 4, 0);
-        if (newNausea < newNauseaGrowth)
-            newNausea = newNauseaGrowth;
-    }
-    else
-    {
-        newNausea = std::min(255, newNausea + 4);
-        if (newNausea > newNauseaGrowth)
-            newNausea = newNauseaGrowth;
-    }
-
-    if (newNausea != Nausea)
-    {
         Nausea = newNausea;
         WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_2;
     }
@@ -1631,15 +1629,12 @@ bool Guest::DecideAndBuyItem(Ride* ride, ShopItem shopItem, money32 price)
 
     WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_INVENTORY;
     UpdateSpriteType();
-    if (PeepFlags & PEEP_FLAGS_TRACKING)
+    if ((PeepFlags & PEEP_FLAGS_TRACKING) && gConfigNotifications.guest_bought_item)
     {
         auto ft = Formatter();
         FormatNameTo(ft);
         ft.Add<rct_string_id>(GetShopItemDescriptor(shopItem).Naming.Indefinite);
-        if (gConfigNotifications.guest_bought_item)
-        {
-            News::AddItemToQueue(News::ItemType::PeepOnRide, STR_PEEP_TRACKING_NOTIFICATION_BOUGHT_X, sprite_index, ft);
-        }
+        News::AddItemToQueue(News::ItemType::PeepOnRide, STR_PEEP_TRACKING_NOTIFICATION_BOUGHT_X, sprite_index, ft);
     }
 
     if (GetShopItemDescriptor(shopItem).IsFood())
@@ -1786,15 +1781,7 @@ void Guest::OnExitRide(Ride* ride)
  */
 void Guest::PickRideToGoOn()
 {
-    if (State != PeepState::Walking)
-        return;
-    if (GuestHeadingToRideId != RIDE_ID_NULL)
-        return;
-    if (PeepFlags & PEEP_FLAGS_LEAVING_PARK)
-        return;
-    if (HasFoodOrDrink())
-        return;
-    if (x == LOCATION_NULL)
+    if (!CanPickRideToGoOn())
         return;
 
     auto ride = FindBestRideToGoOn();
@@ -1838,7 +1825,39 @@ Ride* Guest::FindBestRideToGoOn()
     return mostExcitingRide;
 }
 
-std::bitset<MAX_RIDES> Guest::FindRidesToGoOn()
+bool Guest::CanPickRideToGoOn() const
+{
+    if (State != PeepState::Walking)
+        return false;
+    if (GuestHeadingToRideId != RIDE_ID_NULL)
+        return false;
+    if (PeepFlags & PEEP_FLAGS_LEAVING_PARK)
+        return false;
+    if (HasFoodOrDrink())
+        return false;
+    if (x == LOCATION_NULL)
+        return false;
+    return true;
+}
+
+std::bitset<MAX_RIDES> Guest::FindRidesToGoOn() const
+{
+    auto it = std::lower_bound(
+        _guestRidePlans.begin(), _guestRidePlans.end(), sprite_index,
+        [](const GuestRidePlan& plan, uint16_t spriteIndex) { return plan.SpriteIndex < spriteIndex; });
+    if (it != _guestRidePlans.end() && it->SpriteIndex == sprite_index && it->Location == CoordsXY{ x, y }
+        && it->HasMap == HasItem(ShopItem::Map))
+    {
+        return it->RideConsideration;
+    }
+    return ComputeRidesToGoOn();
+}
+
+/**
+ * Only reads the guest and map / ride state that is not modified during the peep update, this makes it safe to call
+ * for several guests at once from the planning phase of peep_update_all.
+ */
+std::bitset<MAX_RIDES> Guest::ComputeRidesToGoOn() const
 {
     std::bitset<MAX_RIDES> rideConsideration;
 
@@ -1859,36 +1878,70 @@ std::bitset<MAX_RIDES> Guest::FindRidesToGoOn()
     else
     {
         // Take nearby rides into consideration
-        constexpr auto radius = 10 * 32;
-        int32_t cx = floor2(x, 32);
-        int32_t cy = floor2(y, 32);
-        for (int32_t tileX = cx - radius; tileX <= cx + radius; tileX += COORDS_XY_STEP)
-        {
-            for (int32_t tileY = cy - radius; tileY <= cy + radius; tileY += COORDS_XY_STEP)
-            {
-                auto location = CoordsXY{ tileX, tileY };
-                if (!map_is_location_valid(location))
-                    continue;
+        constexpr auto radius = 10;
+        RideProximityIndex::AddRidesInRange(TileCoordsXY(CoordsXY{ x, y }), radius, rideConsideration);
 
-                for (auto* trackElement : TileElementsView<TrackElement>(location))
-                {
-                    auto rideIndex = trackElement->GetRideIndex();
-                    rideConsideration[rideIndex] = true;
-                }
-            }
+        // Always take the tall rides into consideration (realistic as you can usually see them from anywhere in the park)
+        rideConsideration |= _alwaysVisibleRides;
+    }
+
+    return rideConsideration;
+}
+
+/**
+ * Brings the ride lookups used by ComputeRidesToGoOn up to date. Guests do not build track or change ride ratings, so
+ * this only has to be done once before they update.
+ */
+void peep_update_ride_consideration()
+{
+    RideProximityIndex::Refresh();
+
+    _alwaysVisibleRides.reset();
+    for (auto& ride : GetRideManager())
+    {
+        if (ride.highest_drop_height > 66 || ride.excitement >= RIDE_RATING(8, 00))
+        {
+            _alwaysVisibleRides[ride.id] = true;
         }
+    }
+}
 
-        // Always take the tall rides into consideration (realistic as you can usually see them from anywhere in the park)
-        for (auto& ride : GetRideManager())
+void peep_plan_guest_updates()
+{
+    _guestRidePlans.clear();
+
+    // Mirrors the index used by peep_update_all, only guests due their 512 tick update can pick a ride.
+    uint32_t index = 0;
+    for (auto* guest : EntityList<Guest>())
+    {
+        if ((index & 0x1FF) == (gCurrentTicks & 0x1FF) && guest->CanPickRideToGoOn())
         {
-            if (ride.highest_drop_height > 66 || ride.excitement >= RIDE_RATING(8, 00))
-            {
-                rideConsideration[ride.id] = true;
-            }
+            auto& plan = _guestRidePlans.emplace_back();
+            plan.SpriteIndex = guest->sprite_index;
+            plan.Location = { guest->x, guest->y };
+            plan.HasMap = guest->HasItem(ShopItem::Map);
         }
+        index++;
     }
 
-    return rideConsideration;
+    constexpr size_t PlansPerTask = 4;
+    OpenRCT2::TaskScheduler::Get().ParallelFor(0, _guestRidePlans.size(), PlansPerTask, [](size_t i) {
+        auto& plan = _guestRidePlans[i];
+        const auto* guest = GetEntity<Guest>(plan.SpriteIndex);
+        if (guest != nullptr)
+        {
+            plan.RideConsideration = guest->ComputeRidesToGoOn();
+        }
+    });
+
+    std::sort(_guestRidePlans.begin(), _guestRidePlans.end(), [](const GuestRidePlan& a, const GuestRidePlan& b) {
+        return a.SpriteIndex < b.SpriteIndex;
+    });
+}
+
+void peep_clear_guest_plans()
+{
+    _guestRidePlans.clear();
 }
 
 /**
@@ -3810,7 +3863,7 @@ void Guest::UpdateRideFreeVehicleEnterRide(Ride* ride)
         window_invalidate_by_number(WC_RIDE, CurrentRide);
     }
 
-    if (PeepFlags & PEEP_FLAGS_TRACKING)
+    if ((PeepFlags & PEEP_FLAGS_TRACKING) && gConfigNotifications.guest_on_ride)
     {
         auto ft = Formatter();
         FormatNameTo(ft);
@@ -3822,10 +3875,7 @@ void Guest::UpdateRideFreeVehicleEnterRide(Ride* ride)
         else
             msg_string = STR_PEEP_TRACKING_PEEP_IS_ON_X;
 
-        if (gConfigNotifications.guest_on_ride)
-        {
-            News::AddItemToQueue(News::ItemType::PeepOnRide, msg_string, sprite_index, ft);
-        }
+        News::AddItemToQueue(News::ItemType::PeepOnRide, msg_string, sprite_index, ft);
     }
 
     if (ride->type == RIDE_TYPE_SPIRAL_SLIDE)
@@ -4917,16 +4967,13 @@ void Guest::UpdateRideLeaveExit()
 
     OnExitRide(ride);
 
-    if (ride != nullptr && (PeepFlags & PEEP_FLAGS_TRACKING))
+    if (ride != nullptr && (PeepFlags & PEEP_FLAGS_TRACKING) && gConfigNotifications.guest_left_ride)
     {
         auto ft = Formatter();
         FormatNameTo(ft);
         ride->FormatNameTo(ft);
 
-        if (gConfigNotifications.guest_left_ride)
-        {
-            News::AddItemToQueue(News::ItemType::PeepOnRide, STR_PEEP_TRACKING_LEFT_RIDE_X, sprite_index, ft);
-        }
+        News::AddItemToQueue(News::ItemType::PeepOnRide, STR_PEEP_TRACKING_LEFT_RIDE_X, sprite_index, ft);
     }
 
     InteractionRideIndex = RIDE_ID_NULL;
@@ -5583,6 +5630,7 @@ void Guest::UpdateEnteringPark()
     increment_guests_in_park();
     decrement_guests_heading_for_park();
     auto intent = Intent(INTENT_ACTION_UPDATE_GUEST_COUNT);
+    intent.putExtra(INTENT_EXTRA_PEEP, this);
     context_broadcast_intent(&intent);
 }
 
@@ -5612,6 +5660,7 @@ void Guest::UpdateLeavingPark()
     DestinationTolerance = 5;
     decrement_guests_in_park();
     auto intent = Intent(INTENT_ACTION_UPDATE_GUEST_COUNT);
+    intent.putExtra(INTENT_EXTRA_PEEP, this);
     context_broadcast_intent(&intent);
     Var37 = 1;
 
@@ -10,6 +10,7 @@
 #include "GuestPathfinding.h"
 
 #include "../core/Guard.hpp"
+#include "../core/Profiling.h"
 #include "../ride/RideData.h"
 #include "../ride/Station.h"
 #include "../ride/Track.h"
@@ -20,7 +21,9 @@
 #include "Peep.h"
 #include "Staff.h"
 
+#include <algorithm>
 #include <cstring>
+#include <unordered_map>
 
 static bool _peepPathFindIsStaff;
 static int8_t _peepPathFindNumJunctions;
@@ -28,6 +31,10 @@ static int8_t _peepPathFindMaxJunctions;
 static int32_t _peepPathFindTilesChecked;
 static uint8_t _peepPathFindFewestNumSteps;
 
+static PathfindStats _pathfindStats;
+static bool _pathfindHitTileLimit;
+static bool _pathfindHitJunctionLimit;
+
 TileCoordsXYZ gPeepPathFindGoalPosition;
 bool gPeepPathFindIgnoreForeignQueues;
 ride_id_t gPeepPathFindQueueRideIndex;
@@ -51,6 +58,69 @@ static struct
     Direction direction;
 } _peepPathFindHistory[16];
 
+/* Guests heading for the same goal from the same tile run the exact same
+ * heuristic search, which only depends on the map and the parameters in
+ * this key. Results are shared for the duration of the peep update as the
+ * map does not change while guests are being updated. */
+struct PathfindSearchKey
+{
+    TileCoordsXYZ Start;
+    TileCoordsXYZ Goal;
+    int32_t TilesChecked;
+    ride_id_t QueueRideIndex;
+    uint8_t Edge;
+    int8_t MaxJunctions;
+    bool IgnoreForeignQueues;
+
+    bool operator==(const PathfindSearchKey& other) const
+    {
+        return Start == other.Start && Goal == other.Goal && TilesChecked == other.TilesChecked
+            && QueueRideIndex == other.QueueRideIndex && Edge == other.Edge && MaxJunctions == other.MaxJunctions
+            && IgnoreForeignQueues == other.IgnoreForeignQueues;
+    }
+};
+
+struct PathfindSearchKeyHash
+{
+    size_t operator()(const PathfindSearchKey& key) const
+    {
+        size_t hash = std::hash<int32_t>()(key.Start.x);
+        auto combine = [&hash](size_t value) { hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2); };
+        combine(std::hash<int32_t>()(key.Start.y));
+        combine(std::hash<int32_t>()(key.Start.z));
+        combine(std::hash<int32_t>()(key.Goal.x));
+        combine(std::hash<int32_t>()(key.Goal.y));
+        combine(std::hash<int32_t>()(key.Goal.z));
+        combine(std::hash<int32_t>()(key.TilesChecked));
+        combine(std::hash<uint32_t>()(
+            (static_cast<uint32_t>(key.Edge) << 16) | (static_cast<uint32_t>(static_cast<uint8_t>(key.MaxJunctions)) << 8)
+            | key.IgnoreForeignQueues));
+        combine(std::hash<uint32_t>()(static_cast<uint32_t>(key.QueueRideIndex)));
+        return hash;
+    }
+};
+
+struct PathfindSearchResult
+{
+    uint16_t Score;
+    uint8_t Steps;
+};
+
+static std::unordered_map<PathfindSearchKey, PathfindSearchResult, PathfindSearchKeyHash> _peepPathFindSearchCache;
+
+/* Connectivity of the path network discovered by the searches: whether a
+ * path element is a thin junction and what lies at the end of the single
+ * width path leaving a tile in a direction. Shares the lifetime of the
+ * search cache. */
+struct PathDestinationResult
+{
+    uint8_t SearchResult;
+    ride_id_t RideIndex;
+};
+
+static std::unordered_map<const PathElement*, bool> _pathThinJunctionCache;
+static std::unordered_map<uint64_t, PathDestinationResult> _pathDestinationCache;
+
 enum
 {
     PATH_SEARCH_DEAD_END,
@@ -446,7 +516,29 @@ static uint8_t footpath_element_destination_in_direction(
         }
     }
 
-    return footpath_element_dest_in_dir(loc, chosenDirection, outRideIndex, 0);
+    // The walk only depends on the start, the direction and whether no entry signs apply.
+    const uint64_t key = (static_cast<uint64_t>(static_cast<uint16_t>(loc.x)) << 40)
+        | (static_cast<uint64_t>(static_cast<uint16_t>(loc.y)) << 24) | (static_cast<uint64_t>(loc.z & 0xFFFF) << 8)
+        | (_peepPathFindIsStaff ? 0x10 : 0) | chosenDirection;
+    auto cached = _pathDestinationCache.find(key);
+    if (cached != _pathDestinationCache.end())
+    {
+        const auto& result = cached->second;
+        if (result.RideIndex != RIDE_ID_NULL)
+        {
+            *outRideIndex = result.RideIndex;
+        }
+        return result.SearchResult;
+    }
+
+    ride_id_t rideIndex = RIDE_ID_NULL;
+    auto searchResult = footpath_element_dest_in_dir(loc, chosenDirection, &rideIndex, 0);
+    if (rideIndex != RIDE_ID_NULL)
+    {
+        *outRideIndex = rideIndex;
+    }
+    _pathDestinationCache.emplace(key, PathDestinationResult{ searchResult, rideIndex });
+    return searchResult;
 }
 
 /**
@@ -519,7 +611,7 @@ static uint8_t peep_pathfind_get_max_number_junctions(Peep* peep)
  * since entrances and ride queues coming off a path should not result in
  * the path being considered a junction.
  */
-static bool path_is_thin_junction(PathElement* path, const TileCoordsXYZ& loc)
+static bool path_is_thin_junction_uncached(PathElement* path, const TileCoordsXYZ& loc)
 {
     uint8_t edges = path->GetEdges();
 
@@ -551,6 +643,19 @@ static bool path_is_thin_junction(PathElement* path, const TileCoordsXYZ& loc)
     return thin_junction;
 }
 
+static bool path_is_thin_junction(PathElement* path, const TileCoordsXYZ& loc)
+{
+    auto cached = _pathThinJunctionCache.find(path);
+    if (cached != _pathThinJunctionCache.end())
+    {
+        return cached->second;
+    }
+
+    bool thinJunction = path_is_thin_junction_uncached(path, loc);
+    _pathThinJunctionCache.emplace(path, thinJunction);
+    return thinJunction;
+}
+
 static int32_t CalculateHeuristicPathingScore(const TileCoordsXYZ& loc1, const TileCoordsXYZ& loc2)
 {
     auto xDelta = abs(loc1.x - loc2.x) * 32;
@@ -696,6 +801,8 @@ static void peep_pathfind_heuristic_search(
 
     ++counter;
     _peepPathFindTilesChecked--;
+    _pathfindStats.TilesChecked++;
+    _pathfindStats.MaxDepth = std::max<uint32_t>(_pathfindStats.MaxDepth, counter);
 
     /* If this is where the search started this is a search loop and the
      * current search path ends here.
@@ -1017,6 +1124,7 @@ static void peep_pathfind_heuristic_search(
          * - max number of steps or max tiles checked. */
         if (counter >= 200 || _peepPathFindTilesChecked <= 0)
         {
+            _pathfindHitTileLimit = true;
             /* The current search ends here.
              * The path continues, so the goal could still be reachable from here.
              * If the search result is better than the best so far (in the parameters),
@@ -1129,6 +1237,7 @@ static void peep_pathfind_heuristic_search(
                  * then update the parameters with this search before continuing to the next map element. */
                 if (_peepPathFindNumJunctions <= 0)
                 {
+                    _pathfindHitJunctionLimit = true;
                     if (new_score < *endScore || (new_score == *endScore && counter < *endSteps))
                     {
                         // Update the search results
@@ -1162,6 +1271,7 @@ static void peep_pathfind_heuristic_search(
                 // .direction take is added below.
 
                 _peepPathFindNumJunctions--;
+                _pathfindStats.JunctionsVisited++;
             }
         }
 
@@ -1252,7 +1362,7 @@ static void peep_pathfind_heuristic_search(
  *
  *  rct2: 0x0069A5F0
  */
-Direction peep_pathfind_choose_direction(const TileCoordsXYZ& loc, Peep* peep)
+static Direction peep_pathfind_choose_direction_internal(const TileCoordsXYZ& loc, Peep* peep)
 {
     // The max number of thin junctions searched - a per-search-path limit.
     _peepPathFindMaxJunctions = peep_pathfind_get_max_number_junctions(peep);
@@ -1509,9 +1619,37 @@ Direction peep_pathfind_choose_direction(const TileCoordsXYZ& loc, Peep* peep)
             }
 #endif // defined(DEBUG_LEVEL_2) && DEBUG_LEVEL_2
 
-            peep_pathfind_heuristic_search(
-                { loc.x, loc.y, height }, peep, first_tile_element, inPatrolArea, 0, &score, test_edge, &endJunctions,
-                endJunctionList, endDirectionList, &endXYZ, &endSteps);
+            bool useSearchCache = !_peepPathFindIsStaff;
+#if defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
+            // Debug logging wants the junction list of every search.
+            useSearchCache = useSearchCache && !_pathFindDebug;
+#endif // defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
+
+            PathfindSearchKey searchKey{ { loc.x, loc.y, height },
+                                         goal,
+                                         _peepPathFindTilesChecked,
+                                         gPeepPathFindQueueRideIndex,
+                                         static_cast<uint8_t>(test_edge),
+                                         _peepPathFindMaxJunctions,
+                                         gPeepPathFindIgnoreForeignQueues };
+            auto cached = useSearchCache ? _peepPathFindSearchCache.find(searchKey) : _peepPathFindSearchCache.end();
+            if (cached != _peepPathFindSearchCache.end())
+            {
+                _pathfindStats.CachedSearches++;
+                score = cached->second.Score;
+                endSteps = cached->second.Steps;
+            }
+            else
+            {
+                _pathfindStats.Searches++;
+                peep_pathfind_heuristic_search(
+                    { loc.x, loc.y, height }, peep, first_tile_element, inPatrolArea, 0, &score, test_edge, &endJunctions,
+                    endJunctionList, endDirectionList, &endXYZ, &endSteps);
+                if (useSearchCache)
+                {
+                    _peepPathFindSearchCache.emplace(searchKey, PathfindSearchResult{ score, endSteps });
+                }
+            }
 
 #if defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
             if (_pathFindDebug)
@@ -1624,6 +1762,44 @@ Direction peep_pathfind_choose_direction(const TileCoordsXYZ& loc, Peep* peep)
     return chosen_edge;
 }
 
+Direction peep_pathfind_choose_direction(const TileCoordsXYZ& loc, Peep* peep)
+{
+    _pathfindHitTileLimit = false;
+    _pathfindHitJunctionLimit = false;
+    const auto start = OpenRCT2::Profiling::GetTimestamp();
+
+    auto direction = peep_pathfind_choose_direction_internal(loc, peep);
+
+    const auto time = OpenRCT2::Profiling::GetTimestamp() - start;
+    _pathfindStats.Calls++;
+    _pathfindStats.TotalTime += time;
+    _pathfindStats.MaxTime = std::max(_pathfindStats.MaxTime, time);
+    if (_pathfindHitTileLimit)
+        _pathfindStats.TileLimitCalls++;
+    if (_pathfindHitJunctionLimit)
+        _pathfindStats.JunctionLimitCalls++;
+    if (direction == INVALID_DIRECTION)
+        _pathfindStats.FailedCalls++;
+    return direction;
+}
+
+PathfindStats peep_pathfind_get_stats()
+{
+    return _pathfindStats;
+}
+
+void peep_pathfind_reset_stats()
+{
+    _pathfindStats = {};
+}
+
+void peep_pathfind_clear_search_cache()
+{
+    _peepPathFindSearchCache.clear();
+    _pathThinJunctionCache.clear();
+    _pathDestinationCache.clear();
+}
+
 /**
  * Gets the nearest park entrance relative to point, by using Manhattan distance.
  * @param x x coordinate of location
@@ -41,6 +41,35 @@ extern bool gPeepPathFindIgnoreForeignQueues;
 // the direction the peep should walk in from the current tile.
 Direction peep_pathfind_choose_direction(const TileCoordsXYZ& loc, Peep* peep);
 
+// Counters of the work done by peep_pathfind_choose_direction, summed since the last reset. They do not affect the
+// game state, so they can be read and reset at any time.
+struct PathfindStats
+{
+    uint64_t Calls{};
+    // Heuristic searches run, one per edge tried, and those answered by the shared search cache instead.
+    uint64_t Searches{};
+    uint64_t CachedSearches{};
+    // Tiles the searches stepped onto and thin junctions they passed through.
+    uint64_t TilesChecked{};
+    uint64_t JunctionsVisited{};
+    // The deepest search path in tiles, searches stop at 200.
+    uint32_t MaxDepth{};
+    // Calls in which a search ran out of tiles or junctions before it could reach the goal.
+    uint64_t TileLimitCalls{};
+    uint64_t JunctionLimitCalls{};
+    uint64_t FailedCalls{};
+    // Time spent in the calls, in nanoseconds.
+    uint64_t TotalTime{};
+    uint64_t MaxTime{};
+};
+
+PathfindStats peep_pathfind_get_stats();
+void peep_pathfind_reset_stats();
+
+// Forget the shared guest search results and the path connectivity found by the searches. They are only valid while
+// the map does not change, which is the case for the duration of the peep update.
+void peep_pathfind_clear_search_cache();
+
 // Test whether the given tile can be walked onto, if the peep is currently at height currentZ and
 // moving in direction currentDirection.
 bool IsValidPathZAndDirection(TileElement* tileElement, int32_t currentZ, int32_t currentDirection);
@@ -202,6 +202,18 @@ void peep_update_all()
     if (gScreenFlags & SCREEN_FLAGS_EDITOR)
         return;
 
+    peep_update_ride_consideration();
+
+    // The planning phase only precomputes results the serial update below would compute anyway, so whether it runs
+    // does not change the outcome of the tick.
+    if (gConfigGeneral.multithreading)
+    {
+        peep_plan_guest_updates();
+    }
+
+    // Searches done since the last update may have seen a different map.
+    peep_pathfind_clear_search_cache();
+
     int32_t i = 0;
     // Warning this loop can delete peeps
     for (auto peep : EntityList<Guest>())
@@ -241,6 +253,9 @@ void peep_update_all()
 
         i++;
     }
+
+    peep_clear_guest_plans();
+    peep_pathfind_clear_search_cache();
 }
 
 /**
@@ -650,6 +665,11 @@ void peep_sprite_remove(Peep* peep)
     if (wasGuest)
     {
         News::DisableNewsItems(News::ItemType::PeepOnRide, peep->sprite_index);
+
+        // The guest list drops just this guest, so tell it while the guest still exists
+        auto intent = Intent(INTENT_ACTION_REMOVE_GUEST_FROM_LIST);
+        intent.putExtra(INTENT_EXTRA_PEEP, peep);
+        context_broadcast_intent(&intent);
     }
     else
     {
@@ -660,8 +680,11 @@ void peep_sprite_remove(Peep* peep)
     }
     sprite_remove(peep);
 
-    auto intent = Intent(wasGuest ? INTENT_ACTION_REFRESH_GUEST_LIST : INTENT_ACTION_REFRESH_STAFF_LIST);
-    context_broadcast_intent(&intent);
+    if (!wasGuest)
+    {
+        auto intent = Intent(INTENT_ACTION_REFRESH_STAFF_LIST);
+        context_broadcast_intent(&intent);
+    }
 }
 
 /**
@@ -676,6 +699,7 @@ void Peep::Remove()
         {
             decrement_guests_in_park();
             auto intent = Intent(INTENT_ACTION_UPDATE_GUEST_COUNT);
+            intent.putExtra(INTENT_EXTRA_PEEP, guest);
             context_broadcast_intent(&intent);
         }
         if (State == PeepState::EnteringPark)
@@ -992,73 +1016,18 @@ void Peep::Update()
  *
  *  rct2: 0x0069BF41
  */
-void peep_problem_warnings_update()
+void peep_problem_warnings_update(const ParkGuestStatistics& guestStatistics)
 {
-    Ride* ride;
-    uint32_t hunger_counter = 0, lost_counter = 0, noexit_counter = 0, thirst_counter = 0, litter_counter = 0,
-             disgust_counter = 0, toilet_counter = 0, vandalism_counter = 0;
+    const auto hunger_counter = guestStatistics.HungryGuestsNotHeadingForFood;
+    const auto thirst_counter = guestStatistics.ThirstyGuestsNotHeadingForDrinks;
+    const auto toilet_counter = guestStatistics.GuestsNotHeadingForToilet;
+    const auto lost_counter = guestStatistics.GetFreshThoughtCount(PeepThoughtType::Lost);
+    const auto litter_counter = guestStatistics.GetFreshThoughtCount(PeepThoughtType::BadLitter);
+    const auto noexit_counter = guestStatistics.GetFreshThoughtCount(PeepThoughtType::CantFindExit);
+    const auto disgust_counter = guestStatistics.GetFreshThoughtCount(PeepThoughtType::PathDisgusting);
+    const auto vandalism_counter = guestStatistics.GetFreshThoughtCount(PeepThoughtType::Vandalism);
     uint8_t* warning_throttle = gPeepWarningThrottle;
 
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark || peep->Thoughts[0].freshness > 5)
-            continue;
-
-        switch (peep->Thoughts[0].type)
-        {
-            case PeepThoughtType::Lost: // 0x10
-                lost_counter++;
-                break;
-
-            case PeepThoughtType::Hungry: // 0x14
-                if (peep->GuestHeadingToRideId == RIDE_ID_NULL)
-                {
-                    hunger_counter++;
-                    break;
-                }
-                ride = get_ride(peep->GuestHeadingToRideId);
-                if (ride != nullptr && !ride->GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_FLAT_RIDE))
-                    hunger_counter++;
-                break;
-
-            case PeepThoughtType::Thirsty:
-                if (peep->GuestHeadingToRideId == RIDE_ID_NULL)
-                {
-                    thirst_counter++;
-                    break;
-                }
-                ride = get_ride(peep->GuestHeadingToRideId);
-                if (ride != nullptr && !ride->GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_SELLS_DRINKS))
-                    thirst_counter++;
-                break;
-
-            case PeepThoughtType::Toilet:
-                if (peep->GuestHeadingToRideId == RIDE_ID_NULL)
-                {
-                    toilet_counter++;
-                    break;
-                }
-                ride = get_ride(peep->GuestHeadingToRideId);
-                if (ride != nullptr && !ride->GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_IS_TOILET))
-                    toilet_counter++;
-                break;
-
-            case PeepThoughtType::BadLitter: // 0x1a
-                litter_counter++;
-                break;
-            case PeepThoughtType::CantFindExit: // 0x1b
-                noexit_counter++;
-                break;
-            case PeepThoughtType::PathDisgusting: // 0x1f
-                disgust_counter++;
-                break;
-            case PeepThoughtType::Vandalism: // 0x21
-                vandalism_counter++;
-                break;
-            default:
-                break;
-        }
-    }
     // could maybe be packed into a loop, would lose a lot of clarity though
     if (warning_throttle[0])
         --warning_throttle[0];
@@ -1176,21 +1145,45 @@ void peep_update_crowd_noise()
 
     // Count the number of peeps visible
     auto visiblePeeps = 0;
-
-    for (auto peep : EntityList<Guest>())
-    {
+    auto countPeep = [viewport, &visiblePeeps](const Guest* peep) {
         if (peep->sprite_left == LOCATION_NULL)
-            continue;
+            return;
         if (viewport->viewPos.x > peep->sprite_right)
-            continue;
+            return;
         if (viewport->viewPos.x + viewport->view_width < peep->sprite_left)
-            continue;
+            return;
         if (viewport->viewPos.y > peep->sprite_bottom)
-            continue;
+            return;
         if (viewport->viewPos.y + viewport->view_height < peep->sprite_top)
-            continue;
+            return;
 
         visiblePeeps += peep->State == PeepState::Queuing ? 1 : 2;
+    };
+
+    // Peep sprites reach less than 256 pixels from their position, so only the tiles they could be visible from need to
+    // be searched. Zoomed out far enough it is quicker to test every guest.
+    auto range = viewport_get_entity_map_range(viewport, 256);
+    auto numTiles = static_cast<size_t>((range.GetRight() - range.GetLeft()) / COORDS_XY_STEP + 1)
+        * ((range.GetBottom() - range.GetTop()) / COORDS_XY_STEP + 1);
+    if (numTiles < GetEntityListCount(EntityType::Guest))
+    {
+        for (int32_t y = range.GetTop(); y <= range.GetBottom(); y += COORDS_XY_STEP)
+        {
+            for (int32_t x = range.GetLeft(); x <= range.GetRight(); x += COORDS_XY_STEP)
+            {
+                for (auto peep : EntityTileList<Guest>({ x, y }))
+                {
+                    countPeep(peep);
+                }
+            }
+        }
+    }
+    else
+    {
+        for (auto peep : EntityList<Guest>())
+        {
+            countPeep(peep);
+        }
     }
 
     // This function doesn't account for the fact that the screen might be so big that 100 peeps could potentially be very
@@ -1702,16 +1695,13 @@ static bool peep_interact_with_entrance(Peep* peep, const CoordsXYE& coords, uin
         guest->SetState(PeepState::Queuing);
         guest->RideSubState = PeepRideSubState::AtQueueFront;
         guest->TimeInQueue = 0;
-        if (guest->PeepFlags & PEEP_FLAGS_TRACKING)
+        if ((guest->PeepFlags & PEEP_FLAGS_TRACKING) && gConfigNotifications.guest_queuing_for_ride)
         {
             auto ft = Formatter();
             guest->FormatNameTo(ft);
             ride->FormatNameTo(ft);
-            if (gConfigNotifications.guest_queuing_for_ride)
-            {
-                News::AddItemToQueue(
-                    News::ItemType::PeepOnRide, STR_PEEP_TRACKING_PEEP_JOINED_QUEUE_FOR_X, guest->sprite_index, ft);
-            }
+            News::AddItemToQueue(
+                News::ItemType::PeepOnRide, STR_PEEP_TRACKING_PEEP_JOINED_QUEUE_FOR_X, guest->sprite_index, ft);
         }
     }
     else
@@ -1764,14 +1754,11 @@ static bool peep_interact_with_entrance(Peep* peep, const CoordsXYE& coords, uin
             guest->SetState(PeepState::LeavingPark);
 
             guest->Var37 = 0;
-            if (guest->PeepFlags & PEEP_FLAGS_TRACKING)
+            if ((guest->PeepFlags & PEEP_FLAGS_TRACKING) && gConfigNotifications.guest_left_park)
             {
                 auto ft = Formatter();
                 guest->FormatNameTo(ft);
-                if (gConfigNotifications.guest_left_park)
-                {
-                    News::AddItemToQueue(News::ItemType::PeepOnRide, STR_PEEP_TRACKING_LEFT_PARK, guest->sprite_index, ft);
-                }
+                News::AddItemToQueue(News::ItemType::PeepOnRide, STR_PEEP_TRACKING_LEFT_PARK, guest->sprite_index, ft);
             }
             return true;
         }
@@ -2132,16 +2119,13 @@ static void peep_interact_with_path(Peep* peep, const CoordsXYE& coords)
                     guest->RideSubState = PeepRideSubState::InQueue;
                     guest->DestinationTolerance = 2;
                     guest->TimeInQueue = 0;
-                    if (guest->PeepFlags & PEEP_FLAGS_TRACKING)
+                    if ((guest->PeepFlags & PEEP_FLAGS_TRACKING) && gConfigNotifications.guest_queuing_for_ride)
                     {
                         auto ft = Formatter();
                         guest->FormatNameTo(ft);
                         ride->FormatNameTo(ft);
-                        if (gConfigNotifications.guest_queuing_for_ride)
-                        {
-                            News::AddItemToQueue(
-                                News::ItemType::PeepOnRide, STR_PEEP_TRACKING_PEEP_JOINED_QUEUE_FOR_X, guest->sprite_index, ft);
-                        }
+                        News::AddItemToQueue(
+                            News::ItemType::PeepOnRide, STR_PEEP_TRACKING_PEEP_JOINED_QUEUE_FOR_X, guest->sprite_index, ft);
                     }
 
                     peep_footpath_move_forward(guest, { coords, tile_element }, vandalism_present);
@@ -2245,7 +2229,7 @@ static bool peep_interact_with_shop(Peep* peep, const CoordsXYE& coords)
 
         guest->GuestTimeOnRide = 0;
         ride->cur_num_customers++;
-        if (guest->PeepFlags & PEEP_FLAGS_TRACKING)
+        if ((guest->PeepFlags & PEEP_FLAGS_TRACKING) && gConfigNotifications.guest_used_facility)
         {
             auto ft = Formatter();
             guest->FormatNameTo(ft);
@@ -2253,10 +2237,7 @@ static bool peep_interact_with_shop(Peep* peep, const CoordsXYE& coords)
             rct_string_id string_id = ride->GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_IN_RIDE)
                 ? STR_PEEP_TRACKING_PEEP_IS_IN_X
                 : STR_PEEP_TRACKING_PEEP_IS_ON_X;
-            if (gConfigNotifications.guest_used_facility)
-            {
-                News::AddItemToQueue(News::ItemType::PeepOnRide, string_id, guest->sprite_index, ft);
-            }
+            News::AddItemToQueue(News::ItemType::PeepOnRide, string_id, guest->sprite_index, ft);
         }
     }
     else
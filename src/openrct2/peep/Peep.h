@@ -50,6 +50,7 @@ constexpr auto PEEP_CLEARANCE_HEIGHT = 4 * COORDS_Z_STEP;
 class Formatter;
 struct TileElement;
 struct Ride;
+struct ParkGuestStatistics;
 class DataSerialiser;
 
 namespace GameActions
@@ -749,6 +750,8 @@ public:
     void TryGetUpFromSitting();
     void ChoseNotToGoOnRide(Ride* ride, bool peepAtRide, bool updateLastRide);
     void PickRideToGoOn();
+    bool CanPickRideToGoOn() const;
+    std::bitset<MAX_RIDES> ComputeRidesToGoOn() const;
     void ReadMap();
     bool ShouldGoOnRide(Ride* ride, int32_t entranceNum, bool atQueue, bool thinking);
     bool ShouldGoToShop(Ride* ride, bool peepAtShop);
@@ -823,7 +826,7 @@ private:
     void MakePassingPeepsSick(Guest* passingPeep);
     void GivePassingPeepsIceCream(Guest* passingPeep);
     Ride* FindBestRideToGoOn();
-    std::bitset<MAX_RIDES> FindRidesToGoOn();
+    std::bitset<MAX_RIDES> FindRidesToGoOn() const;
     bool FindVehicleToEnter(Ride* ride, std::vector<uint8_t>& car_array);
     void GoToRideEntrance(Ride* ride);
 };
@@ -998,7 +1001,10 @@ extern uint8_t gPeepWarningThrottle[16];
 
 int32_t peep_get_staff_count();
 void peep_update_all();
-void peep_problem_warnings_update();
+void peep_update_ride_consideration();
+void peep_plan_guest_updates();
+void peep_clear_guest_plans();
+void peep_problem_warnings_update(const ParkGuestStatistics& guestStatistics);
 void peep_stop_crowd_noise();
 void peep_update_crowd_noise();
 void peep_update_days_in_queue();
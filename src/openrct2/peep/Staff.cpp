@@ -141,24 +141,24 @@ bool staff_hire_new_member(StaffType staffType, EntertainerCostume entertainerTy
  */
 void staff_update_greyed_patrol_areas()
 {
-    for (int32_t staff_type = 0; staff_type < static_cast<uint8_t>(StaffType::Count); ++staff_type)
+    // The combined areas of every staff type follow the areas of the individual staff members
+    auto* typePatrolAreas = &gStaffPatrolAreas[STAFF_MAX_COUNT * STAFF_PATROL_AREA_SIZE];
+    std::fill_n(typePatrolAreas, static_cast<uint8_t>(StaffType::Count) * STAFF_PATROL_AREA_SIZE, 0);
+
+    // A single pass over the staff, each member only adds to the area of its own type
+    for (auto peep : EntityList<Staff>())
     {
-        int32_t staffPatrolOffset = (staff_type + STAFF_MAX_COUNT) * STAFF_PATROL_AREA_SIZE;
-        for (int32_t i = 0; i < STAFF_PATROL_AREA_SIZE; i++)
+        const auto staffType = static_cast<uint8_t>(peep->AssignedStaffType);
+        if (staffType >= static_cast<uint8_t>(StaffType::Count))
         {
-            gStaffPatrolAreas[staffPatrolOffset + i] = 0;
+            continue;
         }
 
-        for (auto peep : EntityList<Staff>())
+        auto* typePatrolArea = &typePatrolAreas[staffType * STAFF_PATROL_AREA_SIZE];
+        const auto* peepPatrolArea = &gStaffPatrolAreas[peep->StaffId * STAFF_PATROL_AREA_SIZE];
+        for (int32_t i = 0; i < STAFF_PATROL_AREA_SIZE; i++)
         {
-            if (static_cast<uint8_t>(peep->AssignedStaffType) == staff_type)
-            {
-                int32_t peepPatrolOffset = peep->StaffId * STAFF_PATROL_AREA_SIZE;
-                for (int32_t i = 0; i < STAFF_PATROL_AREA_SIZE; i++)
-                {
-                    gStaffPatrolAreas[staffPatrolOffset + i] |= gStaffPatrolAreas[peepPatrolOffset + i];
-                }
-            }
+            typePatrolArea[i] |= peepPatrolArea[i];
         }
     }
 }
@@ -422,20 +422,33 @@ void staff_toggle_patrol_area(int32_t staffIndex, const CoordsXY& coords)
  */
 Direction Staff::HandymanDirectionToNearestLitter() const
 {
+    // Only litter within MAX_LITTER_DISTANCE is of interest, so only the tiles in that range are searched. Ties go to
+    // the lowest sprite index, the same litter a search of the whole litter list would find.
     uint16_t nearestLitterDist = 0xFFFF;
     Litter* nearestLitter = nullptr;
-    for (auto litter : EntityList<Litter>())
+    const int32_t tileX0 = std::max(0, (x - MAX_LITTER_DISTANCE) / COORDS_XY_STEP);
+    const int32_t tileY0 = std::max(0, (y - MAX_LITTER_DISTANCE) / COORDS_XY_STEP);
+    const int32_t tileX1 = std::min(MAXIMUM_MAP_SIZE_TECHNICAL - 1, (x + MAX_LITTER_DISTANCE) / COORDS_XY_STEP);
+    const int32_t tileY1 = std::min(MAXIMUM_MAP_SIZE_TECHNICAL - 1, (y + MAX_LITTER_DISTANCE) / COORDS_XY_STEP);
+    for (int32_t tileY = tileY0; tileY <= tileY1; tileY++)
     {
-        uint16_t distance = abs(litter->x - x) + abs(litter->y - y) + abs(litter->z - z) * 4;
-
-        if (distance < nearestLitterDist)
+        for (int32_t tileX = tileX0; tileX <= tileX1; tileX++)
         {
-            nearestLitterDist = distance;
-            nearestLitter = litter;
+            for (auto litter : EntityTileList<Litter>(TileCoordsXY{ tileX, tileY }.ToCoordsXY()))
+            {
+                uint16_t distance = abs(litter->x - x) + abs(litter->y - y) + abs(litter->z - z) * 4;
+
+                if (distance < nearestLitterDist
+                    || (distance == nearestLitterDist && litter->sprite_index < nearestLitter->sprite_index))
+                {
+                    nearestLitterDist = distance;
+                    nearestLitter = litter;
+                }
+            }
         }
     }
 
-    if (nearestLitterDist > MAX_LITTER_DISTANCE)
+    if (nearestLitter == nullptr || nearestLitterDist > MAX_LITTER_DISTANCE)
     {
         return INVALID_DIRECTION;
     }
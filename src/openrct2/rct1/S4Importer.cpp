@@ -17,12 +17,13 @@
 #include "../audio/audio.h"
 #include "../core/Collections.hpp"
 #include "../core/Console.hpp"
-#include "../core/FileStream.h"
 #include "../core/Guard.hpp"
 #include "../core/IStream.hpp"
 #include "../core/Memory.hpp"
+#include "../core/MemoryMappedFileStream.h"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
+#include "../core/TaskScheduler.h"
 #include "../interface/Window.h"
 #include "../localisation/Date.h"
 #include "../localisation/Localisation.h"
@@ -68,6 +69,7 @@
 #include <algorithm>
 #include <iterator>
 #include <memory>
+#include <utility>
 #include <vector>
 
 static constexpr const ObjectEntryIndex OBJECT_ENTRY_INDEX_IGNORE = 254;
@@ -139,6 +141,9 @@ private:
     ObjectEntryIndex _pathAdditionTypeToEntryMap[16]{};
     ObjectEntryIndex _sceneryThemeTypeToEntryMap[24]{};
 
+    // Elements whose banner still has to be imported, by index into their row of tiles
+    using TileElementBannerList = std::vector<std::pair<size_t, const RCT12TileElement*>>;
+
     // Research
     std::bitset<MAX_RIDE_OBJECTS> _researchRideEntryUsed{};
     std::bitset<RCT1_RIDE_TYPE_COUNT> _researchRideTypeUsed{};
@@ -166,14 +171,14 @@ public:
 
     ParkLoadResult LoadSavedGame(const utf8* path, bool skipObjectCheck = false) override
     {
-        auto fs = FileStream(path, FILE_MODE_OPEN);
+        auto fs = MemoryMappedFileStream(path);
         auto result = LoadFromStream(&fs, false, skipObjectCheck, path);
         return result;
     }
 
     ParkLoadResult LoadScenario(const utf8* path, bool skipObjectCheck = false) override
     {
-        auto fs = FileStream(path, FILE_MODE_OPEN);
+        auto fs = MemoryMappedFileStream(path);
         auto result = LoadFromStream(&fs, true, skipObjectCheck, path);
         return result;
     }
@@ -1483,45 +1488,76 @@ private:
         // Build tile pointer cache (needed to get the first element at a certain location)
         auto tilePointerIndex = TilePointerIndex<RCT12TileElement>(RCT1_MAX_MAP_SIZE, _s4.tile_elements);
 
+        // Each row of tiles is converted on its own so the rows can be imported in parallel. The banners are shared by
+        // the whole map, so they are imported afterwards in map order.
+        std::vector<std::vector<TileElement>> rows(MAXIMUM_MAP_SIZE_TECHNICAL);
+        std::vector<TileElementBannerList> rowBanners(MAXIMUM_MAP_SIZE_TECHNICAL);
+        OpenRCT2::TaskScheduler::Get().ParallelFor(0, MAXIMUM_MAP_SIZE_TECHNICAL, 8, [&](size_t y) {
+            ImportTileElementRow(tilePointerIndex, static_cast<int32_t>(y), rows[y], rowBanners[y]);
+        });
+
+        size_t numElements = 0;
+        for (const auto& row : rows)
+        {
+            numElements += row.size();
+        }
+
         std::vector<TileElement> tileElements;
-        for (TileCoordsXY coords = { 0, 0 }; coords.y < MAXIMUM_MAP_SIZE_TECHNICAL; coords.y++)
+        tileElements.reserve(numElements);
+        for (size_t y = 0; y < rows.size(); y++)
         {
-            for (coords.x = 0; coords.x < MAXIMUM_MAP_SIZE_TECHNICAL; coords.x++)
+            auto rowStart = tileElements.size();
+            tileElements.insert(tileElements.end(), rows[y].begin(), rows[y].end());
+            for (const auto& [index, srcElement] : rowBanners[y])
             {
-                if (coords.x >= RCT1_MAX_MAP_SIZE || coords.y >= RCT1_MAX_MAP_SIZE)
-                {
-                    auto& dstElement = tileElements.emplace_back();
-                    dstElement.ClearAs(TILE_ELEMENT_TYPE_SURFACE);
-                    dstElement.SetLastForTile(true);
-                }
-                else
-                {
-                    // This is the equivalent of map_get_first_element_at(x, y), but on S4 data.
-                    RCT12TileElement* srcElement = tilePointerIndex.GetFirstElementAt(coords);
-                    do
-                    {
-                        if (srcElement->base_height == RCT12_MAX_ELEMENT_HEIGHT)
-                            continue;
+                ImportTileElementBanner(&tileElements[rowStart + index], srcElement);
+            }
+        }
 
-                        // Reserve 8 elements for import
-                        auto originalSize = tileElements.size();
-                        tileElements.resize(originalSize + 16);
-                        auto dstElement = tileElements.data() + originalSize;
-                        auto numAddedElements = ImportTileElement(dstElement, srcElement);
-                        tileElements.resize(originalSize + numAddedElements);
-                    } while (!(srcElement++)->IsLastForTile());
+        SetTileElements(std::move(tileElements));
+        FixEntrancePositions();
+    }
 
-                    // Set last element flag in case the original last element was never added
-                    if (tileElements.size() > 0)
+    void ImportTileElementRow(
+        TilePointerIndex<RCT12TileElement>& tilePointerIndex, int32_t y, std::vector<TileElement>& tileElements,
+        TileElementBannerList& banners)
+    {
+        for (TileCoordsXY coords = { 0, y }; coords.x < MAXIMUM_MAP_SIZE_TECHNICAL; coords.x++)
+        {
+            if (coords.x >= RCT1_MAX_MAP_SIZE || coords.y >= RCT1_MAX_MAP_SIZE)
+            {
+                auto& dstElement = tileElements.emplace_back();
+                dstElement.ClearAs(TILE_ELEMENT_TYPE_SURFACE);
+                dstElement.SetLastForTile(true);
+            }
+            else
+            {
+                // This is the equivalent of map_get_first_element_at(x, y), but on S4 data.
+                RCT12TileElement* srcElement = tilePointerIndex.GetFirstElementAt(coords);
+                do
+                {
+                    if (srcElement->base_height == RCT12_MAX_ELEMENT_HEIGHT)
+                        continue;
+
+                    // Reserve 8 elements for import
+                    auto originalSize = tileElements.size();
+                    tileElements.resize(originalSize + 16);
+                    auto dstElement = tileElements.data() + originalSize;
+                    auto numAddedElements = ImportTileElement(dstElement, srcElement);
+                    tileElements.resize(originalSize + numAddedElements);
+                    if (numAddedElements != 0 && srcElement->GetType() == TILE_ELEMENT_TYPE_BANNER)
                     {
-                        tileElements.back().SetLastForTile(true);
+                        banners.emplace_back(originalSize, srcElement);
                     }
+                } while (!(srcElement++)->IsLastForTile());
+
+                // Set last element flag in case the original last element was never added
+                if (tileElements.size() > 0)
+                {
+                    tileElements.back().SetLastForTile(true);
                 }
             }
         }
-
-        SetTileElements(std::move(tileElements));
-        FixEntrancePositions();
     }
 
     size_t ImportTileElement(TileElement* dst, const RCT12TileElement* src)
@@ -1809,25 +1845,8 @@ private:
                 dst2->SetPosition(src2->GetPosition());
                 dst2->SetAllowedEdges(src2->GetAllowedEdges());
 
-                auto index = src2->GetIndex();
-                if (index < std::size(_s4.banners))
-                {
-                    auto srcBanner = &_s4.banners[index];
-                    auto dstBanner = GetOrCreateBanner(index);
-                    if (dstBanner == nullptr)
-                    {
-                        dst2->SetIndex(BANNER_INDEX_NULL);
-                    }
-                    else
-                    {
-                        ImportBanner(dstBanner, srcBanner);
-                        dst2->SetIndex(index);
-                    }
-                }
-                else
-                {
-                    dst2->SetIndex(BANNER_INDEX_NULL);
-                }
+                // Banner information is imported by ImportTileElementBanner
+                dst2->SetIndex(BANNER_INDEX_NULL);
                 return 1;
             }
             default:
@@ -1837,6 +1856,28 @@ private:
         return 0;
     }
 
+    /**
+     * Imports the banner of a banner element. This modifies the banner list shared by the whole map, so unlike
+     * ImportTileElement it must not be called in parallel.
+     */
+    void ImportTileElementBanner(TileElement* dst, const RCT12TileElement* src)
+    {
+        auto dst2 = dst->AsBanner();
+        auto src2 = src->AsBanner();
+
+        auto index = src2->GetIndex();
+        if (index < std::size(_s4.banners))
+        {
+            auto srcBanner = &_s4.banners[index];
+            auto dstBanner = GetOrCreateBanner(index);
+            if (dstBanner != nullptr)
+            {
+                ImportBanner(dstBanner, srcBanner);
+                dst2->SetIndex(index);
+            }
+        }
+    }
+
     void ImportResearch()
     {
         // All available objects must be loaded before this method is called as it
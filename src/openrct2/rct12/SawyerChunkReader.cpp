@@ -11,6 +11,9 @@
 
 #include "../core/IStream.hpp"
 
+#include <algorithm>
+#include <cstring>
+
 // malloc is very slow for large allocations in MSVC debug builds as it allocates
 // memory on a special debug heap and then initialises all the memory to 0xCC.
 #if defined(_WIN32) && defined(DEBUG)
@@ -27,6 +30,120 @@ constexpr const char* EXCEPTION_MSG_DESTINATION_TOO_SMALL = "Chunk data larger t
 constexpr const char* EXCEPTION_MSG_INVALID_CHUNK_ENCODING = "Invalid chunk encoding.";
 constexpr const char* EXCEPTION_MSG_ZERO_SIZED_CHUNK = "Encountered zero-sized chunk.";
 
+/**
+ * Thrown when the decoded chunk does not fit the destination, so ReadChunk can tell it apart from corrupt data.
+ */
+class SawyerChunkDestinationException final : public SawyerChunkException
+{
+public:
+    SawyerChunkDestinationException()
+        : SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL)
+    {
+    }
+};
+
+/**
+ * Decodes the repeat encoding one code byte at a time. This allows the output of the RLE decoder to be fed straight
+ * into it, rather than decoding the whole RLE stage into an intermediate buffer first.
+ */
+class SawyerRepeatDecoder final
+{
+private:
+    uint8_t* const _dst;
+    uint8_t* _dstCurrent;
+    uint8_t* const _dstEnd;
+    bool _literalNext = false;
+
+public:
+    SawyerRepeatDecoder(void* dst, size_t dstCapacity)
+        : _dst(static_cast<uint8_t*>(dst))
+        , _dstCurrent(_dst)
+        , _dstEnd(_dst + dstCapacity)
+    {
+    }
+
+    void Push(uint8_t code)
+    {
+        if (_literalNext)
+        {
+            if (_dstCurrent == _dstEnd)
+            {
+                throw SawyerChunkDestinationException();
+            }
+            *_dstCurrent++ = code;
+            _literalNext = false;
+        }
+        else if (code == 0xFF)
+        {
+            _literalNext = true;
+        }
+        else
+        {
+            size_t count = (code & 7) + 1;
+            size_t distance = 32 - (code >> 3);
+            if (count > static_cast<size_t>(_dstEnd - _dstCurrent))
+            {
+                throw SawyerChunkDestinationException();
+            }
+            // The copy has to lie completely within the data already written
+            if (distance > static_cast<size_t>(_dstCurrent - _dst) || count > distance)
+            {
+                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
+            }
+
+            std::memcpy(_dstCurrent, _dstCurrent - distance, count);
+            _dstCurrent += count;
+        }
+    }
+
+    size_t Finish() const
+    {
+        if (_literalNext)
+        {
+            throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
+        }
+        return static_cast<size_t>(_dstCurrent - _dst);
+    }
+};
+
+/**
+ * Walks the RLE runs of src, calling fill(count, value) for repeated bytes and copy(data, count) for literal bytes.
+ */
+template<typename TFill, typename TCopy>
+static void DecodeRLERuns(const void* src, size_t srcLength, TFill&& fill, TCopy&& copy)
+{
+    auto src8 = static_cast<const uint8_t*>(src);
+    for (size_t i = 0; i < srcLength; i++)
+    {
+        uint8_t rleCodeByte = src8[i];
+        if (rleCodeByte & 128)
+        {
+            i++;
+            size_t count = 257 - rleCodeByte;
+
+            if (i >= srcLength)
+            {
+                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
+            }
+            fill(count, src8[i]);
+        }
+        else
+        {
+            if (i + 1 >= srcLength)
+            {
+                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
+            }
+            if (i + 1 + rleCodeByte + 1 > srcLength)
+            {
+                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
+            }
+
+            copy(src8 + i + 1, static_cast<size_t>(rleCodeByte) + 1);
+            i += rleCodeByte + 1;
+        }
+    }
+}
+
 SawyerChunkReader::SawyerChunkReader(OpenRCT2::IStream* stream, bool persistentChunks)
     : _stream(stream)
     , _createsPersistentChunks(persistentChunks)
@@ -65,16 +182,13 @@ std::shared_ptr<SawyerChunk> SawyerChunkReader::ReadChunk()
             case CHUNK_ENCODING_RLECOMPRESSED:
             case CHUNK_ENCODING_ROTATE:
             {
-                std::unique_ptr<uint8_t[]> compressedData(new uint8_t[header.length]);
-                if (_stream->TryRead(compressedData.get(), header.length) != header.length)
-                {
-                    throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
-                }
+                std::unique_ptr<uint8_t[]> compressedDataStorage;
+                auto compressedData = ReadChunkData(header.length, compressedDataStorage);
 
                 auto buffer = static_cast<uint8_t*>(AllocateLargeTempBuffer());
                 try
                 {
-                    size_t uncompressedLength = DecodeChunk(buffer, MAX_UNCOMPRESSED_CHUNK_SIZE, compressedData.get(), header);
+                    size_t uncompressedLength = DecodeChunk(buffer, MAX_UNCOMPRESSED_CHUNK_SIZE, compressedData, header);
                     if (uncompressedLength == 0)
                     {
                         throw SawyerChunkException(EXCEPTION_MSG_ZERO_SIZED_CHUNK);
@@ -116,16 +230,12 @@ std::shared_ptr<SawyerChunk> SawyerChunkReader::ReadChunkTrack()
             throw SawyerChunkException(EXCEPTION_MSG_ZERO_SIZED_CHUNK);
         }
         uint32_t compressedDataLength = compressedDataLength64;
-        auto compressedData = std::make_unique<uint8_t[]>(compressedDataLength);
-
-        if (_stream->TryRead(compressedData.get(), compressedDataLength) != compressedDataLength)
-        {
-            throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
-        }
+        std::unique_ptr<uint8_t[]> compressedDataStorage;
+        auto compressedData = ReadChunkData(compressedDataLength, compressedDataStorage);
 
         auto buffer = static_cast<uint8_t*>(AllocateLargeTempBuffer());
         sawyercoding_chunk_header header{ CHUNK_ENCODING_RLE, compressedDataLength };
-        size_t uncompressedLength = DecodeChunk(buffer, MAX_UNCOMPRESSED_CHUNK_SIZE, compressedData.get(), header);
+        size_t uncompressedLength = DecodeChunk(buffer, MAX_UNCOMPRESSED_CHUNK_SIZE, compressedData, header);
         if (uncompressedLength == 0)
         {
             throw SawyerChunkException(EXCEPTION_MSG_ZERO_SIZED_CHUNK);
@@ -146,23 +256,69 @@ std::shared_ptr<SawyerChunk> SawyerChunkReader::ReadChunkTrack()
 
 void SawyerChunkReader::ReadChunk(void* dst, size_t length)
 {
-    auto chunk = ReadChunk();
-    auto chunkData = static_cast<const uint8_t*>(chunk->GetData());
-    auto chunkLength = chunk->GetLength();
-    if (chunkLength > length)
+    uint64_t originalPosition = _stream->GetPosition();
+    try
     {
-        std::memcpy(dst, chunkData, length);
+        auto header = _stream->ReadValue<sawyercoding_chunk_header>();
+        if (header.length >= MAX_UNCOMPRESSED_CHUNK_SIZE)
+            throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
+
+        std::unique_ptr<uint8_t[]> compressedDataStorage;
+        auto compressedData = ReadChunkData(header.length, compressedDataStorage);
+
+        // Decode straight into the destination, nearly all chunks fit it exactly
+        size_t uncompressedLength;
+        try
+        {
+            uncompressedLength = DecodeChunk(dst, length, compressedData, header);
+        }
+        catch (const SawyerChunkDestinationException&)
+        {
+            // The chunk is larger than the destination, decode it in full and only keep what fits
+            auto buffer = std::unique_ptr<uint8_t, decltype(&FreeLargeTempBuffer)>(
+                static_cast<uint8_t*>(AllocateLargeTempBuffer()), &FreeLargeTempBuffer);
+            uncompressedLength = DecodeChunk(buffer.get(), MAX_UNCOMPRESSED_CHUNK_SIZE, compressedData, header);
+            std::memcpy(dst, buffer.get(), std::min(length, uncompressedLength));
+        }
+        if (uncompressedLength == 0)
+        {
+            throw SawyerChunkException(EXCEPTION_MSG_ZERO_SIZED_CHUNK);
+        }
+
+        if (uncompressedLength < length)
+        {
+            auto offset = static_cast<uint8_t*>(dst) + uncompressedLength;
+            std::fill_n(offset, length - uncompressedLength, 0x00);
+        }
+    }
+    catch (const std::exception&)
+    {
+        // Rewind stream back to original position
+        _stream->SetPosition(originalPosition);
+        throw;
     }
-    else
+}
+
+const uint8_t* SawyerChunkReader::ReadChunkData(size_t length, std::unique_ptr<uint8_t[]>& storage)
+{
+    auto data = static_cast<const uint8_t*>(_stream->GetData());
+    if (data != nullptr)
     {
-        std::memcpy(dst, chunkData, chunkLength);
-        auto remainingLength = length - chunkLength;
-        if (remainingLength > 0)
+        auto position = _stream->GetPosition();
+        if (length > _stream->GetLength() - position)
         {
-            auto offset = static_cast<uint8_t*>(dst) + chunkLength;
-            std::fill_n(offset, remainingLength, 0x00);
+            throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
         }
+        _stream->Seek(length, OpenRCT2::STREAM_SEEK_CURRENT);
+        return data + position;
     }
+
+    storage = std::make_unique<uint8_t[]>(length);
+    if (_stream->TryRead(storage.get(), length) != length)
+    {
+        throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
+    }
+    return storage.get();
 }
 
 void SawyerChunkReader::FreeChunk(void* data)
@@ -178,7 +334,7 @@ size_t SawyerChunkReader::DecodeChunk(void* dst, size_t dstCapacity, const void*
         case CHUNK_ENCODING_NONE:
             if (header.length > dstCapacity)
             {
-                throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
+                throw SawyerChunkDestinationException();
             }
             std::memcpy(dst, src, header.length);
             resultLength = header.length;
@@ -200,113 +356,70 @@ size_t SawyerChunkReader::DecodeChunk(void* dst, size_t dstCapacity, const void*
 
 size_t SawyerChunkReader::DecodeChunkRLERepeat(void* dst, size_t dstCapacity, const void* src, size_t srcLength)
 {
-    auto immBuffer = std::unique_ptr<uint8_t, decltype(&FreeLargeTempBuffer)>(
-        static_cast<uint8_t*>(AllocateLargeTempBuffer()), &FreeLargeTempBuffer);
-    auto immLength = DecodeChunkRLE(immBuffer.get(), MAX_UNCOMPRESSED_CHUNK_SIZE, src, srcLength);
-    auto size = DecodeChunkRepeat(dst, dstCapacity, immBuffer.get(), immLength);
-    return size;
+    SawyerRepeatDecoder repeatDecoder(dst, dstCapacity);
+    DecodeRLERuns(
+        src, srcLength,
+        [&repeatDecoder](size_t count, uint8_t value) {
+            for (size_t i = 0; i < count; i++)
+            {
+                repeatDecoder.Push(value);
+            }
+        },
+        [&repeatDecoder](const uint8_t* data, size_t count) {
+            for (size_t i = 0; i < count; i++)
+            {
+                repeatDecoder.Push(data[i]);
+            }
+        });
+    return repeatDecoder.Finish();
 }
 
 size_t SawyerChunkReader::DecodeChunkRLE(void* dst, size_t dstCapacity, const void* src, size_t srcLength)
 {
-    auto src8 = static_cast<const uint8_t*>(src);
     auto dst8 = static_cast<uint8_t*>(dst);
-    auto dstEnd = dst8 + dstCapacity;
-    for (size_t i = 0; i < srcLength; i++)
-    {
-        uint8_t rleCodeByte = src8[i];
-        if (rleCodeByte & 128)
-        {
-            i++;
-            size_t count = 257 - rleCodeByte;
-
-            if (i >= srcLength)
-            {
-                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
-            }
-            if (dst8 + count > dstEnd)
+    size_t remaining = dstCapacity;
+    DecodeRLERuns(
+        src, srcLength,
+        [&dst8, &remaining](size_t count, uint8_t value) {
+            if (count > remaining)
             {
-                throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
+                throw SawyerChunkDestinationException();
             }
-
-            std::fill_n(dst8, count, src8[i]);
+            std::fill_n(dst8, count, value);
             dst8 += count;
-        }
-        else
-        {
-            if (i + 1 >= srcLength)
-            {
-                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
-            }
-            if (dst8 + rleCodeByte + 1 > dstEnd)
-            {
-                throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
-            }
-            if (i + 1 + rleCodeByte + 1 > srcLength)
+            remaining -= count;
+        },
+        [&dst8, &remaining](const uint8_t* data, size_t count) {
+            if (count > remaining)
             {
-                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
+                throw SawyerChunkDestinationException();
             }
-
-            std::memcpy(dst8, src8 + i + 1, rleCodeByte + 1);
-            dst8 += rleCodeByte + 1;
-            i += rleCodeByte + 1;
-        }
-    }
-    return reinterpret_cast<uintptr_t>(dst8) - reinterpret_cast<uintptr_t>(dst);
+            std::memcpy(dst8, data, count);
+            dst8 += count;
+            remaining -= count;
+        });
+    return dstCapacity - remaining;
 }
 
 size_t SawyerChunkReader::DecodeChunkRepeat(void* dst, size_t dstCapacity, const void* src, size_t srcLength)
 {
     auto src8 = static_cast<const uint8_t*>(src);
-    auto dst8 = static_cast<uint8_t*>(dst);
-    auto dstEnd = dst8 + dstCapacity;
+    SawyerRepeatDecoder repeatDecoder(dst, dstCapacity);
     for (size_t i = 0; i < srcLength; i++)
     {
-        if (src8[i] == 0xFF)
-        {
-            *dst8++ = src8[++i];
-        }
-        else
-        {
-            size_t count = (src8[i] & 7) + 1;
-            const uint8_t* copySrc = dst8 + static_cast<int32_t>(src8[i] >> 3) - 32;
-
-            if (dst8 + count >= dstEnd || copySrc + count >= dstEnd)
-            {
-                throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
-            }
-            if (copySrc < dst)
-            {
-                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
-            }
-            if ((copySrc < (dst8 + count) && copySrc >= dst8)
-                || ((copySrc + count) <= (dst8 + count) && (copySrc + count) > dst8))
-            {
-                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
-            }
-
-            std::memcpy(dst8, copySrc, count);
-            dst8 += count;
-        }
+        repeatDecoder.Push(src8[i]);
     }
-    return reinterpret_cast<uintptr_t>(dst8) - reinterpret_cast<uintptr_t>(dst);
+    return repeatDecoder.Finish();
 }
 
 size_t SawyerChunkReader::DecodeChunkRotate(void* dst, size_t dstCapacity, const void* src, size_t srcLength)
 {
     if (srcLength > dstCapacity)
     {
-        throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
+        throw SawyerChunkDestinationException();
     }
 
-    auto src8 = static_cast<const uint8_t*>(src);
-    auto dst8 = static_cast<uint8_t*>(dst);
-    uint8_t code = 1;
-    for (size_t i = 0; i < srcLength; i++)
-    {
-        dst8[i] = ror8(src8[i], code);
-        code = (code + 2) % 8;
-    }
+    sawyercoding_decode_rotate(static_cast<const uint8_t*>(src), static_cast<uint8_t*>(dst), srcLength);
     return srcLength;
 }
 
@@ -92,6 +92,12 @@ public:
     static void FreeChunk(void* data);
 
 private:
+    /**
+     * Returns the next length bytes of the stream. Streams in memory are used in place, anything else is read into
+     * storage.
+     */
+    const uint8_t* ReadChunkData(size_t length, std::unique_ptr<uint8_t[]>& storage);
+
     static size_t DecodeChunk(void* dst, size_t dstCapacity, const void* src, const sawyercoding_chunk_header& header);
     static size_t DecodeChunkRLERepeat(void* dst, size_t dstCapacity, const void* src, size_t srcLength);
     static size_t DecodeChunkRLE(void* dst, size_t dstCapacity, const void* src, size_t srcLength);
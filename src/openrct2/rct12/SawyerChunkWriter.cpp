@@ -37,62 +37,10 @@ void SawyerChunkWriter::WriteChunk(const void* src, size_t length, SAWYER_ENCODI
     _stream->Write(data.get(), dataLength);
 }
 
-/**
- * Ensure dst_buffer is bigger than src_buffer then resize afterwards
- * returns length of dst_buffer
- */
-static size_t EncodeChunkRLE(const uint8_t* src_buffer, uint8_t* dst_buffer, size_t length)
-{
-    const uint8_t* src = src_buffer;
-    uint8_t* dst = dst_buffer;
-    const uint8_t* end_src = src + length;
-    uint8_t count = 0;
-    const uint8_t* src_norm_start = src;
-
-    while (src < end_src - 1)
-    {
-        if ((count && *src == src[1]) || count > 125)
-        {
-            *dst++ = count - 1;
-            std::memcpy(dst, src_norm_start, count);
-            dst += count;
-            src_norm_start += count;
-            count = 0;
-        }
-        if (*src == src[1])
-        {
-            for (; (count < 125) && ((src + count) < end_src); count++)
-            {
-                if (*src != src[count])
-                    break;
-            }
-            *dst++ = 257 - count;
-            *dst++ = *src;
-            src += count;
-            src_norm_start = src;
-            count = 0;
-        }
-        else
-        {
-            count++;
-            src++;
-        }
-    }
-    if (src == end_src - 1)
-        count++;
-    if (count)
-    {
-        *dst++ = count - 1;
-        std::memcpy(dst, src_norm_start, count);
-        dst += count;
-    }
-    return dst - dst_buffer;
-}
-
 void SawyerChunkWriter::WriteChunkTrack(const void* src, size_t length)
 {
     auto data = std::make_unique<uint8_t[]>(MAX_COMPRESSED_CHUNK_SIZE);
-    size_t dataLength = EncodeChunkRLE(static_cast<const uint8_t*>(src), data.get(), length);
+    size_t dataLength = sawyercoding_encode_rle(static_cast<const uint8_t*>(src), data.get(), length);
 
     uint32_t checksum = 0;
     for (size_t i = 0; i < dataLength; i++)
@@ -18,6 +18,7 @@
 #include "../config/Config.h"
 #include "../core/FileStream.h"
 #include "../core/IStream.hpp"
+#include "../core/MemoryStream.h"
 #include "../core/String.hpp"
 #include "../interface/Viewport.h"
 #include "../interface/Window.h"
@@ -91,6 +92,69 @@ void S6Exporter::SaveScenario(OpenRCT2::IStream* stream)
     Save(stream, true);
 }
 
+std::array<S6ParkFileRegion, 9> GetS6ParkFileRegions(rct_s6_data& s6)
+{
+    // The saved game chunk covers everything from the tile element count to the end of the saved data.
+    auto* entitiesStart = reinterpret_cast<uint8_t*>(&s6.next_free_tile_element_pointer_index);
+    auto* parkStart = reinterpret_cast<uint8_t*>(std::end(s6.sprites));
+    auto* ridesStart = reinterpret_cast<uint8_t*>(s6.rides);
+    auto* miscStart = reinterpret_cast<uint8_t*>(std::end(s6.rides));
+    auto* savedGameEnd = entitiesStart + 0x2E8570;
+    return { {
+        { OpenRCT2::ParkFile::ChunkId::Header, reinterpret_cast<uint8_t*>(&s6.header), sizeof(s6.header) },
+        { OpenRCT2::ParkFile::ChunkId::Info, reinterpret_cast<uint8_t*>(&s6.info), sizeof(s6.info) },
+        { OpenRCT2::ParkFile::ChunkId::Objects, reinterpret_cast<uint8_t*>(s6.objects), sizeof(s6.objects) },
+        { OpenRCT2::ParkFile::ChunkId::General, reinterpret_cast<uint8_t*>(&s6.elapsed_months), 16 },
+        { OpenRCT2::ParkFile::ChunkId::TileElements, reinterpret_cast<uint8_t*>(s6.tile_elements), sizeof(s6.tile_elements) },
+        { OpenRCT2::ParkFile::ChunkId::Entities, entitiesStart, static_cast<size_t>(parkStart - entitiesStart) },
+        { OpenRCT2::ParkFile::ChunkId::Park, parkStart, static_cast<size_t>(ridesStart - parkStart) },
+        { OpenRCT2::ParkFile::ChunkId::Rides, ridesStart, static_cast<size_t>(miscStart - ridesStart) },
+        { OpenRCT2::ParkFile::ChunkId::Misc, miscStart, static_cast<size_t>(savedGameEnd - miscStart) },
+    } };
+}
+
+void S6Exporter::SaveParkFile(const utf8* path)
+{
+    auto fs = OpenRCT2::FileStream(path, OpenRCT2::FILE_MODE_WRITE);
+    SaveParkFile(&fs);
+}
+
+/**
+ * Writes the park as a saved game in the native park file format. It holds the same data as an SV6 but skips the
+ * Sawyer encodings and only stores the tile elements that are in use.
+ */
+void S6Exporter::SaveParkFile(OpenRCT2::IStream* stream)
+{
+    _s6.header.type = S6_TYPE_SAVEDGAME;
+    _s6.header.classic_flag = 0;
+    _s6.header.num_packed_objects = uint16_t(ExportObjectsList.size());
+    _s6.header.version = S6_RCT2_VERSION;
+    _s6.header.magic_number = S6_MAGIC_NUMBER;
+    _s6.game_version_number = 201028;
+
+    OpenRCT2::ParkFileWriter writer;
+    for (const auto& region : GetS6ParkFileRegions(_s6))
+    {
+        auto length = region.Length;
+        if (region.Id == OpenRCT2::ParkFile::ChunkId::TileElements)
+        {
+            length = std::min<size_t>(_s6.next_free_tile_element_pointer_index, RCT2_MAX_TILE_ELEMENTS)
+                * sizeof(RCT12TileElement);
+        }
+        writer.AddChunk(region.Id, region.Data, length);
+    }
+
+    OpenRCT2::MemoryStream packedObjects;
+    if (!ExportObjectsList.empty())
+    {
+        auto& objRepo = OpenRCT2::GetContext()->GetObjectRepository();
+        objRepo.WritePackedObjects(&packedObjects, ExportObjectsList);
+        writer.AddChunk(OpenRCT2::ParkFile::ChunkId::PackedObjects, packedObjects.GetData(), packedObjects.GetLength());
+    }
+
+    writer.Save(stream);
+}
+
 void S6Exporter::Save(OpenRCT2::IStream* stream, bool isScenario)
 {
     _s6.header.type = isScenario ? S6_TYPE_SCENARIO : S6_TYPE_SAVEDGAME;
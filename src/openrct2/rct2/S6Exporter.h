@@ -9,10 +9,12 @@
 
 #pragma once
 
+#include "../ParkFile.h"
 #include "../common.h"
 #include "../object/ObjectList.h"
 #include "../scenario/Scenario.h"
 
+#include <array>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -23,6 +25,22 @@ namespace OpenRCT2
     struct IStream;
 }
 
+/**
+ * A part of rct_s6_data that is stored as its own chunk of a park file.
+ */
+struct S6ParkFileRegion
+{
+    OpenRCT2::ParkFile::ChunkId Id;
+    uint8_t* Data;
+    size_t Length;
+};
+
+/**
+ * Splits the saved game data into the chunks of a park file. The tile element region covers the whole tile element
+ * array, only the elements in use are written.
+ */
+std::array<S6ParkFileRegion, 9> GetS6ParkFileRegions(rct_s6_data& s6);
+
 struct Litter;
 struct ObjectRepositoryItem;
 struct RCT12SpriteBase;
@@ -44,6 +62,8 @@ public:
     void SaveGame(OpenRCT2::IStream* stream);
     void SaveScenario(const utf8* path);
     void SaveScenario(OpenRCT2::IStream* stream);
+    void SaveParkFile(const utf8* path);
+    void SaveParkFile(OpenRCT2::IStream* stream);
     void Export();
     void ExportParkName();
     void ExportRides();
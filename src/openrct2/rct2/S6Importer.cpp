@@ -13,14 +13,17 @@
 #include "../Game.h"
 #include "../GameState.h"
 #include "../OpenRCT2.h"
+#include "../ParkFile.h"
 #include "../ParkImporter.h"
 #include "../config/Config.h"
 #include "../core/Console.hpp"
-#include "../core/FileStream.h"
 #include "../core/IStream.hpp"
+#include "../core/MemoryMappedFileStream.h"
+#include "../core/MemoryStream.h"
 #include "../core/Path.hpp"
 #include "../core/Random.hpp"
 #include "../core/String.hpp"
+#include "../core/TaskScheduler.h"
 #include "../interface/Viewport.h"
 #include "../localisation/Date.h"
 #include "../localisation/Localisation.h"
@@ -66,8 +69,11 @@
 #include "../world/Scenery.h"
 #include "../world/Sprite.h"
 #include "../world/Surface.h"
+#include "S6Exporter.h"
 
 #include <algorithm>
+#include <utility>
+#include <vector>
 
 /**
  * Class to import RollerCoaster Tycoon 2 scenarios (*.SC6) and saved games (*.SV6).
@@ -82,6 +88,9 @@ private:
     uint8_t _gameVersion = 0;
     bool _isSV7 = false;
 
+    // Elements whose banner still has to be imported, by index into their row of tiles
+    using TileElementBannerList = std::vector<std::pair<size_t, const RCT12TileElement*>>;
+
 public:
     S6Importer(IObjectRepository& objectRepository)
         : _objectRepository(objectRepository)
@@ -95,7 +104,7 @@ public:
         {
             return LoadScenario(path);
         }
-        else if (String::Equals(extension, ".sv6", true))
+        else if (String::Equals(extension, ".sv6", true) || String::Equals(extension, ".park", true))
         {
             return LoadSavedGame(path);
         }
@@ -107,7 +116,7 @@ public:
 
     ParkLoadResult LoadSavedGame(const utf8* path, bool skipObjectCheck = false) override
     {
-        auto fs = OpenRCT2::FileStream(path, OpenRCT2::FILE_MODE_OPEN);
+        auto fs = OpenRCT2::MemoryMappedFileStream(path);
         auto result = LoadFromStream(&fs, false, skipObjectCheck);
         _s6Path = path;
         return result;
@@ -115,7 +124,7 @@ public:
 
     ParkLoadResult LoadScenario(const utf8* path, bool skipObjectCheck = false) override
     {
-        auto fs = OpenRCT2::FileStream(path, OpenRCT2::FILE_MODE_OPEN);
+        auto fs = OpenRCT2::MemoryMappedFileStream(path);
         auto result = LoadFromStream(&fs, true, skipObjectCheck);
         _s6Path = path;
         return result;
@@ -125,6 +134,13 @@ public:
         OpenRCT2::IStream* stream, bool isScenario, [[maybe_unused]] bool skipObjectCheck = false,
         const utf8* path = String::Empty) override
     {
+        if (OpenRCT2::ParkFile::IsParkFile(stream))
+        {
+            LoadFromParkFile(stream, isScenario);
+            _s6Path = path;
+            return ParkLoadResult(GetRequiredObjects());
+        }
+
         if (isScenario && !gConfigGeneral.allow_loading_with_incorrect_checksum && !SawyerEncoding::ValidateChecksum(stream))
         {
             throw IOException("Invalid checksum.");
@@ -195,6 +211,43 @@ public:
         return ParkLoadResult(GetRequiredObjects());
     }
 
+    void LoadFromParkFile(OpenRCT2::IStream* stream, bool isScenario)
+    {
+        OpenRCT2::ParkFileReader reader;
+        reader.Load(stream);
+
+        reader.ReadChunk(OpenRCT2::ParkFile::ChunkId::Header, &_s6.header, sizeof(_s6.header));
+        if (isScenario && _s6.header.type != S6_TYPE_SCENARIO)
+        {
+            throw std::runtime_error("Park is not a scenario.");
+        }
+        if (!isScenario && _s6.header.type != S6_TYPE_SAVEDGAME)
+        {
+            throw std::runtime_error("Park is not a saved game.");
+        }
+
+        if (_s6.header.num_packed_objects > 0)
+        {
+            std::vector<uint8_t> packedObjects(reader.GetChunkLength(OpenRCT2::ParkFile::ChunkId::PackedObjects));
+            reader.ReadChunk(OpenRCT2::ParkFile::ChunkId::PackedObjects, packedObjects.data(), packedObjects.size());
+            auto ms = OpenRCT2::MemoryStream(packedObjects.data(), packedObjects.size());
+            for (uint16_t i = 0; i < _s6.header.num_packed_objects; i++)
+            {
+                _objectRepository.ExportPackedObject(&ms);
+            }
+        }
+
+        std::vector<OpenRCT2::ParkFileReader::ChunkRead> reads;
+        for (const auto& region : GetS6ParkFileRegions(_s6))
+        {
+            if (region.Id != OpenRCT2::ParkFile::ChunkId::Header)
+            {
+                reads.push_back({ region.Id, region.Data, region.Length });
+            }
+        }
+        reader.ReadChunks(reads);
+    }
+
     bool GetDetails(scenario_index_entry* dst) override
     {
         *dst = {};
@@ -1069,57 +1122,90 @@ public:
         // Build tile pointer cache (needed to get the first element at a certain location)
         auto tilePointerIndex = TilePointerIndex<RCT12TileElement>(RCT2_MAXIMUM_MAP_SIZE_TECHNICAL, _s6.tile_elements);
 
+        // Each row of tiles is converted on its own so the rows can be imported in parallel. The banners are shared by
+        // the whole map, so they are imported afterwards in map order.
+        std::vector<std::vector<TileElement>> rows(MAXIMUM_MAP_SIZE_TECHNICAL);
+        std::vector<TileElementBannerList> rowBanners(MAXIMUM_MAP_SIZE_TECHNICAL);
+        OpenRCT2::TaskScheduler::Get().ParallelFor(0, MAXIMUM_MAP_SIZE_TECHNICAL, 8, [&](size_t y) {
+            ImportTileElementRow(tilePointerIndex, static_cast<int32_t>(y), rows[y], rowBanners[y]);
+        });
+
+        size_t numElements = 0;
+        for (const auto& row : rows)
+        {
+            numElements += row.size();
+        }
+
         std::vector<TileElement> tileElements;
-        for (TileCoordsXY coords = { 0, 0 }; coords.y < MAXIMUM_MAP_SIZE_TECHNICAL; coords.y++)
+        tileElements.reserve(numElements);
+        for (size_t y = 0; y < rows.size(); y++)
         {
-            for (coords.x = 0; coords.x < MAXIMUM_MAP_SIZE_TECHNICAL; coords.x++)
+            auto rowStart = tileElements.size();
+            tileElements.insert(tileElements.end(), rows[y].begin(), rows[y].end());
+            for (const auto& [index, srcElement] : rowBanners[y])
             {
-                if (coords.x >= RCT2_MAXIMUM_MAP_SIZE_TECHNICAL || coords.y >= RCT2_MAXIMUM_MAP_SIZE_TECHNICAL)
-                {
-                    auto& dstElement = tileElements.emplace_back();
-                    dstElement.ClearAs(TILE_ELEMENT_TYPE_SURFACE);
-                    dstElement.SetLastForTile(true);
-                    continue;
-                }
+                ImportTileElementBanner(&tileElements[rowStart + index], srcElement);
+            }
+        }
+        SetTileElements(std::move(tileElements));
+    }
+
+    void ImportTileElementRow(
+        TilePointerIndex<RCT12TileElement>& tilePointerIndex, int32_t y, std::vector<TileElement>& tileElements,
+        TileElementBannerList& banners)
+    {
+        for (TileCoordsXY coords = { 0, y }; coords.x < MAXIMUM_MAP_SIZE_TECHNICAL; coords.x++)
+        {
+            if (coords.x >= RCT2_MAXIMUM_MAP_SIZE_TECHNICAL || coords.y >= RCT2_MAXIMUM_MAP_SIZE_TECHNICAL)
+            {
+                auto& dstElement = tileElements.emplace_back();
+                dstElement.ClearAs(TILE_ELEMENT_TYPE_SURFACE);
+                dstElement.SetLastForTile(true);
+                continue;
+            }
 
-                RCT12TileElement* srcElement = tilePointerIndex.GetFirstElementAt(coords);
-                // This might happen with damaged parks. Make sure there is *something* to avoid crashes.
-                if (srcElement == nullptr)
+            RCT12TileElement* srcElement = tilePointerIndex.GetFirstElementAt(coords);
+            // This might happen with damaged parks. Make sure there is *something* to avoid crashes.
+            if (srcElement == nullptr)
+            {
+                auto& dstElement = tileElements.emplace_back();
+                dstElement.ClearAs(TILE_ELEMENT_TYPE_SURFACE);
+                dstElement.SetLastForTile(true);
+                continue;
+            }
+
+            do
+            {
+                auto& dstElement = tileElements.emplace_back();
+                if (srcElement->base_height == RCT12_MAX_ELEMENT_HEIGHT)
                 {
-                    auto& dstElement = tileElements.emplace_back();
-                    dstElement.ClearAs(TILE_ELEMENT_TYPE_SURFACE);
-                    dstElement.SetLastForTile(true);
-                    continue;
+                    std::memcpy(&dstElement, srcElement, sizeof(*srcElement));
                 }
-
-                do
+                else
                 {
-                    auto& dstElement = tileElements.emplace_back();
-                    if (srcElement->base_height == RCT12_MAX_ELEMENT_HEIGHT)
-                    {
+                    auto tileElementType = static_cast<RCT12TileElementType>(srcElement->GetType());
+                    // Todo: replace with setting invisibility bit
+                    if (tileElementType == RCT12TileElementType::Corrupt
+                        || tileElementType == RCT12TileElementType::EightCarsCorrupt14
+                        || tileElementType == RCT12TileElementType::EightCarsCorrupt15)
                         std::memcpy(&dstElement, srcElement, sizeof(*srcElement));
-                    }
                     else
                     {
-                        auto tileElementType = static_cast<RCT12TileElementType>(srcElement->GetType());
-                        // Todo: replace with setting invisibility bit
-                        if (tileElementType == RCT12TileElementType::Corrupt
-                            || tileElementType == RCT12TileElementType::EightCarsCorrupt14
-                            || tileElementType == RCT12TileElementType::EightCarsCorrupt15)
-                            std::memcpy(&dstElement, srcElement, sizeof(*srcElement));
-                        else
-                            ImportTileElement(&dstElement, srcElement);
+                        ImportTileElement(&dstElement, srcElement);
+                        if (TileElementHasBanner(srcElement->GetType()))
+                        {
+                            banners.emplace_back(tileElements.size() - 1, srcElement);
+                        }
                     }
-                } while (!(srcElement++)->IsLastForTile());
-
-                // Set last element flag in case the original last element was never added
-                if (tileElements.size() > 0)
-                {
-                    tileElements.back().SetLastForTile(true);
                 }
+            } while (!(srcElement++)->IsLastForTile());
+
+            // Set last element flag in case the original last element was never added
+            if (tileElements.size() > 0)
+            {
+                tileElements.back().SetLastForTile(true);
             }
         }
-        SetTileElements(std::move(tileElements));
     }
 
     void ImportTileElement(TileElement* dst, const RCT12TileElement* src)
@@ -1267,8 +1353,60 @@ public:
                 dst2->SetAcrossTrack(src2->IsAcrossTrack());
                 dst2->SetAnimationIsBackwards(src2->AnimationIsBackwards());
 
-                // Import banner information
+                // Banner information is imported by ImportTileElementBanner
                 dst2->SetBannerIndex(BANNER_INDEX_NULL);
+                break;
+            }
+            case TILE_ELEMENT_TYPE_LARGE_SCENERY:
+            {
+                auto dst2 = dst->AsLargeScenery();
+                auto src2 = src->AsLargeScenery();
+
+                dst2->SetEntryIndex(src2->GetEntryIndex());
+                dst2->SetSequenceIndex(src2->GetSequenceIndex());
+                dst2->SetPrimaryColour(src2->GetPrimaryColour());
+                dst2->SetSecondaryColour(src2->GetSecondaryColour());
+
+                // Banner information is imported by ImportTileElementBanner
+                dst2->SetBannerIndex(BANNER_INDEX_NULL);
+                break;
+            }
+            case TILE_ELEMENT_TYPE_BANNER:
+            {
+                auto dst2 = dst->AsBanner();
+                auto src2 = src->AsBanner();
+
+                dst2->SetPosition(src2->GetPosition());
+                dst2->SetAllowedEdges(src2->GetAllowedEdges());
+
+                // Banner information is imported by ImportTileElementBanner
+                dst2->SetIndex(BANNER_INDEX_NULL);
+                break;
+            }
+            default:
+                assert(false);
+        }
+    }
+
+    static bool TileElementHasBanner(uint8_t tileElementType)
+    {
+        return tileElementType == TILE_ELEMENT_TYPE_WALL || tileElementType == TILE_ELEMENT_TYPE_LARGE_SCENERY
+            || tileElementType == TILE_ELEMENT_TYPE_BANNER;
+    }
+
+    /**
+     * Imports the banner of a wall, large scenery or banner element. This modifies the banner list shared by the whole
+     * map, so unlike ImportTileElement it must not be called in parallel.
+     */
+    void ImportTileElementBanner(TileElement* dst, const RCT12TileElement* src)
+    {
+        switch (src->GetType())
+        {
+            case TILE_ELEMENT_TYPE_WALL:
+            {
+                auto dst2 = dst->AsWall();
+                auto src2 = src->AsWall();
+
                 auto entry = dst2->GetEntry();
                 if (entry != nullptr && entry->scrolling_mode != SCROLLING_MODE_NONE)
                 {
@@ -1277,11 +1415,7 @@ public:
                     {
                         auto srcBanner = &_s6.banners[bannerIndex];
                         auto dstBanner = GetOrCreateBanner(bannerIndex);
-                        if (dstBanner == nullptr)
-                        {
-                            dst2->SetBannerIndex(BANNER_INDEX_NULL);
-                        }
-                        else
+                        if (dstBanner != nullptr)
                         {
                             ImportBanner(dstBanner, srcBanner);
                             dst2->SetBannerIndex(src2->GetBannerIndex());
@@ -1295,13 +1429,6 @@ public:
                 auto dst2 = dst->AsLargeScenery();
                 auto src2 = src->AsLargeScenery();
 
-                dst2->SetEntryIndex(src2->GetEntryIndex());
-                dst2->SetSequenceIndex(src2->GetSequenceIndex());
-                dst2->SetPrimaryColour(src2->GetPrimaryColour());
-                dst2->SetSecondaryColour(src2->GetSecondaryColour());
-
-                // Import banner information
-                dst2->SetBannerIndex(BANNER_INDEX_NULL);
                 auto entry = dst2->GetEntry();
                 if (entry != nullptr && entry->scrolling_mode != SCROLLING_MODE_NONE)
                 {
@@ -1310,11 +1437,7 @@ public:
                     {
                         auto srcBanner = &_s6.banners[bannerIndex];
                         auto dstBanner = GetOrCreateBanner(bannerIndex);
-                        if (dstBanner == nullptr)
-                        {
-                            dst2->SetBannerIndex(BANNER_INDEX_NULL);
-                        }
-                        else
+                        if (dstBanner != nullptr)
                         {
                             ImportBanner(dstBanner, srcBanner);
                             dst2->SetBannerIndex(src2->GetBannerIndex());
@@ -1328,32 +1451,19 @@ public:
                 auto dst2 = dst->AsBanner();
                 auto src2 = src->AsBanner();
 
-                dst2->SetPosition(src2->GetPosition());
-                dst2->SetAllowedEdges(src2->GetAllowedEdges());
-
                 auto bannerIndex = src2->GetIndex();
                 if (bannerIndex < std::size(_s6.banners))
                 {
                     auto srcBanner = &_s6.banners[bannerIndex];
                     auto dstBanner = GetOrCreateBanner(bannerIndex);
-                    if (dstBanner == nullptr)
-                    {
-                        dst2->SetIndex(BANNER_INDEX_NULL);
-                    }
-                    else
+                    if (dstBanner != nullptr)
                     {
                         ImportBanner(dstBanner, srcBanner);
                         dst2->SetIndex(bannerIndex);
                     }
                 }
-                else
-                {
-                    dst2->SetIndex(BANNER_INDEX_NULL);
-                }
                 break;
             }
-            default:
-                assert(false);
         }
     }
 
@@ -71,6 +71,7 @@
 #include <iterator>
 #include <limits>
 #include <optional>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -85,6 +86,9 @@ static constexpr const int32_t RideInspectionInterval[] = {
 
 static std::vector<Ride> _rides;
 
+// The steps of a walk around a complete track circuit, in the order track_circuit_iterator_next visits them.
+using TrackCircuit = std::vector<track_circuit_iterator>;
+
 // Static function declarations
 Staff* find_closest_mechanic(const CoordsXY& entrancePosition, int32_t forInspection);
 static void ride_breakdown_status_update(Ride* ride);
@@ -172,16 +176,7 @@ Ride* get_ride(ride_id_t index)
 
 rct_ride_entry* get_ride_entry(ObjectEntryIndex index)
 {
-    rct_ride_entry* result = nullptr;
-    auto& objMgr = OpenRCT2::GetContext()->GetObjectManager();
-
-    auto obj = objMgr.GetLoadedObject(ObjectType::Ride, index);
-    if (obj != nullptr)
-    {
-        result = static_cast<rct_ride_entry*>(obj->GetLegacyData());
-    }
-
-    return result;
+    return static_cast<rct_ride_entry*>(object_manager_get_loaded_object_legacy_data(ObjectType::Ride, index));
 }
 
 std::string_view get_ride_entry_name(ObjectEntryIndex index)
@@ -296,37 +291,41 @@ void Ride::QueueInsertGuestAtFront(StationIndex stationIndex, Guest* peep)
     assert(peep != nullptr);
 
     peep->GuestNextInQueue = SPRITE_INDEX_NULL;
-    auto* queueHeadGuest = GetQueueHeadGuest(peep->CurrentRideStation);
+
+    // Find the head of the queue and count the guests in the same walk, instead of walking the chain once for each.
+    auto& station = stations[peep->CurrentRideStation];
+    uint16_t count = 0;
+    Guest* queueHeadGuest = nullptr;
+    for (auto* guest = TryGetEntity<Guest>(station.LastPeepInQueue); guest != nullptr;
+         guest = TryGetEntity<Guest>(guest->GuestNextInQueue))
+    {
+        queueHeadGuest = guest;
+        count++;
+    }
+
     if (queueHeadGuest == nullptr)
     {
-        stations[peep->CurrentRideStation].LastPeepInQueue = peep->sprite_index;
+        station.LastPeepInQueue = peep->sprite_index;
     }
     else
     {
         queueHeadGuest->GuestNextInQueue = peep->sprite_index;
     }
-    UpdateQueueLength(peep->CurrentRideStation);
+    station.QueueLength = count + 1;
 }
 
 /**
  *
  *  rct2: 0x006AC916
  */
-void ride_update_favourited_stat()
+void ride_update_favourited_stat(const ParkGuestStatistics& guestStatistics)
 {
     for (auto& ride : GetRideManager())
-        ride.guests_favourite = 0;
-
-    for (auto peep : EntityList<Guest>())
     {
-        if (peep->FavouriteRide != RIDE_ID_NULL)
+        ride.guests_favourite = static_cast<uint16_t>(guestStatistics.GuestsFavouriteRide[ride.id]);
+        if (ride.guests_favourite != 0)
         {
-            auto ride = get_ride(peep->FavouriteRide);
-            if (ride != nullptr)
-            {
-                ride->guests_favourite++;
-                ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_CUSTOMER;
-            }
+            ride.window_invalidate_flags |= RIDE_INVALIDATE_RIDE_CUSTOMER;
         }
     }
 
@@ -695,16 +694,24 @@ bool track_block_get_previous(const CoordsXYE& trackPos, track_begin_end* outTra
     return track_block_get_previous_from_zero({ coords, z }, ride, rotation, outTrackBeginEnd);
 }
 
+static int32_t ride_track_gap_found(TrackCircuit* circuit)
+{
+    // Only a complete circuit is worth keeping
+    if (circuit != nullptr)
+        circuit->clear();
+    return 1;
+}
+
 /**
- *
- * Make sure to pass in the x and y of the start track element too.
+ * Make sure to pass in the x and y of the start track element too. When the track is a complete circuit, every step
+ * of the walk is recorded in circuit so the checks that follow can run against it instead of walking the track again.
  *  rct2: 0x006CB02F
- * ax result x
- * bx result y
- * esi input / output map element
  */
-int32_t ride_find_track_gap(const Ride* ride, CoordsXYE* input, CoordsXYE* output)
+static int32_t ride_find_track_gap(const Ride* ride, CoordsXYE* input, CoordsXYE* output, TrackCircuit* circuit)
 {
+    if (circuit != nullptr)
+        circuit->clear();
+
     if (ride == nullptr || input == nullptr || input->element == nullptr
         || input->element->GetType() != TILE_ELEMENT_TYPE_TRACK)
         return 0;
@@ -729,7 +736,7 @@ int32_t ride_find_track_gap(const Ride* ride, CoordsXYE* input, CoordsXYE* outpu
         if (!track_is_connected_by_shape(it.last.element, it.current.element))
         {
             *output = it.current;
-            return 1;
+            return ride_track_gap_found(circuit);
         }
         //#2081: prevent an infinite loop
         moveSlowIt = !moveSlowIt;
@@ -739,19 +746,34 @@ int32_t ride_find_track_gap(const Ride* ride, CoordsXYE* input, CoordsXYE* outpu
             if (track_circuit_iterators_match(&it, &slowIt))
             {
                 *output = it.current;
-                return 1;
+                return ride_track_gap_found(circuit);
             }
         }
+        if (circuit != nullptr)
+            circuit->push_back(it);
     }
     if (!it.looped)
     {
         *output = it.last;
-        return 1;
+        return ride_track_gap_found(circuit);
     }
 
     return 0;
 }
 
+/**
+ *
+ * Make sure to pass in the x and y of the start track element too.
+ *  rct2: 0x006CB02F
+ * ax result x
+ * bx result y
+ * esi input / output map element
+ */
+int32_t ride_find_track_gap(const Ride* ride, CoordsXYE* input, CoordsXYE* output)
+{
+    return ride_find_track_gap(ride, input, output, nullptr);
+}
+
 void Ride::FormatStatusTo(Formatter& ft) const
 {
     if (lifecycle_flags & RIDE_LIFECYCLE_CRASHED)
@@ -933,7 +955,8 @@ void Ride::UpdateAll()
 
     window_update_viewport_ride_music();
 
-    // Update rides
+    // Update rides. Idle rides are not skipped: the subsystems of Ride::Update already return straight away outside of
+    // their fixed tick cadences, and the per tick counters have to advance for every ride to keep the same outcome.
     for (auto& ride : GetRideManager())
         ride.Update();
 
@@ -1670,6 +1693,9 @@ Staff* find_closest_mechanic(const CoordsXY& entrancePosition, int32_t forInspec
     Staff* closestMechanic = nullptr;
     uint32_t closestDistance = std::numeric_limits<uint32_t>::max();
 
+    const auto location = entrancePosition.ToTileStart();
+    const bool isLocationInPark = map_is_location_in_park(location);
+
     for (auto peep : EntityList<Staff>())
     {
         if (!peep->IsMechanic())
@@ -1694,21 +1720,20 @@ Staff* find_closest_mechanic(const CoordsXY& entrancePosition, int32_t forInspec
                 continue;
         }
 
-        auto location = entrancePosition.ToTileStart();
-        if (map_is_location_in_park(location))
-            if (!peep->IsLocationInPatrol(location))
-                continue;
-
         if (peep->x == LOCATION_NULL)
             continue;
 
         // Manhattan distance
         uint32_t distance = std::abs(peep->x - entrancePosition.x) + std::abs(peep->y - entrancePosition.y);
-        if (distance < closestDistance)
-        {
-            closestDistance = distance;
-            closestMechanic = peep;
-        }
+        if (distance >= closestDistance)
+            continue;
+
+        // Only check the patrol area of mechanics that would be closer, it needs the most lookups
+        if (isLocationInPark && !peep->IsLocationInPatrol(location))
+            continue;
+
+        closestDistance = distance;
+        closestMechanic = peep;
     }
 
     return closestMechanic;
@@ -2577,40 +2602,58 @@ void Ride::ChainQueues() const
  *
  *  rct2: 0x006D3319
  */
-static int32_t ride_check_block_brakes(CoordsXYE* input, CoordsXYE* output)
+static bool ride_check_block_brake(const track_circuit_iterator& it, CoordsXYE* output)
+{
+    if (it.current.element->AsTrack()->GetTrackType() == TrackElemType::BlockBrakes)
+    {
+        auto type = it.last.element->AsTrack()->GetTrackType();
+        if (type == TrackElemType::EndStation)
+        {
+            gGameCommandErrorText = STR_BLOCK_BRAKES_CANNOT_BE_USED_DIRECTLY_AFTER_STATION;
+            *output = it.current;
+            return false;
+        }
+        if (type == TrackElemType::BlockBrakes)
+        {
+            gGameCommandErrorText = STR_BLOCK_BRAKES_CANNOT_BE_USED_DIRECTLY_AFTER_EACH_OTHER;
+            *output = it.current;
+            return false;
+        }
+        if (it.last.element->AsTrack()->HasChain() && type != TrackElemType::LeftCurvedLiftHill
+            && type != TrackElemType::RightCurvedLiftHill)
+        {
+            gGameCommandErrorText = STR_BLOCK_BRAKES_CANNOT_BE_USED_DIRECTLY_AFTER_THE_TOP_OF_THIS_LIFT_HILL;
+            *output = it.current;
+            return false;
+        }
+    }
+    return true;
+}
+
+static int32_t ride_check_block_brakes(CoordsXYE* input, CoordsXYE* output, const TrackCircuit& circuit)
 {
     ride_id_t rideIndex = input->element->AsTrack()->GetRideIndex();
     rct_window* w = window_find_by_class(WC_RIDE_CONSTRUCTION);
     if (w != nullptr && _rideConstructionState != RideConstructionState::State0 && _currentRideIndex == rideIndex)
         ride_construction_invalidate_current_track();
 
-    track_circuit_iterator it;
-    track_circuit_iterator_begin(&it, *input);
-    while (track_circuit_iterator_next(&it))
+    if (!circuit.empty())
     {
-        if (it.current.element->AsTrack()->GetTrackType() == TrackElemType::BlockBrakes)
+        // The circuit is complete, so the walk would end by looping back to the start
+        for (const auto& step : circuit)
         {
-            auto type = it.last.element->AsTrack()->GetTrackType();
-            if (type == TrackElemType::EndStation)
-            {
-                gGameCommandErrorText = STR_BLOCK_BRAKES_CANNOT_BE_USED_DIRECTLY_AFTER_STATION;
-                *output = it.current;
-                return 0;
-            }
-            if (type == TrackElemType::BlockBrakes)
-            {
-                gGameCommandErrorText = STR_BLOCK_BRAKES_CANNOT_BE_USED_DIRECTLY_AFTER_EACH_OTHER;
-                *output = it.current;
-                return 0;
-            }
-            if (it.last.element->AsTrack()->HasChain() && type != TrackElemType::LeftCurvedLiftHill
-                && type != TrackElemType::RightCurvedLiftHill)
-            {
-                gGameCommandErrorText = STR_BLOCK_BRAKES_CANNOT_BE_USED_DIRECTLY_AFTER_THE_TOP_OF_THIS_LIFT_HILL;
-                *output = it.current;
+            if (!ride_check_block_brake(step, output))
                 return 0;
-            }
         }
+        return 1;
+    }
+
+    track_circuit_iterator it;
+    track_circuit_iterator_begin(&it, *input);
+    while (track_circuit_iterator_next(&it))
+    {
+        if (!ride_check_block_brake(it, output))
+            return 0;
     }
     if (!it.looped)
     {
@@ -2630,7 +2673,7 @@ static int32_t ride_check_block_brakes(CoordsXYE* input, CoordsXYE* output)
  * @returns true if an inversion track piece is found, otherwise false.
  *  rct2: 0x006CB149
  */
-static bool ride_check_track_contains_inversions(CoordsXYE* input, CoordsXYE* output)
+static bool ride_check_track_contains_inversions(CoordsXYE* input, CoordsXYE* output, const TrackCircuit& circuit)
 {
     if (input->element == nullptr)
         return false;
@@ -2650,6 +2693,21 @@ static bool ride_check_track_contains_inversions(CoordsXYE* input, CoordsXYE* ou
         ride_construction_invalidate_current_track();
     }
 
+    if (!circuit.empty())
+    {
+        // A complete circuit has no repeated steps, so there is no infinite loop to guard against
+        for (const auto& step : circuit)
+        {
+            auto trackType = step.current.element->AsTrack()->GetTrackType();
+            if (TrackFlags[trackType] & TRACK_ELEM_FLAG_INVERSION_TO_NORMAL)
+            {
+                *output = step.current;
+                return true;
+            }
+        }
+        return false;
+    }
+
     bool moveSlowIt = true;
     track_circuit_iterator it, slowIt;
     track_circuit_iterator_begin(&it, *input);
@@ -3814,9 +3872,11 @@ bool Ride::Test(RideStatus newStatus, bool isApplying)
             return false;
     }
 
+    // Filled in when the circuit check finds a complete circuit, so the checks after it need not walk the track again
+    TrackCircuit circuit;
     if (mode == RideMode::ContinuousCircuit || IsBlockSectioned())
     {
-        if (ride_find_track_gap(this, &trackElement, &problematicTrackElement)
+        if (ride_find_track_gap(this, &trackElement, &problematicTrackElement, &circuit)
             && (newStatus != RideStatus::Simulating || IsBlockSectioned()))
         {
             gGameCommandErrorText = STR_TRACK_IS_NOT_A_COMPLETE_CIRCUIT;
@@ -3827,7 +3887,7 @@ bool Ride::Test(RideStatus newStatus, bool isApplying)
 
     if (IsBlockSectioned())
     {
-        if (!ride_check_block_brakes(&trackElement, &problematicTrackElement))
+        if (!ride_check_block_brakes(&trackElement, &problematicTrackElement, circuit))
         {
             ride_scroll_to_track_error(&problematicTrackElement);
             return false;
@@ -3840,7 +3900,7 @@ bool Ride::Test(RideStatus newStatus, bool isApplying)
         if (rideType->flags & RIDE_ENTRY_FLAG_NO_INVERSIONS)
         {
             gGameCommandErrorText = STR_TRACK_UNSUITABLE_FOR_TYPE_OF_TRAIN;
-            if (ride_check_track_contains_inversions(&trackElement, &problematicTrackElement))
+            if (ride_check_track_contains_inversions(&trackElement, &problematicTrackElement, circuit))
             {
                 ride_scroll_to_track_error(&problematicTrackElement);
                 return false;
@@ -3948,9 +4008,11 @@ bool Ride::Open(bool isApplying)
             return false;
     }
 
+    // Filled in when the circuit check finds a complete circuit, so the checks after it need not walk the track again
+    TrackCircuit circuit;
     if (mode == RideMode::Race || mode == RideMode::ContinuousCircuit || IsBlockSectioned())
     {
-        if (ride_find_track_gap(this, &trackElement, &problematicTrackElement))
+        if (ride_find_track_gap(this, &trackElement, &problematicTrackElement, &circuit))
         {
             gGameCommandErrorText = STR_TRACK_IS_NOT_A_COMPLETE_CIRCUIT;
             ride_scroll_to_track_error(&problematicTrackElement);
@@ -3960,7 +4022,7 @@ bool Ride::Open(bool isApplying)
 
     if (IsBlockSectioned())
     {
-        if (!ride_check_block_brakes(&trackElement, &problematicTrackElement))
+        if (!ride_check_block_brakes(&trackElement, &problematicTrackElement, circuit))
         {
             ride_scroll_to_track_error(&problematicTrackElement);
             return false;
@@ -3973,7 +4035,7 @@ bool Ride::Open(bool isApplying)
         if (rideEntry->flags & RIDE_ENTRY_FLAG_NO_INVERSIONS)
         {
             gGameCommandErrorText = STR_TRACK_UNSUITABLE_FOR_TYPE_OF_TRAIN;
-            if (ride_check_track_contains_inversions(&trackElement, &problematicTrackElement))
+            if (ride_check_track_contains_inversions(&trackElement, &problematicTrackElement, circuit))
             {
                 ride_scroll_to_track_error(&problematicTrackElement);
                 return false;
@@ -31,6 +31,7 @@ struct RideTypeDescriptor;
 struct Guest;
 struct Staff;
 struct Vehicle;
+struct ParkGuestStatistics;
 
 #define MAX_RIDE_TYPES_PER_RIDE_ENTRY 3
 // The max number of different types of vehicle.
@@ -1124,7 +1125,7 @@ extern uint8_t gLastEntranceStyle;
 int32_t ride_get_count();
 void ride_init_all();
 void reset_all_ride_build_dates();
-void ride_update_favourited_stat();
+void ride_update_favourited_stat(const ParkGuestStatistics& guestStatistics);
 void ride_check_all_reachable();
 void ride_update_satisfaction(Ride* ride, uint8_t happiness);
 void ride_update_popularity(Ride* ride, uint8_t pop_amount);
@@ -0,0 +1,205 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "RideProximityIndex.h"
+
+#include "../world/Map.h"
+#include "../world/TileElementsView.h"
+#include "Track.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace OpenRCT2;
+
+namespace RideProximityIndex
+{
+    static constexpr int32_t CellSize = 4;
+    static constexpr int32_t CellsPerRow = MAXIMUM_MAP_SIZE_TECHNICAL / CellSize;
+    static_assert(MAXIMUM_MAP_SIZE_TECHNICAL % CellSize == 0);
+
+    struct TrackTile
+    {
+        TileCoordsXY Tile;
+        ride_id_t Ride;
+    };
+
+    struct Cell
+    {
+        // Rides with track anywhere in the cell, used when the cell is completely in range
+        std::bitset<MAX_RIDES> Rides;
+        // One entry per ride and tile, used when the cell is only partly in range
+        std::vector<TrackTile> Tracks;
+    };
+
+    static std::vector<Cell> _cells;
+    static std::vector<TileCoordsXY> _changedTiles;
+    static std::vector<bool> _tileChanged;
+    static bool _needsRebuild = true;
+    static bool _trackRemoved;
+
+    static size_t GetTileIndex(const TileCoordsXY& tilePos)
+    {
+        return static_cast<size_t>(tilePos.y) * MAXIMUM_MAP_SIZE_TECHNICAL + tilePos.x;
+    }
+
+    static Cell& GetCell(const TileCoordsXY& tilePos)
+    {
+        return _cells[static_cast<size_t>(tilePos.y / CellSize) * CellsPerRow + tilePos.x / CellSize];
+    }
+
+    static bool IsTileInRange(const TileCoordsXY& tilePos)
+    {
+        return tilePos.x >= 0 && tilePos.y >= 0 && tilePos.x < MAXIMUM_MAP_SIZE_TECHNICAL
+            && tilePos.y < MAXIMUM_MAP_SIZE_TECHNICAL;
+    }
+
+    static void AddTrackTiles(Cell& cell, const TileCoordsXY& tilePos)
+    {
+        for (auto* trackElement : TileElementsView<TrackElement>(tilePos.ToCoordsXY()))
+        {
+            auto rideIndex = trackElement->GetRideIndex();
+            if (static_cast<size_t>(rideIndex) >= MAX_RIDES)
+                continue;
+
+            auto isSameTrack = [&](const TrackTile& track) { return track.Tile == tilePos && track.Ride == rideIndex; };
+            if (std::none_of(cell.Tracks.begin(), cell.Tracks.end(), isSameTrack))
+            {
+                cell.Tracks.push_back({ tilePos, rideIndex });
+                cell.Rides[static_cast<size_t>(rideIndex)] = true;
+            }
+        }
+    }
+
+    static void RescanTile(const TileCoordsXY& tilePos)
+    {
+        auto& cell = GetCell(tilePos);
+        cell.Tracks.erase(
+            std::remove_if(
+                cell.Tracks.begin(), cell.Tracks.end(), [&](const TrackTile& track) { return track.Tile == tilePos; }),
+            cell.Tracks.end());
+        AddTrackTiles(cell, tilePos);
+
+        cell.Rides.reset();
+        for (const auto& track : cell.Tracks)
+        {
+            cell.Rides[static_cast<size_t>(track.Ride)] = true;
+        }
+    }
+
+    static void Rebuild()
+    {
+        _cells.clear();
+        _cells.resize(CellsPerRow * CellsPerRow);
+        for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+        {
+            for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+            {
+                TileCoordsXY tilePos{ x, y };
+                AddTrackTiles(GetCell(tilePos), tilePos);
+            }
+        }
+    }
+
+    void Reset()
+    {
+        _needsRebuild = true;
+    }
+
+    void MarkTileChanged(const TileCoordsXY& tilePos)
+    {
+        if (_needsRebuild || !IsTileInRange(tilePos))
+            return;
+
+        if (_tileChanged.empty())
+        {
+            _tileChanged.resize(MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL);
+        }
+        auto index = GetTileIndex(tilePos);
+        if (!_tileChanged[index])
+        {
+            _tileChanged[index] = true;
+            _changedTiles.push_back(tilePos);
+        }
+    }
+
+    void MarkTrackRemoved()
+    {
+        // The map does not know where the removed element was, every tile with track is checked again instead which is
+        // still much less than scanning the whole map.
+        _trackRemoved = true;
+    }
+
+    void Refresh()
+    {
+        if (_needsRebuild)
+        {
+            Rebuild();
+        }
+        else
+        {
+            if (_trackRemoved)
+            {
+                for (const auto& cell : _cells)
+                {
+                    for (const auto& track : cell.Tracks)
+                    {
+                        MarkTileChanged(track.Tile);
+                    }
+                }
+            }
+            for (const auto& tilePos : _changedTiles)
+            {
+                RescanTile(tilePos);
+            }
+        }
+
+        for (const auto& tilePos : _changedTiles)
+        {
+            _tileChanged[GetTileIndex(tilePos)] = false;
+        }
+        _changedTiles.clear();
+        _needsRebuild = false;
+        _trackRemoved = false;
+    }
+
+    void AddRidesInRange(const TileCoordsXY& centre, int32_t radius, std::bitset<MAX_RIDES>& rides)
+    {
+        const auto minX = std::max(centre.x - radius, 0);
+        const auto minY = std::max(centre.y - radius, 0);
+        const auto maxX = std::min(centre.x + radius, MAXIMUM_MAP_SIZE_TECHNICAL - 1);
+        const auto maxY = std::min(centre.y + radius, MAXIMUM_MAP_SIZE_TECHNICAL - 1);
+        if (minX > maxX || minY > maxY)
+            return;
+
+        for (int32_t cellY = minY / CellSize; cellY <= maxY / CellSize; cellY++)
+        {
+            for (int32_t cellX = minX / CellSize; cellX <= maxX / CellSize; cellX++)
+            {
+                const auto& cell = _cells[static_cast<size_t>(cellY) * CellsPerRow + cellX];
+                const auto cellLeft = cellX * CellSize;
+                const auto cellTop = cellY * CellSize;
+                if (cellLeft >= minX && cellTop >= minY && cellLeft + CellSize - 1 <= maxX
+                    && cellTop + CellSize - 1 <= maxY)
+                {
+                    rides |= cell.Rides;
+                    continue;
+                }
+
+                for (const auto& track : cell.Tracks)
+                {
+                    if (track.Tile.x >= minX && track.Tile.x <= maxX && track.Tile.y >= minY && track.Tile.y <= maxY)
+                    {
+                        rides[static_cast<size_t>(track.Ride)] = true;
+                    }
+                }
+            }
+        }
+    }
+} // namespace RideProximityIndex
@@ -0,0 +1,34 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../world/Location.hpp"
+#include "Ride.h"
+
+#include <bitset>
+
+/**
+ * Index from map regions to the rides that have track in them, used by guests without a map to find the rides around
+ * them without walking every tile element in range. The map notifies the index of changed tiles, the index is brought
+ * up to date by Refresh which has to be called before querying, queries can then run on several threads at once.
+ */
+namespace RideProximityIndex
+{
+    void Reset();
+    void MarkTileChanged(const TileCoordsXY& tilePos);
+    void MarkTrackRemoved();
+    void Refresh();
+
+    /**
+     * Adds all rides with a track element within the square of the given radius around the tile, the same as walking
+     * the track elements of all those tiles.
+     */
+    void AddRidesInRange(const TileCoordsXY& centre, int32_t radius, std::bitset<MAX_RIDES>& rides);
+} // namespace RideProximityIndex
@@ -93,10 +93,9 @@ static void ride_ratings_score_close_proximity(RideRatingUpdateState& state, Til
 static void ride_ratings_add(RatingTuple* rating, int32_t excitement, int32_t intensity, int32_t nausea);
 
 /**
- * This is a small hack function to keep calling the ride rating processor until
- * the given ride's ratings have been calculated. What ever is currently being
- * processed will be overwritten.
- * Only purpose of this function currently is for testing.
+ * Calculates the ratings of the given ride right away using a separate state, the
+ * progress of the ride currently processed by ride_ratings_update_all is kept.
+ * Used by tools and tests that need the ratings of a ride without running ticks.
  */
 void ride_ratings_update_ride(const Ride& ride)
 {
@@ -116,14 +115,17 @@ void ride_ratings_update_ride(const Ride& ride)
  *
  *  rct2: 0x006B5A2A
  */
-void ride_ratings_update_all()
+void ride_ratings_update_all(uint32_t stepBudget)
 {
     if (gScreenFlags & SCREEN_FLAGS_SCENARIO_EDITOR)
         return;
 
     // NOTE: Until the new save format only one ride can be updated at once.
     // The SV6 format can store only a single state.
-    ride_ratings_update_state(gRideRatingUpdateState);
+    for (uint32_t i = 0; i < stepBudget; i++)
+    {
+        ride_ratings_update_state(gRideRatingUpdateState);
+    }
 }
 
 static void ride_ratings_update_state(RideRatingUpdateState& state)
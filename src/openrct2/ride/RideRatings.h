@@ -56,8 +56,12 @@ struct RideRatingUpdateState
 
 extern RideRatingUpdateState gRideRatingUpdateState;
 
+// Number of rating state machine steps run per game tick. Changing it changes the tick at which ratings are published,
+// so it must be the same for every network client and replay.
+constexpr uint32_t RideRatingsStepsPerTick = 1;
+
 void ride_ratings_update_ride(const Ride& ride);
-void ride_ratings_update_all();
+void ride_ratings_update_all(uint32_t stepBudget = RideRatingsStepsPerTick);
 
 using ride_ratings_calculation = void (*)(Ride* ride, RideRatingUpdateState& state);
 ride_ratings_calculation ride_ratings_get_calculate_func(uint8_t rideType);
@@ -70,6 +70,8 @@ bool gTrackDesignSceneryToggle;
 static CoordsXYZ _trackPreviewMin;
 static CoordsXYZ _trackPreviewMax;
 static CoordsXYZ _trackPreviewOrigin;
+// Storage of the temporary map previews are drawn on, kept so that drawing the next preview does not allocate it again.
+static std::vector<TileElement> _previewTileElements;
 
 bool _trackDesignDrawingPreview;
 static uint8_t _trackDesignPlaceOperation;
@@ -1982,7 +1984,7 @@ void track_design_draw_preview(TrackDesign* td6, uint8_t* pixels)
     if (!track_design_place_preview(td6, &cost, &ride, &flags))
     {
         std::fill_n(pixels, TRACK_PREVIEW_IMAGE_SIZE * 4, 0x00);
-        UnstashMap();
+        _previewTileElements = UnstashMap();
         return;
     }
     td6->cost = cost;
@@ -2065,7 +2067,7 @@ void track_design_draw_preview(TrackDesign* td6, uint8_t* pixels)
     }
 
     ride->Delete();
-    UnstashMap();
+    _previewTileElements = UnstashMap();
 }
 
 /**
@@ -2080,23 +2082,21 @@ static void track_design_preview_clear_map()
     gMapSizeMinus2 = (264 * 32) - 2;
     gMapSize = 256;
 
-    // Reserve ~8 elements per tile
-    std::vector<TileElement> tileElements;
+    TileElement element;
+    element.ClearAs(TILE_ELEMENT_TYPE_SURFACE);
+    element.SetLastForTile(true);
+    element.AsSurface()->SetSlope(TILE_ELEMENT_SLOPE_FLAT);
+    element.AsSurface()->SetWaterHeight(0);
+    element.AsSurface()->SetSurfaceStyle(0);
+    element.AsSurface()->SetEdgeStyle(0);
+    element.AsSurface()->SetGrassLength(GRASS_LENGTH_CLEAR_0);
+    element.AsSurface()->SetOwnership(OWNERSHIP_OWNED);
+    element.AsSurface()->SetParkFences(0);
+
+    // Reuse the storage of the previous preview, reserving ~8 elements per tile
+    auto tileElements = std::move(_previewTileElements);
     tileElements.reserve(numTiles * 8);
-
-    for (int32_t i = 0; i < numTiles; i++)
-    {
-        auto* element = &tileElements.emplace_back();
-        element->ClearAs(TILE_ELEMENT_TYPE_SURFACE);
-        element->SetLastForTile(true);
-        element->AsSurface()->SetSlope(TILE_ELEMENT_SLOPE_FLAT);
-        element->AsSurface()->SetWaterHeight(0);
-        element->AsSurface()->SetSurfaceStyle(0);
-        element->AsSurface()->SetEdgeStyle(0);
-        element->AsSurface()->SetGrassLength(GRASS_LENGTH_CLEAR_0);
-        element->AsSurface()->SetOwnership(OWNERSHIP_OWNED);
-        element->AsSurface()->SetParkFences(0);
-    }
+    tileElements.assign(numTiles, element);
     SetTileElements(std::move(tileElements));
 }
 
@@ -17,6 +17,7 @@
 #include "../core/File.h"
 #include "../core/FileIndex.hpp"
 #include "../core/FileStream.h"
+#include "../core/FileWatcher.h"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
 #include "../localisation/LocalisationService.h"
@@ -27,6 +28,8 @@
 
 #include <algorithm>
 #include <memory>
+#include <mutex>
+#include <unordered_set>
 #include <vector>
 
 using namespace OpenRCT2;
@@ -120,6 +123,11 @@ private:
     TrackDesignFileIndex const _fileIndex;
     std::vector<TrackRepositoryItem> _items;
 
+    // Written by the file watcher thread, so declared before it to outlive it
+    std::unordered_set<std::string> _changedFiles;
+    std::mutex _changedFilesMutex;
+    std::unique_ptr<FileWatcher> _fileWatcher;
+
 public:
     explicit TrackDesignRepository(const std::shared_ptr<IPlatformEnvironment>& env)
         : _env(env)
@@ -215,6 +223,52 @@ public:
         }
 
         SortItems();
+
+        if (_fileWatcher == nullptr)
+        {
+            SetupFileWatcher();
+        }
+    }
+
+    void ApplyFileChanges(int32_t language) override
+    {
+        std::unordered_set<std::string> changedFiles;
+        {
+            std::lock_guard<std::mutex> guard(_changedFilesMutex);
+            if (_changedFiles.empty())
+                return;
+            changedFiles.swap(_changedFiles);
+        }
+
+        bool changed = false;
+        for (const auto& path : changedFiles)
+        {
+            if (!IsTrackDesignFile(path))
+                continue;
+
+            // A changed file is indexed again, a deleted or renamed one is removed
+            size_t index = GetTrackIndex(path);
+            if (index != SIZE_MAX)
+            {
+                _items.erase(_items.begin() + index);
+                changed = true;
+            }
+            if (File::Exists(path))
+            {
+                auto td = _fileIndex.Create(language, path);
+                if (std::get<0>(td) && std::get<1>(td).RideType != RIDE_TYPE_NULL)
+                {
+                    _items.push_back(std::move(std::get<1>(td)));
+                    changed = true;
+                }
+            }
+        }
+
+        if (changed)
+        {
+            SortItems();
+            log_verbose("Track design repository updated with %zu changed files", changedFiles.size());
+        }
     }
 
     bool Delete(const std::string& path) override
@@ -280,6 +334,29 @@ public:
     }
 
 private:
+    void SetupFileWatcher()
+    {
+        try
+        {
+            auto directory = _env->GetDirectoryPath(DIRBASE::USER, DIRID::TRACK);
+            _fileWatcher = std::make_unique<FileWatcher>(directory);
+            _fileWatcher->OnFileChanged = [this](const std::string& path) {
+                std::lock_guard<std::mutex> guard(_changedFilesMutex);
+                _changedFiles.emplace(path);
+            };
+        }
+        catch (const std::exception& e)
+        {
+            log_verbose("Unable to watch the track design directory: %s", e.what());
+        }
+    }
+
+    static bool IsTrackDesignFile(const std::string& path)
+    {
+        auto extension = Path::GetExtension(path);
+        return String::Equals(extension, ".td4", true) || String::Equals(extension, ".td6", true);
+    }
+
     void SortItems()
     {
         std::sort(_items.begin(), _items.end(), [](const TrackRepositoryItem& a, const TrackRepositoryItem& b) -> bool {
@@ -37,6 +37,12 @@ struct ITrackDesignRepository
         uint8_t rideType, const std::string& entry) const abstract;
 
     virtual void Scan(int32_t language) abstract;
+
+    /**
+     * Adds, updates or removes the items of the track designs that changed in the user track design directory since
+     * the last call, without scanning the other files again.
+     */
+    virtual void ApplyFileChanges(int32_t language) abstract;
     virtual bool Delete(const std::string& path) abstract;
     virtual std::string Rename(const std::string& path, const std::string& newName) abstract;
     virtual std::string Install(const std::string& path, const std::string& name) abstract;
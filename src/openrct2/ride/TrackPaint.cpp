@@ -2178,6 +2178,48 @@ void track_paint_util_left_corkscrew_up_supports(paint_session* session, Directi
     }
 }
 
+void track_paint_util_paint_descriptor(
+    paint_session* session, const TrackPaintDescriptor& descriptor, Direction direction, int32_t height)
+{
+    const auto& directionDescriptor = descriptor.Directions[direction];
+    const int32_t baseHeight = height + descriptor.HeightOffset;
+    const uint32_t colourFlags = session->TrackColours[SCHEME_TRACK];
+
+    for (const auto& sprite : directionDescriptor.Sprites)
+    {
+        if (sprite.sprite_id == 0)
+            break;
+
+        PaintAddImageAsParent(
+            session, sprite.sprite_id | colourFlags, { sprite.offset.x, sprite.offset.y, baseHeight + sprite.offset.z },
+            sprite.bb_size, { sprite.bb_offset.x, sprite.bb_offset.y, baseHeight + sprite.bb_offset.z });
+    }
+
+    switch (directionDescriptor.TunnelSide)
+    {
+        case TrackPaintTunnelSide::None:
+            break;
+        case TrackPaintTunnelSide::Left:
+            paint_util_push_tunnel_left(session, baseHeight, descriptor.TunnelType);
+            break;
+        case TrackPaintTunnelSide::Right:
+            paint_util_push_tunnel_right(session, baseHeight, descriptor.TunnelType);
+            break;
+    }
+
+    if (directionDescriptor.SupportType != TrackPaintNoSupports
+        && (!descriptor.PatternedSupports || track_paint_util_should_paint_supports(session->MapPosition)))
+    {
+        metal_a_supports_paint_setup(
+            session, directionDescriptor.SupportType, descriptor.SupportSegment, descriptor.SupportSpecial, baseHeight,
+            session->TrackColours[SCHEME_SUPPORTS]);
+    }
+
+    paint_util_set_segment_support_height(
+        session, paint_util_rotate_segments(descriptor.BlockedSegments, direction), 0xFFFF, 0);
+    paint_util_set_general_support_height(session, height + descriptor.GeneralSupportHeight, 0x20);
+}
+
 /**
  *
  *  rct2: 0x006C4794
@@ -394,6 +394,48 @@ void track_paint_util_right_vertical_loop_segments(paint_session* session, Direc
 
 void track_paint_util_left_corkscrew_up_supports(paint_session* session, Direction direction, uint16_t height);
 
+enum class TrackPaintTunnelSide : uint8_t
+{
+    None,
+    Left,
+    Right,
+};
+
+constexpr const uint8_t TrackPaintNoSupports = 0xFF;
+constexpr const size_t TrackPaintMaxSprites = 4;
+
+struct TrackPaintDirectionDescriptor
+{
+    // Painted in order up to the first sprite with a sprite_id of 0. The z of the offsets is relative to the track.
+    sprite_bb Sprites[TrackPaintMaxSprites];
+    TrackPaintTunnelSide TunnelSide;
+    // A metal support type or TrackPaintNoSupports.
+    uint8_t SupportType;
+};
+
+/**
+ * Everything painted for a track piece that only depends on its direction, so the piece can be described as data and
+ * painted by track_paint_util_paint_descriptor instead of a hand-written paint function.
+ */
+struct TrackPaintDescriptor
+{
+    TrackPaintDirectionDescriptor Directions[NumOrthogonalDirections];
+    // Added to the track height for the sprites, tunnels and supports.
+    int16_t HeightOffset;
+    uint8_t TunnelType;
+    uint8_t SupportSegment;
+    int8_t SupportSpecial;
+    // Only paint supports on the tiles picked by track_paint_util_should_paint_supports.
+    bool PatternedSupports;
+    // Segments blocked by the piece when facing direction 0.
+    uint16_t BlockedSegments;
+    // The general support height above the track height.
+    int16_t GeneralSupportHeight;
+};
+
+void track_paint_util_paint_descriptor(
+    paint_session* session, const TrackPaintDescriptor& descriptor, Direction direction, int32_t height);
+
 using TRACK_PAINT_FUNCTION = void (*)(
     paint_session* session, const Ride* ride, uint8_t trackSequence, Direction direction, int32_t height,
     const TrackElement& trackElement);
@@ -7,8 +7,9 @@
  * OpenRCT2 is licensed under the GNU General Public License version 3.
  *****************************************************************************/
 #pragma once
+#include "../world/EntityList.h"
+
 #include <cstdint>
-#include <list>
 
 struct Vehicle;
 
@@ -18,17 +19,17 @@ namespace TrainManager
     class View
     {
     private:
-        const std::list<uint16_t>* vec;
+        const EntityIndexList* vec;
 
         class Iterator
         {
         private:
-            std::list<uint16_t>::const_iterator iter;
-            std::list<uint16_t>::const_iterator end;
+            EntityIndexList::const_iterator iter;
+            EntityIndexList::const_iterator end;
             Vehicle* Entity = nullptr;
 
         public:
-            Iterator(std::list<uint16_t>::const_iterator _iter, std::list<uint16_t>::const_iterator _end)
+            Iterator(EntityIndexList::const_iterator _iter, EntityIndexList::const_iterator _end)
                 : iter(_iter)
                 , end(_end)
             {
@@ -49,6 +49,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <limits>
 
 static bool vehicle_boat_is_location_accessible(const CoordsXYZ& location);
 
@@ -765,72 +766,18 @@ static void InvokeVehicleCrashHook(const uint16_t vehicleId, const std::string_v
 }
 #endif
 
-static bool vehicle_move_info_valid(
-    VehicleTrackSubposition trackSubposition, track_type_t type, uint8_t direction, int32_t offset)
-{
-    uint16_t typeAndDirection = (type << 2) | (direction & 3);
-
-    if (trackSubposition >= VehicleTrackSubposition{ std::size(gTrackVehicleInfo) })
-    {
-        return false;
-    }
-    int32_t size = 0;
-    switch (trackSubposition)
-    {
-        case VehicleTrackSubposition::Default:
-            size = VehicleTrackSubpositionSizeDefault;
-            break;
-        case VehicleTrackSubposition::ChairliftGoingOut:
-            size = 692;
-            break;
-        case VehicleTrackSubposition::ChairliftGoingBack:
-        case VehicleTrackSubposition::ChairliftEndBullwheel:
-        case VehicleTrackSubposition::ChairliftStartBullwheel:
-            size = 404;
-            break;
-        case VehicleTrackSubposition::GoKartsLeftLane:
-        case VehicleTrackSubposition::GoKartsRightLane:
-        case VehicleTrackSubposition::GoKartsMovingToRightLane:
-        case VehicleTrackSubposition::GoKartsMovingToLeftLane:
-            size = 208;
-            break;
-        case VehicleTrackSubposition::MiniGolfPathA9: // VehicleTrackSubposition::MiniGolfStart9
-        case VehicleTrackSubposition::MiniGolfBallPathA10:
-        case VehicleTrackSubposition::MiniGolfPathB11:
-        case VehicleTrackSubposition::MiniGolfBallPathB12:
-        case VehicleTrackSubposition::MiniGolfPathC13:
-        case VehicleTrackSubposition::MiniGolfBallPathC14:
-            size = 824;
-            break;
-        case VehicleTrackSubposition::ReverserRCFrontBogie:
-        case VehicleTrackSubposition::ReverserRCRearBogie:
-            size = 868;
-            break;
-        default:
-            break;
-    }
-    if (typeAndDirection >= size)
-    {
-        return false;
-    }
-    if (offset >= gTrackVehicleInfo[static_cast<uint8_t>(trackSubposition)][typeAndDirection]->size)
-    {
-        return false;
-    }
-    return true;
-}
-
 static const rct_vehicle_info* vehicle_get_move_info(
     VehicleTrackSubposition trackSubposition, track_type_t type, uint8_t direction, int32_t offset)
 {
     uint16_t typeAndDirection = (type << 2) | (direction & 3);
 
-    if (!vehicle_move_info_valid(trackSubposition, type, direction, offset))
+    auto list = GetTrackVehicleInfoList(trackSubposition, typeAndDirection);
+    if (list == nullptr || offset >= list->size)
     {
         static constexpr const rct_vehicle_info zero = {};
         return &zero;
     }
-    return &gTrackVehicleInfo[static_cast<uint8_t>(trackSubposition)][typeAndDirection]->info[offset];
+    return &list->info[offset];
 }
 
 const rct_vehicle_info* Vehicle::GetMoveInfo() const
@@ -842,11 +789,12 @@ static uint16_t vehicle_get_move_info_size(VehicleTrackSubposition trackSubposit
 {
     uint16_t typeAndDirection = (type << 2) | (direction & 3);
 
-    if (!vehicle_move_info_valid(trackSubposition, type, direction, 0))
+    auto list = GetTrackVehicleInfoList(trackSubposition, typeAndDirection);
+    if (list == nullptr)
     {
         return 0;
     }
-    return gTrackVehicleInfo[static_cast<uint8_t>(trackSubposition)][typeAndDirection]->size;
+    return list->size;
 }
 
 uint16_t Vehicle::GetTrackProgress() const
@@ -1082,42 +1030,6 @@ OpenRCT2::Audio::VehicleSoundParams Vehicle::CreateSoundParam(uint16_t priority)
     return param;
 }
 
-/**
- *
- *  rct2: 0x006BB9FF
- */
-void Vehicle::UpdateSoundParams(std::vector<OpenRCT2::Audio::VehicleSoundParams>& vehicleSoundParamsList) const
-{
-    if (!SoundCanPlay())
-        return;
-
-    uint16_t soundPriority = GetSoundPriority();
-    // Find a sound param of lower priority to use
-    auto soundParamIter = std::find_if(
-        vehicleSoundParamsList.begin(), vehicleSoundParamsList.end(),
-        [soundPriority](const auto& param) { return soundPriority > param.priority; });
-
-    if (soundParamIter == std::end(vehicleSoundParamsList))
-    {
-        if (vehicleSoundParamsList.size() < OpenRCT2::Audio::MaxVehicleSounds)
-        {
-            vehicleSoundParamsList.push_back(CreateSoundParam(soundPriority));
-        }
-    }
-    else
-    {
-        if (vehicleSoundParamsList.size() < OpenRCT2::Audio::MaxVehicleSounds)
-        {
-            // Shift all sound params down one if using a free space
-            vehicleSoundParamsList.insert(soundParamIter, CreateSoundParam(soundPriority));
-        }
-        else
-        {
-            *soundParamIter = CreateSoundParam(soundPriority);
-        }
-    }
-}
-
 static void vehicle_sounds_update_window_setup()
 {
     g_music_tracking_viewport = nullptr;
@@ -1310,23 +1222,150 @@ static void UpdateSound(
     }
 }
 
+struct VehicleSoundCandidate
+{
+    uint16_t Priority;
+    uint16_t Id;
+};
+
+// On equal priority the train with the lower sprite index wins, as it did when all trains were scanned in order.
+static bool IsLouderSoundCandidate(const VehicleSoundCandidate& lhs, const VehicleSoundCandidate& rhs)
+{
+    if (lhs.Priority != rhs.Priority)
+        return lhs.Priority > rhs.Priority;
+    return lhs.Id < rhs.Id;
+}
+
+/**
+ * Keeps the MaxVehicleSounds loudest candidates in a heap with the quietest candidate at the front.
+ */
+static void vehicle_sounds_add_candidate(std::vector<VehicleSoundCandidate>& candidates, const Vehicle& vehicle)
+{
+    if (!vehicle.SoundCanPlay())
+        return;
+
+    VehicleSoundCandidate candidate{ vehicle.GetSoundPriority(), vehicle.sprite_index };
+    if (candidates.size() < OpenRCT2::Audio::MaxVehicleSounds)
+    {
+        candidates.push_back(candidate);
+        std::push_heap(candidates.begin(), candidates.end(), IsLouderSoundCandidate);
+    }
+    else if (IsLouderSoundCandidate(candidate, candidates.front()))
+    {
+        std::pop_heap(candidates.begin(), candidates.end(), IsLouderSoundCandidate);
+        candidates.back() = candidate;
+        std::push_heap(candidates.begin(), candidates.end(), IsLouderSoundCandidate);
+    }
+}
+
+/**
+ * Gets the range of tiles a train can be on and still pass Vehicle::SoundCanPlay for the listening viewport.
+ * @returns false if the range covers so many tiles that scanning all trains is cheaper.
+ */
+static bool vehicle_sounds_get_listening_tiles(TileCoordsXY& minTile, TileCoordsXY& maxTile)
+{
+    // Vehicle sprites extend well within this many screen units from their position
+    constexpr int32_t SpriteMargin = 128;
+    constexpr int32_t MaxZ = (MAX_ELEMENT_HEIGHT + 32) * COORDS_Z_STEP;
+
+    const auto* viewport = g_music_tracking_viewport;
+    int32_t left = viewport->viewPos.x;
+    int32_t top = viewport->viewPos.y;
+    int32_t right = left + viewport->view_width;
+    int32_t bottom = top + viewport->view_height;
+    if (window_get_classification(gWindowAudioExclusive) == WC_MAIN_WINDOW)
+    {
+        left -= viewport->view_width / 4;
+        top -= viewport->view_height / 4;
+        right += viewport->view_width / 4;
+        bottom += viewport->view_height / 4;
+    }
+
+    CoordsXY mapMin{ std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::max() };
+    CoordsXY mapMax{ std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::min() };
+    for (auto screenX : { left - SpriteMargin, right + SpriteMargin })
+    {
+        for (auto screenY : { top - SpriteMargin, bottom + SpriteMargin })
+        {
+            for (auto z : { 0, MaxZ })
+            {
+                auto mapPos = viewport_coord_to_map_coord({ screenX, screenY }, z);
+                mapMin = { std::min(mapMin.x, mapPos.x), std::min(mapMin.y, mapPos.y) };
+                mapMax = { std::max(mapMax.x, mapPos.x), std::max(mapMax.y, mapPos.y) };
+            }
+        }
+    }
+
+    minTile = TileCoordsXY{ std::max(mapMin.x, 0) / COORDS_XY_STEP, std::max(mapMin.y, 0) / COORDS_XY_STEP };
+    maxTile = TileCoordsXY{ std::min(mapMax.x / COORDS_XY_STEP, gMapSize - 1),
+                            std::min(mapMax.y / COORDS_XY_STEP, gMapSize - 1) };
+    if (minTile.x > maxTile.x || minTile.y > maxTile.y)
+    {
+        // Looking at nothing but the void, leave the range empty
+        return true;
+    }
+
+    // Visiting a tile costs about as much as rejecting a car that is not the head of its train
+    auto numTiles = static_cast<size_t>(maxTile.x - minTile.x + 1) * (maxTile.y - minTile.y + 1);
+    return numTiles < GetEntityListCount(EntityType::Vehicle);
+}
+
 /**
  *
  *  rct2: 0x006BBC6B
  */
 void vehicle_sounds_update()
 {
-    if (!OpenRCT2::Audio::IsAvailable())
+    if (!OpenRCT2::Audio::IsAvailable() || OpenRCT2::Audio::gGameSoundsOff)
         return;
 
-    std::vector<OpenRCT2::Audio::VehicleSoundParams> vehicleSoundParamsList;
-    vehicleSoundParamsList.reserve(OpenRCT2::Audio::MaxVehicleSounds);
+    if (!gConfigSound.sound_enabled)
+    {
+        OpenRCT2::Audio::StopVehicleSounds();
+        return;
+    }
 
     vehicle_sounds_update_window_setup();
 
-    for (auto vehicle : TrainManager::View())
+    std::vector<VehicleSoundCandidate> candidates;
+    candidates.reserve(OpenRCT2::Audio::MaxVehicleSounds);
+    if (g_music_tracking_viewport != nullptr)
+    {
+        TileCoordsXY minTile;
+        TileCoordsXY maxTile;
+        if (vehicle_sounds_get_listening_tiles(minTile, maxTile))
+        {
+            for (int32_t y = minTile.y; y <= maxTile.y; y++)
+            {
+                for (int32_t x = minTile.x; x <= maxTile.x; x++)
+                {
+                    for (auto vehicle : EntityTileList<Vehicle>(TileCoordsXY{ x, y }.ToCoordsXY()))
+                    {
+                        if (vehicle->IsHead())
+                        {
+                            vehicle_sounds_add_candidate(candidates, *vehicle);
+                        }
+                    }
+                }
+            }
+        }
+        else
+        {
+            for (auto vehicle : TrainManager::View())
+            {
+                vehicle_sounds_add_candidate(candidates, *vehicle);
+            }
+        }
+    }
+
+    // Loudest first, sound slots are handed out in this order
+    std::sort_heap(candidates.begin(), candidates.end(), IsLouderSoundCandidate);
+    std::vector<OpenRCT2::Audio::VehicleSoundParams> vehicleSoundParamsList;
+    vehicleSoundParamsList.reserve(candidates.size());
+    for (const auto& candidate : candidates)
     {
-        vehicle->UpdateSoundParams(vehicleSoundParamsList);
+        auto* vehicle = GetEntity<Vehicle>(candidate.Id);
+        vehicleSoundParamsList.push_back(vehicle->CreateSoundParam(candidate.Priority));
     }
 
     // Stop all playing sounds that no longer have priority to play after vehicle_update_sound_params
@@ -1407,6 +1446,9 @@ void vehicle_update_all()
     if ((gScreenFlags & SCREEN_FLAGS_TRACK_DESIGNER) && gEditorStep != EditorStep::RollercoasterDesigner)
         return;
 
+    // Trains have to be updated one after the other and in this order. They draw from the shared scenario random number
+    // generator, move entities between the shared tile lists and use file level state for the motion of the current
+    // train, so updating them concurrently would change the outcome and desync from other clients and replays.
     for (auto vehicle : TrainManager::View())
     {
         vehicle->Update();
@@ -5343,6 +5385,7 @@ void Vehicle::KillPassengers(Ride* curRide)
         {
             decrement_guests_in_park();
             auto intent = Intent(INTENT_ACTION_UPDATE_GUEST_COUNT);
+            intent.putExtra(INTENT_EXTRA_PEEP, curPeep);
             context_broadcast_intent(&intent);
         }
         peep_sprite_remove(curPeep);
@@ -217,7 +217,6 @@ struct Vehicle : SpriteBase
     Vehicle* GetCar(size_t carIndex) const;
     void SetState(Vehicle::Status vehicleStatus, uint8_t subState = 0);
     bool IsGhost() const;
-    void UpdateSoundParams(std::vector<OpenRCT2::Audio::VehicleSoundParams>& vehicleSoundParamsList) const;
     bool DodgemsCarWouldCollideAt(const CoordsXY& coords, uint16_t* spriteId) const;
     int32_t UpdateTrackMotion(int32_t* outStation);
     int32_t CableLiftUpdateTrackMotion();
@@ -269,12 +268,13 @@ struct Vehicle : SpriteBase
     void ApplyMass(int16_t appliedMass);
     void Serialise(DataSerialiser& stream);
 
-private:
     bool SoundCanPlay() const;
     uint16_t GetSoundPriority() const;
+    OpenRCT2::Audio::VehicleSoundParams CreateSoundParam(uint16_t priority) const;
+
+private:
     const rct_vehicle_info* GetMoveInfo() const;
     uint16_t GetTrackProgress() const;
-    OpenRCT2::Audio::VehicleSoundParams CreateSoundParam(uint16_t priority) const;
     void CableLiftUpdate();
     bool CableLiftUpdateTrackMotionForwards();
     bool CableLiftUpdateTrackMotionBackwards();
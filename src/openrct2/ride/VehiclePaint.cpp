@@ -18,8 +18,10 @@
 #include "../ride/RideData.h"
 #include "../ride/Vehicle.h"
 #include "../world/Entity.h"
+#include "../world/EntityTweener.h"
 #include "Track.h"
 
+#include <array>
 #include <iterator>
 
 // clang-format off
@@ -1007,6 +1009,15 @@ static void vehicle_sprite_paint_6D51DE(
     vehicle_sprite_paint(session, vehicle, ebx, ecx, z, vehicleEntry);
 }
 
+using vehicle_sprite_func = void (*)(
+    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
+    const rct_ride_entry_vehicle* vehicleEntry);
+
+static constexpr uint8_t NumVehicleBankRotations = 20;
+
+// One sprite function for every bank rotation of a pitch
+using vehicle_sprite_bank_funcs = std::array<vehicle_sprite_func, NumVehicleBankRotations>;
+
 // 6D51DE
 static void vehicle_sprite_0_0(
     paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
@@ -1365,74 +1376,38 @@ static void vehicle_sprite_0_19(
     }
 }
 
+// 0x009A3DE4:
+static constexpr const vehicle_sprite_bank_funcs vehicle_sprite_0_funcs = {
+    vehicle_sprite_0_0,
+    vehicle_sprite_0_1,
+    vehicle_sprite_0_2,
+    vehicle_sprite_0_3,
+    vehicle_sprite_0_4,
+    vehicle_sprite_0_5,
+    vehicle_sprite_0_6,
+    vehicle_sprite_0_7,
+    vehicle_sprite_0_8,
+    vehicle_sprite_0_9,
+    vehicle_sprite_0_10,
+    vehicle_sprite_0_11,
+    vehicle_sprite_0_12,
+    vehicle_sprite_0_13,
+    vehicle_sprite_0_14,
+    vehicle_sprite_0_0,
+    vehicle_sprite_0_16,
+    vehicle_sprite_0_17,
+    vehicle_sprite_0_18,
+    vehicle_sprite_0_19,
+};
+
 // 6D51D7
 static void vehicle_sprite_0(
     paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
     const rct_ride_entry_vehicle* vehicleEntry)
 {
-    // 0x009A3DE4:
-    switch (vehicle->bank_rotation)
+    if (vehicle->bank_rotation < std::size(vehicle_sprite_0_funcs))
     {
-        case 0:
-            vehicle_sprite_0_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 1:
-            vehicle_sprite_0_1(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 2:
-            vehicle_sprite_0_2(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 3:
-            vehicle_sprite_0_3(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 4:
-            vehicle_sprite_0_4(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 5:
-            vehicle_sprite_0_5(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 6:
-            vehicle_sprite_0_6(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 7:
-            vehicle_sprite_0_7(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 8:
-            vehicle_sprite_0_8(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 9:
-            vehicle_sprite_0_9(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 10:
-            vehicle_sprite_0_10(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 11:
-            vehicle_sprite_0_11(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 12:
-            vehicle_sprite_0_12(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 13:
-            vehicle_sprite_0_13(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 14:
-            vehicle_sprite_0_14(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 15:
-            vehicle_sprite_0_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 16:
-            vehicle_sprite_0_16(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 17:
-            vehicle_sprite_0_17(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 18:
-            vehicle_sprite_0_18(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 19:
-            vehicle_sprite_0_19(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
+        vehicle_sprite_0_funcs[vehicle->bank_rotation](session, vehicle, imageDirection, z, vehicleEntry);
     }
 }
 
@@ -1522,74 +1497,38 @@ static void vehicle_sprite_1_4(
     }
 }
 
+// 0x009A3C04:
+static constexpr const vehicle_sprite_bank_funcs vehicle_sprite_1_funcs = {
+    vehicle_sprite_1_0,
+    vehicle_sprite_1_1,
+    vehicle_sprite_1_2,
+    vehicle_sprite_1_3,
+    vehicle_sprite_1_4,
+    vehicle_sprite_1_0,
+    vehicle_sprite_1_0,
+    vehicle_sprite_1_0,
+    vehicle_sprite_1_0,
+    vehicle_sprite_1_0,
+    vehicle_sprite_1_0,
+    vehicle_sprite_1_0,
+    vehicle_sprite_1_0,
+    vehicle_sprite_1_0,
+    vehicle_sprite_1_0,
+    vehicle_sprite_1_0,
+    vehicle_sprite_1_1,
+    vehicle_sprite_1_2,
+    vehicle_sprite_1_3,
+    vehicle_sprite_1_4,
+};
+
 // 6D460D
 static void vehicle_sprite_1(
     paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
     const rct_ride_entry_vehicle* vehicleEntry)
 {
-    // 0x009A3C04:
-    switch (vehicle->bank_rotation)
+    if (vehicle->bank_rotation < std::size(vehicle_sprite_1_funcs))
     {
-        case 0:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 1:
-            vehicle_sprite_1_1(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 2:
-            vehicle_sprite_1_2(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 3:
-            vehicle_sprite_1_3(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 4:
-            vehicle_sprite_1_4(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 5:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 6:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 7:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 8:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 9:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 10:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 11:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 12:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 13:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 14:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 15:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 16:
-            vehicle_sprite_1_1(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 17:
-            vehicle_sprite_1_2(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 18:
-            vehicle_sprite_1_3(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 19:
-            vehicle_sprite_1_4(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
+        vehicle_sprite_1_funcs[vehicle->bank_rotation](session, vehicle, imageDirection, z, vehicleEntry);
     }
 }
 
@@ -1710,74 +1649,38 @@ static void vehicle_sprite_2_4(
     }
 }
 
+// 0x009A3CA4:
+static constexpr const vehicle_sprite_bank_funcs vehicle_sprite_2_funcs = {
+    vehicle_sprite_2_0,
+    vehicle_sprite_2_1,
+    vehicle_sprite_2_2,
+    vehicle_sprite_2_3,
+    vehicle_sprite_2_4,
+    vehicle_sprite_2_0,
+    vehicle_sprite_2_0,
+    vehicle_sprite_2_0,
+    vehicle_sprite_2_0,
+    vehicle_sprite_2_0,
+    vehicle_sprite_2_0,
+    vehicle_sprite_2_0,
+    vehicle_sprite_2_0,
+    vehicle_sprite_2_0,
+    vehicle_sprite_2_0,
+    vehicle_sprite_2_0,
+    vehicle_sprite_2_1,
+    vehicle_sprite_2_2,
+    vehicle_sprite_2_3,
+    vehicle_sprite_2_4,
+};
+
 // 6D476C
 static void vehicle_sprite_2(
     paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
     const rct_ride_entry_vehicle* vehicleEntry)
 {
-    // 0x009A3CA4:
-    switch (vehicle->bank_rotation)
+    if (vehicle->bank_rotation < std::size(vehicle_sprite_2_funcs))
     {
-        case 0:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 1:
-            vehicle_sprite_2_1(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 2:
-            vehicle_sprite_2_2(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 3:
-            vehicle_sprite_2_3(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 4:
-            vehicle_sprite_2_4(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 5:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 6:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 7:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 8:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 9:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 10:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 11:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 12:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 13:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 14:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 15:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 16:
-            vehicle_sprite_2_1(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 17:
-            vehicle_sprite_2_2(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 18:
-            vehicle_sprite_2_3(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 19:
-            vehicle_sprite_2_4(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
+        vehicle_sprite_2_funcs[vehicle->bank_rotation](session, vehicle, imageDirection, z, vehicleEntry);
     }
 }
 
@@ -1902,74 +1805,38 @@ static void vehicle_sprite_5_4(
     }
 }
 
+// 0x009A3C54:
+static constexpr const vehicle_sprite_bank_funcs vehicle_sprite_5_funcs = {
+    vehicle_sprite_5_0,
+    vehicle_sprite_5_1,
+    vehicle_sprite_5_2,
+    vehicle_sprite_5_3,
+    vehicle_sprite_5_4,
+    vehicle_sprite_5_0,
+    vehicle_sprite_5_0,
+    vehicle_sprite_5_0,
+    vehicle_sprite_5_0,
+    vehicle_sprite_5_0,
+    vehicle_sprite_5_0,
+    vehicle_sprite_5_0,
+    vehicle_sprite_5_0,
+    vehicle_sprite_5_0,
+    vehicle_sprite_5_0,
+    vehicle_sprite_5_0,
+    vehicle_sprite_5_1,
+    vehicle_sprite_5_2,
+    vehicle_sprite_5_3,
+    vehicle_sprite_5_4,
+};
+
 // 6D4636
 static void vehicle_sprite_5(
     paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
     const rct_ride_entry_vehicle* vehicleEntry)
 {
-    // 0x009A3C54:
-    switch (vehicle->bank_rotation)
+    if (vehicle->bank_rotation < std::size(vehicle_sprite_5_funcs))
     {
-        case 0:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 1:
-            vehicle_sprite_5_1(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 2:
-            vehicle_sprite_5_2(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 3:
-            vehicle_sprite_5_3(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 4:
-            vehicle_sprite_5_4(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 5:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 6:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 7:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 8:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 9:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 10:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 11:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 12:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 13:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 14:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 15:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 16:
-            vehicle_sprite_5_1(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 17:
-            vehicle_sprite_5_2(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 18:
-            vehicle_sprite_5_3(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 19:
-            vehicle_sprite_5_4(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
+        vehicle_sprite_5_funcs[vehicle->bank_rotation](session, vehicle, imageDirection, z, vehicleEntry);
     }
 }
 
@@ -2093,74 +1960,38 @@ static void vehicle_sprite_6_4(
     }
 }
 
+// 0x009A3CF4:
+static constexpr const vehicle_sprite_bank_funcs vehicle_sprite_6_funcs = {
+    vehicle_sprite_6_0,
+    vehicle_sprite_6_1,
+    vehicle_sprite_6_2,
+    vehicle_sprite_6_3,
+    vehicle_sprite_6_4,
+    vehicle_sprite_6_0,
+    vehicle_sprite_6_0,
+    vehicle_sprite_6_0,
+    vehicle_sprite_6_0,
+    vehicle_sprite_6_0,
+    vehicle_sprite_6_0,
+    vehicle_sprite_6_0,
+    vehicle_sprite_6_0,
+    vehicle_sprite_6_0,
+    vehicle_sprite_6_0,
+    vehicle_sprite_6_0,
+    vehicle_sprite_6_1,
+    vehicle_sprite_6_2,
+    vehicle_sprite_6_3,
+    vehicle_sprite_6_4,
+};
+
 // 6D47DD
 static void vehicle_sprite_6(
     paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
     const rct_ride_entry_vehicle* vehicleEntry)
 {
-    // 0x009A3CF4:
-    switch (vehicle->bank_rotation)
+    if (vehicle->bank_rotation < std::size(vehicle_sprite_6_funcs))
     {
-        case 0:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 1:
-            vehicle_sprite_6_1(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 2:
-            vehicle_sprite_6_2(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 3:
-            vehicle_sprite_6_3(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 4:
-            vehicle_sprite_6_4(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 5:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 6:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 7:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 8:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 9:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 10:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 11:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 12:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 13:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 14:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 15:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 16:
-            vehicle_sprite_6_1(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 17:
-            vehicle_sprite_6_2(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 18:
-            vehicle_sprite_6_3(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 19:
-            vehicle_sprite_6_4(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
+        vehicle_sprite_6_funcs[vehicle->bank_rotation](session, vehicle, imageDirection, z, vehicleEntry);
     }
 }
 
@@ -2564,74 +2395,38 @@ static void vehicle_sprite_50_3(
     }
 }
 
+// 0x009A3D44:
+static constexpr const vehicle_sprite_bank_funcs vehicle_sprite_50_funcs = {
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_1,
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_3,
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_1,
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_3,
+    vehicle_sprite_50_0,
+};
+
 // 6D4D60
 static void vehicle_sprite_50(
     paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
     const rct_ride_entry_vehicle* vehicleEntry)
 {
-    // 0x009A3D44:
-    switch (vehicle->bank_rotation)
+    if (vehicle->bank_rotation < std::size(vehicle_sprite_50_funcs))
     {
-        case 0:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 1:
-            vehicle_sprite_50_1(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 2:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 3:
-            vehicle_sprite_50_3(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 4:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 5:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 6:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 7:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 8:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 9:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 10:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 11:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 12:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 13:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 14:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 15:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 16:
-            vehicle_sprite_50_1(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 17:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 18:
-            vehicle_sprite_50_3(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 19:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
+        vehicle_sprite_50_funcs[vehicle->bank_rotation](session, vehicle, imageDirection, z, vehicleEntry);
     }
 }
 
@@ -2722,74 +2517,38 @@ static void vehicle_sprite_53_3(
     }
 }
 
+// 0x009A3D94:
+static constexpr const vehicle_sprite_bank_funcs vehicle_sprite_53_funcs = {
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_1,
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_3,
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_1,
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_3,
+    vehicle_sprite_53_0,
+};
+
 // 6D4D89
 static void vehicle_sprite_53(
     paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
     const rct_ride_entry_vehicle* vehicleEntry)
 {
-    // 0x009A3D94:
-    switch (vehicle->bank_rotation)
+    if (vehicle->bank_rotation < std::size(vehicle_sprite_53_funcs))
     {
-        case 0:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 1:
-            vehicle_sprite_53_1(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 2:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 3:
-            vehicle_sprite_53_3(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 4:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 5:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 6:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 7:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 8:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 9:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 10:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 11:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 12:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 13:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 14:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 15:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 16:
-            vehicle_sprite_53_1(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 17:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 18:
-            vehicle_sprite_53_3(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 19:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
+        vehicle_sprite_53_funcs[vehicle->bank_rotation](session, vehicle, imageDirection, z, vehicleEntry);
     }
 }
 
@@ -2889,73 +2648,80 @@ static void vehicle_sprite_59(
     }
 }
 
-// 0x009A3B14:
-using vehicle_sprite_func = void (*)(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry);
+// Pitches without banked sprites use the same function for every bank rotation
+static constexpr vehicle_sprite_bank_funcs vehicle_sprite_unbanked(vehicle_sprite_func func)
+{
+    vehicle_sprite_bank_funcs funcs{};
+    for (size_t i = 0; i < funcs.size(); i++)
+    {
+        funcs[i] = func;
+    }
+    return funcs;
+}
 
+// 0x009A3B14: indexed by pitch and then bank rotation, so painting a car needs a single lookup
 // clang-format off
-static constexpr const vehicle_sprite_func vehicle_sprite_funcs[] = {
-    vehicle_sprite_0,
-    vehicle_sprite_1,
-    vehicle_sprite_2,
-    vehicle_sprite_3,
-    vehicle_sprite_4,
-    vehicle_sprite_5,
-    vehicle_sprite_6,
-    vehicle_sprite_7,
-    vehicle_sprite_8,
-    vehicle_sprite_9,
-    vehicle_sprite_10,
-    vehicle_sprite_11,
-    vehicle_sprite_12,
-    vehicle_sprite_13,
-    vehicle_sprite_14,
-    vehicle_sprite_15,
-    vehicle_sprite_16,
-    vehicle_sprite_17,
-    vehicle_sprite_18,
-    vehicle_sprite_19,
-    vehicle_sprite_20,
-    vehicle_sprite_21,
-    vehicle_sprite_22,
-    vehicle_sprite_23,
-    vehicle_sprite_24,
-    vehicle_sprite_24,
-    vehicle_sprite_24,
-    vehicle_sprite_24,
-    vehicle_sprite_24,
-    vehicle_sprite_24,
-    vehicle_sprite_24,
-    vehicle_sprite_24,
-    vehicle_sprite_24,
-    vehicle_sprite_24,
-    vehicle_sprite_24,
-    vehicle_sprite_24,
-    vehicle_sprite_24,
-    vehicle_sprite_24,
-    vehicle_sprite_24,
-    vehicle_sprite_24,
-    vehicle_sprite_24,
-    vehicle_sprite_24,
-    vehicle_sprite_24,
-    vehicle_sprite_24,
-    vehicle_sprite_0,
-    vehicle_sprite_0,
-    vehicle_sprite_0,
-    vehicle_sprite_0,
-    vehicle_sprite_0,
-    vehicle_sprite_0,
-    vehicle_sprite_50,
-    vehicle_sprite_51,
-    vehicle_sprite_52,
-    vehicle_sprite_53,
-    vehicle_sprite_54,
-    vehicle_sprite_55,
-    vehicle_sprite_56,
-    vehicle_sprite_57,
-    vehicle_sprite_58,
-    vehicle_sprite_59,
+static constexpr const vehicle_sprite_bank_funcs vehicle_sprite_funcs[] = {
+    vehicle_sprite_0_funcs,
+    vehicle_sprite_1_funcs,
+    vehicle_sprite_2_funcs,
+    vehicle_sprite_unbanked(vehicle_sprite_3),
+    vehicle_sprite_unbanked(vehicle_sprite_4),
+    vehicle_sprite_5_funcs,
+    vehicle_sprite_6_funcs,
+    vehicle_sprite_unbanked(vehicle_sprite_7),
+    vehicle_sprite_unbanked(vehicle_sprite_8),
+    vehicle_sprite_unbanked(vehicle_sprite_9),
+    vehicle_sprite_unbanked(vehicle_sprite_10),
+    vehicle_sprite_unbanked(vehicle_sprite_11),
+    vehicle_sprite_unbanked(vehicle_sprite_12),
+    vehicle_sprite_unbanked(vehicle_sprite_13),
+    vehicle_sprite_unbanked(vehicle_sprite_14),
+    vehicle_sprite_unbanked(vehicle_sprite_15),
+    vehicle_sprite_unbanked(vehicle_sprite_16),
+    vehicle_sprite_unbanked(vehicle_sprite_17),
+    vehicle_sprite_unbanked(vehicle_sprite_18),
+    vehicle_sprite_unbanked(vehicle_sprite_19),
+    vehicle_sprite_unbanked(vehicle_sprite_20),
+    vehicle_sprite_unbanked(vehicle_sprite_21),
+    vehicle_sprite_unbanked(vehicle_sprite_22),
+    vehicle_sprite_unbanked(vehicle_sprite_23),
+    vehicle_sprite_unbanked(vehicle_sprite_24),
+    vehicle_sprite_unbanked(vehicle_sprite_24),
+    vehicle_sprite_unbanked(vehicle_sprite_24),
+    vehicle_sprite_unbanked(vehicle_sprite_24),
+    vehicle_sprite_unbanked(vehicle_sprite_24),
+    vehicle_sprite_unbanked(vehicle_sprite_24),
+    vehicle_sprite_unbanked(vehicle_sprite_24),
+    vehicle_sprite_unbanked(vehicle_sprite_24),
+    vehicle_sprite_unbanked(vehicle_sprite_24),
+    vehicle_sprite_unbanked(vehicle_sprite_24),
+    vehicle_sprite_unbanked(vehicle_sprite_24),
+    vehicle_sprite_unbanked(vehicle_sprite_24),
+    vehicle_sprite_unbanked(vehicle_sprite_24),
+    vehicle_sprite_unbanked(vehicle_sprite_24),
+    vehicle_sprite_unbanked(vehicle_sprite_24),
+    vehicle_sprite_unbanked(vehicle_sprite_24),
+    vehicle_sprite_unbanked(vehicle_sprite_24),
+    vehicle_sprite_unbanked(vehicle_sprite_24),
+    vehicle_sprite_unbanked(vehicle_sprite_24),
+    vehicle_sprite_unbanked(vehicle_sprite_24),
+    vehicle_sprite_0_funcs,
+    vehicle_sprite_0_funcs,
+    vehicle_sprite_0_funcs,
+    vehicle_sprite_0_funcs,
+    vehicle_sprite_0_funcs,
+    vehicle_sprite_0_funcs,
+    vehicle_sprite_50_funcs,
+    vehicle_sprite_unbanked(vehicle_sprite_51),
+    vehicle_sprite_unbanked(vehicle_sprite_52),
+    vehicle_sprite_53_funcs,
+    vehicle_sprite_unbanked(vehicle_sprite_54),
+    vehicle_sprite_unbanked(vehicle_sprite_55),
+    vehicle_sprite_unbanked(vehicle_sprite_56),
+    vehicle_sprite_unbanked(vehicle_sprite_57),
+    vehicle_sprite_unbanked(vehicle_sprite_58),
+    vehicle_sprite_unbanked(vehicle_sprite_59),
 };
 // clang-format on
 
@@ -3123,9 +2889,9 @@ void vehicle_visual_default(
     paint_session* session, int32_t imageDirection, int32_t z, const Vehicle* vehicle,
     const rct_ride_entry_vehicle* vehicleEntry)
 {
-    if (vehicle->Pitch < std::size(vehicle_sprite_funcs))
+    if (vehicle->Pitch < std::size(vehicle_sprite_funcs) && vehicle->bank_rotation < NumVehicleBankRotations)
     {
-        vehicle_sprite_funcs[vehicle->Pitch](session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_funcs[vehicle->Pitch][vehicle->bank_rotation](session, vehicle, imageDirection, z, vehicleEntry);
     }
 }
 
@@ -3137,9 +2903,10 @@ template<> void PaintEntity(paint_session* session, const Vehicle* vehicle, int3
 {
     const rct_ride_entry_vehicle* vehicleEntry;
 
-    int32_t x = vehicle->x;
-    int32_t y = vehicle->y;
-    int32_t z = vehicle->z;
+    const auto renderPos = EntityTweener::Get().GetRenderState(*vehicle).Position;
+    int32_t x = renderPos.x;
+    int32_t y = renderPos.y;
+    int32_t z = renderPos.z;
 
     if (vehicle->IsCrashedVehicle)
     {
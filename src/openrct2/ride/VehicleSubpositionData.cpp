@@ -11,6 +11,10 @@
 
 #include "Vehicle.h"
 
+#include <array>
+#include <unordered_map>
+#include <vector>
+
 #define CREATE_VEHICLE_INFO(VAR, ...)                                                                                          \
     static constexpr const rct_vehicle_info VAR##_data[] = __VA_ARGS__;                                                        \
     static constexpr const rct_vehicle_info_list VAR = { static_cast<uint16_t>(std::size(VAR##_data)), VAR##_data };
@@ -25843,4 +25847,107 @@ constexpr const rct_vehicle_info_list * const * gTrackVehicleInfo[static_cast<ui
     TrackVehicleInfoListReverserRCRearBogie,      // VehicleTrackSubposition::ReverserRCRearBogie
 };
 
+static constexpr const size_t TrackVehicleInfoListSizes[static_cast<uint8_t>(VehicleTrackSubposition::Count)] = {
+    std::size(TrackVehicleInfoListDefault),
+    std::size(TrackVehicleInfoListChairliftGoingOut),
+    std::size(TrackVehicleInfoListChairliftGoingBack),
+    std::size(TrackVehicleInfoListChairliftEndBullwheel),
+    std::size(TrackVehicleInfoListChairliftStartBullwheel),
+    std::size(TrackVehicleInfoListGoKartsLeftLane),
+    std::size(TrackVehicleInfoListGoKartsRightLane),
+    std::size(TrackVehicleInfoListGoKartsMovingToRightLane),
+    std::size(TrackVehicleInfoListGoKartsMovingToLeftLane),
+    std::size(TrackVehicleInfoListMiniGolfStartPathA9),
+    std::size(TrackVehicleInfoListMiniGolfBallPathA10),
+    std::size(TrackVehicleInfoListMiniGolfPathB11),
+    std::size(TrackVehicleInfoListMiniGolfBallPathB12),
+    std::size(TrackVehicleInfoListMiniGolfPathC13),
+    std::size(TrackVehicleInfoListMiniGolfPathC14),
+    std::size(TrackVehicleInfoListReverserRCFrontBogie),
+    std::size(TrackVehicleInfoListReverserRCRearBogie),
+};
+
 // clang-format on
+
+namespace
+{
+    /**
+     * The move infos are defined as over a thousand separate arrays that are reached through two levels of pointers.
+     * This packs the lists of all subpositions one after the other into a single index and copies the infos they point
+     * to into one block in the same order, so the infos of neighbouring track pieces and directions end up next to
+     * each other. Lists that are shared between track pieces are only copied once.
+     */
+    class PackedTrackVehicleInfo
+    {
+    private:
+        std::array<size_t, EnumValue(VehicleTrackSubposition::Count) + 1> _subpositionStart{};
+        std::vector<rct_vehicle_info_list> _lists;
+        std::vector<rct_vehicle_info> _infos;
+
+    public:
+        PackedTrackVehicleInfo()
+        {
+            std::unordered_map<const rct_vehicle_info_list*, size_t> infoOffsets;
+            std::vector<const rct_vehicle_info_list*> uniqueLists;
+            size_t numLists = 0;
+            size_t numInfos = 0;
+            for (size_t i = 0; i < std::size(gTrackVehicleInfo); i++)
+            {
+                _subpositionStart[i] = numLists;
+                for (size_t j = 0; j < TrackVehicleInfoListSizes[i]; j++)
+                {
+                    auto list = gTrackVehicleInfo[i][j];
+                    if (infoOffsets.emplace(list, numInfos).second)
+                    {
+                        uniqueLists.push_back(list);
+                        numInfos += list->size;
+                    }
+                }
+                numLists += TrackVehicleInfoListSizes[i];
+            }
+            _subpositionStart.back() = numLists;
+
+            // The infos must not be reallocated once the lists point into them
+            _infos.reserve(numInfos);
+            for (auto list : uniqueLists)
+            {
+                _infos.insert(_infos.end(), list->info, list->info + list->size);
+            }
+
+            _lists.reserve(numLists);
+            for (size_t i = 0; i < std::size(gTrackVehicleInfo); i++)
+            {
+                for (size_t j = 0; j < TrackVehicleInfoListSizes[i]; j++)
+                {
+                    auto list = gTrackVehicleInfo[i][j];
+                    _lists.push_back({ list->size, _infos.data() + infoOffsets[list] });
+                }
+            }
+        }
+
+        PackedTrackVehicleInfo(const PackedTrackVehicleInfo&) = delete;
+
+        const rct_vehicle_info_list* Get(VehicleTrackSubposition trackSubposition, uint16_t typeAndDirection) const
+        {
+            const auto subposition = EnumValue(trackSubposition);
+            if (subposition >= std::size(gTrackVehicleInfo))
+            {
+                return nullptr;
+            }
+            const auto index = _subpositionStart[subposition] + typeAndDirection;
+            if (index >= _subpositionStart[subposition + 1])
+            {
+                return nullptr;
+            }
+            return &_lists[index];
+        }
+    };
+} // namespace
+
+// Only built from constant data, so it is safe to construct during static initialisation
+static const PackedTrackVehicleInfo _packedTrackVehicleInfo;
+
+const rct_vehicle_info_list* GetTrackVehicleInfoList(VehicleTrackSubposition trackSubposition, uint16_t typeAndDirection)
+{
+    return _packedTrackVehicleInfo.Get(trackSubposition, typeAndDirection);
+}
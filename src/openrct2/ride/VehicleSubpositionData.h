@@ -50,3 +50,10 @@ struct rct_vehicle_info_list
 };
 
 extern const rct_vehicle_info_list* const* const gTrackVehicleInfo[EnumValue(VehicleTrackSubposition::Count)];
+
+/**
+ * Looks up the move infos of a track piece in a packed copy of gTrackVehicleInfo that keeps the lists of all
+ * subpositions in one index and all of their infos in one contiguous block.
+ * @returns nullptr if the subposition has no entry for the track type and direction.
+ */
+const rct_vehicle_info_list* GetTrackVehicleInfoList(VehicleTrackSubposition trackSubposition, uint16_t typeAndDirection);
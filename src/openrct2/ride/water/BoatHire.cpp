@@ -29,34 +29,95 @@ enum
     SPR_BOAT_HIRE_FLAT_QUARTER_TURN_1_TILE_BACK_SE_SW = 28534,
 };
 
+// clang-format off
 /** rct2: 0x008B0E40 */
-static void paint_boat_hire_track_flat(
-    paint_session* session, const Ride* ride, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TrackElement& trackElement)
-{
-    uint32_t imageId;
-
-    const auto offset = CoordsXYZ{ 0, 0, height };
-    if (direction & 1)
+static constexpr const TrackPaintDescriptor BoatHireTrackFlat = {
     {
-        imageId = SPR_BOAT_HIRE_FLAT_BACK_NW_SE | session->TrackColours[SCHEME_TRACK];
-        PaintAddImageAsParent(session, imageId, offset, { 1, 32, 3 }, { 4, 0, height });
+        {
+            {
+                { SPR_BOAT_HIRE_FLAT_BACK_SW_NE, { 0, 0, 0 }, { 0, 4, 0 }, { 32, 1, 3 } },
+                { SPR_BOAT_HIRE_FLAT_FRONT_SW_NE, { 0, 0, 0 }, { 0, 28, 0 }, { 32, 1, 3 } },
+            },
+            TrackPaintTunnelSide::None,
+            TrackPaintNoSupports,
+        },
+        {
+            {
+                { SPR_BOAT_HIRE_FLAT_BACK_NW_SE, { 0, 0, 0 }, { 4, 0, 0 }, { 1, 32, 3 } },
+                { SPR_BOAT_HIRE_FLAT_FRONT_NW_SE, { 0, 0, 0 }, { 28, 0, 0 }, { 1, 32, 3 } },
+            },
+            TrackPaintTunnelSide::None,
+            TrackPaintNoSupports,
+        },
+        {
+            {
+                { SPR_BOAT_HIRE_FLAT_BACK_SW_NE, { 0, 0, 0 }, { 0, 4, 0 }, { 32, 1, 3 } },
+                { SPR_BOAT_HIRE_FLAT_FRONT_SW_NE, { 0, 0, 0 }, { 0, 28, 0 }, { 32, 1, 3 } },
+            },
+            TrackPaintTunnelSide::None,
+            TrackPaintNoSupports,
+        },
+        {
+            {
+                { SPR_BOAT_HIRE_FLAT_BACK_NW_SE, { 0, 0, 0 }, { 4, 0, 0 }, { 1, 32, 3 } },
+                { SPR_BOAT_HIRE_FLAT_FRONT_NW_SE, { 0, 0, 0 }, { 28, 0, 0 }, { 1, 32, 3 } },
+            },
+            TrackPaintTunnelSide::None,
+            TrackPaintNoSupports,
+        },
+    },
+    0, 0, 0, 0, false,
+    SEGMENT_D0 | SEGMENT_C4 | SEGMENT_CC,
+    16,
+};
 
-        imageId = SPR_BOAT_HIRE_FLAT_FRONT_NW_SE | session->TrackColours[SCHEME_TRACK];
-        PaintAddImageAsParent(session, imageId, offset, { 1, 32, 3 }, { 28, 0, height });
-    }
-    else
+/** rct2: 0x008B0E80 */
+static constexpr const TrackPaintDescriptor BoatHireTrackLeftQuarterTurn1Tile = {
     {
-        imageId = SPR_BOAT_HIRE_FLAT_BACK_SW_NE | session->TrackColours[SCHEME_TRACK];
-        PaintAddImageAsParent(session, imageId, offset, { 32, 1, 3 }, { 0, 4, height });
-
-        imageId = SPR_BOAT_HIRE_FLAT_FRONT_SW_NE | session->TrackColours[SCHEME_TRACK];
-        PaintAddImageAsParent(session, imageId, offset, { 32, 1, 3 }, { 0, 28, height });
-    }
+        {
+            {
+                { SPR_BOAT_HIRE_FLAT_QUARTER_TURN_1_TILE_BACK_SW_NW, { 0, 0, 0 }, { 0, 0, 0 }, { 32, 32, 0 } },
+                { SPR_BOAT_HIRE_FLAT_QUARTER_TURN_1_TILE_FRONT_SW_NW, { 0, 0, 0 }, { 28, 28, 2 }, { 3, 3, 3 } },
+            },
+            TrackPaintTunnelSide::None,
+            TrackPaintNoSupports,
+        },
+        {
+            {
+                { SPR_BOAT_HIRE_FLAT_QUARTER_TURN_1_TILE_BACK_NW_NE, { 0, 0, 0 }, { 0, 0, 0 }, { 32, 32, 0 } },
+                { SPR_BOAT_HIRE_FLAT_QUARTER_TURN_1_TILE_FRONT_NW_NE, { 0, 0, 0 }, { 28, 28, 2 }, { 3, 3, 3 } },
+            },
+            TrackPaintTunnelSide::None,
+            TrackPaintNoSupports,
+        },
+        {
+            {
+                { SPR_BOAT_HIRE_FLAT_QUARTER_TURN_1_TILE_BACK_NE_SE, { 0, 0, 0 }, { 0, 0, 0 }, { 32, 32, 0 } },
+                { SPR_BOAT_HIRE_FLAT_QUARTER_TURN_1_TILE_FRONT_NE_SE, { 0, 0, 0 }, { 28, 28, 2 }, { 3, 3, 3 } },
+            },
+            TrackPaintTunnelSide::None,
+            TrackPaintNoSupports,
+        },
+        {
+            {
+                { SPR_BOAT_HIRE_FLAT_QUARTER_TURN_1_TILE_FRONT_SE_SW, { 0, 0, 0 }, { 28, 28, 2 }, { 3, 3, 3 } },
+                { SPR_BOAT_HIRE_FLAT_QUARTER_TURN_1_TILE_BACK_SE_SW, { 0, 0, 0 }, { 0, 0, 0 }, { 32, 32, 0 } },
+            },
+            TrackPaintTunnelSide::None,
+            TrackPaintNoSupports,
+        },
+    },
+    0, 0, 0, 0, false,
+    SEGMENT_D0 | SEGMENT_C4 | SEGMENT_C8,
+    16,
+};
+// clang-format on
 
-    paint_util_set_segment_support_height(
-        session, paint_util_rotate_segments(SEGMENT_D0 | SEGMENT_C4 | SEGMENT_CC, direction), 0xFFFF, 0);
-    paint_util_set_general_support_height(session, height + 16, 0x20);
+static void paint_boat_hire_track_flat(
+    paint_session* session, const Ride* ride, uint8_t trackSequence, uint8_t direction, int32_t height,
+    const TrackElement& trackElement)
+{
+    track_paint_util_paint_descriptor(session, BoatHireTrackFlat, direction, height);
 }
 
 /** rct2: 0x008B0E50 */
@@ -86,48 +147,11 @@ static void paint_boat_hire_station(
     paint_util_set_general_support_height(session, height + 32, 0x20);
 }
 
-/** rct2: 0x008B0E80 */
 static void paint_boat_hire_track_left_quarter_turn_1_tile(
     paint_session* session, const Ride* ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    uint32_t imageId;
-    const auto offset = CoordsXYZ{ 0, 0, height };
-    switch (direction)
-    {
-        case 0:
-            imageId = SPR_BOAT_HIRE_FLAT_QUARTER_TURN_1_TILE_BACK_SW_NW | session->TrackColours[SCHEME_TRACK];
-            PaintAddImageAsParent(session, imageId, offset, { 32, 32, 0 }, { 0, 0, height });
-
-            imageId = SPR_BOAT_HIRE_FLAT_QUARTER_TURN_1_TILE_FRONT_SW_NW | session->TrackColours[SCHEME_TRACK];
-            PaintAddImageAsParent(session, imageId, offset, { 3, 3, 3 }, { 28, 28, height + 2 });
-            break;
-        case 1:
-            imageId = SPR_BOAT_HIRE_FLAT_QUARTER_TURN_1_TILE_BACK_NW_NE | session->TrackColours[SCHEME_TRACK];
-            PaintAddImageAsParent(session, imageId, offset, { 32, 32, 0 }, { 0, 0, height });
-
-            imageId = SPR_BOAT_HIRE_FLAT_QUARTER_TURN_1_TILE_FRONT_NW_NE | session->TrackColours[SCHEME_TRACK];
-            PaintAddImageAsParent(session, imageId, offset, { 3, 3, 3 }, { 28, 28, height + 2 });
-            break;
-        case 2:
-            imageId = SPR_BOAT_HIRE_FLAT_QUARTER_TURN_1_TILE_BACK_NE_SE | session->TrackColours[SCHEME_TRACK];
-            PaintAddImageAsParent(session, imageId, offset, { 32, 32, 0 }, { 0, 0, height });
-
-            imageId = SPR_BOAT_HIRE_FLAT_QUARTER_TURN_1_TILE_FRONT_NE_SE | session->TrackColours[SCHEME_TRACK];
-            PaintAddImageAsParent(session, imageId, offset, { 3, 3, 3 }, { 28, 28, height + 2 });
-            break;
-        case 3:
-            imageId = SPR_BOAT_HIRE_FLAT_QUARTER_TURN_1_TILE_FRONT_SE_SW | session->TrackColours[SCHEME_TRACK];
-            PaintAddImageAsParent(session, imageId, offset, { 3, 3, 3 }, { 28, 28, height + 2 });
-
-            imageId = SPR_BOAT_HIRE_FLAT_QUARTER_TURN_1_TILE_BACK_SE_SW | session->TrackColours[SCHEME_TRACK];
-            PaintAddImageAsParent(session, imageId, offset, { 32, 32, 0 }, { 0, 0, height });
-            break;
-    }
-
-    paint_util_set_segment_support_height(
-        session, paint_util_rotate_segments(SEGMENT_D0 | SEGMENT_C4 | SEGMENT_C8, direction), 0xFFFF, 0);
-    paint_util_set_general_support_height(session, height + 16, 0x20);
+    track_paint_util_paint_descriptor(session, BoatHireTrackLeftQuarterTurn1Tile, direction, height);
 }
 
 /** rct2: 0x008B0E90 */
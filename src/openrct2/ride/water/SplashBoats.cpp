@@ -13,6 +13,7 @@
 #include "../../paint/Supports.h"
 #include "../../paint/sprite/Paint.Sprite.h"
 #include "../../world/Entity.h"
+#include "../../world/EntityTweener.h"
 #include "../Track.h"
 #include "../TrackPaint.h"
 #include "../Vehicle.h"
@@ -1266,8 +1267,9 @@ void vehicle_visual_splash_boats_or_water_coaster(
     }
     session->CurrentlyDrawnItem = vehicle;
     imageDirection = ((session->CurrentRotation * 8) + vehicle->sprite_direction) & 0x1F;
-    session->SpritePosition.x = vehicle->x;
-    session->SpritePosition.y = vehicle->y;
+    const auto renderPos = EntityTweener::Get().GetRenderState(*vehicle).Position;
+    session->SpritePosition.x = renderPos.x;
+    session->SpritePosition.y = renderPos.y;
     PaintEntity(session, vehicle, imageDirection);
 }
 #endif
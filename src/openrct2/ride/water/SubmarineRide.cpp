@@ -114,36 +114,41 @@ static void submarine_ride_paint_track_station(
     paint_util_set_general_support_height(session, height + 32, 0x20);
 }
 
+// clang-format off
+static constexpr const TrackPaintDescriptor SubmarineRideTrackFlat = {
+    {
+        {
+            { { SPR_TRACK_SUBMARINE_RIDE_MINI_HELICOPTERS_FLAT_NE_SW, { 0, 0, 0 }, { 0, 6, 0 }, { 32, 20, 3 } } },
+            TrackPaintTunnelSide::Left,
+            METAL_SUPPORTS_STICK,
+        },
+        {
+            { { SPR_TRACK_SUBMARINE_RIDE_MINI_HELICOPTERS_FLAT_SE_NW, { 0, 0, 0 }, { 6, 0, 0 }, { 20, 32, 3 } } },
+            TrackPaintTunnelSide::Right,
+            METAL_SUPPORTS_STICK_ALT,
+        },
+        {
+            { { SPR_TRACK_SUBMARINE_RIDE_MINI_HELICOPTERS_FLAT_NE_SW, { 0, 0, 0 }, { 0, 6, 0 }, { 32, 20, 3 } } },
+            TrackPaintTunnelSide::Left,
+            METAL_SUPPORTS_STICK,
+        },
+        {
+            { { SPR_TRACK_SUBMARINE_RIDE_MINI_HELICOPTERS_FLAT_SE_NW, { 0, 0, 0 }, { 6, 0, 0 }, { 20, 32, 3 } } },
+            TrackPaintTunnelSide::Right,
+            METAL_SUPPORTS_STICK_ALT,
+        },
+    },
+    -16, TUNNEL_0, 4, -1, true,
+    SEGMENT_D0 | SEGMENT_C4 | SEGMENT_CC,
+    16,
+};
+// clang-format on
+
 static void submarine_ride_paint_track_flat(
     paint_session* session, const Ride* ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    int32_t heightLower = height - 16;
-    uint32_t imageId;
-
-    if (direction & 1)
-    {
-        imageId = SPR_TRACK_SUBMARINE_RIDE_MINI_HELICOPTERS_FLAT_SE_NW | session->TrackColours[SCHEME_TRACK];
-        PaintAddImageAsParent(session, imageId, 0, 0, 20, 32, 3, heightLower, 6, 0, heightLower);
-        paint_util_push_tunnel_right(session, heightLower, TUNNEL_0);
-    }
-    else
-    {
-        imageId = SPR_TRACK_SUBMARINE_RIDE_MINI_HELICOPTERS_FLAT_NE_SW | session->TrackColours[SCHEME_TRACK];
-        PaintAddImageAsParent(session, imageId, 0, 0, 32, 20, 3, heightLower, 0, 6, heightLower);
-        paint_util_push_tunnel_left(session, heightLower, TUNNEL_0);
-    }
-
-    if (track_paint_util_should_paint_supports(session->MapPosition))
-    {
-        metal_a_supports_paint_setup(
-            session, (direction & 1) ? METAL_SUPPORTS_STICK_ALT : METAL_SUPPORTS_STICK, 4, -1, heightLower,
-            session->TrackColours[SCHEME_SUPPORTS]);
-    }
-
-    paint_util_set_segment_support_height(
-        session, paint_util_rotate_segments(SEGMENT_D0 | SEGMENT_C4 | SEGMENT_CC, direction), 0xFFFF, 0);
-    paint_util_set_general_support_height(session, height + 16, 0x20);
+    track_paint_util_paint_descriptor(session, SubmarineRideTrackFlat, direction, height);
 }
 
 static void submarine_ride_paint_track_left_quarter_turn_3_tiles(
@@ -51,6 +51,7 @@
 
 #include <algorithm>
 #include <bitset>
+#include <optional>
 
 const rct_string_id ScenarioCategoryStringIds[SCENARIO_CATEGORY_COUNT] = {
     STR_BEGINNER_PARKS, STR_CHALLENGING_PARKS,    STR_EXPERT_PARKS, STR_REAL_PARKS, STR_OTHER_PARKS,
@@ -309,7 +310,7 @@ static void scenario_day_update()
     context_broadcast_intent(&intent);
 }
 
-static void scenario_week_update()
+static void scenario_week_update(const ParkGuestStatistics& guestStatistics)
 {
     int32_t month = date_get_month(gDateMonthsElapsed);
 
@@ -317,9 +318,9 @@ static void scenario_week_update()
     finance_pay_research();
     finance_pay_interest();
     marketing_update();
-    peep_problem_warnings_update();
+    peep_problem_warnings_update(guestStatistics);
     ride_check_all_reachable();
-    ride_update_favourited_stat();
+    ride_update_favourited_stat(guestStatistics);
 
     auto water_type = static_cast<rct_water_type*>(object_entry_get_chunk(ObjectType::Water, 0));
 
@@ -339,12 +340,12 @@ static void scenario_fortnight_update()
     finance_pay_ride_upkeep();
 }
 
-static void scenario_month_update()
+static void scenario_month_update(const ParkGuestStatistics& guestStatistics)
 {
     finance_shift_expenditure_table();
     scenario_objective_check();
     scenario_entrance_fee_too_high_check();
-    award_update_all();
+    award_update_all(guestStatistics);
 }
 
 static void scenario_update_daynight_cycle()
@@ -396,9 +397,17 @@ void scenario_update()
         {
             scenario_day_update();
         }
+
+        // Months start on a week start, the warnings and awards share one pass as guests do not update in between
+        std::optional<ParkGuestStatistics> guestStatistics;
+        if (date_is_week_start(gDateMonthTicks) || date_is_month_start(gDateMonthTicks))
+        {
+            guestStatistics = park_get_guest_statistics();
+        }
+
         if (date_is_week_start(gDateMonthTicks))
         {
-            scenario_week_update();
+            scenario_week_update(*guestStatistics);
         }
         if (date_is_fortnight_start(gDateMonthTicks))
         {
@@ -406,7 +415,7 @@ void scenario_update()
         }
         if (date_is_month_start(gDateMonthTicks))
         {
-            scenario_month_update();
+            scenario_month_update(*guestStatistics);
         }
     }
     scenario_update_daynight_cycle();
@@ -319,11 +319,18 @@ class ScenarioRepository final : public IScenarioRepository
 {
 private:
     static constexpr uint32_t HighscoreFileVersion = 2;
+    // Number of highscores appended to the end of the highscores file before it is written again from scratch.
+    static constexpr uint32_t MaxHighscoreJournalEntries = 32;
 
     std::shared_ptr<IPlatformEnvironment> const _env;
     ScenarioFileIndex const _fileIndex;
     std::vector<scenario_index_entry> _scenarios;
     std::vector<scenario_highscore_entry*> _highscores;
+    bool _highscoresLoaded = false;
+    uint64_t _highscoresLastModified = 0;
+    uint32_t _highscoreJournalEntries = 0;
+    // Whether the highscores file is known to be in the current format, so new highscores can be appended to it.
+    bool _canAppendHighscores = false;
 
 public:
     explicit ScenarioRepository(const std::shared_ptr<IPlatformEnvironment>& env)
@@ -349,10 +356,16 @@ public:
             AddScenario(scenario);
         }
 
-        // Sort the scenarios and load the highscores
+        // Sort the scenarios and load the highscores, which only need reading again when another instance of the
+        // game changed them.
         Sort();
-        LoadScores();
-        LoadLegacyScores();
+        if (!_highscoresLoaded || GetHighscoresLastModified() != _highscoresLastModified)
+        {
+            LoadScores();
+            LoadLegacyScores();
+            _highscoresLoaded = true;
+            _highscoresLastModified = GetHighscoresLastModified();
+        }
         AttachHighscores();
     }
 
@@ -418,28 +431,13 @@ public:
 
     bool TryRecordHighscore(int32_t language, const utf8* scenarioFileName, money64 companyValue, const utf8* name) override
     {
-        // Scan the scenarios so we have a fresh list to query. This is to prevent the issue of scenario completions
-        // not getting recorded, see #4951.
-        Scan(language);
-
-        scenario_index_entry* scenario = GetByFilename(scenarioFileName);
-
-        // Check if this is an RCTC scenario that corresponds to a known RCT1/2 scenario or vice versa, see #12626
-        if (scenario == nullptr)
+        // Scan the scenarios if the scenario is not known yet, so we have a fresh list to query. This is to prevent
+        // the issue of scenario completions not getting recorded, see #4951.
+        scenario_index_entry* scenario = FindScenarioForHighscore(scenarioFileName);
+        if (scenario == nullptr || !_highscoresLoaded || GetHighscoresLastModified() != _highscoresLastModified)
         {
-            const std::string scenarioBaseName = String::ToStd(Path::GetFileNameWithoutExtension(scenarioFileName));
-            const std::string scenarioExtension = String::ToStd(Path::GetExtension(scenarioFileName));
-
-            if (String::Equals(scenarioExtension, ".sea", true))
-            {
-                // Get scenario using RCT2 style name of RCTC scenario
-                scenario = GetByFilename((scenarioBaseName + ".sc6").c_str());
-            }
-            else if (String::Equals(scenarioExtension, ".sc6", true))
-            {
-                // Get scenario using RCTC style name of RCT2 scenario
-                scenario = GetByFilename((scenarioBaseName + ".sea").c_str());
-            }
+            Scan(language);
+            scenario = FindScenarioForHighscore(scenarioFileName);
         }
 
         if (scenario != nullptr)
@@ -467,7 +465,7 @@ public:
                 highscore->fileName = String::Duplicate(Path::GetFileName(scenario->path));
                 highscore->name = String::Duplicate(name);
                 highscore->company_value = companyValue;
-                SaveHighscores();
+                SaveHighscore(*highscore);
                 return true;
             }
         }
@@ -475,6 +473,30 @@ public:
     }
 
 private:
+    scenario_index_entry* FindScenarioForHighscore(const utf8* scenarioFileName)
+    {
+        scenario_index_entry* scenario = GetByFilename(scenarioFileName);
+
+        // Check if this is an RCTC scenario that corresponds to a known RCT1/2 scenario or vice versa, see #12626
+        if (scenario == nullptr)
+        {
+            const std::string scenarioBaseName = String::ToStd(Path::GetFileNameWithoutExtension(scenarioFileName));
+            const std::string scenarioExtension = String::ToStd(Path::GetExtension(scenarioFileName));
+
+            if (String::Equals(scenarioExtension, ".sea", true))
+            {
+                // Get scenario using RCT2 style name of RCTC scenario
+                scenario = GetByFilename((scenarioBaseName + ".sc6").c_str());
+            }
+            else if (String::Equals(scenarioExtension, ".sc6", true))
+            {
+                // Get scenario using RCTC style name of RCT2 scenario
+                scenario = GetByFilename((scenarioBaseName + ".sea").c_str());
+            }
+        }
+        return scenario;
+    }
+
     scenario_index_entry* GetByFilename(const utf8* filename)
     {
         const ScenarioRepository* repo = this;
@@ -588,6 +610,7 @@ private:
 
     void LoadScores()
     {
+        _canAppendHighscores = false;
         std::string path = _env->GetFilePath(PATHID::SCORES);
         if (!Platform::FileExists(path))
         {
@@ -605,6 +628,7 @@ private:
             }
 
             ClearHighscores();
+            _highscoreJournalEntries = 0;
 
             uint32_t numHighscores = fs.ReadValue<uint32_t>();
             for (uint32_t i = 0; i < numHighscores; i++)
@@ -615,6 +639,33 @@ private:
                 highscore->company_value = fileVersion == 1 ? fs.ReadValue<money32>() : fs.ReadValue<money64>();
                 highscore->timestamp = fs.ReadValue<datetime64>();
             }
+
+            // Highscores recorded since the file was last written in full are appended after the counted ones, a
+            // later entry replaces an earlier one of the same scenario. Older versions of the game stop reading at
+            // the count.
+            if (fileVersion == HighscoreFileVersion)
+            {
+                while (fs.GetPosition() < fs.GetLength())
+                {
+                    auto fileName = std::unique_ptr<utf8, decltype(&std::free)>(fs.ReadString(), &std::free);
+                    auto recordName = std::unique_ptr<utf8, decltype(&std::free)>(fs.ReadString(), &std::free);
+                    auto companyValue = fs.ReadValue<money64>();
+                    auto timestamp = fs.ReadValue<datetime64>();
+
+                    auto it = std::find_if(_highscores.begin(), _highscores.end(), [&fileName](const auto* highscore) {
+                        return String::Equals(highscore->fileName, fileName.get(), true);
+                    });
+                    scenario_highscore_entry* highscore = it != _highscores.end() ? *it : InsertHighscore();
+                    SafeFree(highscore->fileName);
+                    SafeFree(highscore->name);
+                    highscore->fileName = fileName.release();
+                    highscore->name = recordName.release();
+                    highscore->company_value = companyValue;
+                    highscore->timestamp = timestamp;
+                    _highscoreJournalEntries++;
+                }
+                _canAppendHighscores = true;
+            }
         }
         catch (const std::exception&)
         {
@@ -732,6 +783,46 @@ private:
         }
     }
 
+    uint64_t GetHighscoresLastModified() const
+    {
+        std::string path = _env->GetFilePath(PATHID::SCORES);
+        return File::Exists(path) ? File::GetLastModified(path) : 0;
+    }
+
+    static void WriteHighscore(IStream& stream, const scenario_highscore_entry& highscore)
+    {
+        stream.WriteString(highscore.fileName);
+        stream.WriteString(highscore.name);
+        stream.WriteValue(highscore.company_value);
+        stream.WriteValue(highscore.timestamp);
+    }
+
+    /**
+     * Records a changed highscore by appending it to the highscores file, rewriting the whole file only once enough
+     * changes have been appended. An interrupted write can then at worst lose the new highscore.
+     */
+    void SaveHighscore(const scenario_highscore_entry& highscore)
+    {
+        std::string path = _env->GetFilePath(PATHID::SCORES);
+        if (!_canAppendHighscores || _highscoreJournalEntries >= MaxHighscoreJournalEntries || !File::Exists(path))
+        {
+            SaveHighscores();
+            return;
+        }
+
+        try
+        {
+            auto fs = FileStream(path, FILE_MODE_APPEND);
+            WriteHighscore(fs, highscore);
+            _highscoreJournalEntries++;
+        }
+        catch (const std::exception&)
+        {
+            Console::Error::WriteLine("Unable to save highscores to '%s'", path.c_str());
+        }
+        _highscoresLastModified = GetHighscoresLastModified();
+    }
+
     void SaveHighscores()
     {
         std::string path = _env->GetFilePath(PATHID::SCORES);
@@ -742,17 +833,16 @@ private:
             fs.WriteValue<uint32_t>(static_cast<uint32_t>(_highscores.size()));
             for (size_t i = 0; i < _highscores.size(); i++)
             {
-                const scenario_highscore_entry* highscore = _highscores[i];
-                fs.WriteString(highscore->fileName);
-                fs.WriteString(highscore->name);
-                fs.WriteValue(highscore->company_value);
-                fs.WriteValue(highscore->timestamp);
+                WriteHighscore(fs, *_highscores[i]);
             }
+            _highscoreJournalEntries = 0;
+            _canAppendHighscores = true;
         }
         catch (const std::exception&)
         {
             Console::Error::WriteLine("Unable to save highscores to '%s'", path.c_str());
         }
+        _highscoresLastModified = GetHighscoresLastModified();
     }
 };
 
@@ -254,6 +254,11 @@ namespace OpenRCT2::Scripting
 
     std::string ProcessString(const DukValue& value);
 
+    /**
+     * Creates a Duktape heap whose allocations are counted as scripting memory, nullptr if it could not be created.
+     */
+    duk_context* CreateAccountedHeap();
+
     template<typename T> DukValue ToDuk(duk_context* ctx, const T& value) = delete;
     template<typename T> T FromDuk(const DukValue& s) = delete;
 
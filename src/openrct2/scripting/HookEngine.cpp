@@ -39,6 +39,12 @@ HOOK_TYPE OpenRCT2::Scripting::GetHookType(const std::string& name)
     return (result != HooksLookupTable.end()) ? result->second : HOOK_TYPE::UNDEFINED;
 }
 
+std::string_view OpenRCT2::Scripting::GetHookName(HOOK_TYPE type)
+{
+    auto result = HooksLookupTable.find(type);
+    return (result != HooksLookupTable.end()) ? result->first : std::string_view();
+}
+
 HookEngine::HookEngine(ScriptEngine& scriptEngine)
     : _scriptEngine(scriptEngine)
 {
@@ -93,60 +99,78 @@ void HookEngine::UnsubscribeAll()
 bool HookEngine::HasSubscriptions(HOOK_TYPE type) const
 {
     auto& hookList = GetHookList(type);
-    return !hookList.Hooks.empty();
+    return !hookList.Hooks.empty() || _scriptEngine.IsWorkerSubscribed(type);
 }
 
 void HookEngine::Call(HOOK_TYPE type, bool isGameStateMutable)
 {
+    _scriptEngine.PostWorkerEvent(type);
+
     auto& hookList = GetHookList(type);
+    if (hookList.Hooks.empty())
+        return;
+
+    ScriptEngine::PerformanceCategoryScope category(_scriptEngine, GetHookName(type));
+    const std::vector<DukValue> dukArgs;
     for (auto& hook : hookList.Hooks)
     {
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, {}, isGameStateMutable);
+        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, dukArgs, isGameStateMutable);
     }
 }
 
 void HookEngine::Call(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutable)
 {
+    _scriptEngine.PostWorkerEvent(type, arg);
+
     auto& hookList = GetHookList(type);
+    if (hookList.Hooks.empty())
+        return;
+
+    // The same event object is passed to every subscriber so later hooks see changes made by earlier ones
+    ScriptEngine::PerformanceCategoryScope category(_scriptEngine, GetHookName(type));
+    const std::vector<DukValue> dukArgs{ arg };
     for (auto& hook : hookList.Hooks)
     {
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, { arg }, isGameStateMutable);
+        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, dukArgs, isGameStateMutable);
     }
 }
 
 void HookEngine::Call(
     HOOK_TYPE type, const std::initializer_list<std::pair<std::string_view, std::any>>& args, bool isGameStateMutable)
 {
-    auto& hookList = GetHookList(type);
-    for (auto& hook : hookList.Hooks)
-    {
-        auto ctx = _scriptEngine.GetContext();
+    if (!HasSubscriptions(type))
+        return;
 
-        // Convert key/value pairs into an object
-        auto objIdx = duk_push_object(ctx);
-        for (const auto& arg : args)
+    auto dukArgs = CreateEventArgs(args);
+    Call(type, dukArgs, isGameStateMutable);
+}
+
+DukValue HookEngine::CreateEventArgs(const std::initializer_list<std::pair<std::string_view, std::any>>& args)
+{
+    auto ctx = _scriptEngine.GetContext();
+
+    // Convert key/value pairs into an object
+    auto objIdx = duk_push_object(ctx);
+    for (const auto& arg : args)
+    {
+        if (arg.second.type() == typeid(int32_t))
         {
-            if (arg.second.type() == typeid(int32_t))
-            {
-                auto val = std::any_cast<int32_t>(arg.second);
-                duk_push_int(ctx, val);
-            }
-            else if (arg.second.type() == typeid(std::string))
-            {
-                const auto& val = std::any_cast<std::string>(arg.second);
-                duk_push_string(ctx, val.c_str());
-            }
-            else
-            {
-                throw std::runtime_error("Not implemented");
-            }
-            duk_put_prop_string(ctx, objIdx, arg.first.data());
+            auto val = std::any_cast<int32_t>(arg.second);
+            duk_push_int(ctx, val);
         }
-
-        std::vector<DukValue> dukArgs;
-        dukArgs.push_back(DukValue::take_from_stack(ctx));
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, dukArgs, isGameStateMutable);
+        else if (arg.second.type() == typeid(std::string))
+        {
+            const auto& val = std::any_cast<const std::string&>(arg.second);
+            duk_push_string(ctx, val.c_str());
+        }
+        else
+        {
+            duk_pop(ctx);
+            throw std::runtime_error("Not implemented");
+        }
+        duk_put_prop_string(ctx, objIdx, arg.first.data());
     }
+    return DukValue::take_from_stack(ctx);
 }
 
 HookList& HookEngine::GetHookList(HOOK_TYPE type)
@@ -11,18 +11,33 @@
 
 #    include "Plugin.h"
 
+#    include "../Context.h"
 #    include "../Diagnostic.h"
 #    include "../OpenRCT2.h"
+#    include "../PlatformEnvironment.h"
+#    include "../Version.h"
 #    include "../core/File.h"
+#    include "../core/FileScanner.h"
+#    include "../core/Path.hpp"
+#    include "../core/String.hpp"
+#    include "../platform/platform.h"
 #    include "Duktape.hpp"
 #    include "ScriptEngine.h"
 
 #    include <algorithm>
+#    include <cinttypes>
+#    include <cstring>
+#    include <functional>
 #    include <fstream>
 #    include <memory>
+#    include <vector>
 
+using namespace OpenRCT2;
 using namespace OpenRCT2::Scripting;
 
+static constexpr uint32_t PluginBytecodeMagic = 0x43425250; // PRBC
+static constexpr size_t PluginBytecodeCacheMaxEntries = 64;
+
 Plugin::Plugin(duk_context* context, const std::string& path)
     : _context(context)
     , _path(path)
@@ -63,8 +78,24 @@ void Plugin::Load()
         "     })(" + projectedVariables + ");";
     // clang-format on
 
-    auto flags = DUK_COMPILE_EVAL | DUK_COMPILE_SAFE | DUK_COMPILE_NOSOURCE | DUK_COMPILE_NOFILENAME;
-    auto result = duk_eval_raw(_context, code.c_str(), code.size(), flags);
+    // Compiling large plug-ins takes a long time, so the compiled code is kept for the next time the same code is loaded
+    auto cachePath = GetBytecodeCachePath(code);
+    if (!TryLoadBytecode(_context, cachePath, code))
+    {
+        auto flags = DUK_COMPILE_EVAL | DUK_COMPILE_SAFE | DUK_COMPILE_NOSOURCE | DUK_COMPILE_NOFILENAME;
+        auto result = duk_compile_raw(_context, code.c_str(), code.size(), flags);
+        if (result != DUK_ERR_NONE)
+        {
+            auto val = std::string(duk_safe_to_string(_context, -1));
+            duk_pop(_context);
+            throw std::runtime_error("Failed to load plug-in script: " + val);
+        }
+        SaveBytecode(_context, cachePath, code);
+    }
+
+    // Call the compiled code like duk_eval would, with the global object as this
+    duk_push_global_object(_context);
+    auto result = duk_pcall_method(_context, 0);
     if (result != DUK_ERR_NONE)
     {
         auto val = std::string(duk_safe_to_string(_context, -1));
@@ -106,6 +137,130 @@ void Plugin::LoadCodeFromFile()
     _code = File::ReadAllText(_path);
 }
 
+std::string Plugin::GetBytecodeCachePath(std::string_view code)
+{
+    auto context = GetContext();
+    if (context == nullptr)
+        return {};
+
+    auto name = String::StdFormat("%016" PRIx64 ".bc", static_cast<uint64_t>(std::hash<std::string_view>()(code)));
+    auto env = context->GetPlatformEnvironment();
+    return Path::Combine(env->GetDirectoryPath(DIRBASE::CACHE, DIRID::CACHE_PLUGIN), name);
+}
+
+/**
+ * Bytecode is only valid for the Duktape build that produced it, so the header records the build next to the length of
+ * the code it was compiled from.
+ */
+PluginBytecodeHeader Plugin::GetBytecodeHeader(std::string_view code, size_t bytecodeLength)
+{
+    PluginBytecodeHeader header{};
+    header.Magic = PluginBytecodeMagic;
+    header.DuktapeVersion = static_cast<uint32_t>(DUK_VERSION);
+    header.BuildHash = static_cast<uint64_t>(std::hash<std::string_view>()(gVersionInfoFull));
+    header.CodeLength = static_cast<uint64_t>(code.size());
+    header.Length = static_cast<uint64_t>(bytecodeLength);
+    return header;
+}
+
+/**
+ * Pushes the compiled function stored in the given cache file. Duktape does not validate bytecode it loads, so only
+ * complete files written by SaveBytecode are accepted.
+ */
+bool Plugin::TryLoadBytecode(duk_context* ctx, const std::string& path, std::string_view code)
+{
+#    ifdef DUK_USE_BYTECODE_DUMP_SUPPORT
+    if (path.empty() || !File::Exists(path))
+        return false;
+
+    std::vector<uint8_t> data;
+    try
+    {
+        data = File::ReadAllBytes(path);
+    }
+    catch (const std::exception& e)
+    {
+        log_warning("Unable to read compiled plug-in '%s': %s", path.c_str(), e.what());
+        return false;
+    }
+
+    PluginBytecodeHeader header{};
+    if (data.size() <= sizeof(header))
+        return false;
+    std::memcpy(&header, data.data(), sizeof(header));
+    auto expectedHeader = GetBytecodeHeader(code, data.size() - sizeof(header));
+    if (std::memcmp(&header, &expectedHeader, sizeof(header)) != 0)
+        return false;
+
+    auto* buffer = duk_push_fixed_buffer(ctx, header.Length);
+    std::memcpy(buffer, data.data() + sizeof(header), header.Length);
+    duk_load_function(ctx);
+    return true;
+#    else
+    return false;
+#    endif
+}
+
+/**
+ * Writes the compiled function on top of the stack to the given cache file, leaving the stack as it was.
+ */
+void Plugin::SaveBytecode(duk_context* ctx, const std::string& path, std::string_view code)
+{
+#    ifdef DUK_USE_BYTECODE_DUMP_SUPPORT
+    if (path.empty())
+        return;
+
+    duk_dup_top(ctx);
+    duk_dump_function(ctx);
+    duk_size_t size{};
+    auto* bytecode = static_cast<const uint8_t*>(duk_get_buffer(ctx, -1, &size));
+
+    auto header = GetBytecodeHeader(code, size);
+    std::vector<uint8_t> data(sizeof(header) + size);
+    std::memcpy(data.data(), &header, sizeof(header));
+    std::memcpy(data.data() + sizeof(header), bytecode, size);
+    duk_pop(ctx);
+
+    auto directory = Path::GetDirectory(path);
+    if (!platform_ensure_directory_exists(directory.c_str()))
+    {
+        log_warning("Unable to create directory '%s'.", directory.c_str());
+        return;
+    }
+
+    try
+    {
+        File::WriteAllBytes(path, data.data(), data.size());
+    }
+    catch (const std::exception& e)
+    {
+        log_warning("Unable to write compiled plug-in '%s': %s", path.c_str(), e.what());
+        return;
+    }
+    RemoveOldBytecode(directory);
+#    endif
+}
+
+// Every change to a plug-in adds a new file, so only the most recently written ones are kept.
+void Plugin::RemoveOldBytecode(const std::string& directory)
+{
+    std::vector<std::pair<uint64_t, std::string>> files;
+    auto scanner = Path::ScanDirectory(Path::Combine(directory, "*.bc"), false);
+    while (scanner->Next())
+    {
+        files.emplace_back(scanner->GetFileInfo()->LastModified, scanner->GetPath());
+    }
+
+    if (files.size() <= PluginBytecodeCacheMaxEntries)
+        return;
+
+    std::sort(files.begin(), files.end());
+    for (size_t i = 0; i < files.size() - PluginBytecodeCacheMaxEntries; i++)
+    {
+        File::Delete(files[i].second);
+    }
+}
+
 static std::string TryGetString(const DukValue& value, const std::string& message)
 {
     if (value.type() != DukValue::Type::STRING)
@@ -160,6 +315,8 @@ PluginType Plugin::ParsePluginType(std::string_view type)
         return PluginType::Local;
     if (type == "remote")
         return PluginType::Remote;
+    if (type == "worker")
+        return PluginType::Worker;
     throw std::invalid_argument("Unknown plugin type.");
 }
 
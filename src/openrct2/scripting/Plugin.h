@@ -33,6 +33,12 @@ namespace OpenRCT2::Scripting
          * modify game state in certain contexts.
          */
         Remote,
+
+        /**
+         * Scripts that run in their own context on a separate thread. They have no access to the game state and only
+         * receive copies of the events they subscribe to, so they can not slow down the game.
+         */
+        Worker,
     };
 
     struct PluginMetadata
@@ -46,6 +52,15 @@ namespace OpenRCT2::Scripting
         DukValue Main;
     };
 
+    struct PluginBytecodeHeader
+    {
+        uint32_t Magic;
+        uint32_t DuktapeVersion;
+        uint64_t BuildHash;
+        uint64_t CodeLength;
+        uint64_t Length;
+    };
+
     class Plugin
     {
     private:
@@ -96,6 +111,12 @@ namespace OpenRCT2::Scripting
     private:
         void LoadCodeFromFile();
 
+        static std::string GetBytecodeCachePath(std::string_view code);
+        static PluginBytecodeHeader GetBytecodeHeader(std::string_view code, size_t bytecodeLength);
+        static bool TryLoadBytecode(duk_context* ctx, const std::string& path, std::string_view code);
+        static void SaveBytecode(duk_context* ctx, const std::string& path, std::string_view code);
+        static void RemoveOldBytecode(const std::string& directory);
+
         static PluginMetadata GetMetadata(const DukValue& dukMetadata);
         static PluginType ParsePluginType(std::string_view type);
         static void CheckForLicence(const DukValue& dukLicence, std::string_view pluginName);
@@ -11,6 +11,8 @@
 
 #ifdef ENABLE_SCRIPTING
 
+#    include "../MemoryReport.h"
+#    include "../actions/CustomAction.h"
 #    include "../actions/GameAction.h"
 #    include "../interface/Screenshot.h"
 #    include "../localisation/Formatting.h"
@@ -24,6 +26,7 @@
 #    include "ScriptEngine.h"
 
 #    include <cstdio>
+#    include <limits>
 #    include <memory>
 
 namespace OpenRCT2::Scripting
@@ -240,6 +243,16 @@ namespace OpenRCT2::Scripting
             QueryOrExecuteAction(action, args, callback, true);
         }
 
+        void queryActions(const DukValue& actions, const DukValue& callback)
+        {
+            QueryOrExecuteActions(actions, callback, false);
+        }
+
+        void executeActions(const DukValue& actions, const DukValue& callback)
+        {
+            QueryOrExecuteActions(actions, callback, true);
+        }
+
         void QueryOrExecuteAction(const std::string& actionid, const DukValue& args, const DukValue& callback, bool isExecute)
         {
             auto& scriptEngine = GetContext()->GetScriptEngine();
@@ -249,20 +262,7 @@ namespace OpenRCT2::Scripting
                 auto action = scriptEngine.CreateGameAction(actionid, args);
                 if (action != nullptr)
                 {
-                    auto plugin = scriptEngine.GetExecInfo().GetCurrentPlugin();
-                    if (isExecute)
-                    {
-                        action->SetCallback(
-                            [this, plugin, callback](const GameAction*, const GameActions::Result* res) -> void {
-                                HandleGameActionResult(plugin, *res, callback);
-                            });
-                        GameActions::Execute(action.get());
-                    }
-                    else
-                    {
-                        auto res = GameActions::Query(action.get());
-                        HandleGameActionResult(plugin, *res, callback);
-                    }
+                    QueryOrExecuteGameAction(*action, callback, isExecute);
                 }
                 else
                 {
@@ -275,6 +275,54 @@ namespace OpenRCT2::Scripting
             }
         }
 
+        void QueryOrExecuteActions(const DukValue& actions, const DukValue& callback, bool isExecute)
+        {
+            auto& scriptEngine = GetContext()->GetScriptEngine();
+            auto ctx = scriptEngine.GetContext();
+            if (!actions.is_array())
+            {
+                duk_error(ctx, DUK_ERR_ERROR, "actions was not an array.");
+            }
+            try
+            {
+                auto action = scriptEngine.CreateBatchGameAction(actions);
+                if (action == nullptr)
+                {
+                    duk_error(ctx, DUK_ERR_ERROR, "Unknown or disallowed action in batch.");
+                }
+                else if (static_cast<const CustomAction&>(*action).GetJson().size() > std::numeric_limits<uint16_t>::max())
+                {
+                    duk_error(ctx, DUK_ERR_ERROR, "Too many actions in one batch.");
+                }
+                else
+                {
+                    QueryOrExecuteGameAction(*action, callback, isExecute);
+                }
+            }
+            catch (DukException&)
+            {
+                duk_error(ctx, DUK_ERR_ERROR, "Invalid action parameters.");
+            }
+        }
+
+        void QueryOrExecuteGameAction(GameAction& action, const DukValue& callback, bool isExecute)
+        {
+            auto& scriptEngine = GetContext()->GetScriptEngine();
+            auto plugin = scriptEngine.GetExecInfo().GetCurrentPlugin();
+            if (isExecute)
+            {
+                action.SetCallback([this, plugin, callback](const GameAction*, const GameActions::Result* res) -> void {
+                    HandleGameActionResult(plugin, *res, callback);
+                });
+                GameActions::Execute(&action);
+            }
+            else
+            {
+                auto res = GameActions::Query(&action);
+                HandleGameActionResult(plugin, *res, callback);
+            }
+        }
+
         void HandleGameActionResult(
             const std::shared_ptr<Plugin>& plugin, const GameActions::Result& res, const DukValue& callback)
         {
@@ -375,6 +423,48 @@ namespace OpenRCT2::Scripting
             ClearIntervalOrTimeout(handle);
         }
 
+        std::vector<DukValue> getPerformanceStats()
+        {
+            auto& scriptEngine = GetContext()->GetScriptEngine();
+            auto ctx = scriptEngine.GetContext();
+            std::vector<DukValue> result;
+            for (const auto& counter : scriptEngine.GetPerformanceStats())
+            {
+                DukObject obj(ctx);
+                obj.Set("plugin", counter.Plugin);
+                obj.Set("category", counter.Category);
+                obj.Set("calls", counter.Calls);
+                obj.Set("overBudgetCalls", counter.OverBudgetCalls);
+                obj.Set(
+                    "totalTime",
+                    static_cast<int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(counter.TotalTime).count()));
+                obj.Set(
+                    "maxTime",
+                    static_cast<int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(counter.MaxTime).count()));
+                result.push_back(obj.Take());
+            }
+            return result;
+        }
+
+        void resetPerformanceStats()
+        {
+            GetContext()->GetScriptEngine().ResetPerformanceStats();
+        }
+
+        std::vector<DukValue> getMemoryUsage()
+        {
+            auto ctx = GetContext()->GetScriptEngine().GetContext();
+            std::vector<DukValue> result;
+            for (const auto& entry : GetMemoryReport())
+            {
+                DukObject obj(ctx);
+                obj.Set("category", MemoryAccounting::GetCategoryName(entry.Category));
+                obj.Set("bytes", static_cast<uint64_t>(entry.Bytes));
+                result.push_back(obj.Take());
+            }
+            return result;
+        }
+
     public:
         static void Register(duk_context* ctx)
         {
@@ -389,11 +479,16 @@ namespace OpenRCT2::Scripting
             dukglue_register_method(ctx, &ScContext::subscribe, "subscribe");
             dukglue_register_method(ctx, &ScContext::queryAction, "queryAction");
             dukglue_register_method(ctx, &ScContext::executeAction, "executeAction");
+            dukglue_register_method(ctx, &ScContext::queryActions, "queryActions");
+            dukglue_register_method(ctx, &ScContext::executeActions, "executeActions");
             dukglue_register_method(ctx, &ScContext::registerAction, "registerAction");
             dukglue_register_method(ctx, &ScContext::setInterval, "setInterval");
             dukglue_register_method(ctx, &ScContext::setTimeout, "setTimeout");
             dukglue_register_method(ctx, &ScContext::clearInterval, "clearInterval");
             dukglue_register_method(ctx, &ScContext::clearTimeout, "clearTimeout");
+            dukglue_register_method(ctx, &ScContext::getPerformanceStats, "getPerformanceStats");
+            dukglue_register_method(ctx, &ScContext::resetPerformanceStats, "resetPerformanceStats");
+            dukglue_register_method(ctx, &ScContext::getMemoryUsage, "getMemoryUsage");
         }
     };
 } // namespace OpenRCT2::Scripting
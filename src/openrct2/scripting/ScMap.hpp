@@ -27,6 +27,9 @@
 #    include "ScRide.hpp"
 #    include "ScTile.hpp"
 
+#    include <cstring>
+#    include <vector>
+
 namespace OpenRCT2::Scripting
 {
     class ScMap
@@ -167,6 +170,143 @@ namespace OpenRCT2::Scripting
             return result;
         }
 
+        /**
+         * Returns the surface and footpath data of a rectangular range of tiles as typed arrays so plugins do not need
+         * to create a tile and element object for every tile. The arrays are row major, starting at the given tile.
+         */
+        DukValue getTileData(int32_t x, int32_t y, int32_t width, int32_t height) const
+        {
+            if (x < 0 || y < 0 || width <= 0 || height <= 0 || x + width > gMapSize || y + height > gMapSize)
+            {
+                duk_error(_context, DUK_ERR_RANGE_ERROR, "Tile range is outside the map.");
+            }
+
+            auto numTiles = static_cast<size_t>(width) * height;
+            std::vector<uint8_t> surfaceHeights(numTiles);
+            std::vector<uint16_t> waterHeights(numTiles);
+            std::vector<uint8_t> surfaceStyles(numTiles);
+            std::vector<uint8_t> edgeStyles(numTiles);
+            std::vector<uint8_t> ownership(numTiles);
+            std::vector<uint8_t> footpathFlags(numTiles);
+
+            size_t index = 0;
+            for (int32_t tileY = y; tileY < y + height; tileY++)
+            {
+                for (int32_t tileX = x; tileX < x + width; tileX++, index++)
+                {
+                    auto element = map_get_first_element_at(TileCoordsXY(tileX, tileY).ToCoordsXY());
+                    if (element == nullptr)
+                        continue;
+
+                    do
+                    {
+                        auto surfaceElement = element->AsSurface();
+                        if (surfaceElement != nullptr)
+                        {
+                            surfaceHeights[index] = surfaceElement->base_height;
+                            waterHeights[index] = static_cast<uint16_t>(surfaceElement->GetWaterHeight());
+                            surfaceStyles[index] = static_cast<uint8_t>(surfaceElement->GetSurfaceStyle());
+                            edgeStyles[index] = static_cast<uint8_t>(surfaceElement->GetEdgeStyle());
+                            ownership[index] = surfaceElement->GetOwnership();
+                        }
+
+                        auto pathElement = element->AsPath();
+                        if (pathElement != nullptr)
+                        {
+                            footpathFlags[index] |= TILE_DATA_FOOTPATH;
+                            if (pathElement->IsQueue())
+                                footpathFlags[index] |= TILE_DATA_FOOTPATH_QUEUE;
+                            if (pathElement->IsSloped())
+                                footpathFlags[index] |= TILE_DATA_FOOTPATH_SLOPED;
+                        }
+                    } while (!(element++)->IsLastForTile());
+                }
+            }
+
+            DukObject obj(_context);
+            obj.Set("x", x);
+            obj.Set("y", y);
+            obj.Set("width", width);
+            obj.Set("height", height);
+            obj.Set("surfaceHeight", ToTypedArray(surfaceHeights, DUK_BUFOBJ_UINT8ARRAY));
+            obj.Set("waterHeight", ToTypedArray(waterHeights, DUK_BUFOBJ_UINT16ARRAY));
+            obj.Set("surfaceStyle", ToTypedArray(surfaceStyles, DUK_BUFOBJ_UINT8ARRAY));
+            obj.Set("edgeStyle", ToTypedArray(edgeStyles, DUK_BUFOBJ_UINT8ARRAY));
+            obj.Set("ownership", ToTypedArray(ownership, DUK_BUFOBJ_UINT8ARRAY));
+            obj.Set("footpathFlags", ToTypedArray(footpathFlags, DUK_BUFOBJ_UINT8ARRAY));
+            return obj.Take();
+        }
+
+        /**
+         * Returns the id and position of all entities of the given type as typed arrays, the equivalent of
+         * getAllEntities without creating an object for every entity.
+         */
+        DukValue getEntityData(const std::string& type) const
+        {
+            std::vector<uint16_t> ids;
+            std::vector<int16_t> xs;
+            std::vector<int16_t> ys;
+            std::vector<int16_t> zs;
+            auto addEntity = [&](const SpriteBase* entity) {
+                ids.push_back(entity->sprite_index);
+                xs.push_back(entity->x);
+                ys.push_back(entity->y);
+                zs.push_back(entity->z);
+            };
+
+            if (type == "balloon")
+            {
+                for (auto sprite : EntityList<Balloon>())
+                    addEntity(sprite);
+            }
+            else if (type == "car")
+            {
+                for (auto trainHead : TrainManager::View())
+                {
+                    for (auto carId = trainHead->sprite_index; carId != SPRITE_INDEX_NULL;)
+                    {
+                        auto car = GetEntity<Vehicle>(carId);
+                        addEntity(car);
+                        carId = car->next_vehicle_on_train;
+                    }
+                }
+            }
+            else if (type == "litter")
+            {
+                for (auto sprite : EntityList<Litter>())
+                    addEntity(sprite);
+            }
+            else if (type == "duck")
+            {
+                for (auto sprite : EntityList<Duck>())
+                    addEntity(sprite);
+            }
+            else if (type == "peep" || type == "guest" || type == "staff")
+            {
+                if (type != "staff")
+                {
+                    for (auto sprite : EntityList<Guest>())
+                        addEntity(sprite);
+                }
+                if (type != "guest")
+                {
+                    for (auto sprite : EntityList<Staff>())
+                        addEntity(sprite);
+                }
+            }
+            else
+            {
+                duk_error(_context, DUK_ERR_ERROR, "Invalid entity type.");
+            }
+
+            DukObject obj(_context);
+            obj.Set("id", ToTypedArray(ids, DUK_BUFOBJ_UINT16ARRAY));
+            obj.Set("x", ToTypedArray(xs, DUK_BUFOBJ_INT16ARRAY));
+            obj.Set("y", ToTypedArray(ys, DUK_BUFOBJ_INT16ARRAY));
+            obj.Set("z", ToTypedArray(zs, DUK_BUFOBJ_INT16ARRAY));
+            return obj.Take();
+        }
+
         template<typename TEntityType, typename TScriptType> DukValue createEntityType(const DukValue& initializer)
         {
             TEntityType* entity = CreateEntity<TEntityType>();
@@ -250,10 +390,29 @@ namespace OpenRCT2::Scripting
             dukglue_register_method(ctx, &ScMap::getTile, "getTile");
             dukglue_register_method(ctx, &ScMap::getEntity, "getEntity");
             dukglue_register_method(ctx, &ScMap::getAllEntities, "getAllEntities");
+            dukglue_register_method(ctx, &ScMap::getTileData, "getTileData");
+            dukglue_register_method(ctx, &ScMap::getEntityData, "getEntityData");
             dukglue_register_method(ctx, &ScMap::createEntity, "createEntity");
         }
 
     private:
+        static constexpr uint8_t TILE_DATA_FOOTPATH = 1 << 0;
+        static constexpr uint8_t TILE_DATA_FOOTPATH_QUEUE = 1 << 1;
+        static constexpr uint8_t TILE_DATA_FOOTPATH_SLOPED = 1 << 2;
+
+        template<typename T> DukValue ToTypedArray(const std::vector<T>& values, duk_uint_t arrayType) const
+        {
+            auto dataLen = values.size() * sizeof(T);
+            auto data = duk_push_fixed_buffer(_context, dataLen);
+            if (dataLen != 0)
+            {
+                std::memcpy(data, values.data(), dataLen);
+            }
+            duk_push_buffer_object(_context, -1, 0, dataLen, arrayType);
+            duk_remove(_context, -2);
+            return DukValue::take_from_stack(_context);
+        }
+
         DukValue GetEntityAsDukValue(const SpriteBase* sprite) const
         {
             auto spriteId = sprite->sprite_index;
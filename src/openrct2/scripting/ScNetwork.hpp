@@ -16,6 +16,7 @@
 #    include "../actions/PlayerKickAction.h"
 #    include "../actions/PlayerSetGroupAction.h"
 #    include "../network/NetworkAction.h"
+#    include "../network/NetworkPacket.h"
 #    include "../network/network.h"
 #    include "Duktape.hpp"
 #    include "ScSocket.hpp"
@@ -396,6 +397,43 @@ namespace OpenRCT2::Scripting
                 }
                 obj.Set("bytesSent", DukValue::take_from_stack(_context));
             }
+            {
+                auto commands = OpenRCT2::Scripting::DukObject(_context);
+                for (size_t i = 0; i < std::size(networkStats.commands); i++)
+                {
+                    auto name = GetNetworkCommandName(static_cast<NetworkCommand>(i));
+                    if (name == nullptr)
+                        continue;
+
+                    const auto& commandStats = networkStats.commands[i];
+                    auto command = OpenRCT2::Scripting::DukObject(_context);
+                    command.Set("bytesReceived", commandStats.bytesReceived);
+                    command.Set("bytesSent", commandStats.bytesSent);
+                    command.Set("packetsReceived", commandStats.packetsReceived);
+                    command.Set("packetsSent", commandStats.packetsSent);
+                    commands.Set(name, command.Take());
+                }
+                obj.Set("commands", commands.Take());
+            }
+            {
+                auto queueStats = GameActions::GetQueueStats();
+                auto actionQueue = OpenRCT2::Scripting::DukObject(_context);
+                actionQueue.Set("depth", static_cast<uint32_t>(queueStats.Depth));
+                actionQueue.Set("processed", queueStats.Processed);
+                actionQueue.Set("totalWaitTime", queueStats.TotalWaitTime);
+                actionQueue.Set("maxWaitTime", queueStats.MaxWaitTime);
+
+                duk_push_array(_context);
+                duk_uarridx_t index = 0;
+                for (auto v : queueStats.WaitHistogram)
+                {
+                    duk_push_number(_context, static_cast<duk_double_t>(v));
+                    duk_put_prop_index(_context, -2, index);
+                    index++;
+                }
+                actionQueue.Set("waitHistogram", DukValue::take_from_stack(_context));
+                obj.Set("actionQueue", actionQueue.Take());
+            }
             return obj.Take();
 #    else
             return ToDuk(_context, nullptr);
@@ -11,6 +11,9 @@
 
 #    include "ScriptEngine.h"
 
+#    include "../Context.h"
+#    include "../Game.h"
+#    include "../GameState.h"
 #    include "../PlatformEnvironment.h"
 #    include "../actions/CustomAction.h"
 #    include "../actions/GameAction.h"
@@ -20,9 +23,16 @@
 #    include "../core/EnumMap.hpp"
 #    include "../core/File.h"
 #    include "../core/FileScanner.h"
+#    include "../core/Json.hpp"
+#    include "../core/MemoryAccounting.h"
 #    include "../core/Path.hpp"
 #    include "../interface/InteractiveConsole.h"
+#    include "../management/Finance.h"
+#    include "../network/network.h"
+#    include "../peep/Peep.h"
 #    include "../platform/Platform2.h"
+#    include "../world/Map.h"
+#    include "../world/Park.h"
 #    include "Duktape.hpp"
 #    include "ScCheats.hpp"
 #    include "ScClimate.hpp"
@@ -40,7 +50,11 @@
 #    include "ScSocket.hpp"
 #    include "ScTile.hpp"
 
+#    include <algorithm>
+#    include <cstddef>
+#    include <cstdlib>
 #    include <iostream>
+#    include <optional>
 #    include <stdexcept>
 
 using namespace OpenRCT2;
@@ -354,9 +368,67 @@ public:
     }
 };
 
+// Every allocation of an accounted heap is prefixed with its size, so that frees and reallocations can be counted.
+static constexpr size_t DukAllocationHeaderSize = alignof(std::max_align_t);
+static_assert(DukAllocationHeaderSize >= sizeof(size_t));
+
+static void* DukAccountedAlloc(void* udata, duk_size_t size)
+{
+    auto* block = static_cast<uint8_t*>(std::malloc(DukAllocationHeaderSize + size));
+    if (block == nullptr)
+    {
+        return nullptr;
+    }
+    *reinterpret_cast<size_t*>(block) = size;
+    MemoryAccounting::Add(MemoryAccounting::Category::Scripting, size);
+    return block + DukAllocationHeaderSize;
+}
+
+static void DukAccountedFree(void* udata, void* ptr)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+    auto* block = static_cast<uint8_t*>(ptr) - DukAllocationHeaderSize;
+    MemoryAccounting::Remove(MemoryAccounting::Category::Scripting, *reinterpret_cast<size_t*>(block));
+    std::free(block);
+}
+
+static void* DukAccountedRealloc(void* udata, void* ptr, duk_size_t size)
+{
+    if (ptr == nullptr)
+    {
+        return DukAccountedAlloc(udata, size);
+    }
+    if (size == 0)
+    {
+        DukAccountedFree(udata, ptr);
+        return nullptr;
+    }
+
+    auto* block = static_cast<uint8_t*>(ptr) - DukAllocationHeaderSize;
+    auto oldSize = *reinterpret_cast<size_t*>(block);
+    auto* newBlock = static_cast<uint8_t*>(std::realloc(block, DukAllocationHeaderSize + size));
+    if (newBlock == nullptr)
+    {
+        // The old allocation is left untouched
+        return nullptr;
+    }
+    *reinterpret_cast<size_t*>(newBlock) = size;
+    MemoryAccounting::Remove(MemoryAccounting::Category::Scripting, oldSize);
+    MemoryAccounting::Add(MemoryAccounting::Category::Scripting, size);
+    return newBlock + DukAllocationHeaderSize;
+}
+
+duk_context* OpenRCT2::Scripting::CreateAccountedHeap()
+{
+    return duk_create_heap(DukAccountedAlloc, DukAccountedRealloc, DukAccountedFree, nullptr, nullptr);
+}
+
 DukContext::DukContext()
 {
-    _context = duk_create_heap_default();
+    _context = CreateAccountedHeap();
     if (_context == nullptr)
     {
         throw std::runtime_error("Unable to initialise duktape context.");
@@ -548,6 +620,10 @@ void ScriptEngine::AutoReloadPlugins()
         std::lock_guard<std::mutex> guard(_changedPluginFilesMutex);
         for (auto& path : _changedPluginFiles)
         {
+            // Deleting or renaming a plugin also raises a change, but there is nothing to reload from
+            if (!File::Exists(path))
+                continue;
+
             auto findResult = std::find_if(_plugins.begin(), _plugins.end(), [&path](const std::shared_ptr<Plugin>& plugin) {
                 return Path::Equals(path, plugin->GetPath());
             });
@@ -558,10 +634,12 @@ void ScriptEngine::AutoReloadPlugins()
                 {
                     StopPlugin(plugin);
 
+                    StopWorker(plugin);
+
                     ScriptExecutionInfo::PluginScope scope(_execInfo, plugin, false);
                     plugin->Load();
                     LogPluginInfo(plugin, "Reloaded");
-                    plugin->Start();
+                    StartPlugin(plugin);
                 }
                 catch (const std::exception& e)
                 {
@@ -597,7 +675,7 @@ void ScriptEngine::StartPlugins()
             try
             {
                 LogPluginInfo(plugin, "Started");
-                plugin->Start();
+                StartPlugin(plugin);
             }
             catch (const std::exception& e)
             {
@@ -608,6 +686,27 @@ void ScriptEngine::StartPlugins()
     _pluginsStarted = true;
 }
 
+void ScriptEngine::StartPlugin(std::shared_ptr<Plugin> plugin)
+{
+    const auto& metadata = plugin->GetMetadata();
+    if (metadata.Type == PluginType::Worker)
+    {
+        StopWorker(plugin);
+        _workers.push_back(std::make_unique<ScriptWorker>(metadata.Name, plugin->GetCode()));
+    }
+    else
+    {
+        plugin->Start();
+    }
+}
+
+void ScriptEngine::StopWorker(const std::shared_ptr<Plugin>& plugin)
+{
+    const auto& name = plugin->GetMetadata().Name;
+    auto isPluginWorker = [&name](const std::unique_ptr<ScriptWorker>& worker) { return worker->GetName() == name; };
+    _workers.erase(std::remove_if(_workers.begin(), _workers.end(), isPluginWorker), _workers.end());
+}
+
 bool ScriptEngine::ShouldStartPlugin(const std::shared_ptr<Plugin>& plugin)
 {
     auto networkMode = network_get_mode();
@@ -634,6 +733,8 @@ void ScriptEngine::StopPlugins()
             LogPluginInfo(plugin, "Stopped");
         }
     }
+    UpdateWorkers();
+    _workers.clear();
     _pluginsStarted = false;
 }
 
@@ -663,6 +764,7 @@ void ScriptEngine::Update()
 
     UpdateIntervals();
     UpdateSockets();
+    UpdateWorkers();
     ProcessREPL();
 }
 
@@ -720,7 +822,9 @@ DukValue ScriptEngine::ExecutePluginCall(
         {
             arg.push();
         }
+        auto startTime = std::chrono::steady_clock::now();
         auto result = duk_pcall_method(_context, static_cast<duk_idx_t>(args.size()));
+        RecordPluginCall(plugin, std::chrono::steady_clock::now() - startTime);
         if (result == DUK_EXEC_SUCCESS)
         {
             return DukValue::take_from_stack(_context);
@@ -748,6 +852,150 @@ void ScriptEngine::LogPluginInfo(const std::shared_ptr<Plugin>& plugin, std::str
     }
 }
 
+void ScriptEngine::UpdateWorkers()
+{
+    for (auto& worker : _workers)
+    {
+        for (const auto& line : worker->TakeLog())
+        {
+            auto message = "[" + worker->GetName() + "] " + line.Message;
+            if (line.IsError)
+            {
+                _console.WriteLineError(message);
+            }
+            else
+            {
+                _console.WriteLine(message);
+            }
+        }
+    }
+}
+
+bool ScriptEngine::IsWorkerSubscribed(HOOK_TYPE type) const
+{
+    return std::any_of(_workers.begin(), _workers.end(), [type](const std::unique_ptr<ScriptWorker>& worker) {
+        return worker->IsSubscribed(type);
+    });
+}
+
+void ScriptEngine::PostWorkerEvent(HOOK_TYPE type, const DukValue& arg)
+{
+    if (!IsWorkerSubscribed(type))
+        return;
+
+    // Workers run in their own heaps, so the event is passed as JSON. Encode it in a safe call as the event can contain
+    // values that can not be encoded, such as cyclic references.
+    DukStackFrame frame(_context);
+    arg.push();
+    auto encode = [](duk_context* ctx, void*) -> duk_ret_t {
+        duk_json_encode(ctx, -1);
+        return 1;
+    };
+    if (duk_safe_call(_context, encode, nullptr, 1, 1) != DUK_EXEC_SUCCESS)
+    {
+        duk_pop(_context);
+        return;
+    }
+    std::string json = duk_get_string(_context, -1);
+    duk_pop(_context);
+
+    for (auto& worker : _workers)
+    {
+        if (worker->IsSubscribed(type))
+        {
+            worker->PostEvent(type, std::string(json));
+        }
+    }
+}
+
+void ScriptEngine::PostWorkerEvent(HOOK_TYPE type)
+{
+    if (!IsWorkerSubscribed(type))
+        return;
+
+    const auto& date = GetContext()->GetGameState()->GetDate();
+    json_t snapshot = {
+        { "date",
+          {
+              { "year", date.GetYear() },
+              { "month", date.GetMonth() },
+              { "day", date.GetDay() },
+              { "monthsElapsed", date.GetMonthsElapsed() },
+              { "ticksElapsed", gCurrentTicks },
+          } },
+        { "park",
+          {
+              { "rating", gParkRating },
+              { "guests", gNumGuestsInPark },
+              { "cash", gCash },
+              { "companyValue", gCompanyValue },
+          } },
+    };
+    auto json = snapshot.dump();
+
+    for (auto& worker : _workers)
+    {
+        if (worker->IsSubscribed(type))
+        {
+            worker->PostEvent(type, std::string(json));
+        }
+    }
+}
+
+void ScriptEngine::RecordPluginCall(const std::shared_ptr<Plugin>& plugin, std::chrono::nanoseconds time)
+{
+    if (plugin == nullptr)
+        return;
+
+    const auto& pluginName = plugin->GetMetadata().Name;
+    auto key = std::make_pair(pluginName, std::string(_performanceCategory));
+    auto it = _performanceCounters.find(key);
+    if (it == _performanceCounters.end())
+    {
+        it = _performanceCounters.emplace(key, PluginPerformanceCounter{ key.first, key.second }).first;
+    }
+
+    auto& counter = it->second;
+    counter.Calls++;
+    counter.TotalTime += time;
+    counter.MaxTime = std::max(counter.MaxTime, time);
+
+    // Duktape is built without its execution timeout check, so a call running over the budget can not be interrupted.
+    // Report the first call that goes over the budget so the offending plugin can be found.
+    auto budget = std::chrono::milliseconds(gConfigPlugin.call_time_budget);
+    if (budget.count() > 0 && time > budget)
+    {
+        if (counter.OverBudgetCalls == 0)
+        {
+            auto timeMs = std::chrono::duration_cast<std::chrono::milliseconds>(time).count();
+            LogPluginInfo(
+                plugin,
+                "Call to " + counter.Category + " took " + std::to_string(timeMs) + " ms, the budget is "
+                    + std::to_string(budget.count()) + " ms.");
+        }
+        counter.OverBudgetCalls++;
+    }
+}
+
+std::vector<PluginPerformanceCounter> ScriptEngine::GetPerformanceStats() const
+{
+    std::vector<PluginPerformanceCounter> result;
+    result.reserve(_performanceCounters.size());
+    for (const auto& kvp : _performanceCounters)
+    {
+        result.push_back(kvp.second);
+    }
+    std::sort(result.begin(), result.end(), [](const PluginPerformanceCounter& a, const PluginPerformanceCounter& b) {
+        return a.TotalTime > b.TotalTime;
+    });
+    return result;
+}
+
+void ScriptEngine::ResetPerformanceStats()
+{
+    _performanceCounters.clear();
+}
+
 void ScriptEngine::AddNetworkPlugin(std::string_view code)
 {
     auto plugin = std::make_shared<Plugin>(_context, std::string());
@@ -756,16 +1004,21 @@ void ScriptEngine::AddNetworkPlugin(std::string_view code)
 }
 
 std::unique_ptr<GameActions::Result> ScriptEngine::QueryOrExecuteCustomGameAction(
-    std::string_view id, std::string_view args, bool isExecute)
+    const CustomAction& action, bool isExecute)
 {
-    std::string actionz = std::string(id);
+    std::string actionz = action.GetId();
+    if (actionz == BATCH_ACTION_ID)
+    {
+        return QueryOrExecuteBatchGameAction(action, isExecute);
+    }
+
     auto kvp = _customActions.find(actionz);
     if (kvp != _customActions.end())
     {
         const auto& customAction = kvp->second;
 
         // Deserialise the JSON args
-        std::string argsz(args);
+        std::string argsz = action.GetJson();
 
         auto dukArgs = DuktapeTryParseJson(_context, argsz);
         if (!dukArgs)
@@ -777,6 +1030,7 @@ std::unique_ptr<GameActions::Result> ScriptEngine::QueryOrExecuteCustomGameActio
         }
 
         // Ready to call plugin handler
+        PerformanceCategoryScope category(*this, isExecute ? "action.custom.execute" : "action.custom.query");
         DukValue dukResult;
         if (!isExecute)
         {
@@ -797,6 +1051,105 @@ std::unique_ptr<GameActions::Result> ScriptEngine::QueryOrExecuteCustomGameActio
     }
 }
 
+// Actions of a batch are nested, so the server checks the permissions a top level action would have been checked for.
+static bool CanPlayerPerformBatchedAction(NetworkPlayerId_t playerId, GameCommand command)
+{
+    if (command == GameCommand::TogglePause || command == GameCommand::LoadOrQuit || command == GameCommand::Custom)
+        return false;
+    if (network_get_mode() != NETWORK_MODE_SERVER)
+        return true;
+
+    auto playerIndex = network_get_player_index(playerId.id);
+    if (playerIndex == -1)
+        return false;
+    auto groupIndex = network_get_group_index(network_get_player_group(playerIndex));
+    if (groupIndex == -1)
+        return false;
+    if (!network_can_perform_command(groupIndex, EnumValue(command)))
+        return false;
+    if (command == GameCommand::ScatterSmallScenery)
+        return network_can_perform_command(groupIndex, EnumValue(GameCommand::PlaceScenery));
+    return true;
+}
+
+/**
+ * Runs the built-in game actions of a batch as nested actions of the batch. The whole batch is validated up front, so
+ * a query fails with the first action that fails. Execute applies the actions in order in one pass, skipping any that
+ * fail because of an earlier action of the batch, and reports the first failure only when nothing was applied.
+ */
+std::unique_ptr<GameActions::Result> ScriptEngine::QueryOrExecuteBatchGameAction(
+    const CustomAction& batchAction, bool isExecute)
+{
+    auto makeError = [](GameActions::Status status, std::string title) {
+        auto result = std::make_unique<GameActions::Result>();
+        result->Error = status;
+        result->ErrorTitle = std::move(title);
+        return result;
+    };
+
+    auto dukActions = DuktapeTryParseJson(_context, batchAction.GetJson());
+    if (!dukActions || !dukActions->is_array())
+    {
+        return makeError(GameActions::Status::InvalidParameters, "Invalid JSON");
+    }
+
+    std::vector<std::unique_ptr<GameAction>> actions;
+    try
+    {
+        for (const auto& dukAction : dukActions->as_array())
+        {
+            auto actionId = AsOrDefault<std::string>(dukAction["action"]);
+            auto action = CreateGameAction(actionId, dukAction["args"]);
+            if (action == nullptr || !CanPlayerPerformBatchedAction(batchAction.GetPlayer(), action->GetType()))
+            {
+                return makeError(GameActions::Status::Disallowed, "Action not allowed in batch");
+            }
+            action->SetFlags(action->GetFlags() | batchAction.GetFlags());
+            action->SetPlayer(batchAction.GetPlayer());
+            actions.push_back(std::move(action));
+        }
+    }
+    catch (const DukException&)
+    {
+        return makeError(GameActions::Status::InvalidParameters, "Invalid action parameters");
+    }
+
+    auto result = std::make_unique<GameActions::Result>();
+    std::unique_ptr<GameActions::Result> firstFailure;
+    bool anyApplied = false;
+    bool hasExpenditure = false;
+    std::optional<MapInvalidationBatch> invalidationBatch;
+    if (isExecute)
+        invalidationBatch.emplace();
+    for (const auto& action : actions)
+    {
+        auto actionResult = isExecute ? GameActions::ExecuteNested(action.get()) : GameActions::QueryNested(action.get());
+        if (actionResult->Error != GameActions::Status::Ok)
+        {
+            if (!isExecute)
+                return actionResult;
+            if (firstFailure == nullptr)
+                firstFailure = std::move(actionResult);
+            continue;
+        }
+
+        anyApplied = true;
+        result->Cost += actionResult->Cost;
+        result->Position = actionResult->Position;
+        if (!hasExpenditure && actionResult->Cost != 0)
+        {
+            result->Expenditure = actionResult->Expenditure;
+            hasExpenditure = true;
+        }
+    }
+
+    if (!anyApplied && firstFailure != nullptr)
+    {
+        return firstFailure;
+    }
+    return result;
+}
+
 std::unique_ptr<GameActions::Result> ScriptEngine::DukToGameActionResult(const DukValue& d)
 {
     auto result = std::make_unique<GameActions::Result>();
@@ -902,7 +1255,7 @@ bool ScriptEngine::RegisterCustomAction(
     const std::shared_ptr<Plugin>& plugin, std::string_view action, const DukValue& query, const DukValue& execute)
 {
     std::string actionz = std::string(action);
-    if (_customActions.find(actionz) != _customActions.end())
+    if (actionz == BATCH_ACTION_ID || _customActions.find(actionz) != _customActions.end())
     {
         return false;
     }
@@ -1049,6 +1402,7 @@ const static EnumMap<GameCommand> ActionNameToType = {
     { "signsetstyle", GameCommand::SetSignStyle },
     { "smallsceneryplace", GameCommand::PlaceScenery },
     { "smallsceneryremove", GameCommand::RemoveScenery },
+    { "smallsceneryscatter", GameCommand::ScatterSmallScenery },
     { "stafffire", GameCommand::FireStaffMember },
     { "staffhire", GameCommand::HireNewStaffMember },
     { "staffsetcolour", GameCommand::SetStaffColour },
@@ -1193,6 +1547,31 @@ std::unique_ptr<GameAction> ScriptEngine::CreateGameAction(const std::string& ac
     }
 }
 
+std::unique_ptr<GameAction> ScriptEngine::CreateBatchGameAction(const DukValue& actions)
+{
+    // Validate every action of the batch before anything is sent
+    for (const auto& dukAction : actions.as_array())
+    {
+        if (dukAction.type() != DukValue::Type::OBJECT || dukAction["action"].type() != DukValue::Type::STRING)
+        {
+            return nullptr;
+        }
+        auto action = CreateGameAction(dukAction["action"].as_string(), dukAction["args"]);
+        if (action == nullptr
+            || !CanPlayerPerformBatchedAction(NetworkPlayerId_t{ network_get_current_player_id() }, action->GetType()))
+        {
+            return nullptr;
+        }
+    }
+
+    auto ctx = actions.context();
+    actions.push();
+    auto jsonz = duk_json_encode(ctx, -1);
+    auto json = std::string(jsonz);
+    duk_pop(ctx);
+    return std::make_unique<CustomAction>(std::string(BATCH_ACTION_ID), json);
+}
+
 void ScriptEngine::InitSharedStorage()
 {
     duk_push_object(_context);
@@ -1300,6 +1679,7 @@ void ScriptEngine::UpdateIntervals()
     }
     _lastIntervalTimestamp = timestamp;
 
+    PerformanceCategoryScope category(*this, "interval");
     for (auto& interval : _intervals)
     {
         if (interval.IsValid())
@@ -17,13 +17,17 @@
 #    include "../world/Location.hpp"
 #    include "HookEngine.h"
 #    include "Plugin.h"
+#    include "ScriptWorker.h"
 
+#    include <chrono>
 #    include <future>
 #    include <list>
+#    include <map>
 #    include <memory>
 #    include <mutex>
 #    include <queue>
 #    include <string>
+#    include <string_view>
 #    include <unordered_map>
 #    include <unordered_set>
 #    include <vector>
@@ -31,6 +35,7 @@
 struct duk_hthread;
 typedef struct duk_hthread duk_context;
 
+struct CustomAction;
 struct GameAction;
 namespace GameActions
 {
@@ -46,11 +51,14 @@ namespace OpenRCT2
 
 namespace OpenRCT2::Scripting
 {
-    static constexpr int32_t OPENRCT2_PLUGIN_API_VERSION = 36;
+    static constexpr int32_t OPENRCT2_PLUGIN_API_VERSION = 40;
 
     // Versions marking breaking changes.
     static constexpr int32_t API_VERSION_33_PEEP_DEPRECATION = 33;
 
+    // Custom action that carries a list of built-in game actions, run by the script engine itself.
+    static constexpr std::string_view BATCH_ACTION_ID = "openrct2.batch";
+
 #    ifndef DISABLE_NETWORK
     class ScSocketBase;
 #    endif
@@ -138,8 +146,45 @@ namespace OpenRCT2::Scripting
         }
     };
 
+    /**
+     * Time spent in the callbacks of a plugin for one category, such as a hook or intervals.
+     */
+    struct PluginPerformanceCounter
+    {
+        std::string Plugin;
+        std::string Category;
+        uint64_t Calls{};
+        uint64_t OverBudgetCalls{};
+        std::chrono::nanoseconds TotalTime{};
+        std::chrono::nanoseconds MaxTime{};
+    };
+
     class ScriptEngine
     {
+    public:
+        /**
+         * Sets the category calls into plugins are counted under while the scope is alive.
+         */
+        class PerformanceCategoryScope
+        {
+        private:
+            ScriptEngine& _scriptEngine;
+            std::string_view _backupCategory;
+
+        public:
+            PerformanceCategoryScope(ScriptEngine& scriptEngine, std::string_view category)
+                : _scriptEngine(scriptEngine)
+                , _backupCategory(scriptEngine._performanceCategory)
+            {
+                _scriptEngine._performanceCategory = category;
+            }
+            PerformanceCategoryScope(const PerformanceCategoryScope&) = delete;
+            ~PerformanceCategoryScope()
+            {
+                _scriptEngine._performanceCategory = _backupCategory;
+            }
+        };
+
     private:
         InteractiveConsole& _console;
         IPlatformEnvironment& _env;
@@ -171,6 +216,11 @@ namespace OpenRCT2::Scripting
         };
 
         std::unordered_map<std::string, CustomActionInfo> _customActions;
+
+        std::vector<std::unique_ptr<ScriptWorker>> _workers;
+
+        std::string_view _performanceCategory = "callback";
+        std::map<std::pair<std::string, std::string>, PluginPerformanceCounter> _performanceCounters;
 #    ifndef DISABLE_NETWORK
         std::list<std::shared_ptr<ScSocketBase>> _sockets;
 #    endif
@@ -213,6 +263,24 @@ namespace OpenRCT2::Scripting
 
         void LogPluginInfo(const std::shared_ptr<Plugin>& plugin, std::string_view message);
 
+        /**
+         * @returns true if a worker plugin subscribed to the hook.
+         */
+        bool IsWorkerSubscribed(HOOK_TYPE type) const;
+
+        /**
+         * Sends a copy of the event to the worker plugins subscribed to the hook. Hooks without arguments send a
+         * snapshot of the park instead.
+         */
+        void PostWorkerEvent(HOOK_TYPE type, const DukValue& arg);
+        void PostWorkerEvent(HOOK_TYPE type);
+
+        /**
+         * @returns the performance counters of all plugins, the most expensive first.
+         */
+        std::vector<PluginPerformanceCounter> GetPerformanceStats() const;
+        void ResetPerformanceStats();
+
         void SubscribeToPluginStoppedEvent(std::function<void(std::shared_ptr<Plugin>)> callback)
         {
             _pluginStoppedSubscriptions.push_back(callback);
@@ -221,11 +289,12 @@ namespace OpenRCT2::Scripting
         void AddNetworkPlugin(std::string_view code);
 
         std::unique_ptr<GameActions::Result> QueryOrExecuteCustomGameAction(
-            std::string_view id, std::string_view args, bool isExecute);
+            const CustomAction& customAction, bool isExecute);
         bool RegisterCustomAction(
             const std::shared_ptr<Plugin>& plugin, std::string_view action, const DukValue& query, const DukValue& execute);
         void RunGameActionHooks(const GameAction& action, std::unique_ptr<GameActions::Result>& result, bool isExecute);
         std::unique_ptr<GameAction> CreateGameAction(const std::string& actionid, const DukValue& args);
+        std::unique_ptr<GameAction> CreateBatchGameAction(const DukValue& actions);
 
         void SaveSharedStorage();
 
@@ -243,17 +312,23 @@ namespace OpenRCT2::Scripting
         void LoadPlugin(const std::string& path);
         void LoadPlugin(std::shared_ptr<Plugin>& plugin);
         void StopPlugin(std::shared_ptr<Plugin> plugin);
+        void StartPlugin(std::shared_ptr<Plugin> plugin);
+        void StopWorker(const std::shared_ptr<Plugin>& plugin);
+        void UpdateWorkers();
         bool ShouldLoadScript(const std::string& path);
         bool ShouldStartPlugin(const std::shared_ptr<Plugin>& plugin);
         void SetupHotReloading();
         void AutoReloadPlugins();
         void ProcessREPL();
         void RemoveCustomGameActions(const std::shared_ptr<Plugin>& plugin);
+        std::unique_ptr<GameActions::Result> QueryOrExecuteBatchGameAction(const CustomAction& batchAction, bool isExecute);
         std::unique_ptr<GameActions::Result> DukToGameActionResult(const DukValue& d);
         DukValue GameActionResultToDuk(const GameAction& action, const std::unique_ptr<GameActions::Result>& result);
         static std::string_view ExpenditureTypeToString(ExpenditureType expenditureType);
         static ExpenditureType StringToExpenditureType(std::string_view expenditureType);
 
+        void RecordPluginCall(const std::shared_ptr<Plugin>& plugin, std::chrono::nanoseconds time);
+
         void InitSharedStorage();
         void LoadSharedStorage();
 
@@ -0,0 +1,278 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef ENABLE_SCRIPTING
+
+#    include "ScriptWorker.h"
+
+#    include "Duktape.hpp"
+
+using namespace OpenRCT2::Scripting;
+
+static constexpr const char* StashWorker = "worker";
+static constexpr const char* StashSubscriptions = "subscriptions";
+
+static ScriptWorker* GetWorker(duk_context* ctx)
+{
+    duk_push_heap_stash(ctx);
+    duk_get_prop_string(ctx, -1, StashWorker);
+    auto worker = static_cast<ScriptWorker*>(duk_get_pointer(ctx, -1));
+    duk_pop_2(ctx);
+    return worker;
+}
+
+static std::string JoinArguments(duk_context* ctx)
+{
+    std::string result;
+    auto numArgs = duk_get_top(ctx);
+    for (duk_idx_t i = 0; i < numArgs; i++)
+    {
+        if (i != 0)
+        {
+            result.push_back(' ');
+        }
+        result += duk_safe_to_string(ctx, i);
+    }
+    return result;
+}
+
+static duk_ret_t WorkerConsoleLog(duk_context* ctx)
+{
+    GetWorker(ctx)->AddLogLine(false, JoinArguments(ctx));
+    return 0;
+}
+
+static duk_ret_t WorkerConsoleError(duk_context* ctx)
+{
+    GetWorker(ctx)->AddLogLine(true, JoinArguments(ctx));
+    return 0;
+}
+
+static duk_ret_t WorkerSubscribe(duk_context* ctx)
+{
+    std::string hookName = duk_require_string(ctx, 0);
+    duk_require_function(ctx, 1);
+
+    auto hookType = GetHookType(hookName);
+    if (hookType == HOOK_TYPE::UNDEFINED)
+    {
+        duk_error(ctx, DUK_ERR_ERROR, "Unknown hook type");
+    }
+
+    // Callbacks are kept in the heap stash as subscriptions[hookType] = [callbacks...]
+    auto hookIndex = static_cast<duk_uarridx_t>(hookType);
+    duk_push_heap_stash(ctx);
+    duk_get_prop_string(ctx, -1, StashSubscriptions);
+    auto subscriptionsIdx = duk_get_top_index(ctx);
+    if (!duk_get_prop_index(ctx, subscriptionsIdx, hookIndex))
+    {
+        duk_pop(ctx);
+        duk_push_array(ctx);
+        duk_dup_top(ctx);
+        duk_put_prop_index(ctx, subscriptionsIdx, hookIndex);
+    }
+    auto callbacksIdx = duk_get_top_index(ctx);
+    duk_dup(ctx, 1);
+    duk_put_prop_index(ctx, callbacksIdx, static_cast<duk_uarridx_t>(duk_get_length(ctx, callbacksIdx)));
+    duk_pop_3(ctx);
+
+    GetWorker(ctx)->AddSubscription(hookType);
+    return 0;
+}
+
+static void RegisterWorkerApi(duk_context* ctx, ScriptWorker* worker)
+{
+    duk_push_heap_stash(ctx);
+    duk_push_pointer(ctx, worker);
+    duk_put_prop_string(ctx, -2, StashWorker);
+    duk_push_array(ctx);
+    duk_put_prop_string(ctx, -2, StashSubscriptions);
+    duk_pop(ctx);
+
+    duk_push_object(ctx);
+    duk_push_c_function(ctx, WorkerConsoleLog, DUK_VARARGS);
+    duk_put_prop_string(ctx, -2, "log");
+    duk_push_c_function(ctx, WorkerConsoleError, DUK_VARARGS);
+    duk_put_prop_string(ctx, -2, "error");
+    duk_put_global_string(ctx, "console");
+
+    duk_push_object(ctx);
+    duk_push_c_function(ctx, WorkerSubscribe, 2);
+    duk_put_prop_string(ctx, -2, "subscribe");
+    duk_put_global_string(ctx, "worker");
+}
+
+/**
+ * Evaluates the plugin code and calls its main function, the same way Plugin::Load and Plugin::Start do for plugins
+ * on the game thread.
+ */
+static bool StartWorkerPlugin(duk_context* ctx, ScriptWorker& worker, const std::string& pluginCode)
+{
+    // clang-format off
+    auto code =
+        "     (function(console,worker) {"
+        "         var __metadata__ = null;"
+        "         var registerPlugin = function(m) { __metadata__ = m };"
+        "         (function(__metadata__) {"
+                      + pluginCode +
+        "         })();"
+        "         return __metadata__;"
+        "     })(console,worker);";
+    // clang-format on
+
+    auto flags = DUK_COMPILE_EVAL | DUK_COMPILE_SAFE | DUK_COMPILE_NOSOURCE | DUK_COMPILE_NOFILENAME;
+    if (duk_eval_raw(ctx, code.c_str(), code.size(), flags) != DUK_ERR_NONE)
+    {
+        worker.AddLogLine(true, std::string("Failed to load plug-in script: ") + duk_safe_to_string(ctx, -1));
+        duk_pop(ctx);
+        return false;
+    }
+
+    if (!duk_is_object(ctx, -1))
+    {
+        worker.AddLogLine(true, "No plugin registered.");
+        duk_pop(ctx);
+        return false;
+    }
+    duk_get_prop_string(ctx, -1, "main");
+    if (!duk_is_function(ctx, -1))
+    {
+        worker.AddLogLine(true, "No main function specified.");
+        duk_pop_2(ctx);
+        return false;
+    }
+
+    auto result = duk_pcall(ctx, 0);
+    if (result != DUK_EXEC_SUCCESS)
+    {
+        worker.AddLogLine(true, duk_safe_to_string(ctx, -1));
+    }
+    duk_pop_2(ctx);
+    return result == DUK_EXEC_SUCCESS;
+}
+
+static void DispatchWorkerEvent(duk_context* ctx, ScriptWorker& worker, HOOK_TYPE type, const std::string& json)
+{
+    duk_push_heap_stash(ctx);
+    duk_get_prop_string(ctx, -1, StashSubscriptions);
+    duk_get_prop_index(ctx, -1, static_cast<duk_uarridx_t>(type));
+    if (duk_is_array(ctx, -1))
+    {
+        auto numCallbacks = static_cast<duk_uarridx_t>(duk_get_length(ctx, -1));
+        for (duk_uarridx_t i = 0; i < numCallbacks; i++)
+        {
+            // Decode the event for every callback so a callback modifying it does not affect the next one
+            duk_get_prop_index(ctx, -1, i);
+            duk_push_lstring(ctx, json.data(), json.size());
+            duk_json_decode(ctx, -1);
+            if (duk_pcall(ctx, 1) != DUK_EXEC_SUCCESS)
+            {
+                worker.AddLogLine(true, duk_safe_to_string(ctx, -1));
+            }
+            duk_pop(ctx);
+        }
+    }
+    duk_pop_3(ctx);
+}
+
+ScriptWorker::ScriptWorker(const std::string& name, const std::string& code)
+    : _name(name)
+    , _code(code)
+{
+    _thread = std::thread(&ScriptWorker::Run, this);
+}
+
+ScriptWorker::~ScriptWorker()
+{
+    {
+        std::lock_guard<std::mutex> lock(_eventsMutex);
+        _shouldStop = true;
+    }
+    _eventsCondition.notify_one();
+    if (_thread.joinable())
+    {
+        _thread.join();
+    }
+}
+
+const std::string& ScriptWorker::GetName() const
+{
+    return _name;
+}
+
+bool ScriptWorker::IsSubscribed(HOOK_TYPE type) const
+{
+    return (_subscriptions & (1U << static_cast<uint32_t>(type))) != 0;
+}
+
+void ScriptWorker::PostEvent(HOOK_TYPE type, std::string&& json)
+{
+    {
+        std::lock_guard<std::mutex> lock(_eventsMutex);
+        if (_events.size() >= MaxPendingEvents)
+        {
+            _events.pop_front();
+        }
+        _events.push_back({ type, std::move(json) });
+    }
+    _eventsCondition.notify_one();
+}
+
+std::vector<ScriptWorkerLogLine> ScriptWorker::TakeLog()
+{
+    std::lock_guard<std::mutex> lock(_logMutex);
+    auto result = std::move(_log);
+    _log.clear();
+    return result;
+}
+
+void ScriptWorker::AddSubscription(HOOK_TYPE type)
+{
+    _subscriptions |= 1U << static_cast<uint32_t>(type);
+}
+
+void ScriptWorker::AddLogLine(bool isError, std::string&& message)
+{
+    std::lock_guard<std::mutex> lock(_logMutex);
+    _log.push_back({ isError, std::move(message) });
+}
+
+void ScriptWorker::Run()
+{
+    auto ctx = CreateAccountedHeap();
+    if (ctx == nullptr)
+    {
+        AddLogLine(true, "Unable to initialise duktape context.");
+        return;
+    }
+
+    RegisterWorkerApi(ctx, this);
+    if (StartWorkerPlugin(ctx, *this, _code))
+    {
+        while (true)
+        {
+            WorkerEvent workerEvent;
+            {
+                std::unique_lock<std::mutex> lock(_eventsMutex);
+                _eventsCondition.wait(lock, [this]() { return _shouldStop || !_events.empty(); });
+                if (_shouldStop)
+                {
+                    break;
+                }
+                workerEvent = std::move(_events.front());
+                _events.pop_front();
+            }
+            DispatchWorkerEvent(ctx, *this, workerEvent.Type, workerEvent.Json);
+        }
+    }
+
+    duk_destroy_heap(ctx);
+}
+
+#endif
@@ -0,0 +1,91 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifdef ENABLE_SCRIPTING
+
+#    include "../common.h"
+#    include "HookEngine.h"
+
+#    include <atomic>
+#    include <condition_variable>
+#    include <deque>
+#    include <mutex>
+#    include <string>
+#    include <thread>
+#    include <vector>
+
+namespace OpenRCT2::Scripting
+{
+    struct ScriptWorkerLogLine
+    {
+        bool IsError{};
+        std::string Message;
+    };
+
+    /**
+     * Runs a worker plugin in its own Duktape heap on its own thread. Worker plugins have no access to the game state,
+     * they receive copies of the events they subscribed to as JSON through a queue, so they can never block the game
+     * thread. Only console and worker are available to them.
+     */
+    class ScriptWorker
+    {
+    private:
+        static constexpr size_t MaxPendingEvents = 1024;
+        static_assert(NUM_HOOK_TYPES <= 32, "Subscriptions are stored as a bit mask");
+
+        struct WorkerEvent
+        {
+            HOOK_TYPE Type{};
+            std::string Json;
+        };
+
+        std::string _name;
+        std::string _code;
+
+        std::mutex _eventsMutex;
+        std::condition_variable _eventsCondition;
+        std::deque<WorkerEvent> _events;
+        bool _shouldStop{};
+        std::atomic<uint32_t> _subscriptions{};
+
+        std::mutex _logMutex;
+        std::vector<ScriptWorkerLogLine> _log;
+
+        std::thread _thread;
+
+    public:
+        ScriptWorker(const std::string& name, const std::string& code);
+        ScriptWorker(const ScriptWorker&) = delete;
+        ~ScriptWorker();
+
+        const std::string& GetName() const;
+        bool IsSubscribed(HOOK_TYPE type) const;
+
+        /**
+         * Queues an event for the worker, the oldest event is dropped if the worker does not keep up.
+         */
+        void PostEvent(HOOK_TYPE type, std::string&& json);
+
+        /**
+         * @returns the lines logged by the worker since the last call, to be written to the console on the game thread.
+         */
+        std::vector<ScriptWorkerLogLine> TakeLog();
+
+        // Called on the worker thread by the script API
+        void AddSubscription(HOOK_TYPE type);
+        void AddLogLine(bool isError, std::string&& message);
+
+    private:
+        void Run();
+    };
+} // namespace OpenRCT2::Scripting
+
+#endif
@@ -83,6 +83,10 @@ namespace OpenRCT2::Ui
         void ProcessMessages() override
         {
         }
+        uint32_t TakeInputTimestamp() override
+        {
+            return 0;
+        }
         void TriggerResize() override
         {
         }
@@ -50,6 +50,9 @@ namespace OpenRCT2::Ui
         void HandleInput() override
         {
         }
+        void UpdateToolAtCursor() override
+        {
+        }
         void HandleKeyboard(bool /*isTitle*/) override
         {
         }
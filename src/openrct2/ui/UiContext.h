@@ -110,6 +110,12 @@ namespace OpenRCT2
             virtual bool IsMinimised() abstract;
             virtual bool IsSteamOverlayActive() abstract;
             virtual void ProcessMessages() abstract;
+
+            /**
+             * Returns when the oldest input event processed since the last call was made, in platform ticks, or 0 if
+             * there was none.
+             */
+            virtual uint32_t TakeInputTimestamp() abstract;
             virtual void TriggerResize() abstract;
 
             virtual void ShowMessageBox(const std::string& message) abstract;
@@ -16,10 +16,14 @@
 #include <algorithm>
 #include <cstring>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define SAWYERCODING_SSE2
+#    include <emmintrin.h>
+#endif
+
 static size_t decode_chunk_rle(const uint8_t* src_buffer, uint8_t* dst_buffer, size_t length);
 static size_t decode_chunk_rle_with_size(const uint8_t* src_buffer, uint8_t* dst_buffer, size_t length, size_t dstSize);
 
-static size_t encode_chunk_rle(const uint8_t* src_buffer, uint8_t* dst_buffer, size_t length);
 static size_t encode_chunk_repeat(const uint8_t* src_buffer, uint8_t* dst_buffer, size_t length);
 static void encode_chunk_rotate(uint8_t* buffer, size_t length);
 
@@ -61,7 +65,7 @@ size_t sawyercoding_write_chunk_buffer(uint8_t* dst_file, const uint8_t* buffer,
             break;
         case CHUNK_ENCODING_RLE:
             encode_buffer = static_cast<uint8_t*>(malloc(0x600000));
-            chunkHeader.length = static_cast<uint32_t>(encode_chunk_rle(buffer, encode_buffer, chunkHeader.length));
+            chunkHeader.length = static_cast<uint32_t>(sawyercoding_encode_rle(buffer, encode_buffer, chunkHeader.length));
             std::memcpy(dst_file, &chunkHeader, sizeof(sawyercoding_chunk_header));
             dst_file += sizeof(sawyercoding_chunk_header);
             std::memcpy(dst_file, encode_buffer, chunkHeader.length);
@@ -72,7 +76,8 @@ size_t sawyercoding_write_chunk_buffer(uint8_t* dst_file, const uint8_t* buffer,
             encode_buffer = static_cast<uint8_t*>(malloc(chunkHeader.length * 2));
             encode_buffer2 = static_cast<uint8_t*>(malloc(0x600000));
             chunkHeader.length = static_cast<uint32_t>(encode_chunk_repeat(buffer, encode_buffer, chunkHeader.length));
-            chunkHeader.length = static_cast<uint32_t>(encode_chunk_rle(encode_buffer, encode_buffer2, chunkHeader.length));
+            chunkHeader.length = static_cast<uint32_t>(
+                sawyercoding_encode_rle(encode_buffer, encode_buffer2, chunkHeader.length));
             std::memcpy(dst_file, &chunkHeader, sizeof(sawyercoding_chunk_header));
             dst_file += sizeof(sawyercoding_chunk_header);
             std::memcpy(dst_file, encode_buffer2, chunkHeader.length);
@@ -125,7 +130,7 @@ size_t sawyercoding_decode_sc4(const uint8_t* src, uint8_t* dst, size_t length,
 size_t sawyercoding_encode_sv4(const uint8_t* src, uint8_t* dst, size_t length)
 {
     // Encode
-    size_t encodedLength = encode_chunk_rle(src, dst, length);
+    size_t encodedLength = sawyercoding_encode_rle(src, dst, length);
 
     // Append checksum
     uint32_t checksum = sawyercoding_calculate_checksum(dst, encodedLength);
@@ -141,7 +146,7 @@ size_t sawyercoding_decode_td6(const uint8_t* src, uint8_t* dst, size_t length)
 
 size_t sawyercoding_encode_td6(const uint8_t* src, uint8_t* dst, size_t length)
 {
-    size_t output_length = encode_chunk_rle(src, dst, length);
+    size_t output_length = sawyercoding_encode_rle(src, dst, length);
 
     uint32_t checksum = 0;
     for (size_t i = 0; i < output_length; i++)
@@ -180,6 +185,132 @@ int32_t sawyercoding_validate_track_checksum(const uint8_t* src, size_t length)
         return 0;
 }
 
+#pragma region Scanning
+
+#ifdef SAWYERCODING_SSE2
+static __m128i load_16(const uint8_t* src)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+}
+
+/**
+ * Rotates every byte left by TShift bits, the 16-bit shifts move bits across bytes which the masks remove again.
+ */
+template<int TShift> static __m128i rotate_bytes_left(__m128i value)
+{
+    const __m128i leftMask = _mm_set1_epi8(static_cast<char>((0xFF << TShift) & 0xFF));
+    const __m128i rightMask = _mm_set1_epi8(static_cast<char>(0xFF >> (8 - TShift)));
+    const __m128i left = _mm_and_si128(_mm_slli_epi16(value, TShift), leftMask);
+    const __m128i right = _mm_and_si128(_mm_srli_epi16(value, 8 - TShift), rightMask);
+    return _mm_or_si128(left, right);
+}
+
+/**
+ * Rotates the bytes left by TShift0 to TShift3 bits, depending on their index modulo 4. Returns the number of bytes
+ * processed, which is a multiple of 16 so the pattern continues at the same phase for the remaining bytes.
+ */
+template<int TShift0, int TShift1, int TShift2, int TShift3>
+static size_t rotate_pattern_left(const uint8_t* src, uint8_t* dst, size_t length)
+{
+    const __m128i lane0 = _mm_set1_epi32(0x000000FF);
+    const __m128i lane1 = _mm_set1_epi32(0x0000FF00);
+    const __m128i lane2 = _mm_set1_epi32(0x00FF0000);
+    const __m128i lane3 = _mm_set1_epi32(static_cast<int32_t>(0xFF000000));
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16)
+    {
+        const __m128i value = load_16(src + i);
+        const __m128i result = _mm_or_si128(
+            _mm_or_si128(
+                _mm_and_si128(rotate_bytes_left<TShift0>(value), lane0),
+                _mm_and_si128(rotate_bytes_left<TShift1>(value), lane1)),
+            _mm_or_si128(
+                _mm_and_si128(rotate_bytes_left<TShift2>(value), lane2),
+                _mm_and_si128(rotate_bytes_left<TShift3>(value), lane3)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), result);
+    }
+    return i;
+}
+#endif
+
+/**
+ * Returns the first position from src on at which a byte is followed by the same byte, or end - 1 if there is none.
+ * src has to be before end - 1.
+ */
+static const uint8_t* find_repeated_byte(const uint8_t* src, const uint8_t* end)
+{
+#ifdef SAWYERCODING_SSE2
+    for (; end - src > 16; src += 16)
+    {
+        int32_t mask = _mm_movemask_epi8(_mm_cmpeq_epi8(load_16(src), load_16(src + 1)));
+        if (mask != 0)
+        {
+            return src + bitscanforward(mask);
+        }
+    }
+#endif
+    for (; src < end - 1; src++)
+    {
+        if (src[0] == src[1])
+        {
+            return src;
+        }
+    }
+    return end - 1;
+}
+
+/**
+ * Counts how many bytes from src on are equal to the byte at src, up to maxCount.
+ */
+static size_t count_run(const uint8_t* src, const uint8_t* end, size_t maxCount)
+{
+    const size_t limit = std::min(maxCount, static_cast<size_t>(end - src));
+    size_t count = 0;
+#ifdef SAWYERCODING_SSE2
+    const __m128i value = _mm_set1_epi8(static_cast<char>(*src));
+    for (; count + 16 <= limit; count += 16)
+    {
+        int32_t mask = ~_mm_movemask_epi8(_mm_cmpeq_epi8(load_16(src + count), value)) & 0xFFFF;
+        if (mask != 0)
+        {
+            return count + bitscanforward(mask);
+        }
+    }
+#endif
+    while (count < limit && src[count] == *src)
+    {
+        count++;
+    }
+    return count;
+}
+
+/**
+ * Returns a mask with bit n set if src[n] equals value, for the first length bytes of src. length is at most 32.
+ */
+static uint32_t find_byte_matches(const uint8_t* src, size_t length, uint8_t value)
+{
+#ifdef SAWYERCODING_SSE2
+    if (length == 32)
+    {
+        const __m128i values = _mm_set1_epi8(static_cast<char>(value));
+        const auto low = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(load_16(src), values)));
+        const auto high = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(load_16(src + 16), values)));
+        return low | (high << 16);
+    }
+#endif
+    uint32_t mask = 0;
+    for (size_t i = 0; i < length; i++)
+    {
+        if (src[i] == value)
+        {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+}
+
+#pragma endregion
+
 #pragma region Decoding
 
 /**
@@ -254,6 +385,21 @@ static size_t decode_chunk_rle_with_size(const uint8_t* src_buffer, uint8_t* dst
     return dst - dst_buffer;
 }
 
+void sawyercoding_decode_rotate(const uint8_t* src, uint8_t* dst, size_t length)
+{
+    size_t i = 0;
+#ifdef SAWYERCODING_SSE2
+    // Rotating right by 1, 3, 5 and 7 bits is rotating left by 7, 5, 3 and 1 bits
+    i = rotate_pattern_left<7, 5, 3, 1>(src, dst, length);
+#endif
+    uint8_t code = 1;
+    for (; i < length; i++)
+    {
+        dst[i] = ror8(src[i], code);
+        code = (code + 2) % 8;
+    }
+}
+
 #pragma endregion
 
 #pragma region Encoding
@@ -262,7 +408,7 @@ static size_t decode_chunk_rle_with_size(const uint8_t* src_buffer, uint8_t* dst
  * Ensure dst_buffer is bigger than src_buffer then resize afterwards
  * returns length of dst_buffer
  */
-static size_t encode_chunk_rle(const uint8_t* src_buffer, uint8_t* dst_buffer, size_t length)
+size_t sawyercoding_encode_rle(const uint8_t* src_buffer, uint8_t* dst_buffer, size_t length)
 {
     const uint8_t* src = src_buffer;
     uint8_t* dst = dst_buffer;
@@ -282,11 +428,7 @@ static size_t encode_chunk_rle(const uint8_t* src_buffer, uint8_t* dst_buffer, s
         }
         if (*src == src[1])
         {
-            for (; (count < 125) && ((src + count) < end_src); count++)
-            {
-                if (*src != src[count])
-                    break;
-            }
+            count = static_cast<uint8_t>(count_run(src, end_src, 125));
             *dst++ = 257 - count;
             *dst++ = *src;
             src += count;
@@ -295,8 +437,10 @@ static size_t encode_chunk_rle(const uint8_t* src_buffer, uint8_t* dst_buffer, s
         }
         else
         {
-            count++;
-            src++;
+            // Extend the literal up to the next repeated byte, as far as the current literal allows
+            auto literalLength = std::min<size_t>(find_repeated_byte(src, end_src) - src, 126 - count);
+            count += static_cast<uint8_t>(literalLength);
+            src += literalLength;
         }
     }
     if (src == end_src - 1)
@@ -330,8 +474,14 @@ static size_t encode_chunk_repeat(const uint8_t* src_buffer, uint8_t* dst_buffer
 
         size_t bestRepeatIndex = 0;
         size_t bestRepeatCount = 0;
-        for (size_t repeatIndex = searchIndex; repeatIndex <= searchEnd; repeatIndex++)
+
+        // Only positions starting with the same byte can repeat, check those in order
+        uint32_t candidates = find_byte_matches(src_buffer + searchIndex, searchEnd - searchIndex + 1, src_buffer[i]);
+        while (candidates != 0)
         {
+            size_t repeatIndex = searchIndex + bitscanforward(static_cast<int32_t>(candidates));
+            candidates &= candidates - 1;
+
             size_t repeatCount = 0;
             size_t maxRepeatCount = std::min(std::min(static_cast<size_t>(7), searchEnd - repeatIndex), length - i - 1);
             // maxRepeatCount should not exceed length
@@ -379,9 +529,12 @@ static size_t encode_chunk_repeat(const uint8_t* src_buffer, uint8_t* dst_buffer
 
 static void encode_chunk_rotate(uint8_t* buffer, size_t length)
 {
-    size_t i;
+    size_t i = 0;
+#ifdef SAWYERCODING_SSE2
+    i = rotate_pattern_left<1, 3, 5, 7>(buffer, buffer, length);
+#endif
     uint8_t code = 1;
-    for (i = 0; i < length; i++)
+    for (; i < length; i++)
     {
         buffer[i] = rol8(buffer[i], code);
         code = (code + 2) % 8;
@@ -11,6 +11,7 @@
 
 #include "../common.h"
 #include "../core/Guard.hpp"
+#include "../core/TaskScheduler.h"
 #include "../interface/Window.h"
 #include "../localisation/Localisation.h"
 #include "../platform/platform.h"
@@ -18,6 +19,7 @@
 #include "zlib.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <cmath>
 #include <ctime>
@@ -568,40 +570,57 @@ constexpr int32_t MAX_ZLIB_REALLOC = 4 * 1024 * 1024;
  */
 uint8_t* util_zlib_inflate(uint8_t* data, size_t data_in_size, size_t* data_out_size)
 {
-    int32_t ret = Z_OK;
-    uLongf out_size = static_cast<uLong>(*data_out_size);
+    size_t out_size = *data_out_size;
     if (out_size == 0)
     {
         // Try to guesstimate the size needed for output data by applying the
         // same ratio it would take to compress data_in_size.
-        out_size = static_cast<uLong>(data_in_size) * static_cast<uLong>(data_in_size)
-            / compressBound(static_cast<uLong>(data_in_size));
-        out_size = std::min(static_cast<uLongf>(MAX_ZLIB_REALLOC), out_size);
+        out_size = data_in_size * data_in_size / compressBound(static_cast<uLong>(data_in_size));
+        out_size = std::min(static_cast<size_t>(MAX_ZLIB_REALLOC), out_size);
     }
-    uLongf buffer_size = out_size;
+    out_size = std::max<size_t>(out_size, 1);
+
+    z_stream strm{};
+    if (inflateInit(&strm) != Z_OK)
+    {
+        log_error("Your build is shipped with broken zlib. Please use the official build.");
+        return nullptr;
+    }
+
+    // Inflate in a single pass, growing the output as needed rather than restarting with a bigger buffer.
+    size_t buffer_size = out_size;
     uint8_t* buffer = static_cast<uint8_t*>(malloc(buffer_size));
-    do
+    strm.next_in = data;
+    strm.avail_in = static_cast<uInt>(data_in_size);
+    int32_t ret = Z_OK;
+    while (ret != Z_STREAM_END)
     {
-        if (ret == Z_BUF_ERROR)
+        if (strm.total_out == buffer_size)
         {
             buffer_size *= 2;
-            out_size = buffer_size;
             buffer = static_cast<uint8_t*>(realloc(buffer, buffer_size));
         }
-        else if (ret == Z_STREAM_ERROR)
+        strm.next_out = buffer + strm.total_out;
+        strm.avail_out = static_cast<uInt>(buffer_size - strm.total_out);
+        ret = inflate(&strm, Z_NO_FLUSH);
+        if (ret == Z_STREAM_ERROR)
         {
             log_error("Your build is shipped with broken zlib. Please use the official build.");
-            free(buffer);
-            return nullptr;
         }
-        else if (ret < 0)
+        if (ret != Z_OK && ret != Z_STREAM_END && !(ret == Z_BUF_ERROR && strm.avail_out == 0))
         {
-            log_error("Error uncompressing data.");
+            if (ret != Z_STREAM_ERROR)
+            {
+                log_error("Error uncompressing data.");
+            }
+            inflateEnd(&strm);
             free(buffer);
             return nullptr;
         }
-        ret = uncompress(buffer, &out_size, data, static_cast<uLong>(data_in_size));
-    } while (ret != Z_OK);
+    }
+    out_size = strm.total_out;
+    inflateEnd(&strm);
+
     buffer = static_cast<uint8_t*>(realloc(buffer, out_size));
     *data_out_size = out_size;
     return buffer;
@@ -613,8 +632,96 @@ uint8_t* util_zlib_inflate(uint8_t* data, size_t data_in_size, size_t* data_out_
  * @param data_in_size Size of data to be compressed
  * @return Returns an optional std::vector of bytes, which is equal to std::nullopt when deflate has failed
  */
+static constexpr size_t ZLIB_PARALLEL_BLOCK_SIZE = 1024 * 1024;
+static constexpr size_t ZLIB_WINDOW_SIZE = 32 * 1024;
+
+/**
+ * Compresses one block of a parallel deflate as raw deflate data, primed with the end of the previous block so the
+ * compression ratio barely suffers. All but the last block end with a sync flush so the blocks can be concatenated.
+ */
+static bool util_zlib_deflate_block(const uint8_t* data, size_t offset, size_t length, bool last, std::vector<uint8_t>& out)
+{
+    z_stream strm{};
+    if (deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+    {
+        return false;
+    }
+    if (offset > 0)
+    {
+        size_t dictionarySize = std::min(offset, ZLIB_WINDOW_SIZE);
+        deflateSetDictionary(&strm, data + offset - dictionarySize, static_cast<uInt>(dictionarySize));
+    }
+
+    // Room for the sync flush marker on top of the bound.
+    out.resize(deflateBound(&strm, static_cast<uLong>(length)) + 16);
+    strm.next_in = const_cast<uint8_t*>(data + offset);
+    strm.avail_in = static_cast<uInt>(length);
+    strm.next_out = out.data();
+    strm.avail_out = static_cast<uInt>(out.size());
+    int32_t ret = deflate(&strm, last ? Z_FINISH : Z_SYNC_FLUSH);
+    bool success = last ? ret == Z_STREAM_END : (ret == Z_OK && strm.avail_in == 0);
+    out.resize(strm.total_out);
+    deflateEnd(&strm);
+    return success;
+}
+
+/**
+ * Deflates large inputs in blocks spread over the task scheduler. The result is a regular zlib stream which any
+ * inflate can read, only the block boundaries differ from a serial compression.
+ */
+static std::optional<std::vector<uint8_t>> util_zlib_deflate_parallel(const uint8_t* data, size_t data_in_size)
+{
+    const size_t blockCount = (data_in_size + ZLIB_PARALLEL_BLOCK_SIZE - 1) / ZLIB_PARALLEL_BLOCK_SIZE;
+    std::vector<std::vector<uint8_t>> blocks(blockCount);
+    std::vector<uLong> checksums(blockCount);
+    std::atomic<bool> failed{ false };
+    OpenRCT2::TaskScheduler::Get().ParallelFor(0, blockCount, 1, [&](size_t i) {
+        size_t offset = i * ZLIB_PARALLEL_BLOCK_SIZE;
+        size_t length = std::min(ZLIB_PARALLEL_BLOCK_SIZE, data_in_size - offset);
+        checksums[i] = adler32(adler32(0, nullptr, 0), data + offset, static_cast<uInt>(length));
+        if (!util_zlib_deflate_block(data, offset, length, i == blockCount - 1, blocks[i]))
+        {
+            failed = true;
+        }
+    });
+    if (failed)
+    {
+        log_error("Your build is shipped with broken zlib. Please use the official build.");
+        return std::nullopt;
+    }
+
+    uLong checksum = checksums[0];
+    size_t totalSize = 2 + 4 + blocks[0].size();
+    for (size_t i = 1; i < blockCount; i++)
+    {
+        size_t length = std::min(ZLIB_PARALLEL_BLOCK_SIZE, data_in_size - i * ZLIB_PARALLEL_BLOCK_SIZE);
+        checksum = adler32_combine(checksum, checksums[i], static_cast<z_off_t>(length));
+        totalSize += blocks[i].size();
+    }
+
+    // zlib header for deflate with a 32K window and default compression, the adler32 trailer is big endian.
+    std::vector<uint8_t> buffer;
+    buffer.reserve(totalSize);
+    buffer.push_back(0x78);
+    buffer.push_back(0x9C);
+    for (const auto& block : blocks)
+    {
+        buffer.insert(buffer.end(), block.begin(), block.end());
+    }
+    for (int32_t shift = 24; shift >= 0; shift -= 8)
+    {
+        buffer.push_back(static_cast<uint8_t>(checksum >> shift));
+    }
+    return buffer;
+}
+
 std::optional<std::vector<uint8_t>> util_zlib_deflate(const uint8_t* data, size_t data_in_size)
 {
+    if (data_in_size > ZLIB_PARALLEL_BLOCK_SIZE && OpenRCT2::TaskScheduler::Get().GetWorkerCount() > 0)
+    {
+        return util_zlib_deflate_parallel(data, data_in_size);
+    }
+
     int32_t ret = Z_OK;
     uLongf out_size = 0;
     uLong buffer_size = compressBound(static_cast<uLong>(data_in_size));
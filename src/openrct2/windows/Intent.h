@@ -93,6 +93,7 @@ enum
     INTENT_ACTION_REFRESH_SCENERY,
     INTENT_ACTION_INVALIDATE_TICKER_NEWS,
     INTENT_ACTION_REFRESH_GUEST_LIST,
+    INTENT_ACTION_REMOVE_GUEST_FROM_LIST,
     INTENT_ACTION_CLEAR_TILE_INSPECTOR_CLIPBOARD,
     INTENT_ACTION_REFRESH_STAFF_LIST,
     INTENT_ACTION_INVALIDATE_VEHICLE_WINDOW,
@@ -18,6 +18,7 @@
 #include "../config/Config.h"
 #include "../drawing/Drawing.h"
 #include "../interface/Window.h"
+#include "../interface/Window_internal.h"
 #include "../localisation/Date.h"
 #include "../scenario/Scenario.h"
 #include "../sprites.h"
@@ -69,6 +70,7 @@ static void climate_update_weather_sound();
 static void climate_update_thunder_sound();
 static void climate_update_lightning();
 static void climate_update_thunder();
+static void climate_invalidate_weather_gloom();
 static void climate_play_thunder(int32_t instanceIndex, OpenRCT2::Audio::SoundId soundId, int32_t volume, int32_t pan);
 
 int32_t climate_celsius_to_fahrenheit(int32_t celsius)
@@ -152,7 +154,7 @@ void climate_update()
                 {
                     gClimateCurrent.WeatherGloom = climate_step_weather_level(
                         gClimateCurrent.WeatherGloom, gClimateNext.WeatherGloom);
-                    gfx_invalidate_screen();
+                    climate_invalidate_weather_gloom();
                 }
             }
             else
@@ -189,6 +191,7 @@ void climate_force_weather(WeatherType weather)
     int32_t month = date_get_month(gDateMonthsElapsed);
     const WeatherTransition* transition = &ClimateTransitions[static_cast<uint8_t>(gClimate)][month];
     const auto weatherState = &ClimateWeatherData[EnumValue(weather)];
+    const auto previousGloom = gClimateCurrent.WeatherGloom;
 
     gClimateCurrent.Weather = weather;
     gClimateCurrent.WeatherGloom = weatherState->GloomLevel;
@@ -199,8 +202,10 @@ void climate_force_weather(WeatherType weather)
 
     climate_update();
 
-    // In case of change in gloom level force a complete redraw
-    gfx_invalidate_screen();
+    if (gClimateCurrent.WeatherGloom != previousGloom)
+    {
+        climate_invalidate_weather_gloom();
+    }
 }
 
 void climate_update_sound()
@@ -372,6 +377,26 @@ static void climate_update_thunder_sound()
     }
 }
 
+/**
+ * The gloom is filtered over the viewports as they are drawn, after their paint structs are arranged, so a change of
+ * gloom only needs the viewports drawn again. The other windows, their cached surfaces and the cached paint columns
+ * stay valid.
+ */
+static void climate_invalidate_weather_gloom()
+{
+    if (!gConfigGeneral.render_weather_gloom)
+        return;
+
+    window_visit_each([](rct_window* w) {
+        auto* viewport = w->viewport;
+        if (viewport != nullptr && viewport->visibility != VisibilityCache::Covered)
+        {
+            auto bottomRight = viewport->pos + ScreenCoordsXY{ viewport->width, viewport->height };
+            gfx_set_dirty_blocks({ viewport->pos, bottomRight });
+        }
+    });
+}
+
 static void climate_update_lightning()
 {
     if (_lightningTimer == 0)
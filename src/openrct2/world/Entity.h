@@ -11,21 +11,52 @@
 
 #include "SpriteBase.h"
 
+#include <type_traits>
+
 constexpr uint16_t MAX_ENTITIES = 10000;
 
 SpriteBase* try_get_sprite(size_t spriteIndex);
 SpriteBase* get_sprite(size_t sprite_idx);
 
+/**
+ * Returns the type of the entity at the given index from the dense type array, this does not touch the entity itself.
+ * Returns EntityType::Null for indices out of range.
+ */
+EntityType GetEntityType(size_t spriteIndex);
+
+template<typename T, typename = void> struct EntityHasStaticType : std::false_type
+{
+};
+
+template<typename T> struct EntityHasStaticType<T, std::void_t<decltype(T::cEntityType)>> : std::true_type
+{
+};
+
 template<typename T = SpriteBase> T* GetEntity(size_t sprite_idx)
 {
-    auto spr = get_sprite(sprite_idx);
-    return spr != nullptr ? spr->As<T>() : nullptr;
+    if constexpr (EntityHasStaticType<T>::value)
+    {
+        // Check the type first so that entities of other types are never loaded.
+        return GetEntityType(sprite_idx) == T::cEntityType ? static_cast<T*>(get_sprite(sprite_idx)) : nullptr;
+    }
+    else
+    {
+        auto spr = get_sprite(sprite_idx);
+        return spr != nullptr ? spr->As<T>() : nullptr;
+    }
 }
 
 template<typename T = SpriteBase> T* TryGetEntity(size_t sprite_idx)
 {
-    auto spr = try_get_sprite(sprite_idx);
-    return spr != nullptr ? spr->As<T>() : nullptr;
+    if constexpr (EntityHasStaticType<T>::value)
+    {
+        return GetEntityType(sprite_idx) == T::cEntityType ? static_cast<T*>(try_get_sprite(sprite_idx)) : nullptr;
+    }
+    else
+    {
+        auto spr = try_get_sprite(sprite_idx);
+        return spr != nullptr ? spr->As<T>() : nullptr;
+    }
 }
 
 SpriteBase* CreateEntity(EntityType type);
@@ -11,36 +11,161 @@
 
 #include "../common.h"
 #include "../rct12/RCT12.h"
+#include "../util/Util.h"
 #include "Entity.h"
 #include "Location.hpp"
 #include "SpriteBase.h"
 
-#include <list>
-#include <vector>
+#include <array>
 
 enum class EntityListId : uint8_t
 {
     Count = 6,
 };
 
-const std::list<uint16_t>& GetEntityList(const EntityType id);
+/**
+ * Set of entity indices backed by a bitmap. Adding and removing are O(1) and cause no allocations, iteration always
+ * visits the indices in ascending sprite_index order which is required to keep network games in sync.
+ */
+class EntityIndexList
+{
+private:
+    using Block = uint64_t;
+    static constexpr size_t BitsPerBlock = sizeof(Block) * 8;
+    static constexpr size_t BlockCount = (MAX_ENTITIES + BitsPerBlock - 1) / BitsPerBlock;
+
+    std::array<Block, BlockCount> _blocks{};
+    size_t _count{};
+
+public:
+    class const_iterator
+    {
+    private:
+        const EntityIndexList* _list;
+        size_t _index;
+
+    public:
+        const_iterator(const EntityIndexList* list, size_t index)
+            : _list(list)
+            , _index(index)
+        {
+        }
+        const_iterator& operator++()
+        {
+            _index = _list->FindNext(_index + 1);
+            return *this;
+        }
+        const_iterator operator++(int)
+        {
+            const_iterator retval = *this;
+            ++(*this);
+            return retval;
+        }
+        bool operator==(const const_iterator& other) const
+        {
+            return _index == other._index;
+        }
+        bool operator!=(const const_iterator& other) const
+        {
+            return !(*this == other);
+        }
+        uint16_t operator*() const
+        {
+            return static_cast<uint16_t>(_index);
+        }
+        // iterator traits
+        using difference_type = std::ptrdiff_t;
+        using value_type = uint16_t;
+        using pointer = const uint16_t*;
+        using reference = const uint16_t&;
+        using iterator_category = std::forward_iterator_tag;
+    };
+
+    const_iterator begin() const
+    {
+        return const_iterator(this, FindNext(0));
+    }
+    const_iterator end() const
+    {
+        return const_iterator(this, MAX_ENTITIES);
+    }
+
+    size_t size() const
+    {
+        return _count;
+    }
+    bool empty() const
+    {
+        return _count == 0;
+    }
+    bool contains(uint16_t index) const
+    {
+        return index < MAX_ENTITIES && (_blocks[index / BitsPerBlock] & (Block{ 1 } << (index % BitsPerBlock))) != 0;
+    }
+    void insert(uint16_t index)
+    {
+        if (index >= MAX_ENTITIES || contains(index))
+            return;
+        _blocks[index / BitsPerBlock] |= Block{ 1 } << (index % BitsPerBlock);
+        _count++;
+    }
+    void erase(uint16_t index)
+    {
+        if (!contains(index))
+            return;
+        _blocks[index / BitsPerBlock] &= ~(Block{ 1 } << (index % BitsPerBlock));
+        _count--;
+    }
+    void clear()
+    {
+        _blocks.fill(0);
+        _count = 0;
+    }
+
+private:
+    // Returns the first index in the set that is not below start, or MAX_ENTITIES if there is none.
+    size_t FindNext(size_t start) const
+    {
+        if (start >= MAX_ENTITIES)
+            return MAX_ENTITIES;
+
+        size_t blockIndex = start / BitsPerBlock;
+        Block block = _blocks[blockIndex] & (~Block{ 0 } << (start % BitsPerBlock));
+        while (block == 0)
+        {
+            if (++blockIndex >= BlockCount)
+                return MAX_ENTITIES;
+            block = _blocks[blockIndex];
+        }
+        return (blockIndex * BitsPerBlock) + bitscanforward(static_cast<int64_t>(block));
+    }
+};
+
+const EntityIndexList& GetEntityList(const EntityType id);
 
 uint16_t GetEntityListCount(EntityType list);
 uint16_t GetMiscEntityCount();
 uint16_t GetNumFreeEntities();
-const std::vector<uint16_t>& GetEntityTileList(const CoordsXY& spritePos);
+/**
+ * Entities on each tile are kept in an intrusive linked list in sprite_index order. The tile index is an opaque
+ * handle obtained from GetEntityTileIndex.
+ */
+size_t GetEntityTileIndex(const CoordsXY& spritePos);
+uint16_t GetFirstEntityOnTile(size_t tileIndex);
+// Returns SPRITE_INDEX_NULL when the entity is the last one of the tile or has moved off the tile.
+uint16_t GetNextEntityOnTile(size_t tileIndex, uint16_t spriteIndex);
 
 template<typename T> class EntityTileIterator
 {
 private:
-    std::vector<uint16_t>::const_iterator iter;
-    std::vector<uint16_t>::const_iterator end;
+    size_t tileIndex;
+    uint16_t iter;
     T* Entity = nullptr;
 
 public:
-    EntityTileIterator(std::vector<uint16_t>::const_iterator _iter, std::vector<uint16_t>::const_iterator _end)
-        : iter(_iter)
-        , end(_end)
+    EntityTileIterator(size_t _tileIndex, uint16_t _iter)
+        : tileIndex(_tileIndex)
+        , iter(_iter)
     {
         ++(*this);
     }
@@ -48,9 +173,11 @@ public:
     {
         Entity = nullptr;
 
-        while (iter != end && Entity == nullptr)
+        while (iter != SPRITE_INDEX_NULL && Entity == nullptr)
         {
-            Entity = GetEntity<T>(*iter++);
+            const auto spriteIndex = iter;
+            iter = GetNextEntityOnTile(tileIndex, spriteIndex);
+            Entity = GetEntity<T>(spriteIndex);
         }
         return *this;
     }
@@ -59,7 +186,7 @@ public:
     {
         EntityTileIterator retval = *this;
         ++(*this);
-        return *iter;
+        return retval;
     }
     bool operator==(EntityTileIterator other) const
     {
@@ -84,33 +211,33 @@ public:
 template<typename T = SpriteBase> class EntityTileList
 {
 private:
-    const std::vector<uint16_t>& vec;
+    size_t tileIndex;
 
 public:
     EntityTileList(const CoordsXY& loc)
-        : vec(GetEntityTileList(loc))
+        : tileIndex(GetEntityTileIndex(loc))
     {
     }
 
     EntityTileIterator<T> begin()
     {
-        return EntityTileIterator<T>(std::begin(vec), std::end(vec));
+        return EntityTileIterator<T>(tileIndex, GetFirstEntityOnTile(tileIndex));
     }
     EntityTileIterator<T> end()
     {
-        return EntityTileIterator<T>(std::end(vec), std::end(vec));
+        return EntityTileIterator<T>(tileIndex, SPRITE_INDEX_NULL);
     }
 };
 
 template<typename T> class EntityListIterator
 {
 private:
-    std::list<uint16_t>::const_iterator iter;
-    std::list<uint16_t>::const_iterator end;
+    EntityIndexList::const_iterator iter;
+    EntityIndexList::const_iterator end;
     T* Entity = nullptr;
 
 public:
-    EntityListIterator(std::list<uint16_t>::const_iterator _iter, std::list<uint16_t>::const_iterator _end)
+    EntityListIterator(EntityIndexList::const_iterator _iter, EntityIndexList::const_iterator _end)
         : iter(_iter)
         , end(_end)
     {
@@ -157,7 +284,7 @@ template<typename T = SpriteBase> class EntityList
 {
 private:
     using EntityListIterator_t = EntityListIterator<T>;
-    const std::list<uint16_t>& vec;
+    const EntityIndexList& vec;
 
 public:
     EntityList()
@@ -8,35 +8,45 @@
  *****************************************************************************/
 #include "EntityTweener.h"
 
+#include "../interface/Viewport.h"
 #include "../peep/Peep.h"
 #include "../ride/Vehicle.h"
 #include "EntityList.h"
+#include "Map.h"
 #include "Sprite.h"
 
+#include <algorithm>
 #include <cmath>
 
+void EntityTweener::AddEntity(SpriteBase* entity)
+{
+    if (entity->sprite_index >= EntityIndices.size())
+        return;
+
+    Entities.push_back(entity);
+    PrePos.emplace_back(entity->x, entity->y, entity->z);
+    EntityIndices[entity->sprite_index] = static_cast<uint32_t>(Entities.size());
+}
+
 void EntityTweener::PopulateEntities()
 {
+    EntityIndices.resize(MAX_ENTITIES);
     for (auto ent : EntityList<Guest>())
     {
-        Entities.push_back(ent);
-        PrePos.emplace_back(ent->x, ent->y, ent->z);
+        AddEntity(ent);
     }
     for (auto ent : EntityList<Staff>())
     {
-        Entities.push_back(ent);
-        PrePos.emplace_back(ent->x, ent->y, ent->z);
+        AddEntity(ent);
     }
     for (auto ent : EntityList<Vehicle>())
     {
-        Entities.push_back(ent);
-        PrePos.emplace_back(ent->x, ent->y, ent->z);
+        AddEntity(ent);
     }
 }
 
 void EntityTweener::PreTick()
 {
-    Restore();
     Reset();
     PopulateEntities();
 }
@@ -59,20 +69,23 @@ void EntityTweener::PostTick()
 
 void EntityTweener::RemoveEntity(SpriteBase* entity)
 {
-    if (!entity->Is<Peep>() && !entity->Is<Vehicle>())
-    {
-        // Only peeps and vehicles are tweened, bail if type is incorrect.
+    if (entity->sprite_index >= EntityIndices.size())
         return;
-    }
 
-    auto it = std::find(Entities.begin(), Entities.end(), entity);
-    if (it != Entities.end())
-        *it = nullptr;
+    auto& index = EntityIndices[entity->sprite_index];
+    if (index != 0)
+    {
+        Entities[index - 1] = nullptr;
+        index = 0;
+    }
 }
 
 void EntityTweener::Tween(float alpha)
 {
     const float inv = (1.0f - alpha);
+    const auto rotation = get_current_rotation();
+    const bool hasPreviousFrame = RenderStates.size() == Entities.size();
+    RenderStates.resize(Entities.size());
     for (size_t i = 0; i < Entities.size(); ++i)
     {
         auto* ent = Entities[i];
@@ -82,36 +95,77 @@ void EntityTweener::Tween(float alpha)
         auto& posA = PrePos[i];
         auto& posB = PostPos[i];
 
+        auto& state = RenderStates[i];
         if (posA == posB)
+        {
+            state = { posB, ent->sprite_left, ent->sprite_top, ent->sprite_right, ent->sprite_bottom };
             continue;
+        }
 
-        sprite_set_coordinates(
-            { static_cast<int32_t>(std::round(posB.x * alpha + posA.x * inv)),
-              static_cast<int32_t>(std::round(posB.y * alpha + posA.y * inv)),
-              static_cast<int32_t>(std::round(posB.z * alpha + posA.z * inv)) },
-            ent);
-        ent->Invalidate();
+        const auto previousState = state;
+        const CoordsXYZ pos = { static_cast<int32_t>(std::round(posB.x * alpha + posA.x * inv)),
+                                static_cast<int32_t>(std::round(posB.y * alpha + posA.y * inv)),
+                                static_cast<int32_t>(std::round(posB.z * alpha + posA.z * inv)) };
+        const auto screenCoords = translate_3d_to_2d_with_z(rotation, pos);
+        state.Position = pos;
+        state.SpriteLeft = screenCoords.x - ent->sprite_width;
+        state.SpriteRight = screenCoords.x + ent->sprite_width;
+        state.SpriteTop = screenCoords.y - ent->sprite_height_negative;
+        state.SpriteBottom = screenCoords.y + ent->sprite_height_positive;
+
+        // Redraw both where the entity was drawn last frame and where it is drawn now
+        if (hasPreviousFrame && previousState.Position != pos)
+        {
+            viewports_invalidate(
+                std::min(previousState.SpriteLeft, state.SpriteLeft), std::min(previousState.SpriteTop, state.SpriteTop),
+                std::max(previousState.SpriteRight, state.SpriteRight),
+                std::max(previousState.SpriteBottom, state.SpriteBottom), 2);
+        }
+        else if (!hasPreviousFrame)
+        {
+            viewports_invalidate(state.SpriteLeft, state.SpriteTop, state.SpriteRight, state.SpriteBottom, 2);
+        }
     }
 }
 
-void EntityTweener::Restore()
+/**
+ * Redraws the tweened positions of the last frame, as the entities will be drawn somewhere else from now on.
+ */
+void EntityTweener::InvalidateRenderStates()
 {
-    for (size_t i = 0; i < Entities.size(); ++i)
+    for (size_t i = 0; i < RenderStates.size() && i < PrePos.size() && i < PostPos.size(); ++i)
     {
-        auto* ent = Entities[i];
-        if (ent == nullptr)
-            continue;
-
-        sprite_set_coordinates(PostPos[i], ent);
-        ent->Invalidate();
+        if (PrePos[i] != PostPos[i])
+        {
+            const auto& state = RenderStates[i];
+            viewports_invalidate(state.SpriteLeft, state.SpriteTop, state.SpriteRight, state.SpriteBottom, 2);
+        }
     }
 }
 
 void EntityTweener::Reset()
 {
+    InvalidateRenderStates();
+    std::fill(EntityIndices.begin(), EntityIndices.end(), 0);
     Entities.clear();
     PrePos.clear();
     PostPos.clear();
+    RenderStates.clear();
+}
+
+EntityRenderState EntityTweener::GetRenderState(const SpriteBase& entity) const
+{
+    if (entity.sprite_index < EntityIndices.size())
+    {
+        const auto index = EntityIndices[entity.sprite_index];
+        if (index != 0 && index <= RenderStates.size())
+        {
+            return RenderStates[index - 1];
+        }
+    }
+    return {
+        { entity.x, entity.y, entity.z }, entity.sprite_left, entity.sprite_top, entity.sprite_right, entity.sprite_bottom
+    };
 }
 
 static EntityTweener tweener;
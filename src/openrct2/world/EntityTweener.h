@@ -9,18 +9,41 @@
 
 #pragma once
 
+#include "Location.hpp"
 #include "SpriteBase.h"
 
 #include <vector>
 
+/**
+ * Where an entity is drawn in the current frame, along with its screen bounds at that position.
+ */
+struct EntityRenderState
+{
+    CoordsXYZ Position;
+    int16_t SpriteLeft;
+    int16_t SpriteTop;
+    int16_t SpriteRight;
+    int16_t SpriteBottom;
+};
+
+/**
+ * Interpolates the positions of moving entities between ticks for variable frame rates. The interpolated positions
+ * are kept here for painting only, the entities themselves always stay at their simulated positions.
+ */
 class EntityTweener
 {
     std::vector<SpriteBase*> Entities;
     std::vector<CoordsXYZ> PrePos;
     std::vector<CoordsXYZ> PostPos;
+    std::vector<EntityRenderState> RenderStates;
+
+    // One past the index into Entities for every sprite index that is tweened, 0 for entities that are not.
+    std::vector<uint32_t> EntityIndices;
 
 private:
     void PopulateEntities();
+    void AddEntity(SpriteBase* entity);
+    void InvalidateRenderStates();
 
 public:
     static EntityTweener& Get();
@@ -29,6 +52,10 @@ public:
     void PostTick();
     void RemoveEntity(SpriteBase* entity);
     void Tween(float alpha);
-    void Restore();
     void Reset();
+
+    /**
+     * Returns the position the entity is drawn at, which is its current position unless it is being tweened.
+     */
+    EntityRenderState GetRenderState(const SpriteBase& entity) const;
 };
@@ -46,8 +46,8 @@ CoordsXYZ gFootpathConstructFromPosition;
 uint8_t gFootpathConstructSlope;
 uint8_t gFootpathGroundFlags;
 
-static ride_id_t* _footpathQueueChainNext;
 static ride_id_t _footpathQueueChain[64];
+static ride_id_t* _footpathQueueChainNext = _footpathQueueChain;
 
 // This is the coordinates that a user of the bin should move to
 // rct2: 0x00992A4C
@@ -1191,6 +1191,10 @@ void footpath_queue_chain_push(ride_id_t rideIndex)
 {
     if (rideIndex != RIDE_ID_NULL)
     {
+        // A ride's queues only need to be walked once per update, however many of its queue tiles were touched
+        if (std::find(_footpathQueueChain, _footpathQueueChainNext, rideIndex) != _footpathQueueChainNext)
+            return;
+
         auto* lastSlot = _footpathQueueChain + std::size(_footpathQueueChain) - 1;
         if (_footpathQueueChainNext <= lastSlot)
         {
@@ -1927,6 +1931,23 @@ void footpath_update_path_wide_flags(const CoordsXY& footpathPos)
     } while (!(tileElement++)->IsLastForTile());
 }
 
+/**
+ * Recomputes the wide flags of the tiles around an edited path right away rather than waiting for the map sweep in
+ * map_update_path_wide_flags to reach them. The tiles are updated in the same order as the sweep as the wide flag of
+ * a tile depends on the flags of the tiles updated before it. Any knock-on changes further away are still picked up
+ * by the sweep.
+ */
+void footpath_update_path_wide_flags_around(const CoordsXY& footpathPos)
+{
+    for (int32_t yOffset = -COORDS_XY_STEP; yOffset <= COORDS_XY_STEP; yOffset += COORDS_XY_STEP)
+    {
+        for (int32_t xOffset = -COORDS_XY_STEP; xOffset <= COORDS_XY_STEP; xOffset += COORDS_XY_STEP)
+        {
+            footpath_update_path_wide_flags(footpathPos.ToTileStart() + CoordsXY{ xOffset, yOffset });
+        }
+    }
+}
+
 bool footpath_is_blocked_by_vehicle(const TileCoordsXYZ& position)
 {
     auto pathElement = map_get_path_element_at(position);
@@ -37,6 +37,7 @@
 #include "../object/ObjectManager.h"
 #include "../object/TerrainSurfaceObject.h"
 #include "../ride/RideData.h"
+#include "../ride/RideProximityIndex.h"
 #include "../ride/Track.h"
 #include "../ride/TrackData.h"
 #include "../ride/TrackDesign.h"
@@ -57,8 +58,10 @@
 #include "Wall.h"
 
 #include <algorithm>
+#include <bitset>
 #include <iterator>
 #include <memory>
+#include <tuple>
 
 using namespace OpenRCT2;
 
@@ -124,6 +127,62 @@ static int32_t _mapSizeMinus2Stash;
 static int32_t _mapSizeStash;
 static int32_t _currentRotationStash;
 
+// Blocks of elements left behind when a tile moves to a bigger block or loses an element, indexed by block size. Blocks
+// that are freed only become reusable at the next capacity check: callers may still hold pointers into the old block of
+// a tile until then, as they could before blocks were reused.
+static constexpr size_t MaxFreeTileElementBlockSize = 32;
+static std::array<std::vector<size_t>, MaxFreeTileElementBlockSize + 1> _freeTileElementBlocks;
+static std::vector<std::pair<size_t, size_t>> _pendingFreeTileElementBlocks;
+
+static void ClearFreeTileElementBlocks()
+{
+    for (auto& blocks : _freeTileElementBlocks)
+    {
+        blocks.clear();
+    }
+    _pendingFreeTileElementBlocks.clear();
+}
+
+static void FreeTileElementBlock(const TileElement* block, size_t numElements)
+{
+    if (block != nullptr && numElements != 0 && numElements <= MaxFreeTileElementBlockSize)
+    {
+        _pendingFreeTileElementBlocks.emplace_back(block - _tileElements.data(), numElements);
+    }
+}
+
+static void ReleasePendingFreeTileElementBlocks()
+{
+    for (const auto& [index, numElements] : _pendingFreeTileElementBlocks)
+    {
+        _freeTileElementBlocks[numElements].push_back(index);
+    }
+    _pendingFreeTileElementBlocks.clear();
+}
+
+/**
+ * Takes the smallest free block that fits, the rest of a bigger block is kept for later allocations.
+ * @returns nullptr if there is no free block big enough.
+ */
+static TileElement* TakeFreeTileElementBlock(size_t numElements)
+{
+    for (size_t blockSize = numElements; blockSize <= MaxFreeTileElementBlockSize; blockSize++)
+    {
+        auto& blocks = _freeTileElementBlocks[blockSize];
+        if (!blocks.empty())
+        {
+            auto index = blocks.back();
+            blocks.pop_back();
+            if (blockSize > numElements)
+            {
+                _freeTileElementBlocks[blockSize - numElements].push_back(index + numElements);
+            }
+            return &_tileElements[index];
+        }
+    }
+    return nullptr;
+}
+
 void StashMap()
 {
     _tileIndexStash = std::move(_tileIndex);
@@ -133,10 +192,13 @@ void StashMap()
     _mapSizeStash = gMapSize;
     _currentRotationStash = gCurrentRotation;
     _tileElementsInUseStash = _tileElementsInUse;
+    ClearFreeTileElementBlocks();
+    RideProximityIndex::Reset();
 }
 
-void UnstashMap()
+std::vector<TileElement> UnstashMap()
 {
+    auto temporaryTileElements = std::move(_tileElements);
     _tileIndex = std::move(_tileIndexStash);
     _tileElements = std::move(_tileElementsStash);
     gMapSizeUnits = _mapSizeUnitsStash;
@@ -144,6 +206,9 @@ void UnstashMap()
     gMapSize = _mapSizeStash;
     gCurrentRotation = _currentRotationStash;
     _tileElementsInUse = _tileElementsInUseStash;
+    ClearFreeTileElementBlocks();
+    RideProximityIndex::Reset();
+    return temporaryTileElements;
 }
 
 const std::vector<TileElement>& GetTileElements()
@@ -156,6 +221,20 @@ void SetTileElements(std::vector<TileElement>&& tileElements)
     _tileElements = std::move(tileElements);
     _tileIndex = TilePointerIndex<TileElement>(MAXIMUM_MAP_SIZE_TECHNICAL, _tileElements.data());
     _tileElementsInUse = _tileElements.size();
+    ClearFreeTileElementBlocks();
+    RideProximityIndex::Reset();
+}
+
+size_t GetTileElementsMemoryUsage()
+{
+    size_t bytes = (_tileElements.capacity() + _tileElementsStash.capacity()) * sizeof(TileElement);
+    bytes += _tileIndex.GetMemoryUsage() + _tileIndexStash.GetMemoryUsage();
+    for (const auto& blocks : _freeTileElementBlocks)
+    {
+        bytes += blocks.capacity() * sizeof(size_t);
+    }
+    bytes += _pendingFreeTileElementBlocks.capacity() * sizeof(decltype(_pendingFreeTileElementBlocks)::value_type);
+    return bytes;
 }
 
 static void ReorganiseTileElements(size_t capacity)
@@ -241,6 +320,7 @@ static size_t CountElementsOnTile(const CoordsXY& loc);
 
 bool MapCheckCapacityAndReorganise(const CoordsXY& loc, size_t numElements)
 {
+    ReleasePendingFreeTileElementBlocks();
     auto numElementsOnTile = CountElementsOnTile(loc);
     return map_check_free_elements_and_reorganise(numElementsOnTile, numElements);
 }
@@ -338,6 +418,7 @@ void map_set_tile_element(const TileCoordsXY& tilePos, TileElement* elements)
         return;
     }
     _tileIndex.SetTile(tilePos, elements);
+    RideProximityIndex::MarkTileChanged(tilePos);
 }
 
 SurfaceElement* map_get_surface_element_at(const CoordsXY& coords)
@@ -698,14 +779,29 @@ void map_update_path_wide_flags()
     // Presumably update_path_wide_flags is too computationally expensive to call for every
     // tile every update, so gWidePathTileLoopX and gWidePathTileLoopY store the x and y
     // progress. A maximum of 128 calls is done per update.
+    // Tiles on the map edge or outside the map can not have any paths, so runs of them are stepped over in one go. This
+    // keeps the same cadence for the other tiles on small maps without visiting every position.
+    const int32_t mapEdge = (gMapSize - 1) * COORDS_XY_STEP;
     auto x = gWidePathTileLoopPosition.x;
     auto y = gWidePathTileLoopPosition.y;
-    for (int32_t i = 0; i < 128; i++)
+    int32_t remainingSteps = 128;
+    while (remainingSteps > 0)
     {
-        footpath_update_path_wide_flags({ x, y });
+        int32_t steps = 1;
+        const bool isRowInMap = y >= COORDS_XY_STEP && y < mapEdge;
+        if (isRowInMap && x >= COORDS_XY_STEP && x < mapEdge)
+        {
+            footpath_update_path_wide_flags({ x, y });
+        }
+        else
+        {
+            const int32_t nextX = (isRowInMap && x < COORDS_XY_STEP) ? COORDS_XY_STEP : MAXIMUM_MAP_SIZE_BIG;
+            steps = std::min(remainingSteps, (nextX - x + COORDS_XY_STEP - 1) / COORDS_XY_STEP);
+        }
+        remainingSteps -= steps;
 
         // Next x, y tile
-        x += COORDS_XY_STEP;
+        x += steps * COORDS_XY_STEP;
         if (x >= MAXIMUM_MAP_SIZE_BIG)
         {
             x = 0;
@@ -1011,6 +1107,11 @@ bool map_is_location_at_edge(const CoordsXY& loc)
  */
 void tile_element_remove(TileElement* tileElement)
 {
+    if (tileElement->GetType() == TILE_ELEMENT_TYPE_TRACK)
+    {
+        RideProximityIndex::MarkTrackRemoved();
+    }
+
     // Replace Nth element by (N+1)th element.
     // This loop will make tileElement point to the old last element position,
     // after copy it to it's new position
@@ -1030,6 +1131,10 @@ void tile_element_remove(TileElement* tileElement)
     {
         _tileElements.pop_back();
     }
+    else
+    {
+        FreeTileElementBlock(tileElement, 1);
+    }
 }
 
 /**
@@ -1149,9 +1254,17 @@ static TileElement* AllocateTileElements(size_t numElementsOnTile, size_t numNew
         return nullptr;
     }
 
+    _tileElementsInUse += numNewElements;
+
+    // Reusing a block never needs the spare capacity at the end that the game actions have checked for
+    auto* freeBlock = TakeFreeTileElementBlock(numElementsOnTile + numNewElements);
+    if (freeBlock != nullptr)
+    {
+        return freeBlock;
+    }
+
     auto oldSize = _tileElements.size();
     _tileElements.resize(_tileElements.size() + numElementsOnTile + numNewElements);
-    _tileElementsInUse += numNewElements;
     return &_tileElements[oldSize];
 }
 
@@ -1170,9 +1283,11 @@ TileElement* tile_element_insert(const CoordsXYZ& loc, int32_t occupiedQuadrants
     {
         return nullptr;
     }
+    FreeTileElementBlock(originalTileElement, numElementsOnTileOld);
 
     // Set tile index pointer to point to new element block
     _tileIndex.SetTile(tileLoc, newTileElement);
+    RideProximityIndex::MarkTileChanged(tileLoc);
 
     bool isLastForTile = false;
     if (originalTileElement == nullptr)
@@ -2047,23 +2162,159 @@ ScreenCoordsXY translate_3d_to_2d_with_z(int32_t rotation, const CoordsXYZ& pos)
     return ScreenCoordsXY{ rotated.y - rotated.x, ((rotated.x + rotated.y) >> 1) - pos.z };
 }
 
+static int32_t _invalidationBatchDepth;
+static bool _invalidationBatchPending;
+static ScreenRect _invalidationBatchRect;
+
+/**
+ * Invalidates the given area of all viewports, or adds it to the open invalidation batch.
+ */
+static void map_invalidate_viewports(int32_t left, int32_t top, int32_t right, int32_t bottom, int32_t maxZoom)
+{
+    if (_invalidationBatchDepth == 0)
+    {
+        viewports_invalidate(left, top, right, bottom, maxZoom);
+    }
+    else if (!_invalidationBatchPending)
+    {
+        _invalidationBatchRect = { { left, top }, { right, bottom } };
+        _invalidationBatchPending = true;
+    }
+    else
+    {
+        _invalidationBatchRect.Point1.x = std::min(_invalidationBatchRect.GetLeft(), left);
+        _invalidationBatchRect.Point1.y = std::min(_invalidationBatchRect.GetTop(), top);
+        _invalidationBatchRect.Point2.x = std::max(_invalidationBatchRect.GetRight(), right);
+        _invalidationBatchRect.Point2.y = std::max(_invalidationBatchRect.GetBottom(), bottom);
+    }
+}
+
+void map_begin_invalidation_batch()
+{
+    _invalidationBatchDepth++;
+}
+
+void map_end_invalidation_batch()
+{
+    if (_invalidationBatchDepth == 0 || --_invalidationBatchDepth != 0)
+        return;
+
+    if (_invalidationBatchPending)
+    {
+        _invalidationBatchPending = false;
+        viewports_invalidate(
+            _invalidationBatchRect.GetLeft(), _invalidationBatchRect.GetTop(), _invalidationBatchRect.GetRight(),
+            _invalidationBatchRect.GetBottom());
+    }
+}
+
+struct QueuedTileInvalidation
+{
+    int32_t X;
+    int32_t Y;
+    int32_t MaxZoom;
+    int32_t Z0;
+    int32_t Z1;
+};
+
+static constexpr size_t MaxQueuedTileInvalidations = 65536;
+
+// Tile invalidations of the current frame, projected to the viewports once before the frame is drawn.
+static std::vector<QueuedTileInvalidation> _queuedTileInvalidations;
+
+static void map_invalidate_tile_viewports(const QueuedTileInvalidation& tile)
+{
+    auto screenCoord = translate_3d_to_2d(get_current_rotation(), { tile.X + 16, tile.Y + 16 });
+
+    int32_t x1 = screenCoord.x - 32;
+    int32_t y1 = screenCoord.y - 32 - tile.Z1;
+    int32_t x2 = screenCoord.x + 32;
+    int32_t y2 = screenCoord.y + 32 - tile.Z0;
+
+    map_invalidate_viewports(x1, y1, x2, y2, tile.MaxZoom);
+}
+
 static void map_invalidate_tile_under_zoom(int32_t x, int32_t y, int32_t z0, int32_t z1, int32_t maxZoom)
 {
     if (gOpenRCT2Headless)
         return;
 
-    int32_t x1, y1, x2, y2;
+    if (_invalidationBatchDepth != 0)
+    {
+        map_invalidate_tile_viewports({ x, y, maxZoom, z0, z1 });
+        return;
+    }
 
-    x += 16;
-    y += 16;
-    auto screenCoord = translate_3d_to_2d(get_current_rotation(), { x, y });
+    // Picking must not see the old contents of the tile, even though the viewports are only invalidated later.
+    viewport_invalidate_interaction_cache();
+    _queuedTileInvalidations.push_back({ x, y, maxZoom, z0, z1 });
+
+    // Frames may not be drawn for a while, e.g. when the window is minimised.
+    if (_queuedTileInvalidations.size() >= MaxQueuedTileInvalidations)
+    {
+        map_flush_invalidations();
+    }
+}
+
+void map_flush_invalidations()
+{
+    if (_queuedTileInvalidations.empty())
+        return;
 
-    x1 = screenCoord.x - 32;
-    y1 = screenCoord.y - 32 - z1;
-    x2 = screenCoord.x + 32;
-    y2 = screenCoord.y + 32 - z0;
+    // Tiles invalidated several times during the frame are merged into one area covering all their height ranges.
+    auto& queue = _queuedTileInvalidations;
+    std::sort(queue.begin(), queue.end(), [](const QueuedTileInvalidation& a, const QueuedTileInvalidation& b) {
+        return std::tie(a.Y, a.X, a.MaxZoom) < std::tie(b.Y, b.X, b.MaxZoom);
+    });
 
-    viewports_invalidate(x1, y1, x2, y2, maxZoom);
+    for (size_t i = 0; i < queue.size();)
+    {
+        auto merged = queue[i++];
+        while (i < queue.size() && queue[i].X == merged.X && queue[i].Y == merged.Y && queue[i].MaxZoom == merged.MaxZoom)
+        {
+            merged.Z0 = std::min(merged.Z0, queue[i].Z0);
+            merged.Z1 = std::max(merged.Z1, queue[i].Z1);
+            i++;
+        }
+        map_invalidate_tile_viewports(merged);
+    }
+    queue.clear();
+}
+
+static bool _trackChangedTiles;
+static std::vector<TileCoordsXY> _changedTiles;
+static std::bitset<MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL> _changedTileFlags;
+
+static void map_mark_tile_changed(const TileCoordsXY& tilePos)
+{
+    if (tilePos.x < 0 || tilePos.y < 0 || tilePos.x >= MAXIMUM_MAP_SIZE_TECHNICAL || tilePos.y >= MAXIMUM_MAP_SIZE_TECHNICAL)
+        return;
+
+    auto index = static_cast<size_t>(tilePos.y) * MAXIMUM_MAP_SIZE_TECHNICAL + tilePos.x;
+    if (!_changedTileFlags[index])
+    {
+        _changedTileFlags[index] = true;
+        _changedTiles.push_back(tilePos);
+    }
+}
+
+void map_set_changed_tile_tracking(bool enabled)
+{
+    _trackChangedTiles = enabled;
+    _changedTiles.clear();
+    _changedTiles.shrink_to_fit();
+    _changedTileFlags.reset();
+}
+
+std::vector<TileCoordsXY> map_take_changed_tiles()
+{
+    for (const auto& tilePos : _changedTiles)
+    {
+        _changedTileFlags[static_cast<size_t>(tilePos.y) * MAXIMUM_MAP_SIZE_TECHNICAL + tilePos.x] = false;
+    }
+    std::vector<TileCoordsXY> result;
+    result.swap(_changedTiles);
+    return result;
 }
 
 /**
@@ -2072,6 +2323,10 @@ static void map_invalidate_tile_under_zoom(int32_t x, int32_t y, int32_t z0, int
  */
 void map_invalidate_tile(const CoordsXYRangedZ& tilePos)
 {
+    if (_trackChangedTiles)
+    {
+        map_mark_tile_changed(TileCoordsXY{ tilePos });
+    }
     map_invalidate_tile_under_zoom(tilePos.x, tilePos.y, tilePos.baseZ, tilePos.clearanceZ, -1);
 }
 
@@ -2109,6 +2364,19 @@ void map_invalidate_element(const CoordsXY& elementPos, TileElement* tileElement
 
 void map_invalidate_region(const CoordsXY& mins, const CoordsXY& maxs)
 {
+    if (_trackChangedTiles)
+    {
+        auto minTile = TileCoordsXY{ mins };
+        auto maxTile = TileCoordsXY{ maxs };
+        for (int32_t y = std::max(minTile.y, 0); y <= std::min(maxTile.y, MAXIMUM_MAP_SIZE_TECHNICAL - 1); y++)
+        {
+            for (int32_t x = std::max(minTile.x, 0); x <= std::min(maxTile.x, MAXIMUM_MAP_SIZE_TECHNICAL - 1); x++)
+            {
+                map_mark_tile_changed({ x, y });
+            }
+        }
+    }
+
     int32_t x0, y0, x1, y1, left, right, top, bottom;
 
     x0 = mins.x + 16;
@@ -2124,7 +2392,7 @@ void map_invalidate_region(const CoordsXY& mins, const CoordsXY& maxs)
     bottom += 32;
     top -= 32 + 2080;
 
-    viewports_invalidate(left, top, right, bottom);
+    map_invalidate_viewports(left, top, right, bottom, -1);
 }
 
 int32_t map_get_tile_side(const CoordsXY& mapPos)
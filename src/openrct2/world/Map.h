@@ -170,13 +170,28 @@ public:
     {
         TilePointers[coords.x + (coords.y * MapSize)] = tileElement;
     }
+
+    size_t GetMemoryUsage() const
+    {
+        return TilePointers.capacity() * sizeof(T*);
+    }
 };
 
 void ReorganiseTileElements();
 const std::vector<TileElement>& GetTileElements();
 void SetTileElements(std::vector<TileElement>&& tileElements);
+
+/**
+ * @returns the bytes reserved for tile elements, including their index, free blocks and the stashed map.
+ */
+size_t GetTileElementsMemoryUsage();
 void StashMap();
-void UnstashMap();
+
+/**
+ * Restores the stashed map.
+ * @returns the tile elements that were in use until now, so their storage can be reused for the next temporary map.
+ */
+std::vector<TileElement> UnstashMap();
 
 void map_init(int32_t size);
 
@@ -272,6 +287,40 @@ void map_invalidate_tile_full(const CoordsXY& tilePos);
 void map_invalidate_element(const CoordsXY& elementPos, TileElement* tileElement);
 void map_invalidate_region(const CoordsXY& mins, const CoordsXY& maxs);
 
+/**
+ * While enabled, the tiles passed to map_invalidate_tile and map_invalidate_region are collected so the map window can
+ * redraw only the parts of the minimap that changed.
+ */
+void map_set_changed_tile_tracking(bool enabled);
+std::vector<TileCoordsXY> map_take_changed_tiles();
+
+/**
+ * Tile invalidations are queued and merged per tile, this projects them to the viewports. Called once per frame before
+ * drawing.
+ */
+void map_flush_invalidations();
+
+/**
+ * While a batch is open, viewport invalidations of tiles and regions are merged into a single area that is invalidated
+ * when the outermost batch ends. Used by actions that change many neighbouring tiles at once.
+ */
+void map_begin_invalidation_batch();
+void map_end_invalidation_batch();
+
+struct MapInvalidationBatch
+{
+    MapInvalidationBatch()
+    {
+        map_begin_invalidation_batch();
+    }
+    ~MapInvalidationBatch()
+    {
+        map_end_invalidation_batch();
+    }
+    MapInvalidationBatch(const MapInvalidationBatch&) = delete;
+    MapInvalidationBatch& operator=(const MapInvalidationBatch&) = delete;
+};
+
 int32_t map_get_tile_side(const CoordsXY& mapPos);
 int32_t map_get_tile_quadrant(const CoordsXY& mapPos);
 int32_t map_get_corner_height(int32_t z, int32_t slope, int32_t direction);
@@ -11,6 +11,7 @@
 
 #include "../Context.h"
 #include "../Game.h"
+#include "../OpenRCT2.h"
 #include "../interface/Viewport.h"
 #include "../object/StationObject.h"
 #include "../peep/Peep.h"
@@ -26,25 +27,44 @@
 #include "Scenery.h"
 #include "SmallScenery.h"
 
+#include <array>
+#include <unordered_set>
+
 using map_animation_invalidate_event_handler = bool (*)(const CoordsXYZ& loc);
 
 static std::vector<MapAnimation> _mapAnimations;
 
+// The type and location of every animation in _mapAnimations, so creating an animation does not need to search the list.
+static std::unordered_set<uint64_t> _mapAnimationKeys;
+
 constexpr size_t MAX_ANIMATED_OBJECTS = 2000;
 
+// Animations only redraw their tile when the region they are in can be seen in a viewport. They are still updated
+// everywhere, as some of them change the state of doors, photo sections and guests.
+constexpr int32_t AnimationRegionSize = 8 * COORDS_XY_STEP;
+constexpr int32_t AnimationRegionsPerSide = MAXIMUM_MAP_SIZE_TECHNICAL * COORDS_XY_STEP / AnimationRegionSize;
+
+enum class AnimationRegionVisibility : uint8_t
+{
+    Unknown,
+    Hidden,
+    Visible,
+};
+
+static std::array<AnimationRegionVisibility, AnimationRegionsPerSide * AnimationRegionsPerSide> _animationRegionVisibility;
+static bool _isCurrentAnimationVisible;
+
 static bool InvalidateMapAnimation(const MapAnimation& obj);
 
+static uint64_t GetMapAnimationKey(int32_t type, const CoordsXYZ& location)
+{
+    return (static_cast<uint64_t>(type & 0xFF) << 48) | (static_cast<uint64_t>(location.x & 0xFFFF) << 32)
+        | (static_cast<uint64_t>(location.y & 0xFFFF) << 16) | static_cast<uint64_t>(location.z & 0xFFFF);
+}
+
 static bool DoesAnimationExist(int32_t type, const CoordsXYZ& location)
 {
-    for (const auto& a : _mapAnimations)
-    {
-        if (a.type == type && a.location == location)
-        {
-            // Animation already exists
-            return true;
-        }
-    }
-    return false;
+    return _mapAnimationKeys.count(GetMapAnimationKey(type, location)) != 0;
 }
 
 void map_animation_create(int32_t type, const CoordsXYZ& loc)
@@ -55,6 +75,7 @@ void map_animation_create(int32_t type, const CoordsXYZ& loc)
         {
             // Create new animation
             _mapAnimations.push_back({ static_cast<uint8_t>(type), loc });
+            _mapAnimationKeys.insert(GetMapAnimationKey(type, loc));
         }
         else
         {
@@ -67,19 +88,69 @@ void map_animation_create(int32_t type, const CoordsXYZ& loc)
  *
  *  rct2: 0x0068AFAD
  */
+static bool IsAnimationRegionVisible(const CoordsXY& location)
+{
+    const auto regionX = location.x / AnimationRegionSize;
+    const auto regionY = location.y / AnimationRegionSize;
+    if (regionX < 0 || regionY < 0 || regionX >= AnimationRegionsPerSide || regionY >= AnimationRegionsPerSide)
+        return false;
+
+    auto& visibility = _animationRegionVisibility[regionY * AnimationRegionsPerSide + regionX];
+    if (visibility == AnimationRegionVisibility::Unknown)
+    {
+        // Screen bounds of the region from the ground up to the highest possible element, with the same margin
+        // tile invalidation uses around each tile
+        const auto rotation = get_current_rotation();
+        ScreenCoordsXY topLeft{ INT32_MAX, INT32_MAX };
+        ScreenCoordsXY bottomRight{ INT32_MIN, INT32_MIN };
+        for (int32_t corner = 0; corner < 4; corner++)
+        {
+            const CoordsXY cornerPos = { (regionX + (corner & 1)) * AnimationRegionSize,
+                                         (regionY + (corner >> 1)) * AnimationRegionSize };
+            for (int32_t z : { 0, MAX_ELEMENT_HEIGHT * COORDS_Z_STEP + 64 })
+            {
+                const auto screenPos = translate_3d_to_2d_with_z(rotation, { cornerPos, z });
+                topLeft.x = std::min(topLeft.x, screenPos.x);
+                topLeft.y = std::min(topLeft.y, screenPos.y);
+                bottomRight.x = std::max(bottomRight.x, screenPos.x);
+                bottomRight.y = std::max(bottomRight.y, screenPos.y);
+            }
+        }
+        const bool isVisible = viewports_overlap(topLeft.x - 32, topLeft.y - 32, bottomRight.x + 32, bottomRight.y + 32, 1);
+        visibility = isVisible ? AnimationRegionVisibility::Visible : AnimationRegionVisibility::Hidden;
+    }
+    return visibility == AnimationRegionVisibility::Visible;
+}
+
+static void map_animation_invalidate_tile(const CoordsXYRangedZ& tilePos)
+{
+    if (_isCurrentAnimationVisible)
+    {
+        map_invalidate_tile_zoom1(tilePos);
+    }
+}
+
 void map_animation_invalidate_all()
 {
-    auto it = _mapAnimations.begin();
-    while (it != _mapAnimations.end())
+    // Viewports may have moved since the last tick
+    _animationRegionVisibility.fill(AnimationRegionVisibility::Unknown);
+
+    // Finished animations are replaced by the last one, which is then updated in their place. Every animation only
+    // affects its own tile, so the order they are updated in does not change the outcome.
+    size_t i = 0;
+    while (i < _mapAnimations.size())
     {
-        if (InvalidateMapAnimation(*it))
+        auto& animation = _mapAnimations[i];
+        if (InvalidateMapAnimation(animation))
         {
             // Map animation has finished, remove it
-            it = _mapAnimations.erase(it);
+            _mapAnimationKeys.erase(GetMapAnimationKey(animation.type, animation.location));
+            animation = _mapAnimations.back();
+            _mapAnimations.pop_back();
         }
         else
         {
-            it++;
+            i++;
         }
     }
 }
@@ -110,7 +181,7 @@ static bool map_animation_invalidate_ride_entrance(const CoordsXYZ& loc)
             if (stationObj != nullptr)
             {
                 int32_t height = loc.z + stationObj->Height + 8;
-                map_invalidate_tile_zoom1({ loc, height, height + 16 });
+                map_animation_invalidate_tile({ loc, height, height + 16 });
             }
         }
         return false;
@@ -145,7 +216,7 @@ static bool map_animation_invalidate_queue_banner(const CoordsXYZ& loc)
         int32_t direction = (tileElement->AsPath()->GetQueueBannerDirection() + get_current_rotation()) & 3;
         if (direction == TILE_ELEMENT_DIRECTION_NORTH || direction == TILE_ELEMENT_DIRECTION_EAST)
         {
-            map_invalidate_tile_zoom1({ loc, loc.z + 16, loc.z + 30 });
+            map_animation_invalidate_tile({ loc, loc.z + 16, loc.z + 30 });
         }
         return false;
     } while (!(tileElement++)->IsLastForTile());
@@ -182,7 +253,7 @@ static bool map_animation_invalidate_small_scenery(const CoordsXYZ& loc)
                 SMALL_SCENERY_FLAG_FOUNTAIN_SPRAY_1 | SMALL_SCENERY_FLAG_FOUNTAIN_SPRAY_4 | SMALL_SCENERY_FLAG_SWAMP_GOO
                     | SMALL_SCENERY_FLAG_HAS_FRAME_OFFSETS))
         {
-            map_invalidate_tile_zoom1({ loc, loc.z, tileElement->GetClearanceZ() });
+            map_animation_invalidate_tile({ loc, loc.z, tileElement->GetClearanceZ() });
             return false;
         }
 
@@ -210,7 +281,7 @@ static bool map_animation_invalidate_small_scenery(const CoordsXYZ& loc)
                     break;
                 }
             }
-            map_invalidate_tile_zoom1({ loc, loc.z, tileElement->GetClearanceZ() });
+            map_animation_invalidate_tile({ loc, loc.z, tileElement->GetClearanceZ() });
             return false;
         }
 
@@ -241,7 +312,7 @@ static bool map_animation_invalidate_park_entrance(const CoordsXYZ& loc)
         if (tileElement->AsEntrance()->GetSequenceIndex())
             continue;
 
-        map_invalidate_tile_zoom1({ loc, loc.z + 32, loc.z + 64 });
+        map_animation_invalidate_tile({ loc, loc.z + 32, loc.z + 64 });
         return false;
     } while (!(tileElement++)->IsLastForTile());
 
@@ -269,7 +340,7 @@ static bool map_animation_invalidate_track_waterfall(const CoordsXYZ& loc)
 
         if (tileElement->AsTrack()->GetTrackType() == TrackElemType::Waterfall)
         {
-            map_invalidate_tile_zoom1({ loc, loc.z + 14, loc.z + 46 });
+            map_animation_invalidate_tile({ loc, loc.z + 14, loc.z + 46 });
             return false;
         }
     } while (!(tileElement++)->IsLastForTile());
@@ -298,7 +369,7 @@ static bool map_animation_invalidate_track_rapids(const CoordsXYZ& loc)
 
         if (tileElement->AsTrack()->GetTrackType() == TrackElemType::Rapids)
         {
-            map_invalidate_tile_zoom1({ loc, loc.z + 14, loc.z + 18 });
+            map_animation_invalidate_tile({ loc, loc.z + 14, loc.z + 18 });
             return false;
         }
     } while (!(tileElement++)->IsLastForTile());
@@ -327,7 +398,7 @@ static bool map_animation_invalidate_track_onridephoto(const CoordsXYZ& loc)
 
         if (tileElement->AsTrack()->GetTrackType() == TrackElemType::OnRidePhoto)
         {
-            map_invalidate_tile_zoom1({ loc, loc.z, tileElement->GetClearanceZ() });
+            map_animation_invalidate_tile({ loc, loc.z, tileElement->GetClearanceZ() });
             if (game_is_paused())
             {
                 return false;
@@ -368,7 +439,7 @@ static bool map_animation_invalidate_track_whirlpool(const CoordsXYZ& loc)
 
         if (tileElement->AsTrack()->GetTrackType() == TrackElemType::Whirlpool)
         {
-            map_invalidate_tile_zoom1({ loc, loc.z + 14, loc.z + 18 });
+            map_animation_invalidate_tile({ loc, loc.z + 14, loc.z + 18 });
             return false;
         }
     } while (!(tileElement++)->IsLastForTile());
@@ -397,7 +468,7 @@ static bool map_animation_invalidate_track_spinningtunnel(const CoordsXYZ& loc)
 
         if (tileElement->AsTrack()->GetTrackType() == TrackElemType::SpinningTunnel)
         {
-            map_invalidate_tile_zoom1({ loc, loc.z + 14, loc.z + 32 });
+            map_animation_invalidate_tile({ loc, loc.z + 14, loc.z + 32 });
             return false;
         }
     } while (!(tileElement++)->IsLastForTile());
@@ -432,7 +503,7 @@ static bool map_animation_invalidate_banner(const CoordsXYZ& loc)
             continue;
         if (tileElement->GetType() != TILE_ELEMENT_TYPE_BANNER)
             continue;
-        map_invalidate_tile_zoom1({ loc, loc.z, loc.z + 16 });
+        map_animation_invalidate_tile({ loc, loc.z, loc.z + 16 });
         return false;
     } while (!(tileElement++)->IsLastForTile());
 
@@ -462,7 +533,7 @@ static bool map_animation_invalidate_large_scenery(const CoordsXYZ& loc)
         auto* sceneryEntry = tileElement->AsLargeScenery()->GetEntry();
         if (sceneryEntry->flags & LARGE_SCENERY_FLAG_ANIMATED)
         {
-            map_invalidate_tile_zoom1({ loc, loc.z, loc.z + 16 });
+            map_animation_invalidate_tile({ loc, loc.z, loc.z + 16 });
             wasInvalidated = true;
         }
     } while (!(tileElement++)->IsLastForTile());
@@ -527,7 +598,7 @@ static bool map_animation_invalidate_wall_door(const CoordsXYZ& loc)
         tileElement->AsWall()->SetAnimationFrame(currentFrame);
         if (invalidate)
         {
-            map_invalidate_tile_zoom1({ loc, loc.z, loc.z + 32 });
+            map_animation_invalidate_tile({ loc, loc.z, loc.z + 32 });
         }
     } while (!(tileElement++)->IsLastForTile());
 
@@ -560,7 +631,7 @@ static bool map_animation_invalidate_wall(const CoordsXYZ& loc)
             || (!(wallEntry->flags2 & WALL_SCENERY_2_ANIMATED) && wallEntry->scrolling_mode == SCROLLING_MODE_NONE))
             continue;
 
-        map_invalidate_tile_zoom1({ loc, loc.z, loc.z + 16 });
+        map_animation_invalidate_tile({ loc, loc.z, loc.z + 16 });
         wasInvalidated = true;
     } while (!(tileElement++)->IsLastForTile());
 
@@ -595,6 +666,7 @@ static bool InvalidateMapAnimation(const MapAnimation& a)
 {
     if (a.type < std::size(_animatedObjectEventHandlers))
     {
+        _isCurrentAnimationVisible = !gOpenRCT2Headless && IsAnimationRegionVisible(a.location);
         return _animatedObjectEventHandlers[a.type](a.location);
     }
     return true;
@@ -608,6 +680,7 @@ const std::vector<MapAnimation>& GetMapAnimations()
 static void ClearMapAnimations()
 {
     _mapAnimations.clear();
+    _mapAnimationKeys.clear();
 }
 
 void AutoCreateMapAnimations()
@@ -15,6 +15,7 @@
 #include "../core/Guard.hpp"
 #include "../core/Imaging.h"
 #include "../core/String.hpp"
+#include "../core/TaskScheduler.h"
 #include "../localisation/Localisation.h"
 #include "../localisation/StringIds.h"
 #include "../object/Object.h"
@@ -33,6 +34,7 @@
 #include <cmath>
 #include <cstring>
 #include <iterator>
+#include <random>
 #include <vector>
 
 #pragma region Height map struct
@@ -88,6 +90,15 @@ static constexpr const char* SnowTrees[] = {
 static constexpr const std::string_view BaseTerrain[] = { "rct2.surface.grass", "rct2.surface.sand", "rct2.surface.sandbrown",
                                                           "rct2.surface.dirt", "rct2.surface.ice" };
 
+static constexpr int32_t MapGenTreeChunkSize = 32;
+
+struct MapGenTree
+{
+    TileCoordsXY Location;
+    int32_t Type;
+    uint8_t Direction;
+};
+
 static void mapgen_place_trees();
 static void mapgen_set_water_level(int32_t waterLevel);
 static void mapgen_smooth_height(int32_t iterations);
@@ -233,7 +244,7 @@ void mapgen_generate(mapgen_settings* settings)
         mapgen_place_trees();
 }
 
-static void mapgen_place_tree(int32_t type, const CoordsXY& loc)
+static void mapgen_place_tree(int32_t type, const CoordsXY& loc, uint8_t direction)
 {
     auto* sceneryEntry = get_small_scenery_entry(type);
     if (sceneryEntry == nullptr)
@@ -247,7 +258,7 @@ static void mapgen_place_tree(int32_t type, const CoordsXY& loc)
     Guard::Assert(sceneryElement != nullptr);
 
     sceneryElement->SetClearanceZ(surfaceZ + sceneryEntry->height);
-    sceneryElement->SetDirection(util_rand() & 3);
+    sceneryElement->SetDirection(direction);
     sceneryElement->SetEntryIndex(type);
     sceneryElement->SetAge(0);
     sceneryElement->SetPrimaryColour(COLOUR_YELLOW);
@@ -323,81 +334,67 @@ static void mapgen_place_trees()
         }
     }
 
-    TileCoordsXY tmp, pos;
-
-    std::vector<TileCoordsXY> availablePositions;
-
-    // Create list of available tiles
-    for (int32_t y = 1; y < gMapSize - 1; y++)
-    {
-        for (int32_t x = 1; x < gMapSize - 1; x++)
+    // Trees are picked per chunk of the map, each from its own random generator seeded by the chunk index. The chunks
+    // can then be processed in parallel while the result only depends on the base seed.
+    const auto baseSeed = util_rand();
+    const float treeToLandRatio = (10 + (util_rand() % 30)) / 100.0f;
+    const int32_t numChunks = (gMapSize + MapGenTreeChunkSize - 1) / MapGenTreeChunkSize;
+
+    std::vector<std::vector<MapGenTree>> chunkTrees(numChunks * numChunks);
+    auto pickChunkTrees = [&](size_t chunkIndex) {
+        const auto chunkX = static_cast<int32_t>(chunkIndex % numChunks) * MapGenTreeChunkSize;
+        const auto chunkY = static_cast<int32_t>(chunkIndex / numChunks) * MapGenTreeChunkSize;
+        std::mt19937 random(baseSeed + static_cast<uint32_t>(chunkIndex) * 0x9E3779B9);
+        std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+        auto& trees = chunkTrees[chunkIndex];
+
+        for (int32_t y = std::max(chunkY, 1); y < std::min(chunkY + MapGenTreeChunkSize, gMapSize - 1); y++)
         {
-            auto* surfaceElement = map_get_surface_element_at(TileCoordsXY{ x, y }.ToCoordsXY());
-            if (surfaceElement == nullptr)
-                continue;
-
-            // Exclude water tiles
-            if (surfaceElement->GetWaterHeight() > 0)
-                continue;
-
-            pos.x = x;
-            pos.y = y;
-            availablePositions.push_back(pos);
-        }
-    }
-
-    // Shuffle list
-    for (uint32_t i = 0; i < availablePositions.size(); i++)
-    {
-        uint32_t rindex = util_rand() % availablePositions.size();
-        if (rindex == i)
-            continue;
-
-        tmp = availablePositions[i];
-        availablePositions[i] = availablePositions[rindex];
-        availablePositions[rindex] = tmp;
-    }
+            for (int32_t x = std::max(chunkX, 1); x < std::min(chunkX + MapGenTreeChunkSize, gMapSize - 1); x++)
+            {
+                auto* surfaceElement = map_get_surface_element_at(TileCoordsXY{ x, y }.ToCoordsXY());
+                // Exclude water tiles
+                if (surfaceElement == nullptr || surfaceElement->GetWaterHeight() > 0)
+                    continue;
 
-    // Place trees
-    float treeToLandRatio = (10 + (util_rand() % 30)) / 100.0f;
-    int32_t numTrees = std::min(
-        std::max(4, static_cast<int32_t>(availablePositions.size() * treeToLandRatio)),
-        static_cast<int32_t>(availablePositions.size()));
+                if (chance(random) >= treeToLandRatio)
+                    continue;
 
-    for (int32_t i = 0; i < numTrees; i++)
-    {
-        pos = availablePositions[i];
+                const auto* object = TerrainSurfaceObject::GetById(surfaceElement->GetSurfaceStyle());
+                if (object == nullptr)
+                    continue;
 
-        int32_t type = -1;
-        auto* surfaceElement = map_get_surface_element_at(pos.ToCoordsXY());
-        if (surfaceElement == nullptr)
-            continue;
-        const auto* object = TerrainSurfaceObject::GetById(surfaceElement->GetSurfaceStyle());
-        if (MapGenSurfaceTakesGrassTrees(*object))
-        {
-            if (grassTreeIds.empty())
-                break;
+                int32_t type = -1;
+                if (MapGenSurfaceTakesGrassTrees(*object))
+                {
+                    if (!grassTreeIds.empty())
+                        type = grassTreeIds[random() % grassTreeIds.size()];
+                }
+                else if (MapGenSurfaceTakesSandTrees(*object))
+                {
+                    if (!desertTreeIds.empty() && random() % 4 == 0)
+                        type = desertTreeIds[random() % desertTreeIds.size()];
+                }
+                else if (MapGenSurfaceTakesSnowTrees(*object))
+                {
+                    if (!snowTreeIds.empty())
+                        type = snowTreeIds[random() % snowTreeIds.size()];
+                }
 
-            type = grassTreeIds[util_rand() % grassTreeIds.size()];
+                if (type != -1)
+                    trees.push_back({ TileCoordsXY{ x, y }, type, static_cast<uint8_t>(random() & 3) });
+            }
         }
-        else if (MapGenSurfaceTakesSandTrees(*object))
-        {
-            if (desertTreeIds.empty())
-                break;
+    };
+    OpenRCT2::TaskScheduler::Get().ParallelFor(0, chunkTrees.size(), 1, pickChunkTrees);
 
-            if (util_rand() % 4 == 0)
-                type = desertTreeIds[util_rand() % desertTreeIds.size()];
-        }
-        else if (MapGenSurfaceTakesSnowTrees(*object))
+    // Inserting tile elements can move the element storage, so this part stays on a single thread.
+    for (const auto& trees : chunkTrees)
+    {
+        for (const auto& tree : trees)
         {
-            if (snowTreeIds.empty())
-                break;
-
-            type = snowTreeIds[util_rand() % snowTreeIds.size()];
+            mapgen_place_tree(tree.Type, tree.Location.ToCoordsXY(), tree.Direction);
         }
-
-        if (type != -1)
-            mapgen_place_tree(type, pos.ToCoordsXY());
     }
 }
 
@@ -426,32 +423,34 @@ static void mapgen_set_water_level(int32_t waterLevel)
  */
 static void mapgen_smooth_height(int32_t iterations)
 {
-    int32_t i, x, y, xx, yy, avg;
-    int32_t arraySize = _heightSize * _heightSize * sizeof(uint8_t);
-    uint8_t* copyHeight = new uint8_t[arraySize];
+    const size_t heightSize = _heightSize;
+    std::vector<uint8_t> copyHeight(heightSize * heightSize);
 
-    for (i = 0; i < iterations; i++)
+    for (int32_t i = 0; i < iterations; i++)
     {
-        std::memcpy(copyHeight, _height, arraySize);
-        for (y = 1; y < _heightSize - 1; y++)
-        {
-            for (x = 1; x < _heightSize - 1; x++)
+        std::copy_n(_height, copyHeight.size(), copyHeight.begin());
+
+        // Every row only reads the copy, so the rows can be averaged independently. The 3x3 box is summed as three
+        // columns first, which keeps the inner loops simple enough for the compiler to vectorise.
+        OpenRCT2::TaskScheduler::Get().ParallelFor(1, heightSize - 1, 16, [&copyHeight, heightSize](size_t y) {
+            const uint8_t* above = &copyHeight[(y - 1) * heightSize];
+            const uint8_t* row = &copyHeight[y * heightSize];
+            const uint8_t* below = &copyHeight[(y + 1) * heightSize];
+
+            thread_local std::vector<uint16_t> columnSums;
+            columnSums.resize(heightSize);
+            for (size_t x = 0; x < heightSize; x++)
             {
-                avg = 0;
-                for (yy = -1; yy <= 1; yy++)
-                {
-                    for (xx = -1; xx <= 1; xx++)
-                    {
-                        avg += copyHeight[(y + yy) * _heightSize + (x + xx)];
-                    }
-                }
-                avg /= 9;
-                set_height(x, y, avg);
+                columnSums[x] = above[x] + row[x] + below[x];
             }
-        }
-    }
 
-    delete[] copyHeight;
+            uint8_t* dst = &_height[y * heightSize];
+            for (size_t x = 1; x < heightSize - 1; x++)
+            {
+                dst[x] = static_cast<uint8_t>((columnSums[x - 1] + columnSums[x] + columnSums[x + 1]) / 9);
+            }
+        });
+    }
 }
 
 /**
@@ -635,8 +634,6 @@ static float grad(int32_t hash, float x, float y)
 
 static void mapgen_simplex(mapgen_settings* settings)
 {
-    int32_t x, y;
-
     float freq = settings->simplex_base_freq * (1.0f / _heightSize);
     int32_t octaves = settings->simplex_octaves;
 
@@ -644,16 +641,18 @@ static void mapgen_simplex(mapgen_settings* settings)
     int32_t high = settings->simplex_high;
 
     noise_rand();
-    for (y = 0; y < _heightSize; y++)
-    {
-        for (x = 0; x < _heightSize; x++)
+
+    // The permutation table is only read from here on, so every row of noise can be generated on its own.
+    OpenRCT2::TaskScheduler::Get().ParallelFor(0, _heightSize, 8, [=](size_t row) {
+        const auto y = static_cast<int32_t>(row);
+        for (int32_t x = 0; x < _heightSize; x++)
         {
             float noiseValue = std::clamp(fractal_noise(x, y, freq, octaves, 2.0f, 0.65f), -1.0f, 1.0f);
             float normalisedNoiseValue = (noiseValue + 1.0f) / 2.0f;
 
             set_height(x, y, low + static_cast<int32_t>(normalisedNoiseValue * high));
         }
-    }
+    });
 }
 
 #pragma endregion
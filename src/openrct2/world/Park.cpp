@@ -43,6 +43,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <optional>
 
 using namespace OpenRCT2;
 
@@ -310,10 +311,17 @@ void Park::Initialise()
 
 void Park::Update(const Date& date)
 {
+    // The rating and the weekly histories share one pass over the guests
+    std::optional<ParkGuestStatistics> guestStatistics;
+    if (gCurrentTicks % 512 == 0 || date.IsWeekStart())
+    {
+        guestStatistics = park_get_guest_statistics();
+    }
+
     // Every ~13 seconds
     if (gCurrentTicks % 512 == 0)
     {
-        gParkRating = CalculateParkRating();
+        gParkRating = CalculateParkRating(*guestStatistics);
         gParkValue = CalculateParkValue();
         gCompanyValue = CalculateCompanyValue();
         gTotalRideValueForMoney = CalculateTotalRideValueForMoney();
@@ -333,7 +341,7 @@ void Park::Update(const Date& date)
     // Every new week
     if (date.IsWeekStart())
     {
-        UpdateHistories();
+        UpdateHistories(*guestStatistics);
     }
     GenerateGuests();
 }
@@ -364,6 +372,11 @@ int32_t Park::CalculateParkSize() const
 }
 
 int32_t Park::CalculateParkRating() const
+{
+    return CalculateParkRating(park_get_guest_statistics());
+}
+
+int32_t Park::CalculateParkRating(const ParkGuestStatistics& guestStatistics) const
 {
     if (_forcedParkRating >= 0)
     {
@@ -381,23 +394,9 @@ int32_t Park::CalculateParkRating() const
         // -150 to +3 based on a range of guests from 0 to 2000
         result -= 150 - (std::min<int16_t>(2000, gNumGuestsInPark) / 13);
 
-        // Find the number of happy peeps and the number of peeps who can't find the park exit
-        uint32_t happyGuestCount = 0;
-        uint32_t lostGuestCount = 0;
-        for (auto peep : EntityList<Guest>())
-        {
-            if (!peep->OutsideOfPark)
-            {
-                if (peep->Happiness > 128)
-                {
-                    happyGuestCount++;
-                }
-                if ((peep->PeepFlags & PEEP_FLAGS_LEAVING_PARK) && (peep->GuestIsLostCountdown < 90))
-                {
-                    lostGuestCount++;
-                }
-            }
-        }
+        // The number of happy peeps and the number of peeps who can't find the park exit
+        const auto happyGuestCount = guestStatistics.HappyGuests;
+        const auto lostGuestCount = guestStatistics.LostGuests;
 
         // Peep happiness -500 to +0
         result -= 500;
@@ -734,10 +733,7 @@ Guest* Park::GenerateGuest()
 
 template<typename T, size_t TSize> static void HistoryPushRecord(T history[TSize], T newItem)
 {
-    for (size_t i = TSize - 1; i > 0; i--)
-    {
-        history[i] = history[i - 1];
-    }
+    std::copy_backward(history, history + TSize - 1, history + TSize);
     history[0] = newItem;
 }
 
@@ -750,7 +746,7 @@ void Park::ResetHistories()
     }
 }
 
-void Park::UpdateHistories()
+void Park::UpdateHistories(const ParkGuestStatistics& guestStatistics)
 {
     uint8_t guestChangeModifier = 1;
     int32_t changeInGuestsInPark = static_cast<int32_t>(gNumGuestsInPark) - static_cast<int32_t>(gNumGuestsInParkLastWeek);
@@ -766,7 +762,7 @@ void Park::UpdateHistories()
     gNumGuestsInParkLastWeek = gNumGuestsInPark;
 
     // Update park rating, guests in park and current cash history
-    HistoryPushRecord<uint8_t, 32>(gParkRatingHistory, CalculateParkRating() / 4);
+    HistoryPushRecord<uint8_t, 32>(gParkRatingHistory, CalculateParkRating(guestStatistics) / 4);
     HistoryPushRecord<uint8_t, 32>(gGuestsInParkHistory, std::min<uint16_t>(gNumGuestsInPark, 5000) / 20);
     HistoryPushRecord<money64, std::size(gCashHistory)>(gCashHistory, finance_get_current_cash() - gBankLoan);
 
@@ -795,6 +791,63 @@ int32_t park_is_open()
     return GetContext()->GetGameState()->GetPark().IsOpen();
 }
 
+ParkGuestStatistics park_get_guest_statistics()
+{
+    ParkGuestStatistics stats;
+    for (auto guest : EntityList<Guest>())
+    {
+        if (guest->FavouriteRide < MAX_RIDES)
+        {
+            stats.GuestsFavouriteRide[guest->FavouriteRide]++;
+        }
+
+        if (guest->OutsideOfPark)
+            continue;
+
+        stats.GuestsInPark++;
+        if (guest->Happiness > 128)
+        {
+            stats.HappyGuests++;
+        }
+        if ((guest->PeepFlags & PEEP_FLAGS_LEAVING_PARK) && (guest->GuestIsLostCountdown < 90))
+        {
+            stats.LostGuests++;
+        }
+
+        const auto& thought = guest->Thoughts[0];
+        if (thought.freshness > 5)
+            continue;
+
+        stats.FreshThoughts[static_cast<size_t>(thought.type)]++;
+
+        // Guests already heading for a ride that helps them are not counted towards the warnings
+        auto isNotHeadingForRideWith = [guest](uint64_t rideTypeFlag) {
+            if (guest->GuestHeadingToRideId == RIDE_ID_NULL)
+                return true;
+            auto ride = get_ride(guest->GuestHeadingToRideId);
+            return ride != nullptr && !ride->GetRideTypeDescriptor().HasFlag(rideTypeFlag);
+        };
+        switch (thought.type)
+        {
+            case PeepThoughtType::Hungry:
+                if (isNotHeadingForRideWith(RIDE_TYPE_FLAG_FLAT_RIDE))
+                    stats.HungryGuestsNotHeadingForFood++;
+                break;
+            case PeepThoughtType::Thirsty:
+                if (isNotHeadingForRideWith(RIDE_TYPE_FLAG_SELLS_DRINKS))
+                    stats.ThirstyGuestsNotHeadingForDrinks++;
+                break;
+            case PeepThoughtType::Toilet:
+                if (isNotHeadingForRideWith(RIDE_TYPE_FLAG_IS_TOILET))
+                    stats.GuestsNotHeadingForToilet++;
+                break;
+            default:
+                break;
+        }
+    }
+    return stats;
+}
+
 int32_t park_calculate_size()
 {
     auto tiles = GetContext()->GetGameState()->GetPark().CalculateParkSize();
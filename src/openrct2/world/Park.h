@@ -13,6 +13,8 @@
 #include "../ride/Ride.h"
 #include "Map.h"
 
+#include <array>
+
 #define DECRYPT_MONEY(money) (static_cast<money32>(rol32((money) ^ 0xF4EC9621, 13)))
 #define ENCRYPT_MONEY(money) (static_cast<money32>(ror32((money), 13) ^ 0xF4EC9621))
 
@@ -44,6 +46,33 @@ enum : uint32_t
 struct Guest;
 struct rct_ride;
 
+/**
+ * Guest counts used by the park rating, the guest warnings, the awards and the ride favourite statistic, gathered in a
+ * single pass over the guests so the checks that run on the same tick do not each walk all guests.
+ */
+struct ParkGuestStatistics
+{
+    uint32_t GuestsInPark{};
+    uint32_t HappyGuests{};
+    uint32_t LostGuests{};
+
+    // Guests in the park by the type of their latest thought, if that thought is still fresh
+    std::array<uint32_t, 256> FreshThoughts{};
+
+    // Fresh hungry, thirsty and toilet thoughts of guests that are not already heading for a ride that helps them
+    uint32_t HungryGuestsNotHeadingForFood{};
+    uint32_t ThirstyGuestsNotHeadingForDrinks{};
+    uint32_t GuestsNotHeadingForToilet{};
+
+    // All guests, including those outside the park, by favourite ride
+    std::array<uint32_t, MAX_RIDES> GuestsFavouriteRide{};
+
+    uint32_t GetFreshThoughtCount(PeepThoughtType type) const
+    {
+        return FreshThoughts[static_cast<size_t>(type)];
+    }
+};
+
 namespace OpenRCT2
 {
     class Date;
@@ -67,6 +96,7 @@ namespace OpenRCT2
 
         int32_t CalculateParkSize() const;
         int32_t CalculateParkRating() const;
+        int32_t CalculateParkRating(const ParkGuestStatistics& guestStatistics) const;
         money64 CalculateParkValue() const;
         money64 CalculateCompanyValue() const;
         static uint8_t CalculateGuestInitialHappiness(uint8_t percentage);
@@ -74,7 +104,7 @@ namespace OpenRCT2
         Guest* GenerateGuest();
 
         void ResetHistories();
-        void UpdateHistories();
+        void UpdateHistories(const ParkGuestStatistics& guestStatistics);
 
     private:
         money64 CalculateRideValue(const Ride* ride) const;
@@ -110,6 +140,7 @@ void set_forced_park_rating(int32_t rating);
 int32_t get_forced_park_rating();
 
 int32_t park_is_open();
+ParkGuestStatistics park_get_guest_statistics();
 int32_t park_calculate_size();
 
 void update_park_fences(const CoordsXY& coords);
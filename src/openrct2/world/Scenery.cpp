@@ -231,50 +231,23 @@ void scenery_remove_ghost_tool_placement()
 
 WallSceneryEntry* get_wall_entry(ObjectEntryIndex entryIndex)
 {
-    WallSceneryEntry* result = nullptr;
-    auto& objMgr = OpenRCT2::GetContext()->GetObjectManager();
-    auto obj = objMgr.GetLoadedObject(ObjectType::Walls, entryIndex);
-    if (obj != nullptr)
-    {
-        result = static_cast<WallSceneryEntry*>(obj->GetLegacyData());
-    }
-    return result;
+    return static_cast<WallSceneryEntry*>(object_manager_get_loaded_object_legacy_data(ObjectType::Walls, entryIndex));
 }
 
 BannerSceneryEntry* get_banner_entry(ObjectEntryIndex entryIndex)
 {
-    BannerSceneryEntry* result = nullptr;
-    auto& objMgr = OpenRCT2::GetContext()->GetObjectManager();
-    auto obj = objMgr.GetLoadedObject(ObjectType::Banners, entryIndex);
-    if (obj != nullptr)
-    {
-        result = static_cast<BannerSceneryEntry*>(obj->GetLegacyData());
-    }
-    return result;
+    return static_cast<BannerSceneryEntry*>(object_manager_get_loaded_object_legacy_data(ObjectType::Banners, entryIndex));
 }
 
 PathBitEntry* get_footpath_item_entry(ObjectEntryIndex entryIndex)
 {
-    PathBitEntry* result = nullptr;
-    auto& objMgr = OpenRCT2::GetContext()->GetObjectManager();
-    auto obj = objMgr.GetLoadedObject(ObjectType::PathBits, entryIndex);
-    if (obj != nullptr)
-    {
-        result = static_cast<PathBitEntry*>(obj->GetLegacyData());
-    }
-    return result;
+    return static_cast<PathBitEntry*>(object_manager_get_loaded_object_legacy_data(ObjectType::PathBits, entryIndex));
 }
 
 rct_scenery_group_entry* get_scenery_group_entry(ObjectEntryIndex entryIndex)
 {
-    rct_scenery_group_entry* result = nullptr;
-    auto& objMgr = OpenRCT2::GetContext()->GetObjectManager();
-    auto obj = objMgr.GetLoadedObject(ObjectType::SceneryGroup, entryIndex);
-    if (obj != nullptr)
-    {
-        result = static_cast<rct_scenery_group_entry*>(obj->GetLegacyData());
-    }
-    return result;
+    return static_cast<rct_scenery_group_entry*>(
+        object_manager_get_loaded_object_legacy_data(ObjectType::SceneryGroup, entryIndex));
 }
 
 int32_t wall_entry_get_door_sound(const WallSceneryEntry* wallEntry)
@@ -175,12 +175,5 @@ SmallSceneryEntry* SmallSceneryElement::GetEntry() const
 
 SmallSceneryEntry* get_small_scenery_entry(ObjectEntryIndex entryIndex)
 {
-    SmallSceneryEntry* result = nullptr;
-    auto& objMgr = OpenRCT2::GetContext()->GetObjectManager();
-    auto obj = objMgr.GetLoadedObject(ObjectType::SmallScenery, entryIndex);
-    if (obj != nullptr)
-    {
-        result = static_cast<SmallSceneryEntry*>(obj->GetLegacyData());
-    }
-    return result;
+    return static_cast<SmallSceneryEntry*>(object_manager_get_loaded_object_legacy_data(ObjectType::SmallScenery, entryIndex));
 }
@@ -14,6 +14,7 @@
 #include "../core/Crypt.h"
 #include "../core/DataSerialiser.h"
 #include "../core/Guard.hpp"
+#include "../core/TaskScheduler.h"
 #include "../core/MemoryStream.h"
 #include "../interface/Viewport.h"
 #include "../peep/Peep.h"
@@ -27,21 +28,41 @@
 #include "Particle.h"
 
 #include <algorithm>
+#include <cinttypes>
 #include <cmath>
+#include <cstring>
 #include <iterator>
+#include <limits>
 #include <numeric>
 #include <vector>
 
 static rct_sprite _spriteList[MAX_ENTITIES];
-static std::array<std::list<uint16_t>, EnumValue(EntityType::Count)> gEntityLists;
+// Dense copy of each entity's type, typed lookups and list walks check this instead of loading the entity record.
+static std::array<EntityType, MAX_ENTITIES> _spriteTypes;
+static std::array<EntityIndexList, EnumValue(EntityType::Count)> gEntityLists;
 static std::vector<uint16_t> _freeIdList;
 
 static bool _spriteFlashingList[MAX_ENTITIES];
 
 constexpr const uint32_t SPATIAL_INDEX_SIZE = (MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL) + 1;
 constexpr const uint32_t SPATIAL_INDEX_LOCATION_NULL = SPATIAL_INDEX_SIZE - 1;
+constexpr const uint32_t SPATIAL_INDEX_NOT_INSERTED = std::numeric_limits<uint32_t>::max();
 
-static std::array<std::vector<uint16_t>, SPATIAL_INDEX_SIZE> gSpriteSpatialIndex;
+/**
+ * Links of the intrusive per tile entity lists, indexed by sprite_index. Each list is doubly linked and kept in
+ * sprite_index order, the tile is stored so that removing an entity does not depend on its current coordinates.
+ */
+struct SpatialIndexLink
+{
+    uint32_t Tile = SPATIAL_INDEX_NOT_INSERTED;
+    uint16_t Prev = SPRITE_INDEX_NULL;
+    uint16_t Next = SPRITE_INDEX_NULL;
+};
+
+static std::array<uint16_t, SPATIAL_INDEX_SIZE> _spatialIndexHeads;
+// Last entity of each tile list, new entities usually have the highest index on their tile and are appended directly.
+static std::array<uint16_t, SPATIAL_INDEX_SIZE> _spatialIndexTails;
+static std::array<SpatialIndexLink, MAX_ENTITIES> _spatialIndexLinks;
 
 constexpr size_t GetSpatialIndexOffset(int32_t x, int32_t y)
 {
@@ -56,7 +77,7 @@ constexpr size_t GetSpatialIndexOffset(int32_t x, int32_t y)
         index = (flooredX << 3) | tileY;
     }
 
-    if (index >= sizeof(gSpriteSpatialIndex))
+    if (index >= SPATIAL_INDEX_SIZE)
     {
         return SPATIAL_INDEX_LOCATION_NULL;
     }
@@ -138,6 +159,11 @@ std::string rct_sprite_checksum::ToString() const
     return result;
 }
 
+EntityType GetEntityType(size_t spriteIndex)
+{
+    return spriteIndex >= MAX_ENTITIES ? EntityType::Null : _spriteTypes[spriteIndex];
+}
+
 SpriteBase* try_get_sprite(size_t spriteIndex)
 {
     return spriteIndex >= MAX_ENTITIES ? nullptr : &_spriteList[spriteIndex].base;
@@ -153,18 +179,31 @@ SpriteBase* get_sprite(size_t spriteIndex)
     return try_get_sprite(spriteIndex);
 }
 
-const std::vector<uint16_t>& GetEntityTileList(const CoordsXY& spritePos)
+size_t GetEntityTileIndex(const CoordsXY& spritePos)
 {
-    return gSpriteSpatialIndex[GetSpatialIndexOffset(spritePos.x, spritePos.y)];
+    return GetSpatialIndexOffset(spritePos.x, spritePos.y);
 }
 
-void SpriteBase::Invalidate()
+uint16_t GetFirstEntityOnTile(size_t tileIndex)
 {
-    if (sprite_left == LOCATION_NULL)
-        return;
+    return tileIndex < SPATIAL_INDEX_SIZE ? _spatialIndexHeads[tileIndex] : SPRITE_INDEX_NULL;
+}
+
+uint16_t GetNextEntityOnTile(size_t tileIndex, uint16_t spriteIndex)
+{
+    if (spriteIndex >= MAX_ENTITIES)
+        return SPRITE_INDEX_NULL;
+
+    const auto& link = _spatialIndexLinks[spriteIndex];
+    if (link.Tile != tileIndex)
+        return SPRITE_INDEX_NULL;
+    return link.Next;
+}
 
+static int32_t GetInvalidateMaxZoom(EntityType type)
+{
     int32_t maxZoom = 0;
-    switch (Type)
+    switch (type)
     {
         case EntityType::Vehicle:
         case EntityType::Guest:
@@ -192,8 +231,15 @@ void SpriteBase::Invalidate()
         default:
             break;
     }
+    return maxZoom;
+}
+
+void SpriteBase::Invalidate()
+{
+    if (sprite_left == LOCATION_NULL)
+        return;
 
-    viewports_invalidate(sprite_left, sprite_top, sprite_right, sprite_bottom, maxZoom);
+    viewports_invalidate(sprite_left, sprite_top, sprite_right, sprite_bottom, GetInvalidateMaxZoom(Type));
 }
 
 static void ResetEntityLists()
@@ -213,7 +259,7 @@ static void ResetFreeIds()
     std::iota(std::rbegin(_freeIdList), std::rend(_freeIdList), 0);
 }
 
-const std::list<uint16_t>& GetEntityList(const EntityType id)
+const EntityIndexList& GetEntityList(const EntityType id)
 {
     return gEntityLists[EnumValue(id)];
 }
@@ -226,6 +272,7 @@ void reset_sprite_list()
 {
     gSavedAge = 0;
     std::memset(static_cast<void*>(_spriteList), 0, sizeof(_spriteList));
+    _spriteTypes.fill(EntityType::Null);
     for (int32_t i = 0; i < MAX_ENTITIES; ++i)
     {
         auto* spr = GetEntity(i);
@@ -254,20 +301,33 @@ static void SpriteSpatialInsert(SpriteBase* sprite, const CoordsXY& newLoc);
  */
 void reset_sprite_spatial_index()
 {
-    for (auto& vec : gSpriteSpatialIndex)
-    {
-        vec.clear();
-    }
+    _spatialIndexHeads.fill(SPRITE_INDEX_NULL);
+    _spatialIndexTails.fill(SPRITE_INDEX_NULL);
+    _spatialIndexLinks.fill({});
     for (size_t i = 0; i < MAX_ENTITIES; i++)
     {
+        if (_spriteTypes[i] == EntityType::Null)
+            continue;
+
         auto* spr = GetEntity(i);
-        if (spr != nullptr && spr->Type != EntityType::Null)
+        if (spr != nullptr)
         {
             SpriteSpatialInsert(spr, { spr->x, spr->y });
         }
     }
 }
 
+size_t GetEntitiesMemoryUsage()
+{
+    return sizeof(_spriteList) + sizeof(_spriteTypes) + sizeof(gEntityLists) + sizeof(_spriteFlashingList)
+        + _freeIdList.capacity() * sizeof(uint16_t);
+}
+
+size_t GetSpatialIndexMemoryUsage()
+{
+    return sizeof(_spatialIndexHeads) + sizeof(_spatialIndexTails) + sizeof(_spatialIndexLinks);
+}
+
 #ifndef DISABLE_NETWORK
 
 template<typename T> void NetworkSerialseEntityType(DataSerialiser& ds)
@@ -293,6 +353,74 @@ rct_sprite_checksum sprite_checksum()
 
     return checksum;
 }
+
+static constexpr size_t EntityChecksumBucketSize = (MAX_ENTITIES + EntityChecksumTree::BucketCount - 1)
+    / EntityChecksumTree::BucketCount;
+
+uint16_t EntityChecksumTree::GetBucketFirstIndex(size_t bucket)
+{
+    return static_cast<uint16_t>(std::min<size_t>(bucket * EntityChecksumBucketSize, MAX_ENTITIES));
+}
+
+std::string EntityChecksumTree::ToString() const
+{
+    char buf[17];
+    snprintf(buf, sizeof(buf), "%016" PRIx64, Root);
+    return buf;
+}
+
+template<typename T> static bool NetworkSerialiseEntityIfType(DataSerialiser& ds, size_t spriteIndex)
+{
+    auto* ent = TryGetEntity<T>(spriteIndex);
+    if (ent != nullptr)
+    {
+        ent->Serialise(ds);
+        return true;
+    }
+    return false;
+}
+
+template<typename... T> static void NetworkSerialiseEntityOfTypes(DataSerialiser& ds, size_t spriteIndex)
+{
+    (NetworkSerialiseEntityIfType<T>(ds, spriteIndex) || ...);
+}
+
+static uint64_t EntityChecksumBucket(size_t bucket)
+{
+    rct_sprite_checksum checksum{};
+    OpenRCT2::ChecksumStream ms(checksum.raw);
+    DataSerialiser ds(true, ms);
+
+    const size_t end = EntityChecksumTree::GetBucketFirstIndex(bucket + 1);
+    for (size_t i = EntityChecksumTree::GetBucketFirstIndex(bucket); i < end; i++)
+    {
+        NetworkSerialiseEntityOfTypes<Guest, Staff, Vehicle, Litter>(ds, i);
+    }
+
+    uint64_t result;
+    std::memcpy(&result, checksum.raw.data(), sizeof(result));
+    return result;
+}
+
+/**
+ * Unlike sprite_checksum, which replays store, this hashes each bucket on its own so the work can be spread over the
+ * task scheduler.
+ */
+EntityChecksumTree entity_checksum_tree()
+{
+    EntityChecksumTree tree;
+    OpenRCT2::TaskScheduler::Get().ParallelFor(
+        0, tree.Buckets.size(), 1, [&tree](size_t bucket) { tree.Buckets[bucket] = EntityChecksumBucket(bucket); });
+
+    rct_sprite_checksum checksum{};
+    OpenRCT2::ChecksumStream ms(checksum.raw);
+    for (auto bucket : tree.Buckets)
+    {
+        ms.WriteValue(bucket);
+    }
+    std::memcpy(&tree.Root, checksum.raw.data(), sizeof(tree.Root));
+    return tree;
+}
 #else
 
 rct_sprite_checksum sprite_checksum()
@@ -300,6 +428,21 @@ rct_sprite_checksum sprite_checksum()
     return rct_sprite_checksum{};
 }
 
+uint16_t EntityChecksumTree::GetBucketFirstIndex(size_t bucket)
+{
+    return 0;
+}
+
+std::string EntityChecksumTree::ToString() const
+{
+    return {};
+}
+
+EntityChecksumTree entity_checksum_tree()
+{
+    return EntityChecksumTree{};
+}
+
 #endif // DISABLE_NETWORK
 
 static void sprite_reset(SpriteBase* sprite)
@@ -312,14 +455,14 @@ static void sprite_reset(SpriteBase* sprite)
 
     sprite->sprite_index = sprite_index;
     sprite->Type = EntityType::Null;
+    _spriteTypes[sprite_index] = EntityType::Null;
 }
 
 static constexpr uint16_t MAX_MISC_SPRITES = 300;
 static void AddToEntityList(SpriteBase* entity)
 {
-    auto& list = gEntityLists[EnumValue(entity->Type)];
-    // Entity list must be in sprite_index order to prevent desync issues
-    list.insert(std::lower_bound(std::begin(list), std::end(list), entity->sprite_index), entity->sprite_index);
+    // Entity lists always iterate in sprite_index order to prevent desync issues
+    gEntityLists[EnumValue(entity->Type)].insert(entity->sprite_index);
 }
 
 static void AddToFreeList(uint16_t index)
@@ -330,12 +473,7 @@ static void AddToFreeList(uint16_t index)
 
 static void RemoveFromEntityList(SpriteBase* entity)
 {
-    auto& list = gEntityLists[EnumValue(entity->Type)];
-    auto ptr = std::lower_bound(std::begin(list), std::end(list), entity->sprite_index);
-    if (ptr != std::end(list) && *ptr == entity->sprite_index)
-    {
-        list.erase(ptr);
-    }
+    gEntityLists[EnumValue(entity->Type)].erase(entity->sprite_index);
 }
 
 uint16_t GetMiscEntityCount()
@@ -357,6 +495,7 @@ static void PrepareNewEntity(SpriteBase* base, const EntityType type)
     sprite_reset(base);
 
     base->Type = type;
+    _spriteTypes[base->sprite_index] = type;
     AddToEntityList(base);
 
     base->x = LOCATION_NULL;
@@ -449,33 +588,77 @@ void sprite_misc_update_all()
 // Performs a search to ensure that insert keeps next_in_quadrant in sprite_index order
 static void SpriteSpatialInsert(SpriteBase* sprite, const CoordsXY& newLoc)
 {
-    size_t newIndex = GetSpatialIndexOffset(newLoc.x, newLoc.y);
-    auto& spatialVector = gSpriteSpatialIndex[newIndex];
-    auto index = std::lower_bound(std::begin(spatialVector), std::end(spatialVector), sprite->sprite_index);
-    spatialVector.insert(index, sprite->sprite_index);
+    const auto spriteIndex = sprite->sprite_index;
+    const auto newIndex = static_cast<uint32_t>(GetSpatialIndexOffset(newLoc.x, newLoc.y));
+    auto& link = _spatialIndexLinks[spriteIndex];
+
+    uint16_t prev = SPRITE_INDEX_NULL;
+    uint16_t next = _spatialIndexHeads[newIndex];
+    const auto tail = _spatialIndexTails[newIndex];
+    if (tail != SPRITE_INDEX_NULL && tail < spriteIndex)
+    {
+        prev = tail;
+        next = SPRITE_INDEX_NULL;
+    }
+    while (next != SPRITE_INDEX_NULL && next < spriteIndex)
+    {
+        prev = next;
+        next = _spatialIndexLinks[next].Next;
+    }
+
+    link.Tile = newIndex;
+    link.Prev = prev;
+    link.Next = next;
+    if (prev == SPRITE_INDEX_NULL)
+    {
+        _spatialIndexHeads[newIndex] = spriteIndex;
+    }
+    else
+    {
+        _spatialIndexLinks[prev].Next = spriteIndex;
+    }
+    if (next != SPRITE_INDEX_NULL)
+    {
+        _spatialIndexLinks[next].Prev = spriteIndex;
+    }
+    else
+    {
+        _spatialIndexTails[newIndex] = spriteIndex;
+    }
 }
 
 static void SpriteSpatialRemove(SpriteBase* sprite)
 {
-    size_t currentIndex = GetSpatialIndexOffset(sprite->x, sprite->y);
-    auto& spatialVector = gSpriteSpatialIndex[currentIndex];
-    auto index = std::lower_bound(std::begin(spatialVector), std::end(spatialVector), sprite->sprite_index);
-    if (index != std::end(spatialVector) && *index == sprite->sprite_index)
+    auto& link = _spatialIndexLinks[sprite->sprite_index];
+    if (link.Tile == SPATIAL_INDEX_NOT_INSERTED)
     {
-        spatialVector.erase(index, index + 1);
+        log_warning("Sprite %u is not in the spatial index.", sprite->sprite_index);
+        return;
+    }
+
+    if (link.Prev == SPRITE_INDEX_NULL)
+    {
+        _spatialIndexHeads[link.Tile] = link.Next;
     }
     else
     {
-        log_warning("Bad sprite spatial index. Rebuilding the spatial index...");
-        reset_sprite_spatial_index();
+        _spatialIndexLinks[link.Prev].Next = link.Next;
     }
+    if (link.Next != SPRITE_INDEX_NULL)
+    {
+        _spatialIndexLinks[link.Next].Prev = link.Prev;
+    }
+    else
+    {
+        _spatialIndexTails[link.Tile] = link.Prev;
+    }
+    link = {};
 }
 
 static void SpriteSpatialMove(SpriteBase* sprite, const CoordsXY& newLoc)
 {
     size_t newIndex = GetSpatialIndexOffset(newLoc.x, newLoc.y);
-    size_t currentIndex = GetSpatialIndexOffset(sprite->x, sprite->y);
-    if (newIndex == currentIndex)
+    if (newIndex == _spatialIndexLinks[sprite->sprite_index].Tile)
         return;
 
     SpriteSpatialRemove(sprite);
@@ -484,11 +667,13 @@ static void SpriteSpatialMove(SpriteBase* sprite, const CoordsXY& newLoc)
 
 void SpriteBase::MoveTo(const CoordsXYZ& newLocation)
 {
-    if (x != LOCATION_NULL)
-    {
-        // Invalidate old position.
-        Invalidate();
-    }
+    // The old position is invalidated once the new one is known, so both can be invalidated in one go
+    const bool invalidateOld = x != LOCATION_NULL && sprite_left != LOCATION_NULL;
+    const int32_t oldLeft = sprite_left;
+    const int32_t oldTop = sprite_top;
+    const int32_t oldRight = sprite_right;
+    const int32_t oldBottom = sprite_bottom;
+    const auto maxZoom = GetInvalidateMaxZoom(Type);
 
     auto loc = newLocation;
     if (!map_is_location_valid(loc))
@@ -500,6 +685,10 @@ void SpriteBase::MoveTo(const CoordsXYZ& newLocation)
 
     if (loc.x == LOCATION_NULL)
     {
+        if (invalidateOld)
+        {
+            viewports_invalidate(oldLeft, oldTop, oldRight, oldBottom, maxZoom);
+        }
         sprite_left = LOCATION_NULL;
         x = loc.x;
         y = loc.y;
@@ -508,7 +697,24 @@ void SpriteBase::MoveTo(const CoordsXYZ& newLocation)
     else
     {
         sprite_set_coordinates(loc, this);
-        Invalidate(); // Invalidate new position.
+
+        // Most moves are by a few pixels, the bounds of both positions then mark the same dirty blocks as invalidating
+        // them one by one, for half the viewport and paint cache checks.
+        if (invalidateOld && sprite_left != LOCATION_NULL && oldLeft <= sprite_right && sprite_left <= oldRight
+            && oldTop <= sprite_bottom && sprite_top <= oldBottom)
+        {
+            viewports_invalidate(
+                std::min<int32_t>(oldLeft, sprite_left), std::min<int32_t>(oldTop, sprite_top),
+                std::max<int32_t>(oldRight, sprite_right), std::max<int32_t>(oldBottom, sprite_bottom), maxZoom);
+        }
+        else
+        {
+            if (invalidateOld)
+            {
+                viewports_invalidate(oldLeft, oldTop, oldRight, oldBottom, maxZoom);
+            }
+            Invalidate();
+        }
     }
 }
 
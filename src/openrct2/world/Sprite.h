@@ -36,6 +36,22 @@ struct rct_sprite_checksum
 
 #pragma pack(pop)
 
+/**
+ * Checksums of the network relevant entities grouped into buckets of consecutive sprite indices, the root checksum
+ * combines all buckets. Buckets are independent of each other so they are computed in parallel and a mismatch can be
+ * narrowed down to the sprite index range of the differing buckets.
+ */
+struct EntityChecksumTree
+{
+    static constexpr size_t BucketCount = 64;
+
+    std::array<uint64_t, BucketCount> Buckets{};
+    uint64_t Root{};
+
+    static uint16_t GetBucketFirstIndex(size_t bucket);
+    std::string ToString() const;
+};
+
 void reset_sprite_list();
 void reset_sprite_spatial_index();
 void sprite_misc_update_all();
@@ -44,8 +60,12 @@ void sprite_remove(SpriteBase* sprite);
 uint16_t remove_floating_sprites();
 
 rct_sprite_checksum sprite_checksum();
+EntityChecksumTree entity_checksum_tree();
 
 void sprite_set_flashing(SpriteBase* sprite, bool flashing);
 bool sprite_get_flashing(SpriteBase* sprite);
 
+size_t GetEntitiesMemoryUsage();
+size_t GetSpatialIndexMemoryUsage();
+
 #endif
@@ -39,6 +39,12 @@ namespace OpenRCT2
         }
     } // namespace Detail
 
+    /**
+     * Iterates the elements of one tile, optionally only the ones of type T. Tiles hold only a handful of elements, so
+     * the scan is a few byte compares. There is deliberately no cached per tile summary of the element types: elements
+     * are copied, swapped and retyped through raw pointers in many places, and a stale summary would make lookups miss
+     * elements that are there.
+     */
     template<typename T = TileElement> class TileElementsView
     {
         const CoordsXY _loc;
@@ -419,7 +419,7 @@ namespace OpenRCT2::TileInspector
     {
         if (isExecuting)
         {
-            const TileElement* const firstElement = map_get_first_element_at(loc);
+            TileElement* const firstElement = map_get_first_element_at(loc);
             if (firstElement == nullptr)
                 return std::make_unique<GameActions::Result>(GameActions::Status::Unknown, STR_NONE);
 
@@ -431,32 +431,16 @@ namespace OpenRCT2::TileInspector
                 numElement++;
             } while (!(elementIterator++)->IsLastForTile());
 
-            // Bubble sort
-            for (int32_t loopStart = 1; loopStart < numElement; loopStart++)
+            // Sort by base height, then by clearance height. The sort is stable so elements of equal height keep their
+            // order, the same result the previous insertion sort of pairwise swaps gave, without rescanning the tile
+            // for every swap.
+            std::stable_sort(firstElement, firstElement + numElement, [](const TileElement& a, const TileElement& b) {
+                return a.base_height < b.base_height
+                    || (a.base_height == b.base_height && a.clearance_height < b.clearance_height);
+            });
+            for (int32_t i = 0; i < numElement; i++)
             {
-                int32_t currentId = loopStart;
-                const TileElement* currentElement = firstElement + currentId;
-                const TileElement* otherElement = currentElement - 1;
-
-                // While current element's base height is lower, or (when their baseheight is the same) the other map element's
-                // clearance height is lower...
-                while (currentId > 0
-                       && (otherElement->base_height > currentElement->base_height
-                           || (otherElement->base_height == currentElement->base_height
-                               && otherElement->clearance_height > currentElement->clearance_height)))
-                {
-                    if (!SwapTileElements(loc, currentId - 1, currentId))
-                    {
-                        // don't return error here, we've already ran some actions
-                        // and moved things as far as we could, the only sensible
-                        // thing left to do is to invalidate the window.
-                        loopStart = numElement;
-                        break;
-                    }
-                    currentId--;
-                    currentElement--;
-                    otherElement--;
-                }
+                firstElement[i].SetLastForTile(i == numElement - 1);
             }
 
             map_invalidate_tile_full(loc);
@@ -0,0 +1,168 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <openrct2/core/DataSerialiser.h>
+
+using namespace OpenRCT2;
+
+// Forwards everything to a memory stream, so the serialiser does not see a memory stream and uses the traits.
+class ForwardingStream final : public IStream
+{
+public:
+    MemoryStream Inner;
+
+    bool CanRead() const override
+    {
+        return Inner.CanRead();
+    }
+    bool CanWrite() const override
+    {
+        return Inner.CanWrite();
+    }
+    uint64_t GetLength() const override
+    {
+        return Inner.GetLength();
+    }
+    uint64_t GetPosition() const override
+    {
+        return Inner.GetPosition();
+    }
+    void SetPosition(uint64_t position) override
+    {
+        Inner.SetPosition(position);
+    }
+    void Seek(int64_t offset, int32_t origin) override
+    {
+        Inner.Seek(offset, origin);
+    }
+    void Read(void* buffer, uint64_t length) override
+    {
+        Inner.Read(buffer, length);
+    }
+    void Write(const void* buffer, uint64_t length) override
+    {
+        Inner.Write(buffer, length);
+    }
+    uint64_t TryRead(void* buffer, uint64_t length) override
+    {
+        return Inner.TryRead(buffer, length);
+    }
+    const void* GetData() const override
+    {
+        return Inner.GetData();
+    }
+};
+
+enum class TestEnum : uint16_t
+{
+    A = 0x0102,
+    B = 0xA0B0,
+};
+
+struct TestValues
+{
+    uint8_t u8 = 0x12;
+    int8_t i8 = -3;
+    uint16_t u16 = 0x3456;
+    int16_t i16 = -1234;
+    uint32_t u32 = 0x789ABCDE;
+    int32_t i32 = -123456789;
+    uint64_t u64 = 0x0102030405060708;
+    int64_t i64 = -1234567890123;
+    bool flag = true;
+    TestEnum enumValue = TestEnum::B;
+    utf8 text[8] = "park";
+    uint16_t shorts[3] = { 0x0102, 0x0304, 0x0506 };
+    uint32_t ints[2] = { 0x01020304, 0xA0B0C0D0 };
+    std::array<uint8_t, 4> bytes = { 1, 2, 3, 4 };
+    std::array<uint32_t, 3> intArray = { 0x11223344, 0x55667788, 0x99AABBCC };
+    std::array<TestEnum, 2> enums = { TestEnum::A, TestEnum::B };
+
+    void Serialise(DataSerialiser& ds)
+    {
+        ds << u8 << i8 << u16 << i16 << u32 << i32 << u64 << i64 << flag << enumValue;
+        ds << text << shorts << ints << bytes << intArray << enums;
+    }
+};
+
+TEST(DataSerialiserTest, memoryStreamMatchesTraits)
+{
+    TestValues values;
+
+    MemoryStream direct;
+    DataSerialiser directSerialiser(true, direct);
+    values.Serialise(directSerialiser);
+
+    ForwardingStream forwarded;
+    DataSerialiser tracedSerialiser(true, forwarded);
+    values.Serialise(tracedSerialiser);
+
+    ASSERT_EQ(direct.GetLength(), forwarded.Inner.GetLength());
+    ASSERT_EQ(std::memcmp(direct.GetData(), forwarded.Inner.GetData(), direct.GetLength()), 0);
+}
+
+TEST(DataSerialiserTest, memoryStreamRoundTrip)
+{
+    TestValues values;
+    MemoryStream stream;
+    DataSerialiser saver(true, stream);
+    values.Serialise(saver);
+
+    // Read back both through the memory stream and through the traits.
+    TestValues loaded{};
+    std::memset(&loaded, 0, sizeof(loaded));
+    stream.SetPosition(0);
+    DataSerialiser loader(false, stream);
+    loaded.Serialise(loader);
+    ASSERT_EQ(stream.GetPosition(), stream.GetLength());
+
+    ForwardingStream forwarded;
+    forwarded.Inner.Write(stream.GetData(), stream.GetLength());
+    forwarded.SetPosition(0);
+    TestValues tracedLoaded{};
+    std::memset(&tracedLoaded, 0, sizeof(tracedLoaded));
+    DataSerialiser tracedLoader(false, forwarded);
+    tracedLoaded.Serialise(tracedLoader);
+
+    for (const auto* result : { &loaded, &tracedLoaded })
+    {
+        ASSERT_EQ(result->u8, values.u8);
+        ASSERT_EQ(result->i8, values.i8);
+        ASSERT_EQ(result->u16, values.u16);
+        ASSERT_EQ(result->i16, values.i16);
+        ASSERT_EQ(result->u32, values.u32);
+        ASSERT_EQ(result->i32, values.i32);
+        ASSERT_EQ(result->u64, values.u64);
+        ASSERT_EQ(result->i64, values.i64);
+        ASSERT_EQ(result->flag, values.flag);
+        ASSERT_EQ(result->enumValue, values.enumValue);
+        ASSERT_STREQ(result->text, values.text);
+        ASSERT_EQ(std::memcmp(result->shorts, values.shorts, sizeof(values.shorts)), 0);
+        ASSERT_EQ(std::memcmp(result->ints, values.ints, sizeof(values.ints)), 0);
+        ASSERT_EQ(result->bytes, values.bytes);
+        ASSERT_EQ(result->intArray, values.intArray);
+        ASSERT_EQ(result->enums, values.enums);
+    }
+}
+
+TEST(DataSerialiserTest, arraySizeMismatchThrows)
+{
+    std::array<uint32_t, 3> values = { 1, 2, 3 };
+    MemoryStream stream;
+    DataSerialiser saver(true, stream);
+    saver << values;
+
+    std::array<uint32_t, 2> smaller{};
+    stream.SetPosition(0);
+    DataSerialiser loader(false, stream);
+    ASSERT_THROW(loader << smaller, std::runtime_error);
+}
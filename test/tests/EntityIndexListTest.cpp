@@ -0,0 +1,76 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+#include <gtest/gtest.h>
+#include <openrct2/world/EntityList.h>
+#include <vector>
+
+static std::vector<uint16_t> ToVector(const EntityIndexList& list)
+{
+    return std::vector<uint16_t>(list.begin(), list.end());
+}
+
+TEST(EntityIndexListTest, empty)
+{
+    EntityIndexList list;
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(list.size(), 0U);
+    ASSERT_EQ(list.begin(), list.end());
+}
+
+TEST(EntityIndexListTest, iteratesInIndexOrder)
+{
+    EntityIndexList list;
+    for (uint16_t index : { 9999, 64, 0, 63, 65, 500, 128 })
+    {
+        list.insert(index);
+    }
+    ASSERT_EQ(list.size(), 7U);
+    ASSERT_EQ(ToVector(list), (std::vector<uint16_t>{ 0, 63, 64, 65, 128, 500, 9999 }));
+}
+
+TEST(EntityIndexListTest, insertAndErase)
+{
+    EntityIndexList list;
+    list.insert(5);
+    list.insert(5);
+    ASSERT_EQ(list.size(), 1U);
+    ASSERT_TRUE(list.contains(5));
+
+    list.erase(6);
+    ASSERT_EQ(list.size(), 1U);
+
+    list.erase(5);
+    ASSERT_FALSE(list.contains(5));
+    ASSERT_TRUE(list.empty());
+
+    list.insert(MAX_ENTITIES);
+    ASSERT_TRUE(list.empty());
+}
+
+TEST(EntityIndexListTest, eraseWhileIterating)
+{
+    EntityIndexList list;
+    for (uint16_t i = 0; i < 200; i++)
+    {
+        list.insert(i);
+    }
+
+    std::vector<uint16_t> visited;
+    for (auto index : list)
+    {
+        visited.push_back(index);
+        list.erase(index);
+        // Removing an index that has not been visited yet must skip it.
+        list.erase(index + 2);
+    }
+    ASSERT_EQ(visited.size(), 100U);
+    ASSERT_EQ(visited[1], 1);
+    ASSERT_EQ(visited[2], 4);
+    ASSERT_TRUE(list.empty());
+}
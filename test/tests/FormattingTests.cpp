@@ -44,6 +44,29 @@ TEST_F(FmtStringTests, iteration)
     ASSERT_EQ("[29:{BLACK}][1:Guests: ][8:{INT32}]", actual);
 }
 
+TEST_F(FmtStringTests, iteration_tokenised)
+{
+    std::string expected;
+    std::string actual;
+
+    std::string_view str = "{BLACK}Guests: {INT32}{NEWLINE}{{ESCAPED}}";
+    std::vector<FmtString::token> tokens;
+    for (const auto& t : FmtString(str))
+    {
+        expected += String::StdFormat("[%d:%s]", t.kind, std::string(t.text).c_str());
+        tokens.push_back(t);
+    }
+
+    auto fmt = FmtString(str, tokens);
+    for (const auto& t : fmt)
+    {
+        actual += String::StdFormat("[%d:%s]", t.kind, std::string(t.text).c_str());
+    }
+
+    ASSERT_EQ(expected, actual);
+    ASSERT_EQ(FmtString(str).WithoutFormatTokens(), fmt.WithoutFormatTokens());
+}
+
 TEST_F(FmtStringTests, iteration_escaped)
 {
     std::string actual;
@@ -7,11 +7,15 @@
  * OpenRCT2 is licensed under the GNU General Public License version 3.
  *****************************************************************************/
 
+#include "TestData.h"
+#include "openrct2/core/File.h"
+#include "openrct2/core/Path.hpp"
 #include "openrct2/localisation/LanguagePack.h"
 
 #include "openrct2/localisation/Language.h"
 #include "openrct2/localisation/StringIds.h"
 
+#include <cstring>
 #include <gtest/gtest.h>
 
 class LanguagePackTest : public testing::Test
@@ -73,6 +77,41 @@ TEST_F(LanguagePackTest, language_pack_multibyte)
     delete lang;
 }
 
+TEST_F(LanguagePackTest, language_pack_cache)
+{
+    auto sourcePath = Path::Combine(TestData::GetBasePath(), "language_cache_test.txt");
+    auto cachePath = Path::Combine(TestData::GetBasePath(), "language_cache_test.dat");
+    File::WriteAllBytes(sourcePath, LanguageEnGB, std::strlen(LanguageEnGB));
+    File::Delete(cachePath);
+
+    // First load parses the text and writes the cache, second load reads the cache
+    for (int i = 0; i < 2; i++)
+    {
+        ILanguagePack* lang = LanguagePackFactory::FromFile(0, sourcePath.c_str(), cachePath);
+        ASSERT_NE(lang, nullptr);
+        ASSERT_TRUE(File::Exists(cachePath));
+        ASSERT_EQ(lang->GetCount(), 4U);
+        ASSERT_STREQ(lang->GetString(2), "Spiral Roller Coaster");
+        ASSERT_EQ(lang->GetScenarioOverrideStringId("Arid Heights", 0), 0x7000);
+        ASSERT_STREQ(lang->GetString(0x7000), "Arid Heights scenario string");
+        ASSERT_EQ(lang->GetObjectOverrideStringId("CONDORRD", 0), 0x6000);
+        ASSERT_STREQ(lang->GetString(0x6000), "my test ride");
+        lang->SetString(2, "xx");
+        ASSERT_STREQ(lang->GetString(2), "xx");
+        delete lang;
+    }
+
+    // A cache written for a different language is ignored
+    ILanguagePack* lang = LanguagePackFactory::FromFile(1, sourcePath.c_str(), cachePath);
+    ASSERT_NE(lang, nullptr);
+    ASSERT_EQ(lang->GetId(), 1);
+    ASSERT_STREQ(lang->GetString(2), "Spiral Roller Coaster");
+    delete lang;
+
+    File::Delete(sourcePath);
+    File::Delete(cachePath);
+}
+
 const utf8* LanguagePackTest::LanguageEnGB = "# STR_XXXX part is read and XXXX becomes the string id number.\n"
                                              "# Everything after the colon and before the new line will be saved as the "
                                              "string.\n"
@@ -0,0 +1,88 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <openrct2/core/Memory.hpp>
+#include <openrct2/core/MemoryStream.h>
+
+using namespace OpenRCT2;
+
+TEST(MemoryStreamTest, reserveDoesNotChangeContents)
+{
+    MemoryStream stream;
+    uint32_t value = 0x12345678;
+    stream.WriteValue(value);
+    stream.Reserve(1024);
+    ASSERT_GE(stream.GetCapacity(), 1024U);
+    ASSERT_EQ(stream.GetLength(), sizeof(value));
+    ASSERT_EQ(stream.GetPosition(), sizeof(value));
+
+    stream.SetPosition(0);
+    ASSERT_EQ(stream.ReadValue<uint32_t>(), value);
+}
+
+TEST(MemoryStreamTest, clearKeepsBuffer)
+{
+    MemoryStream stream(256);
+    const auto* data = stream.GetData();
+    for (uint32_t i = 0; i < 64; i++)
+    {
+        stream.WriteValue(i);
+    }
+    stream.Clear();
+    ASSERT_EQ(stream.GetLength(), 0U);
+    ASSERT_EQ(stream.GetPosition(), 0U);
+    ASSERT_EQ(stream.GetData(), data);
+
+    stream.WriteValue<uint32_t>(7);
+    ASSERT_EQ(stream.GetLength(), sizeof(uint32_t));
+    ASSERT_EQ(stream.GetData(), data);
+}
+
+TEST(MemoryStreamTest, reserveIgnoresBorrowedBuffers)
+{
+    uint8_t buffer[16] = {};
+    MemoryStream stream(buffer, sizeof(buffer), MEMORY_ACCESS::READ | MEMORY_ACCESS::WRITE);
+    stream.Reserve(1024);
+    ASSERT_EQ(stream.GetData(), buffer);
+    ASSERT_EQ(stream.GetCapacity(), sizeof(buffer));
+}
+
+TEST(MemoryStreamTest, poolReusesReleasedBuffers)
+{
+    MemoryStreamPool pool;
+    const void* data = nullptr;
+    {
+        PooledMemoryStream stream(pool, 128);
+        stream->WriteValue<uint64_t>(1);
+        data = stream->GetData();
+    }
+    {
+        PooledMemoryStream stream(pool);
+        ASSERT_EQ(stream->GetData(), data);
+        ASSERT_EQ(stream->GetLength(), 0U);
+        ASSERT_GE(stream->GetCapacity(), 128U);
+    }
+}
+
+TEST(MemoryStreamTest, poolSkipsStreamsThatGaveAwayTheirData)
+{
+    MemoryStreamPool pool;
+    void* taken = nullptr;
+    {
+        PooledMemoryStream stream(pool, 128);
+        stream->WriteValue<uint64_t>(1);
+        taken = stream->TakeData();
+    }
+    {
+        PooledMemoryStream stream(pool);
+        ASSERT_NE(stream->GetData(), taken);
+    }
+    Memory::Free(taken);
+}
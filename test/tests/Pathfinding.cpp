@@ -251,3 +251,32 @@ INSTANTIATE_TEST_CASE_P(
         SimplePathfindingScenario("PathWithFences", { 11, 6, 14 }, 10000),
         SimplePathfindingScenario("PathWithCliff", { 7, 17, 14 }, 10000)),
     SimplePathfindingScenario::ToName);
+
+class PathfindingStatsTest : public PathfindingTestBase
+{
+};
+
+TEST_F(PathfindingStatsTest, CountsSearchesOfRoutesWithJunctions)
+{
+    TileCoordsXYZ pos = { 3, 13, 14 };
+    auto ride = FindRideByName("TwoUnequalRoutes");
+    ASSERT_NE(ride, nullptr);
+
+    auto entrancePos = ride_get_entrance_location(ride, 0);
+    TileCoordsXYZ goal = TileCoordsXYZ(
+        entrancePos.x - TileDirectionDelta[entrancePos.direction].x,
+        entrancePos.y - TileDirectionDelta[entrancePos.direction].y, entrancePos.z);
+
+    peep_pathfind_reset_stats();
+    EXPECT_TRUE(FindPath(&pos, goal, 89, ride->id));
+
+    auto stats = peep_pathfind_get_stats();
+    EXPECT_GT(stats.Calls, 0U);
+    EXPECT_GT(stats.Searches + stats.CachedSearches, 0U);
+    EXPECT_GT(stats.TilesChecked, 0U);
+    EXPECT_LE(stats.MaxDepth, 200U);
+    EXPECT_LT(stats.FailedCalls, stats.Calls);
+
+    peep_pathfind_reset_stats();
+    EXPECT_EQ(peep_pathfind_get_stats().Calls, 0U);
+}
@@ -12,6 +12,7 @@
 
 #include <gtest/gtest.h>
 #include <openrct2/core/String.hpp>
+#include <openrct2/localisation/Language.h>
 #include <openrct2/util/Util.h>
 #include <string>
 #include <tuple>
@@ -203,3 +204,18 @@ TEST_F(CodepointViewTest, CodepointView_iterate)
     AssertCodepoints("ゲスト", { U'ゲ', U'ス', U'ト' });
     AssertCodepoints("<🎢>", { U'<', U'🎢', U'>' });
 }
+
+TEST_F(CodepointViewTest, CodepointView_iterate_mixed)
+{
+    AssertCodepoints("Guest 1 ゲスト", { 'G', 'u', 'e', 's', 't', ' ', '1', ' ', U'ゲ', U'ス', U'ト' });
+    AssertCodepoints("Ärger über Öl", { U'Ä', 'r', 'g', 'e', 'r', ' ', U'ü', 'b', 'e', 'r', ' ', U'Ö', 'l' });
+}
+
+TEST_F(CodepointViewTest, utf8_length)
+{
+    ASSERT_EQ(utf8_length(""), 0);
+    ASSERT_EQ(utf8_length("test"), 4);
+    ASSERT_EQ(utf8_length("A long ASCII only guest name"), 28);
+    ASSERT_EQ(utf8_length("ゲスト"), 3);
+    ASSERT_EQ(utf8_length("Roller coaster <🎢> Guest ゲスト"), 28);
+}
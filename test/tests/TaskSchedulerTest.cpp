@@ -0,0 +1,68 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+#include <atomic>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <openrct2/core/JobPool.h>
+#include <openrct2/core/TaskScheduler.h>
+#include <vector>
+
+using namespace OpenRCT2;
+
+TEST(TaskSchedulerTest, parallelForVisitsEveryIndexOnce)
+{
+    std::vector<std::atomic<int32_t>> visits(10000);
+    TaskScheduler::Get().ParallelFor(0, visits.size(), 16, [&visits](size_t i) { visits[i]++; });
+    for (const auto& count : visits)
+    {
+        ASSERT_EQ(count, 1);
+    }
+}
+
+TEST(TaskSchedulerTest, parallelForEmptyRange)
+{
+    int32_t calls = 0;
+    TaskScheduler::Get().ParallelFor(5, 5, 1, [&calls](size_t) { calls++; });
+    ASSERT_EQ(calls, 0);
+}
+
+TEST(TaskSchedulerTest, nestedParallelFor)
+{
+    std::atomic<size_t> sum{ 0 };
+    TaskScheduler::Get().ParallelFor(0, 32, 1, [&sum](size_t) {
+        TaskScheduler::Get().ParallelFor(0, 100, 10, [&sum](size_t j) { sum += j; });
+    });
+    ASSERT_EQ(sum, 32U * 4950U);
+}
+
+TEST(TaskSchedulerTest, jobPoolRunsCompletionsOnJoin)
+{
+    std::atomic<int32_t> work{ 0 };
+    int32_t completions = 0;
+    int32_t reports = 0;
+    JobPool jobPool;
+    for (int32_t i = 0; i < 100; i++)
+    {
+        jobPool.AddTask([&work]() { work++; }, [&completions]() { completions++; });
+    }
+    jobPool.Join([&reports]() { reports++; });
+    ASSERT_EQ(work, 100);
+    ASSERT_EQ(completions, 100);
+    ASSERT_GE(reports, 1);
+    ASSERT_EQ(jobPool.CountPending(), 0U);
+}
+
+TEST(TaskSchedulerTest, configureAfterStartIsRejected)
+{
+    auto workerCount = TaskScheduler::Get().GetWorkerCount();
+    TaskSchedulerOptions options;
+    options.WorkerCount = workerCount + 1;
+    ASSERT_FALSE(TaskScheduler::Configure(options));
+    ASSERT_EQ(TaskScheduler::Get().GetWorkerCount(), workerCount);
+}
@@ -7,10 +7,12 @@
  * OpenRCT2 is licensed under the GNU General Public License version 3.
  *****************************************************************************/
 
+#include <algorithm>
 #include <gtest/gtest.h>
 #include <openrct2/core/MemoryStream.h>
 #include <openrct2/rct12/SawyerChunkReader.h>
 #include <openrct2/util/SawyerCoding.h>
+#include <vector>
 
 constexpr size_t BUFFER_SIZE = 0x600000;
 
@@ -32,13 +34,18 @@ protected:
     static const uint8_t empty[1];
 
     void test_encode_decode(uint8_t encoding_type)
+    {
+        test_encode_decode(encoding_type, randomdata, sizeof(randomdata));
+    }
+
+    void test_encode_decode(uint8_t encoding_type, const uint8_t* data, size_t size)
     {
         // Encode
         sawyercoding_chunk_header chdr_in;
         chdr_in.encoding = encoding_type;
-        chdr_in.length = sizeof(randomdata);
+        chdr_in.length = static_cast<uint32_t>(size);
         uint8_t* encodedDataBuffer = new uint8_t[BUFFER_SIZE];
-        size_t encodedDataSize = sawyercoding_write_chunk_buffer(encodedDataBuffer, (const uint8_t*)randomdata, chdr_in);
+        size_t encodedDataSize = sawyercoding_write_chunk_buffer(encodedDataBuffer, data, chdr_in);
         ASSERT_GT(encodedDataSize, sizeof(sawyercoding_chunk_header));
 
         // Decode
@@ -47,12 +54,40 @@ protected:
         auto chunk = reader.ReadChunk();
         ASSERT_EQ(static_cast<uint8_t>(chunk->GetEncoding()), chdr_in.encoding);
         ASSERT_EQ(chunk->GetLength(), chdr_in.length);
-        auto result = memcmp(chunk->GetData(), randomdata, sizeof(randomdata));
+        auto result = memcmp(chunk->GetData(), data, size);
         ASSERT_EQ(result, 0);
 
         delete[] encodedDataBuffer;
     }
 
+    /**
+     * Mixes runs and literals of many lengths, including ones longer than the vectorised scans and the RLE limits.
+     */
+    static std::vector<uint8_t> create_pattern_data()
+    {
+        std::vector<uint8_t> data;
+        uint32_t state = 12345;
+        auto next = [&state]() {
+            state = state * 1103515245 + 12345;
+            return static_cast<uint8_t>(state >> 16);
+        };
+        for (size_t length = 1; length < 300; length += 7)
+        {
+            data.insert(data.end(), length, next());
+            for (size_t i = 0; i < length; i++)
+            {
+                data.push_back(next());
+            }
+            for (size_t i = 0; i < length; i++)
+            {
+                data.push_back(data[data.size() - 1 - (next() % 8)]);
+            }
+        }
+        // Leave a tail that is not a multiple of the vector width
+        data.resize(data.size() - data.size() % 16 + 5);
+        return data;
+    }
+
     void test_decode(const uint8_t* data, size_t size)
     {
         auto expectedLength = size - sizeof(sawyercoding_chunk_header);
@@ -67,6 +102,28 @@ protected:
         auto result = memcmp(chunk->GetData(), randomdata, sizeof(randomdata));
         ASSERT_EQ(result, 0);
     }
+
+    void test_decode_into(const uint8_t* data, size_t size, size_t dstLength)
+    {
+        OpenRCT2::MemoryStream ms(data, size);
+        SawyerChunkReader reader(&ms);
+        std::vector<uint8_t> dst(dstLength, 0xAA);
+        reader.ReadChunk(dst.data(), dst.size());
+
+        auto copiedLength = std::min(dstLength, sizeof(randomdata));
+        ASSERT_EQ(memcmp(dst.data(), randomdata, copiedLength), 0);
+        for (size_t i = copiedLength; i < dstLength; i++)
+        {
+            ASSERT_EQ(dst[i], 0);
+        }
+    }
+
+    void test_decode_into(const uint8_t* data, size_t size)
+    {
+        test_decode_into(data, size, sizeof(randomdata));
+        test_decode_into(data, size, sizeof(randomdata) + 100);
+        test_decode_into(data, size, sizeof(randomdata) - 100);
+    }
 };
 
 TEST_F(SawyerCodingTest, write_read_chunk_none)
@@ -89,6 +146,24 @@ TEST_F(SawyerCodingTest, write_read_chunk_rotate)
     test_encode_decode(CHUNK_ENCODING_ROTATE);
 }
 
+TEST_F(SawyerCodingTest, write_read_chunk_rle_pattern)
+{
+    auto data = create_pattern_data();
+    test_encode_decode(CHUNK_ENCODING_RLE, data.data(), data.size());
+}
+
+TEST_F(SawyerCodingTest, write_read_chunk_rle_compressed_pattern)
+{
+    auto data = create_pattern_data();
+    test_encode_decode(CHUNK_ENCODING_RLECOMPRESSED, data.data(), data.size());
+}
+
+TEST_F(SawyerCodingTest, write_read_chunk_rotate_pattern)
+{
+    auto data = create_pattern_data();
+    test_encode_decode(CHUNK_ENCODING_ROTATE, data.data(), data.size());
+}
+
 // Note we only check if provided data decompresses to the same data, not if it compresses the same.
 // The reason for that is we may improve encoding at some point, but the test won't be affected,
 // as we already do a decode test and roundtrip (encode + decode), which validates all uses.
@@ -114,6 +189,26 @@ TEST_F(SawyerCodingTest, decode_chunk_rotate)
     test_decode(rotatedata, sizeof(rotatedata));
 }
 
+TEST_F(SawyerCodingTest, decode_chunk_into_buffer_none)
+{
+    test_decode_into(nonedata, sizeof(nonedata));
+}
+
+TEST_F(SawyerCodingTest, decode_chunk_into_buffer_rle)
+{
+    test_decode_into(rledata, sizeof(rledata));
+}
+
+TEST_F(SawyerCodingTest, decode_chunk_into_buffer_rlecompressed)
+{
+    test_decode_into(rlecompresseddata, sizeof(rlecompresseddata));
+}
+
+TEST_F(SawyerCodingTest, decode_chunk_into_buffer_rotate)
+{
+    test_decode_into(rotatedata, sizeof(rotatedata));
+}
+
 TEST_F(SawyerCodingTest, invalid1)
 {
     OpenRCT2::MemoryStream ms(invalid1, sizeof(invalid1));